@@ -0,0 +1,46 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//#version 430 core
+
+layout(location = 0) in vec2 vertPosition;   // unit quad corner, [-1, 1]
+
+layout(location = 1) in vec3 instPosition;   // world-space center
+layout(location = 2) in float instRadius;    // world-space half size
+layout(location = 3) in vec4 instUvRect;     // xy: atlas tile offset, zw: tile size
+
+layout(location = 0) uniform mat4 viewProj;  // spans locations 0..3
+layout(location = 4) uniform vec3 camRight;
+layout(location = 5) uniform vec3 camUp;
+
+out vec2 uv;
+
+void main()
+{
+    vec3 worldPos = instPosition
+                  + (camRight * vertPosition.x + camUp * vertPosition.y) * instRadius;
+    gl_Position = viewProj * vec4(worldPos, 1.0);
+    uv = instUvRect.xy + (vertPosition * 0.5 + 0.5) * instUvRect.zw;
+}
@@ -35,6 +35,12 @@
 in vec3 normal;
 in vec3 fragPos;
 
+/* Per-instance animation state forwarded from the vertex shader; power is
+   the engine throttle, and the time offset desynchronizes flicker between
+   engines without per-draw uniform updates */
+flat in float instPower;
+flat in float instTimeOffset;
+
 layout(location = 0, index = 0) out vec4 color;
 
 /* Z position of plume ends
@@ -56,10 +62,9 @@ layout(location = 6) uniform sampler2D combustionNoiseTex;
 layout(location = 7) uniform vec4 baseColor;
 
 layout(location = 8) uniform float flowVelocity;
-layout(location = 9) uniform float time;
 
-// Engine power, which is the primary influence on plume density
-layout(location = 10) uniform float power;
+// Shared frame time, set once per frame rather than once per draw
+layout(location = 9) uniform float time;
 
 const float PI = 3.14159265358;
 float height = topZ - bottomZ;
@@ -87,7 +92,7 @@ vec2 plumeCoords(vec3 rect)
 vec2 scrollUV(vec2 UV)
 {
     float tmpI;
-    float scrollFac = modf(UV.y - time*flowVelocity, tmpI);
+    float scrollFac = modf(UV.y - (time - instTimeOffset)*flowVelocity, tmpI);
     scrollFac = float(scrollFac < 0.0)*(scrollFac + 1.0) + float(scrollFac >= 0.0)*scrollFac;
     return vec2(UV.x, scrollFac);
 }
@@ -148,7 +153,7 @@ void main()
 
     float combust = mix(1.0, combustValue, vertFadeFactor);
     float nozzle = mix(1.0, nozzleValue, nozzleNoiseFactor);
-    float throttle = mix(1.0, power, throttleFadeFactor);
+    float throttle = mix(1.0, instPower, throttleFadeFactor);
     float diffusion = (1.0 - plumeFactor);
 
     // The final plume density is the product of all these factors
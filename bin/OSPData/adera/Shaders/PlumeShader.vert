@@ -28,8 +28,18 @@ layout(location = 0) in vec4 vertPosition;
 layout(location = 1) in vec2 vertTexCoords;
 layout(location = 5) in vec3 vertNormal;
 
+/* Per-instance animation state: x = throttle, y = time offset
+
+ * Written by the CPU only when an engine's throttle changes; scale and
+   flicker animation are derived from it here and in the fragment shader,
+   so steady-state engines cost no uniform traffic at all.
+*/
+layout(location = 2) in vec2 instAnim;
+
 out vec3 normal;
 out vec3 fragPos;
+flat out float instPower;
+flat out float instTimeOffset;
 
 layout(location = 0) uniform mat4 projMat;
 layout(location = 1) uniform mat4 modelTransformMat;
@@ -37,10 +47,18 @@ layout(location = 2) uniform mat3 normalMat;
 
 void main()
 {
-    gl_Position = projMat * modelTransformMat * vertPosition;
+    /* Stretch the free plume (below the nozzle aperture at -Z) with throttle;
+       the in-nozzle portion keeps its shape */
+    float tailScale = mix(0.2, 1.0, instAnim.x);
+    vec4 pos = vertPosition;
+    pos.z *= (pos.z < 0.0) ? tailScale : 1.0;
+
+    gl_Position = projMat * modelTransformMat * pos;
     normal = normalMat * vertNormal;
 
     // Send vert position to frag shader for UV calculation
-    fragPos = vec3(vertPosition);
+    fragPos = vec3(pos);
+    instPower = instAnim.x;
+    instTimeOffset = instAnim.y;
 }
 
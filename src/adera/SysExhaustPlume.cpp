@@ -133,7 +133,11 @@ void attach_plume_effect(ActiveScene &rScene, ActiveEnt part, ActiveEnt mach)
         return;
     }
 
-    rScene.reg_emplace<ACompExhaustPlume>(plumeNode, mach, plumeEffect);
+    ACompExhaustPlume &rPlume
+            = rScene.reg_emplace<ACompExhaustPlume>(plumeNode, mach, plumeEffect);
+
+    // Spread flicker phases out so engines don't pulse in unison
+    rPlume.m_timeOffset = 0.137f * float(entt::to_integral(plumeNode));
 
     // Add Plume mesh
 
@@ -196,31 +200,35 @@ void SysExhaustPlume::update_construct(ActiveScene& rScene) noexcept
     }
 }
 
-// TODO: workaround. add an actual way to keep time accessible from ActiveScene
-float g_time = 0;
-
 void SysExhaustPlume::update_plumes(ActiveScene& rScene) noexcept
 {
-    g_time += rScene.get_time_delta_fixed();
-
     using adera::active::machines::MCompRocket;
     using osp::active::ACompVisible;
 
     osp::active::ActiveReg_t& reg = rScene.get_registry();
 
-    // Process plumes
+    // Scale and flicker animation run on the GPU, driven by each plume's
+    // (throttle, time offset) instance attribute. The CPU only flags a plume
+    // when its throttle actually changes; PlumeShader::sync_animation then
+    // rewrites that one buffer slot.
     auto plumeView = reg.view<ACompExhaustPlume>();
     for (ActiveEnt plumeEnt : plumeView)
     {
         auto& plume = plumeView.get<ACompExhaustPlume>(plumeEnt);
-        plume.m_time = g_time;
 
         auto& machine = rScene.reg_get<MCompRocket>(plume.m_parentMCompRocket);
-        float powerLevel = machine.current_output_power();
+        float const powerLevel = machine.current_output_power();
+
+        if (powerLevel == plume.m_powerLevel)
+        {
+            continue; // Steady state, nothing to write
+        }
+
+        plume.m_powerLevel = powerLevel;
+        plume.m_animDirty = true;
 
         if (powerLevel > 0.0f)
         {
-            plume.m_powerLevel = powerLevel;
             rScene.get_registry().emplace_or_replace<ACompVisible>(plumeEnt);
         }
         else
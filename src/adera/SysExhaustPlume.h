@@ -27,6 +27,8 @@
 
 #include <entt/entity/entity.hpp>    // for null, null_t
 
+#include <cstdint>                   // for uint32_t
+
 namespace osp { namespace active { class ActiveScene; } }
 
 namespace adera::active
@@ -36,8 +38,17 @@ struct ACompExhaustPlume
 {
     PlumeEffectData m_effect;
 
-    float m_time{0.0f};
+    /// Slot in ACtxPlumeData's per-instance animation buffer
+    uint32_t m_animSlot{0};
+
+    /// Desynchronizes flicker between engines; constant per plume
+    float m_timeOffset{0.0f};
+
     float m_powerLevel{0.0f};
+
+    /// Set when m_powerLevel changes, cleared once the animation buffer slot
+    /// is rewritten; scale/flicker animation itself runs on the GPU
+    bool m_animDirty{true};
 };
 
 class SysExhaustPlume
@@ -38,13 +38,15 @@ VehicleBuilder::~VehicleBuilder()
     // clear resource owners
     for ([[maybe_unused]] auto && [_, value] : std::exchange(m_prefabs, {}))
     {
-        m_pResources->owner_destroy(gc_importer, std::move(value.m_importer));
+        m_pResources->owner_destroy_later(gc_importer, std::move(value.m_importer));
     }
 
     for ([[maybe_unused]] auto && rPrefabPair : std::exchange(m_data->m_partPrefabs, {}))
     {
-        m_pResources->owner_destroy(gc_importer, std::move(rPrefabPair.m_importer));
+        m_pResources->owner_destroy_later(gc_importer, std::move(rPrefabPair.m_importer));
     }
+
+    m_pResources->owner_destroy_flush();
 }
 
 void VehicleBuilder::set_prefabs(std::initializer_list<SetPrefab> const& setPrefabs)
@@ -245,6 +247,20 @@ VehicleData VehicleBuilder::finalize_release()
         }
     }
 
+    // Compile flat snapshots of the completed link graph, so spawning streams
+    // contiguous arrays through the remap tables instead of re-walking maps
+    for (PerNodeType &rPerNodeType : rData.m_nodePerType)
+    {
+        osp::link::snapshot_nodes(rPerNodeType, rData.m_machines,
+                                  rPerNodeType.m_snapshot);
+
+        rPerNodeType.m_nodesUsed.reserve(rPerNodeType.nodeIds.size());
+        for (NodeId const node : rPerNodeType.nodeIds.bitview().zeros())
+        {
+            rPerNodeType.m_nodesUsed.push_back(node);
+        }
+    }
+
     // Reserve part-to-machine partitions
     using osp::link::MachinePair;
     rData.m_partToMachines.ids_reserve(rData.m_partIds.capacity());
@@ -277,6 +293,26 @@ VehicleData VehicleBuilder::finalize_release()
         return count == 0;
     }));
 
+    // Flatten live ids into sorted tables consumed by SysVehicleSpawnVB; each
+    // vehicle's id bitmaps are scanned once here instead of per spawn task
+    rData.m_partsUsed.reserve(rData.m_partIds.size());
+    for (PartId const part : rData.m_partIds.bitview().zeros())
+    {
+        rData.m_partsUsed.push_back(part);
+    }
+
+    rData.m_weldsUsed.reserve(rData.m_weldIds.size());
+    for (WeldId const weld : rData.m_weldIds.bitview().zeros())
+    {
+        rData.m_weldsUsed.push_back(weld);
+    }
+
+    rData.m_machsUsed.reserve(rData.m_machines.ids.size());
+    for (MachAnyId const mach : rData.m_machines.ids.bitview().zeros())
+    {
+        rData.m_machsUsed.push_back(mach);
+    }
+
     VehicleData dataOut{std::move(*m_data)};
     m_data.emplace();
     return dataOut;
@@ -63,6 +63,10 @@ struct PerNodeType : osp::link::Nodes
     entt::any               m_nodeValues;
     std::vector<int>        m_nodeConnectCount;
     int                     m_connectCountTotal{0};
+
+    // Compiled by finalize_release; used to stamp out copies when spawning
+    osp::link::NodesSnapshot m_snapshot;
+    std::vector<osp::link::NodeId> m_nodesUsed;
 };
 
 struct VehicleData
@@ -87,6 +91,12 @@ struct VehicleData
     std::vector<PartId>                     m_machToPart;
 
     std::vector<PerNodeType>                m_nodePerType;
+
+    // Live ids flattened into sorted tables by finalize_release, so spawn-time
+    // loops stream them directly instead of re-scanning id bitmaps per vehicle
+    std::vector<PartId>                     m_partsUsed;
+    std::vector<WeldId>                     m_weldsUsed;
+    std::vector<osp::link::MachAnyId>       m_machsUsed;
 };
 
 /**
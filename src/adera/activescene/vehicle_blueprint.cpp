@@ -0,0 +1,425 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "vehicle_blueprint.h"
+
+#include <osp/core/Resources.h>
+#include <osp/link/signal.h>
+#include <osp/util/logging.h>
+#include <osp/vehicles/ImporterData.h>
+#include <osp/vehicles/pack_io.h>
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+
+using namespace adera;
+
+using osp::restypes::gc_importer;
+
+using osp::ArrayView;
+using osp::PackFileView;
+using osp::PackReader;
+using osp::PackWriter;
+using osp::PrefabId;
+using osp::PrefabIndex_t;
+using osp::ResId;
+using osp::Resources;
+
+using osp::index_prefabs;
+using osp::read_multimap;
+using osp::read_table;
+using osp::read_vector;
+using osp::registry_count;
+using osp::registry_create_dense;
+using osp::write_multimap;
+using osp::write_table;
+
+using osp::link::NodesSnapshot;
+using osp::link::PerMachType;
+using osp::link::SignalValues_t;
+
+namespace
+{
+
+constexpr std::array<char, 8> sc_blueprintMagic{'O', 'S', 'P', 'V', 'H', 'B', '\0', '\1'};
+
+bool write_vehicle(PackWriter &rWriter, VehicleData const& data, Resources const& rResources)
+{
+    auto const partCount = registry_count(data.m_partIds);
+    auto const weldCount = registry_count(data.m_weldIds);
+    auto const machCount = registry_count(data.m_machines.ids);
+
+    rWriter.write(partCount);
+    rWriter.write(weldCount);
+    rWriter.write(machCount);
+    rWriter.write(std::uint32_t(data.m_machines.perType.size()));
+    rWriter.write(std::uint32_t(data.m_nodePerType.size()));
+
+    // Parts
+    write_table(rWriter, data.m_partTransformWeld.data(), partCount);
+    write_table(rWriter, data.m_partToWeld.data(), partCount);
+    for (std::uint32_t part = 0; part < partCount; ++part)
+    {
+        osp::PrefabPair const &rPair = data.m_partPrefabs[part];
+        if (rPair.m_importer.has_value())
+        {
+            auto const &rPrefabData = rResources.data_get<osp::Prefabs const>(
+                    gc_importer, rPair.m_importer.value());
+            rWriter.write_string(rPrefabData.m_prefabNames[rPair.m_prefabId]);
+        }
+        else
+        {
+            rWriter.write_string("");
+        }
+    }
+    write_multimap(rWriter, data.m_partToMachines, partCount);
+
+    // Welds
+    write_multimap(rWriter, data.m_weldToParts, weldCount);
+
+    // Machines
+    write_table(rWriter, data.m_machines.machTypes.data(), machCount);
+    write_table(rWriter, data.m_machines.machToLocal.data(), machCount);
+    write_table(rWriter, data.m_machToPart.data(), machCount);
+    for (PerMachType const& rPerMachType : data.m_machines.perType)
+    {
+        auto const localCount = registry_count(rPerMachType.localIds);
+        rWriter.write(localCount);
+        write_table(rWriter, rPerMachType.localToAny.data(), localCount);
+    }
+
+    // Nodes
+    for (PerNodeType const& rPerNodeType : data.m_nodePerType)
+    {
+        auto const nodeCount = registry_count(rPerNodeType.nodeIds);
+        rWriter.write(nodeCount);
+        write_multimap(rWriter, rPerNodeType.nodeToMach, nodeCount);
+        write_multimap(rWriter, rPerNodeType.machToNode, machCount);
+        write_multimap(rWriter, rPerNodeType.m_machToNodeCustom, machCount);
+
+        if (auto const *pValues = entt::any_cast< SignalValues_t<float> >(&rPerNodeType.m_nodeValues);
+            pValues != nullptr)
+        {
+            rWriter.write(std::uint8_t(1));
+            write_table(rWriter, pValues->data(), nodeCount);
+        }
+        else if ( ! bool(rPerNodeType.m_nodeValues))
+        {
+            rWriter.write(std::uint8_t(0));
+        }
+        else
+        {
+            return false; // Node value type this format doesn't know how to store
+        }
+
+        write_table(rWriter, rPerNodeType.m_nodeConnectCount.data(), nodeCount);
+        rWriter.write(std::int32_t(rPerNodeType.m_connectCountTotal));
+
+        NodesSnapshot const &rSnapshot = rPerNodeType.m_snapshot;
+        rWriter.write(rSnapshot.nodeCount);
+        write_table(rWriter, rSnapshot.juncFirst.data(), rSnapshot.juncFirst.size());
+        write_table(rWriter, rSnapshot.juncs.data(),     rSnapshot.juncs.size());
+        write_table(rWriter, rSnapshot.portFirst.data(), rSnapshot.portFirst.size());
+        write_table(rWriter, rSnapshot.ports.data(),     rSnapshot.ports.size());
+    }
+
+    return true;
+}
+
+bool read_vehicle(PackReader &rReader, Resources &rResources,
+                  PrefabIndex_t const& prefabs, VehicleData &rData)
+{
+    auto const partCount     = rReader.read<std::uint32_t>();
+    auto const weldCount     = rReader.read<std::uint32_t>();
+    auto const machCount     = rReader.read<std::uint32_t>();
+    auto const machTypeCount = rReader.read<std::uint32_t>();
+    auto const nodeTypeCount = rReader.read<std::uint32_t>();
+
+    if (   rReader.fail
+        || machTypeCount != osp::link::MachTypeReg_t::size()
+        || nodeTypeCount != osp::link::NodeTypeReg_t::size())
+    {
+        return false; // Registered link types changed since this file was written
+    }
+
+    // Parts
+    registry_create_dense(rData.m_partIds, partCount);
+    std::size_t const partCapacity = rData.m_partIds.capacity();
+    rData.m_partTransformWeld   .resize(partCapacity);
+    rData.m_partPrefabs         .resize(partCapacity);
+    rData.m_partToWeld          .resize(partCapacity);
+    if (   ! read_table(rReader, rData.m_partTransformWeld.data(), partCount)
+        || ! read_table(rReader, rData.m_partToWeld.data(), partCount))
+    {
+        return false;
+    }
+    for (std::uint32_t part = 0; part < partCount; ++part)
+    {
+        auto const name = rReader.read_string();
+        if (rReader.fail)
+        {
+            return false;
+        }
+        if (name.empty())
+        {
+            continue;
+        }
+
+        auto const foundIt = prefabs.find(name);
+        if (foundIt == prefabs.end())
+        {
+            return false; // Prefab no longer exists in loaded assets
+        }
+
+        auto &rPair = rData.m_partPrefabs[part];
+        rPair.m_prefabId = foundIt->second.second;
+        rPair.m_importer = rResources.owner_create(gc_importer, foundIt->second.first);
+    }
+    if ( ! read_multimap(rReader, rData.m_partToMachines, partCount))
+    {
+        return false;
+    }
+
+    // Dense registries have no holes; the finalized id tables are just 0..count
+    rData.m_partsUsed.resize(partCount);
+    std::iota(rData.m_partsUsed.begin(), rData.m_partsUsed.end(), PartId{0});
+
+    // Welds
+    registry_create_dense(rData.m_weldIds, weldCount);
+    if ( ! read_multimap(rReader, rData.m_weldToParts, weldCount))
+    {
+        return false;
+    }
+    rData.m_weldsUsed.resize(weldCount);
+    std::iota(rData.m_weldsUsed.begin(), rData.m_weldsUsed.end(), WeldId{0});
+
+    // Machines
+    registry_create_dense(rData.m_machines.ids, machCount);
+    std::size_t const machCapacity = rData.m_machines.ids.capacity();
+    rData.m_machines.machTypes  .resize(machCapacity);
+    rData.m_machines.machToLocal.resize(machCapacity);
+    rData.m_machToPart          .resize(machCapacity);
+    if (   ! read_table(rReader, rData.m_machines.machTypes.data(), machCount)
+        || ! read_table(rReader, rData.m_machines.machToLocal.data(), machCount)
+        || ! read_table(rReader, rData.m_machToPart.data(), machCount))
+    {
+        return false;
+    }
+    rData.m_machsUsed.resize(machCount);
+    std::iota(rData.m_machsUsed.begin(), rData.m_machsUsed.end(), osp::link::MachAnyId{0});
+
+    rData.m_machines.perType.resize(machTypeCount);
+    for (PerMachType &rPerMachType : rData.m_machines.perType)
+    {
+        auto const localCount = rReader.read<std::uint32_t>();
+        if (rReader.fail || localCount > machCount)
+        {
+            return false;
+        }
+        registry_create_dense(rPerMachType.localIds, localCount);
+        rPerMachType.localToAny.resize(rPerMachType.localIds.capacity());
+        if ( ! read_table(rReader, rPerMachType.localToAny.data(), localCount))
+        {
+            return false;
+        }
+    }
+
+    // Nodes
+    rData.m_nodePerType.resize(nodeTypeCount);
+    for (PerNodeType &rPerNodeType : rData.m_nodePerType)
+    {
+        auto const nodeCount = rReader.read<std::uint32_t>();
+        if (rReader.fail)
+        {
+            return false;
+        }
+        registry_create_dense(rPerNodeType.nodeIds, nodeCount);
+        rPerNodeType.m_nodesUsed.resize(nodeCount);
+        std::iota(rPerNodeType.m_nodesUsed.begin(), rPerNodeType.m_nodesUsed.end(), osp::link::NodeId{0});
+        if (   ! read_multimap(rReader, rPerNodeType.nodeToMach, nodeCount)
+            || ! read_multimap(rReader, rPerNodeType.machToNode, machCount)
+            || ! read_multimap(rReader, rPerNodeType.m_machToNodeCustom, machCount))
+        {
+            return false;
+        }
+
+        auto const hasValues = rReader.read<std::uint8_t>();
+        if (hasValues == 1)
+        {
+            rPerNodeType.m_nodeValues.emplace< SignalValues_t<float> >();
+            auto &rValues = entt::any_cast< SignalValues_t<float>& >(rPerNodeType.m_nodeValues);
+            rValues.resize(rPerNodeType.nodeIds.capacity());
+            if ( ! read_table(rReader, rValues.data(), nodeCount))
+            {
+                return false;
+            }
+        }
+        else if (rReader.fail || hasValues != 0)
+        {
+            return false;
+        }
+
+        rPerNodeType.m_nodeConnectCount.resize(rPerNodeType.nodeIds.capacity());
+        if ( ! read_table(rReader, rPerNodeType.m_nodeConnectCount.data(), nodeCount))
+        {
+            return false;
+        }
+        rPerNodeType.m_connectCountTotal = rReader.read<std::int32_t>();
+
+        NodesSnapshot &rSnapshot = rPerNodeType.m_snapshot;
+        rSnapshot.nodeCount = rReader.read<std::uint32_t>();
+        if (   ! read_vector(rReader, rSnapshot.juncFirst)
+            || ! read_vector(rReader, rSnapshot.juncs)
+            || ! read_vector(rReader, rSnapshot.portFirst)
+            || ! read_vector(rReader, rSnapshot.ports))
+        {
+            return false;
+        }
+    }
+
+    return ! rReader.fail;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+
+bool adera::write_vehicle_blueprints(
+        std::string_view const  filepath,
+        std::uint32_t const     revision,
+        ArrayView<std::unique_ptr<VehicleData> const> const vehicles,
+        Resources const&        rResources)
+{
+    PackWriter writer;
+
+    writer.out.insert(writer.out.end(), sc_blueprintMagic.begin(), sc_blueprintMagic.end());
+    writer.write(revision);
+    writer.write(std::uint32_t(vehicles.size()));
+
+    for (std::unique_ptr<VehicleData> const& rpData : vehicles)
+    {
+        writer.write(std::uint8_t(rpData != nullptr));
+        if (rpData != nullptr && ! write_vehicle(writer, *rpData, rResources))
+        {
+            OSP_LOG_WARN("Vehicle blueprints {} not written; unsupported node value type",
+                         filepath);
+            return false;
+        }
+    }
+
+    std::string const path{filepath};
+
+    bool writable;
+    {
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        writable = file.is_open();
+        if (writable)
+        {
+            file.write(reinterpret_cast<char const*>(writer.out.data()),
+                       std::streamsize(writer.out.size()));
+            writable = file.good();
+        }
+    }
+
+    if ( ! writable)
+    {
+        OSP_LOG_WARN("Could not write vehicle blueprints {}", filepath);
+        std::remove(path.c_str()); // Never leave a partial file behind
+    }
+
+    return writable;
+}
+
+std::vector<std::unique_ptr<VehicleData>> adera::load_vehicle_blueprints(
+        std::string_view const  filepath,
+        std::uint32_t const     revision,
+        Resources&              rResources)
+{
+    PackFileView file;
+    if ( ! file.open(filepath))
+    {
+        return {};
+    }
+
+    auto const view = file.data();
+    if (   view.size() < sc_blueprintMagic.size()
+        || std::memcmp(view.data(), sc_blueprintMagic.data(), sc_blueprintMagic.size()) != 0)
+    {
+        return {};
+    }
+
+    PackReader reader{ .data = view, .pos = sc_blueprintMagic.size() };
+
+    auto const fileRevision = reader.read<std::uint32_t>();
+    auto const vehicleCount = reader.read<std::uint32_t>();
+    if (reader.fail || fileRevision != revision || vehicleCount > (1u << 12))
+    {
+        return {}; // Out-of-revision files rebuild silently; expected after design edits
+    }
+
+    PrefabIndex_t const prefabs = index_prefabs(rResources);
+
+    // A corrupt or stale file is rejected as a whole instead of handing the caller half
+    // of its vehicles
+    std::vector<std::unique_ptr<VehicleData>> out(vehicleCount);
+    for (std::unique_ptr<VehicleData> &rpData : out)
+    {
+        bool const hasData = reader.read<std::uint8_t>() != 0;
+        bool ok = ! reader.fail;
+
+        if (ok && hasData)
+        {
+            rpData = std::make_unique<VehicleData>();
+            ok = read_vehicle(reader, rResources, prefabs, *rpData);
+        }
+
+        if ( ! ok)
+        {
+            // Release importer owners created for vehicles read so far
+            for (std::unique_ptr<VehicleData> const& rpBuilt : out)
+            {
+                if (rpBuilt == nullptr)
+                {
+                    continue;
+                }
+                for (osp::PrefabPair &rPair : rpBuilt->m_partPrefabs)
+                {
+                    rResources.owner_destroy_later(gc_importer, std::move(rPair.m_importer));
+                }
+            }
+            rResources.owner_destroy_flush();
+
+            OSP_LOG_WARN("Stale or malformed vehicle blueprints {}; rebuilding", filepath);
+            return {};
+        }
+    }
+
+    return out;
+}
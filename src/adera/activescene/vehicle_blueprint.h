@@ -0,0 +1,77 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "VehicleBuilder.h"
+
+#include <osp/core/array_view.h>
+#include <osp/core/resourcetypes.h>
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace adera
+{
+
+/**
+ * @brief Export finalized VehicleData to a binary blueprint file
+ *
+ * Writes each vehicle's part/weld/machine/node tables flat, so the next launch can load
+ * them directly instead of re-running VehicleBuilder assembly. Part prefabs are stored by
+ * prefab name and re-resolved against Resources on load, so the file survives asset
+ * repacking. Like asset packs, blueprint files are a host-endian per-machine cache.
+ *
+ * @param revision [in] Bump alongside changes to the builder code that assembles the
+ *                      vehicles; files written with another revision are rejected on load
+ * @param vehicles [in] May contain null entries; slot order is preserved
+ *
+ * @return false when a vehicle is unserializable or writing failed; the output file is
+ *         removed in that case
+ */
+bool write_vehicle_blueprints(
+        std::string_view filepath,
+        std::uint32_t revision,
+        osp::ArrayView<std::unique_ptr<VehicleData> const> vehicles,
+        osp::Resources const& rResources);
+
+/**
+ * @brief Load vehicles from a blueprint file written by write_vehicle_blueprints
+ *
+ * The file is memory-mapped where supported and its tables copied straight into
+ * VehicleData containers; prefab names are fixed up to importer resource owners. A
+ * missing, malformed, or out-of-revision file is rejected as a whole, before any
+ * vehicle reaches the caller.
+ *
+ * @return One entry per exported slot (null entries preserved); empty on rejection,
+ *         in which case the caller re-runs builder assembly
+ */
+std::vector<std::unique_ptr<VehicleData>> load_vehicle_blueprints(
+        std::string_view filepath,
+        std::uint32_t revision,
+        osp::Resources& rResources);
+
+} // namespace adera
@@ -78,15 +78,16 @@ void SysVehicleSpawnVB::create_parts_and_welds(ACtxVehicleSpawn& rVehicleSpawn,
     rVehicleSpawn.spawnedWelds      .resize(weldTotal);
     rVehicleSpawn.spawnedPrefabs    .resize(partTotal);
     rVSVB.remapParts                .resize(remapPartTotal, lgrn::id_null<PartId>());
-    rVSVB.remapWelds                .resize(remapPartTotal, lgrn::id_null<WeldId>());
+    rVSVB.remapWelds                .resize(remapWeldTotal, lgrn::id_null<WeldId>());
 
     // Create new Scene PartIds and WeldIds
 
     rScnParts.partIds.create(rVehicleSpawn.spawnedParts.begin(), rVehicleSpawn.spawnedParts.end());
     rScnParts.weldIds.create(rVehicleSpawn.spawnedWelds.begin(), rVehicleSpawn.spawnedWelds.end());
 
-    rScnParts.partDirty.insert(rScnParts.partDirty.begin(), rVehicleSpawn.spawnedParts.begin(), rVehicleSpawn.spawnedParts.end());
-    rScnParts.weldDirty.insert(rScnParts.weldDirty.begin(), rVehicleSpawn.spawnedWelds.begin(), rVehicleSpawn.spawnedWelds.end());
+    // Append; inserting at begin() would shift any already-queued dirty ids for every spawn
+    rScnParts.partDirty.insert(rScnParts.partDirty.end(), rVehicleSpawn.spawnedParts.begin(), rVehicleSpawn.spawnedParts.end());
+    rScnParts.weldDirty.insert(rScnParts.weldDirty.end(), rVehicleSpawn.spawnedWelds.begin(), rVehicleSpawn.spawnedWelds.end());
 
     // Resize scene containers to account for new IDs
 
@@ -125,7 +126,7 @@ void SysVehicleSpawnVB::create_parts_and_welds(ACtxVehicleSpawn& rVehicleSpawn,
         std::size_t const remapPartOffset = rVSVB.remapPartOffsets[spVhId];
         std::size_t const remapWeldOffset = rVSVB.remapWeldOffsets[spVhId];
 
-        for (PartId const srcPart : pVData->m_partIds.bitview().zeros())
+        for (PartId const srcPart : pVData->m_partsUsed)
         {
             PartId const dstPart = *itDstPartIds;
             ++itDstPartIds;
@@ -134,7 +135,7 @@ void SysVehicleSpawnVB::create_parts_and_welds(ACtxVehicleSpawn& rVehicleSpawn,
             rVSVB.remapParts[remapPartOffset + srcPart] = dstPart;
         }
 
-        for (WeldId const srcWeld : pVData->m_weldIds.bitview().zeros())
+        for (WeldId const srcWeld : pVData->m_weldsUsed)
         {
             WeldId const dstWeld = *itDstWeldIds;
             ++itDstWeldIds;
@@ -170,6 +171,9 @@ void SysVehicleSpawnVB::request_prefabs(ACtxVehicleSpawn& rVehicleSpawn, ACtxVeh
     auto itDstPartIds = rVehicleSpawn.spawnedParts.cbegin();
     auto itPrefabOut  = rVehicleSpawn.spawnedPrefabs.begin();
 
+    // One prefab request per spawned part; reserve across all pending vehicles up front
+    rPrefabs.spawnRequest.reserve(rPrefabs.spawnRequest.size() + rVehicleSpawn.spawnedParts.size());
+
     for (uint32_t spVhInt = 0; spVhInt < newVehicleCount; ++spVhInt)
     {
         auto const spVhId = SpVehicleId{spVhInt};
@@ -181,7 +185,7 @@ void SysVehicleSpawnVB::request_prefabs(ACtxVehicleSpawn& rVehicleSpawn, ACtxVeh
         }
 
         // Copy Part data from VehicleBuilder to scene
-        for (uint32_t srcPart : pVData->m_partIds.bitview().zeros())
+        for (PartId const srcPart : pVData->m_partsUsed)
         {
             PartId const dstPart = *itDstPartIds;
             ++itDstPartIds;
@@ -40,13 +40,21 @@ void adera::shader::draw_ent_flat(
     auto &rData   = *reinterpret_cast<ACtxDrawFlat*>(pData);
     auto &rShader = *reinterpret_cast<FlatGL3D*>(pShader);
 
+    // Flat has no pass-constant uniforms, but recording the program scopes the texture
+    // unit below and keeps the cache coherent for other shaders' draws
+    GlBindCache &rBind = *rData.pBindCache;
+    rBind.bind_program(&rShader);
+
     // Collect uniform information
-    Matrix4 const &drawTf = (*rData.pDrawTf)[ent];
+    Matrix4 const &drawTf = (*rData.pHot)[ent].drawTf;
 
     if (rShader.flags() & FlatGL3D::Flag::Textured)
     {
         TexGlId const texGlId = (*rData.pDiffuseTexId)[ent].m_glId;
-        rShader.bindTexture(rData.pTexGl->get(texGlId));
+        if (rBind.bind_texture(0, texGlId))
+        {
+            rShader.bindTexture(rData.pTexGl->get(texGlId));
+        }
     }
 
     if (rData.pColor != nullptr)
@@ -57,6 +65,8 @@ void adera::shader::draw_ent_flat(
     MeshGlId const      meshId = (*rData.pMeshId)[ent].m_glId;
     Magnum::GL::Mesh    &rMesh = rData.pMeshGl->get(meshId);
 
+    rBind.bind_mesh(meshId);
+
     rShader.setTransformationProjectionMatrix(viewProj.m_viewProj * drawTf)
            .draw(rMesh);
 }
@@ -39,13 +39,14 @@ struct ACtxDrawFlat
     FlatGL3D                    shaderUntextured    {Corrade::NoCreate};
     FlatGL3D                    shaderDiffuse       {Corrade::NoCreate};
 
-    osp::draw::DrawTransforms_t    *pDrawTf         {nullptr};
+    osp::draw::DrawEntHots_t       *pHot            {nullptr};
     osp::draw::DrawEntColors_t     *pColor          {nullptr};
     osp::draw::TexGlEntStorage_t   *pDiffuseTexId   {nullptr};
     osp::draw::MeshGlEntStorage_t  *pMeshId         {nullptr};
 
     osp::draw::TexGlStorage_t      *pTexGl          {nullptr};
     osp::draw::MeshGlStorage_t     *pMeshGl         {nullptr};
+    osp::draw::GlBindCache         *pBindCache      {nullptr};
 
     osp::draw::MaterialId materialId { lgrn::id_null<osp::draw::MaterialId>() };
 
@@ -53,12 +54,13 @@ struct ACtxDrawFlat
                                    osp::draw::ACtxSceneRenderGL& rScnRenderGl,
                                    osp::draw::RenderGL&          rRenderGl) noexcept
     {
-        pDrawTf         = &rScnRender   .m_drawTransform;
+        pHot            = &rScnRender   .hot;
         pColor          = &rScnRender   .m_color;
         pDiffuseTexId   = &rScnRenderGl .m_diffuseTexId;
         pMeshId         = &rScnRenderGl .m_meshId;
         pTexGl          = &rRenderGl    .m_texGl;
         pMeshGl         = &rRenderGl    .m_meshGl;
+        pBindCache      = &rRenderGl    .m_bindCache;
     }
 };
 
@@ -70,8 +72,8 @@ void draw_ent_flat(
 struct ArgsForSyncDrawEntFlat
 {
     osp::draw::DrawEntSet_t const&              hasMaterial;
-    osp::draw::RenderGroup::DrawEnts_t *const   pStorageOpaque;
-    osp::draw::RenderGroup::DrawEnts_t *const   pStorageTransparent;
+    osp::draw::RenderGroup *const               pGroupOpaque;
+    osp::draw::RenderGroup *const               pGroupTransparent;
     osp::draw::DrawEntSet_t const&              opaque;
     osp::draw::DrawEntSet_t const&              transparent;
     osp::draw::TexGlEntStorage_t const&         diffuse;
@@ -90,22 +92,39 @@ inline void sync_drawent_flat(osp::draw::DrawEnt ent, ArgsForSyncDrawEntFlat con
                       ? &args.rData.shaderDiffuse
                       : &args.rData.shaderUntextured;
 
-    if (args.pStorageTransparent != nullptr)
+    // Sort key groups draws by shader variant, then texture, then mesh to minimize GL binds
+    osp::draw::TexGlId const texGl  = hasTexture ? args.diffuse[ent].m_glId
+                                                 : osp::draw::TexGlId(0);
+    osp::draw::MeshGlId const meshGl = ((*args.rData.pMeshId).size() > entInt)
+                                     ? (*args.rData.pMeshId)[ent].m_glId
+                                     : lgrn::id_null<osp::draw::MeshGlId>();
+    std::uint64_t const key = osp::draw::draw_sort_key(
+            hasTexture ? 1 : 0,
+            std::uint16_t(std::size_t(texGl)),
+            std::uint16_t(std::size_t(meshGl)));
+
+    if (args.pGroupTransparent != nullptr)
     {
-        auto value = (hasMaterial && args.transparent.test(entInt))
+        bool const used = hasMaterial && args.transparent.test(entInt);
+        auto value = used
                    ? std::make_optional(osp::draw::EntityToDraw{&draw_ent_flat, {&args.rData, pShader}})
                    : std::nullopt;
 
-        osp::storage_assign(*args.pStorageTransparent, ent, std::move(value));
+        osp::storage_assign(args.pGroupTransparent->entities, ent, std::move(value));
+        used ? args.pGroupTransparent->set_sort_key(ent, key)
+             : args.pGroupTransparent->clear_sort_key(ent);
     }
 
-    if (args.pStorageOpaque != nullptr)
+    if (args.pGroupOpaque != nullptr)
     {
-        auto value = (hasMaterial && args.opaque.test(entInt))
+        bool const used = hasMaterial && args.opaque.test(entInt);
+        auto value = used
                    ? std::make_optional(osp::draw::EntityToDraw{&draw_ent_flat, {&args.rData, pShader}})
                    : std::nullopt;
 
-        osp::storage_assign(*args.pStorageOpaque, ent, std::move(value));
+        osp::storage_assign(args.pGroupOpaque->entities, ent, std::move(value));
+        used ? args.pGroupOpaque->set_sort_key(ent, key)
+             : args.pGroupOpaque->clear_sort_key(ent);
     }
 }
 
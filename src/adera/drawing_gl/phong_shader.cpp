@@ -24,12 +24,51 @@
  */
 #include "phong_shader.h"
 
+#include <Corrade/Containers/ArrayViewStl.h>
+
+#include <algorithm>
+
 // for the 0xrrggbb_rgbf and angle literals
 using namespace Magnum::Math::Literals;
 
 using namespace osp;
 using namespace osp::draw;
 
+using adera::shader::ACtxDrawPhong;
+using adera::shader::PhongGL;
+
+// Bind the uniform arena as a mesh's instanced attributes, once per GL mesh object. The GL
+// object name is rechecked so a mesh re-created in the same slot is rebound.
+static void bind_arena_attributes(
+        ACtxDrawPhong& rData, MeshGlId const meshId, Magnum::GL::Mesh& rMesh)
+{
+    auto const found = std::find_if(
+            rData.meshBoundInstanced.begin(), rData.meshBoundInstanced.end(),
+            [meshId] (ACtxDrawPhong::BoundMesh const& bound) noexcept
+    {
+        return bound.meshGl == meshId;
+    });
+
+    if (found != rData.meshBoundInstanced.end() && found->glName == rMesh.id())
+    {
+        return; // Still bound to the same GL mesh object
+    }
+
+    rMesh.addVertexBufferInstanced(rData.drawTfArena, 1, 0,
+                                   PhongGL::TransformationMatrix{},
+                                   PhongGL::NormalMatrix{},
+                                   PhongGL::Color4{});
+
+    if (found != rData.meshBoundInstanced.end())
+    {
+        found->glName = rMesh.id();
+    }
+    else
+    {
+        rData.meshBoundInstanced.push_back({meshId, rMesh.id()});
+    }
+}
+
 void adera::shader::draw_ent_phong(
         DrawEnt                     ent,
         ViewProjMatrix const&       viewProj,
@@ -45,8 +84,56 @@ void adera::shader::draw_ent_phong(
     auto &rData   = *reinterpret_cast<ACtxDrawPhong*>(pData);
     auto &rShader = *reinterpret_cast<PhongGL*>(pShader);
 
+    GlBindCache &rBind = *rData.pBindCache;
+    bool const programChanged = rBind.bind_program(&rShader);
+
+    if (rData.useDrawTfArena)
+    {
+        // Transform, normal matrix, and color were staged by stage_drawent_phong; camera and
+        // light uniforms were set once for the frame. Only texture binds are left per draw.
+        std::uint32_t const record = (rData.arenaIndex.size() > std::size_t(ent))
+                                   ? rData.arenaIndex[ent] : ACtxDrawPhong::sc_noRecord;
+        if (record == ACtxDrawPhong::sc_noRecord)
+        {
+            return; // Not staged this frame
+        }
+
+        if (rShader.flags() & Flag::DiffuseTexture)
+        {
+            // Diffuse and ambient are always fed the same texture here, so one slot covers both
+            TexGlId const texGlId = (*rData.pDiffuseTexId)[ent].m_glId;
+            if (rBind.bind_texture(0, texGlId))
+            {
+                Magnum::GL::Texture2D &rTexture = rData.pTexGl->get(texGlId);
+                rShader.bindDiffuseTexture(rTexture);
+
+                if (rShader.flags() & (Flag::AmbientTexture | Flag::AlphaMask))
+                {
+                    rShader.bindAmbientTexture(rTexture);
+                }
+            }
+        }
+
+        MeshGlId const      meshId = (*rData.pMeshId)[ent].m_glId;
+        Magnum::GL::Mesh    &rMesh = rData.pMeshGl->get(meshId);
+
+        // Same program and mesh as the previous draw means it came through this path and
+        // the arena attributes are already on the mesh; skip even the rebind check
+        if (rBind.bind_mesh(meshId) || programChanged)
+        {
+            bind_arena_attributes(rData, meshId, rMesh);
+        }
+
+        rMesh.setInstanceCount(1);
+        rMesh.setBaseInstance(record);
+        rShader.draw(rMesh);
+        return;
+    }
+
+    // Classic path; every uniform is set per entity
+
     // Collect uniform information
-    Matrix4 const &drawTf = (*rData.pDrawTf)[ent];
+    Matrix4 const &drawTf = (*rData.pHot)[ent].drawTf;
 
     Magnum::Matrix4 entRelative = viewProj.m_view * drawTf;
 
@@ -59,12 +146,15 @@ void adera::shader::draw_ent_phong(
     if (rShader.flags() & Flag::DiffuseTexture)
     {
         TexGlId const texGlId = (*rData.pDiffuseTexId)[ent].m_glId;
-        Magnum::GL::Texture2D &rTexture = rData.pTexGl->get(texGlId);
-        rShader.bindDiffuseTexture(rTexture);
-
-        if (rShader.flags() & (Flag::AmbientTexture | Flag::AlphaMask))
+        if (rBind.bind_texture(0, texGlId))
         {
-            rShader.bindAmbientTexture(rTexture);
+            Magnum::GL::Texture2D &rTexture = rData.pTexGl->get(texGlId);
+            rShader.bindDiffuseTexture(rTexture);
+
+            if (rShader.flags() & (Flag::AmbientTexture | Flag::AlphaMask))
+            {
+                rShader.bindAmbientTexture(rTexture);
+            }
         }
     }
 
@@ -76,11 +166,175 @@ void adera::shader::draw_ent_phong(
     MeshGlId const      meshId = (*rData.pMeshId)[ent].m_glId;
     Magnum::GL::Mesh    &rMesh = rData.pMeshGl->get(meshId);
 
-    Matrix3 a{viewProj.m_view};
+    rBind.bind_mesh(meshId); // Record only; the draw below binds it
+
+    if (programChanged)
+    {
+        // Lights and camera are constant across the pass; only re-applied when a draw
+        // with a different program landed in between
+
+        // Lights with w=0.0f are directional lights
+        // Directonal lights are camera-relative, so we need 'viewProj.m_view *'
+        auto const lightPositions =
+        {
+            viewProj.m_view * Vector4{ Vector3{0.2f, 0.6f, 0.5f}.normalized(), 0.0f},
+            viewProj.m_view * Vector4{-Vector3{0.0f, 0.0f, 1.0f}, 0.0f}
+        };
+
+        auto const lightColors =
+        {
+            0xddd4Cd_rgbf,
+            0x32354e_rgbf
+        };
+
+        auto const lightSpecColors =
+        {
+            0xfff5ed_rgbf,
+            0x000000_rgbf
+        };
+
+        // TODO: find a better way to deal with lights instead of hard-coding it
+        rShader
+            .setAmbientColor(0x1a1e29ff_rgbaf)
+            .setSpecularColor(0xffffff00_rgbaf)
+            .setLightColors(lightColors)
+            .setLightSpecularColors(lightSpecColors)
+            .setLightPositions(lightPositions)
+            .setProjectionMatrix(viewProj.m_proj);
+    }
+
+    rShader
+        .setTransformationMatrix(entRelative)
+        .setNormalMatrix(entRelative.normalMatrix())
+        .draw(rMesh);
+}
+
 
+void adera::shader::draw_batch_phong(
+        ArrayView<DrawEnt const>        ents,
+        ViewProjMatrix const&           viewProj,
+        InstancedBatch::UserData_t      userData) noexcept
+{
+    using Flag = PhongGL::Flag;
+
+    void* const pData   = std::get<0>(userData);
+    void* const pShader = std::get<1>(userData);
+    assert(pData   != nullptr);
+    assert(pShader != nullptr);
+
+    auto &rData   = *reinterpret_cast<ACtxDrawPhong*>(pData);
+    auto &rShader = *reinterpret_cast<PhongGL*>(pShader);
+
+    // Buckets only exist in contexts with the staging task
+    assert(rData.useDrawTfArena);
+
+    DrawEnt const firstEnt = ents.front();
+
+    // stage_drawent_phong staged this bucket's visible entities contiguously, in the same
+    // order draw_group filtered them, starting at the first one's record
+    std::uint32_t const base = (rData.arenaIndex.size() > std::size_t(firstEnt))
+                             ? rData.arenaIndex[firstEnt] : ACtxDrawPhong::sc_noRecord;
+    if (base == ACtxDrawPhong::sc_noRecord)
+    {
+        return; // Bucket not staged this frame
+    }
+
+    GlBindCache &rBind = *rData.pBindCache;
+    bool const programChanged = rBind.bind_program(&rShader);
+
+    if (rShader.flags() & Flag::DiffuseTexture)
+    {
+        TexGlId const texGlId = (*rData.pDiffuseTexId)[firstEnt].m_glId;
+        if (rBind.bind_texture(0, texGlId))
+        {
+            Magnum::GL::Texture2D &rTexture = rData.pTexGl->get(texGlId);
+            rShader.bindDiffuseTexture(rTexture);
+
+            if (rShader.flags() & (Flag::AmbientTexture | Flag::AlphaMask))
+            {
+                rShader.bindAmbientTexture(rTexture);
+            }
+        }
+    }
+
+    MeshGlId const      meshId = (*rData.pMeshId)[firstEnt].m_glId;
+    Magnum::GL::Mesh    &rMesh = rData.pMeshGl->get(meshId);
+
+    if (rBind.bind_mesh(meshId) || programChanged)
+    {
+        bind_arena_attributes(rData, meshId, rMesh);
+    }
+
+    rMesh.setInstanceCount(Magnum::UnsignedInt(ents.size()));
+    rMesh.setBaseInstance(base);
+    rShader.draw(rMesh);
+
+    // Leave the shared mesh sane for singleton draws
+    rMesh.setInstanceCount(1);
+    rMesh.setBaseInstance(0);
+}
+
+void adera::shader::stage_drawent_phong(
+        DrawEntSet_t const&     visible,
+        DrawEntSet_t const&     hasMaterial,
+        RenderGroup const&      group,
+        ViewProjMatrix const&   viewProj,
+        ACtxDrawPhong&          rData)
+{
+    rData.arenaStaging.clear();
+    rData.arenaIndex.assign(visible.size(), ACtxDrawPhong::sc_noRecord);
+
+    auto const stage_ent = [&rData] (DrawEnt const ent)
+    {
+        Matrix4 const &drawTf = (*rData.pHot)[ent].drawTf;
+        rData.arenaIndex[ent] = std::uint32_t(rData.arenaStaging.size());
+        rData.arenaStaging.push_back(
+        {
+            .tf     = drawTf,
+            .normal = drawTf.normalMatrix(),
+            .color  = (rData.pColor != nullptr) ? (*rData.pColor)[ent]
+                                                : Magnum::Color4{1.0f}
+        });
+    };
+
+    // Buckets first, so each one's records are contiguous for a single instanced call
+    for (auto const& [_, batch] : group.instanced)
+    {
+        if (batch.draw != &draw_batch_phong)
+        {
+            continue; // Another shader's bucket
+        }
+
+        for (DrawEnt const ent : batch.entities)
+        {
+            if (visible.test(std::size_t(ent)))
+            {
+                stage_ent(ent);
+            }
+        }
+    }
+
+    // Remaining entities with the material, drawn one instance at a time. Material and
+    // visibility membership are resolved a word at a time in one combined scan.
+    osp::bitvector_for_each_set_and(hasMaterial, visible,
+                                    [&rData, &stage_ent] (std::size_t const entInt)
+    {
+        auto const ent = DrawEnt(entInt);
+        if (   entInt < rData.arenaIndex.size()
+            && rData.arenaIndex[ent] == ACtxDrawPhong::sc_noRecord)
+        {
+            stage_ent(ent);
+        }
+    });
+
+    if (rData.drawTfArena.id() == 0)
+    {
+        rData.drawTfArena = Magnum::GL::Buffer{Magnum::GL::Buffer::TargetHint::Array};
+    }
+
+    // Orphan last frame's data and upload the whole arena in one write
+    rData.drawTfArena.setData(rData.arenaStaging, Magnum::GL::BufferUsage::StreamDraw);
 
-    // Lights with w=0.0f are directional lights
-    // Directonal lights are camera-relative, so we need 'viewProj.m_view *'
     auto const lightPositions =
     {
         viewProj.m_view * Vector4{ Vector3{0.2f, 0.6f, 0.5f}.normalized(), 0.0f},
@@ -99,16 +353,19 @@ void adera::shader::draw_ent_phong(
         0x000000_rgbf
     };
 
-    // TODO: find a better way to deal with lights instead of hard-coding it
-    rShader
-        .setAmbientColor(0x1a1e29ff_rgbaf)
-        .setSpecularColor(0xffffff00_rgbaf)
-        .setLightColors(lightColors)
-        .setLightSpecularColors(lightSpecColors)
-        .setLightPositions(lightPositions)
-        .setTransformationMatrix(entRelative)
-        .setProjectionMatrix(viewProj.m_proj)
-        .setNormalMatrix(entRelative.normalMatrix())
-        .draw(rMesh);
+    // Camera and light uniforms are set once for the frame; per-instance matrices and colors
+    // from the arena are applied on top
+    for (PhongGL *pShader : {&rData.shaderUntexturedInstanced, &rData.shaderDiffuseInstanced})
+    {
+        (*pShader)
+            .setAmbientColor(0x1a1e29ff_rgbaf)
+            .setSpecularColor(0xffffff00_rgbaf)
+            .setDiffuseColor(0xffffffff_rgbaf) // Per-instance colors multiply this
+            .setLightColors(lightColors)
+            .setLightSpecularColors(lightSpecColors)
+            .setLightPositions(lightPositions)
+            .setTransformationMatrix(viewProj.m_view)
+            .setProjectionMatrix(viewProj.m_proj)
+            .setNormalMatrix(viewProj.m_view.normalMatrix());
+    }
 }
-
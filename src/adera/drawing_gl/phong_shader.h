@@ -28,26 +28,68 @@
 
 #include <Magnum/Shaders/PhongGL.h>
 
+#include <cstdint>
+
 namespace adera::shader
 {
 
 using PhongGL = Magnum::Shaders::PhongGL;
 
+/**
+ * @brief One per-draw record in the uniform staging arena, bound as instanced attributes
+ */
+struct PhongDrawData
+{
+    Magnum::Matrix4     tf;
+    Magnum::Matrix3x3   normal;
+    Magnum::Color4      color;
+};
+
 /**
  * @brief Stores per-scene data needed for Phong shaders to draw
  */
 struct ACtxDrawPhong
 {
+    /// Marks an entity with no record staged this frame; such entities are not drawn
+    static constexpr std::uint32_t sc_noRecord = ~std::uint32_t{0};
+
     PhongGL                     shaderUntextured    {Corrade::NoCreate};
     PhongGL                     shaderDiffuse       {Corrade::NoCreate};
 
-    osp::draw::DrawTransforms_t    *pDrawTf         {nullptr};
+    // Variants with Flag::InstancedTransformation used by the uniform arena path; both
+    // singleton draws (instance count 1) and bucketed draws index the arena by base instance
+    PhongGL                     shaderUntexturedInstanced {Corrade::NoCreate};
+    PhongGL                     shaderDiffuseInstanced    {Corrade::NoCreate};
+
+    /// Per-frame uniform staging arena of PhongDrawData records; orphaned and refilled with
+    /// every drawn entity's transform and color in one upload by stage_drawent_phong
+    Magnum::GL::Buffer                  drawTfArena {Corrade::NoCreate};
+    std::vector<PhongDrawData>          arenaStaging;
+    osp::KeyedVec<osp::draw::DrawEnt, std::uint32_t> arenaIndex;
+
+    /// True when a staging task fills the arena each frame; enables the instanced shader
+    /// variants for all draws. Left false by contexts without the task (enginetest), which
+    /// keep the classic per-entity uniform path.
+    bool                                useDrawTfArena {false};
+
+    /// GL meshes that already have drawTfArena bound as their instanced vertex attributes.
+    /// The GL object name is kept so a mesh re-created in the same slot (resource residency
+    /// eviction) is detected and rebound.
+    struct BoundMesh
+    {
+        osp::draw::MeshGlId     meshGl;
+        Magnum::UnsignedInt     glName;
+    };
+    std::vector<BoundMesh>      meshBoundInstanced;
+
+    osp::draw::DrawEntHots_t       *pHot            {nullptr};
     osp::draw::DrawEntColors_t     *pColor          {nullptr};
     osp::draw::TexGlEntStorage_t   *pDiffuseTexId   {nullptr};
     osp::draw::MeshGlEntStorage_t  *pMeshId         {nullptr};
 
     osp::draw::TexGlStorage_t      *pTexGl          {nullptr};
     osp::draw::MeshGlStorage_t     *pMeshGl         {nullptr};
+    osp::draw::GlBindCache         *pBindCache      {nullptr};
 
     osp::draw::MaterialId materialId { lgrn::id_null<osp::draw::MaterialId>() };
 
@@ -55,12 +97,13 @@ struct ACtxDrawPhong
                                    osp::draw::ACtxSceneRenderGL& rScnRenderGl,
                                    osp::draw::RenderGL&          rRenderGl) noexcept
     {
-        pDrawTf         = &rScnRender   .m_drawTransform;
+        pHot            = &rScnRender   .hot;
         pColor          = &rScnRender   .m_color;
         pDiffuseTexId   = &rScnRenderGl .m_diffuseTexId;
         pMeshId         = &rScnRenderGl .m_meshId;
         pTexGl          = &rRenderGl    .m_texGl;
         pMeshGl         = &rRenderGl    .m_meshGl;
+        pBindCache      = &rRenderGl    .m_bindCache;
     }
 };
 
@@ -69,11 +112,38 @@ void draw_ent_phong(
         osp::draw::ViewProjMatrix const&     viewProj,
         osp::draw::EntityToDraw::UserData_t  userData) noexcept;
 
+/**
+ * @brief Draw a bucket of entities sharing one mesh and texture with a single instanced call
+ *
+ * Per-instance transform and normal matrices are streamed through ACtxDrawPhong::instanceTfBuf;
+ * buckets larger than one buffer section are drawn in section-sized chunks.
+ */
+void draw_batch_phong(
+        osp::ArrayView<osp::draw::DrawEnt const>  ents,
+        osp::draw::ViewProjMatrix const&          viewProj,
+        osp::draw::InstancedBatch::UserData_t     userData) noexcept;
+
+/**
+ * @brief Fill the per-frame uniform staging arena with every drawn Phong entity
+ *
+ * Call once per frame before drawing, after draw transforms are updated. Bucketed entities
+ * are staged first so each bucket's records stay contiguous for one instanced call, followed
+ * by the remaining entities with the material. The whole arena is uploaded in a single
+ * orphaning buffer write, and per-frame camera and light uniforms are set on the instanced
+ * shader variants here, leaving draw functions only texture binds and base-instance draws.
+ */
+void stage_drawent_phong(
+        osp::draw::DrawEntSet_t const&      visible,
+        osp::draw::DrawEntSet_t const&      hasMaterial,
+        osp::draw::RenderGroup const&       group,
+        osp::draw::ViewProjMatrix const&    viewProj,
+        ACtxDrawPhong&                      rData);
+
 struct ArgsForSyncDrawEntPhong
 {
     osp::draw::DrawEntSet_t const&              hasMaterial;
-    osp::draw::RenderGroup::DrawEnts_t *const   pStorageOpaque;
-    osp::draw::RenderGroup::DrawEnts_t *const   pStorageTransparent;
+    osp::draw::RenderGroup *const               pGroupOpaque;
+    osp::draw::RenderGroup *const               pGroupTransparent;
     osp::draw::DrawEntSet_t const&              opaque;
     osp::draw::DrawEntSet_t const&              transparent;
     osp::draw::TexGlEntStorage_t const&         diffuse;
@@ -87,26 +157,45 @@ inline void sync_drawent_phong(osp::draw::DrawEnt ent, ArgsForSyncDrawEntPhong c
     bool const hasMaterial = args.hasMaterial.test(entInt);
     bool const hasTexture = (args.diffuse.size() > std::size_t(ent)) && (args.diffuse[ent].m_glId != lgrn::id_null<osp::draw::TexGlId>());
 
-    PhongGL *pShader = hasTexture
-                     ? &args.rData.shaderDiffuse
-                     : &args.rData.shaderUntextured;
+    PhongGL *pShader = args.rData.useDrawTfArena
+                     ? (hasTexture ? &args.rData.shaderDiffuseInstanced
+                                   : &args.rData.shaderUntexturedInstanced)
+                     : (hasTexture ? &args.rData.shaderDiffuse
+                                   : &args.rData.shaderUntextured);
+
+    // Sort key groups draws by shader variant, then texture, then mesh to minimize GL binds
+    osp::draw::TexGlId const texGl  = hasTexture ? args.diffuse[ent].m_glId
+                                                 : osp::draw::TexGlId(0);
+    osp::draw::MeshGlId const meshGl = ((*args.rData.pMeshId).size() > entInt)
+                                     ? (*args.rData.pMeshId)[ent].m_glId
+                                     : lgrn::id_null<osp::draw::MeshGlId>();
+    std::uint64_t const key = osp::draw::draw_sort_key(
+            hasTexture ? 1 : 0,
+            std::uint16_t(std::size_t(texGl)),
+            std::uint16_t(std::size_t(meshGl)));
 
-    if (args.pStorageTransparent != nullptr)
+    if (args.pGroupTransparent != nullptr)
     {
-        auto value = (hasMaterial && args.transparent.test(entInt))
+        bool const used = hasMaterial && args.transparent.test(entInt);
+        auto value = used
                    ? std::make_optional(osp::draw::EntityToDraw{&draw_ent_phong, {&args.rData, pShader}})
                    : std::nullopt;
 
-        osp::storage_assign(*args.pStorageTransparent, ent, std::move(value));
+        osp::storage_assign(args.pGroupTransparent->entities, ent, std::move(value));
+        used ? args.pGroupTransparent->set_sort_key(ent, key)
+             : args.pGroupTransparent->clear_sort_key(ent);
     }
 
-    if (args.pStorageOpaque != nullptr)
+    if (args.pGroupOpaque != nullptr)
     {
-        auto value = (hasMaterial && args.opaque.test(entInt))
+        bool const used = hasMaterial && args.opaque.test(entInt);
+        auto value = used
                    ? std::make_optional(osp::draw::EntityToDraw{&draw_ent_phong, {&args.rData, pShader}})
                    : std::nullopt;
 
-        osp::storage_assign(*args.pStorageOpaque, ent, std::move(value));
+        osp::storage_assign(args.pGroupOpaque->entities, ent, std::move(value));
+        used ? args.pGroupOpaque->set_sort_key(ent, key)
+             : args.pGroupOpaque->clear_sort_key(ent);
     }
 }
 
@@ -122,4 +211,76 @@ void sync_drawent_phong(
     });
 }
 
+struct ArgsForSyncDrawEntInstancedPhong
+{
+    osp::draw::DrawEntSet_t const&              hasMaterial;
+    osp::draw::RenderGroup::Instanced_t *const  pInstanced;
+    osp::draw::DrawEntSet_t const&              opaque;
+    osp::draw::TexGlEntStorage_t const&         diffuse;
+    osp::draw::MeshGlEntStorage_t const&        mesh;
+    ACtxDrawPhong&                              rData;
+};
+
+/**
+ * @brief Rebuild a RenderGroup's instanced Phong buckets from a full range of DrawEnts
+ *
+ * Buckets entities by (GL mesh, GL texture) so each bucket renders with one instanced call;
+ * entities put here must not also be in RenderGroup::entities or they draw twice. Unlike
+ * sync_drawent_phong this clears this material's buckets and rebuilds, so pass every DrawEnt
+ * that may use the material, not just dirty ones. Only opaque entities are bucketed; the
+ * transparent pass needs back-to-front ordering that instancing would destroy.
+ */
+template<typename ITA_T, typename ITB_T>
+void sync_drawent_phong_instanced(
+        ITA_T const&                            first,
+        ITB_T const&                            last,
+        ArgsForSyncDrawEntInstancedPhong const  args)
+{
+    using osp::draw::InstancedBatch;
+    using osp::draw::MeshGlId;
+    using osp::draw::TexGlId;
+
+    // Drop this material's previous buckets; other shaders' buckets are left alone
+    for (auto it = args.pInstanced->begin(); it != args.pInstanced->end(); )
+    {
+        it = (it->second.draw == &draw_batch_phong) ? args.pInstanced->erase(it)
+                                                    : std::next(it);
+    }
+
+    std::for_each(first, last, [&args] (osp::draw::DrawEnt const ent)
+    {
+        auto const entInt = std::size_t(ent);
+
+        if ( ! args.hasMaterial.test(entInt) || ! args.opaque.test(entInt))
+        {
+            return;
+        }
+
+        MeshGlId const meshGl = (args.mesh.size() > entInt)
+                              ? args.mesh[ent].m_glId : lgrn::id_null<MeshGlId>();
+        if (meshGl == lgrn::id_null<MeshGlId>())
+        {
+            return; // Mesh not yet synced to GL
+        }
+
+        TexGlId const texGl = (args.diffuse.size() > entInt)
+                            ? args.diffuse[ent].m_glId : lgrn::id_null<TexGlId>();
+
+        PhongGL *pShader = (texGl != lgrn::id_null<TexGlId>())
+                         ? &args.rData.shaderDiffuseInstanced
+                         : &args.rData.shaderUntexturedInstanced;
+
+        std::uint64_t const key = (std::uint64_t(std::size_t(meshGl)) << 32)
+                                |  std::uint64_t(std::size_t(texGl));
+
+        InstancedBatch &rBatch = (*args.pInstanced)[key];
+        if (rBatch.draw == nullptr)
+        {
+            rBatch.draw = &draw_batch_phong;
+            rBatch.data = {&args.rData, pShader};
+        }
+        rBatch.entities.push_back(ent);
+    });
+}
+
 } // namespace osp::shader
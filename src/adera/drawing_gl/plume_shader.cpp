@@ -86,12 +86,15 @@ void PlumeShader::draw_plume(
         .setMeshZBounds             (effect.m_zMax, effect.m_zMin)
         .setBaseColor               (effect.m_color)
         .setFlowVelocity            (effect.m_flowVelocity)
-        .updateTime                 (comp.m_time)
-        .setPower                   (comp.m_powerLevel)
         .setTransformationMatrix    (entRelative)
         .setProjectionMatrix        (viewProj.m_proj)
         .setNormalMatrix            (entRelative.normalMatrix());
 
+    // Throttle and flicker phase come from this plume's slot of the shared
+    // instance buffer; no animation uniforms to refresh per draw
+    rMesh.setInstanceCount(1);
+    rMesh.setBaseInstance(comp.m_animSlot);
+
     // Draw back face
     Renderer::setFaceCullingMode(Renderer::PolygonFacing::Front);
     rData.m_shader.draw(rMesh);
@@ -108,8 +111,42 @@ void PlumeShader::assign_plumes(
 {
     for (ActiveEnt ent : entities)
     {
+        ACompExhaustPlume &rPlume = rData.m_pExaustPlumes->get(ent);
+        rPlume.m_animSlot = rData.m_animSlotNext++;
+        rPlume.m_animDirty = true;
+
+        MeshGlId const meshId = rData.m_pMeshId->get(ent);
+        if (rData.m_animMeshes.insert(meshId).second)
+        {
+            rData.m_pMeshGl->get(meshId).addVertexBufferInstanced(
+                    rData.m_animInstances, 1, 0, ThrottleTimeOffset{});
+        }
+
         //rStorage.emplace(ent, EntityToDraw{&draw_plume, {&rData} });
     }
+
+    // Reallocate one pair per plume; sync_animation refills dirty slots
+    rData.m_animInstances.setData(
+            {nullptr, rData.m_animSlotNext * sizeof(Magnum::Vector2)});
+}
+
+void PlumeShader::sync_animation(ACtxPlumeData& rData, float const time) noexcept
+{
+    // Shared frame time is one uniform per frame instead of one per draw
+    rData.m_shader.updateTime(time);
+
+    for (ACompExhaustPlume &rPlume : *rData.m_pExaustPlumes)
+    {
+        if ( ! rPlume.m_animDirty)
+        {
+            continue;
+        }
+
+        Magnum::Vector2 const animData{rPlume.m_powerLevel, rPlume.m_timeOffset};
+        rData.m_animInstances.setSubData(
+                rPlume.m_animSlot * sizeof(Magnum::Vector2), {&animData, 1});
+        rPlume.m_animDirty = false;
+    }
 }
 
 void PlumeShader::init()
@@ -31,6 +31,7 @@
 #include <osp/Active/opengl/SysRenderGL.h>
 #include <osp/Active/activetypes.h>
 
+#include <Magnum/GL/Buffer.h>
 #include <Magnum/GL/Texture.h>
 #include <Magnum/GL/AbstractShaderProgram.h>
 
@@ -38,6 +39,8 @@
 
 #include <Magnum/Magnum.h> // for Magnum::Int
 
+#include <set>
+
 namespace osp::active { class ActiveScene; }
 namespace osp::active { struct ACompCamera; }
 
@@ -57,6 +60,10 @@ public:
     Magnum::Shaders::GenericGL3D::Normal Normal;
     Magnum::Shaders::GenericGL3D::TextureCoordinates TextureCoordinates;
 
+    // Per-instance (throttle, time offset) animation state, fetched through
+    // base-instance indexing into ACtxPlumeData::m_animInstances
+    typedef Magnum::GL::Attribute<2, Magnum::Vector2> ThrottleTimeOffset;
+
     // Outputs
     enum : Magnum::UnsignedInt
     {
@@ -75,6 +82,15 @@ public:
             RenderGroup::Storage_t& rStorage,
             ACtxPlumeData& rData);
 
+    /**
+     * @brief Upload (throttle, time offset) pairs for plumes whose throttle
+     *        changed, and set the shared frame time uniform
+     *
+     * Steady-state plumes cost nothing here; all per-frame animation is
+     * derived on the GPU from the instance buffer and frame time.
+     */
+    static void sync_animation(ACtxPlumeData& rData, float time) noexcept;
+
 private:
 
     // GL init
@@ -92,8 +108,7 @@ private:
         CombustionNoiseTex = 6,
         BaseColor = 7,
         FlowVelocity = 8,
-        Time = 9,
-        Power = 10
+        Time = 9 // shared frame time; throttle is a per-instance attribute
     };
 
     // Texture2D slots
@@ -118,7 +133,6 @@ private:
     PlumeShader& setBaseColor(const Magnum::Color4 color);
     PlumeShader& setFlowVelocity(const float vel);
     PlumeShader& updateTime(const float currentTime);
-    PlumeShader& setPower(const float power);
 };
 
 /**
@@ -136,6 +150,16 @@ struct ACtxPlumeData
 
     TexGlId m_tmpTex;
 
+    /// One (throttle, time offset) pair per plume, fetched by the vertex
+    /// shader through base-instance indexing. Slots are rewritten by
+    /// PlumeShader::sync_animation only when a throttle changes
+    Magnum::GL::Buffer  m_animInstances;
+    uint32_t            m_animSlotNext{0};
+
+    /// Meshes that already have m_animInstances attached as an instanced
+    /// vertex buffer; meshes are shared between plumes of the same effect
+    std::set<MeshGlId>  m_animMeshes;
+
     acomp_storage_t<osp::Matrix4>       *m_pDrawTf{nullptr};
     acomp_storage_t<ACompExhaustPlume>  *m_pExaustPlumes{nullptr};
     acomp_storage_t<MeshGlId>           *m_pMeshId{nullptr};
@@ -45,11 +45,13 @@ void adera::shader::draw_ent_visualizer(
     assert(pData != nullptr);
     auto &rData = *reinterpret_cast<ACtxDrawMeshVisualizer*>(pData);
 
-    Matrix4 const&  drawTf      = (*rData.m_pDrawTf)[ent];
+    Matrix4 const&  drawTf      = (*rData.m_pHot)[ent].drawTf;
     Matrix4 const   entRelative = viewProj.m_view * drawTf;
 
     MeshVisualizer &rShader = rData.m_shader;
 
+    bool const programChanged = rData.m_pBindCache->bind_program(&rShader);
+
     if (rShader.flags() & MeshVisualizer::Flag::NormalDirection)
     {
         rShader.setNormalMatrix(entRelative.normalMatrix());
@@ -57,17 +59,28 @@ void adera::shader::draw_ent_visualizer(
 
     if (rData.m_wireframeOnly)
     {
-        rShader.setColor(0x00000000_rgbaf);
+        if (programChanged)
+        {
+            rShader.setColor(0x00000000_rgbaf);
+        }
         Magnum::GL::Renderer::setDepthMask(GL_FALSE);
     }
 
     MeshGlId const      meshId = (*rData.m_pMeshId)[ent].m_glId;
     Magnum::GL::Mesh    &rMesh = rData.m_pMeshGl->get(meshId);
 
+    rData.m_pBindCache->bind_mesh(meshId);
+
+    if (programChanged)
+    {
+        // Viewport and projection hold for the whole pass
+        rShader
+            .setViewportSize(Vector2{Magnum::GL::defaultFramebuffer.viewport().size()})
+            .setProjectionMatrix(viewProj.m_proj);
+    }
+
     rShader
-        .setViewportSize(Vector2{Magnum::GL::defaultFramebuffer.viewport().size()})
         .setTransformationMatrix(entRelative)
-        .setProjectionMatrix(viewProj.m_proj)
         .draw(rMesh);
 
     if (rData.m_wireframeOnly)
@@ -37,9 +37,10 @@ struct ACtxDrawMeshVisualizer
 {
     MeshVisualizer m_shader{Corrade::NoCreate};
 
-    osp::draw::DrawTransforms_t         *m_pDrawTf{nullptr};
+    osp::draw::DrawEntHots_t            *m_pHot{nullptr};
     osp::draw::MeshGlEntStorage_t       *m_pMeshId{nullptr};
     osp::draw::MeshGlStorage_t          *m_pMeshGl{nullptr};
+    osp::draw::GlBindCache              *m_pBindCache{nullptr};
 
     osp::draw::MaterialId               m_materialId { lgrn::id_null<osp::draw::MaterialId>() };
 
@@ -49,9 +50,10 @@ constexpr void assign_pointers(osp::draw::ACtxSceneRender&      rScnRender,
                                osp::draw::ACtxSceneRenderGL&    rScnRenderGl,
                                osp::draw::RenderGL&             rRenderGl) noexcept
     {
-        m_pDrawTf   = &rScnRender.m_drawTransform;
+        m_pHot      = &rScnRender.hot;
         m_pMeshId   = &rScnRenderGl.m_meshId;
         m_pMeshGl   = &rRenderGl.m_meshGl;
+        m_pBindCache = &rRenderGl.m_bindCache;
     }
 };
 
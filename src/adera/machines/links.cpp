@@ -24,6 +24,8 @@
  */
 #include "links.h"
 
+#include <osp/util/logging.h>
+
 using namespace osp;
 
 using osp::link::MachTypeReg_t;
@@ -63,5 +65,69 @@ float thruster_influence(Vector3 const pos, Vector3 const dir, Vector3 const cmd
     return std::clamp(influence, 0.0f, 1.0f);
 }
 
+bool update_rcsdrivers(
+        ArrayView<link::MachLocalId const> const    toUpdate,
+        link::SignalPortTable const&                ports,
+        link::SignalValues_t<float> const&          sigValFloat,
+        link::UpdateNodes<float>&                   rSigUpdFloat) noexcept
+{
+    using osp::link::MachLocalId;
+    using osp::link::NodeId;
+
+    bool changed = false;
+
+    for (MachLocalId const local : toUpdate)
+    {
+        NodeId const thrNode = ports.get(ports_rcsdriver::gc_throttleOut.port, local);
+        if (thrNode == lgrn::id_null<NodeId>())
+        {
+            continue; // Throttle Output not connected, calculations below are useless
+        }
+
+        auto const rcs_read = [&sigValFloat, &ports, local] (float& rDstVar, PortEntry const& entry)
+        {
+            NodeId const node = ports.get(entry.port, local);
+
+            if (node != lgrn::id_null<NodeId>())
+            {
+                rDstVar = sigValFloat[node];
+            }
+        };
+
+        Vector3 pos     {0.0f};
+        Vector3 dir     {0.0f};
+        Vector3 cmdLin  {0.0f};
+        Vector3 cmdAng  {0.0f};
+
+        rcs_read( pos.x(),    ports_rcsdriver::gc_posXIn    );
+        rcs_read( pos.y(),    ports_rcsdriver::gc_posYIn    );
+        rcs_read( pos.z(),    ports_rcsdriver::gc_posZIn    );
+        rcs_read( dir.x(),    ports_rcsdriver::gc_dirXIn    );
+        rcs_read( dir.y(),    ports_rcsdriver::gc_dirYIn    );
+        rcs_read( dir.z(),    ports_rcsdriver::gc_dirZIn    );
+        rcs_read( cmdLin.x(), ports_rcsdriver::gc_cmdLinXIn );
+        rcs_read( cmdLin.y(), ports_rcsdriver::gc_cmdLinYIn );
+        rcs_read( cmdLin.z(), ports_rcsdriver::gc_cmdLinZIn );
+        rcs_read( cmdAng.x(), ports_rcsdriver::gc_cmdAngXIn );
+        rcs_read( cmdAng.y(), ports_rcsdriver::gc_cmdAngYIn );
+        rcs_read( cmdAng.z(), ports_rcsdriver::gc_cmdAngZIn );
+
+        OSP_LOG_TRACE("RCS controller {} pitch = {}", local, cmdAng.x());
+        OSP_LOG_TRACE("RCS controller {} yaw = {}", local, cmdAng.y());
+        OSP_LOG_TRACE("RCS controller {} roll = {}", local, cmdAng.z());
+
+        float const thrCurr = sigValFloat[thrNode];
+        float const thrNew = thruster_influence(pos, dir, cmdLin, cmdAng);
+
+        if (thrCurr != thrNew)
+        {
+            rSigUpdFloat.assign(thrNode, thrNew);
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
 
 } // namespace adera
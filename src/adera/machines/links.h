@@ -72,8 +72,23 @@ PortEntry const gc_cmdAngXIn        { gc_ntSigFloat, 9, gc_sigIn };
 PortEntry const gc_cmdAngYIn        { gc_ntSigFloat, 10, gc_sigIn };
 PortEntry const gc_cmdAngZIn        { gc_ntSigFloat, 11, gc_sigIn };
 PortEntry const gc_throttleOut      { gc_ntSigFloat, 12, gc_sigOut };
+constexpr osp::link::PortId gc_portCount {13};
 }
 
 float thruster_influence(osp::Vector3 pos, osp::Vector3 dir, osp::Vector3 cmdLin, osp::Vector3 cmdAng) noexcept;
 
+/**
+ * @brief Batch update kernel for RCS Drivers
+ *
+ * Reads control inputs and writes new throttle outputs for a span of dirty
+ * machines in one loop, gathered with osp::link::batch_dirty_machines.
+ *
+ * @return true if any output changed, requesting another machine update loop
+ */
+bool update_rcsdrivers(
+        osp::ArrayView<osp::link::MachLocalId const> toUpdate,
+        osp::link::SignalPortTable const&            ports,
+        osp::link::SignalValues_t<float> const&      sigValFloat,
+        osp::link::UpdateNodes<float>&               rSigUpdFloat) noexcept;
+
 } // namespace adera
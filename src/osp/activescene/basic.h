@@ -74,6 +74,22 @@ struct ACtxSceneGraph
 
     std::vector<TreePos_t>  m_delete;
 
+    // Auxiliary children lookup: each tree position's children packed into one contiguous
+    // range of m_childArray, so hot traversals iterate children as a span instead of hopping
+    // descendant counts. Rebuilt by SysSceneGraph::update_children_spans once stale; structural
+    // changes (SysSceneGraph::add_descendants, do_delete) mark it stale.
+    osp::KeyedVec<TreePos_t, uint32_t>  m_posChildFirst;    ///< Offsets into m_childArray
+    osp::KeyedVec<TreePos_t, uint32_t>  m_posChildCount;
+    std::vector<ActiveEnt>              m_childArray;
+    bool                                m_childrenStale{true};
+
+    // Entities whose ACompTransform changed since the last clear_transform_dirty, with bits also
+    // kept on their ancestors (m_subtreeTransformDirty) so traversals can skip whole subtrees
+    // containing no changes. Optional; scenes that never mark keep both empty, which consumers
+    // treat as every transform changed. see SysSceneGraph::mark_transform_dirty
+    ActiveEntSet_t          m_transformDirty;
+    ActiveEntSet_t          m_subtreeTransformDirty;
+
     void resize(std::size_t ents)
     {
         m_treeToEnt         .reserve(ents);
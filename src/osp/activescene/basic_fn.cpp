@@ -27,6 +27,7 @@
 #include <Corrade/Containers/ArrayViewStl.h>
 
 #include <algorithm>
+#include <cassert>
 
 using namespace osp;
 using namespace osp::active;
@@ -41,6 +42,9 @@ SubtreeBuilder SubtreeBuilder::add_child(ActiveEnt ent, uint32_t descendantCount
     m_rScnGraph.m_entParent[ent]            = m_root;
     m_rScnGraph.m_entToTreePos[ent]         = m_first;
 
+    // Newly added entities start with changed transforms
+    SysSceneGraph::mark_transform_dirty(m_rScnGraph, ent);
+
     TreePos_t const childFirst = m_first + 1;
     TreePos_t const childLast  = childFirst + descendantCount;
 
@@ -49,6 +53,35 @@ SubtreeBuilder SubtreeBuilder::add_child(ActiveEnt ent, uint32_t descendantCount
     return {m_rScnGraph, ent, childFirst, childLast};
 }
 
+void SubtreeBuilder::add_subtree(
+        ArrayView<ActiveEnt const>  ents,
+        ArrayView<uint32_t const>   descendants,
+        ArrayView<int32_t const>    parents)
+{
+    assert(descendants.size() == ents.size());
+    assert(parents    .size() == ents.size());
+    assert(m_first + ents.size() <= m_last);
+
+    // Input arrays are already the tree's depth-first layout; write them
+    // straight into place instead of recursing through nested builders
+    for (std::size_t i = 0; i < ents.size(); ++i)
+    {
+        ActiveEnt const ent = ents[i];
+        TreePos_t const pos = m_first + TreePos_t(i);
+
+        m_rScnGraph.m_treeToEnt[pos]        = ent;
+        m_rScnGraph.m_treeDescendants[pos]  = descendants[i];
+        m_rScnGraph.m_entParent[ent]        = (parents[i] == -1)
+                                            ? m_root
+                                            : ents[parents[i]];
+        m_rScnGraph.m_entToTreePos[ent]     = pos;
+
+        SysSceneGraph::mark_transform_dirty(m_rScnGraph, ent);
+    }
+
+    m_first += TreePos_t(ents.size());
+}
+
 SubtreeBuilder SysSceneGraph::add_descendants(ACtxSceneGraph& rScnGraph, uint32_t descendantCount, ActiveEnt root)
 {
     TreePos_t const rootPos         = (root == lgrn::id_null<ActiveEnt>())
@@ -66,6 +99,8 @@ SubtreeBuilder SysSceneGraph::add_descendants(ACtxSceneGraph& rScnGraph, uint32_
     rScnGraph.m_treeToEnt.resize(treeNewSize);
     rScnGraph.m_treeDescendants.resize(treeNewSize);
 
+    rScnGraph.m_childrenStale = true;
+
     SubtreeBuilder out(rScnGraph, root, subFirst, subLast);
 
     if (subFirst != treeOldSize)
@@ -133,11 +168,112 @@ ChildRange_t SysSceneGraph::children(ACtxSceneGraph const& rScnGraph, ActiveEnt
                         ChildIterator{&rScnGraph, childLast}};
 }
 
+void SysSceneGraph::update_children_spans(ACtxSceneGraph& rScnGraph)
+{
+    if ( ! rScnGraph.m_childrenStale)
+    {
+        return;
+    }
+
+    TreePos_t const treeSize = 1 + rScnGraph.m_treeDescendants[0];
+
+    rScnGraph.m_posChildFirst.resize(treeSize);
+    rScnGraph.m_posChildCount.resize(treeSize);
+    rScnGraph.m_childArray   .resize(treeSize - 1);
+
+    std::fill(rScnGraph.m_posChildCount.begin(), rScnGraph.m_posChildCount.end(), 0u);
+
+    // Count children per position, then prefix-sum into offsets
+    for (TreePos_t pos = 1; pos < treeSize; pos ++)
+    {
+        ActiveEnt const parent      = rScnGraph.m_entParent[rScnGraph.m_treeToEnt[pos]];
+        TreePos_t const parentPos   = (parent == lgrn::id_null<ActiveEnt>())
+                                    ? 0
+                                    : rScnGraph.m_entToTreePos[parent];
+        rScnGraph.m_posChildCount[parentPos] ++;
+    }
+
+    uint32_t offset = 0;
+    for (TreePos_t pos = 0; pos < treeSize; pos ++)
+    {
+        rScnGraph.m_posChildFirst[pos] = offset;
+        offset += rScnGraph.m_posChildCount[pos];
+    }
+
+    // Scatter; offsets become end-offsets, restored right after. Visiting in tree order keeps
+    // each parent's children sorted by position.
+    for (TreePos_t pos = 1; pos < treeSize; pos ++)
+    {
+        ActiveEnt const ent         = rScnGraph.m_treeToEnt[pos];
+        ActiveEnt const parent      = rScnGraph.m_entParent[ent];
+        TreePos_t const parentPos   = (parent == lgrn::id_null<ActiveEnt>())
+                                    ? 0
+                                    : rScnGraph.m_entToTreePos[parent];
+        rScnGraph.m_childArray[rScnGraph.m_posChildFirst[parentPos] ++] = ent;
+    }
+
+    for (TreePos_t pos = 0; pos < treeSize; pos ++)
+    {
+        rScnGraph.m_posChildFirst[pos] -= rScnGraph.m_posChildCount[pos];
+    }
+
+    rScnGraph.m_childrenStale = false;
+}
+
+ArrayView<ActiveEnt const> SysSceneGraph::children_span(ACtxSceneGraph const& rScnGraph, ActiveEnt parent)
+{
+    assert( ! rScnGraph.m_childrenStale); // see update_children_spans
+
+    TreePos_t const parentPos = (parent == lgrn::id_null<ActiveEnt>())
+                              ? 0
+                              : rScnGraph.m_entToTreePos[parent];
+
+    uint32_t const first = rScnGraph.m_posChildFirst[parentPos];
+    uint32_t const count = rScnGraph.m_posChildCount[parentPos];
+
+    return (count == 0)
+            ? ArrayView<ActiveEnt const>{}
+            : arrayView(rScnGraph.m_childArray.data(), rScnGraph.m_childArray.size()).slice(first, first + count);
+}
+
+void SysSceneGraph::mark_transform_dirty(ACtxSceneGraph& rScnGraph, ActiveEnt ent)
+{
+    if (rScnGraph.m_transformDirty.size() <= std::size_t(ent.value))
+    {
+        std::size_t const size = std::max(rScnGraph.m_entParent.size(),
+                                          std::size_t(ent.value) + 1);
+        bitvector_resize(rScnGraph.m_transformDirty,        size);
+        bitvector_resize(rScnGraph.m_subtreeTransformDirty, size);
+    }
+
+    rScnGraph.m_transformDirty.set(ent.value);
+
+    // Stop once an ancestor already has its subtree bit; everything above it does too
+    ActiveEnt parent = rScnGraph.m_entParent[ent];
+    while (   parent != lgrn::id_null<ActiveEnt>()
+           && ! rScnGraph.m_subtreeTransformDirty.test(parent.value) )
+    {
+        rScnGraph.m_subtreeTransformDirty.set(parent.value);
+        parent = rScnGraph.m_entParent[parent];
+    }
+}
+
+void SysSceneGraph::clear_transform_dirty(ACtxSceneGraph& rScnGraph) noexcept
+{
+    auto &rDirtyInts   = rScnGraph.m_transformDirty.ints();
+    auto &rSubtreeInts = rScnGraph.m_subtreeTransformDirty.ints();
+
+    std::fill(rDirtyInts.begin(),   rDirtyInts.end(),   bitint_t{0});
+    std::fill(rSubtreeInts.begin(), rSubtreeInts.end(), bitint_t{0});
+}
+
 void SysSceneGraph::do_delete(ACtxSceneGraph& rScnGraph)
 {
-    // Delete subtrees by carefully shifting elements left
-    // Operation being a single left->right swoop. This should be pretty fast
-    // since this is only a few KB in size, and is done once per update
+    // Coalesce queued subtree positions into sorted disjoint ranges, then
+    // compact the tree by shifting elements left in a single left->right
+    // swoop. Duplicates and subtrees nested inside another queued subtree are
+    // skipped, and back-to-back subtrees share one shift, so mass deletions
+    // stay linear no matter how they were queued.
 
     std::sort(rScnGraph.m_delete.begin(), rScnGraph.m_delete.end());
 
@@ -146,44 +282,58 @@ void SysSceneGraph::do_delete(ACtxSceneGraph& rScnGraph)
     auto const& itTreeDescFirst = rScnGraph.m_treeDescendants.begin();
     auto const& itTreeEntsFirst = rScnGraph.m_treeToEnt.begin();
 
-    auto const& itDelFirst      = rScnGraph.m_delete.begin();
     auto const& itDelLast       = rScnGraph.m_delete.end();
-    auto        itDel           = itDelFirst;
+    auto        itDel           = rScnGraph.m_delete.begin();
 
-    TreePos_t const untouched = (*itDel);
-    TreePos_t done = untouched;
+    TreePos_t done = (*itDel);
 
     while (itDel != itDelLast)
     {
-        auto const itDelNext = std::next(itDel);
-        bool const notLast = (itDelNext != itDelLast);
+        TreePos_t const removeFirst = (*itDel);
+        TreePos_t       removeLast  = removeFirst;
 
-        uint32_t const removeTotal = 1 + rScnGraph.m_treeDescendants[*itDel];
+        // Grow the removed range while queued positions continue it. Each
+        // range-extending subtree root also updates ancestor counts; queued
+        // positions inside the range are already covered by a previous root.
+        while (itDel != itDelLast && (*itDel) <= removeLast)
+        {
+            TreePos_t const pos = (*itDel);
+            std::advance(itDel, 1);
+
+            if (pos < removeLast)
+            {
+                continue; // Duplicate, or nested in a subtree already removed
+            }
+
+            uint32_t const removeTotal = 1 + rScnGraph.m_treeDescendants[pos];
+            removeLast = pos + removeTotal;
+
+            // Update descendant count of ancestors
+            ActiveEnt parent = rScnGraph.m_treeToEnt[pos];
+            bool parentNotNull = true;
+            while (parentNotNull)
+            {
+                parent = rScnGraph.m_entParent[parent];
+                parentNotNull = (parent != lgrn::id_null<ActiveEnt>());
+                TreePos_t const parentPos = parentNotNull ? rScnGraph.m_entToTreePos[parent] : 0;
+                rScnGraph.m_treeDescendants[parentPos] -= removeTotal;
+            }
+        }
 
         // State of array each iteration:
         //
-        // [Done] [Prev. shifted] [Delete] [Keep] [Delete Next] ....
-        //        <--------SHIFT-----------|----|
+        // [Done] [Prev. shifted] [Remove range] [Keep] [Next range] ....
+        //        <--------SHIFT----------------|------|
 
-        TreePos_t const keepFirst   = (*itDel) + removeTotal;
-        TreePos_t const keepLast    = (notLast) ? (*itDelNext) : (treeLast);
+        bool const notLast          = (itDel != itDelLast);
+        TreePos_t const keepFirst   = removeLast;
+        TreePos_t const keepLast    = (notLast) ? (*itDel) : (treeLast);
         assert(keepFirst <= keepLast);
 
         std::ptrdiff_t const shift  = keepFirst - done;
 
-        // Update descendant count of ancestors
-        ActiveEnt parent = rScnGraph.m_treeToEnt[*itDel];
-        bool parentNotNull = true;
-        while (parentNotNull)
-        {
-            parent = rScnGraph.m_entParent[parent];
-            parentNotNull = (parent != lgrn::id_null<ActiveEnt>());
-            TreePos_t const parentPos = parentNotNull ? rScnGraph.m_entToTreePos[parent] : 0;
-            rScnGraph.m_treeDescendants[parentPos] -= removeTotal;
-        }
-
         // Clear values for entities to delete
-        std::for_each(itTreeEntsFirst + (*itDel), itTreeEntsFirst + (*itDel) + removeTotal,
+        std::for_each(itTreeEntsFirst + removeFirst, itTreeEntsFirst + removeLast,
                       [&rScnGraph] (ActiveEnt const ent)
         {
             rScnGraph.m_entParent[ent]      = lgrn::id_null<ActiveEnt>();
@@ -202,11 +352,14 @@ void SysSceneGraph::do_delete(ACtxSceneGraph& rScnGraph)
         std::shift_left(itTreeEntsFirst + done, itTreeEntsFirst + keepLast, shift);
 
         done += keepLast - keepFirst;
-        itDel = itDelNext;
     }
 
     rScnGraph.m_treeToEnt      .resize(done);
     rScnGraph.m_treeDescendants.resize(done);
 
     rScnGraph.m_delete.clear();
+
+    // Compaction shifted positions; refresh the children lookup while the tree is hot
+    rScnGraph.m_childrenStale = true;
+    update_children_spans(rScnGraph);
 }
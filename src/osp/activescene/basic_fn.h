@@ -65,6 +65,18 @@ public:
         (void) add_child(ent, 0);
     }
 
+    /**
+     * @brief Add a whole pre-flattened subtree in a single pass
+     *
+     * All three arrays are the same size and in depth-first order, matching the
+     * tree's own layout: descendants holds each entity's subtree size, and
+     * parents indexes into \p ents, with -1 meaning a direct child of this
+     * builder's root. Consumes ents.size() reserved slots.
+     */
+    void add_subtree(ArrayView<ActiveEnt const> ents,
+                     ArrayView<uint32_t const>  descendants,
+                     ArrayView<int32_t const>   parents);
+
     std::size_t remaining()
     {
         assert(m_last >= m_first);
@@ -152,11 +164,42 @@ public:
     static ChildRange_t children(ACtxSceneGraph const& rScnGraph, ActiveEnt parent = lgrn::id_null<ActiveEnt>());
 
     /**
-     * @brief Remove multiple entities from a scene graph
+     * @brief Rebuild the contiguous children lookup if structural changes made it stale
+     *
+     * Call once before traversals that use children_span; no-op while fresh.
+     */
+    static void update_children_spans(ACtxSceneGraph& rScnGraph);
+
+    /**
+     * @return An entity's children as one contiguous span, in tree order
+     *
+     * Requires update_children_spans since the last structural change; prefer this over
+     * children() in hot traversals, which otherwise hop descendant counts per child.
+     */
+    static ArrayView<ActiveEnt const> children_span(ACtxSceneGraph const& rScnGraph, ActiveEnt parent = lgrn::id_null<ActiveEnt>());
+
+    /**
+     * @brief Mark an entity's ACompTransform as changed
+     *
+     * Also sets ACtxSceneGraph::m_subtreeTransformDirty on all ancestors. SubtreeBuilder
+     * marks newly added entities itself; anything that writes an existing transform must call
+     * this, or consumers that skip clean subtrees (eg. SysRender::update_draw_transforms) will
+     * keep stale results.
+     */
+    static void mark_transform_dirty(ACtxSceneGraph& rScnGraph, ActiveEnt ent);
+
+    /**
+     * @brief Clear all transform dirty bits, called by the consumer once changes are applied
+     */
+    static void clear_transform_dirty(ACtxSceneGraph& rScnGraph) noexcept;
+
+    /**
+     * @brief Remove multiple entities and their descendants from a scene graph
      *
-     * @warning Do not include entities that are ancestors of any other entity
-     *          in the same range. All given entities should be a root of a
-     *          unique subtree.
+     * All queued subtrees are coalesced into sorted ranges and removed with
+     * one compaction sweep. Duplicates and entities that are descendants of
+     * another entity in the same range are allowed; they fold into their
+     * ancestor's subtree.
      */
     template<typename ITA_T, typename ITB_T>
     static void cut(ACtxSceneGraph& rScnGraph, ITA_T first, ITB_T const& last);
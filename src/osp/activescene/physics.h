@@ -29,6 +29,8 @@
 #include "../core/keyed_vector.h"
 #include "../scientific/shapes.h"
 
+#include <cstdint>
+
 namespace osp::active
 {
 
@@ -42,6 +44,20 @@ struct ACompMass
     float   m_mass;
 };
 
+/**
+ * @brief Cached mass properties of an entity's collider subtree, in its own frame
+ *
+ * m_inertia is taken about m_com. An entry is only valid while it exists in
+ * ACtxPhysics::m_subtreeMass; SysPhysics::invalidate_subtree_mass removes
+ * entries when masses within a subtree change.
+ */
+struct ACompSubtreeMass
+{
+    Matrix3 m_inertia;
+    Vector3 m_com;
+    float   m_mass;
+};
+
 /**
  * @brief Physics components and other data needed to support physics in a scene
  */
@@ -50,11 +66,28 @@ struct ACtxPhysics
     KeyedVec<ActiveEnt, EShape>     m_shape;
     ActiveEntSet_t                  m_hasColliders;
     Storage_t<ActiveEnt, ACompMass> m_mass;
+    Storage_t<ActiveEnt, ACompSubtreeMass> m_subtreeMass;
     Vector3                         m_originTranslate;
     ActiveEntVec_t                  m_colliderDirty;
 
+    /// Hash of each collider's last-applied shape and transform, written by the physics
+    /// engine's collider update. Wholesale invalidations (eg. a scene load queueing every
+    /// collider) rarely change most of them; comparing stamps lets unchanged colliders skip
+    /// engine work entirely. Zero means never applied.
+    KeyedVec<ActiveEnt, std::uint64_t> m_colliderStamp;
+
     std::vector< std::pair<ActiveEnt, Vector3> > m_setVelocity;
 
+    /// Entities whose rigid bodies must be woken this frame, queued by gameplay events that
+    /// Newton can't see (proximity triggers, grabs, structural edits). Consumed by the
+    /// physics engine's world update; entities without a body are ignored.
+    ActiveEntVec_t                  m_wake;
+
+    /// Bodies moving faster than this (meters/second) get swept (continuous) collision
+    /// detection so they can't tunnel through thin geometry in one step; slower bodies keep
+    /// the cheap discrete test. Zero or negative leaves every body discrete.
+    float                           m_ccdSpeedThreshold{30.0f};
+
 }; // struct ACtxPhysics
 
 
@@ -37,26 +37,127 @@ void SysPhysics::calculate_subtree_mass_center(
         float&                                  rTotalMass,
         Matrix4 const&                          currentTf)
 {
-    for (ActiveEnt const child : SysSceneGraph::children(rScnGraph, root))
+    TreePos_t const rootPos = rScnGraph.m_entToTreePos[root];
+    TreePos_t const first   = rootPos + 1;
+    TreePos_t const last    = first + rScnGraph.m_treeDescendants[rootPos];
+
+    // Root-relative transforms composed in one flat sweep; parents precede
+    // children in tree order. Subtrees below non-collider entities are skipped.
+    std::vector<Matrix4> relTf(last - first);
+
+    for (TreePos_t pos = first; pos < last; )
     {
-        Matrix4 const childTf = currentTf * rTf.get(child).m_transform;
+        ActiveEnt const ent         = rScnGraph.m_treeToEnt[pos];
+        TreePos_t const parentPos   = rScnGraph.m_entToTreePos[rScnGraph.m_entParent[ent]];
+
+        Matrix4 const& parentTf = (parentPos == rootPos) ? currentTf : relTf[parentPos - first];
+        Matrix4 const& entTf    = (relTf[pos - first] = parentTf * rTf.get(ent).m_transform);
 
-        if (rCtxPhys.m_mass.contains(child))
+        if (rCtxPhys.m_mass.contains(ent))
         {
-            ACompMass const& childMass = rCtxPhys.m_mass.get(child);
+            ACompMass const& entMass = rCtxPhys.m_mass.get(ent);
 
-            Matrix3 inertiaTensor{};
-            inertiaTensor[0][0] = childMass.m_inertia.x();
-            inertiaTensor[1][1] = childMass.m_inertia.y();
-            inertiaTensor[2][2] = childMass.m_inertia.z();
+            rTotalMass  += entMass.m_mass;
+            rMassPos    += entTf.translation() * entMass.m_mass;
+        }
+
+        pos += rCtxPhys.m_hasColliders.test(std::size_t(ent))
+             ? 1
+             : 1 + rScnGraph.m_treeDescendants[pos];
+    }
+}
+
+
+ACompSubtreeMass const& SysPhysics::update_subtree_mass(
+        ACompTransformStorage_t const&          rTf,
+        ACtxPhysics&                            rCtxPhys,
+        ACtxSceneGraph const&                   rScnGraph,
+        ActiveEnt                               root)
+{
+    if (rCtxPhys.m_subtreeMass.contains(root))
+    {
+        return rCtxPhys.m_subtreeMass.get(root);
+    }
+
+    // Bodies combined into the rollup: root's own mass plus child rollups,
+    // each with a center of mass and an inertia tensor about it in root's frame
+    struct Body
+    {
+        Matrix3 m_inertia;
+        Matrix3 m_rotation;
+        Vector3 m_com;
+        float   m_mass;
+    };
+    std::vector<Body> bodies;
+
+    if (rCtxPhys.m_mass.contains(root))
+    {
+        ACompMass const& rootMass = rCtxPhys.m_mass.get(root);
+
+        Matrix3 inertia{};
+        inertia[0][0] = rootMass.m_inertia.x();
+        inertia[1][1] = rootMass.m_inertia.y();
+        inertia[2][2] = rootMass.m_inertia.z();
+
+        bodies.push_back({inertia, Matrix3{}, rootMass.m_offset, rootMass.m_mass});
+    }
+
+    if (rCtxPhys.m_hasColliders.test(std::size_t(root)))
+    {
+        for (ActiveEnt const child : SysSceneGraph::children(rScnGraph, root))
+        {
+            Matrix4 const& childTf = rTf.get(child).m_transform;
+
+            // Copied; recursing into the next child may grow m_subtreeMass
+            ACompSubtreeMass const childMass
+                    = update_subtree_mass(rTf, rCtxPhys, rScnGraph, child);
+
+            if (childMass.m_mass == 0.0f)
+            {
+                continue;
+            }
 
-            rTotalMass  += childMass.m_mass;
-            rMassPos    += childTf.translation() * childMass.m_mass;
+            bodies.push_back({childMass.m_inertia, childTf.rotation(),
+                              childTf.transformPoint(childMass.m_com),
+                              childMass.m_mass});
         }
+    }
+
+    float   totalMass = 0.0f;
+    Vector3 massPos{0.0f};
+
+    for (Body const& body : bodies)
+    {
+        totalMass   += body.m_mass;
+        massPos     += body.m_com * body.m_mass;
+    }
+
+    Vector3 const com = (totalMass != 0.0f) ? (massPos / totalMass) : Vector3{0.0f};
+
+    Matrix3 inertia{0.0f};
+    for (Body const& body : bodies)
+    {
+        inertia += transform_inertia_tensor(
+                body.m_inertia, body.m_mass, body.m_com - com, body.m_rotation);
+    }
 
-        if (rCtxPhys.m_hasColliders.test(std::size_t(child)))
+    rCtxPhys.m_subtreeMass.emplace(root, ACompSubtreeMass{inertia, com, totalMass});
+
+    return rCtxPhys.m_subtreeMass.get(root);
+}
+
+
+void SysPhysics::invalidate_subtree_mass(
+        ACtxPhysics&                            rCtxPhys,
+        ACtxSceneGraph const&                   rScnGraph,
+        ActiveEnt                               ent) noexcept
+{
+    for (ActiveEnt next = ent; next != lgrn::id_null<ActiveEnt>();
+         next = rScnGraph.m_entParent[next])
+    {
+        if (rCtxPhys.m_subtreeMass.contains(next))
         {
-            calculate_subtree_mass_center(rTf, rCtxPhys, rScnGraph, child, rMassPos, rTotalMass, childTf);
+            rCtxPhys.m_subtreeMass.remove(next);
         }
     }
 }
@@ -70,27 +171,36 @@ void SysPhysics::calculate_subtree_mass_inertia(
         Matrix3&                                rInertiaTensor,
         Matrix4 const&                          currentTf)
 {
-    for (ActiveEnt const child : SysSceneGraph::children(rScnGraph, root))
+    TreePos_t const rootPos = rScnGraph.m_entToTreePos[root];
+    TreePos_t const first   = rootPos + 1;
+    TreePos_t const last    = first + rScnGraph.m_treeDescendants[rootPos];
+
+    std::vector<Matrix4> relTf(last - first);
+
+    for (TreePos_t pos = first; pos < last; )
     {
-        Matrix4 const childTf = currentTf * rTf.get(child).m_transform;
+        ActiveEnt const ent         = rScnGraph.m_treeToEnt[pos];
+        TreePos_t const parentPos   = rScnGraph.m_entToTreePos[rScnGraph.m_entParent[ent]];
 
-        if (rCtxPhys.m_mass.contains(child))
+        Matrix4 const& parentTf = (parentPos == rootPos) ? currentTf : relTf[parentPos - first];
+        Matrix4 const& entTf    = (relTf[pos - first] = parentTf * rTf.get(ent).m_transform);
+
+        if (rCtxPhys.m_mass.contains(ent))
         {
-            ACompMass const& childMass = rCtxPhys.m_mass.get(child);
+            ACompMass const& entMass = rCtxPhys.m_mass.get(ent);
 
             Matrix3 inertiaTensor{};
-            inertiaTensor[0][0] = childMass.m_inertia.x();
-            inertiaTensor[1][1] = childMass.m_inertia.y();
-            inertiaTensor[2][2] = childMass.m_inertia.z();
+            inertiaTensor[0][0] = entMass.m_inertia.x();
+            inertiaTensor[1][1] = entMass.m_inertia.y();
+            inertiaTensor[2][2] = entMass.m_inertia.z();
 
-            Vector3 const offset = childTf.translation() + childMass.m_offset * childTf.scaling();
+            Vector3 const offset = entTf.translation() + entMass.m_offset * entTf.scaling();
 
-            rInertiaTensor += transform_inertia_tensor(inertiaTensor, childMass.m_mass, offset, childTf.rotation());
+            rInertiaTensor += transform_inertia_tensor(inertiaTensor, entMass.m_mass, offset, entTf.rotation());
         }
 
-        if (rCtxPhys.m_hasColliders.test(std::size_t(child)))
-        {
-            calculate_subtree_mass_inertia(rTf, rCtxPhys, rScnGraph, child, rInertiaTensor, childTf);
-        }
+        pos += rCtxPhys.m_hasColliders.test(std::size_t(ent))
+             ? 1
+             : 1 + rScnGraph.m_treeDescendants[pos];
     }
 }
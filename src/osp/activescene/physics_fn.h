@@ -53,15 +53,80 @@ public:
             Matrix3&                                rInertiaTensor,
             Matrix4 const&                          currentTf = {});
 
+    /**
+     * @brief Get cached mass properties of an entity's collider subtree,
+     *        recomputing invalidated branches
+     *
+     * Rollups are cached per-entity in ACtxPhysics::m_subtreeMass, so only
+     * branches with no valid entry are traversed; changing one part of a large
+     * weld recomputes the path to it, not the whole subtree. Descends past an
+     * entity only while m_hasColliders is set, like the calculate_subtree_*
+     * functions.
+     *
+     * @return Mass, center of mass, and inertia tensor in root's frame
+     */
+    static ACompSubtreeMass const& update_subtree_mass(
+            ACompTransformStorage_t const&          rTf,
+            ACtxPhysics&                            rCtxPhys,
+            ACtxSceneGraph const&                   rScnGraph,
+            ActiveEnt                               root);
+
+    /**
+     * @brief Remove cached subtree mass rollups of an entity and its ancestors
+     *
+     * Call when an entity's mass, shape, or transform changes; the next
+     * update_subtree_mass recomputes only the invalidated ancestry branch.
+     */
+    static void invalidate_subtree_mass(
+            ACtxPhysics&                            rCtxPhys,
+            ACtxSceneGraph const&                   rScnGraph,
+            ActiveEnt                               ent) noexcept;
+
+    /**
+     * @brief Refresh cached mass rollups of many subtree roots in one array pass
+     *
+     * Intended to run once per frame over a dirty list (eg: ACtxParts::weldDirty
+     * mapped through weldToActive). Consumers afterwards read the shared
+     * ACtxPhysics::m_subtreeMass cache with update_subtree_mass instead of each
+     * re-walking the hierarchy. Null entities are skipped.
+     */
+    template<typename IT_T, typename ITB_T>
+    static void update_subtree_mass_batch(
+            ACompTransformStorage_t const&          rTf,
+            ACtxPhysics&                            rCtxPhys,
+            ACtxSceneGraph const&                   rScnGraph,
+            IT_T                                    first,
+            ITB_T const&                            last);
+
     template<typename IT_T, typename ITB_T>
     static void update_delete_phys(ACtxPhysics& rCtxPhys, IT_T const& first, ITB_T const& last);
 
 };
 
+template<typename IT_T, typename ITB_T>
+void SysPhysics::update_subtree_mass_batch(
+        ACompTransformStorage_t const&  rTf,
+        ACtxPhysics&                    rCtxPhys,
+        ACtxSceneGraph const&           rScnGraph,
+        IT_T                            first,
+        ITB_T const&                    last)
+{
+    while (first != last)
+    {
+        ActiveEnt const root = *first;
+        if (root != lgrn::id_null<ActiveEnt>())
+        {
+            update_subtree_mass(rTf, rCtxPhys, rScnGraph, root);
+        }
+        ++first;
+    }
+}
+
 template<typename IT_T, typename ITB_T>
 void SysPhysics::update_delete_phys(ACtxPhysics& rCtxPhys, IT_T const& first, ITB_T const& last)
 {
     rCtxPhys.m_mass.remove(first, last);
+    rCtxPhys.m_subtreeMass.remove(first, last);
 }
 
 
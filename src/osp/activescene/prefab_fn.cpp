@@ -81,37 +81,17 @@ void SysPrefabInit::add_to_subtree(
         Resources const&                    rResources,
         SubtreeBuilder&                     bldPrefab) noexcept
 {
-    auto const &rImportData = rResources.data_get<osp::ImporterData const>(
+    auto const &rRecipes = rResources.data_get<osp::PrefabRecipes const>(
             gc_importer, basic.m_importerRes);
-    auto const &rPrefabData = rResources.data_get<osp::Prefabs const>(
-            gc_importer, basic.m_importerRes);
-
-    auto const& objs    = rPrefabData.m_prefabs[basic.m_prefabId];
-    auto const& parents = rPrefabData.m_prefabParents[basic.m_prefabId];
-
-    auto itObj      = std::begin(objs);
-    auto itEnt      = std::begin(ents);
-
-    auto const add_child_recurse
-            = [&rImportData, &itObj, &itEnt, &parents] (auto&& self, SubtreeBuilder& bldParent) -> void
-    {
-        std::size_t const descendants   = rImportData.m_objDescendants[*itObj];
-        auto bldChildren = bldParent.add_child(*itEnt, descendants);
-        auto children = rImportData.m_objChildren[*itObj];
-
-        std::advance(itObj, 1);
-        std::advance(itEnt, 1);
-
-        for ([[maybe_unused]] ObjId const child : children)
-        {
-            self(self, bldChildren);
-        }
-    };
+    PrefabRecipe const &rRecipe = rRecipes.m_recipes[basic.m_prefabId];
 
-    add_child_recurse(add_child_recurse, bldPrefab);
+    assert(ents.size() == rRecipe.m_parents.size());
 
-    assert(itObj == std::end(objs));
-    assert(itEnt == std::end(ents));
+    // Recipe arrays are already in the tree's depth-first layout
+    bldPrefab.add_subtree(
+            ents,
+            {rRecipe.m_descendants.data(), rRecipe.m_descendants.size()},
+            {rRecipe.m_parents.data(),     rRecipe.m_parents.size()});
 }
 
 void SysPrefabInit::init_transforms(
@@ -123,19 +103,15 @@ void SysPrefabInit::init_transforms(
 
     for (TmpPrefabRequest const& rPfBasic : rPrefabs.spawnRequest)
     {
-        auto const &rImportData = rResources.data_get<osp::ImporterData const>(
-                gc_importer, rPfBasic.m_importerRes);
-        auto const &rPrefabData = rResources.data_get<osp::Prefabs const>(
+        auto const &rRecipes = rResources.data_get<osp::PrefabRecipes const>(
                 gc_importer, rPfBasic.m_importerRes);
+        PrefabRecipe const &rRecipe = rRecipes.m_recipes[rPfBasic.m_prefabId];
 
-        auto const objects = rPrefabData.m_prefabs[rPfBasic.m_prefabId];
-        auto const parents = rPrefabData.m_prefabParents[rPfBasic.m_prefabId];
-
-        for (std::size_t i = 0; i < objects.size(); ++i)
+        for (std::size_t i = 0; i < rRecipe.m_parents.size(); ++i)
         {
-            Matrix4 const& transform = (parents[i] == -1)
+            Matrix4 const& transform = (rRecipe.m_parents[i] == -1)
                     ? *rPfBasic.m_pTransform
-                    : rImportData.m_objTransforms[objects[i]];
+                    : rRecipe.m_transforms[i];
             ActiveEnt const ent = (*itPfEnts)[i];
             rTransform.emplace(ent, transform);
         }
@@ -152,16 +128,13 @@ void SysPrefabInit::init_info(
 
     for (TmpPrefabRequest const& rPfBasic : rPrefabs.spawnRequest)
     {
-        auto const &rImportData = rResources.data_get<osp::ImporterData const>(
-                gc_importer, rPfBasic.m_importerRes);
-        auto const &rPrefabData = rResources.data_get<osp::Prefabs const>(
+        auto const &rRecipes = rResources.data_get<osp::PrefabRecipes const>(
                 gc_importer, rPfBasic.m_importerRes);
+        PrefabRecipe const &rRecipe = rRecipes.m_recipes[rPfBasic.m_prefabId];
 
-        auto const ents     = ArrayView<ActiveEnt const>{*itPfEnts};
-        auto const objects = rPrefabData.m_prefabs[rPfBasic.m_prefabId];
-        auto const parents = rPrefabData.m_prefabParents[rPfBasic.m_prefabId];
+        auto const ents = ArrayView<ActiveEnt const>{*itPfEnts};
 
-        for (std::size_t i = 0; i < objects.size(); ++i)
+        for (std::size_t i = 0; i < rRecipe.m_parents.size(); ++i)
         {
             ActiveEnt const ent = ents[i];
             PrefabInstanceInfo &rInfo = rPrefabs.instanceInfo[ent];
@@ -169,7 +142,7 @@ void SysPrefabInit::init_info(
             rInfo.prefab    = rPfBasic.m_prefabId;
             rInfo.obj       = static_cast<ObjId>(i);
 
-            if (parents[i] == -1)
+            if (rRecipe.m_parents[i] == -1)
             {
                 rPrefabs.roots.set(std::size_t(ent));
             }
@@ -187,39 +160,24 @@ void SysPrefabInit::init_physics(
 
     auto itPfEnts = rPrefabs.spawnedEntsOffset.begin();
 
+    // Mass properties for every spawned collider are gathered here and computed in one
+    // batched sweep after the loop, instead of one inertia tensor call per entity
+    std::vector<ActiveEnt>  massEnts;
+    std::vector<EShape>     massShapes;
+    std::vector<Vector3>    massScales;
+    std::vector<float>      massMasses;
+
     for (TmpPrefabRequest const& rPfBasic : rPrefabs.spawnRequest)
     {
-        auto const &rImportData = rResources.data_get<osp::ImporterData const>(
-                gc_importer, rPfBasic.m_importerRes);
-        auto const &rPrefabData = rResources.data_get<osp::Prefabs const>(
+        auto const &rRecipes = rResources.data_get<osp::PrefabRecipes const>(
                 gc_importer, rPfBasic.m_importerRes);
+        PrefabRecipe const &rRecipe = rRecipes.m_recipes[rPfBasic.m_prefabId];
 
         auto const ents     = ArrayView<ActiveEnt const>{*itPfEnts};
-        auto const objects  = lgrn::Span<int const>     {rPrefabData.m_prefabs[rPfBasic.m_prefabId]};
-        auto const parents  = lgrn::Span<int const>     {rPrefabData.m_prefabParents[rPfBasic.m_prefabId]};
-
-#if 0
-        auto const assign_dyn_recurse = [&rCtxPhys, ents, objects, parents] (auto const& self, int objectId, ActiveEnt ent) -> void
-        {
-            int const parentId = parents[objectId];
-            if (parentId == -1)
-            {
-                return;
-            }
-
-            ActiveEnt const parentEnt = ents[parentId];
-
-            if ( ! rCtxPhys.m_totalDyn.contains(parentEnt) )
-            {
-                rCtxPhys.m_totalDyn.emplace(parentEnt);
-            }
-
-            self(self, parentId, parentEnt);
-        };
-#endif
+        auto const parents  = lgrn::Span<int32_t const> {rRecipe.m_parents};
 
         auto const assign_collider_recurse
-                = [&rHasColliders = rCtxPhys.m_hasColliders, ents, objects, parents]
+                = [&rHasColliders = rCtxPhys.m_hasColliders, ents, parents]
                   (auto const& self, int objectId, ActiveEnt ent) -> void
         {
             if (rHasColliders.test(std::size_t(ent)))
@@ -236,34 +194,44 @@ void SysPrefabInit::init_physics(
             }
         };
 
-        for (std::size_t i = 0; i < objects.size(); ++i)
+        for (std::size_t i = 0; i < rRecipe.m_parents.size(); ++i)
         {
             ActiveEnt const ent         = ents[i];
-            int const       objectId    = objects[i];
-            float const     mass        = rPrefabData.m_objMass[objectId];
-            EShape const    shape       = rPrefabData.m_objShape[objectId];
+            float const     mass        = rRecipe.m_mass[i];
+            EShape const    shape       = rRecipe.m_shape[i];
 
 
             rCtxPhys.m_shape[ent] = shape;
 
             if (mass != 0.0f)
             {
-                Vector3 const scale = rImportData.m_objTransforms[objectId].scaling();
-                Vector3 const inertia = collider_inertia_tensor(shape, scale, mass);
-                Vector3 const offset{0.0f, 0.0f, 0.0f};
-                rCtxPhys.m_mass.emplace( ent, ACompMass{ offset, inertia, mass } );
-
-                //assign_dyn_recurse(assign_dyn_recurse, objectId, ent);
+                massEnts  .push_back(ent);
+                massShapes.push_back(shape);
+                massScales.push_back(rRecipe.m_transforms[i].scaling());
+                massMasses.push_back(mass);
             }
 
             if ( (mass != 0.0f) || (shape != EShape::None) )
             {
-                assign_collider_recurse(assign_collider_recurse, objectId, ent);
+                assign_collider_recurse(assign_collider_recurse, int(i), ent);
             }
         }
 
         std::advance(itPfEnts, 1);
     }
+
+    std::vector<Vector3> massInertias(massEnts.size());
+    collider_inertia_tensor_batch(
+            arrayView(massShapes.data(), massShapes.size()),
+            arrayView(massScales.data(), massScales.size()),
+            arrayView(massMasses.data(), massMasses.size()),
+            arrayView(massInertias.data(), massInertias.size()));
+
+    Vector3 const offset{0.0f, 0.0f, 0.0f};
+    for (std::size_t i = 0; i < massEnts.size(); ++i)
+    {
+        rCtxPhys.m_mass.emplace( massEnts[i], ACompMass{ offset, massInertias[i], massMasses[i] } );
+    }
 }
 
 
@@ -0,0 +1,468 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "serialize.h"
+
+#include "../util/logging.h"
+#include "../vehicles/ImporterData.h"
+#include "../vehicles/pack_io.h"
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace osp::active
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> sc_snapshotMagic{'O', 'S', 'P', 'S', 'C', 'N', '\0', '\1'};
+
+//-----------------------------------------------------------------------------
+
+// Scene registries have holes from deleted entities, unlike the dense builder ids vehicle
+// blueprints store, so each registry is saved as its capacity plus a presence bitmap.
+
+template<typename ID_T>
+void write_registry(PackWriter &rWriter, lgrn::IdRegistryStl<ID_T> const& reg)
+{
+    auto const capacity = std::uint32_t(reg.capacity());
+    rWriter.write(capacity);
+
+    BitVector_t present;
+    bitvector_resize(present, capacity);
+    for (std::size_t const idInt : reg.bitview().zeros())
+    {
+        present.set(idInt);
+    }
+    write_table(rWriter, present.ints().data(), present.ints().size());
+}
+
+template<typename ID_T>
+bool read_registry(PackReader &rReader, lgrn::IdRegistryStl<ID_T> &rReg)
+{
+    auto const capacity = rReader.read<std::uint32_t>();
+    if (rReader.fail)
+    {
+        return false;
+    }
+
+    BitVector_t present;
+    bitvector_resize(present, capacity);
+    if ( ! read_table(rReader, present.ints().data(), present.ints().size()))
+    {
+        return false;
+    }
+
+    // Ids are handed out in order on a fresh registry; create all of them, then remove the
+    // ones the snapshot doesn't contain
+    registry_create_dense(rReg, capacity);
+    for (std::uint32_t id = 0; id < capacity; ++id)
+    {
+        if ( ! present.test(id))
+        {
+            rReg.remove(ID_T(id));
+        }
+    }
+    return true;
+}
+
+void write_bitvector(PackWriter &rWriter, BitVector_t const& bits)
+{
+    write_table(rWriter, bits.ints().data(), bits.ints().size());
+}
+
+bool read_bitvector(PackReader &rReader, BitVector_t &rBits)
+{
+    return read_vector(rReader, rBits.ints());
+}
+
+template<typename T>
+void write_keyedvec(PackWriter &rWriter, std::vector<T> const& vec)
+{
+    write_table(rWriter, vec.data(), vec.size());
+}
+
+// entt storages are stored as parallel entity/component tables, skipping tombstones
+
+template<typename COMP_T>
+void write_storage(PackWriter &rWriter, Storage_t<ActiveEnt, COMP_T> const& storage,
+                   lgrn::IdRegistryStl<ActiveEnt> const& activeIds)
+{
+    std::vector<ActiveEnt> ents;
+    std::vector<COMP_T>    components;
+    for (std::size_t const entInt : activeIds.bitview().zeros())
+    {
+        auto const ent = ActiveEnt(std::uint32_t(entInt));
+        if (storage.contains(ent))
+        {
+            ents       .push_back(ent);
+            components .push_back(storage.get(ent));
+        }
+    }
+    rWriter.write(std::uint32_t(ents.size()));
+    write_table(rWriter, ents.data(),       ents.size());
+    write_table(rWriter, components.data(), components.size());
+}
+
+template<typename COMP_T>
+bool read_storage(PackReader &rReader, Storage_t<ActiveEnt, COMP_T> &rStorage)
+{
+    auto const count = rReader.read<std::uint32_t>();
+    if (rReader.fail)
+    {
+        return false;
+    }
+
+    std::vector<ActiveEnt> ents(count);
+    std::vector<COMP_T>    components(count);
+    if (   ! read_table(rReader, ents.data(), count)
+        || ! read_table(rReader, components.data(), count))
+    {
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        rStorage.emplace(ents[i], components[i]);
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void write_parts(PackWriter &rWriter, ACtxParts const& parts, Resources const& resources)
+{
+    write_registry(rWriter, parts.partIds);
+    write_registry(rWriter, parts.weldIds);
+
+    auto const partCapacity = std::uint32_t(parts.partIds.capacity());
+    auto const weldCapacity = std::uint32_t(parts.weldIds.capacity());
+
+    // Prefab references by name, re-resolved against loaded assets on restore; empty string
+    // for deleted part ids and parts without a prefab
+    for (std::uint32_t part = 0; part < partCapacity; ++part)
+    {
+        PrefabPair const &rPair = parts.partPrefabs[part];
+        if (parts.partIds.exists(part) && rPair.m_importer.has_value())
+        {
+            auto const &rPrefabData = resources.data_get<Prefabs const>(
+                    restypes::gc_importer, rPair.m_importer.value());
+            rWriter.write_string(rPrefabData.m_prefabNames[rPair.m_prefabId]);
+        }
+        else
+        {
+            rWriter.write_string("");
+        }
+    }
+
+    write_keyedvec(rWriter, parts.partTransformWeld);
+    write_keyedvec(rWriter, parts.partToWeld);
+    write_multimap(rWriter, parts.weldToParts,    weldCapacity);
+    write_multimap(rWriter, parts.partToMachines, partCapacity);
+    write_keyedvec(rWriter, parts.machineToPart);
+    write_keyedvec(rWriter, parts.partToActive);
+    write_keyedvec(rWriter, parts.activeToPart);
+    write_keyedvec(rWriter, parts.weldToActive);
+
+    // Machines
+    write_registry(rWriter, parts.machines.ids);
+    auto const machCapacity = std::uint32_t(parts.machines.ids.capacity());
+    write_keyedvec(rWriter, parts.machines.machTypes);
+    write_keyedvec(rWriter, parts.machines.machToLocal);
+    rWriter.write(std::uint32_t(parts.machines.perType.size()));
+    for (link::PerMachType const& rPerMachType : parts.machines.perType)
+    {
+        write_registry(rWriter, rPerMachType.localIds);
+        write_keyedvec(rWriter, rPerMachType.localToAny);
+    }
+
+    // Nodes
+    rWriter.write(std::uint32_t(parts.nodePerType.size()));
+    for (link::Nodes const& rNodes : parts.nodePerType)
+    {
+        write_registry(rWriter, rNodes.nodeIds);
+        write_multimap(rWriter, rNodes.nodeToMach, std::uint32_t(rNodes.nodeIds.capacity()));
+        write_multimap(rWriter, rNodes.machToNode, machCapacity);
+    }
+}
+
+bool read_parts(PackReader &rReader, ACtxParts &rParts,
+                PrefabIndex_t const& prefabs, Resources &rResources)
+{
+    if (   ! read_registry(rReader, rParts.partIds)
+        || ! read_registry(rReader, rParts.weldIds))
+    {
+        return false;
+    }
+
+    auto const partCapacity = std::uint32_t(rParts.partIds.capacity());
+    auto const weldCapacity = std::uint32_t(rParts.weldIds.capacity());
+
+    rParts.partPrefabs.resize(partCapacity);
+    for (std::uint32_t part = 0; part < partCapacity; ++part)
+    {
+        auto const name = rReader.read_string();
+        if (rReader.fail)
+        {
+            return false;
+        }
+        if (name.empty())
+        {
+            continue;
+        }
+
+        auto const foundIt = prefabs.find(name);
+        if (foundIt == prefabs.end())
+        {
+            return false; // Prefab no longer exists in loaded assets
+        }
+
+        auto &rPair = rParts.partPrefabs[part];
+        rPair.m_prefabId = foundIt->second.second;
+        rPair.m_importer = rResources.owner_create(restypes::gc_importer, foundIt->second.first);
+    }
+
+    if (   ! read_vector(rReader, rParts.partTransformWeld.base())
+        || ! read_vector(rReader, rParts.partToWeld.base())
+        || ! read_multimap(rReader, rParts.weldToParts,    weldCapacity)
+        || ! read_multimap(rReader, rParts.partToMachines, partCapacity)
+        || ! read_vector(rReader, rParts.machineToPart.base())
+        || ! read_vector(rReader, rParts.partToActive.base())
+        || ! read_vector(rReader, rParts.activeToPart.base())
+        || ! read_vector(rReader, rParts.weldToActive.base()))
+    {
+        return false;
+    }
+
+    // Machines
+    if ( ! read_registry(rReader, rParts.machines.ids))
+    {
+        return false;
+    }
+    auto const machCapacity = std::uint32_t(rParts.machines.ids.capacity());
+    if (   ! read_vector(rReader, rParts.machines.machTypes)
+        || ! read_vector(rReader, rParts.machines.machToLocal))
+    {
+        return false;
+    }
+
+    auto const machTypeCount = rReader.read<std::uint32_t>();
+    if (rReader.fail || machTypeCount != link::MachTypeReg_t::size())
+    {
+        return false; // Registered link types changed since this file was written
+    }
+    rParts.machines.perType.resize(machTypeCount);
+    for (link::PerMachType &rPerMachType : rParts.machines.perType)
+    {
+        if (   ! read_registry(rReader, rPerMachType.localIds)
+            || ! read_vector(rReader, rPerMachType.localToAny))
+        {
+            return false;
+        }
+    }
+
+    // Nodes
+    auto const nodeTypeCount = rReader.read<std::uint32_t>();
+    if (rReader.fail || nodeTypeCount != link::NodeTypeReg_t::size())
+    {
+        return false;
+    }
+    rParts.nodePerType.resize(nodeTypeCount);
+    for (link::Nodes &rNodes : rParts.nodePerType)
+    {
+        if (   ! read_registry(rReader, rNodes.nodeIds)
+            || ! read_multimap(rReader, rNodes.nodeToMach, std::uint32_t(rNodes.nodeIds.capacity()))
+            || ! read_multimap(rReader, rNodes.machToNode, machCapacity))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+
+bool write_scene_snapshot(
+        std::string_view const              filepath,
+        std::uint32_t const                 revision,
+        ACtxBasic const&                    basic,
+        ACtxPhysics const&                  physics,
+        ACtxParts const&                    parts,
+        link::SignalValues_t<float> const&  sigValFloat,
+        Resources const&                    resources)
+{
+    PackWriter writer;
+
+    writer.out.insert(writer.out.end(), sc_snapshotMagic.begin(), sc_snapshotMagic.end());
+    writer.write(revision);
+
+    // ACtxBasic; only the scene graph's core tree arrays are saved, child spans and dirty
+    // sets are derived
+    write_registry(writer, basic.m_activeIds);
+    write_keyedvec(writer, basic.m_scnGraph.m_treeToEnt);
+    write_keyedvec(writer, basic.m_scnGraph.m_treeDescendants);
+    write_keyedvec(writer, basic.m_scnGraph.m_entParent);
+    write_keyedvec(writer, basic.m_scnGraph.m_entToTreePos);
+    write_storage (writer, basic.m_transform, basic.m_activeIds);
+
+    // ACtxPhysics; m_setVelocity and m_colliderDirty are transient
+    write_keyedvec(writer, physics.m_shape);
+    write_bitvector(writer, physics.m_hasColliders);
+    write_storage (writer, physics.m_mass,        basic.m_activeIds);
+    write_storage (writer, physics.m_subtreeMass, basic.m_activeIds);
+    writer.write(physics.m_originTranslate);
+
+    // ACtxParts and link graph
+    write_parts(writer, parts, resources);
+
+    // Float signal values
+    write_table(writer, sigValFloat.data(), sigValFloat.size());
+
+    std::string const path{filepath};
+
+    bool writable;
+    {
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        writable = file.is_open();
+        if (writable)
+        {
+            file.write(reinterpret_cast<char const*>(writer.out.data()),
+                       std::streamsize(writer.out.size()));
+            writable = file.good();
+        }
+    }
+
+    if ( ! writable)
+    {
+        OSP_LOG_WARN("Could not write scene snapshot {}", filepath);
+        std::remove(path.c_str()); // Never leave a partial file behind
+    }
+
+    return writable;
+}
+
+bool read_scene_snapshot(
+        std::string_view const              filepath,
+        std::uint32_t const                 revision,
+        ACtxBasic&                          rBasic,
+        ACtxPhysics&                        rPhysics,
+        ACtxParts&                          rParts,
+        link::SignalValues_t<float>&        rSigValFloat,
+        Resources&                          rResources)
+{
+    PackFileView file;
+    if ( ! file.open(filepath))
+    {
+        return false;
+    }
+
+    auto const view = file.data();
+    if (   view.size() < sc_snapshotMagic.size()
+        || std::memcmp(view.data(), sc_snapshotMagic.data(), sc_snapshotMagic.size()) != 0)
+    {
+        return false;
+    }
+
+    PackReader reader{ .data = view, .pos = sc_snapshotMagic.size() };
+
+    auto const fileRevision = reader.read<std::uint32_t>();
+    if (reader.fail || fileRevision != revision)
+    {
+        return false;
+    }
+
+    PrefabIndex_t const prefabs = index_prefabs(rResources);
+
+    // A corrupt or stale file is rejected as a whole instead of handing the caller half a scene
+    auto const rollback = [&rParts, &rResources, filepath] ()
+    {
+        for (PrefabPair &rPair : rParts.partPrefabs)
+        {
+            rResources.owner_destroy_later(restypes::gc_importer, std::move(rPair.m_importer));
+        }
+        rResources.owner_destroy_flush();
+
+        OSP_LOG_WARN("Stale or malformed scene snapshot {}; ignoring", filepath);
+        return false;
+    };
+
+    // ACtxBasic
+    if (   ! read_registry(reader, rBasic.m_activeIds)
+        || ! read_vector(reader, rBasic.m_scnGraph.m_treeToEnt.base())
+        || ! read_vector(reader, rBasic.m_scnGraph.m_treeDescendants.base())
+        || ! read_vector(reader, rBasic.m_scnGraph.m_entParent.base())
+        || ! read_vector(reader, rBasic.m_scnGraph.m_entToTreePos.base())
+        || ! read_storage(reader, rBasic.m_transform))
+    {
+        return rollback();
+    }
+
+    // ACtxPhysics
+    if (   ! read_vector(reader, rPhysics.m_shape.base())
+        || ! read_bitvector(reader, rPhysics.m_hasColliders)
+        || ! read_storage(reader, rPhysics.m_mass)
+        || ! read_storage(reader, rPhysics.m_subtreeMass))
+    {
+        return rollback();
+    }
+    rPhysics.m_originTranslate = reader.read<Vector3>();
+
+    // ACtxParts and link graph
+    if (reader.fail || ! read_parts(reader, rParts, prefabs, rResources))
+    {
+        return rollback();
+    }
+
+    // Float signal values
+    if ( ! read_vector(reader, rSigValFloat))
+    {
+        return rollback();
+    }
+
+    // Derived state is rebuilt lazily through the existing stale/dirty paths: child spans on
+    // the next SysSceneGraph traversal, and empty transform dirty sets mean every transform
+    // changed to consumers
+    rBasic.m_scnGraph.m_childrenStale = true;
+
+    // Queue every collider so the physics engine recreates its bodies on the next update.
+    // partDirty/weldDirty stay empty; marking them would respawn prefabs over the restored
+    // entities rather than re-link them.
+    for (std::size_t const entInt : rPhysics.m_hasColliders.ones())
+    {
+        rPhysics.m_colliderDirty.push_back(ActiveEnt(std::uint32_t(entInt)));
+    }
+
+    return true;
+}
+
+} // namespace osp::active
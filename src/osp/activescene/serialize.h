@@ -0,0 +1,85 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Binary snapshots of an active scene's simulation state
+ *
+ * Persistent scene state (entity/part/machine id registries, component tables, link signal
+ * values) is written as raw sections straight out of the flat KeyedVec/BitVector_t/multimap
+ * layouts, so saving costs a memcpy per section and is cheap enough to autosave mid-session.
+ * Derived state is deliberately not captured: Newton bodies, GL handles, scene graph child
+ * spans, and dirty sets are all rebuilt lazily through their existing dirty/stale paths after
+ * a restore. Like pack files, snapshots are a native-endian per-machine format, and part
+ * prefab references are stored by name and re-resolved against currently loaded assets.
+ */
+
+#include "basic.h"
+#include "physics.h"
+#include "vehicles.h"
+
+#include "../core/resourcetypes.h"
+#include "../link/signal.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace osp::active
+{
+
+/**
+ * @brief Write a scene's persistent state as a binary snapshot file
+ *
+ * @param revision [in] Caller's save format revision; loads are rejected on mismatch
+ *
+ * @return false if the file couldn't be written; no partial file is left behind
+ */
+bool write_scene_snapshot(
+        std::string_view                    filepath,
+        std::uint32_t                       revision,
+        ACtxBasic const&                    basic,
+        ACtxPhysics const&                  physics,
+        ACtxParts const&                    parts,
+        link::SignalValues_t<float> const&  sigValFloat,
+        Resources const&                    resources);
+
+/**
+ * @brief Restore a snapshot written by write_scene_snapshot into freshly-constructed contexts
+ *
+ * Prefab references are re-resolved by name against rResources; a snapshot referring to
+ * prefabs that are no longer loaded is rejected. Corrupt, stale, or out-of-revision files are
+ * rejected as a whole, leaving the contexts untouched aside from default state.
+ */
+bool read_scene_snapshot(
+        std::string_view                    filepath,
+        std::uint32_t                       revision,
+        ACtxBasic&                          rBasic,
+        ACtxPhysics&                        rPhysics,
+        ACtxParts&                          rParts,
+        link::SignalValues_t<float>&        rSigValFloat,
+        Resources&                          rResources);
+
+} // namespace osp::active
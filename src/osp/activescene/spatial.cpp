@@ -0,0 +1,482 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "spatial.h"
+
+#include <Magnum/Math/Functions.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+using namespace osp;
+using namespace osp::active;
+
+using Node = ACtxSpatialTree::Node;
+
+constexpr int32_t gc_null = ACtxSpatialTree::smc_null;
+
+// Leaf boxes are fattened by this margin so jitter doesn't reshape the tree
+constexpr float gc_fatMargin = 0.5f;
+
+static SpatialAabb combine(SpatialAabb const& a, SpatialAabb const& b)
+{
+    return { Magnum::Math::min(a.m_min, b.m_min),
+             Magnum::Math::max(a.m_max, b.m_max) };
+}
+
+static float surface_area(SpatialAabb const& aabb)
+{
+    Vector3 const d = aabb.m_max - aabb.m_min;
+    return 2.0f * (d.x()*d.y() + d.y()*d.z() + d.z()*d.x());
+}
+
+static bool contains(SpatialAabb const& outer, SpatialAabb const& inner)
+{
+    return (outer.m_min <= inner.m_min).all()
+        && (inner.m_max <= outer.m_max).all();
+}
+
+static bool overlaps(SpatialAabb const& a, SpatialAabb const& b)
+{
+    return (a.m_min <= b.m_max).all()
+        && (b.m_min <= a.m_max).all();
+}
+
+static int32_t alloc_node(ACtxSpatialTree& rTree)
+{
+    if ( ! rTree.m_freeNodes.empty())
+    {
+        int32_t const index = rTree.m_freeNodes.back();
+        rTree.m_freeNodes.pop_back();
+        rTree.m_nodes[index] = {};
+        return index;
+    }
+
+    rTree.m_nodes.emplace_back();
+    return int32_t(rTree.m_nodes.size() - 1);
+}
+
+static void free_node(ACtxSpatialTree& rTree, int32_t index)
+{
+    rTree.m_freeNodes.push_back(index);
+}
+
+/**
+ * Rotate subtrees to keep the tree balanced. Returns the node replacing index
+ * as root of its subtree.
+ */
+static int32_t balance(ACtxSpatialTree& rTree, int32_t const iA)
+{
+    Node &rA = rTree.m_nodes[iA];
+
+    if ((rA.m_child0 == gc_null) || (rA.m_height < 2))
+    {
+        return iA;
+    }
+
+    int32_t const iB = rA.m_child0;
+    int32_t const iC = rA.m_child1;
+    Node &rB = rTree.m_nodes[iB];
+    Node &rC = rTree.m_nodes[iC];
+
+    int32_t const imbalance = rC.m_height - rB.m_height;
+
+    if (imbalance > 1)
+    {
+        // Rotate C up
+        int32_t const iF = rC.m_child0;
+        int32_t const iG = rC.m_child1;
+        Node &rF = rTree.m_nodes[iF];
+        Node &rG = rTree.m_nodes[iG];
+
+        rC.m_child0 = iA;
+        rC.m_parent = rA.m_parent;
+        rA.m_parent = iC;
+
+        if (rC.m_parent != gc_null)
+        {
+            Node &rParent = rTree.m_nodes[rC.m_parent];
+            ((rParent.m_child0 == iA) ? rParent.m_child0 : rParent.m_child1) = iC;
+        }
+        else
+        {
+            rTree.m_root = iC;
+        }
+
+        // Attach the shallower grandchild to A
+        bool const fDeeper = rF.m_height > rG.m_height;
+        int32_t const iKeep = fDeeper ? iF : iG;
+        int32_t const iGive = fDeeper ? iG : iF;
+        Node &rGive = rTree.m_nodes[iGive];
+
+        rC.m_child1 = iKeep;
+        rA.m_child1 = iGive;
+        rGive.m_parent = iA;
+
+        rA.m_aabb   = combine(rB.m_aabb, rGive.m_aabb);
+        rC.m_aabb   = combine(rA.m_aabb, rTree.m_nodes[iKeep].m_aabb);
+        rA.m_height = 1 + std::max(rB.m_height, rGive.m_height);
+        rC.m_height = 1 + std::max(rA.m_height, rTree.m_nodes[iKeep].m_height);
+
+        return iC;
+    }
+
+    if (imbalance < -1)
+    {
+        // Rotate B up; mirror of the case above
+        int32_t const iD = rB.m_child0;
+        int32_t const iE = rB.m_child1;
+        Node &rD = rTree.m_nodes[iD];
+        Node &rE = rTree.m_nodes[iE];
+
+        rB.m_child0 = iA;
+        rB.m_parent = rA.m_parent;
+        rA.m_parent = iB;
+
+        if (rB.m_parent != gc_null)
+        {
+            Node &rParent = rTree.m_nodes[rB.m_parent];
+            ((rParent.m_child0 == iA) ? rParent.m_child0 : rParent.m_child1) = iB;
+        }
+        else
+        {
+            rTree.m_root = iB;
+        }
+
+        bool const dDeeper = rD.m_height > rE.m_height;
+        int32_t const iKeep = dDeeper ? iD : iE;
+        int32_t const iGive = dDeeper ? iE : iD;
+        Node &rGive = rTree.m_nodes[iGive];
+
+        rB.m_child1 = iKeep;
+        rA.m_child0 = iGive;
+        rGive.m_parent = iA;
+
+        rA.m_aabb   = combine(rC.m_aabb, rGive.m_aabb);
+        rB.m_aabb   = combine(rA.m_aabb, rTree.m_nodes[iKeep].m_aabb);
+        rA.m_height = 1 + std::max(rC.m_height, rGive.m_height);
+        rB.m_height = 1 + std::max(rA.m_height, rTree.m_nodes[iKeep].m_height);
+
+        return iB;
+    }
+
+    return iA;
+}
+
+static void refit_ancestors(ACtxSpatialTree& rTree, int32_t index)
+{
+    while (index != gc_null)
+    {
+        index = balance(rTree, index);
+
+        Node &rNode = rTree.m_nodes[index];
+        Node const &child0 = rTree.m_nodes[rNode.m_child0];
+        Node const &child1 = rTree.m_nodes[rNode.m_child1];
+
+        rNode.m_aabb   = combine(child0.m_aabb, child1.m_aabb);
+        rNode.m_height = 1 + std::max(child0.m_height, child1.m_height);
+
+        index = rNode.m_parent;
+    }
+}
+
+static void insert_leaf(ACtxSpatialTree& rTree, int32_t const leaf)
+{
+    if (rTree.m_root == gc_null)
+    {
+        rTree.m_root = leaf;
+        rTree.m_nodes[leaf].m_parent = gc_null;
+        return;
+    }
+
+    // Descend towards the sibling costing the least surface area growth
+    SpatialAabb const leafAabb = rTree.m_nodes[leaf].m_aabb;
+    int32_t index = rTree.m_root;
+
+    while (rTree.m_nodes[index].m_child0 != gc_null)
+    {
+        int32_t const child0 = rTree.m_nodes[index].m_child0;
+        int32_t const child1 = rTree.m_nodes[index].m_child1;
+
+        auto const growth = [&rTree, &leafAabb] (int32_t child)
+        {
+            SpatialAabb const& aabb = rTree.m_nodes[child].m_aabb;
+            return surface_area(combine(aabb, leafAabb)) - surface_area(aabb);
+        };
+
+        index = (growth(child0) < growth(child1)) ? child0 : child1;
+    }
+
+    int32_t const sibling   = index;
+    int32_t const oldParent = rTree.m_nodes[sibling].m_parent;
+    int32_t const newParent = alloc_node(rTree);
+
+    Node &rNew = rTree.m_nodes[newParent];
+    rNew.m_aabb     = combine(leafAabb, rTree.m_nodes[sibling].m_aabb);
+    rNew.m_parent   = oldParent;
+    rNew.m_child0   = sibling;
+    rNew.m_child1   = leaf;
+    rNew.m_height   = rTree.m_nodes[sibling].m_height + 1;
+
+    rTree.m_nodes[sibling].m_parent = newParent;
+    rTree.m_nodes[leaf]   .m_parent = newParent;
+
+    if (oldParent != gc_null)
+    {
+        Node &rOld = rTree.m_nodes[oldParent];
+        ((rOld.m_child0 == sibling) ? rOld.m_child0 : rOld.m_child1) = newParent;
+    }
+    else
+    {
+        rTree.m_root = newParent;
+    }
+
+    refit_ancestors(rTree, newParent);
+}
+
+static void remove_leaf(ACtxSpatialTree& rTree, int32_t const leaf)
+{
+    if (rTree.m_root == leaf)
+    {
+        rTree.m_root = gc_null;
+        return;
+    }
+
+    int32_t const parent      = rTree.m_nodes[leaf].m_parent;
+    int32_t const grandparent = rTree.m_nodes[parent].m_parent;
+    Node const &rParent       = rTree.m_nodes[parent];
+    int32_t const sibling     = (rParent.m_child0 == leaf) ? rParent.m_child1
+                                                           : rParent.m_child0;
+
+    rTree.m_nodes[sibling].m_parent = grandparent;
+
+    if (grandparent != gc_null)
+    {
+        Node &rGrand = rTree.m_nodes[grandparent];
+        ((rGrand.m_child0 == parent) ? rGrand.m_child0 : rGrand.m_child1) = sibling;
+        free_node(rTree, parent);
+        refit_ancestors(rTree, grandparent);
+    }
+    else
+    {
+        rTree.m_root = sibling;
+        free_node(rTree, parent);
+    }
+}
+
+void SysSpatialTree::insert(ACtxSpatialTree& rTree, ActiveEnt const ent, SpatialAabb const& aabb)
+{
+    if (rTree.m_entToNode.size() <= std::size_t(ent))
+    {
+        rTree.m_entToNode.resize(std::size_t(ent) + 1, gc_null);
+    }
+
+    assert(rTree.m_entToNode[ent] == gc_null);
+
+    int32_t const leaf = alloc_node(rTree);
+    Node &rLeaf = rTree.m_nodes[leaf];
+    rLeaf.m_aabb = { aabb.m_min - Vector3{gc_fatMargin},
+                     aabb.m_max + Vector3{gc_fatMargin} };
+    rLeaf.m_ent  = ent;
+
+    rTree.m_entToNode[ent] = leaf;
+
+    insert_leaf(rTree, leaf);
+}
+
+void SysSpatialTree::move(ACtxSpatialTree& rTree, ActiveEnt const ent, SpatialAabb const& aabb)
+{
+    int32_t const leaf = rTree.m_entToNode[ent];
+
+    if (contains(rTree.m_nodes[leaf].m_aabb, aabb))
+    {
+        return; // Still inside the fat box
+    }
+
+    remove_leaf(rTree, leaf);
+
+    rTree.m_nodes[leaf].m_aabb = { aabb.m_min - Vector3{gc_fatMargin},
+                                   aabb.m_max + Vector3{gc_fatMargin} };
+
+    insert_leaf(rTree, leaf);
+}
+
+void SysSpatialTree::remove(ACtxSpatialTree& rTree, ActiveEnt const ent)
+{
+    int32_t const leaf = rTree.m_entToNode[ent];
+
+    remove_leaf(rTree, leaf);
+    free_node(rTree, leaf);
+    rTree.m_entToNode[ent] = gc_null;
+}
+
+void SysSpatialTree::update_from_scene(
+        ACtxSpatialTree&                rTree,
+        ACtxSceneGraph const&           rScnGraph,
+        ACtxWorldTf const&              rWorldTf,
+        ACtxPhysics const&              rCtxPhys)
+{
+    std::size_t const treeSize = rScnGraph.m_treeDescendants[0] + 1;
+
+    rTree.m_visitScratch.assign(rTree.m_entToNode.size(), uint8_t{0});
+
+    for (TreePos_t pos = 1; pos < treeSize; ++pos)
+    {
+        ActiveEnt const ent = rScnGraph.m_treeToEnt[pos];
+
+        if (   (rCtxPhys.m_shape.size() <= std::size_t(ent))
+            || (rCtxPhys.m_shape[ent] == EShape::None) )
+        {
+            continue;
+        }
+
+        // Exact box bound of the unit-sized shape under rotation and scale:
+        // half extents are absolute row sums of the upper-left 3x3
+        Matrix4 const&  tf       = rWorldTf.worldTf[pos];
+        Matrix3 const   rotScale = tf.rotationScaling();
+        Vector3 const   halfExt  = Magnum::Math::abs(rotScale[0])
+                                 + Magnum::Math::abs(rotScale[1])
+                                 + Magnum::Math::abs(rotScale[2]);
+        Vector3 const   center   = tf.translation();
+        SpatialAabb const aabb{center - halfExt, center + halfExt};
+
+        if (   (rTree.m_entToNode.size() > std::size_t(ent))
+            && (rTree.m_entToNode[ent] != gc_null) )
+        {
+            move(rTree, ent, aabb);
+        }
+        else
+        {
+            insert(rTree, ent, aabb);
+        }
+
+        if (rTree.m_visitScratch.size() <= std::size_t(ent))
+        {
+            rTree.m_visitScratch.resize(std::size_t(ent) + 1, uint8_t{0});
+        }
+        rTree.m_visitScratch[std::size_t(ent)] = 1;
+    }
+
+    // Drop entities that were deleted or lost their shape
+    for (std::size_t entInt = 0; entInt < rTree.m_visitScratch.size(); ++entInt)
+    {
+        if (   (rTree.m_entToNode[ActiveEnt(entInt)] != gc_null)
+            && (rTree.m_visitScratch[entInt] == 0) )
+        {
+            remove(rTree, ActiveEnt(entInt));
+        }
+    }
+}
+
+template<typename CHECK_T>
+static void query_tree(
+        ACtxSpatialTree const&  rTree,
+        std::vector<ActiveEnt>& rFound,
+        CHECK_T&&               check)
+{
+    if (rTree.m_root == gc_null)
+    {
+        return;
+    }
+
+    std::vector<int32_t> stack;
+    stack.reserve(64);
+    stack.push_back(rTree.m_root);
+
+    while ( ! stack.empty())
+    {
+        int32_t const index = stack.back();
+        stack.pop_back();
+
+        Node const &rNode = rTree.m_nodes[index];
+
+        if ( ! check(rNode.m_aabb))
+        {
+            continue;
+        }
+
+        if (rNode.m_child0 == gc_null)
+        {
+            rFound.push_back(rNode.m_ent);
+        }
+        else
+        {
+            stack.push_back(rNode.m_child0);
+            stack.push_back(rNode.m_child1);
+        }
+    }
+}
+
+void SysSpatialTree::query_aabb(
+        ACtxSpatialTree const&          rTree,
+        SpatialAabb const&              aabb,
+        std::vector<ActiveEnt>&         rFound)
+{
+    query_tree(rTree, rFound, [&aabb] (SpatialAabb const& nodeAabb)
+    {
+        return overlaps(nodeAabb, aabb);
+    });
+}
+
+void SysSpatialTree::query_sphere(
+        ACtxSpatialTree const&          rTree,
+        Vector3 const                   center,
+        float const                     radius,
+        std::vector<ActiveEnt>&         rFound)
+{
+    query_tree(rTree, rFound, [center, radiusSq = radius*radius] (SpatialAabb const& nodeAabb)
+    {
+        Vector3 const closest = Magnum::Math::clamp(center, nodeAabb.m_min, nodeAabb.m_max);
+        return (closest - center).dot() <= radiusSq;
+    });
+}
+
+void SysSpatialTree::query_ray(
+        ACtxSpatialTree const&          rTree,
+        Vector3 const                   origin,
+        Vector3 const                   dir,
+        float const                     maxDist,
+        std::vector<ActiveEnt>&         rFound)
+{
+    Vector3 const dirInv = Vector3{1.0f} / dir;
+
+    query_tree(rTree, rFound, [origin, dirInv, maxDist] (SpatialAabb const& nodeAabb)
+    {
+        // Slab test; relies on IEEE infinities for axis-parallel rays
+        float tNear = 0.0f;
+        float tFar  = maxDist;
+
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            float const tA = (nodeAabb.m_min[axis] - origin[axis]) * dirInv[axis];
+            float const tB = (nodeAabb.m_max[axis] - origin[axis]) * dirInv[axis];
+
+            tNear = std::max(tNear, std::min(tA, tB));
+            tFar  = std::min(tFar,  std::max(tA, tB));
+        }
+
+        return tNear <= tFar;
+    });
+}
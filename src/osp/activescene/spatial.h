@@ -0,0 +1,137 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "basic.h"
+#include "physics.h"
+#include "world_tf.h"
+
+#include <vector>
+
+namespace osp::active
+{
+
+/**
+ * @brief Axis-aligned bounding box in scene space
+ */
+struct SpatialAabb
+{
+    Vector3 m_min;
+    Vector3 m_max;
+};
+
+/**
+ * @brief Dynamic AABB tree spatially indexing collidable entities
+ *
+ * Leaf boxes are fattened by a margin so small movements don't reshape the
+ * tree. Maintained incrementally by SysSpatialTree::update_from_scene; the
+ * query functions then answer "entities within X" in O(log n) instead of
+ * scanning every entity.
+ */
+struct ACtxSpatialTree
+{
+    static constexpr int32_t smc_null = -1;
+
+    struct Node
+    {
+        SpatialAabb m_aabb;
+        int32_t     m_parent    {smc_null};
+        int32_t     m_child0    {smc_null}; ///< smc_null for leaves
+        int32_t     m_child1    {smc_null};
+        int32_t     m_height    {0};
+        ActiveEnt   m_ent       {lgrn::id_null<ActiveEnt>()}; ///< Only set for leaves
+    };
+
+    std::vector<Node>               m_nodes;
+    std::vector<int32_t>            m_freeNodes;
+    int32_t                         m_root{smc_null};
+
+    KeyedVec<ActiveEnt, int32_t>    m_entToNode;
+
+    std::vector<uint8_t>            m_visitScratch;
+};
+
+class SysSpatialTree
+{
+public:
+
+    /**
+     * @brief Insert an entity with a given scene-space box; fattened internally
+     */
+    static void insert(ACtxSpatialTree& rTree, ActiveEnt ent, SpatialAabb const& aabb);
+
+    /**
+     * @brief Move an entity's box, reinserting only once it leaves the fat box
+     */
+    static void move(ACtxSpatialTree& rTree, ActiveEnt ent, SpatialAabb const& aabb);
+
+    static void remove(ACtxSpatialTree& rTree, ActiveEnt ent);
+
+    /**
+     * @brief Incrementally sync the tree with all shaped entities in the scene
+     *
+     * Inserts new colliders, moves ones whose world transform changed, and
+     * drops entities that were deleted or lost their shape. World transforms
+     * are read from rWorldTf; call SysWorldTf::update beforehand.
+     */
+    static void update_from_scene(
+            ACtxSpatialTree&                rTree,
+            ACtxSceneGraph const&           rScnGraph,
+            ACtxWorldTf const&              rWorldTf,
+            ACtxPhysics const&              rCtxPhys);
+
+    /**
+     * @brief Find entities whose boxes overlap an AABB, appended to rFound
+     */
+    static void query_aabb(
+            ACtxSpatialTree const&          rTree,
+            SpatialAabb const&              aabb,
+            std::vector<ActiveEnt>&         rFound);
+
+    /**
+     * @brief Find entities whose boxes intersect a sphere, appended to rFound
+     */
+    static void query_sphere(
+            ACtxSpatialTree const&          rTree,
+            Vector3                         center,
+            float                           radius,
+            std::vector<ActiveEnt>&         rFound);
+
+    /**
+     * @brief Find entities whose boxes intersect a ray segment, appended to rFound
+     *
+     * @param dir       [in] Ray direction, not required to be normalized
+     * @param maxDist   [in] Segment length in units of dir
+     */
+    static void query_ray(
+            ACtxSpatialTree const&          rTree,
+            Vector3                         origin,
+            Vector3                         dir,
+            float                           maxDist,
+            std::vector<ActiveEnt>&         rFound);
+
+};
+
+}
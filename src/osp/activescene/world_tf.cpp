@@ -0,0 +1,100 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "world_tf.h"
+
+using namespace osp;
+using namespace osp::active;
+
+static bool dirty_test(ActiveEntSet_t const& dirtySet, ActiveEnt ent) noexcept
+{
+    // Entities past the end were added after the set was last resized; assume changed
+    return (std::size_t(ent.value) >= dirtySet.size()) || dirtySet.test(ent.value);
+}
+
+void SysWorldTf::update(
+        ACtxSceneGraph const&           rScnGraph,
+        ACompTransformStorage_t const&  rTf,
+        ACtxWorldTf&                    rWorldTf) noexcept
+{
+    TreePos_t const treeSize = 1 + rScnGraph.m_treeDescendants[0];
+
+    rWorldTf.worldTf     .resize(treeSize);
+    rWorldTf.entSnapshot .resize(treeSize, lgrn::id_null<ActiveEnt>());
+    rWorldTf.descSnapshot.resize(treeSize, 0);
+    rWorldTf.dirtyScratch.resize(treeSize, 0);
+
+    // Position 0 is the imaginary scene root
+    rWorldTf.worldTf[0]      = Matrix4{};
+    rWorldTf.dirtyScratch[0] = 0;
+
+    // Empty dirty sets mean the scene doesn't track transform changes; recompose everything
+    bool const trackDirty = ! rScnGraph.m_transformDirty.ints().empty();
+
+    for (TreePos_t pos = 1; pos < treeSize; )
+    {
+        ActiveEnt const ent         = rScnGraph.m_treeToEnt[pos];
+        uint32_t const  descendants = rScnGraph.m_treeDescendants[pos];
+
+        ActiveEnt const parent      = rScnGraph.m_entParent[ent];
+        TreePos_t const parentPos   = (parent == lgrn::id_null<ActiveEnt>())
+                                    ? 0
+                                    : rScnGraph.m_entToTreePos[parent];
+
+        // Row still describes the same subtree? Deletions shift positions without marking
+        // transforms dirty, so a mismatched entity or subtree size forces recomposition.
+        // Additions always mark, so matching snapshots mean the subtree rows are all valid.
+        bool const aligned      = (rWorldTf.entSnapshot[pos] == ent)
+                                && (rWorldTf.descSnapshot[pos] == descendants);
+
+        bool const selfDirty    = ( ! trackDirty)
+                                || ( ! aligned)
+                                || bool(rWorldTf.dirtyScratch[parentPos])
+                                || dirty_test(rScnGraph.m_transformDirty, ent);
+
+        if ( ! selfDirty && ! dirty_test(rScnGraph.m_subtreeTransformDirty, ent))
+        {
+            // Whole subtree is clean and its cached rows are valid
+            pos += 1 + descendants;
+            continue;
+        }
+
+        rWorldTf.dirtyScratch[pos] = selfDirty;
+
+        if (selfDirty)
+        {
+            Matrix4 const& parentTf = rWorldTf.worldTf[parentPos];
+
+            // Entities without an ACompTransform compose as identity
+            rWorldTf.worldTf[pos]       = rTf.contains(ent)
+                                        ? parentTf * rTf.get(ent).m_transform
+                                        : parentTf;
+            rWorldTf.entSnapshot[pos]   = ent;
+            rWorldTf.descSnapshot[pos]  = descendants;
+        }
+        // else: clean entity on the path to a dirty descendant, cached row kept
+
+        ++ pos;
+    }
+}
@@ -0,0 +1,87 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "basic.h"
+
+#include <vector>
+
+namespace osp::active
+{
+
+/**
+ * @brief Cached world-space transforms stored per scene graph tree position
+ *
+ * Structure-of-arrays mirror of ACtxSceneGraph's flat tree: worldTf[pos] is the
+ * composed world transform of m_treeToEnt[pos]. Parents precede children in
+ * tree order, so SysWorldTf::update refreshes the whole cache in one streaming
+ * sweep instead of consumers each re-walking the hierarchy.
+ *
+ * The snapshot arrays record which entity and subtree size each row was
+ * computed for, letting the sweep both skip clean subtrees and detect rows
+ * invalidated by tree compaction (see SysSceneGraph::do_delete), which shifts
+ * positions without marking transforms dirty.
+ */
+struct ACtxWorldTf
+{
+    osp::KeyedVec<TreePos_t, Matrix4>   worldTf;
+    osp::KeyedVec<TreePos_t, ActiveEnt> entSnapshot;
+    osp::KeyedVec<TreePos_t, uint32_t>  descSnapshot;
+
+    std::vector<uint8_t>                dirtyScratch; ///< Per-position dirty propagation flags
+};
+
+class SysWorldTf
+{
+public:
+
+    /**
+     * @brief Recompose cached world transforms in a single linear pass
+     *
+     * Subtrees containing no changed transforms (see
+     * SysSceneGraph::mark_transform_dirty) are skipped when their cached rows
+     * are still valid; scenes that never mark recompose everything. Entities
+     * without an ACompTransform compose as identity.
+     */
+    static void update(
+            ACtxSceneGraph const&           rScnGraph,
+            ACompTransformStorage_t const&  rTf,
+            ACtxWorldTf&                    rWorldTf) noexcept;
+
+    /**
+     * @return Cached world transform of an entity; valid until the scene graph
+     *         or any ancestor transform next changes
+     */
+    static Matrix4 const& world_transform(
+            ACtxSceneGraph const&           rScnGraph,
+            ACtxWorldTf const&              rWorldTf,
+            ActiveEnt                       ent) noexcept
+    {
+        return rWorldTf.worldTf[rScnGraph.m_entToTreePos[ent]];
+    }
+
+}; // class SysWorldTf
+
+} // namespace osp::active
@@ -24,12 +24,18 @@
  */
 #include "Resources.h"
 
+#include <mutex>
+#include <shared_mutex>
+
 using namespace osp;
 
 ResId Resources::create(ResTypeId const typeId, PkgId const pkgId, SharedString name)
 {
-    // Create ResId associated to specified ResTypeId
+    // Create ResId associated to specified ResTypeId. Per-package state below is keyed by
+    // (package, type), so holding the type lock covers it too.
     PerResType &rPerResType = get_type(typeId);
+    std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
     ResId const newResId = rPerResType.m_resIds.create();
 
     // Resize ref counts
@@ -38,6 +44,7 @@ ResId Resources::create(ResTypeId const typeId, PkgId const pkgId, SharedString
     // Associate it with the package
     assert(m_pkgData.size() > std::size_t(pkgId));
     PerPkg &rPkg = m_pkgData[std::size_t(pkgId)];
+    assert( ! rPkg.m_sealed); // Sealed packages are immutable; create into an overlay package
     assert(rPkg.m_resTypeOwn.size() > std::size_t(typeId));
     PerPkgResType &rPkgType = rPkg.m_resTypeOwn[std::size_t(typeId)];
     rPkgType.m_owned.resize(rPerResType.m_resIds.capacity());
@@ -51,9 +58,60 @@ ResId Resources::create(ResTypeId const typeId, PkgId const pkgId, SharedString
     rPerResType.m_resNames.resize(rPerResType.m_resIds.capacity());
     rPerResType.m_resNames[std::size_t(value)] = key;
 
+    // New resources start with no data; assign explicitly too, in case the id was reused
+    rPerResType.m_resLoadState.resize(rPerResType.m_resIds.capacity(), EResLoadState::Declared);
+    rPerResType.m_resLoadState[std::size_t(newResId)] = EResLoadState::Declared;
+
     return newResId;
 }
 
+EResLoadState Resources::load_state(ResTypeId const typeId, ResId const resId) const noexcept
+{
+    PerResType const &rPerResType = get_type(typeId);
+
+    // Sealed packages are immutable and fully loaded; skip the type lock like data reads do
+    if (rPerResType.sealed(resId))
+    {
+        return EResLoadState::Resident;
+    }
+
+    std::shared_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+    assert(rPerResType.m_resLoadState.size() > std::size_t(resId));
+    return rPerResType.m_resLoadState[std::size_t(resId)];
+}
+
+void Resources::load_state_set(ResTypeId const typeId, ResId const resId, EResLoadState const state) noexcept
+{
+    PerResType &rPerResType = get_type(typeId);
+    std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+    assert(rPerResType.m_resIds.exists(resId));
+    assert( ! rPerResType.sealed(resId));
+
+    EResLoadState &rState = rPerResType.m_resLoadState[std::size_t(resId)];
+    if (state <= rState)
+    {
+        return; // States only move forward; repeated publishes are harmless
+    }
+    rState = state;
+
+    if (state == EResLoadState::Resident)
+    {
+        rPerResType.m_resCompleted.push_back(resId);
+    }
+}
+
+void Resources::load_completions_take(ResTypeId const typeId, std::vector<ResId> &rOut) noexcept
+{
+    PerResType &rPerResType = get_type(typeId);
+    std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+    rOut.insert(rOut.end(), rPerResType.m_resCompleted.begin(),
+                            rPerResType.m_resCompleted.end());
+    rPerResType.m_resCompleted.clear();
+}
+
 ResId Resources::find(ResTypeId const typeId, PkgId const pkgId, std::string_view const name) const noexcept
 {
     PerResType const &rPerResType = get_type(typeId);
@@ -61,6 +119,13 @@ ResId Resources::find(ResTypeId const typeId, PkgId const pkgId, std::string_vie
     assert(m_pkgData.size() > std::size_t(pkgId));
     PerPkg const &rPkg = m_pkgData[std::size_t(pkgId)];
     assert(rPkg.m_resTypeOwn.size() > std::size_t(typeId));
+
+    // A sealed package's name maps never change; lookups in it skip the type lock
+    std::shared_lock<std::shared_mutex> lock{*rPerResType.m_mtx, std::defer_lock};
+    if ( ! rPkg.m_sealed)
+    {
+        lock.lock();
+    }
     PerPkgResType const &rPkgType = rPkg.m_resTypeOwn[std::size_t(typeId)];
 
     // TODO: The call to SharedString::create_reference() shouldn't be necessary
@@ -73,9 +138,35 @@ ResId Resources::find(ResTypeId const typeId, PkgId const pkgId, std::string_vie
     return lgrn::id_null<ResId>(); // not found
 }
 
+ResId Resources::find(ResTypeId const typeId, PkgId const pkgId, ResName const& name) const noexcept
+{
+    PerResType const &rPerResType = get_type(typeId);
+
+    assert(m_pkgData.size() > std::size_t(pkgId));
+    PerPkg const &rPkg = m_pkgData[std::size_t(pkgId)];
+    assert(rPkg.m_resTypeOwn.size() > std::size_t(typeId));
+
+    // A sealed package's name maps never change; lookups in it skip the type lock
+    std::shared_lock<std::shared_mutex> lock{*rPerResType.m_mtx, std::defer_lock};
+    if ( ! rPkg.m_sealed)
+    {
+        lock.lock();
+    }
+    PerPkgResType const &rPkgType = rPkg.m_resTypeOwn[std::size_t(typeId)];
+
+    // Heterogeneous lookup; ResNameHash returns the hash precomputed at intern time
+    if(auto const& findIt = rPkgType.m_nameToResId.find(name);
+       findIt != rPkgType.m_nameToResId.end())
+    {
+        return findIt->second;
+    }
+    return lgrn::id_null<ResId>(); // not found
+}
+
 SharedString const& Resources::name(ResTypeId const typeId, ResId const resId) const noexcept
 {
     PerResType const &rPerResType = get_type(typeId);
+    std::shared_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
 
     return rPerResType.m_resNames[std::size_t(resId)];
 }
@@ -88,6 +179,8 @@ lgrn::IdRegistry<ResId> const& Resources::ids(ResTypeId const typeId) const noex
 ResIdOwner_t Resources::owner_create(ResTypeId const typeId, ResId const resId) noexcept
 {
     PerResType &rPerResType = get_type(typeId);
+    std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
     rPerResType.m_resRefs[std::size_t(resId)] ++;
     ResIdOwner_t owner;
     owner.m_id = resId;
@@ -101,11 +194,75 @@ void Resources::owner_destroy(ResTypeId const typeId, ResIdOwner_t&& rOwner) noe
         return;
     }
     PerResType &rPerResType = get_type(typeId);
+    std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
     int &rCount = rPerResType.m_resRefs[std::size_t(rOwner.m_id)];
     -- rCount;
     rOwner.m_id = ResIdOwner_t{};
 }
 
+void Resources::owner_destroy_n(ResTypeId const typeId, ArrayView<ResIdOwner_t> const owners) noexcept
+{
+    PerResType &rPerResType = get_type(typeId);
+    std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+    // Reuse the deferred queue as scratch for sorting
+    std::vector<ResId> &rQueue = rPerResType.m_destroyQueue;
+    std::size_t const deferred = rQueue.size();
+
+    rQueue.reserve(deferred + owners.size());
+    for (ResIdOwner_t &rOwner : owners)
+    {
+        if (rOwner.has_value())
+        {
+            rQueue.push_back(rOwner.m_id);
+            rOwner.m_id = ResIdOwner_t{};
+        }
+    }
+
+    std::sort(rQueue.begin() + deferred, rQueue.end());
+    for (std::size_t i = deferred; i < rQueue.size(); ++i)
+    {
+        -- rPerResType.m_resRefs[std::size_t(rQueue[i])];
+    }
+    rQueue.resize(deferred); // keep owners queued by owner_destroy_later intact
+}
+
+void Resources::owner_destroy_later(ResTypeId const typeId, ResIdOwner_t&& rOwner) noexcept
+{
+    if (!rOwner.has_value())
+    {
+        return;
+    }
+    PerResType &rPerResType = get_type(typeId);
+    std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+    rPerResType.m_destroyQueue.push_back(rOwner.m_id);
+    rOwner.m_id = ResIdOwner_t{};
+}
+
+void Resources::owner_destroy_flush() noexcept
+{
+    for (PerResType &rPerResType : m_perResType)
+    {
+        std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+        std::vector<ResId> &rQueue = rPerResType.m_destroyQueue;
+        if (rQueue.empty())
+        {
+            continue;
+        }
+
+        // Decrement in ascending ResId order; one cache-friendly pass over m_resRefs
+        std::sort(rQueue.begin(), rQueue.end());
+        for (ResId const id : rQueue)
+        {
+            -- rPerResType.m_resRefs[std::size_t(id)];
+        }
+        rQueue.clear();
+    }
+}
+
 PkgId Resources::pkg_create()
 {
     PkgId const newPkgId = m_pkgIds.create();
@@ -113,3 +270,52 @@ PkgId Resources::pkg_create()
     m_pkgData[std::size_t(newPkgId)].m_resTypeOwn.resize(m_perResType.size());
     return newPkgId;
 }
+
+void Resources::pkg_seal(PkgId const pkgId)
+{
+    assert(m_pkgData.size() > std::size_t(pkgId));
+    PerPkg &rPkg = m_pkgData[std::size_t(pkgId)];
+
+    if (rPkg.m_sealed)
+    {
+        return;
+    }
+    rPkg.m_sealed = true;
+
+    for (std::size_t typeInt = 0; typeInt < rPkg.m_resTypeOwn.size(); ++typeInt)
+    {
+        PerPkgResType const &rPkgType = rPkg.m_resTypeOwn[typeInt];
+        if (rPkgType.m_owned.count() == 0)
+        {
+            continue;
+        }
+
+        PerResType &rPerResType = m_perResType[typeInt];
+        std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+        std::size_t const capacity = rPerResType.m_resIds.capacity();
+        rPerResType.m_resSealed.resize(capacity);
+        rPerResType.m_resLoadState.resize(capacity, EResLoadState::Declared);
+
+        // Pin each owned resource with a reference; sealed ids are never freed or reused,
+        // which keeps the frozen container slots below valid for the registry's lifetime
+        for (std::size_t resInt = 0; resInt < rPkgType.m_owned.size(); ++resInt)
+        {
+            if (rPkgType.m_owned.test(resInt))
+            {
+                rPerResType.m_resSealed.set(resInt);
+                ++ rPerResType.m_resRefs[resInt];
+
+                // Sealing asserts the package is fully loaded; no completion events here,
+                // sealing is setup-time and precedes any consumer that would drain them
+                rPerResType.m_resLoadState[resInt] = EResLoadState::Resident;
+            }
+        }
+
+        // Freeze slot pointers of every registered datatype for lock-free reads
+        for (std::size_t dataInt = 0; dataInt < rPerResType.m_resData.size(); ++dataInt)
+        {
+            rPerResType.m_resDataFreeze[dataInt](rPerResType.m_resData[dataInt], capacity);
+        }
+    }
+}
@@ -24,6 +24,7 @@
  */
 #pragma once
 
+#include "array_view.h"
 #include "shared_string.h"
 #include "resourcetypes.h"
 
@@ -34,13 +35,155 @@
 #include <entt/core/any.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string_view>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
 namespace osp
 {
 
+/**
+ * @brief A resource name interned as a SharedString, with its hash precomputed once
+ *
+ * Build one with ResName::intern() and reuse it across repeated Resources::find calls; lookups
+ * then compare the stored hash and buffer pointer instead of re-hashing the string every call.
+ */
+struct ResName
+{
+    static ResName intern(SharedString name) noexcept
+    {
+        std::size_t const hash = std::hash<SharedString>{}(name);
+        return { std::move(name), hash };
+    }
+
+    SharedString m_name;
+    std::size_t  m_hash;
+};
+
+struct ResNameHash
+{
+    using is_transparent = void;
+
+    std::size_t operator() (SharedString const& str) const noexcept
+    {
+        return std::hash<SharedString>{}(str);
+    }
+
+    std::size_t operator() (ResName const& name) const noexcept
+    {
+        return name.m_hash; // precomputed at intern time
+    }
+};
+
+struct ResNameEqual
+{
+    using is_transparent = void;
+
+    static bool equal(std::string_view const lhs, std::string_view const rhs) noexcept
+    {
+        // Interned copies share the same refcounted buffer, making this a pointer compare
+        return (lhs.data() == rhs.data() && lhs.size() == rhs.size()) || lhs == rhs;
+    }
+
+    bool operator() (SharedString const& lhs, SharedString const& rhs) const noexcept
+    {
+        return equal(lhs, rhs);
+    }
+
+    bool operator() (ResName const& lhs, SharedString const& rhs) const noexcept
+    {
+        return equal(lhs.m_name, rhs);
+    }
+
+    bool operator() (SharedString const& lhs, ResName const& rhs) const noexcept
+    {
+        return equal(lhs, rhs.m_name);
+    }
+};
+
+/**
+ * @brief Load progress of a resource published asynchronously
+ *
+ * A ResId is usable as soon as it's created: it can be named, found, owned, and assigned to
+ * scene objects before any of its data exists. This state tracks how far an importer or
+ * streamer has gotten with the actual data, so consumers can show placeholders for Declared
+ * resources and swap in the real thing on completion. States only move forward.
+ */
+enum class EResLoadState : std::uint8_t
+{
+    Declared = 0,   ///< Id and name exist; no data yet. Consumers substitute placeholders
+    Loading  = 1,   ///< An importer or streamer is currently producing this resource's data
+    Resident = 2    ///< All data added; reads see the finished resource
+};
+
+/**
+ * @brief Dense views of a resource type's data containers, resolved and locked once
+ *
+ * data_get re-resolves the datatype's container (a linear scan of registered types plus an
+ * any_cast) and takes the type's shared lock on every call, which adds up in loops touching
+ * hundreds of resources. Resources::data_view does that work once and hands back slot arrays
+ * indexable by ResId, so per-id access is a bounds check and a load.
+ *
+ * Holds the type's shared lock until destroyed: keep it scoped to the loop, and don't call
+ * anything taking the same type's unique lock (create, data_add, owner destruction) or create
+ * a second view of the same type while one is alive.
+ */
+template <typename ... TYPES_T>
+class ResDataView
+{
+    template <typename T>
+    using Slots_t = ArrayView< std::unique_ptr< std::remove_const_t<T> > const >;
+
+public:
+
+    /**
+     * @brief Pointer to resId's data, nullptr if not added. T must be one of TYPES_T.
+     */
+    template <typename T>
+    [[nodiscard]] T* get(ResId const resId) const noexcept
+    {
+        Slots_t<T> const slots = std::get< Slots_t<T> >(m_slots);
+        return (std::size_t(resId) < slots.size()) ? slots[std::size_t(resId)].get() : nullptr;
+    }
+
+    /**
+     * @brief Single-datatype convenience for ResDataView<T>
+     */
+    [[nodiscard]] auto operator[](ResId const resId) const noexcept
+            requires (sizeof...(TYPES_T) == 1)
+    {
+        return get<TYPES_T...>(resId);
+    }
+
+private:
+
+    friend class Resources;
+
+    ResDataView(std::shared_lock<std::shared_mutex> lock, Slots_t<TYPES_T> const ... slots) noexcept
+     : m_lock{std::move(lock)}
+     , m_slots{slots ...}
+    { }
+
+    std::shared_lock<std::shared_mutex> m_lock;
+    std::tuple< Slots_t<TYPES_T> ... >  m_slots;
+};
+
+/**
+ * Thread safety: the registry is sharded by resource type. Each ResTypeId has its own lock, so
+ * importer threads working on different types (meshes, images, prefabs...) never contend, and
+ * create/find/data_add/data_get on the same type are safe to call concurrently. resize_types,
+ * pkg_create, pkg_seal, and data_register are setup-time only and must not race with anything.
+ *
+ * Packages sealed with pkg_seal after loading become immutable; find and const data reads on
+ * their resources skip the type lock entirely, so any number of concurrently-updating scenes
+ * can share one sealed base package. Scenes needing mutable resources create them in their own
+ * unsealed overlay package and fall back to the sealed base by name.
+ */
 class Resources
 {
     using res_data_family_t = entt::family<struct ResourceType>;
@@ -55,17 +198,44 @@ class Resources
 
         // Pointed to by PerPkgResType::m_nameToResId
         std::vector<SharedString>       m_resNames;
+
+        // ResIds released by owner_destroy_later, waiting for owner_destroy_flush.
+        // Also reused as scratch by owner_destroy_n.
+        std::vector<ResId>              m_destroyQueue;
+
+        // Load state per ResId, parallel to m_resIds. Declared at create; advanced through
+        // load_state_set as importers publish data. Sealed resources are implicitly Resident
+        std::vector<EResLoadState>      m_resLoadState;
+
+        // ResIds that reached Resident since the last load_completions_take
+        std::vector<ResId>              m_resCompleted;
+
+        // Set by pkg_seal for resources of sealed packages; only grows at seal time
+        lgrn::HierarchicalBitset<uint64_t> m_resSealed;
+
+        // Type-erased ResourceContainer::freeze per entry of m_resData, captured by
+        // data_register; pkg_seal calls these without knowing the stored types
+        std::vector<void(*)(entt::any&, std::size_t)> m_resDataFreeze;
+
+        // Guards everything above; unique_ptr keeps PerResType movable for resize_types
+        std::unique_ptr<std::shared_mutex> m_mtx { std::make_unique<std::shared_mutex>() };
+
+        bool sealed(ResId const resId) const noexcept
+        {
+            return (std::size_t(resId) < m_resSealed.size()) && m_resSealed.test(std::size_t(resId));
+        }
     };
 
     struct PerPkgResType
     {
         lgrn::HierarchicalBitset<uint64_t> m_owned;
-        std::unordered_map< SharedString, ResId, std::hash<SharedString>, std::equal_to<> > m_nameToResId;
+        std::unordered_map< SharedString, ResId, ResNameHash, ResNameEqual > m_nameToResId;
     };
 
     struct PerPkg
     {
         std::vector<PerPkgResType> m_resTypeOwn;
+        bool m_sealed { false };
     };
 
 public:
@@ -93,6 +263,13 @@ public:
 
     [[nodiscard]] ResId find(ResTypeId typeId, PkgId pkgId, std::string_view name) const noexcept;
 
+    /**
+     * @brief Name lookup with the hash precomputed by ResName::intern
+     *
+     * Use for names looked up repeatedly, eg. per prefab instantiation during scene load.
+     */
+    [[nodiscard]] ResId find(ResTypeId typeId, PkgId pkgId, ResName const& name) const noexcept;
+
     /**
      * @brief Get name of Resource Id
      *
@@ -109,6 +286,49 @@ public:
 
     void owner_destroy(ResTypeId typeId, ResIdOwner_t&& rOwner) noexcept;
 
+    /**
+     * @brief Release many owners in one pass, under a single lock
+     *
+     * For teardown paths that hold owners contiguously. Owners are left empty.
+     * Refcounts are decremented in ascending ResId order for cache locality.
+     */
+    void owner_destroy_n(ResTypeId typeId, ArrayView<ResIdOwner_t> owners) noexcept;
+
+    /**
+     * @brief Queue a released owner; its refcount stays untouched until owner_destroy_flush
+     *
+     * For teardown paths whose owners are scattered through maps or structs and can't form
+     * an array for owner_destroy_n.
+     */
+    void owner_destroy_later(ResTypeId typeId, ResIdOwner_t&& rOwner) noexcept;
+
+    /**
+     * @brief Process all owners queued by owner_destroy_later, one sorted pass per type
+     */
+    void owner_destroy_flush() noexcept;
+
+    /**
+     * @brief Load state of a resource; resources of sealed packages are always Resident
+     */
+    [[nodiscard]] EResLoadState load_state(ResTypeId typeId, ResId resId) const noexcept;
+
+    /**
+     * @brief Advance a resource's load state; states never move backwards
+     *
+     * Reaching Resident queues a completion event for load_completions_take. Importers call
+     * this once every data_add for the resource is done; anything already holding the id can
+     * then swap its placeholder for the finished data.
+     */
+    void load_state_set(ResTypeId typeId, ResId resId, EResLoadState state) noexcept;
+
+    /**
+     * @brief Drain resources that reached Resident since the last call, appending to rOut
+     *
+     * The completion queue is per-type and handed over whole; call once per frame from
+     * whichever system reacts to finished loads, eg. recompiling GL placeholders.
+     */
+    void load_completions_take(ResTypeId typeId, std::vector<ResId> &rOut) noexcept;
+
     /**
      * @brief Register a datatype to a resource Id
      *
@@ -170,6 +390,22 @@ public:
     template<typename T>
     [[nodiscard]] T const* data_try_get(ResTypeId typeId, ResId resId) const;
 
+    /**
+     * @brief Batch accessor for loops: resolve containers and lock once, index by ResId after
+     *
+     * List every datatype of typeId the loop reads, so they all share one lock. See
+     * ResDataView for lifetime rules. Non-const datatypes get the same locking semantics as non-const
+     * data_try_get: the type's structure is read-locked, element mutation is unsynchronized.
+     */
+    template<typename ... TYPES_T>
+    [[nodiscard]] ResDataView<TYPES_T...> data_view(ResTypeId typeId);
+
+    /**
+     * @copydoc Resources::data_view(typeId)
+     */
+    template<typename ... TYPES_T>
+    [[nodiscard]] ResDataView<TYPES_T...> data_view(ResTypeId typeId) const;
+
     /**
      * @brief Create a new package
      *
@@ -181,6 +417,25 @@ public:
      */
      [[nodiscard]] PkgId pkg_create();
 
+    /**
+     * @brief Seal a package after loading, making its resources lock-free shared-readable
+     *
+     * Sealed resources may no longer be created, have data added, or be deleted; each gets a
+     * pinned reference so its id is never reused. find and const data reads then skip the type
+     * lock, letting concurrently-updating scenes share the package without contention or
+     * duplicating its data. Per-scene mutations belong in a separate unsealed overlay package,
+     * falling back to the sealed base by name.
+     *
+     * Setup-time only, like resize_types; must not race with scene reads.
+     */
+    void pkg_seal(PkgId pkgId);
+
+    [[nodiscard]] bool pkg_sealed(PkgId const pkgId) const noexcept
+    {
+        assert(m_pkgData.size() > std::size_t(pkgId));
+        return m_pkgData[std::size_t(pkgId)].m_sealed;
+    }
+
 private:
 
     PerResType const& get_type(ResTypeId typeId) const
@@ -219,16 +474,24 @@ void Resources::data_register(ResTypeId typeId)
 
     rTypes.push_back(type);
     rPerResType.m_resData.emplace_back(res_container_t<T>{});
+
+    // Parallel to m_resData; lets pkg_seal freeze the container without knowing T
+    rPerResType.m_resDataFreeze.push_back([] (entt::any& rAny, std::size_t const count)
+    {
+        entt::any_cast<res_container_t<T>&>(rAny).freeze(count);
+    });
 }
 
 template<typename T, typename ... ARGS_T>
 T& Resources::data_add(ResTypeId typeId, ResId resId, ARGS_T&& ... args)
 {
     PerResType &rPerResType = get_type(typeId);
+    std::unique_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
 
-    // Ensure resource ID exists
+    // Ensure resource ID exists and is not part of a sealed package
     assert(rPerResType.m_resIds.capacity() > std::size_t(resId));
     assert(rPerResType.m_resIds.exists(resId));
+    assert( ! rPerResType.sealed(resId));
 
     res_container_t<T> &rContainer = get_container<T>(rPerResType, typeId);
 
@@ -261,6 +524,15 @@ T const* Resources::data_try_get(ResTypeId typeId, ResId resId) const
 
     PerResType const &rPerResType = get_type(typeId);
 
+    // Resources of sealed packages are immutable and their slot pointers frozen; read them
+    // without touching the type lock, so shared-package reads from scenes never contend
+    if (rPerResType.sealed(resId))
+    {
+        return get_container<NonConst_t>(rPerResType, typeId).get_frozen(resId);
+    }
+
+    std::shared_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
     // Ensure resource ID exists
     assert(rPerResType.m_resIds.capacity() > std::size_t(typeId));
     assert(rPerResType.m_resIds.exists(resId));
@@ -275,6 +547,20 @@ T* Resources::data_try_get(ResTypeId typeId, ResId resId)
 {
     PerResType &rPerResType = get_type(typeId);
 
+    if constexpr (std::is_const_v<T>)
+    {
+        // Same lock-free path as the const overload; mutable access to sealed resources
+        // stays on the locked path and is only valid during setup and teardown
+        if (rPerResType.sealed(resId))
+        {
+            using NonConst_t = std::remove_const_t<T>;
+            return const_cast<const Resources*>(this)
+                    ->get_container<NonConst_t>(rPerResType, typeId).get_frozen(resId);
+        }
+    }
+
+    std::shared_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
     // Ensure resource ID exists
     assert(rPerResType.m_resIds.capacity() > std::size_t(resId));
     assert(rPerResType.m_resIds.exists(resId));
@@ -296,6 +582,28 @@ T* Resources::data_try_get(ResTypeId typeId, ResId resId)
     }
 }
 
+template<typename ... TYPES_T>
+ResDataView<TYPES_T...> Resources::data_view(ResTypeId typeId)
+{
+    PerResType const &rPerResType = get_type(typeId);
+    std::shared_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+    return { std::move(lock),
+             get_container< std::remove_const_t<TYPES_T> >(rPerResType, typeId).slots() ... };
+}
+
+template<typename ... TYPES_T>
+ResDataView<TYPES_T...> Resources::data_view(ResTypeId typeId) const
+{
+    static_assert((std::is_const_v<TYPES_T> && ...), "Non-const data requested from const Resources");
+
+    PerResType const &rPerResType = get_type(typeId);
+    std::shared_lock<std::shared_mutex> lock{*rPerResType.m_mtx};
+
+    return { std::move(lock),
+             get_container< std::remove_const_t<TYPES_T> >(rPerResType, typeId).slots() ... };
+}
+
 template <typename T>
 res_container_t<T>& Resources::get_container(PerResType &rPerResType, ResTypeId typeId)
 {
@@ -0,0 +1,159 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Over-aligned storage and views for SIMD kernels
+ *
+ * Plain std::vector and ArrayView only guarantee alignof(T), forcing SIMD loops to use
+ * unaligned loads. AlignedVec_t/KeyedVecAligned over-align their buffers, and
+ * ArrayViewAligned carries the guarantee through kernel signatures so hot loops can use
+ * aligned streaming loads/stores without re-checking pointers.
+ */
+
+#include "array_view.h"
+#include "keyed_vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace osp
+{
+
+/// Default over-alignment; covers 512-bit vector registers and cache lines
+inline constexpr std::size_t gc_simdAlign = 64;
+
+/**
+ * @brief Minimal std::allocator drop-in that over-aligns every allocation to ALIGN_T bytes
+ */
+template <typename T, std::size_t ALIGN_T = gc_simdAlign>
+struct AlignedAllocator
+{
+    static_assert((ALIGN_T & (ALIGN_T - 1)) == 0, "Alignment must be a power of two");
+    static_assert(ALIGN_T >= alignof(T));
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind { using other = AlignedAllocator<U, ALIGN_T>; };
+
+    AlignedAllocator() = default;
+
+    template <typename U>
+    constexpr AlignedAllocator(AlignedAllocator<U, ALIGN_T> const&) noexcept { }
+
+    [[nodiscard]] T* allocate(std::size_t const n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ALIGN_T}));
+    }
+
+    void deallocate(T* const p, std::size_t const n) noexcept
+    {
+        ::operator delete(p, n * sizeof(T), std::align_val_t{ALIGN_T});
+    }
+};
+
+template <typename T, typename U, std::size_t ALIGN_T>
+constexpr bool operator==(AlignedAllocator<T, ALIGN_T> const&,
+                          AlignedAllocator<U, ALIGN_T> const&) noexcept
+{
+    return true;
+}
+
+template <typename T, std::size_t ALIGN_T = gc_simdAlign>
+using AlignedVec_t = std::vector< T, AlignedAllocator<T, ALIGN_T> >;
+
+template <typename ID_T, typename DATA_T, std::size_t ALIGN_T = gc_simdAlign>
+using KeyedVecAligned = KeyedVec< ID_T, DATA_T, AlignedAllocator<DATA_T, ALIGN_T> >;
+
+/**
+ * @brief ArrayView whose data pointer is guaranteed ALIGN_T-byte aligned
+ *
+ * The guarantee is part of the type, so kernels taking an ArrayViewAligned parameter can
+ * assume alignment instead of asserting it per call; data() funnels through
+ * std::assume_aligned so the compiler emits aligned accesses. Converts implicitly to a plain
+ * ArrayView for non-SIMD callees. Note that only the start is aligned; slicing an arbitrary
+ * offset out of one re-enters unaligned territory.
+ */
+template <typename T, std::size_t ALIGN_T = gc_simdAlign>
+class ArrayViewAligned
+{
+public:
+
+    static constexpr std::size_t smc_align = ALIGN_T;
+
+    constexpr ArrayViewAligned() noexcept = default;
+
+    ArrayViewAligned(T* const pData, std::size_t const size) noexcept
+     : m_view{pData, size}
+    {
+        assert((reinterpret_cast<std::uintptr_t>(pData) % ALIGN_T) == 0);
+    }
+
+    /// const views of the same buffer share the guarantee
+    constexpr operator ArrayViewAligned<T const, ALIGN_T>() const noexcept
+    {
+        return {m_view.data(), m_view.size()};
+    }
+
+    constexpr operator ArrayView<T>() const noexcept { return m_view; }
+
+    T* data() const noexcept
+    {
+        return std::assume_aligned<ALIGN_T>(m_view.data());
+    }
+
+    constexpr std::size_t size() const noexcept { return m_view.size(); }
+    constexpr bool empty() const noexcept       { return m_view.isEmpty(); }
+
+    T* begin() const noexcept   { return data(); }
+    T* end() const noexcept     { return data() + m_view.size(); }
+
+    T& operator[](std::size_t const i) const noexcept { return data()[i]; }
+
+private:
+
+    ArrayView<T> m_view;
+};
+
+template <typename T, std::size_t ALIGN_T>
+ArrayViewAligned<T, ALIGN_T> aligned_view(
+        std::vector< T, AlignedAllocator<T, ALIGN_T> > &rVec) noexcept
+{
+    return {rVec.data(), rVec.size()};
+}
+
+template <typename T, std::size_t ALIGN_T>
+ArrayViewAligned<T const, ALIGN_T> aligned_view(
+        std::vector< T, AlignedAllocator<T, ALIGN_T> > const& vec) noexcept
+{
+    return {vec.data(), vec.size()};
+}
+
+} // namespace osp
@@ -0,0 +1,144 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2023 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace osp
+{
+
+/**
+ * @brief Bump allocator for temporaries that live within a single frame
+ *
+ * allocate() just advances an offset into one fixed buffer; reset() at the start of each frame
+ * reclaims everything at once. Intended to back per-frame scratch containers (via
+ * FrameArenaAllocator below) so they stop hitting the global heap every update. Nothing is
+ * individually freed, so never keep an allocation across reset().
+ *
+ * Requests that don't fit the buffer fall back to the heap and are freed on the next reset();
+ * correctness is kept, only the speedup is lost, so size the buffer from the overflow count.
+ */
+class FrameArena
+{
+public:
+
+    FrameArena() = default;
+
+    explicit FrameArena(std::size_t const capacity)
+     : m_buffer  { std::make_unique<std::byte[]>(capacity) }
+     , m_capacity{ capacity }
+    { }
+
+    void* allocate(std::size_t const bytes, std::size_t const align = alignof(std::max_align_t))
+    {
+        assert((align & (align - 1)) == 0); // power-of-two alignment only
+
+        std::size_t const aligned = (m_offset + align - 1) & ~(align - 1);
+
+        if (aligned + bytes <= m_capacity)
+        {
+            m_offset = aligned + bytes;
+            return m_buffer.get() + aligned;
+        }
+
+        // Arena full; heap fallback freed on next reset()
+        ++ m_overflowCount;
+        m_overflow.push_back(std::make_unique<std::byte[]>(bytes));
+        return m_overflow.back().get();
+    }
+
+    /// Reclaim all allocations at once. Everything handed out before this call is now invalid.
+    void reset() noexcept
+    {
+        m_offset = 0;
+        m_overflow.clear();
+    }
+
+    constexpr std::size_t capacity() const noexcept { return m_capacity; }
+    constexpr std::size_t used()     const noexcept { return m_offset;   }
+
+    /// Total heap fallbacks since construction; non-zero means the buffer is undersized
+    constexpr std::size_t overflow_count() const noexcept { return m_overflowCount; }
+
+private:
+
+    std::unique_ptr<std::byte[]>                m_buffer;
+    std::size_t                                 m_capacity      {0};
+    std::size_t                                 m_offset        {0};
+
+    std::vector< std::unique_ptr<std::byte[]> > m_overflow;
+    std::size_t                                 m_overflowCount {0};
+
+}; // class FrameArena
+
+/**
+ * @brief STL-compatible allocator adapter for FrameArena
+ *
+ * deallocate() is a no-op; memory is reclaimed wholesale by FrameArena::reset(). The arena must
+ * outlive every container using it.
+ */
+template <typename T>
+class FrameArenaAllocator
+{
+    template <typename U>
+    friend class FrameArenaAllocator;
+
+public:
+
+    using value_type = T;
+
+    FrameArenaAllocator(FrameArena& rArena) noexcept
+     : m_pArena{ &rArena }
+    { }
+
+    template <typename U>
+    FrameArenaAllocator(FrameArenaAllocator<U> const& other) noexcept
+     : m_pArena{ other.m_pArena }
+    { }
+
+    T* allocate(std::size_t const n)
+    {
+        return static_cast<T*>(m_pArena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept { }
+
+    bool operator==(FrameArenaAllocator const& rhs) const noexcept { return m_pArena == rhs.m_pArena; }
+    bool operator!=(FrameArenaAllocator const& rhs) const noexcept { return m_pArena != rhs.m_pArena; }
+
+private:
+
+    FrameArena *m_pArena;
+
+}; // class FrameArenaAllocator
+
+/// Per-frame scratch vector; construct with the frame's FrameArena and never keep across frames
+template <typename T>
+using FrameVec_t = std::vector< T, FrameArenaAllocator<T> >;
+
+} // namespace osp
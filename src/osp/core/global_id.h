@@ -26,34 +26,43 @@
 
 #include <longeron/utility/enum_traits.hpp> // for lgrn::underlying_int_type_t
 
+#include <atomic>      // for std::atomic
 #include <type_traits> // for std::is_integral_v
 
 namespace osp
 {
 
+/**
+ * @brief Process-wide monotonic id allocator for an id type
+ *
+ * The counter is atomic, so ids can be created from any thread (task workers, parallel
+ * importers) without a coordination lock; a create is a single relaxed fetch-add. Ids are
+ * never recycled. size() observed from another thread may trail in-flight creates, so size
+ * containers on the thread that created the ids, or after creation is known to be done.
+ */
 template <typename ID_T, typename DUMMY_T = void>
 struct GlobalIdReg
 {
     using underlying_t = lgrn::underlying_int_type_t<ID_T>;
     static_assert(std::is_integral_v<underlying_t>);
 
-    [[nodiscard]] static constexpr ID_T create() noexcept
+    [[nodiscard]] static ID_T create() noexcept
     {
-        return ID_T{sm_count++};
+        return ID_T{sm_count.fetch_add(1, std::memory_order_relaxed)};
     }
 
-    [[nodiscard]] static constexpr std::size_t size() noexcept
+    [[nodiscard]] static std::size_t size() noexcept
     {
-      return std::size_t{sm_count};
+        return std::size_t{sm_count.load(std::memory_order_relaxed)};
     }
 
-    [[nodiscard]] static constexpr underlying_t largest() noexcept
+    [[nodiscard]] static underlying_t largest() noexcept
     {
-      return sm_count;
+        return sm_count.load(std::memory_order_relaxed);
     }
 
 private:
-    static inline constinit underlying_t sm_count{0};
+    static inline constinit std::atomic<underlying_t> sm_count{0};
 };
 
 } // namespace osp
@@ -24,8 +24,17 @@
  */
 #pragma once
 
+#include "bitvector.h"
+
 #include <entt/container/dense_map.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace osp
 {
 
@@ -39,4 +48,152 @@ using IdMap_t = entt::dense_map<KEY_T, VALUE_T>;
 //       only one specialization is actually made.
 //       Also consider using extern templates
 
+/**
+ * @brief Id-keyed map storing keys below a limit in a flat array, the rest in an IdMap_t
+ *
+ * Most strong-id key spaces here are dense (allocated by an IdRegistry), so lookups for keys
+ * below the reserve_dense() limit are a single indexed load with no hashing or probing; only
+ * outliers fall back to the hash map. Use for hot lookup paths like resource-resolve loops;
+ * plain IdMap_t remains preferable when the key space is genuinely sparse or values need
+ * non-trivial destruction (dense slots are abandoned, not destroyed, on clear()).
+ */
+template <typename KEY_T, typename VALUE_T>
+class HybridIdMap
+{
+    static_assert(std::is_trivially_destructible_v<VALUE_T>,
+                  "clear() abandons dense slots without destroying them");
+
+public:
+
+    /**
+     * @brief Grow the dense region; keys below the limit take the flat path
+     *
+     * Typically sized from the key id registry's capacity(). Never shrinks.
+     */
+    void reserve_dense(std::size_t const limit)
+    {
+        if (limit > m_dense.size())
+        {
+            m_dense.resize(limit);
+            bitvector_resize(m_present, limit);
+        }
+    }
+
+    /**
+     * @return {pointer to value, true if newly inserted}
+     */
+    std::pair<VALUE_T*, bool> try_emplace(KEY_T const key, VALUE_T value = VALUE_T{})
+    {
+        auto const keyInt = std::size_t(key);
+
+        if (keyInt < m_dense.size())
+        {
+            if (m_present.test(keyInt))
+            {
+                return { &m_dense[keyInt], false };
+            }
+            m_present.set(keyInt);
+            m_dense[keyInt] = std::move(value);
+            ++ m_denseCount;
+            return { &m_dense[keyInt], true };
+        }
+
+        auto const [it, success] = m_overflow.try_emplace(key, std::move(value));
+        return { &it->second, success };
+    }
+
+    /// Insert a range of key/value pairs; one reserve_dense beforehand amortizes the growth
+    template <typename IT_T, typename ITB_T>
+    void insert(IT_T first, ITB_T const last)
+    {
+        for (; first != last; ++first)
+        {
+            try_emplace(first->first, first->second);
+        }
+    }
+
+    VALUE_T* try_get(KEY_T const key) noexcept
+    {
+        auto const keyInt = std::size_t(key);
+
+        if (keyInt < m_dense.size())
+        {
+            return m_present.test(keyInt) ? &m_dense[keyInt] : nullptr;
+        }
+
+        auto const it = m_overflow.find(key);
+        return (it != m_overflow.end()) ? &it->second : nullptr;
+    }
+
+    VALUE_T const* try_get(KEY_T const key) const noexcept
+    {
+        return const_cast<HybridIdMap*>(this)->try_get(key);
+    }
+
+    VALUE_T& at(KEY_T const key)
+    {
+        auto const keyInt = std::size_t(key);
+
+        if (keyInt < m_dense.size())
+        {
+            assert(m_present.test(keyInt));
+            return m_dense[keyInt];
+        }
+        return m_overflow.at(key);
+    }
+
+    VALUE_T const& at(KEY_T const key) const
+    {
+        return const_cast<HybridIdMap*>(this)->at(key);
+    }
+
+    /// Remove a key if present; dense slots are abandoned like clear()
+    void erase(KEY_T const key)
+    {
+        auto const keyInt = std::size_t(key);
+
+        if (keyInt < m_dense.size())
+        {
+            if (m_present.test(keyInt))
+            {
+                m_present.reset(keyInt);
+                -- m_denseCount;
+            }
+            return;
+        }
+        m_overflow.erase(key);
+    }
+
+    bool contains(KEY_T const key) const noexcept
+    {
+        auto const keyInt = std::size_t(key);
+
+        if (keyInt < m_dense.size())
+        {
+            return m_present.test(keyInt);
+        }
+        return m_overflow.contains(key);
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_denseCount + m_overflow.size();
+    }
+
+    void clear()
+    {
+        std::fill(m_present.ints().begin(), m_present.ints().end(), 0u);
+        m_denseCount = 0;
+        m_overflow.clear();
+    }
+
+private:
+
+    std::vector<VALUE_T>        m_dense;
+    BitVector_t                 m_present;
+    std::size_t                 m_denseCount {0};
+    IdMap_t<KEY_T, VALUE_T>     m_overflow;
+
+}; // class HybridIdMap
+
 }
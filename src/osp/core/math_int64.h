@@ -24,6 +24,7 @@
  */
 #pragma once
 
+#include "array_view.h"
 #include "math_types.h"
 
 namespace osp
@@ -75,4 +76,46 @@ constexpr bool is_distance_near(Vector3l const a, Vector3l const b, std::uint64_
     return magnitudeSqr < threshold*threshold;
 }
 
+/**
+ * @brief Batched is_distance_near; rOut[i] = (distance between pos and points[i]) < threshold
+ *
+ * Same semantics and threshold limit as is_distance_near, written branch-free: absdelta's sign
+ * branches become selects and the range early-out becomes a mask, so the body is a straight-line
+ * loop the compiler can turn into SIMD compares and multiplies at whatever width the target has.
+ * Out-of-range deltas make the unsigned multiplies wrap, which is well-defined and discarded by
+ * the range mask.
+ */
+inline void is_distance_near_batched(
+        Vector3l                  const pos,
+        ArrayView<Vector3l const> const points,
+        std::uint64_t             const threshold,
+        ArrayView<std::uint8_t>   const rOut) noexcept
+{
+    // 1431655765 = sqrt(2^64)/3 = max distance without risk of overflow
+    constexpr std::uint64_t dmax = 1431655765ul;
+
+    std::uint64_t const thresholdSqr = threshold * threshold;
+
+    auto const absdelta_select = [] (std::int64_t const lhs, std::int64_t const rhs) noexcept
+    {
+        // Unsigned subtraction wraps to the true difference mod 2^64, so negating it when
+        // lhs < rhs gives |lhs - rhs| for the full int64 range
+        std::uint64_t const d = std::uint64_t(lhs) - std::uint64_t(rhs);
+        return (lhs >= rhs) ? d : (std::uint64_t(0) - d);
+    };
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        std::uint64_t const dx = absdelta_select(pos.x(), points[i].x());
+        std::uint64_t const dy = absdelta_select(pos.y(), points[i].y());
+        std::uint64_t const dz = absdelta_select(pos.z(), points[i].z());
+
+        bool const inRange = (dx <= dmax) & (dy <= dmax) & (dz <= dmax);
+
+        std::uint64_t const magnitudeSqr = (dx*dx + dy*dy + dz*dz);
+
+        rOut[i] = std::uint8_t(inRange & (magnitudeSqr < thresholdSqr));
+    }
+}
+
 } // namespace osp
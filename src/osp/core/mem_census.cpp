@@ -0,0 +1,96 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "mem_census.h"
+
+#include <algorithm>
+#include <ostream>
+
+namespace osp
+{
+
+void MemCensus::add_tag(std::string_view const name, SampleFunc_t const func, UserData_t const userData)
+{
+    auto const found = std::find_if(tags.begin(), tags.end(),
+                                    [name] (Tag const& tag) { return tag.name == name; });
+    if (found != tags.end())
+    {
+        *found = Tag{ .name = name, .func = func, .userData = userData };
+        return;
+    }
+    tags.push_back(Tag{ .name = name, .func = func, .userData = userData });
+}
+
+void MemCensus::resize_ring(std::size_t const capacity)
+{
+    events.clear();
+    events.resize(capacity);
+    eventsNext = 0;
+}
+
+void MemCensus::sample() noexcept
+{
+    clock_t::time_point const now = clock_t::now();
+
+    for (std::uint32_t tagInt = 0; tagInt < tags.size(); ++tagInt)
+    {
+        Tag &rTag = tags[tagInt];
+
+        std::size_t const bytes = rTag.func(rTag.userData);
+        rTag.bytesLast = bytes;
+        rTag.bytesPeak = std::max(rTag.bytesPeak, bytes);
+
+        if ( ! events.empty())
+        {
+            events[eventsNext % events.size()] = {now, tagInt, bytes};
+            ++eventsNext;
+        }
+    }
+}
+
+void write_mem_trace(std::ostream& rStream, MemCensus const& census)
+{
+    using namespace std::chrono;
+
+    std::size_t const stored = std::min(census.eventsNext, census.events.size());
+
+    rStream << "[";
+
+    for (std::size_t i = 0; i < stored; ++i)
+    {
+        MemCensus::SampleEvent const &event = census.events[i];
+
+        auto const ts = duration_cast<microseconds>(event.time.time_since_epoch()).count();
+
+        rStream << ((i == 0) ? "\n" : ",\n")
+                << "{\"name\":\"" << census.tags[event.tag].name << "\","
+                << "\"cat\":\"mem\",\"ph\":\"C\",\"pid\":0,"
+                << "\"ts\":" << ts << ","
+                << "\"args\":{\"bytes\":" << event.bytes << "}}";
+    }
+
+    rStream << "\n]\n";
+}
+
+} // namespace osp
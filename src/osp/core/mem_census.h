@@ -0,0 +1,116 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Periodic per-subsystem memory census with high-water tracking
+ *
+ * Answers "how much RAM does terrain vs. drawing vs. link use" without a heap profiler.
+ * Subsystems register a named tag with a footprint function summing the capacities of their
+ * major buffers; sample() walks the tags, tracking last and peak bytes and appending to a
+ * history ring. Footprints are sampled rather than intercepted at the allocator: the
+ * containers involved (std::vector, KeyedVec, Corrade arrays, longeron registries) don't
+ * thread custom allocator handles, and a capacity sum costs microseconds, cheap enough to
+ * run every couple of seconds. write_mem_trace exports the ring as Chrome tracing counter
+ * events, the same trace format write_task_trace uses for task timings.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace osp
+{
+
+struct MemCensus
+{
+    using clock_t       = std::chrono::steady_clock;
+    using UserData_t    = std::array<void const*, 4>;
+    using SampleFunc_t  = std::size_t (*)(UserData_t userData) noexcept;
+
+    struct Tag
+    {
+        std::string_view    name;
+        SampleFunc_t        func        {nullptr};
+        UserData_t          userData    {{nullptr, nullptr, nullptr, nullptr}};
+
+        std::size_t         bytesLast   {0};
+        std::size_t         bytesPeak   {0};
+    };
+
+    struct SampleEvent
+    {
+        clock_t::time_point time;
+        std::uint32_t       tag;
+        std::size_t         bytes;
+    };
+
+    /**
+     * @brief Register a footprint function, replacing any existing tag of the same name
+     *
+     * Replacement resets last/peak bytes, and keeps renderer restarts and scenario reloads
+     * from accumulating duplicate tags.
+     */
+    void add_tag(std::string_view name, SampleFunc_t func, UserData_t userData);
+
+    /// Drop every registered tag; call before destroying the contexts tags point into
+    void clear_tags() { tags.clear(); }
+
+    /// Preallocate the history ring; zero capacity still tracks peaks but exports no history
+    void resize_ring(std::size_t capacity);
+
+    /**
+     * @brief Run every tag's footprint function, updating last/peak and the history ring
+     *
+     * Not thread-safe; call between frames on the thread that owns the tagged contexts.
+     */
+    void sample() noexcept;
+
+    std::vector<Tag>            tags;
+    std::vector<SampleEvent>    events;
+    std::size_t                 eventsNext {0};
+};
+
+/// Capacity footprint in bytes of a std::vector-backed container (heap data only)
+template <typename VEC_T>
+constexpr std::size_t container_bytes(VEC_T const& vec) noexcept
+{
+    return vec.capacity() * sizeof(typename VEC_T::value_type);
+}
+
+/**
+ * @brief Write the census history ring as Chrome tracing counter events
+ *
+ * Loads into the same chrome://tracing / Perfetto view as write_task_trace's task timings,
+ * graphing each tag's bytes over time next to where the frame time went.
+ */
+void write_mem_trace(std::ostream& rStream, MemCensus const& census);
+
+} // namespace osp
@@ -0,0 +1,139 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2023 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <array>
+#include <bit>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <longeron/utility/enum_traits.hpp>
+
+namespace osp
+{
+
+/**
+ * @brief KeyedVec-style table stored in fixed power-of-two pages instead of one contiguous block
+ *
+ * Growing allocates new pages without moving existing elements, so references and pointers into
+ * the table stay valid across resize. Use this instead of KeyedVec for large long-lived
+ * per-entity tables that grow while the scene runs; use KeyedVec when contiguous storage is
+ * needed (ArrayView, serialization) or the table is small.
+ *
+ * Unlike std::vector, shrinking only frees whole trailing pages; slots in a kept page retain
+ * their old values if the table grows back over them.
+ */
+template <typename ID_T, typename DATA_T, std::size_t PAGE_SIZE = 1024>
+class PagedKeyedVec
+{
+    static_assert(std::has_single_bit(PAGE_SIZE), "PAGE_SIZE must be a power of two");
+
+    using int_t  = lgrn::underlying_int_type_t<ID_T>;
+    using page_t = std::array<DATA_T, PAGE_SIZE>;
+
+    static constexpr std::size_t smc_pageShift = std::countr_zero(PAGE_SIZE);
+    static constexpr std::size_t smc_pageMask  = PAGE_SIZE - 1;
+
+public:
+
+    using value_type      = DATA_T;
+    using reference       = DATA_T&;
+    using const_reference = DATA_T const&;
+    using size_type       = std::size_t;
+
+    constexpr std::size_t size() const noexcept { return m_size; }
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    /// Total slots backed by allocated pages
+    constexpr std::size_t capacity() const noexcept { return m_pages.size() * PAGE_SIZE; }
+
+    void clear()
+    {
+        m_pages.clear();
+        m_size = 0;
+    }
+
+    void resize(std::size_t const size, DATA_T const& fill = DATA_T{})
+    {
+        std::size_t const pagesNeeded = (size + PAGE_SIZE - 1) >> smc_pageShift;
+
+        if (pagesNeeded < m_pages.size())
+        {
+            m_pages.resize(pagesNeeded);
+        }
+
+        while (m_pages.size() < pagesNeeded)
+        {
+            m_pages.push_back(std::make_unique<page_t>());
+        }
+
+        // Overwrite newly exposed slots, matching std::vector::resize(count, value)
+        for (std::size_t i = m_size; i < size; ++i)
+        {
+            (*m_pages[i >> smc_pageShift])[i & smc_pageMask] = fill;
+        }
+
+        m_size = size;
+    }
+
+    reference operator[] (ID_T const id) noexcept
+    {
+        auto const i = std::size_t(int_t(id));
+        return (*m_pages[i >> smc_pageShift])[i & smc_pageMask];
+    }
+
+    const_reference operator[] (ID_T const id) const noexcept
+    {
+        auto const i = std::size_t(int_t(id));
+        return (*m_pages[i >> smc_pageShift])[i & smc_pageMask];
+    }
+
+    reference at(ID_T const id)
+    {
+        if (std::size_t(int_t(id)) >= m_size)
+        {
+            throw std::out_of_range{"PagedKeyedVec::at"};
+        }
+        return (*this)[id];
+    }
+
+    const_reference at(ID_T const id) const
+    {
+        if (std::size_t(int_t(id)) >= m_size)
+        {
+            throw std::out_of_range{"PagedKeyedVec::at"};
+        }
+        return (*this)[id];
+    }
+
+private:
+
+    std::vector< std::unique_ptr<page_t> >  m_pages;
+    std::size_t                             m_size  {0};
+
+}; // class PagedKeyedVec
+
+} // namespace osp
@@ -24,6 +24,7 @@
  */
 #pragma once
 
+#include "array_view.h"
 #include "global_id.h"
 
 #include <longeron/id_management/owner.hpp>
@@ -73,6 +74,42 @@ public:
         return const_cast<T*>(const_cast<const ResourceContainer*>(this)->get(id));
     }
 
+    /**
+     * @brief Snapshot slot pointers of all ids below count for lock-free sealed reads
+     *
+     * Sealed resources are never removed, and emplace heap-allocates each T, so the snapshot
+     * pointers stay valid while m_vec itself keeps growing for unsealed ids. Only call at
+     * package seal time, while no lock-free readers exist yet.
+     */
+    void freeze(std::size_t count)
+    {
+        count = std::min(count, m_vec.size());
+        m_frozen.resize(std::max(m_frozen.size(), count), nullptr);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            m_frozen[i] = m_vec[i].get();
+        }
+    }
+
+    /**
+     * @brief Lock-free read of a slot pointer frozen by freeze(). Sealed ids only.
+     */
+    T const* get_frozen(ResId id) const noexcept
+    {
+        return (std::size_t(id) < m_frozen.size()) ? m_frozen[std::size_t(id)] : nullptr;
+    }
+
+    /**
+     * @brief View of all slot pointers, indexed by ResId
+     *
+     * Slot pointers stay valid across emplace (each T is individually heap-allocated), but the
+     * slot array itself may reallocate, so don't hold this across emplace/remove.
+     */
+    ArrayView< std::unique_ptr<T> const > slots() const noexcept
+    {
+        return {m_vec.data(), m_vec.size()};
+    }
+
     void remove(ResId id)
     {
         assert(m_vec.size() > std::size_t(id));
@@ -82,6 +119,7 @@ public:
 private:
 
     std::vector< std::unique_ptr<T> > m_vec;
+    std::vector<T const*>             m_frozen;
 };
 
 template <typename T>
@@ -28,6 +28,7 @@
 
 #include "string_concat.h"  // for string_data(), string_size()
 
+#include <array>            // for std::array
 #include <memory>           // for std::shared_ptr
 #include <utility>          // for std::forward
 #include <stdexcept>        // for std::invalid_argument
@@ -104,10 +105,58 @@ public:
     using difference_type        = typename ViewBase_t::difference_type;
 
     constexpr BasicSharedString(void) noexcept( std::is_nothrow_default_constructible_v<LIFETIME_T> ) = default;
-    constexpr BasicSharedString(BasicSharedString &&) noexcept( std::is_nothrow_move_constructible_v<LIFETIME_T> ) = default;
-    constexpr BasicSharedString(BasicSharedString const&) noexcept( std::is_nothrow_copy_constructible_v<LIFETIME_T> ) = default;
-    constexpr BasicSharedString& operator=(BasicSharedString &&) noexcept( std::is_nothrow_move_assignable_v<LIFETIME_T> ) = default;
-    constexpr BasicSharedString& operator=(BasicSharedString const&) noexcept( std::is_nothrow_copy_assignable_v<LIFETIME_T> ) = default;
+
+    // Copy and move cannot be defaulted: when the source stores its characters inline (see the
+    // small-string path in create()), the view must be re-pointed at this object's own buffer.
+
+    constexpr BasicSharedString(BasicSharedString && other) noexcept( std::is_nothrow_move_constructible_v<LIFETIME_T> )
+     : ViewBase_t{ static_cast<ViewBase_t const&>(other) }
+     , m_lifetime{ std::move(other.m_lifetime) }
+     , m_sso     { other.m_sso }
+    {
+        if (other.is_inline())
+        {
+            static_cast<ViewBase_t&>(*this) = ViewBase_t{ m_sso.data(), other.size() };
+        }
+    }
+
+    constexpr BasicSharedString(BasicSharedString const& other) noexcept( std::is_nothrow_copy_constructible_v<LIFETIME_T> )
+     : ViewBase_t{ static_cast<ViewBase_t const&>(other) }
+     , m_lifetime{ other.m_lifetime }
+     , m_sso     { other.m_sso }
+    {
+        if (other.is_inline())
+        {
+            static_cast<ViewBase_t&>(*this) = ViewBase_t{ m_sso.data(), other.size() };
+        }
+    }
+
+    constexpr BasicSharedString& operator=(BasicSharedString && other) noexcept( std::is_nothrow_move_assignable_v<LIFETIME_T> )
+    {
+        if (this != &other)
+        {
+            m_lifetime = std::move(other.m_lifetime);
+            m_sso      = other.m_sso;
+            static_cast<ViewBase_t&>(*this) = other.is_inline()
+                    ? ViewBase_t{ m_sso.data(), other.size() }
+                    : static_cast<ViewBase_t const&>(other);
+        }
+        return *this;
+    }
+
+    constexpr BasicSharedString& operator=(BasicSharedString const& other) noexcept( std::is_nothrow_copy_assignable_v<LIFETIME_T> )
+    {
+        if (this != &other)
+        {
+            m_lifetime = other.m_lifetime;
+            m_sso      = other.m_sso;
+            static_cast<ViewBase_t&>(*this) = other.is_inline()
+                    ? ViewBase_t{ m_sso.data(), other.size() }
+                    : static_cast<ViewBase_t const&>(other);
+        }
+        return *this;
+    }
+
     ~BasicSharedString() noexcept( std::is_nothrow_destructible_v<LIFETIME_T> ) = default;
 
     /**
@@ -175,6 +224,19 @@ public:
     static constexpr BasicSharedString create_reference(ViewBase_t)
         noexcept( std::is_nothrow_default_constructible_v<LIFETIME_T> );
 
+    /**
+     * @brief create_static
+     * @param view
+     * @return a SharedString referencing the data with no copy and no refcount.
+     * Same cost as create_reference; the name documents that the data has static storage
+     * duration (string literals, constinit tables) and outlives the whole program.
+     */
+    static constexpr BasicSharedString create_static(ViewBase_t view)
+        noexcept( std::is_nothrow_default_constructible_v<LIFETIME_T> )
+    {
+        return { view };
+    }
+
 #if defined(__cpp_impl_three_way_comparison)
     /**
      * @brief threeway comparison operator for shared strings. Only compares string data, not lifetime.
@@ -220,7 +282,16 @@ protected:
     { }
 
 private:
-    [[no_unique_address]] LIFETIME_T m_lifetime;
+    /// Strings at most this long are stored in m_sso with no allocation or refcount
+    static constexpr size_type smc_ssoCapacity = 22;
+
+    constexpr bool is_inline() const noexcept
+    {
+        return ViewBase_t::data() == m_sso.data();
+    }
+
+    [[no_unique_address]] LIFETIME_T    m_lifetime;
+    std::array<CHAR_T, smc_ssoCapacity> m_sso{};
 }; // class BasicSharedString
 
 //-----------------------------------------------------------------------------
@@ -246,7 +317,14 @@ constexpr auto BasicSharedString<CHAR_T, LIFETIME_T>::substr(size_type const pos
     noexcept(scm_noExceptSubStr && std::is_nothrow_copy_constructible_v<LIFETIME_T>)
     -> BasicSharedString
 {
-    return { ViewBase_t::substr(pos, count), m_lifetime };
+    ViewBase_t const sub = ViewBase_t::substr(pos, count);
+    if (is_inline())
+    {
+        // The characters live in this object's inline buffer; copy them instead of dangling.
+        // A substring always fits, so create() takes the inline path and never allocates.
+        return create(sub.begin(), sub.end());
+    }
+    return { sub, m_lifetime };
 }
 
 template<typename CHAR_T, typename LIFETIME_T>
@@ -254,7 +332,12 @@ constexpr auto BasicSharedString<CHAR_T, LIFETIME_T>::substr(size_type const pos
     noexcept(scm_noExceptSubStr && std::is_nothrow_move_constructible_v<LIFETIME_T>)
     -> BasicSharedString
 {
-    return { ViewBase_t::substr(pos, count), std::move(m_lifetime) };
+    ViewBase_t const sub = ViewBase_t::substr(pos, count);
+    if (is_inline())
+    {
+        return create(sub.begin(), sub.end()); // see copying substr overload
+    }
+    return { sub, std::move(m_lifetime) };
 }
 
 template<typename CHAR_T, typename LIFETIME_T>
@@ -294,6 +377,15 @@ inline auto BasicSharedString<CHAR_T, LIFETIME_T>::create(IT_T && begin, IT_T &&
         return {};
     }
 
+    if(size <= smc_ssoCapacity)
+    {
+        // Small string: store the characters inline, skipping allocation and refcounting
+        BasicSharedString out;
+        std::copy_n(std::forward<IT_T>(begin), size, out.m_sso.data());
+        static_cast<ViewBase_t&>(out) = ViewBase_t{ out.m_sso.data(), size };
+        return out;
+    }
+
     // Make space to copy the string
 #if defined(__cpp_lib_smart_ptr_for_overwrite)
     auto buf = std::make_shared_for_overwrite<CHAR_T[]>(size);
@@ -328,6 +420,16 @@ inline auto BasicSharedString<CHAR_T, LIFETIME_T>::create_from_parts(STRS_T && .
         return {};
     }
 
+    if(size <= smc_ssoCapacity)
+    {
+        // Small string: concatenate the parts straight into the inline buffer
+        BasicSharedString out;
+        auto * p = out.m_sso.data();
+        ( (p = std::copy_n(string_data(strs), string_size(strs), p)), ... );
+        static_cast<ViewBase_t&>(out) = ViewBase_t{ out.m_sso.data(), size };
+        return out;
+    }
+
     // Make space to copy the string
 #if defined(__cpp_lib_smart_ptr_for_overwrite)
     auto buf = std::make_shared_for_overwrite<CHAR_T[]>(size);
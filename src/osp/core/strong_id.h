@@ -81,6 +81,56 @@ struct StrongId
     INT_T value{ lgrn::id_null<StrongId>() };
 };
 
+/**
+ * @brief A StrongId index packed with a generation count, detecting stale handles to
+ *        recycled ids with one integer compare
+ *
+ * GlobalIdReg ids are never reused, but registries that recycle ids can hand the same index
+ * out again while some holder still keeps the old handle. Alongside a per-index generation
+ * counter bumped by the allocator on each reuse (eg: ACtxSceneRender::m_drawEntGen), a
+ * holder stores the generation it acquired; the handle is stale when its generation() no
+ * longer matches the counter. Generations wrap after 2^GEN_BITS reuses of one index, so
+ * pick GEN_BITS against how long handles outlive their entities.
+ *
+ * The generation occupies the top GEN_BITS of the underlying integer and the index the
+ * remaining low bits; the default all-ones value stays null like a null StrongId.
+ */
+template <typename ID_T, unsigned int GEN_BITS = 8>
+struct GenStrongId
+{
+    using underlying_t = typename ID_T::entity_type;
+
+    static constexpr unsigned int smc_indexBits = sizeof(underlying_t) * 8 - GEN_BITS;
+    static constexpr underlying_t smc_indexMask = (underlying_t(1) << smc_indexBits) - 1;
+    static constexpr underlying_t smc_genMax    = (underlying_t(1) << GEN_BITS) - 1;
+
+    constexpr GenStrongId() noexcept = default;
+
+    constexpr GenStrongId(ID_T const id, underlying_t const generation) noexcept
+     : value{ underlying_t(   (generation << smc_indexBits)
+                            | (underlying_t(id) & smc_indexMask) ) }
+    { }
+
+    [[nodiscard]] constexpr ID_T id() const noexcept
+    {
+        return ID_T(value & smc_indexMask);
+    }
+
+    [[nodiscard]] constexpr underlying_t generation() const noexcept
+    {
+        return underlying_t(value >> smc_indexBits);
+    }
+
+    constexpr auto operator<=>(GenStrongId const&) const = default;
+
+    constexpr bool has_value() const noexcept
+    {
+        return *this != GenStrongId{};
+    }
+
+    underlying_t value{ ~underlying_t(0) };
+};
+
 } // namespace osp
 
 // std::hash support for unordered containers
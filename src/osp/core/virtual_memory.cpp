@@ -0,0 +1,94 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "virtual_memory.h"
+
+#if defined(_WIN32)
+  #ifndef WIN32_LEAN_AND_MEAN
+  #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>
+#else
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+namespace osp
+{
+
+#if defined(_WIN32)
+
+std::size_t virtual_page_size() noexcept
+{
+    static std::size_t const size = [] ()
+    {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return std::size_t(info.dwPageSize);
+    }();
+    return size;
+}
+
+void* virtual_reserve(std::size_t const bytes) noexcept
+{
+    return VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+bool virtual_commit(void* const addr, std::size_t const bytes) noexcept
+{
+    return VirtualAlloc(addr, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+}
+
+void virtual_release(void* const addr, [[maybe_unused]] std::size_t const bytes) noexcept
+{
+    VirtualFree(addr, 0, MEM_RELEASE);
+}
+
+#else // POSIX
+
+std::size_t virtual_page_size() noexcept
+{
+    static std::size_t const size = std::size_t(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+void* virtual_reserve(std::size_t const bytes) noexcept
+{
+    void* const addr = mmap(nullptr, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return (addr != MAP_FAILED) ? addr : nullptr;
+}
+
+bool virtual_commit(void* const addr, std::size_t const bytes) noexcept
+{
+    return mprotect(addr, bytes, PROT_READ | PROT_WRITE) == 0;
+}
+
+void virtual_release(void* const addr, std::size_t const bytes) noexcept
+{
+    munmap(addr, bytes);
+}
+
+#endif
+
+} // namespace osp
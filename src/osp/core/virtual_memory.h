@@ -0,0 +1,55 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Thin wrappers over reserving and committing virtual address space
+ *
+ * Reserving a large range costs only address space; pages are committed (made accessible and
+ * backed on first touch) as a buffer actually grows. Growing this way never moves data, so
+ * pointers and views into the buffer stay valid. Reserved-but-uncommitted pages are
+ * inaccessible and fault loudly if touched.
+ */
+
+#include <cstddef>
+
+namespace osp
+{
+
+/// Granularity virtual_commit operates at; reserve/commit sizes round up to this
+std::size_t virtual_page_size() noexcept;
+
+/// Reserve (but don't commit) a range of address space. nullptr on failure.
+void* virtual_reserve(std::size_t bytes) noexcept;
+
+/// Make the first bytes of a reserved range readable/writable. May be called repeatedly with
+/// growing sizes; already-committed pages are unaffected.
+bool virtual_commit(void* addr, std::size_t bytes) noexcept;
+
+/// Release an entire reserved range. bytes must be the size passed to virtual_reserve.
+void virtual_release(void* addr, std::size_t bytes) noexcept;
+
+} // namespace osp
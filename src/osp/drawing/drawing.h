@@ -111,7 +111,30 @@ struct ACtxDrawingRes
 
 using DrawEntColors_t = KeyedVec<DrawEnt, Magnum::Color4>;
 using DrawEntTextures_t = KeyedVec<DrawEnt, TexIdOwner_t>;
-using DrawTransforms_t = KeyedVec<DrawEnt, Matrix4>;
+
+/**
+ * @brief Per-DrawEnt state read together when building draw lists, interleaved in one record
+ *
+ * Culling, LOD selection, and depth sorting walk every visible entity touching its transform,
+ * bounds, and mesh; storing these as separate parallel arrays costs one cache miss per array
+ * per entity. The draw transform fills a cache line by itself, so the whole record spans at
+ * most two. Visibility stays in ACtxSceneRender's bitsets, as draw-list building consumes it
+ * through whole-word set operations rather than per-entity loads.
+ */
+struct DrawEntHot
+{
+    /// World transform calculated by SysRender::update_draw_transforms
+    Matrix4         drawTf;
+
+    /// Mesh describing the entity's appearance; synchronized to a GPU resource by renderers
+    MeshIdOwner_t   mesh;
+
+    /// Object-space bounding sphere radius used by SysRender::cull_draw_ents for per-view
+    /// frustum culling. Zero (the default) means no known bounds; such entities pass the cull.
+    float           boundRadius{0.0f};
+};
+
+using DrawEntHots_t = KeyedVec<DrawEnt, DrawEntHot>;
 
 struct ACtxSceneRender
 {
@@ -126,10 +149,10 @@ struct ACtxSceneRender
         bitvector_resize(m_transparent, size);
         bitvector_resize(m_visible,     size);
 
-        m_drawTransform .resize(size);
+        hot             .resize(size);
         m_color         .resize(size, {1.0f, 1.0f, 1.0f, 1.0f}); // Default white
         m_diffuseTex    .resize(size);
-        m_mesh          .resize(size);
+        m_drawEntGen    .resize(size, 0);
 
         for (uint32_t matInt : m_materialIds.bitview().zeros())
         {
@@ -155,17 +178,28 @@ struct ACtxSceneRender
     KeyedVec<active::ActiveEnt, DrawEnt>    m_activeToDraw;
 
     KeyedVec<active::ActiveEnt, uint16_t>   drawTfObserverEnable;
-    DrawTransforms_t                        m_drawTransform;
 
-    // Meshes and textures assigned to DrawEnts
+    /// Render-hot records (transform, mesh, bounds); see DrawEntHot
+    DrawEntHots_t                           hot;
+
+    // Textures assigned to DrawEnts
     KeyedVec<DrawEnt, TexIdOwner_t>         m_diffuseTex;
     DrawEntVec_t                            m_diffuseDirty;
 
-    KeyedVec<DrawEnt, MeshIdOwner_t>        m_mesh;
     DrawEntVec_t                            m_meshDirty;
 
     lgrn::IdRegistryStl<MaterialId>         m_materialIds;
     KeyedVec<MaterialId, Material>          m_materials;
+
+    /// Generation counters for externally stored DrawEnts. SysRender::compact_draw_ents
+    /// increments the counter of every id whose meaning changed, so holders that saved a
+    /// {DrawEnt, generation} pair can detect that their handle went stale.
+    KeyedVec<DrawEnt, std::uint8_t>         m_drawEntGen;
+
+    /// Entities whose projected bounding sphere spans fewer pixels than this are dropped by
+    /// SysRender::cull_draw_ents; a fleet of vehicles tens of kilometers out otherwise costs
+    /// a full draw each for sub-pixel area. Zero disables the coverage cull.
+    float                                   m_cullPixelThreshold{1.0f};
 };
 
 struct Camera
@@ -27,10 +27,76 @@
 
 #include "../core/Resources.h"
 
+#include <cmath>
+
 using namespace osp;
 using namespace osp::active;
 using namespace osp::draw;
 
+ViewFrustum ViewFrustum::from_view_proj(Matrix4 const& viewProj) noexcept
+{
+    Vector4 const row0 = viewProj.row(0);
+    Vector4 const row1 = viewProj.row(1);
+    Vector4 const row2 = viewProj.row(2);
+    Vector4 const row3 = viewProj.row(3);
+
+    ViewFrustum out{ .m_planes = {{ row3 + row0, row3 - row0,
+                                    row3 + row1, row3 - row1,
+                                    row3 + row2, row3 - row2 }} };
+    for (Vector4 &rPlane : out.m_planes)
+    {
+        rPlane /= rPlane.xyz().length();
+    }
+    return out;
+}
+
+bool ViewFrustum::test_sphere(Vector3 const& center, float const radius) const noexcept
+{
+    for (Vector4 const& plane : m_planes)
+    {
+        if (Magnum::Math::dot(plane.xyz(), center) + plane.w() < -radius)
+        {
+            return false; // Entirely behind one plane
+        }
+    }
+    return true;
+}
+
+void DrawTfObservers::collect(ACtxSceneRender const& rCtxScnRdr, Matrix4 const& drawTf,
+                              ActiveEnt const ent, int const depth) noexcept
+{
+    std::uint16_t const enable = rCtxScnRdr.drawTfObserverEnable[ent];
+    if (enable == 0)
+    {
+        return; // Nothing subscribed to this entity
+    }
+
+    auto const enableInt  = std::array{enable};
+    auto const enableBits = lgrn::bit_view(enableInt);
+
+    std::lock_guard<std::mutex> const lock{changedLock};
+    for (std::size_t const idx : enableBits.ones())
+    {
+        observers[idx].changed.push_back({drawTf, ent, depth});
+    }
+}
+
+void DrawTfObservers::dispatch(ACtxSceneRender& rCtxScnRdr) noexcept
+{
+    for (Observer &rObserver : observers)
+    {
+        if (rObserver.func != nullptr)
+        {
+            for (ChangedTf const& changed : rObserver.changed)
+            {
+                rObserver.func(rCtxScnRdr, changed.drawTf, changed.ent, changed.depth,
+                               rObserver.data);
+            }
+        }
+        rObserver.changed.clear();
+    }
+}
+
 MeshId SysRender::own_mesh_resource(ACtxDrawing& rCtxDrawing, ACtxDrawingRes& rCtxDrawingRes, Resources &rResources, ResId const resId)
 {
     auto const& [it, success] = rCtxDrawingRes.m_resToMesh.try_emplace(resId);
@@ -69,11 +135,11 @@ void SysRender::clear_owners(ACtxSceneRender& rCtxScnRdr, ACtxDrawing& rCtxDrawi
         }
     }
 
-    for (MeshIdOwner_t &rOwner : std::exchange(rCtxScnRdr.m_mesh, {}))
+    for (DrawEntHot &rHot : rCtxScnRdr.hot)
     {
-        if (rOwner.has_value())
+        if (rHot.mesh.has_value())
         {
-            rCtxDrawing.m_meshRefCounts.ref_release(std::move(rOwner));
+            rCtxDrawing.m_meshRefCounts.ref_release(std::move(rHot.mesh));
         }
     }
 }
@@ -82,15 +148,179 @@ void SysRender::clear_resource_owners(ACtxDrawingRes& rCtxDrawingRes, Resources
 {
     for ([[maybe_unused]] auto && [_, rOwner] : std::exchange(rCtxDrawingRes.m_texToRes, {}))
     {
-        rResources.owner_destroy(restypes::gc_texture, std::move(rOwner));
+        rResources.owner_destroy_later(restypes::gc_texture, std::move(rOwner));
     }
     rCtxDrawingRes.m_resToTex.clear();
 
     for ([[maybe_unused]] auto && [_, rOwner] : std::exchange(rCtxDrawingRes.m_meshToRes, {}))
     {
-        rResources.owner_destroy(restypes::gc_mesh, std::move(rOwner));
+        rResources.owner_destroy_later(restypes::gc_mesh, std::move(rOwner));
     }
     rCtxDrawingRes.m_resToMesh.clear();
+
+    rResources.owner_destroy_flush();
+}
+
+std::size_t SysRender::compact_draw_ents(
+        ACtxSceneRender&            rCtxScnRdr,
+        KeyedVec<DrawEnt, DrawEnt>& rRemap)
+{
+    std::size_t const capacity = rCtxScnRdr.m_drawIds.capacity();
+
+    rRemap.assign(capacity, lgrn::id_null<DrawEnt>());
+    rCtxScnRdr.m_drawEntGen.resize(capacity, 0);
+
+    // Assign new dense ids ascending with old ids, keeping relative order
+    std::uint32_t next  = 0;
+    std::size_t   moved = 0;
+    for (std::size_t const entInt : rCtxScnRdr.m_drawIds.bitview().zeros())
+    {
+        auto const newEnt = DrawEnt(next++);
+        rRemap[DrawEnt(entInt)] = newEnt;
+        moved += std::size_t(newEnt != DrawEnt(entInt));
+    }
+
+    if (moved == 0)
+    {
+        return 0;
+    }
+
+    auto const move_bit = [] (BitVector_t& rBits, std::size_t const oldInt, std::size_t const newInt)
+    {
+        rBits.test(oldInt) ? rBits.set(newInt) : rBits.reset(newInt);
+        rBits.reset(oldInt);
+    };
+
+    // Process in ascending old id order, so each old row is read before any later pair
+    // overwrites it: destinations ascend with sources, and a row already used as a
+    // destination is never read as a source afterwards
+    for (std::size_t oldInt = 0; oldInt < capacity; ++oldInt)
+    {
+        auto const oldEnt    = DrawEnt(oldInt);
+        DrawEnt const newEnt = rRemap[oldEnt];
+        if (newEnt == lgrn::id_null<DrawEnt>() || newEnt == oldEnt)
+        {
+            continue; // Dead, or already dense
+        }
+        auto const newInt = std::size_t(newEnt);
+
+        move_bit(rCtxScnRdr.m_opaque,      oldInt, newInt);
+        move_bit(rCtxScnRdr.m_transparent, oldInt, newInt);
+        move_bit(rCtxScnRdr.m_visible,     oldInt, newInt);
+
+        rCtxScnRdr.m_color[newEnt]          = rCtxScnRdr.m_color[oldEnt];
+        rCtxScnRdr.hot[newEnt]              = std::move(rCtxScnRdr.hot[oldEnt]);
+        rCtxScnRdr.m_diffuseTex[newEnt]     = std::move(rCtxScnRdr.m_diffuseTex[oldEnt]);
+
+        for (std::uint32_t const matInt : rCtxScnRdr.m_materialIds.bitview().zeros())
+        {
+            move_bit(rCtxScnRdr.m_materials[MaterialId(matInt)].m_ents, oldInt, newInt);
+        }
+
+        // Both ids now mean something different than before
+        ++rCtxScnRdr.m_drawEntGen[oldEnt];
+        ++rCtxScnRdr.m_drawEntGen[newEnt];
+    }
+
+    // Remap pending dirty lists, dropping dead entries
+    auto const remap_vec = [&rRemap] (DrawEntVec_t& rVec)
+    {
+        std::size_t write = 0;
+        for (DrawEnt const ent : rVec)
+        {
+            DrawEnt const newEnt = (std::size_t(ent) < rRemap.size())
+                                 ? rRemap[ent] : lgrn::id_null<DrawEnt>();
+            if (newEnt != lgrn::id_null<DrawEnt>())
+            {
+                rVec[write++] = newEnt;
+            }
+        }
+        rVec.resize(write);
+    };
+
+    remap_vec(rCtxScnRdr.m_meshDirty);
+    remap_vec(rCtxScnRdr.m_diffuseDirty);
+    for (std::uint32_t const matInt : rCtxScnRdr.m_materialIds.bitview().zeros())
+    {
+        remap_vec(rCtxScnRdr.m_materials[MaterialId(matInt)].m_dirty);
+    }
+
+    for (DrawEnt &rDrawEnt : rCtxScnRdr.m_activeToDraw)
+    {
+        if (rDrawEnt != lgrn::id_null<DrawEnt>())
+        {
+            rDrawEnt = rRemap[rDrawEnt];
+        }
+    }
+
+    // Rebuild the registry as the dense id range [0, next)
+    rCtxScnRdr.m_drawIds = {};
+    for (std::uint32_t i = 0; i < next; ++i)
+    {
+        [[maybe_unused]] DrawEnt const ent = rCtxScnRdr.m_drawIds.create();
+    }
+
+    return moved;
+}
+
+void SysRender::cull_draw_ents(
+        ACtxSceneRender const&      rCtxScnRdr,
+        ViewProjMatrix const&       viewProj,
+        float const                 viewHeightPx,
+        DrawEntSet_t&               rViewVisible)
+{
+    bitvector_resize(rViewVisible, rCtxScnRdr.m_visible.size());
+    std::fill(rViewVisible.ints().begin(), rViewVisible.ints().end(), 0);
+
+    ViewFrustum const frustum = ViewFrustum::from_view_proj(viewProj.m_viewProj);
+
+    // Pixels covered by one unit of view-space size at depth 1: the projection's [1][1]
+    // is cot(fovY/2), mapping view space onto the 2-unit NDC range spanning the viewport
+    float const pxAtUnitDepth = 0.5f * viewHeightPx * viewProj.m_proj[1][1];
+    float const thresholdPx   = rCtxScnRdr.m_cullPixelThreshold;
+
+    for (std::size_t const entInt : rCtxScnRdr.m_visible.ones())
+    {
+        auto const drawEnt = DrawEnt(entInt);
+
+        // One interleaved record; radius and transform arrive on the same fetch
+        DrawEntHot const& hotEnt = rCtxScnRdr.hot[drawEnt];
+
+        float const radius = hotEnt.boundRadius;
+        if (radius > 0.0f)
+        {
+            Matrix4 const& drawTf = hotEnt.drawTf;
+
+            // Conservatively scale the radius by the transform's largest basis vector, so
+            // non-uniformly scaled entities are never culled while on-screen
+            float const scaleSq = std::max({ drawTf[0].xyz().dot(),
+                                             drawTf[1].xyz().dot(),
+                                             drawTf[2].xyz().dot() });
+
+            float const worldRadius = radius * std::sqrt(scaleSq);
+
+            if ( ! frustum.test_sphere(drawTf.translation(), worldRadius) )
+            {
+                continue;
+            }
+
+            // Coverage cull: drop draws whose projected sphere spans fewer pixels than the
+            // threshold. The camera-enclosing case (depth <= radius) always passes.
+            if (pxAtUnitDepth > 0.0f && thresholdPx > 0.0f)
+            {
+                float const depth
+                        = -viewProj.m_view.transformPoint(drawTf.translation()).z();
+
+                if (   depth > worldRadius
+                    && (2.0f * worldRadius * pxAtUnitDepth) < (thresholdPx * depth))
+                {
+                    continue;
+                }
+            }
+        }
+
+        rViewVisible.set(entInt);
+    }
 }
 
 MeshIdOwner_t SysRender::add_drawable_mesh(ACtxDrawing& rDrawing, ACtxDrawingRes& rDrawingRes, Resources& rResources, PkgId const pkg, std::string_view const name)
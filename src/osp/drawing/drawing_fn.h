@@ -28,6 +28,14 @@
 
 #include "../activescene/basic.h"
 #include "../activescene/basic_fn.h"
+#include "../core/array_view.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace osp::draw
 {
@@ -45,21 +53,56 @@ namespace osp::draw
  * systems.
  *
  * To use, write into DrawTfObservers::observers[i]
- * Enable per-DrawEnt by setting ACtxSceneRender::drawTfObserverEnable[drawEnt] bit [i]
+ * Subscribe per-ActiveEnt by setting ACtxSceneRender::drawTfObserverEnable[ent] bit [i]
  *
+ * Subscriptions are delivered incrementally: the sweep only recomputes entities whose
+ * transforms changed (see SysRender::update_draw_transforms), and collect queues each
+ * changed subscribed entity onto its observers. Observer functions then run serially over
+ * their queues in dispatch, after the sweep; static entities never reach an observer, and
+ * observer functions need not be thread-safe.
  */
 struct DrawTfObservers
 {
     using UserData_t = std::array<void*, 7>;
     using Func_t = void(*)(ACtxSceneRender& rCtxScnRdr, Matrix4 const&, active::ActiveEnt, int, UserData_t) noexcept;
 
+    struct ChangedTf
+    {
+        Matrix4             drawTf;
+        active::ActiveEnt   ent;
+        int                 depth;
+    };
+
     struct Observer
     {
         Func_t      func{nullptr};
         UserData_t  data{};
+
+        /// Subscribed entities recomputed this frame; filled by collect, emptied by dispatch
+        std::vector<ChangedTf> changed;
     };
 
+    /**
+     * @brief Queue a recomputed draw transform onto every observer subscribed to its entity
+     *
+     * Call from the update_draw_transforms func callback, which only fires for entities
+     * whose draw transform actually changed. Thread-safe; the parallel sweep calls this
+     * from workers, and unsubscribed entities return without taking the lock.
+     */
+    void collect(ACtxSceneRender const& rCtxScnRdr, Matrix4 const& drawTf,
+                 active::ActiveEnt ent, int depth) noexcept;
+
+    /**
+     * @brief Run each observer function over its queued entities, then clear the queues
+     *
+     * Call once after the sweep, from a single thread.
+     */
+    void dispatch(ACtxSceneRender& rCtxScnRdr) noexcept;
+
     std::array<Observer, 16> observers;
+
+    /// Guards the observers' changed queues during the parallel sweep
+    std::mutex changedLock;
 };
 
 /**
@@ -78,6 +121,23 @@ struct ViewProjMatrix
     Matrix4 m_proj;
 };
 
+/**
+ * @brief Six view frustum planes extracted from a view-projection matrix
+ *
+ * Built once per view per frame; every DrawEnt bounding sphere of that view is tested against
+ * the same planes.
+ */
+struct ViewFrustum
+{
+    static ViewFrustum from_view_proj(Matrix4 const& viewProj) noexcept;
+
+    /// @return false only when the sphere is entirely outside the frustum
+    bool test_sphere(Vector3 const& center, float radius) const noexcept;
+
+    /// Planes as {nx, ny, nz, d} with normals pointing inward
+    std::array<Vector4, 6> m_planes;
+};
+
 /**
  * @brief Stores a draw function and user data needed to draw a single entity
  */
@@ -102,6 +162,53 @@ struct EntityToDraw
 
 }; // struct EntityToDraw
 
+/**
+ * @brief Stores a draw function and user data needed to draw many entities in one call
+ *
+ * Counterpart to EntityToDraw for entities that share a mesh, texture, and shader, letting
+ * the shader upload per-instance data once and issue a single instanced draw instead of one
+ * draw per entity.
+ */
+struct InstancedBatch
+{
+    using UserData_t = EntityToDraw::UserData_t;
+
+    /**
+     * @brief A function pointer to a Shader's instanced draw() function
+     *
+     * @param ArrayView<DrawEnt const>  [in] Entities to draw, all sharing one mesh/texture
+     * @param ViewProjMatrix            [in] View and projection matrix
+     * @param UserData_t                [in] Non-owning user data
+     */
+    using ShaderDrawBatchFnc_t = void (*)(
+            ArrayView<DrawEnt const>, ViewProjMatrix const&, UserData_t) noexcept;
+
+    ShaderDrawBatchFnc_t draw{nullptr};
+
+    // Non-owning user data passed to draw function, such as the shader
+    UserData_t data{};
+
+    std::vector<DrawEnt> entities;
+
+}; // struct InstancedBatch
+
+/**
+ * @brief Pack a 64-bit draw sort key; higher-order fields dominate ordering
+ *
+ * Drawing key-adjacent entities together keeps GL state switches (program, then texture, then
+ * mesh binds) to a minimum. The depth bucket occupies the low bits for optional front-to-back
+ * ordering within otherwise identical state.
+ */
+constexpr std::uint64_t draw_sort_key(
+        std::uint16_t const shader, std::uint16_t const texture,
+        std::uint16_t const mesh,   std::uint16_t const depthBucket = 0) noexcept
+{
+    return (std::uint64_t(shader)  << 48)
+         | (std::uint64_t(texture) << 32)
+         | (std::uint64_t(mesh)    << 16)
+         |  std::uint64_t(depthBucket);
+}
+
 /**
  * @brief Tracks a set of entities and their assigned drawing functions
  *
@@ -114,8 +221,59 @@ struct RenderGroup
 {
     using DrawEnts_t = Storage_t<DrawEnt, EntityToDraw>;
 
+    /// Buckets for instanced drawing, keyed by an opaque value packed by the shader's sync
+    /// function (typically GPU mesh, texture, and program ids). Entities sorted into a bucket
+    /// must all be drawable by one call of its InstancedBatch::draw
+    using Instanced_t = std::unordered_map<std::uint64_t, InstancedBatch>;
+
+    struct DrawOrderEntry
+    {
+        std::uint64_t   key;
+        DrawEnt         ent;
+    };
+
+    /**
+     * @brief Assign an entity's draw sort key, typically from draw_sort_key
+     *
+     * Called by shader sync functions alongside assigning EntityToDraw. Only marks the cached
+     * draw order dirty when the key actually changes, so re-syncing an unchanged entity costs
+     * nothing at draw time.
+     */
+    void set_sort_key(DrawEnt const ent, std::uint64_t const key)
+    {
+        sortKeys.resize(std::max(sortKeys.size(), std::size_t(ent) + 1), 0);
+        if (sortKeys[ent] != key)
+        {
+            sortKeys[ent] = key;
+            drawOrderDirty = true;
+        }
+    }
+
+    /// Counterpart to set_sort_key for entities removed from the group
+    void clear_sort_key(DrawEnt const ent) noexcept
+    {
+        if (std::size_t(ent) < sortKeys.size() && sortKeys[ent] != 0)
+        {
+            sortKeys[ent] = 0;
+            drawOrderDirty = true;
+        }
+    }
+
+    /// Entities drawn one call each
     DrawEnts_t entities;
 
+    /// Entities drawn one call per bucket
+    Instanced_t instanced;
+
+    /// Sort key per entity; zero for entities never given one
+    KeyedVec<DrawEnt, std::uint64_t> sortKeys;
+
+    /// Key-ordered entities, cached across frames and rebuilt by draw_group only when stale,
+    /// so an unchanged scene draws in a stable order with zero sorting work
+    std::vector<DrawOrderEntry> drawOrder;
+
+    bool drawOrderDirty{false};
+
 }; // struct RenderGroup
 
 class SysRender
@@ -165,7 +323,7 @@ public:
             Resources&                              rResources);
 
     static inline void needs_draw_transforms(
-            active::ACtxSceneGraph const&           scnGraph,
+            active::ACtxSceneGraph&                 rScnGraph,
             active::ActiveEntSet_t&                 rNeedDrawTf,
             active::ActiveEnt                       ent);
 
@@ -175,9 +333,18 @@ public:
         active::ACompTransformStorage_t const&      transforms;
         KeyedVec<active::ActiveEnt, DrawEnt> const& activeToDraw;
         active::ActiveEntSet_t const&               needDrawTf;
-        DrawTransforms_t&                           rDrawTf;
+        DrawEntHots_t&                              rHot;
     };
 
+    /**
+     * @brief Calculate draw transforms for root entities and their descendants
+     *
+     * When the scene graph tracks transform changes (see
+     * SysSceneGraph::mark_transform_dirty), subtrees containing no changed transforms are
+     * skipped and keep their previous draw transforms, making cost proportional to moving
+     * entities. Scenes that never mark get every subtree recomputed. \p func is only called
+     * for recomputed entities.
+     */
     template<typename IT_T, typename ITB_T, typename FUNC_T = UpdDrawTransformNoOp>
     static void update_draw_transforms(
             ArgsForUpdDrawTransform     args,
@@ -185,39 +352,108 @@ public:
             ITB_T const&                last,
             FUNC_T                      func = {});
 
+    /**
+     * @brief update_draw_transforms split across worker threads by root subtree
+     *
+     * Each root entity's subtree is propagated independently; subtrees only write draw
+     * transforms of their own descendants, so whole subtrees are partitioned across threads,
+     * weighted by descendant count. Falls back to the serial version for small scenes. \p func
+     * is called concurrently and must only write state keyed by the entity it's called for.
+     */
+    template<typename IT_T, typename ITB_T, typename FUNC_T = UpdDrawTransformNoOp>
+    static void update_draw_transforms_parallel(
+            ArgsForUpdDrawTransform     args,
+            IT_T                        first,
+            ITB_T const&                last,
+            FUNC_T                      func = {});
+
     template<typename IT_T>
     static void update_delete_drawing(
             ACtxSceneRender& rCtxScnRdr, ACtxDrawing& rCtxDrawing, IT_T const& first, IT_T const& last);
 
+    /**
+     * @brief Compact sparse DrawEnt ids so per-DrawEnt arrays stay dense
+     *
+     * Spawning and despawning leaves holes in the DrawEnt id space, so every per-DrawEnt
+     * KeyedVec and bitset iterates over dead rows. This moves each live DrawEnt down into the
+     * lowest free id (keeping relative order) and writes the old-to-new mapping into
+     * \p rRemap, sized to the old capacity with id_null for dead ids.
+     *
+     * Only scene-side state in \p rCtxScnRdr is remapped; this is an opt-in pass for quiet
+     * frames. Callers must afterwards refresh any DrawEnts stored elsewhere through \p rRemap
+     * (ACtxSceneRender::m_drawEntGen flags stale handles that were missed), and re-synchronize
+     * renderer-side state the same way re-opening a renderer does.
+     *
+     * @return Number of DrawEnts that changed id; 0 when the id space was already dense
+     */
+    static std::size_t compact_draw_ents(
+            ACtxSceneRender&            rCtxScnRdr,
+            KeyedVec<DrawEnt, DrawEnt>& rRemap);
+
+    /**
+     * @brief Frustum-cull visible DrawEnts into a per-view visible set
+     *
+     * Supports multiple views (eg: picture-in-picture docking camera) off one scene sync:
+     * draw transforms, shader assignments, and RenderGroups are all shared, and each view only
+     * intersects ACtxSceneRender::m_visible with its own frustum here, then passes the
+     * resulting set and its ViewProjMatrix to draw_group. A second view therefore costs only
+     * this cull and its own draw submission.
+     *
+     * Bounding spheres are DrawEntHot::boundRadius scaled by the draw transform, centered
+     * on its translation. Entities with no radius assigned (zero) are never culled.
+     *
+     * Entities inside the frustum are additionally dropped when their projected bounding
+     * sphere covers fewer than ACtxSceneRender::m_cullPixelThreshold pixels, estimated from
+     * the projection and \p viewHeightPx; pass zero view height to skip the coverage cull
+     * (eg: for shadow views with no meaningful pixel size).
+     *
+     * @param rViewVisible [out] Per-view subset of m_visible, resized to fit
+     */
+    static void cull_draw_ents(
+            ACtxSceneRender const&      rCtxScnRdr,
+            ViewProjMatrix const&       viewProj,
+            float                       viewHeightPx,
+            DrawEntSet_t&               rViewVisible);
+
     static MeshIdOwner_t add_drawable_mesh(ACtxDrawing& rDrawing, ACtxDrawingRes& rDrawingRes, Resources& rResources, PkgId const pkg, std::string_view const name);
 
     static constexpr decltype(auto) gen_drawable_mesh_adder(ACtxDrawing& rDrawing, ACtxDrawingRes& rDrawingRes, Resources& rResources, PkgId const pkg);
 
 private:
 
+    static bool transform_dirty_test(active::ActiveEntSet_t const& dirtySet, active::ActiveEnt ent) noexcept
+    {
+        // Entities past the end were added after the set was last resized; assume changed
+        return (std::size_t(ent.value) >= dirtySet.size()) || dirtySet.test(ent.value);
+    }
+
     template<typename FUNC_T>
     static void update_draw_transforms_recurse(
             ArgsForUpdDrawTransform     args,
             active::ActiveEnt           ent,
             Matrix4 const&              parentTf,
             int                         depth,
+            bool                        dirty,
             FUNC_T&                     func);
 
 }; // class SysRender
 
 void SysRender::needs_draw_transforms(
-        active::ACtxSceneGraph const&   scnGraph,
+        active::ACtxSceneGraph&         rScnGraph,
         active::ActiveEntSet_t&         rNeedDrawTf,
         active::ActiveEnt               ent)
 {
     rNeedDrawTf.set(ent.value);
 
-    active::ActiveEnt const parentEnt = scnGraph.m_entParent[ent];
+    // Newly drawable entities have no draw transform yet, so they can't be skipped as clean
+    active::SysSceneGraph::mark_transform_dirty(rScnGraph, ent);
+
+    active::ActiveEnt const parentEnt = rScnGraph.m_entParent[ent];
 
     if (   parentEnt != lgrn::id_null<active::ActiveEnt>()
         && ! rNeedDrawTf.test(std::size_t(parentEnt)) )
     {
-        SysRender::needs_draw_transforms(scnGraph, rNeedDrawTf, parentEnt);
+        SysRender::needs_draw_transforms(rScnGraph, rNeedDrawTf, parentEnt);
     }
 }
 
@@ -230,25 +466,117 @@ void SysRender::update_draw_transforms(
 {
     static constexpr Matrix4 const identity{};
 
+    // Empty dirty sets mean the scene doesn't track transform changes; recompute everything
+    bool const trackDirty = ! args.scnGraph.m_transformDirty.ints().empty();
+
     while (first != last)
     {
         active::ActiveEnt const ent = *first;
 
         if (args.needDrawTf.test(ent.value))
         {
-            update_draw_transforms_recurse(args, ent, identity, true, func);
+            bool const entDirty = ! trackDirty
+                                || transform_dirty_test(args.scnGraph.m_transformDirty, ent);
+            if (   entDirty
+                || transform_dirty_test(args.scnGraph.m_subtreeTransformDirty, ent) )
+            {
+                update_draw_transforms_recurse(args, ent, identity, true, entDirty, func);
+            }
         }
 
         std::advance(first, 1);
     }
 }
 
+template<typename IT_T, typename ITB_T, typename FUNC_T>
+void SysRender::update_draw_transforms_parallel(
+        ArgsForUpdDrawTransform     args,
+        IT_T                        first,
+        ITB_T const&                last,
+        FUNC_T                      func)
+{
+    using active::ActiveEnt;
+    using active::SysSceneGraph;
+
+    /// Total entities below which the thread spawn/join overhead isn't worth it
+    static constexpr std::size_t sc_parallelMinWeight = 1024;
+
+    bool const trackDirty = ! args.scnGraph.m_transformDirty.ints().empty();
+
+    // Gather root subtrees that need an update, weighted by subtree entity count so one heavy
+    // station doesn't serialize behind a pile of light debris
+    std::vector<ActiveEnt> roots;
+    std::size_t totalWeight = 0;
+    for (IT_T it = first; it != last; std::advance(it, 1))
+    {
+        ActiveEnt const ent = *it;
+        if (   args.needDrawTf.test(ent.value)
+            && (   ! trackDirty
+                || transform_dirty_test(args.scnGraph.m_transformDirty, ent)
+                || transform_dirty_test(args.scnGraph.m_subtreeTransformDirty, ent) ) )
+        {
+            roots.push_back(ent);
+            totalWeight += 1 + SysSceneGraph::descendants(args.scnGraph, ent).size();
+        }
+    }
+
+    std::size_t const workerCount = std::min({
+            std::size_t(std::thread::hardware_concurrency()),
+            totalWeight / sc_parallelMinWeight,
+            roots.size()});
+
+    if (workerCount <= 1)
+    {
+        update_draw_transforms(args, roots.begin(), roots.end(), func);
+        return;
+    }
+
+    static constexpr Matrix4 const identity{};
+
+    // Greedily hand whole subtrees to each worker up to an even share of the total weight;
+    // the last worker takes whatever remains
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+
+    std::size_t const weightPerWorker = totalWeight / workerCount;
+    std::size_t rootFirst = 0;
+    for (std::size_t w = 0; w < workerCount && rootFirst < roots.size(); ++w)
+    {
+        std::size_t rootLast = rootFirst;
+        std::size_t weight   = 0;
+        while (   rootLast < roots.size()
+               && (weight < weightPerWorker || (w + 1 == workerCount)) )
+        {
+            weight += 1 + SysSceneGraph::descendants(args.scnGraph, roots[rootLast]).size();
+            ++rootLast;
+        }
+
+        workers.emplace_back([&args, &func, &roots, rootFirst, rootLast, trackDirty] ()
+        {
+            for (std::size_t i = rootFirst; i < rootLast; ++i)
+            {
+                bool const dirty = ! trackDirty
+                                 || transform_dirty_test(args.scnGraph.m_transformDirty, roots[i]);
+                update_draw_transforms_recurse(args, roots[i], identity, true, dirty, func);
+            }
+        });
+
+        rootFirst = rootLast;
+    }
+
+    for (std::thread &rWorker : workers)
+    {
+        rWorker.join();
+    }
+}
+
 template<typename FUNC_T>
 void SysRender::update_draw_transforms_recurse(
         ArgsForUpdDrawTransform     args,
         active::ActiveEnt           ent,
         Matrix4 const&              parentTf,
         int                         depth,
+        bool                        dirty,
         FUNC_T&                     func)
 {
     using namespace osp::active;
@@ -256,19 +584,30 @@ void SysRender::update_draw_transforms_recurse(
     Matrix4 const& entTf        = args.transforms.get(ent).m_transform;
     Matrix4 const& entDrawTf    = (depth == 0) ? (entTf) : (parentTf * entTf);
 
-    func(entDrawTf, ent, depth);
-
-    DrawEnt const drawEnt = args.activeToDraw[ent];
-    if (drawEnt != lgrn::id_null<DrawEnt>())
+    // A clean entity on the path to a dirty descendant still multiplies its way down, but its
+    // own stored draw transform and observers are left alone
+    if (dirty)
     {
-        args.rDrawTf[drawEnt] = entDrawTf;
+        func(entDrawTf, ent, depth);
+
+        DrawEnt const drawEnt = args.activeToDraw[ent];
+        if (drawEnt != lgrn::id_null<DrawEnt>())
+        {
+            args.rHot[drawEnt].drawTf = entDrawTf;
+        }
     }
 
-    for (ActiveEnt entChild : SysSceneGraph::children(args.scnGraph, ent))
+    for (ActiveEnt entChild : SysSceneGraph::children_span(args.scnGraph, ent))
     {
         if (args.needDrawTf.test(std::size_t(entChild)))
         {
-            update_draw_transforms_recurse(args, entChild, entDrawTf, depth + 1, func);
+            bool const childDirty = dirty
+                                  || transform_dirty_test(args.scnGraph.m_transformDirty, entChild);
+            if (   childDirty
+                || transform_dirty_test(args.scnGraph.m_subtreeTransformDirty, entChild) )
+            {
+                update_draw_transforms_recurse(args, entChild, entDrawTf, depth + 1, childDirty, func);
+            }
         }
     }
 }
@@ -294,7 +633,12 @@ void SysRender::update_delete_drawing(
         DrawEnt const drawEnt = *it;
 
         remove_refcounted(drawEnt, rCtxScnRdr.m_diffuseTex, rCtxDrawing.m_texRefCounts);
-        remove_refcounted(drawEnt, rCtxScnRdr.m_mesh,       rCtxDrawing.m_meshRefCounts);
+
+        MeshIdOwner_t &rMeshOwner = rCtxScnRdr.hot[drawEnt].mesh;
+        if (rMeshOwner.has_value())
+        {
+            rCtxDrawing.m_meshRefCounts.ref_release(std::move(rMeshOwner));
+        }
     }
 }
 
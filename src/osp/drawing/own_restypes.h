@@ -26,6 +26,8 @@
 
 #include "../core/resourcetypes.h"
 
+#include <array>
+
 namespace osp
 {
 
@@ -40,4 +42,19 @@ inline ResTypeId const gc_mesh          = ResTypeIdReg_t::create();
 
 struct TextureImgSource : public ResIdOwner_t { };
 
+/**
+ * @brief Simplified level-of-detail meshes cooked at import for a gc_mesh resource
+ *
+ * Attached to the full-detail mesh resource. Levels are ordered coarsest-last; entries
+ * without a value mean generation stopped there (mesh too small to bother). Produced by
+ * simplify_mesh_lods / register_mesh_lods, consumed by SysRenderGL when compiling the
+ * full mesh.
+ */
+struct MeshLods
+{
+    static constexpr std::size_t smc_maxLevels = 2;
+
+    std::array<ResIdOwner_t, smc_maxLevels> m_levels;
+};
+
 } // namespace osp
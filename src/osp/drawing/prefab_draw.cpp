@@ -38,6 +38,33 @@ using namespace osp::draw;
 
 using osp::restypes::gc_importer;
 
+/**
+ * @brief Append a spawn batch's DrawEnts to a Material in two grouped writes
+ *
+ * One ranged insert into the dirty vector and one sequential pass over the entity bitset,
+ * instead of a dirty push and a bit toggle interleaved with the rest of each entity's setup.
+ * DrawEnts of a batch are created with consecutive ids, so the bit writes land contiguously.
+ */
+static void assign_material_batch(
+        ACtxSceneRender&            rScnRender,
+        MaterialId const            material,
+        std::vector<DrawEnt> const& matEnts)
+{
+    if (material == lgrn::id_null<MaterialId>() || matEnts.empty())
+    {
+        return;
+    }
+
+    Material &rMat = rScnRender.m_materials[material];
+
+    rMat.m_dirty.insert(rMat.m_dirty.end(), matEnts.begin(), matEnts.end());
+
+    for (DrawEnt const drawEnt : matEnts)
+    {
+        rMat.m_ents.set(drawEnt.value);
+    }
+}
+
 void SysPrefabDraw::init_drawents(
         ACtxPrefabs&                rPrefabs,
         Resources&                  rResources,
@@ -45,7 +72,27 @@ void SysPrefabDraw::init_drawents(
         ACtxDrawing&                rDrawing,
         ACtxSceneRender&            rScnRender)
 {
-    auto itPfEnts = rPrefabs.spawnedEntsOffset.begin();
+    // Count mesh-bearing objects first so all DrawEnts are created with one ranged call,
+    // amortizing the registry's bitvector bookkeeping over the whole spawn batch
+    std::size_t needed = 0;
+
+    for (TmpPrefabRequest const& request : rPrefabs.spawnRequest)
+    {
+        auto const &rImportData = rResources.data_get<osp::ImporterData const>(gc_importer, request.m_importerRes);
+        auto const &rPrefabData = rResources.data_get<osp::Prefabs const>     (gc_importer, request.m_importerRes);
+        auto const objects      = rPrefabData.m_prefabs[request.m_prefabId];
+
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            needed += (rImportData.m_objMeshes[objects[i]] != -1);
+        }
+    }
+
+    std::vector<DrawEnt> newDrawEnts(needed);
+    rScnRender.m_drawIds.create(newDrawEnts.begin(), newDrawEnts.end());
+
+    auto itDrawEnt = newDrawEnts.cbegin();
+    auto itPfEnts  = rPrefabs.spawnedEntsOffset.begin();
 
     for (TmpPrefabRequest const& request : rPrefabs.spawnRequest)
     {
@@ -63,7 +110,8 @@ void SysPrefabDraw::init_drawents(
             }
 
             ActiveEnt const ent = ents[i];
-            rScnRender.m_activeToDraw[ent] = rScnRender.m_drawIds.create();
+            rScnRender.m_activeToDraw[ent] = *itDrawEnt;
+            ++itDrawEnt;
         }
 
         ++itPfEnts;
@@ -117,6 +165,10 @@ void SysPrefabDraw::init_mesh_texture_material(
 {
     auto itPfEnts = rPrefabs.spawnedEntsOffset.begin();
 
+    // Material assignment is deferred and appended in one go after the loop; per-entity
+    // push_backs into the shared dirty vector are the hottest scattered writes of a big spawn
+    std::vector<DrawEnt> matEnts;
+
     for (TmpPrefabRequest const& request : rPrefabs.spawnRequest)
     {
         auto const &rImportData = rResources.data_get<osp::ImporterData const>(gc_importer, request.m_importerRes);
@@ -157,7 +209,7 @@ void SysPrefabDraw::init_mesh_texture_material(
 
             osp::ResId const meshRes = rImportData.m_meshes[meshImportId];
             MeshId const meshId = SysRender::own_mesh_resource(rDrawing, rDrawingRes, rResources, meshRes);
-            rScnRender.m_mesh[drawEnt] = rDrawing.m_meshRefCounts.ref_add(meshId);
+            rScnRender.hot[drawEnt].mesh = rDrawing.m_meshRefCounts.ref_add(meshId);
             rScnRender.m_meshDirty.push_back(drawEnt);
 
             int const matImportId = rImportData.m_objMaterials[objects[i]];
@@ -181,25 +233,28 @@ void SysPrefabDraw::init_mesh_texture_material(
 
             if (material != lgrn::id_null<MaterialId>())
             {
-                rScnRender.m_materials[material].m_dirty.push_back(drawEnt);
-                rScnRender.m_materials[material].m_ents.set(drawEnt.value);
+                matEnts.push_back(drawEnt);
             }
         }
 
         ++itPfEnts;
     }
+
+    assign_material_batch(rScnRender, material, matEnts);
 }
 
 
 void SysPrefabDraw::resync_mesh_texture_material(
         ACtxPrefabs&                rPrefabs,
         Resources&                  rResources,
-        ACtxBasic const&            rBasic,
+        ACtxBasic&                  rBasic,
         ACtxDrawing&                rDrawing,
         ACtxDrawingRes&             rDrawingRes,
         ACtxSceneRender&            rScnRender,
         MaterialId                  material)
 {
+    std::vector<DrawEnt> matEnts;
+
     for (std::size_t const rootInt : rPrefabs.roots.ones())
     {
         auto const root = ActiveEnt::from_index(rootInt);
@@ -229,7 +284,7 @@ void SysPrefabDraw::resync_mesh_texture_material(
 
             osp::ResId const meshRes = rImportData.m_meshes[meshImportId];
             MeshId const meshId = SysRender::own_mesh_resource(rDrawing, rDrawingRes, rResources, meshRes);
-            rScnRender.m_mesh[drawEnt] = rDrawing.m_meshRefCounts.ref_add(meshId);
+            rScnRender.hot[drawEnt].mesh = rDrawing.m_meshRefCounts.ref_add(meshId);
             rScnRender.m_meshDirty.push_back(drawEnt);
 
             int const matImportId = rImportData.m_objMaterials[objects[rPrefabs.instanceInfo[ent].obj]];
@@ -253,9 +308,10 @@ void SysPrefabDraw::resync_mesh_texture_material(
 
             if (material != lgrn::id_null<MaterialId>())
             {
-                rScnRender.m_materials[material].m_dirty.push_back(drawEnt);
-                rScnRender.m_materials[material].m_ents.set(drawEnt.value);
+                matEnts.push_back(drawEnt);
             }
         }
     }
+
+    assign_material_batch(rScnRender, material, matEnts);
 }
@@ -65,7 +65,7 @@ public:
     static void resync_mesh_texture_material(
             ACtxPrefabs&                rPrefabs,
             Resources&                  rResources,
-            ACtxBasic const&            rBasic,
+            ACtxBasic&                  rBasic,
             ACtxDrawing&                rDrawing,
             ACtxDrawingRes&             rDrawingRes,
             ACtxSceneRender&            rScnRender,
@@ -0,0 +1,262 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "weld_merge.h"
+#include "drawing_fn.h"
+#include "own_restypes.h"
+
+#include "../activescene/basic_fn.h"
+#include "../core/Resources.h"
+
+#include <Magnum/MeshTools/Concatenate.h>
+#include <Magnum/MeshTools/Transform.h>
+#include <Magnum/Trade/MeshData.h>
+
+#include <string>
+
+using namespace osp;
+using namespace osp::active;
+using namespace osp::draw;
+
+using Magnum::Trade::MeshData;
+
+void SysWeldMerge::merge_weld(
+        WeldId const                weld,
+        ACtxParts const&            rScnParts,
+        ACtxBasic&                  rBasic,
+        ACtxDrawing&                rDrawing,
+        ACtxDrawingRes&             rDrawingRes,
+        Resources&                  rResources,
+        PkgId const                 pkg,
+        ACtxSceneRender&            rScnRender,
+        ACtxWeldMerge&              rWeldMerge)
+{
+    ActiveEnt const root = rScnParts.weldToActive[weld];
+    if (   root == lgrn::id_null<ActiveEnt>()
+        || rWeldMerge.merged.contains(weld) )
+    {
+        return;
+    }
+
+    // Gather visible drawables below the weld root that share the first one's material and
+    // diffuse texture; anything else (indicators, plumes, odd-material parts) keeps its own
+    // draw. Transforms are composed up the parent chain into weld-root space.
+
+    struct TmpMember
+    {
+        DrawEnt drawEnt;
+        Matrix4 tf;
+    };
+    std::vector<TmpMember> gathered;
+
+    MaterialId  groupMat    {lgrn::id_null<MaterialId>()};
+    TexId       groupTex    {lgrn::id_null<TexId>()};
+    bool        groupSet    {false};
+
+    for (ActiveEnt const ent : SysSceneGraph::descendants(rBasic.m_scnGraph, root))
+    {
+        if (std::size_t(ent) >= rScnRender.m_activeToDraw.size())
+        {
+            continue;
+        }
+
+        DrawEnt const drawEnt = rScnRender.m_activeToDraw[ent];
+        if (   drawEnt == lgrn::id_null<DrawEnt>()
+            || ! rScnRender.m_visible.test(drawEnt.value)
+            || ! rScnRender.hot[drawEnt].mesh.has_value() )
+        {
+            continue;
+        }
+
+        Matrix4 tf;
+        bool chainOk = true;
+        for (ActiveEnt ancestor = ent; ancestor != root;
+             ancestor = rBasic.m_scnGraph.m_entParent[ancestor])
+        {
+            if (   ancestor == lgrn::id_null<ActiveEnt>()
+                || ! rBasic.m_transform.contains(ancestor) )
+            {
+                chainOk = false;
+                break;
+            }
+            tf = rBasic.m_transform.get(ancestor).m_transform * tf;
+        }
+        if ( ! chainOk)
+        {
+            continue;
+        }
+
+        MaterialId entMat {lgrn::id_null<MaterialId>()};
+        for (uint32_t const matInt : rScnRender.m_materialIds.bitview().zeros())
+        {
+            Material const &rMat = rScnRender.m_materials[MaterialId(matInt)];
+            if (   drawEnt.value < rMat.m_ents.size()
+                && rMat.m_ents.test(drawEnt.value) )
+            {
+                entMat = MaterialId(matInt);
+                break;
+            }
+        }
+
+        TexId const entTex = rScnRender.m_diffuseTex[drawEnt].has_value()
+                           ? rScnRender.m_diffuseTex[drawEnt].value()
+                           : lgrn::id_null<TexId>();
+
+        if ( ! groupSet)
+        {
+            groupMat = entMat;
+            groupTex = entTex;
+            groupSet = true;
+        }
+        else if (entMat != groupMat || entTex != groupTex)
+        {
+            continue;
+        }
+
+        gathered.push_back({drawEnt, tf});
+    }
+
+    // Bake member meshes transformed into weld-root space. Scene-only meshes with no backing
+    // resource data can't be baked and keep their own draws.
+
+    std::vector<MeshData>   pieces;
+    std::vector<DrawEnt>    baked;
+    pieces.reserve(gathered.size());
+    baked .reserve(gathered.size());
+    {
+        auto const meshView = rResources.data_view<MeshData const>(restypes::gc_mesh);
+
+        for (TmpMember const& member : gathered)
+        {
+            MeshId const meshId = rScnRender.hot[member.drawEnt].mesh.value();
+
+            auto const foundIt = rDrawingRes.m_meshToRes.find(meshId);
+            if (foundIt == rDrawingRes.m_meshToRes.end())
+            {
+                continue;
+            }
+
+            MeshData const *pMeshData = meshView[foundIt->second.value()];
+            if (pMeshData == nullptr)
+            {
+                continue;
+            }
+
+            pieces.push_back(Magnum::MeshTools::transform3D(*pMeshData, member.tf));
+            baked .push_back(member.drawEnt);
+        }
+    } // meshView's shared lock must end before the baked resource is created below
+
+    if (baked.size() < 2)
+    {
+        return; // Nothing gained by replacing one draw with one draw
+    }
+
+    // Add the combined mesh as a new resource and draw it from the weld root entity
+
+    ResId const bakedRes = rResources.create(restypes::gc_mesh, pkg,
+            SharedString::create_from_parts("bakedweld:", std::to_string(weld),
+                                            ":", std::to_string(rWeldMerge.bakeSerial++)));
+    rResources.data_add<MeshData>(restypes::gc_mesh, bakedRes,
+            Magnum::MeshTools::concatenate(arrayView(pieces.data(), pieces.size())));
+
+    DrawEnt const mergedEnt = rScnRender.m_drawIds.create();
+    rScnRender.resize_draw();
+
+    LGRN_ASSERT(rScnRender.m_activeToDraw[root] == lgrn::id_null<DrawEnt>());
+    rScnRender.m_activeToDraw[root] = mergedEnt;
+    SysRender::needs_draw_transforms(rBasic.m_scnGraph, rScnRender.m_needDrawTf, root);
+
+    MeshId const mergedMesh = SysRender::own_mesh_resource(rDrawing, rDrawingRes, rResources, bakedRes);
+    rScnRender.hot[mergedEnt].mesh = rDrawing.m_meshRefCounts.ref_add(mergedMesh);
+    rScnRender.m_meshDirty.push_back(mergedEnt);
+
+    if (groupTex != lgrn::id_null<TexId>())
+    {
+        rScnRender.m_diffuseTex[mergedEnt] = rDrawing.m_texRefCounts.ref_add(groupTex);
+        rScnRender.m_diffuseDirty.push_back(mergedEnt);
+    }
+
+    rScnRender.m_opaque .set(mergedEnt.value);
+    rScnRender.m_visible.set(mergedEnt.value);
+
+    if (groupMat != lgrn::id_null<MaterialId>())
+    {
+        Material &rMat = rScnRender.m_materials[groupMat];
+        rMat.m_ents.set(mergedEnt.value);
+        rMat.m_dirty.push_back(mergedEnt);
+    }
+
+    // Hide the members and remember them for re-expansion on a structural edit
+
+    ACtxWeldMerge::MergedWeld record{.mergedEnt = mergedEnt, .rootEnt = root};
+    record.members.reserve(baked.size());
+
+    for (DrawEnt const member : baked)
+    {
+        rScnRender.m_visible.reset(member.value);
+        record.members.emplace_back(member, rScnRender.m_drawEntGen[member]);
+    }
+
+    rWeldMerge.merged.emplace(weld, std::move(record));
+}
+
+
+void SysWeldMerge::expand_weld(
+        WeldId const                weld,
+        ACtxSceneRender&            rScnRender,
+        ACtxWeldMerge&              rWeldMerge,
+        DrawEntVec_t&               rDrawEntDel)
+{
+    auto const foundIt = rWeldMerge.merged.find(weld);
+    if (foundIt == rWeldMerge.merged.end())
+    {
+        return;
+    }
+    ACtxWeldMerge::MergedWeld const &rRecord = foundIt->second;
+
+    for (auto const& [member, gen] : rRecord.members)
+    {
+        // Skip members whose id was deleted or remapped since the merge
+        if (   rScnRender.m_drawIds.exists(member)
+            && rScnRender.m_drawEntGen[member] == gen )
+        {
+            rScnRender.m_visible.set(member.value);
+        }
+    }
+
+    rScnRender.m_visible.reset(rRecord.mergedEnt.value);
+    rScnRender.m_opaque .reset(rRecord.mergedEnt.value);
+
+    if (   std::size_t(rRecord.rootEnt) < rScnRender.m_activeToDraw.size()
+        && rScnRender.m_activeToDraw[rRecord.rootEnt] == rRecord.mergedEnt )
+    {
+        rScnRender.m_activeToDraw[rRecord.rootEnt] = lgrn::id_null<DrawEnt>();
+    }
+
+    // The drawing delete tasks release the combined mesh/texture owners and free the id
+    rDrawEntDel.push_back(rRecord.mergedEnt);
+
+    rWeldMerge.merged.erase(foundIt);
+}
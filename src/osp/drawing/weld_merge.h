@@ -0,0 +1,119 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "drawing.h"
+#include "../activescene/basic.h"
+#include "../activescene/vehicles.h"
+#include "../core/resourcetypes.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace osp::draw
+{
+
+/**
+ * @brief Per-weld state for merged (baked) static geometry
+ *
+ * A rigid weld renders one DrawEnt per member part even though none of them ever move relative
+ * to each other. SysWeldMerge bakes matching member meshes into one combined mesh drawn from
+ * the weld's root entity, and remembers the member DrawEnts so a structural edit can re-expand
+ * them into individual draws again.
+ */
+struct ACtxWeldMerge
+{
+    struct MergedWeld
+    {
+        /// Member DrawEnts hidden while merged, paired with their
+        /// ACtxSceneRender::m_drawEntGen value at merge time so stale handles are detected
+        std::vector< std::pair<DrawEnt, std::uint8_t> > members;
+
+        DrawEnt             mergedEnt   {lgrn::id_null<DrawEnt>()};
+        active::ActiveEnt   rootEnt     {lgrn::id_null<active::ActiveEnt>()};
+    };
+
+    IdMap_t<active::WeldId, MergedWeld> merged;
+
+    /// Appended to baked mesh resource names so re-baking a weld never collides with the
+    /// previous bake still owned by the renderer
+    std::uint32_t bakeSerial {0};
+};
+
+/**
+ * @brief Bakes rigid welds' member part meshes into single combined draws
+ *
+ * Not driven by any task automatically; the scene decides when a weld is settled enough to
+ * bake (eg. once docking completes) and when an edit requires expanding it again.
+ */
+class SysWeldMerge
+{
+    using ACtxBasic = osp::active::ACtxBasic;
+    using ActiveEnt = osp::active::ActiveEnt;
+    using ACtxParts = osp::active::ACtxParts;
+    using WeldId    = osp::active::WeldId;
+public:
+
+    /**
+     * @brief Merge a weld's member part meshes into one combined mesh on the weld root entity
+     *
+     * Members below the weld root that share the first drawable's material and diffuse texture
+     * are concatenated in weld-root space; the baked result is added as a new mesh resource in
+     * \p pkg and assigned to a new DrawEnt on the root, and the member DrawEnts are hidden.
+     * Members with a different material or texture keep their own draws. No-op unless at least
+     * two members can merge, and no-op if the weld is already merged; expand it first to
+     * re-bake after a structural edit.
+     *
+     * Must not be called while any ResDataView of the mesh resource type is alive, as adding
+     * the baked resource takes the type's unique lock.
+     */
+    static void merge_weld(
+            WeldId                      weld,
+            ACtxParts const&            rScnParts,
+            ACtxBasic&                  rBasic,
+            ACtxDrawing&                rDrawing,
+            ACtxDrawingRes&             rDrawingRes,
+            Resources&                  rResources,
+            PkgId                       pkg,
+            ACtxSceneRender&            rScnRender,
+            ACtxWeldMerge&              rWeldMerge);
+
+    /**
+     * @brief Re-expand a merged weld into its individual member draws
+     *
+     * Restores visibility of the recorded member DrawEnts (skipping any whose generation no
+     * longer matches) and queues the combined DrawEnt into \p rDrawEntDel; the regular drawing
+     * delete tasks release its mesh/texture owners and free the id. No-op if not merged.
+     */
+    static void expand_weld(
+            WeldId                      weld,
+            ACtxSceneRender&            rScnRender,
+            ACtxWeldMerge&              rWeldMerge,
+            DrawEntVec_t&               rDrawEntDel);
+
+}; // class SysWeldMerge
+
+} // namespace osp::draw
@@ -23,6 +23,7 @@
  * SOFTWARE.
  */
 #include "FullscreenTriShader.h"
+#include "program_cache.h"
 
 #include <Magnum/GL/Version.h>
 #include <Magnum/GL/Shader.h>
@@ -32,19 +33,33 @@
 #include <Corrade/Containers/Iterable.h>  // for Containers::Iterable
 #include <Corrade/Containers/Reference.h>
 
+#include <string>
+
 using namespace osp;
 using namespace Magnum;
 
 FullscreenTriShader::FullscreenTriShader()
 {
-    GL::Shader vert{GL::Version::GL430, GL::Shader::Type::Vertex};
-    GL::Shader frag{GL::Version::GL430, GL::Shader::Type::Fragment};
-    vert.addFile("OSPData/adera/Shaders/FullscreenTri.vert");
-    frag.addFile("OSPData/adera/Shaders/FullscreenTri.frag");
-
-    CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile() && frag.compile());
-    attachShaders({vert, frag});
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    using namespace std::string_view_literals;
+
+    constexpr auto vertPath = "OSPData/adera/Shaders/FullscreenTri.vert"sv;
+    constexpr auto fragPath = "OSPData/adera/Shaders/FullscreenTri.frag"sv;
+
+    // Skip the driver's GLSL compile when a binary cached by a previous launch still matches
+    if ( ! GlProgramCache::try_load(*this, "FullscreenTri", {vertPath, fragPath}))
+    {
+        GL::Shader vert{GL::Version::GL430, GL::Shader::Type::Vertex};
+        GL::Shader frag{GL::Version::GL430, GL::Shader::Type::Fragment};
+        vert.addFile(std::string{vertPath});
+        frag.addFile(std::string{fragPath});
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile() && frag.compile());
+        attachShaders({vert, frag});
+        GlProgramCache::set_retrievable_hint(*this);
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        GlProgramCache::store(*this, "FullscreenTri", {vertPath, fragPath});
+    }
 
     setUniform(static_cast<Int>(EUniformPos::FramebufferSampler),
         static_cast<Int>(ETextureSlot::Framebuffer));
@@ -0,0 +1,84 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ImposterShader.h"
+#include "program_cache.h"
+
+#include <Magnum/GL/Version.h>
+#include <Magnum/GL/Shader.h>
+#include <Magnum/GL/Texture.h>
+
+// used by attachShaders
+#include <Corrade/Containers/Iterable.h>  // for Containers::Iterable
+#include <Corrade/Containers/Reference.h>
+
+#include <string>
+
+using namespace osp;
+using namespace Magnum;
+
+ImposterShader::ImposterShader()
+{
+    using namespace std::string_view_literals;
+
+    constexpr auto vertPath = "OSPData/adera/Shaders/Imposter.vert"sv;
+    constexpr auto fragPath = "OSPData/adera/Shaders/Imposter.frag"sv;
+
+    if ( ! GlProgramCache::try_load(*this, "Imposter", {vertPath, fragPath}))
+    {
+        GL::Shader vert{GL::Version::GL430, GL::Shader::Type::Vertex};
+        GL::Shader frag{GL::Version::GL430, GL::Shader::Type::Fragment};
+        vert.addFile(std::string{vertPath});
+        frag.addFile(std::string{fragPath});
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile() && frag.compile());
+        attachShaders({vert, frag});
+        GlProgramCache::set_retrievable_hint(*this);
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        GlProgramCache::store(*this, "Imposter", {vertPath, fragPath});
+    }
+
+    setUniform(static_cast<Int>(EUniformPos::AtlasSampler),
+        static_cast<Int>(ETextureSlot::Atlas));
+}
+
+ImposterShader& ImposterShader::set_view_proj(Matrix4 const& viewProj)
+{
+    setUniform(static_cast<Int>(EUniformPos::ViewProj), viewProj);
+    return *this;
+}
+
+ImposterShader& ImposterShader::set_cam_axes(Vector3 const& right, Vector3 const& up)
+{
+    setUniform(static_cast<Int>(EUniformPos::CamRight), right);
+    setUniform(static_cast<Int>(EUniformPos::CamUp), up);
+    return *this;
+}
+
+ImposterShader& ImposterShader::bind_atlas(GL::Texture2D& rTex)
+{
+    rTex.bind(static_cast<Int>(ETextureSlot::Atlas));
+    return *this;
+}
@@ -0,0 +1,90 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <Magnum/GL/AbstractShaderProgram.h>
+#include <Magnum/GL/Attribute.h>
+#include <Magnum/Math/Matrix4.h>
+
+namespace osp
+{
+
+/**
+ * @brief Draws camera-facing textured quads for a whole batch of imposters in
+ *        one instanced call
+ */
+class ImposterShader : public Magnum::GL::AbstractShaderProgram
+{
+public:
+    // Vertex attribs
+    typedef Magnum::GL::Attribute<0, Magnum::Vector2> Position;
+
+    // Per-instance attribs
+    typedef Magnum::GL::Attribute<1, Magnum::Vector3> InstancePosition;
+    typedef Magnum::GL::Attribute<2, Magnum::Float>   InstanceRadius;
+    typedef Magnum::GL::Attribute<3, Magnum::Vector4> InstanceUvRect;
+
+    // Outputs
+    enum class EOutputs : Magnum::UnsignedInt
+    {
+        ColorOutput = 0
+    };
+
+    ImposterShader();
+
+    using AbstractShaderProgram::AbstractShaderProgram;
+
+    ImposterShader& set_view_proj(Magnum::Matrix4 const& viewProj);
+
+    /**
+     * Set the camera-space right and up axes the quads are spanned along
+     */
+    ImposterShader& set_cam_axes(Magnum::Vector3 const& right,
+                                 Magnum::Vector3 const& up);
+
+    ImposterShader& bind_atlas(Magnum::GL::Texture2D& rTex);
+
+private:
+    // Uniforms
+    enum class EUniformPos : Magnum::Int
+    {
+        ViewProj        = 0, // mat4, spans locations 0..3
+        CamRight        = 4,
+        CamUp           = 5,
+        AtlasSampler    = 6
+    };
+
+    // Texture2D slots
+    enum class ETextureSlot : Magnum::Int
+    {
+        Atlas = 0
+    };
+
+    // Hide irrelevant calls
+    using Magnum::GL::AbstractShaderProgram::drawTransformFeedback;
+    using Magnum::GL::AbstractShaderProgram::dispatchCompute;
+};
+
+} // namespace osp
@@ -0,0 +1,360 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "imposter.h"
+
+#include <Magnum/GL/Renderer.h>
+#include <Magnum/GL/RenderbufferFormat.h>
+#include <Magnum/GL/TextureFormat.h>
+
+#include <Magnum/Math/Color.h>
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/ArrayViewStl.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace osp;
+using namespace osp::draw;
+
+using Magnum::GL::Renderer;
+
+// Matches ImposterShader's per-instance attributes
+struct ImposterInstance
+{
+    Vector3 position;
+    float   radius;
+    Vector4 uvRect;
+};
+
+/**
+ * @brief Conservative world-space bound radius; same as SysRender::cull_draw_ents
+ */
+static float world_radius(ACtxSceneRender const& rCtxScnRdr, DrawEnt const drawEnt) noexcept
+{
+    DrawEntHot const& hotEnt = rCtxScnRdr.hot[drawEnt];
+
+    float const radius = hotEnt.boundRadius;
+    Matrix4 const& drawTf = hotEnt.drawTf;
+    float const scaleSq = std::max({ drawTf[0].xyz().dot(),
+                                     drawTf[1].xyz().dot(),
+                                     drawTf[2].xyz().dot() });
+    return radius * std::sqrt(scaleSq);
+}
+
+/**
+ * @brief Create the atlas, quad mesh, and shader; first call only, render thread
+ */
+static void ensure_gl(ACtxImposters& rImposters)
+{
+    using Magnum::GL::Framebuffer;
+
+    if (rImposters.glReady)
+    {
+        return;
+    }
+
+    constexpr Vector2i size{ACtxImposters::smc_atlasSizePx};
+
+    rImposters.atlasTex = Magnum::GL::Texture2D{};
+    rImposters.atlasTex
+            .setStorage(1, Magnum::GL::TextureFormat::RGBA8, size)
+            .setMinificationFilter(Magnum::GL::SamplerFilter::Linear)
+            .setMagnificationFilter(Magnum::GL::SamplerFilter::Linear)
+            .setWrapping(Magnum::GL::SamplerWrapping::ClampToEdge);
+
+    rImposters.atlasDepth = Magnum::GL::Renderbuffer{};
+    rImposters.atlasDepth.setStorage(
+            Magnum::GL::RenderbufferFormat::DepthComponent24, size);
+
+    rImposters.atlasFbo = Framebuffer{Magnum::Range2Di{{0, 0}, size}};
+    rImposters.atlasFbo
+            .attachTexture(Framebuffer::ColorAttachment{0}, rImposters.atlasTex, 0)
+            .attachRenderbuffer(Framebuffer::BufferAttachment::Depth,
+                                rImposters.atlasDepth);
+
+    static constexpr std::array<Vector2, 4> sc_quadCorners
+    {
+        Vector2{-1.0f, -1.0f}, Vector2{ 1.0f, -1.0f},
+        Vector2{-1.0f,  1.0f}, Vector2{ 1.0f,  1.0f}
+    };
+
+    rImposters.quadVerts = Magnum::GL::Buffer{};
+    rImposters.quadVerts.setData(sc_quadCorners);
+
+    rImposters.instanceBuf = Magnum::GL::Buffer{};
+
+    rImposters.quad = Magnum::GL::Mesh{};
+    rImposters.quad
+            .setPrimitive(Magnum::GL::MeshPrimitive::TriangleStrip)
+            .setCount(4)
+            .addVertexBuffer(rImposters.quadVerts, 0,
+                             ImposterShader::Position{})
+            .addVertexBufferInstanced(rImposters.instanceBuf, 1, 0,
+                             ImposterShader::InstancePosition{},
+                             ImposterShader::InstanceRadius{},
+                             ImposterShader::InstanceUvRect{});
+
+    rImposters.shader = ImposterShader{};
+
+    rImposters.glReady = true;
+}
+
+void SysImposters::select(
+        ACtxImposters&              rImposters,
+        ACtxSceneRender const&      rCtxScnRdr,
+        ViewProjMatrix const&       viewProj,
+        DrawEntSet_t const&         visibleIn)
+{
+    bitvector_resize(rImposters.viewVisible, visibleIn.size());
+    std::copy(visibleIn.ints().begin(), visibleIn.ints().end(),
+              rImposters.viewVisible.ints().begin());
+
+    rImposters.captureQueue.clear();
+    rImposters.drawList.clear();
+    ++ rImposters.frame;
+
+    if (rImposters.slotFree.empty() && rImposters.entToSlot.empty())
+    {
+        // Empty free list with no slot in use only happens before the first run
+        rImposters.slotFree.reserve(ACtxImposters::smc_slotCount);
+        for (std::uint32_t i = 0; i < ACtxImposters::smc_slotCount; ++i)
+        {
+            rImposters.slotFree.push_back(i);
+        }
+    }
+
+    Vector3 const camPos = viewProj.m_view.invertedRigid().translation();
+
+    for (std::size_t const entInt : visibleIn.ones())
+    {
+        auto const drawEnt = DrawEnt(entInt);
+
+        float const radius = rCtxScnRdr.hot[drawEnt].boundRadius;
+        if (radius <= 0.0f)
+        {
+            continue; // No known bounds; never drawn as an imposter
+        }
+
+        float const worldRadius = world_radius(rCtxScnRdr, drawEnt);
+        Vector3 const pos = rCtxScnRdr.hot[drawEnt].drawTf.translation();
+
+        float const depth = -viewProj.m_view.transformPoint(pos).z();
+        if (depth <= rImposters.depthRatio * worldRadius)
+        {
+            continue; // Near enough for a real mesh (or its last LOD)
+        }
+
+        std::uint32_t slotIdx;
+        if (auto const it = rImposters.entToSlot.find(drawEnt);
+            it != rImposters.entToSlot.end())
+        {
+            slotIdx = it->second;
+        }
+        else if ( ! rImposters.slotFree.empty())
+        {
+            slotIdx = rImposters.slotFree.back();
+            rImposters.slotFree.pop_back();
+            rImposters.entToSlot.emplace(drawEnt, slotIdx);
+            rImposters.slots[slotIdx] = ImposterSlot{ .ent = drawEnt };
+        }
+        else
+        {
+            continue; // Atlas full; keep drawing the mesh
+        }
+
+        ImposterSlot &rSlot = rImposters.slots[slotIdx];
+        rSlot.lastSeen = rImposters.frame;
+
+        Vector3 const dir = (camPos - pos).normalized();
+        if (   ! rSlot.captured
+            || Magnum::Math::dot(dir, rSlot.capturedDir) < rImposters.recaptureDotMin)
+        {
+            rImposters.captureQueue.push_back(slotIdx);
+        }
+
+        if (rSlot.captured)
+        {
+            // A possibly stale tile beats popping; uncaptured slots keep their mesh
+            // until capture gets to them
+            rImposters.viewVisible.reset(entInt);
+            rImposters.drawList.push_back(slotIdx);
+        }
+    }
+
+    // Free slots of entities that left imposter range or visibility this frame
+    for (auto it = rImposters.entToSlot.begin(); it != rImposters.entToSlot.end();)
+    {
+        if (rImposters.slots[it->second].lastSeen != rImposters.frame)
+        {
+            rImposters.slots[it->second] = ImposterSlot{};
+            rImposters.slotFree.push_back(it->second);
+            it = rImposters.entToSlot.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void SysImposters::capture(
+        ACtxImposters&              rImposters,
+        RenderGL&                   rRenderGl,
+        RenderGroup&                rGroup,
+        ACtxSceneRender const&      rCtxScnRdr,
+        ViewProjMatrix const&       viewProj)
+{
+    using Magnum::GL::FramebufferClear;
+
+    if (rImposters.captureQueue.empty())
+    {
+        return;
+    }
+
+    ensure_gl(rImposters);
+
+    // Same pass state as render_opaque; draw functions assume it
+    Renderer::enable(Renderer::Feature::DepthTest);
+    Renderer::enable(Renderer::Feature::FaceCulling);
+    Renderer::disable(Renderer::Feature::Blending);
+    Renderer::setDepthMask(GL_TRUE);
+    Renderer::enable(Renderer::Feature::ScissorTest);
+
+    Vector3 const camPos = viewProj.m_view.invertedRigid().translation();
+
+    rImposters.atlasFbo.bind();
+
+    std::size_t const count = std::min(rImposters.captureQueue.size(),
+                                       ACtxImposters::smc_capturesPerFrame);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::uint32_t const slotIdx = rImposters.captureQueue[i];
+        ImposterSlot &rSlot = rImposters.slots[slotIdx];
+        DrawEnt const drawEnt = rSlot.ent;
+
+        if ( ! rGroup.entities.contains(drawEnt))
+        {
+            continue; // Not in this group (wrong material); stays drawn as a mesh
+        }
+
+        float const worldRadius = world_radius(rCtxScnRdr, drawEnt);
+        Vector3 const pos = rCtxScnRdr.hot[drawEnt].drawTf.translation();
+        Vector3 const dir = (camPos - pos).normalized();
+
+        // Orthographic camera looking at the entity along the current view direction,
+        // backed off so the whole bounding sphere lands in [near, far]
+        Vector3 const up = (std::abs(dir.y()) < 0.99f) ? Vector3::yAxis()
+                                                       : Vector3::xAxis();
+        Matrix4 const camTf = Matrix4::lookAt(pos + dir * (2.0f * worldRadius), pos, up);
+        ViewProjMatrix const tileViewProj
+        {
+            camTf.invertedRigid(),
+            Matrix4::orthographicProjection(Vector2{2.0f * worldRadius},
+                                            0.5f * worldRadius, 3.5f * worldRadius)
+        };
+
+        Vector2i const tile{int(slotIdx) % ACtxImposters::smc_tilesPerRow,
+                            int(slotIdx) / ACtxImposters::smc_tilesPerRow};
+        Magnum::Range2Di const rect = Magnum::Range2Di::fromSize(
+                tile * ACtxImposters::smc_tileSizePx,
+                Vector2i{ACtxImposters::smc_tileSizePx});
+
+        rImposters.atlasFbo.setViewport(rect);
+        Renderer::setScissor(rect);
+        rImposters.atlasFbo.clearColor(0, Magnum::Color4{0.0f});
+        rImposters.atlasFbo.clear(FramebufferClear::Depth);
+
+        // Pass constants cached per program are stale under a different viewProj
+        rRenderGl.m_bindCache.reset();
+
+        EntityToDraw const &toDraw = rGroup.entities.get(drawEnt);
+        toDraw.draw(drawEnt, tileViewProj, toDraw.data);
+
+        rSlot.captured      = true;
+        rSlot.capturedDir   = dir;
+    }
+
+    Renderer::disable(Renderer::Feature::ScissorTest);
+
+    // Back to the main offscreen target; its stored viewport re-applies on bind
+    rRenderGl.m_fbo.bind();
+    rRenderGl.m_bindCache.reset();
+}
+
+void SysImposters::draw_imposters(
+        ACtxImposters&              rImposters,
+        ACtxSceneRender const&      rCtxScnRdr,
+        ViewProjMatrix const&       viewProj)
+{
+    if (rImposters.drawList.empty())
+    {
+        return;
+    }
+
+    // drawList entries all have captured tiles, so ensure_gl has already run
+
+    constexpr float tileUv = 1.0f / float(ACtxImposters::smc_tilesPerRow);
+    // Sampling inset by one texel keeps Linear filtering from bleeding neighbor tiles
+    constexpr float inset  = 1.0f / float(ACtxImposters::smc_atlasSizePx);
+
+    std::vector<ImposterInstance> instances;
+    instances.reserve(rImposters.drawList.size());
+
+    for (std::uint32_t const slotIdx : rImposters.drawList)
+    {
+        DrawEnt const drawEnt = rImposters.slots[slotIdx].ent;
+
+        Vector2 const tile{float(int(slotIdx) % ACtxImposters::smc_tilesPerRow),
+                           float(int(slotIdx) / ACtxImposters::smc_tilesPerRow)};
+
+        instances.push_back(ImposterInstance{
+            .position   = rCtxScnRdr.hot[drawEnt].drawTf.translation(),
+            .radius     = world_radius(rCtxScnRdr, drawEnt),
+            .uvRect     = Vector4{tile.x() * tileUv + inset,
+                                  tile.y() * tileUv + inset,
+                                  tileUv - 2.0f * inset,
+                                  tileUv - 2.0f * inset}});
+    }
+
+    rImposters.instanceBuf.setData(
+            Corrade::Containers::arrayView(instances.data(), instances.size()),
+            Magnum::GL::BufferUsage::DynamicDraw);
+    rImposters.quad.setInstanceCount(Magnum::Int(instances.size()));
+
+    // Quads are unsorted and alpha-tested in the shader, so plain opaque state works
+    // and depth writes keep them valid occluders
+    Renderer::enable(Renderer::Feature::DepthTest);
+    Renderer::disable(Renderer::Feature::FaceCulling);
+    Renderer::disable(Renderer::Feature::Blending);
+    Renderer::setDepthMask(GL_TRUE);
+
+    rImposters.shader
+            .set_view_proj(viewProj.m_viewProj)
+            .set_cam_axes(viewProj.m_view.row(0).xyz(),
+                          viewProj.m_view.row(1).xyz())
+            .bind_atlas(rImposters.atlasTex);
+    rImposters.shader.draw(rImposters.quad);
+}
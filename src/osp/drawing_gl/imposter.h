@@ -0,0 +1,184 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "rendergl.h"
+#include "ImposterShader.h"
+
+#include <Magnum/GL/Buffer.h>
+#include <Magnum/GL/Framebuffer.h>
+#include <Magnum/GL/Mesh.h>
+#include <Magnum/GL/Renderbuffer.h>
+#include <Magnum/GL/Texture.h>
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace osp::draw
+{
+
+/**
+ * @brief One atlas tile holding a captured view of a distant entity
+ */
+struct ImposterSlot
+{
+    DrawEnt         ent             {lgrn::id_null<DrawEnt>()};
+
+    /// Unit vector from the entity towards the camera when the tile was last
+    /// rendered; compared against the current direction to trigger re-captures
+    Vector3         capturedDir;
+
+    /// Frame counter value when the entity last qualified as an imposter; slots
+    /// not seen this frame are freed
+    std::uint64_t   lastSeen        {0};
+
+    bool            captured        {false};
+};
+
+/**
+ * @brief Imposter rendering state for one rendered view
+ *
+ * Past the last simplified mesh level an entity covers a pixel or two, but a fleet of them
+ * still costs a draw call each. Entities beyond depthRatio times their bound radius are
+ * instead rendered once into a tile of a shared offscreen atlas, removed from the view's
+ * visible set, and drawn as camera-facing quads sampling their tile in a single instanced
+ * call; per-frame cost stays constant however many distant craft exist. Tiles are only
+ * re-rendered when the view direction to the entity drifts past a threshold, a few per
+ * frame at most. Disabled by default.
+ */
+struct ACtxImposters
+{
+    /// Atlas side length and tile side length, in pixels
+    static constexpr int            smc_atlasSizePx     = 1024;
+    static constexpr int            smc_tileSizePx      = 64;
+    static constexpr int            smc_tilesPerRow     = smc_atlasSizePx / smc_tileSizePx;
+    static constexpr std::size_t    smc_slotCount       = std::size_t(smc_tilesPerRow)
+                                                        * std::size_t(smc_tilesPerRow);
+    /// Most tiles (re-)rendered per frame; the rest stay stale one more frame
+    static constexpr std::size_t    smc_capturesPerFrame = 4;
+
+    bool                            enabled             {false};
+
+    /// View depth over world bound radius beyond which an entity draws as an imposter.
+    /// Should sit past the last mesh LOD threshold in SysRenderGL::select_mesh_lods.
+    float                           depthRatio          {512.0f};
+
+    /// Cosine of the entity-to-camera direction change that forces a re-capture
+    float                           recaptureDotMin     {0.985f};
+
+    /// Per-view output of SysImposters::select: the input visible set minus
+    /// entities drawn as imposters this frame
+    DrawEntSet_t                    viewVisible;
+
+    // GL objects, created on the render thread the first time select runs enabled
+    Magnum::GL::Texture2D           atlasTex            {Corrade::NoCreate};
+    Magnum::GL::Renderbuffer        atlasDepth          {Corrade::NoCreate};
+    Magnum::GL::Framebuffer         atlasFbo            {Corrade::NoCreate};
+    Magnum::GL::Mesh                quad                {Corrade::NoCreate};
+    Magnum::GL::Buffer              quadVerts           {Corrade::NoCreate};
+    Magnum::GL::Buffer              instanceBuf         {Corrade::NoCreate};
+    ImposterShader                  shader              {Corrade::NoCreate};
+    bool                            glReady             {false};
+
+    std::array<ImposterSlot, smc_slotCount>     slots;
+    std::unordered_map<DrawEnt, std::uint32_t>  entToSlot;
+    std::vector<std::uint32_t>                  slotFree;
+
+    /// Slots needing a (re-)capture, rebuilt each frame by select and consumed
+    /// oldest-request-first by capture up to smc_capturesPerFrame
+    std::vector<std::uint32_t>                  captureQueue;
+
+    /// Slots drawn as quads this frame, rebuilt each frame by select
+    std::vector<std::uint32_t>                  drawList;
+
+    std::uint64_t                               frame   {0};
+};
+
+/**
+ * @brief Imposter functions; see ACtxImposters
+ */
+class SysImposters
+{
+public:
+
+    /**
+     * @brief Assign atlas slots to beyond-LOD entities and clear their visible bits
+     *
+     * Starts from the given visible set, writing the reduced set to viewVisible. Entities
+     * keep drawing as meshes until their first capture completes, and fall back to meshes
+     * when the atlas is full. Also frees slots of entities no longer distant or visible,
+     * and queues captures for new slots and stale view angles.
+     *
+     * @param rImposters    [ref] Imposter state
+     * @param rCtxScnRdr    [in] Scene render context with transforms and bounds
+     * @param viewProj      [in] View and projection matrix
+     * @param visibleIn     [in] Visible set to reduce, already frustum/occlusion culled
+     */
+    static void select(
+            ACtxImposters&              rImposters,
+            ACtxSceneRender const&      rCtxScnRdr,
+            ViewProjMatrix const&       viewProj,
+            DrawEntSet_t const&         visibleIn);
+
+    /**
+     * @brief Render queued entities into their atlas tiles, a few per frame
+     *
+     * Each capture draws the entity alone through its RenderGroup draw function under a
+     * per-entity orthographic camera looking along the current view direction. Call before
+     * the opaque pass; leaves the offscreen FBO in rRenderGl bound again on return.
+     *
+     * @param rImposters    [ref] Imposter state
+     * @param rRenderGl     [ref] Renderer state; the offscreen FBO is re-bound after
+     * @param rGroup        [ref] RenderGroup holding the entities' draw functions
+     * @param rCtxScnRdr    [in] Scene render context with transforms and bounds
+     * @param viewProj      [in] Current view matrices, used for capture directions
+     */
+    static void capture(
+            ACtxImposters&              rImposters,
+            RenderGL&                   rRenderGl,
+            RenderGroup&                rGroup,
+            ACtxSceneRender const&      rCtxScnRdr,
+            ViewProjMatrix const&       viewProj);
+
+    /**
+     * @brief Draw all captured imposters as camera-facing quads in one instanced call
+     *
+     * Call after the opaque pass into the same FBO. Quads alpha-test instead of blend, so
+     * they write depth and stay valid occluder sources for the depth readback.
+     *
+     * @param rImposters    [ref] Imposter state
+     * @param rCtxScnRdr    [in] Scene render context with transforms and bounds
+     * @param viewProj      [in] View and projection matrix
+     */
+    static void draw_imposters(
+            ACtxImposters&              rImposters,
+            ACtxSceneRender const&      rCtxScnRdr,
+            ViewProjMatrix const&       viewProj);
+
+};
+
+} // namespace osp::draw
@@ -0,0 +1,200 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "occlusion.h"
+
+#include <Magnum/GL/Buffer.h>
+#include <Magnum/GL/PixelFormat.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace osp;
+using namespace osp::draw;
+
+// Window-depth slack added to every tile test; absorbs depth buffer quantization and small
+// movement within the readback's frames of latency
+static constexpr float sc_depthMargin = 1.0e-4f;
+
+void SysHiZOcclusion::apply_cull(
+        ACtxHiZOcclusion const&     rOcclusion,
+        ACtxSceneRender const&      rCtxScnRdr,
+        DrawEntSet_t&               rViewVisible)
+{
+    bitvector_resize(rViewVisible, rCtxScnRdr.m_visible.size());
+    std::copy(rCtxScnRdr.m_visible.ints().begin(), rCtxScnRdr.m_visible.ints().end(),
+              rViewVisible.ints().begin());
+
+    if ( ! rOcclusion.gridValid)
+    {
+        return; // No depth resolved yet; everything stays visible
+    }
+
+    Matrix4 const&  view    = rOcclusion.gridView;
+    Matrix4 const&  proj    = rOcclusion.gridProj;
+    Vector2i const  grid    = rOcclusion.gridSize;
+
+    for (std::size_t const entInt : rCtxScnRdr.m_visible.ones())
+    {
+        auto const drawEnt = DrawEnt(entInt);
+
+        DrawEntHot const& hotEnt = rCtxScnRdr.hot[drawEnt];
+
+        float const radius = hotEnt.boundRadius;
+        if (radius <= 0.0f)
+        {
+            continue; // No known bounds; never occlusion culled
+        }
+
+        Matrix4 const& drawTf = hotEnt.drawTf;
+
+        // Same conservative world radius as SysRender::cull_draw_ents
+        float const scaleSq = std::max({ drawTf[0].xyz().dot(),
+                                         drawTf[1].xyz().dot(),
+                                         drawTf[2].xyz().dot() });
+        float const worldRadius = radius * std::sqrt(scaleSq);
+
+        Vector3 const viewPos   = view.transformPoint(drawTf.translation());
+        float const   depth     = -viewPos.z();
+        float const   depthNear = depth - worldRadius; // Depth of the sphere's nearest point
+
+        if (depthNear <= 0.0f)
+        {
+            continue; // Encloses or sits behind the camera; can't be behind an occluder
+        }
+
+        // Window depth of the nearest point; anything drawn in front of every part of the
+        // sphere must be nearer than this
+        float const winZ = (proj[2][2] * (viewPos.z() + worldRadius) + proj[3][2])
+                         / depthNear * 0.5f + 0.5f;
+
+        // Conservative NDC footprint. Dividing the extents by the nearest depth, with the
+        // |x|/|y| terms covering off-axis spheres, provably over-covers the true projection
+        float const ndcX  = proj[0][0] * viewPos.x() / depth;
+        float const ndcY  = proj[1][1] * viewPos.y() / depth;
+        float const halfX = proj[0][0] * worldRadius * (depth + std::abs(viewPos.x()))
+                          / (depth * depthNear);
+        float const halfY = proj[1][1] * worldRadius * (depth + std::abs(viewPos.y()))
+                          / (depth * depthNear);
+
+        // Tile rectangle covered, in [0, 1] screen space
+        float const sx0 = (ndcX - halfX) * 0.5f + 0.5f;
+        float const sx1 = (ndcX + halfX) * 0.5f + 0.5f;
+        float const sy0 = (ndcY - halfY) * 0.5f + 0.5f;
+        float const sy1 = (ndcY + halfY) * 0.5f + 0.5f;
+
+        if (sx0 < 0.0f || sx1 > 1.0f || sy0 < 0.0f || sy1 > 1.0f)
+        {
+            continue; // Reaches off-screen, where there is no depth to test against
+        }
+
+        int const tx0 = std::clamp(int(sx0 * float(grid.x())), 0, grid.x() - 1);
+        int const tx1 = std::clamp(int(sx1 * float(grid.x())), 0, grid.x() - 1);
+        int const ty0 = std::clamp(int(sy0 * float(grid.y())), 0, grid.y() - 1);
+        int const ty1 = std::clamp(int(sy1 * float(grid.y())), 0, grid.y() - 1);
+
+        bool occluded = true;
+        for (int ty = ty0; occluded && (ty <= ty1); ++ty)
+        {
+            float const *pRow = &rOcclusion.tileMaxDepth[std::size_t(ty) * grid.x()];
+            for (int tx = tx0; tx <= tx1; ++tx)
+            {
+                if (winZ <= pRow[tx] + sc_depthMargin)
+                {
+                    occluded = false;
+                    break;
+                }
+            }
+        }
+
+        if (occluded)
+        {
+            rViewVisible.reset(entInt);
+        }
+    }
+}
+
+void SysHiZOcclusion::update_depth(
+        RenderGL&                   rRenderGl,
+        ACtxHiZOcclusion&           rOcclusion,
+        ViewProjMatrix const&       viewProj)
+{
+    using namespace Magnum;
+
+    constexpr int tile = ACtxHiZOcclusion::smc_tileSizePx;
+
+    std::uint32_t const slot = rOcclusion.slotWrite;
+    GL::BufferImage2D   &rImage = rOcclusion.readback[slot];
+
+    // Resolve the read issued into this slot smc_slots frames ago; by now the GPU has long
+    // finished it and the map below won't stall
+    if (rOcclusion.pending[slot])
+    {
+        Vector2i const size = rOcclusion.pendingSize[slot];
+        Vector2i const grid{(size.x() + tile - 1) / tile, (size.y() + tile - 1) / tile};
+
+        rOcclusion.tileMaxDepth.assign(std::size_t(grid.product()), 0.0f);
+
+        auto const data = rImage.buffer().map(
+                0, std::size_t(size.product()) * sizeof(float), GL::Buffer::MapFlag::Read);
+        auto const *pDepth = reinterpret_cast<float const*>(data.data());
+
+        for (int y = 0; y < size.y(); ++y)
+        {
+            float const *pSrcRow  = pDepth + std::size_t(y) * size.x();
+            float       *pTileRow = &rOcclusion.tileMaxDepth[std::size_t(y / tile) * grid.x()];
+
+            for (int x = 0; x < size.x(); ++x)
+            {
+                float &rMax = pTileRow[x / tile];
+                rMax = std::max(rMax, pSrcRow[x]);
+            }
+        }
+
+        rImage.buffer().unmap();
+
+        rOcclusion.gridSize     = grid;
+        rOcclusion.gridView     = rOcclusion.pendingView[slot];
+        rOcclusion.gridProj     = rOcclusion.pendingProj[slot];
+        rOcclusion.gridValid    = true;
+        rOcclusion.pending[slot] = false;
+    }
+
+    // Issue the next asynchronous depth read of the whole offscreen FBO
+    Range2Di const viewport = rRenderGl.m_fbo.viewport();
+
+    if (rImage.buffer().id() == 0)
+    {
+        rImage = GL::BufferImage2D{GL::PixelFormat::DepthComponent, GL::PixelType::Float};
+    }
+
+    rRenderGl.m_fbo.read(viewport, rImage, GL::BufferUsage::DynamicRead);
+
+    rOcclusion.pendingView[slot] = viewProj.m_view;
+    rOcclusion.pendingProj[slot] = viewProj.m_proj;
+    rOcclusion.pendingSize[slot] = viewport.size();
+    rOcclusion.pending[slot]     = true;
+
+    rOcclusion.slotWrite = (slot + 1) % ACtxHiZOcclusion::smc_slots;
+}
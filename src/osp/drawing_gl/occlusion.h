@@ -0,0 +1,132 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "rendergl.h"
+
+#include <Magnum/GL/BufferImage.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace osp::draw
+{
+
+/**
+ * @brief Depth-based occlusion culling state for one rendered view
+ *
+ * Station interiors render every room behind every wall without this; depth testing rejects
+ * the fragments, but each hidden entity still costs a full draw call. This reuses the opaque
+ * pass itself as the occluder depth source: after the pass, the FBO depth buffer is read back
+ * asynchronously through a small ring of pixel buffers, max-reduced on the CPU into a coarse
+ * tile grid, and entities whose bounding sphere sits entirely behind the farthest depth of
+ * every tile it covers are dropped from the next frame's visible set.
+ *
+ * The depth grid lags the camera by the readback ring depth, so fast cuts can over- or
+ * under-cull for a couple of frames; the test is otherwise conservative (tiles keep their
+ * farthest depth, sphere footprints are over-estimated, and unbounded or partially
+ * off-screen entities always pass). Disabled by default.
+ */
+struct ACtxHiZOcclusion
+{
+    /// Side length of one depth tile in pixels; the reduced grid is what the sphere tests walk
+    static constexpr int            smc_tileSizePx  = 16;
+    /// Readback ring depth; each buffer is mapped this many frames after its read is issued
+    static constexpr std::size_t    smc_slots       = 2;
+
+    bool                            enabled         {false};
+
+    /// Per-view output of SysHiZOcclusion::apply_cull: the scene's visible set minus
+    /// occluded entities. Only meaningful for the view the depth grid was rendered from.
+    DrawEntSet_t                    viewVisible;
+
+    // Ring of depth readbacks in flight, with the matrices each was rendered under
+    std::array<Magnum::GL::BufferImage2D, smc_slots> readback
+    {
+        Magnum::GL::BufferImage2D{Corrade::NoCreate},
+        Magnum::GL::BufferImage2D{Corrade::NoCreate}
+    };
+    std::array<bool,     smc_slots> pending         {};
+    std::array<Matrix4,  smc_slots> pendingView;
+    std::array<Matrix4,  smc_slots> pendingProj;
+    std::array<Vector2i, smc_slots> pendingSize;
+    std::uint32_t                   slotWrite       {0};
+
+    /// Farthest window-space depth per tile of the most recently resolved readback,
+    /// row-major gridSize.x() by gridSize.y(). Tiles containing any background pixel
+    /// hold the far plane and never occlude.
+    std::vector<float>              tileMaxDepth;
+    Vector2i                        gridSize;
+
+    // View and projection the resolved grid was rendered under; sphere tests must use
+    // these, not the current frame's camera
+    Matrix4                         gridView;
+    Matrix4                         gridProj;
+    bool                            gridValid       {false};
+};
+
+/**
+ * @brief Occlusion culling functions; see ACtxHiZOcclusion
+ */
+class SysHiZOcclusion
+{
+public:
+
+    /**
+     * @brief Fill a per-view visible set, clearing bits of entities behind the depth grid
+     *
+     * Starts from ACtxSceneRender::m_visible like SysRender::cull_draw_ents. Entities with
+     * no bounding radius, enclosing the camera, or reaching off-screen always pass. Before
+     * the first readback resolves, the scene set is copied through unchanged.
+     *
+     * @param rOcclusion    [in] Resolved depth grid to test against
+     * @param rCtxScnRdr    [in] Scene render context with visibility, transforms, and bounds
+     * @param rViewVisible  [out] Subset of m_visible that survives the occlusion test
+     */
+    static void apply_cull(
+            ACtxHiZOcclusion const&     rOcclusion,
+            ACtxSceneRender const&      rCtxScnRdr,
+            DrawEntSet_t&               rViewVisible);
+
+    /**
+     * @brief Resolve the oldest in-flight depth readback and issue a new one
+     *
+     * Call right after the opaque pass while the offscreen FBO still holds its depth. The
+     * resolved buffer is max-reduced into tileMaxDepth; the new read is asynchronous and
+     * will not stall the pipeline.
+     *
+     * @param rRenderGl     [ref] Renderer state holding the offscreen FBO
+     * @param rOcclusion    [ref] Occlusion state
+     * @param viewProj      [in] Matrices the pass just rendered under
+     */
+    static void update_depth(
+            RenderGL&                   rRenderGl,
+            ACtxHiZOcclusion&           rOcclusion,
+            ViewProjMatrix const&       viewProj);
+
+};
+
+} // namespace osp::draw
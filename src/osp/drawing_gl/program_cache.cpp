@@ -0,0 +1,171 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2021 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "program_cache.h"
+
+#include "../util/logging.h"
+
+#include <Magnum/GL/AbstractShaderProgram.h>
+#include <Magnum/GL/Context.h>
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using osp::GlProgramCache;
+
+static constexpr std::string_view gc_cacheDir = "OSPCache/shaders";
+
+// FNV-1a, matching the collider change stamps; cheap and stable across platforms
+static constexpr std::uint64_t fnv1a_bytes(
+        std::string_view const bytes, std::uint64_t hash) noexcept
+{
+    for (char const c : bytes)
+    {
+        hash ^= std::uint64_t(static_cast<unsigned char>(c));
+        hash *= 0x00000100000001B3ul;
+    }
+    return hash;
+}
+
+// Key combines the driver's identity with the shader sources; a driver update or source
+// edit lands on a different file name, so stale binaries simply miss
+static std::uint64_t cache_key(
+        std::string_view const                          name,
+        std::initializer_list<std::string_view> const   sourceFiles)
+{
+    auto const& ctx = Magnum::GL::Context::current();
+
+    std::uint64_t hash = 0xCBF29CE484222325ul;
+    hash = fnv1a_bytes(ctx.vendorString(),   hash);
+    hash = fnv1a_bytes(ctx.rendererString(), hash);
+    hash = fnv1a_bytes(ctx.versionString(),  hash);
+    hash = fnv1a_bytes(name,                 hash);
+
+    for (std::string_view const path : sourceFiles)
+    {
+        std::ifstream file{std::filesystem::path{path}, std::ios::binary};
+        std::string const contents{std::istreambuf_iterator<char>{file}, {}};
+        hash = fnv1a_bytes(contents, hash);
+    }
+
+    return hash;
+}
+
+static std::filesystem::path cache_path(
+        std::string_view const name, std::uint64_t const key)
+{
+    std::array<char, 16> hex;
+    auto const [pEnd, ec] = std::to_chars(hex.data(), hex.data() + hex.size(), key, 16);
+
+    std::string fileName{name};
+    fileName += '-';
+    fileName.append(hex.data(), pEnd);
+    fileName += ".bin";
+
+    return std::filesystem::path{gc_cacheDir} / fileName;
+}
+
+void GlProgramCache::set_retrievable_hint(
+        Magnum::GL::AbstractShaderProgram const& program)
+{
+    glProgramParameteri(program.id(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+bool GlProgramCache::try_load(
+        Magnum::GL::AbstractShaderProgram&              rProgram,
+        std::string_view const                          name,
+        std::initializer_list<std::string_view> const   sourceFiles)
+{
+    GLint numFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    if (numFormats <= 0)
+    {
+        return false; // Driver exposes no binary formats
+    }
+
+    std::ifstream file{cache_path(name, cache_key(name, sourceFiles)), std::ios::binary};
+    if ( ! file.is_open())
+    {
+        return false; // Miss; first launch, or driver/source changed
+    }
+
+    std::uint32_t format = 0;
+    file.read(reinterpret_cast<char*>(&format), sizeof(format));
+    std::vector<char> const binary{std::istreambuf_iterator<char>{file}, {}};
+    if (binary.empty())
+    {
+        return false; // Truncated cache file
+    }
+
+    glProgramBinary(rProgram.id(), GLenum(format), binary.data(), GLsizei(binary.size()));
+
+    // The driver validates the blob itself and fails the link for binaries it can no
+    // longer run (eg. same driver strings but changed compiler internals)
+    GLint status = GL_FALSE;
+    glGetProgramiv(rProgram.id(), GL_LINK_STATUS, &status);
+    return status == GL_TRUE;
+}
+
+void GlProgramCache::store(
+        Magnum::GL::AbstractShaderProgram const&        program,
+        std::string_view const                          name,
+        std::initializer_list<std::string_view> const   sourceFiles)
+{
+    GLint length = 0;
+    glGetProgramiv(program.id(), GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return; // Driver keeps no retrievable binary for this program
+    }
+
+    std::vector<char> binary(std::size_t(length));
+    GLenum  format  = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program.id(), length, &written, &format, binary.data());
+    if (written <= 0)
+    {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(gc_cacheDir, ec);
+
+    auto const path = cache_path(name, cache_key(name, sourceFiles));
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    if ( ! file.is_open())
+    {
+        OSP_LOG_WARN("Can't write shader binary cache file: {}", path.string());
+        return;
+    }
+
+    std::uint32_t const format32 = format;
+    file.write(reinterpret_cast<char const*>(&format32), sizeof(format32));
+    file.write(binary.data(), written);
+}
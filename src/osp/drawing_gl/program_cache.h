@@ -0,0 +1,82 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2021 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <Magnum/GL/GL.h>
+
+#include <initializer_list>
+#include <string_view>
+
+namespace osp
+{
+
+/**
+ * @brief Disk cache of linked GL program binaries, keyed by driver and source
+ *
+ * The first launch compiles shaders from GLSL and stores their glGetProgramBinary blobs
+ * under OSPCache/shaders; later launches load them with glProgramBinary and skip the
+ * driver's compile entirely. Cache files are keyed by a hash of the driver's vendor,
+ * renderer, and version strings plus the shader source contents, so a driver update or
+ * source edit misses and falls back to compiling. Only usable by in-repo shader classes;
+ * Magnum's builtin shaders link inside their constructors and cannot be seeded.
+ */
+class GlProgramCache
+{
+public:
+
+    /**
+     * @brief Hint the driver to keep a retrievable binary; call after attaching shaders,
+     *        before linking
+     */
+    static void set_retrievable_hint(Magnum::GL::AbstractShaderProgram const& program);
+
+    /**
+     * @brief Try to link a not-yet-linked program object from a cached binary
+     *
+     * @param rProgram      [ref] Program object with no shaders attached yet
+     * @param name          [in] Stable name distinguishing programs with the same sources
+     * @param sourceFiles   [in] Paths of the GLSL sources the program is built from
+     *
+     * @return true if a matching cached binary linked successfully; false means the caller
+     *         must compile from source (and should store() afterwards)
+     */
+    static bool try_load(
+            Magnum::GL::AbstractShaderProgram&          rProgram,
+            std::string_view                            name,
+            std::initializer_list<std::string_view>     sourceFiles);
+
+    /**
+     * @brief Store a linked program's binary for following launches
+     *
+     * Failures (driver exposes no binary formats, cache dir not writable) only warn;
+     * the program itself is unaffected.
+     */
+    static void store(
+            Magnum::GL::AbstractShaderProgram const&    program,
+            std::string_view                            name,
+            std::initializer_list<std::string_view>     sourceFiles);
+};
+
+} // namespace osp
@@ -47,6 +47,14 @@
 #include <Magnum/Mesh.h>
 #include <Magnum/MeshTools/Compile.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 using Magnum::Trade::MeshData;
 using Magnum::Trade::TextureData;
 using Magnum::Trade::ImageData2D;
@@ -61,6 +69,7 @@ using osp::draw::RenderGL;
 
 using osp::draw::TexGlId;
 using osp::draw::MeshGlId;
+using osp::draw::DrawEnt;
 
 void SysRenderGL::setup_context(RenderGL& rCtxGl)
 {
@@ -107,21 +116,186 @@ void SysRenderGL::setup_context(RenderGL& rCtxGl)
         rCtxGl.m_fbo.attachTexture(GL::Framebuffer::ColorAttachment{0}, rFboColor, 0);
         rCtxGl.m_fbo.attachRenderbuffer(GL::Framebuffer::BufferAttachment::DepthStencil, rCtxGl.m_fboDepthStencil);
     }
+
+    /* Create GL_TIME_ELAPSED query rings for per-pass GPU timing */
+    for (GpuPassTimer* pTimer : {&rCtxGl.m_timeOpaque,
+                                 &rCtxGl.m_timeTransparent,
+                                 &rCtxGl.m_timeDisplay})
+    {
+        for (GL::TimeQuery &rQuery : pTimer->m_queries)
+        {
+            rQuery = GL::TimeQuery{GL::TimeQuery::Target::TimeElapsed};
+        }
+    }
+}
+
+void osp::draw::GpuPassTimer::begin()
+{
+    // Poll finished queries, oldest first, into the rolling history. Results lag a few
+    // frames behind; never block on them
+    while (m_pending[m_queryRead])
+    {
+        Magnum::GL::TimeQuery &rQuery = m_queries[m_queryRead];
+        if ( ! rQuery.resultAvailable())
+        {
+            break;
+        }
+
+        m_historyMs[m_historyNext] = float(rQuery.result<Magnum::UnsignedLong>()) * 1.0e-6f;
+        m_historyNext  = (m_historyNext + 1) % smc_historySize;
+        m_historyCount = std::min<std::uint32_t>(m_historyCount + 1, smc_historySize);
+
+        m_pending[m_queryRead] = false;
+        m_queryRead = (m_queryRead + 1) % smc_queryRing;
+    }
+
+    // If the GPU is so far behind that the whole ring is in flight, skip timing this frame
+    // instead of stalling or overwriting an unread query
+    if ( ! m_pending[m_queryWrite])
+    {
+        m_queries[m_queryWrite].begin();
+    }
+}
+
+void osp::draw::GpuPassTimer::end()
+{
+    if ( ! m_pending[m_queryWrite])
+    {
+        m_queries[m_queryWrite].end();
+        m_pending[m_queryWrite] = true;
+        m_queryWrite = (m_queryWrite + 1) % smc_queryRing;
+    }
+}
+
+float osp::draw::GpuPassTimer::average_ms() const noexcept
+{
+    if (m_historyCount == 0)
+    {
+        return 0.0f;
+    }
+
+    float total = 0.0f;
+    for (std::uint32_t i = 0; i < m_historyCount; ++i)
+    {
+        total += m_historyMs[i];
+    }
+    return total / float(m_historyCount);
+}
+
+// Create or re-create the GL texture of a resource; returns its approximate GPU size in bytes
+static std::size_t compile_texture(
+        osp::ResDataView<osp::TextureImgSource const, TextureData const> const& texView,
+        osp::ResDataView<ImageData2D const> const&  imgView,
+        ResId const         texRes,
+        TexGlId const       texGl,
+        RenderGL&           rRenderGl)
+{
+    using namespace osp;
+    using Magnum::GL::textureFormat;
+
+    ResId const imgRes = *texView.get<TextureImgSource const>(texRes);
+    auto const &texData = *texView.get<TextureData const>(texRes);
+    auto const &imgData = *imgView[imgRes];
+
+    if (texData.type() != Magnum::Trade::TextureType::Texture2D)
+    {
+        // Can't use Resources::name here; it would lock gc_texture under texView's lock
+        OSP_LOG_WARN("Unsupported texture type for texture ResId: {}", std::size_t(texRes));
+        return 0;
+    }
+
+    Texture2D texture;
+    texture.setMinificationFilter(texData.minificationFilter(),
+                                  texData.mipmapFilter())
+           .setMagnificationFilter(texData.magnificationFilter())
+           .setWrapping(texData.wrapping().xy());
+
+    if (imgData.isCompressed())
+    {
+        // Block-compressed images (eg: transcoded KTX2/BasisU) upload as-is, with no CPU
+        // decode and a fraction of the bandwidth and VRAM of uncompressed pixels
+        texture.setStorage(1, textureFormat(imgData.compressedFormat()), imgData.size());
+        storage_assign(rRenderGl.m_texGl, texGl, std::make_optional(std::move(texture)));
+        rRenderGl.m_texGl.get(texGl).setCompressedSubImage(
+                0, {}, Magnum::CompressedImageView2D{imgData});
+    }
+    else
+    {
+        texture.setStorage(1, textureFormat(imgData.format()), imgData.size());
+        storage_assign(rRenderGl.m_texGl, texGl, std::make_optional(std::move(texture)));
+
+        if (rRenderGl.m_uploadQueue != nullptr)
+        {
+            // Contents are undefined until the staged pixel data is finished
+            rRenderGl.m_uploadQueue->enqueue_texture(texGl, imgData);
+        }
+        else
+        {
+            rRenderGl.m_texGl.get(texGl).setSubImage(0, {}, imgData);
+        }
+    }
+
+    return imgData.data().size();
+}
+
+// Create or re-create the GL mesh of a resource; returns its approximate GPU size in bytes
+static std::size_t compile_mesh(
+        MeshData const&     meshData,
+        MeshGlId const      meshGl,
+        RenderGL&           rRenderGl)
+{
+    using namespace osp;
+
+    if (rRenderGl.m_uploadQueue != nullptr)
+    {
+        // Placeholder draws nothing until the staged vertex data is finished
+        storage_assign(rRenderGl.m_meshGl, meshGl, std::make_optional<Mesh>());
+        rRenderGl.m_uploadQueue->enqueue_mesh(meshGl, meshData);
+    }
+    else
+    {
+        storage_assign(rRenderGl.m_meshGl, meshGl,
+                       std::make_optional(Magnum::MeshTools::compile(meshData)));
+    }
+
+    return meshData.vertexData().size()
+         + (meshData.isIndexed() ? meshData.indexData().size() : 0);
+}
+
+// Stamp a freshly compiled resource as resident and account for its GPU bytes
+static void track_compiled(
+        osp::draw::GlResourceUse&   rUse,
+        std::size_t const           sizeBytes,
+        RenderGL&                   rRenderGl)
+{
+    rUse.lastUsedFrame  = rRenderGl.m_residencyFrame;
+    rUse.sizeBytes      = sizeBytes;
+    rUse.resident       = true;
+    rRenderGl.m_residentBytes += sizeBytes;
 }
 
 void SysRenderGL::compile_resource_textures(
         ACtxDrawingRes const&   rCtxDrawRes,
         Resources&              rResources,
+        ACtxSceneRenderGL&      rScnRenderGl,
         RenderGL&               rRenderGl)
 {
     // TODO: Eventually have dirty flags instead of checking every entry.
 
+    // Keep ResId lookups on the flat no-hashing path
+    rRenderGl.m_resToTex.reserve_dense(rResources.ids(restypes::gc_texture).capacity());
+
+    // First pass: find unsynchronized resources and register GL ids and owners for them.
+    // owner_create takes the type's unique lock, so this must finish before the data views
+    // below take their shared locks.
+    std::vector< std::pair<ResId, TexGlId> > newlyAdded;
+
     for ([[maybe_unused]] auto const & [_, scnOwner] : rCtxDrawRes.m_texToRes)
     {
         ResId const texRes = scnOwner.value();
 
         // New element will be emplaced if it isn't present yet
-        auto const [it, success] = rRenderGl.m_resToTex.try_emplace(texRes);
+        auto const [pTexGl, success] = rRenderGl.m_resToTex.try_emplace(texRes);
         if ( ! success)
         {
             continue;
@@ -130,10 +304,6 @@ void SysRenderGL::compile_resource_textures(
         // New element emplaced, this means we've just found a resource that
         // isn't synchronized yet.
 
-        using Magnum::GL::SamplerWrapping;
-        using Magnum::GL::SamplerFilter;
-        using Magnum::GL::textureFormat;
-
         // Create new Texture GL Id
         TexGlId const newId = rRenderGl.m_texIds.create();
 
@@ -143,43 +313,67 @@ void SysRenderGL::compile_resource_textures(
 
         // Track with two-way map and store owner
         rRenderGl.m_texToRes.emplace(newId, std::move(renderOwner));
-        it->second = newId;
+        *pTexGl = newId;
 
-        ResId const imgRes = rResources.data_get<TextureImgSource>(restypes::gc_texture, texRes);
-        auto const &texData = rResources.data_get<TextureData>(restypes::gc_texture, texRes);
-        auto const &imgData = rResources.data_get<ImageData2D>(restypes::gc_image, imgRes);
+        newlyAdded.emplace_back(texRes, newId);
+    }
 
-        if (texData.type() != Magnum::Trade::TextureType::Texture2D)
-        {
+    // Count this scene once per resource, even when another scene already compiled it; the
+    // shared GL texture then outlives any single scene until the last one releases it
+    bitvector_resize(rScnRenderGl.m_texResUsed, rResources.ids(restypes::gc_texture).capacity());
+    rRenderGl.m_texGlScnRefs.resize(rRenderGl.m_texIds.capacity());
 
-            OSP_LOG_WARN("Unsupported texture type for texture resource: {}",
-                         rResources.name(restypes::gc_texture, texRes));
-            continue;
+    for ([[maybe_unused]] auto const & [_, scnOwner] : rCtxDrawRes.m_texToRes)
+    {
+        ResId const texRes = scnOwner.value();
+        if ( ! rScnRenderGl.m_texResUsed.test(std::size_t(texRes)))
+        {
+            rScnRenderGl.m_texResUsed.set(std::size_t(texRes));
+            ++ rRenderGl.m_texGlScnRefs[rRenderGl.m_resToTex.at(texRes)];
         }
+    }
+
+    if (newlyAdded.empty())
+    {
+        return;
+    }
+
+    rRenderGl.m_texUse.resize(rRenderGl.m_texIds.capacity());
+
+    // Second pass: compile under a single lock per type instead of per data_get call
+    auto const texView = rResources.data_view<TextureImgSource const, TextureData const>(restypes::gc_texture);
+    auto const imgView = rResources.data_view<ImageData2D const>(restypes::gc_image);
+
+    for (auto const& [texRes, newId] : newlyAdded)
+    {
+        std::size_t const sizeBytes = compile_texture(texView, imgView, texRes, newId, rRenderGl);
 
-        rRenderGl.m_texGl.emplace(newId)
-                .setMinificationFilter(texData.minificationFilter(),
-                                       texData.mipmapFilter())
-                .setMagnificationFilter(texData.magnificationFilter())
-                .setWrapping(texData.wrapping().xy())
-                .setStorage(1, textureFormat(imgData.format()), imgData.size())
-                .setSubImage(0, {}, imgData);
+        track_compiled(rRenderGl.m_texUse[newId], sizeBytes, rRenderGl);
     }
 }
 
 void SysRenderGL::compile_resource_meshes(
         ACtxDrawingRes const&   rCtxDrawRes,
         Resources&              rResources,
+        ACtxSceneRenderGL&      rScnRenderGl,
         RenderGL&               rRenderGl)
 {
     // TODO: Eventually have dirty flags instead of checking every entry.
 
+    // Keep ResId lookups on the flat no-hashing path
+    rRenderGl.m_resToMesh.reserve_dense(rResources.ids(restypes::gc_mesh).capacity());
+
+    // First pass: find unsynchronized resources and register GL ids and owners for them.
+    // owner_create takes the type's unique lock, so this must finish before the data view
+    // below takes its shared lock.
+    std::vector< std::pair<ResId, MeshGlId> > newlyAdded;
+
     for ([[maybe_unused]] auto const & [_, scnOwner] : rCtxDrawRes.m_meshToRes)
     {
         ResId const meshRes = scnOwner.value();
 
         // New element will be emplaced if it isn't present yet
-        auto const [it, success] = rRenderGl.m_resToMesh.try_emplace(meshRes);
+        auto const [pMeshGl, success] = rRenderGl.m_resToMesh.try_emplace(meshRes);
         if ( ! success)
         {
             continue;
@@ -197,25 +391,223 @@ void SysRenderGL::compile_resource_meshes(
 
         // Track with two-way map and store owner
         rRenderGl.m_meshToRes.emplace(newId, std::move(renderOwner));
-        it->second = newId;
+        *pMeshGl = newId;
+
+        newlyAdded.emplace_back(meshRes, newId);
+
+        // Register the import-time LOD chain alongside its full mesh, so the simplified
+        // levels compile, upload, and track residency like any other resource mesh
+        if (auto const *pLods = rResources.data_try_get<MeshLods const>(restypes::gc_mesh, meshRes);
+            pLods != nullptr)
+        {
+            std::array<MeshGlId, MeshLods::smc_maxLevels> lodGl;
+            lodGl.fill(lgrn::id_null<MeshGlId>());
+
+            for (std::size_t lvl = 0; lvl < MeshLods::smc_maxLevels; ++lvl)
+            {
+                ResIdOwner_t const &lodOwner = pLods->m_levels[lvl];
+                if ( ! lodOwner.has_value())
+                {
+                    continue;
+                }
+                ResId const lodRes = lodOwner.value();
+
+                auto const [pLodGl, lodAdded] = rRenderGl.m_resToMesh.try_emplace(lodRes);
+                if (lodAdded)
+                {
+                    MeshGlId const lodId = rRenderGl.m_meshIds.create();
+                    rRenderGl.m_meshToRes.emplace(
+                            lodId, rResources.owner_create(restypes::gc_mesh, lodRes));
+                    *pLodGl = lodId;
+                    newlyAdded.emplace_back(lodRes, lodId);
+                }
+                lodGl[lvl] = *pLodGl;
+            }
+
+            rRenderGl.m_meshGlLods.emplace(newId, lodGl);
+        }
+    }
+
+    // Count this scene once per resource, even when another scene already compiled it; the
+    // shared GL buffer then outlives any single scene until the last one releases it
+    bitvector_resize(rScnRenderGl.m_meshResUsed, rResources.ids(restypes::gc_mesh).capacity());
+    rRenderGl.m_meshGlScnRefs.resize(rRenderGl.m_meshIds.capacity());
+
+    auto const scene_count_mesh = [&rScnRenderGl, &rRenderGl] (ResId const res)
+    {
+        if ( ! rScnRenderGl.m_meshResUsed.test(std::size_t(res)))
+        {
+            rScnRenderGl.m_meshResUsed.set(std::size_t(res));
+            ++ rRenderGl.m_meshGlScnRefs[rRenderGl.m_resToMesh.at(res)];
+        }
+    };
+
+    for ([[maybe_unused]] auto const & [_, scnOwner] : rCtxDrawRes.m_meshToRes)
+    {
+        ResId const meshRes = scnOwner.value();
+        scene_count_mesh(meshRes);
+
+        // The import-time LOD chain rides along with its full-detail mesh
+        if (auto const *pLods = rResources.data_try_get<MeshLods const>(restypes::gc_mesh, meshRes);
+            pLods != nullptr)
+        {
+            for (ResIdOwner_t const &lodOwner : pLods->m_levels)
+            {
+                if (lodOwner.has_value())
+                {
+                    scene_count_mesh(lodOwner.value());
+                }
+            }
+        }
+    }
+
+    if (newlyAdded.empty())
+    {
+        return;
+    }
+
+    rRenderGl.m_meshUse.resize(rRenderGl.m_meshIds.capacity());
+
+    // Second pass: compile under a single lock instead of one per data_get call
+    auto const meshView = rResources.data_view<MeshData const>(restypes::gc_mesh);
+
+    for (auto const& [meshRes, newId] : newlyAdded)
+    {
+        std::size_t const sizeBytes = compile_mesh(*meshView[meshRes], newId, rRenderGl);
+
+        track_compiled(rRenderGl.m_meshUse[newId], sizeBytes, rRenderGl);
+    }
+}
+
+void SysRenderGL::touch_mesh(RenderGL& rRenderGl, MeshGlId const meshGl) noexcept
+{
+    if (std::size_t(meshGl) < rRenderGl.m_meshUse.size())
+    {
+        rRenderGl.m_meshUse[meshGl].lastUsedFrame = rRenderGl.m_residencyFrame;
+    }
+}
+
+void SysRenderGL::touch_texture(RenderGL& rRenderGl, TexGlId const texGl) noexcept
+{
+    if (std::size_t(texGl) < rRenderGl.m_texUse.size())
+    {
+        rRenderGl.m_texUse[texGl].lastUsedFrame = rRenderGl.m_residencyFrame;
+    }
+}
+
+void SysRenderGL::update_residency(RenderGL& rRenderGl, Resources& rResources)
+{
+    if (rRenderGl.m_residencyBudget == 0)
+    {
+        return; // Eviction disabled
+    }
 
-        // Get mesh data
-        auto const &meshData = rResources.data_get<MeshData>(restypes::gc_mesh, meshRes);
+    // Restore evicted resources that were touched again this frame
+    {
+        auto const meshView = rResources.data_view<MeshData const>(restypes::gc_mesh);
 
-        // Compile and store mesh
-        rRenderGl.m_meshGl.emplace(newId, Magnum::MeshTools::compile(meshData));
+        for (auto const& [meshGl, rOwner] : rRenderGl.m_meshToRes)
+        {
+            GlResourceUse &rUse = rRenderGl.m_meshUse[meshGl];
+            if ( ! rUse.resident && rUse.lastUsedFrame == rRenderGl.m_residencyFrame)
+            {
+                track_compiled(rUse, compile_mesh(*meshView[rOwner.value()], meshGl, rRenderGl),
+                               rRenderGl);
+            }
+        }
+    }
+    {
+        auto const texView = rResources.data_view<TextureImgSource const, TextureData const>(restypes::gc_texture);
+        auto const imgView = rResources.data_view<ImageData2D const>(restypes::gc_image);
+
+        for (auto const& [texGl, rOwner] : rRenderGl.m_texToRes)
+        {
+            GlResourceUse &rUse = rRenderGl.m_texUse[texGl];
+            if ( ! rUse.resident && rUse.lastUsedFrame == rRenderGl.m_residencyFrame)
+            {
+                track_compiled(rUse, compile_texture(texView, imgView, rOwner.value(), texGl, rRenderGl),
+                               rRenderGl);
+            }
+        }
+    }
+
+    ++rRenderGl.m_residencyFrame;
+
+    if (rRenderGl.m_residentBytes <= rRenderGl.m_residencyBudget)
+    {
+        return;
+    }
+
+    // Over budget; gather resident resources not drawn within the last frame. Anything newer
+    // may still be referenced by this frame's draws or a pending staged upload.
+    struct Candidate
+    {
+        std::uint64_t   lastUsedFrame;
+        MeshGlId        mesh    {lgrn::id_null<MeshGlId>()};
+        TexGlId         tex     {lgrn::id_null<TexGlId>()};
+    };
+    std::vector<Candidate> candidates;
+
+    for (auto const& [meshGl, rOwner] : rRenderGl.m_meshToRes)
+    {
+        GlResourceUse const &use = rRenderGl.m_meshUse[meshGl];
+        if (use.resident && use.sizeBytes != 0
+            && use.lastUsedFrame + 1 < rRenderGl.m_residencyFrame)
+        {
+            candidates.push_back({.lastUsedFrame = use.lastUsedFrame, .mesh = meshGl});
+        }
+    }
+    for (auto const& [texGl, rOwner] : rRenderGl.m_texToRes)
+    {
+        GlResourceUse const &use = rRenderGl.m_texUse[texGl];
+        if (use.resident && use.sizeBytes != 0
+            && use.lastUsedFrame + 1 < rRenderGl.m_residencyFrame)
+        {
+            candidates.push_back({.lastUsedFrame = use.lastUsedFrame, .tex = texGl});
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+              [] (Candidate const& lhs, Candidate const& rhs) noexcept
+    {
+        return lhs.lastUsedFrame < rhs.lastUsedFrame;
+    });
+
+    for (Candidate const& candidate : candidates)
+    {
+        if (rRenderGl.m_residentBytes <= rRenderGl.m_residencyBudget)
+        {
+            break;
+        }
+
+        // Replace the GL object with an empty one instead of removing the storage entry, so
+        // entities still referencing the id keep a valid (but invisible) mesh or texture
+        if (candidate.mesh != lgrn::id_null<MeshGlId>())
+        {
+            GlResourceUse &rUse = rRenderGl.m_meshUse[candidate.mesh];
+            rRenderGl.m_meshGl.get(candidate.mesh) = Mesh{};
+            rRenderGl.m_residentBytes -= rUse.sizeBytes;
+            rUse.resident = false;
+        }
+        else
+        {
+            GlResourceUse &rUse = rRenderGl.m_texUse[candidate.tex];
+            rRenderGl.m_texGl.get(candidate.tex) = Texture2D{};
+            rRenderGl.m_residentBytes -= rUse.sizeBytes;
+            rUse.resident = false;
+        }
     }
 }
 
 void SysRenderGL::sync_drawent_mesh(
         DrawEnt const                               ent,
-        KeyedVec<DrawEnt, MeshIdOwner_t> const&     cmpMeshIds,
+        DrawEntHots_t const&                        hot,
         IdMap_t<MeshId, ResIdOwner_t> const&        meshToRes,
         MeshGlEntStorage_t&                         rCmpMeshGl,
         RenderGL&                                   rRenderGl)
 {
     ACompMeshGl &rEntMeshGl = rCmpMeshGl[ent];
-    MeshIdOwner_t const& entMeshScnId = cmpMeshIds[ent];
+    MeshIdOwner_t const& entMeshScnId = hot[ent].mesh;
 
     // Make sure dirty entity has a MeshId component
     if (entMeshScnId.has_value())
@@ -236,6 +628,19 @@ void SysRenderGL::sync_drawent_mesh(
 
             // Mesh should have been loaded beforehand, assign it!
             rEntMeshGl.m_glId = rRenderGl.m_resToMesh.at(meshResId);
+
+            // Full mesh plus any simplified levels compiled from its import-time LOD chain
+            rEntMeshGl.m_glLods.fill(lgrn::id_null<MeshGlId>());
+            rEntMeshGl.m_glLods[0] = rEntMeshGl.m_glId;
+
+            if (auto const lodIt = rRenderGl.m_meshGlLods.find(rEntMeshGl.m_glId);
+                lodIt != rRenderGl.m_meshGlLods.end())
+            {
+                for (std::size_t lvl = 0; lvl < MeshLods::smc_maxLevels; ++lvl)
+                {
+                    rEntMeshGl.m_glLods[lvl + 1] = lodIt->second[lvl];
+                }
+            }
         }
         else
         {
@@ -307,6 +712,55 @@ void SysRenderGL::sync_drawent_texture(
     }
 }
 
+// View depth over world bounding radius at which each simplified level takes over. At 45°
+// vertical FOV and 720p, a unit-radius part 48 radii out spans roughly 35 pixels
+static constexpr std::array<float, osp::MeshLods::smc_maxLevels> sc_lodDepthRatio {48.0f, 192.0f};
+
+void SysRenderGL::select_mesh_lods(
+        ACtxSceneRender const&                      rScnRender,
+        ViewProjMatrix const&                       viewProj,
+        MeshGlEntStorage_t&                         rCmpMeshGl) noexcept
+{
+    for (std::size_t const entInt : rScnRender.m_visible.ones())
+    {
+        auto const drawEnt = DrawEnt(entInt);
+
+        ACompMeshGl &rEntMeshGl = rCmpMeshGl[drawEnt];
+        if (rEntMeshGl.m_glLods[1] == lgrn::id_null<MeshGlId>())
+        {
+            continue; // No simplified levels compiled for this mesh
+        }
+
+        DrawEntHot const &hotEnt = rScnRender.hot[drawEnt];
+
+        float const radius = hotEnt.boundRadius;
+        if (radius <= 0.0f)
+        {
+            continue; // No bounds to judge distance against; keep the full mesh
+        }
+
+        osp::Matrix4 const &drawTf = hotEnt.drawTf;
+        float const scaleSq = std::max({ drawTf[0].xyz().dot(),
+                                         drawTf[1].xyz().dot(),
+                                         drawTf[2].xyz().dot() });
+        float const worldRadius = radius * std::sqrt(scaleSq);
+
+        float const depth = -viewProj.m_view.transformPoint(drawTf.translation()).z();
+
+        std::size_t level = 0;
+        for (std::size_t lvl = 0; lvl < sc_lodDepthRatio.size(); ++lvl)
+        {
+            if (   depth > sc_lodDepthRatio[lvl] * worldRadius
+                && rEntMeshGl.m_glLods[lvl + 1] != lgrn::id_null<MeshGlId>())
+            {
+                level = lvl + 1;
+            }
+        }
+
+        rEntMeshGl.m_glId = rEntMeshGl.m_glLods[level];
+    }
+}
+
 void SysRenderGL::display_texture(
         RenderGL& rRenderGl, Magnum::GL::Texture2D& rTex)
 {
@@ -322,29 +776,130 @@ void SysRenderGL::display_texture(
     Renderer::disable(Renderer::Feature::Blending);
     Renderer::setDepthMask(GL_TRUE);
 
+    rRenderGl.m_timeDisplay.begin();
+
     rRenderGl.m_fullscreenTriShader.display_texure(
             rRenderGl.m_meshGl.get(rRenderGl.m_fullscreenTri),
             rRenderGl.m_texGl.get(rRenderGl.m_fboColor));
+
+    rRenderGl.m_timeDisplay.end();
 }
 
 void SysRenderGL::clear_resource_owners(RenderGL& rRenderGl, Resources& rResources)
 {
+    // Stop the upload worker first; pending jobs read resource data the owners keep alive
+    rRenderGl.m_uploadQueue.reset();
+
     for ([[maybe_unused]] auto && [_, rOwner] : std::exchange(rRenderGl.m_texToRes, {}))
     {
-        rResources.owner_destroy(restypes::gc_texture, std::move(rOwner));
+        rResources.owner_destroy_later(restypes::gc_texture, std::move(rOwner));
     }
     rRenderGl.m_resToTex.clear();
 
     for ([[maybe_unused]] auto && [_, rOwner] : std::exchange(rRenderGl.m_meshToRes, {}))
     {
-        rResources.owner_destroy(restypes::gc_mesh, std::move(rOwner));
+        rResources.owner_destroy_later(restypes::gc_mesh, std::move(rOwner));
     }
     rRenderGl.m_resToMesh.clear();
+    rRenderGl.m_meshGlLods.clear();
+
+    rResources.owner_destroy_flush();
+
+    rRenderGl.m_meshUse.clear();
+    rRenderGl.m_texUse.clear();
+    rRenderGl.m_meshGlScnRefs.clear();
+    rRenderGl.m_texGlScnRefs.clear();
+    rRenderGl.m_residentBytes = 0;
+}
+
+void SysRenderGL::release_scene_resources(
+        ACtxSceneRenderGL&      rScnRenderGl,
+        Resources&              rResources,
+        RenderGL&               rRenderGl)
+{
+    for (std::size_t const resInt : rScnRenderGl.m_meshResUsed.ones())
+    {
+        auto const meshRes = ResId(resInt);
+
+        MeshGlId const *pMeshGl = rRenderGl.m_resToMesh.try_get(meshRes);
+        if (pMeshGl == nullptr)
+        {
+            continue; // clear_resource_owners already tore the shared tables down
+        }
+        MeshGlId const meshGl = *pMeshGl;
+
+        if (-- rRenderGl.m_meshGlScnRefs[meshGl] != 0)
+        {
+            continue; // Other scenes still draw this mesh
+        }
+
+        // Last referencing scene left; destroy the GL object and release the resource
+        GlResourceUse &rUse = rRenderGl.m_meshUse[meshGl];
+        if (rUse.resident)
+        {
+            rRenderGl.m_residentBytes -= rUse.sizeBytes;
+        }
+        rUse = {};
+
+        if (rRenderGl.m_meshGl.contains(meshGl))
+        {
+            rRenderGl.m_meshGl.remove(meshGl);
+        }
+        rRenderGl.m_meshGlLods.erase(meshGl);
+
+        auto const foundIt = rRenderGl.m_meshToRes.find(meshGl);
+        rResources.owner_destroy_later(restypes::gc_mesh, std::move(foundIt->second));
+        rRenderGl.m_meshToRes.erase(foundIt);
+        rRenderGl.m_resToMesh.erase(meshRes);
+        rRenderGl.m_meshIds.remove(meshGl);
+    }
+
+    for (std::size_t const resInt : rScnRenderGl.m_texResUsed.ones())
+    {
+        auto const texRes = ResId(resInt);
+
+        TexGlId const *pTexGl = rRenderGl.m_resToTex.try_get(texRes);
+        if (pTexGl == nullptr)
+        {
+            continue;
+        }
+        TexGlId const texGl = *pTexGl;
+
+        if (-- rRenderGl.m_texGlScnRefs[texGl] != 0)
+        {
+            continue;
+        }
+
+        GlResourceUse &rUse = rRenderGl.m_texUse[texGl];
+        if (rUse.resident)
+        {
+            rRenderGl.m_residentBytes -= rUse.sizeBytes;
+        }
+        rUse = {};
+
+        if (rRenderGl.m_texGl.contains(texGl))
+        {
+            rRenderGl.m_texGl.remove(texGl);
+        }
+
+        auto const foundIt = rRenderGl.m_texToRes.find(texGl);
+        rResources.owner_destroy_later(restypes::gc_texture, std::move(foundIt->second));
+        rRenderGl.m_texToRes.erase(foundIt);
+        rRenderGl.m_resToTex.erase(texRes);
+        rRenderGl.m_texIds.remove(texGl);
+    }
+
+    rResources.owner_destroy_flush();
+
+    std::fill(rScnRenderGl.m_meshResUsed.ints().begin(), rScnRenderGl.m_meshResUsed.ints().end(), 0u);
+    std::fill(rScnRenderGl.m_texResUsed.ints().begin(), rScnRenderGl.m_texResUsed.ints().end(), 0u);
 }
 
 void SysRenderGL::render_opaque(
-        RenderGroup const& group,
+        RenderGL& rRenderGl,
+        RenderGroup& rGroup,
         DrawEntSet_t const& visible,
+        DrawEntHots_t const& hot,
         ViewProjMatrix const& viewProj)
 {
     using Magnum::GL::Renderer;
@@ -354,12 +909,19 @@ void SysRenderGL::render_opaque(
     Renderer::disable(Renderer::Feature::Blending);
     Renderer::setDepthMask(GL_TRUE);
 
-    draw_group(group, visible, viewProj);
+    // Binds made outside the draw paths (display_texture, uploads) aren't tracked
+    rRenderGl.m_bindCache.reset();
+
+    rRenderGl.m_timeOpaque.begin();
+    draw_group_front_to_back(rGroup, visible, hot, viewProj);
+    rRenderGl.m_timeOpaque.end();
 }
 
 void SysRenderGL::render_transparent(
-        RenderGroup const& group,
+        RenderGL& rRenderGl,
+        RenderGroup& rGroup,
         DrawEntSet_t const& visible,
+        DrawEntHots_t const& hot,
         ViewProjMatrix const& viewProj)
 {
     using Magnum::GL::Renderer;
@@ -375,19 +937,249 @@ void SysRenderGL::render_transparent(
     //            can mess up other transparent objects once added
     //Renderer::setDepthMask(GL_FALSE);
 
-    draw_group(group, visible, viewProj);
+    rRenderGl.m_bindCache.reset();
+
+    rRenderGl.m_timeTransparent.begin();
+    draw_group_depth_sorted(rGroup, visible, hot, viewProj);
+    rRenderGl.m_timeTransparent.end();
+}
+
+// Rebuild and re-sort a RenderGroup's cached draw order from current membership and sort keys
+static void rebuild_draw_order(osp::draw::RenderGroup& rGroup)
+{
+    rGroup.drawOrder.clear();
+    rGroup.drawOrder.reserve(rGroup.entities.size());
+
+    for (auto const& [ent, toDraw] : entt::basic_view{rGroup.entities}.each())
+    {
+        std::uint64_t const key = (std::size_t(ent) < rGroup.sortKeys.size())
+                                ? rGroup.sortKeys[ent] : 0;
+        rGroup.drawOrder.push_back({key, ent});
+    }
+
+    // Tie-break on entity id for a deterministic frame-to-frame order
+    std::sort(rGroup.drawOrder.begin(), rGroup.drawOrder.end(),
+              [] (auto const& lhs, auto const& rhs) noexcept
+    {
+        return (lhs.key != rhs.key) ? (lhs.key < rhs.key) : (lhs.ent < rhs.ent);
+    });
+
+    rGroup.drawOrderDirty = false;
+}
+
+// Instanced buckets; one call each regardless of how many entities they hold
+static void draw_instanced_buckets(
+        osp::draw::RenderGroup const& rGroup,
+        osp::draw::DrawEntSet_t const& visible,
+        osp::draw::ViewProjMatrix const& viewProj)
+{
+    std::vector<DrawEnt> visibleInstances;
+    for (auto const& [_, batch] : rGroup.instanced)
+    {
+        visibleInstances.clear();
+        visibleInstances.reserve(batch.entities.size());
+        for (DrawEnt const ent : batch.entities)
+        {
+            if (visible.test(std::size_t(ent)))
+            {
+                visibleInstances.push_back(ent);
+            }
+        }
+
+        if ( ! visibleInstances.empty())
+        {
+            batch.draw(osp::arrayView(visibleInstances.data(), visibleInstances.size()),
+                       viewProj, batch.data);
+        }
+    }
 }
 
 void SysRenderGL::draw_group(
-        RenderGroup const& group,
+        RenderGroup& rGroup,
+        DrawEntSet_t const& visible,
+        ViewProjMatrix const& viewProj)
+{
+    // Detect changes made without going through set/clear_sort_key, such as the render group
+    // delete task removing entities directly
+    bool stale = rGroup.drawOrderDirty
+              || (rGroup.drawOrder.size() != rGroup.entities.size());
+    if ( ! stale)
+    {
+        for (RenderGroup::DrawOrderEntry const& entry : rGroup.drawOrder)
+        {
+            if ( ! rGroup.entities.contains(entry.ent))
+            {
+                stale = true;
+                break;
+            }
+        }
+    }
+
+    if (stale)
+    {
+        rebuild_draw_order(rGroup);
+    }
+
+    for (RenderGroup::DrawOrderEntry const& entry : rGroup.drawOrder)
+    {
+        if (visible.test(std::size_t(entry.ent)))
+        {
+            EntityToDraw const &toDraw = rGroup.entities.get(entry.ent);
+            toDraw.draw(entry.ent, viewProj, toDraw.data);
+        }
+    }
+
+    draw_instanced_buckets(rGroup, visible, viewProj);
+}
+
+// Map view-space depth to a radix-sortable unsigned value; the monotonic float-to-uint
+// flip preserves ascending order for all finite floats, including the negative depths of
+// entities behind the camera
+static std::uint32_t depth_bits(float const depth) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+    bits ^= ((bits & 0x80000000u) != 0) ? 0xFFFFFFFFu : 0x80000000u;
+    return bits;
+}
+
+// Stable LSD radix sort on the 64-bit keys, one byte per pass. Histograms for every pass
+// are gathered in a single scan, and passes where all keys share the same digit are skipped
+// entirely; depth keys rarely populate more than a few of the eight bytes.
+static void radix_sort_draw_order(std::vector<osp::draw::RenderGroup::DrawOrderEntry>& rEntries)
+{
+    using Entry = osp::draw::RenderGroup::DrawOrderEntry;
+
+    std::size_t const count = rEntries.size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    constexpr std::size_t sc_passes = sizeof(std::uint64_t);
+
+    std::array<std::array<std::uint32_t, 256>, sc_passes> histograms{};
+    for (Entry const& entry : rEntries)
+    {
+        for (std::size_t pass = 0; pass < sc_passes; ++pass)
+        {
+            ++histograms[pass][(entry.key >> (8 * pass)) & 0xFF];
+        }
+    }
+
+    std::vector<Entry> scratch(count);
+    Entry *pSrc = rEntries.data();
+    Entry *pDst = scratch.data();
+
+    for (std::size_t pass = 0; pass < sc_passes; ++pass)
+    {
+        std::array<std::uint32_t, 256> &rHist = histograms[pass];
+
+        if (rHist[(pSrc[0].key >> (8 * pass)) & 0xFF] == count)
+        {
+            continue; // Every key shares this digit; nothing would move
+        }
+
+        // Exclusive prefix sum turns counts into write offsets
+        std::uint32_t offset = 0;
+        for (std::uint32_t &rBucket : rHist)
+        {
+            offset += std::exchange(rBucket, offset);
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            pDst[rHist[(pSrc[i].key >> (8 * pass)) & 0xFF]++] = pSrc[i];
+        }
+
+        std::swap(pSrc, pDst);
+    }
+
+    if (pSrc != rEntries.data())
+    {
+        std::copy(pSrc, pSrc + count, rEntries.data());
+    }
+}
+
+void SysRenderGL::draw_group_depth_sorted(
+        RenderGroup& rGroup,
         DrawEntSet_t const& visible,
+        DrawEntHots_t const& hot,
         ViewProjMatrix const& viewProj)
 {
-    for (auto const& [ent, toDraw] : entt::basic_view{group.entities}.each())
+    using Entry = RenderGroup::DrawOrderEntry;
+
+    std::vector<Entry> entries;
+    entries.reserve(rGroup.entities.size());
+
+    for (auto const& [ent, toDraw] : entt::basic_view{rGroup.entities}.each())
     {
-        if (visible.test(std::size_t(ent)))
+        if ( ! visible.test(std::size_t(ent)))
         {
-            toDraw.draw(ent, viewProj, toDraw.data);
+            continue;
         }
+
+        // Depth of the entity origin along the view axis, re-quantized every frame
+        float const depth = -viewProj.m_view.transformPoint(hot[ent].drawTf.translation()).z();
+
+        // Inverted depth occupies the high bits so farther entities draw first and blending
+        // order dominates; the static key's shader and texture fields tie-break equal
+        // depths to still group GL state
+        std::uint64_t const stateKey = (std::size_t(ent) < rGroup.sortKeys.size())
+                                     ? (rGroup.sortKeys[ent] >> 32) : 0;
+
+        entries.push_back({(std::uint64_t(~depth_bits(depth)) << 32) | stateKey, ent});
     }
+
+    radix_sort_draw_order(entries);
+
+    for (Entry const& entry : entries)
+    {
+        EntityToDraw const &toDraw = rGroup.entities.get(entry.ent);
+        toDraw.draw(entry.ent, viewProj, toDraw.data);
+    }
+
+    draw_instanced_buckets(rGroup, visible, viewProj);
+}
+
+void SysRenderGL::draw_group_front_to_back(
+        RenderGroup& rGroup,
+        DrawEntSet_t const& visible,
+        DrawEntHots_t const& hot,
+        ViewProjMatrix const& viewProj)
+{
+    using Entry = RenderGroup::DrawOrderEntry;
+
+    std::vector<Entry> entries;
+    entries.reserve(rGroup.entities.size());
+
+    for (auto const& [ent, toDraw] : entt::basic_view{rGroup.entities}.each())
+    {
+        if ( ! visible.test(std::size_t(ent)))
+        {
+            continue;
+        }
+
+        float const depth = -viewProj.m_view.transformPoint(hot[ent].drawTf.translation()).z();
+
+        // Coarse bucket: the float flip's top 16 bits are sign, exponent, and leading
+        // mantissa, giving near entities finer buckets where early-Z matters most. Many
+        // entities land in one bucket, where the static key's state fields keep draws
+        // grouped by shader, texture, and mesh
+        std::uint64_t const bucket   = depth_bits(depth) >> 16;
+        std::uint64_t const stateKey = (std::size_t(ent) < rGroup.sortKeys.size())
+                                     ? (rGroup.sortKeys[ent] >> 16) : 0;
+
+        entries.push_back({(bucket << 48) | stateKey, ent});
+    }
+
+    radix_sort_draw_order(entries);
+
+    for (Entry const& entry : entries)
+    {
+        EntityToDraw const &toDraw = rGroup.entities.get(entry.ent);
+        toDraw.draw(entry.ent, viewProj, toDraw.data);
+    }
+
+    draw_instanced_buckets(rGroup, visible, viewProj);
 }
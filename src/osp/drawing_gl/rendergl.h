@@ -25,11 +25,14 @@
 #pragma once
 
 #include "FullscreenTriShader.h"
+#include "upload_queue.h"
 
 #include "../drawing/drawing_fn.h"
+#include "../drawing/own_restypes.h"
 
 #include <Magnum/GL/Mesh.h>
 #include <Magnum/GL/Texture.h>
+#include <Magnum/GL/TimeQuery.h>
 #include <Magnum/GL/Framebuffer.h>
 #include <Magnum/GL/Renderbuffer.h>
 
@@ -38,6 +41,10 @@
 
 #include <longeron/id_management/registry.hpp>
 
+#include <array>
+#include <cstdint>
+#include <memory>
+
 namespace osp::draw
 {
 
@@ -47,6 +54,123 @@ enum class MeshGlId : uint32_t { };
 using TexGlStorage_t    = Storage_t<TexGlId, Magnum::GL::Texture2D>;
 using MeshGlStorage_t   = Storage_t<MeshGlId, Magnum::GL::Mesh>;
 
+/**
+ * @brief Residency bookkeeping for one resource-backed GL mesh or texture
+ */
+struct GlResourceUse
+{
+    std::uint64_t   lastUsedFrame   {0};
+    std::size_t     sizeBytes       {0};
+    bool            resident        {false};
+};
+
+/**
+ * @brief Rolling GL_TIME_ELAPSED timings for one GPU render pass
+ *
+ * Queries are a short ring so results are read back a few frames late, never stalling
+ * waiting on the GPU. begin() polls finished queries into the rolling history first, so no
+ * separate per-frame collect call is needed. GPU cost is invisible to CPU-side task timing;
+ * these attribute frame drops to individual passes.
+ */
+struct GpuPassTimer
+{
+    static constexpr std::size_t smc_queryRing      = 4;
+    static constexpr std::size_t smc_historySize    = 32;
+
+    void begin();
+    void end();
+
+    /// Average of the history in milliseconds, or 0.0f before any result arrived
+    float average_ms() const noexcept;
+
+    std::array<Magnum::GL::TimeQuery, smc_queryRing> m_queries
+    {
+        Magnum::GL::TimeQuery{Corrade::NoCreate},
+        Magnum::GL::TimeQuery{Corrade::NoCreate},
+        Magnum::GL::TimeQuery{Corrade::NoCreate},
+        Magnum::GL::TimeQuery{Corrade::NoCreate}
+    };
+    std::array<bool, smc_queryRing>     m_pending       {};
+    std::uint32_t                       m_queryWrite    {0};
+    std::uint32_t                       m_queryRead     {0};
+
+    /// Rolling elapsed times in milliseconds, most recent at m_historyNext - 1
+    std::array<float, smc_historySize>  m_historyMs     {};
+    std::uint32_t                       m_historyNext   {0};
+    std::uint32_t                       m_historyCount  {0};
+};
+
+/**
+ * @brief Last-applied GL binding state, tracked across draw calls within a render pass
+ *
+ * Draw functions record the shader program, mesh, and texture units they bind here, and
+ * skip calls that would only re-apply the current state; this is what lets a sort-key
+ * ordered draw list actually realize its state-change savings. Texture unit layouts are
+ * per-program, so the unit slots reset whenever the program changes. Recorded ids are
+ * only meaningful within one pass: SysRenderGL::render_opaque and render_transparent
+ * reset the cache at pass start, which also covers binds made outside the draw paths
+ * (display_texture, staged uploads) and GL objects replaced between frames (residency
+ * eviction, resource recompiles).
+ */
+struct GlBindCache
+{
+    /// Texture units tracked per program; enough for the builtin shaders' layouts
+    static constexpr std::size_t smc_texUnits = 4;
+
+    /**
+     * @brief Record the shader program used for following draws
+     *
+     * @return true if the program changed, meaning pass-constant uniforms must be
+     *         (re-)applied; texture unit slots are reset as units are program-relative
+     */
+    bool bind_program(void const* pProgram) noexcept
+    {
+        if (m_pProgram == pProgram)
+        {
+            return false;
+        }
+        m_pProgram = pProgram;
+        m_texUnits.fill(lgrn::id_null<TexGlId>());
+        return true;
+    }
+
+    /// Record the mesh of the next draw; returns true if it differs from the previous draw's
+    bool bind_mesh(MeshGlId const meshGl) noexcept
+    {
+        if (m_mesh == meshGl)
+        {
+            return false;
+        }
+        m_mesh = meshGl;
+        return true;
+    }
+
+    /// Record a texture on one of the current program's units; returns true if the unit
+    /// must actually be bound
+    bool bind_texture(std::size_t const unit, TexGlId const texGl) noexcept
+    {
+        if (m_texUnits[unit] == texGl)
+        {
+            return false;
+        }
+        m_texUnits[unit] = texGl;
+        return true;
+    }
+
+    void reset() noexcept
+    {
+        *this = GlBindCache{};
+    }
+
+    void const*                         m_pProgram  {nullptr};
+    MeshGlId                            m_mesh      {lgrn::id_null<MeshGlId>()};
+    std::array<TexGlId, smc_texUnits>   m_texUnits
+    {
+        lgrn::id_null<TexGlId>(), lgrn::id_null<TexGlId>(),
+        lgrn::id_null<TexGlId>(), lgrn::id_null<TexGlId>()
+    };
+};
+
 /**
  * @brief Main renderer state and essential GL resources
  *
@@ -73,13 +197,48 @@ struct RenderGL
     MeshGlStorage_t                     m_meshGl;
 
     // Associate GL Texture Ids with resources
-    IdMap_t<ResId, TexGlId>             m_resToTex;
+    HybridIdMap<ResId, TexGlId>         m_resToTex;
     IdMap_t<TexGlId, ResIdOwner_t>      m_texToRes;
 
     // Associate GL Mesh Ids with resources
-    IdMap_t<ResId, MeshGlId>            m_resToMesh;
+    HybridIdMap<ResId, MeshGlId>        m_resToMesh;
     IdMap_t<MeshGlId, ResIdOwner_t>     m_meshToRes;
 
+    // Compiled import-time LOD chains, keyed by the full-detail mesh's GL id; levels are
+    // registered in compile_resource_meshes and null where a mesh's chain is shorter
+    IdMap_t<MeshGlId, std::array<MeshGlId, MeshLods::smc_maxLevels>> m_meshGlLods;
+
+    // Number of scenes counted into each resource-backed GL object by compile_resource_*.
+    // N scenes referencing the same glTF mesh share one GL buffer; release_scene_resources
+    // destroys the object when the last scene counted into it leaves.
+    KeyedVec<MeshGlId, std::uint16_t>   m_meshGlScnRefs;
+    KeyedVec<TexGlId, std::uint16_t>    m_texGlScnRefs;
+
+    // Optional worker-thread staging of resource data; when present, compile_resource_* enqueue
+    // uploads finished by UploadQueueGL::finish_uploads instead of copying on the render thread
+    std::unique_ptr<UploadQueueGL>      m_uploadQueue;
+
+    // Residency tracking for resource-backed GL objects; see SysRenderGL::update_residency.
+    // Only ids present in m_meshToRes/m_texToRes are tracked; built-ins like the fullscreen
+    // triangle and FBO color texture are never evicted.
+    KeyedVec<MeshGlId, GlResourceUse>   m_meshUse;
+    KeyedVec<TexGlId, GlResourceUse>    m_texUse;
+    std::uint64_t                       m_residencyFrame    {0};
+    std::size_t                         m_residentBytes     {0};
+
+    /// GPU bytes of resource meshes and textures kept resident; 0 disables eviction
+    std::size_t                         m_residencyBudget   {2048ul * 1024ul * 1024ul};
+
+    // GL_TIME_ELAPSED scopes per GPU pass, alongside the CPU-side ExecLog task timings.
+    // Queries are created in setup_context
+    GpuPassTimer                        m_timeOpaque;
+    GpuPassTimer                        m_timeTransparent;
+    GpuPassTimer                        m_timeDisplay;
+
+    // Program/mesh/texture-unit binds applied so far this pass, consulted by shader draw
+    // functions through their assign_pointers and reset by render_opaque/render_transparent
+    GlBindCache                         m_bindCache;
+
 };
 
 struct ACompTexGl
@@ -90,8 +249,20 @@ struct ACompTexGl
 
 struct ACompMeshGl
 {
+    /// Full mesh plus the import-time simplified levels
+    static constexpr std::size_t smc_maxLods = MeshLods::smc_maxLevels + 1;
+
     MeshId      m_scnId     {lgrn::id_null<MeshId>()};
+
+    /// Level the draw functions use; SysRenderGL::select_mesh_lods repoints this within
+    /// m_glLods by view depth each frame. Stays on the full mesh without a chain.
     MeshGlId    m_glId      {lgrn::id_null<MeshGlId>()};
+
+    /// [0] is the full mesh; null past the last compiled level
+    std::array<MeshGlId, smc_maxLods> m_glLods
+    {
+        lgrn::id_null<MeshGlId>(), lgrn::id_null<MeshGlId>(), lgrn::id_null<MeshGlId>()
+    };
 };
 
 using MeshGlEntStorage_t    = KeyedVec<DrawEnt, ACompMeshGl>;
@@ -104,6 +275,11 @@ struct ACtxSceneRenderGL
 {
     MeshGlEntStorage_t      m_meshId;
     TexGlEntStorage_t       m_diffuseTexId;
+
+    // ResIds this scene has been counted for in RenderGL's shared per-resource tables, so
+    // repeated sync passes don't recount. Walked and cleared by release_scene_resources.
+    BitVector_t             m_meshResUsed;
+    BitVector_t             m_texResUsed;
 };
 
 /**
@@ -137,39 +313,92 @@ public:
     /**
      * @brief Compile GPU-side TexGlIds for textures loaded from a Resource (TexId + ResId)
      *
+     * The ResId to TexGlId table is shared renderer-wide: scenes referencing the same
+     * resource get the same GL texture, each scene counted once into its reference count.
+     *
      * @param rCtxDrawRes   [in] Resources used by the scene
      * @param rResources    [ref] Application Resources shared with the scene. New resource owners may be created.
+     * @param rScnRenderGl  [ref] Scene's renderer-side state, records which ResIds it counted
      * @param rRenderGl     [ref] Renderer state
      */
     static void compile_resource_textures(
             ACtxDrawingRes const& rCtxDrawRes,
             Resources& rResources,
+            ACtxSceneRenderGL& rScnRenderGl,
             RenderGL& rRenderGl);
 
     /**
      * @brief Compile GPU-side MeshGlIds for meshes loaded from a Resource (MeshId + ResId)
      *
+     * Shared renderer-wide like compile_resource_textures; a part mesh used by N scenes
+     * occupies one GL buffer.
+     *
      * @param rCtxDrawRes   [in] Resources used by the scene
      * @param rResources    [ref] Application Resources shared with the scene. New resource owners may be created.
+     * @param rScnRenderGl  [ref] Scene's renderer-side state, records which ResIds it counted
      * @param rRenderGl     [ref] Renderer state
      */
     static void compile_resource_meshes(
             ACtxDrawingRes const& rCtxDrawRes,
             Resources& rResources,
+            ACtxSceneRenderGL& rScnRenderGl,
+            RenderGL& rRenderGl);
+
+    /**
+     * @brief Release one scene's references into the shared GL resource tables
+     *
+     * Call when a scene's renderer closes. GL meshes and textures whose last referencing
+     * scene left are destroyed and their resource owners released; objects other scenes
+     * still reference are untouched. Safe after clear_resource_owners already tore the
+     * tables down.
+     *
+     * @param rScnRenderGl  [ref] Scene's renderer-side state; its counted sets are cleared
+     * @param rResources    [ref] Application Resources shared with the scene
+     * @param rRenderGl     [ref] Renderer state
+     */
+    static void release_scene_resources(
+            ACtxSceneRenderGL& rScnRenderGl,
+            Resources& rResources,
             RenderGL& rRenderGl);
 
     /**
-     * @brief Synchronize an entity's MeshId component to an ACompMeshGl
+     * @brief Record that a resource-backed GL mesh will be drawn this residency frame
+     *
+     * Null and non-resource ids (fullscreen triangle, FBO color) are ignored
+     */
+    static void touch_mesh(RenderGL& rRenderGl, MeshGlId meshGl) noexcept;
+
+    /**
+     * @brief Record that a resource-backed GL texture will be drawn this residency frame
+     */
+    static void touch_texture(RenderGL& rRenderGl, TexGlId texGl) noexcept;
+
+    /**
+     * @brief Restore touched evicted resources, then evict least-recently-drawn ones over budget
+     *
+     * Call once per frame after touch_mesh/touch_texture. Eviction replaces the GL object with
+     * an empty one and recompiles it through the resource data when drawn again, so an evicted
+     * resource coming back into view may render empty for one frame. Resources drawn within the
+     * last frame are never evicted; a working set larger than the budget stays resident instead
+     * of thrashing.
+     *
+     * @param rRenderGl     [ref] Renderer state
+     * @param rResources    [ref] Application Resources holding mesh and image data
+     */
+    static void update_residency(RenderGL& rRenderGl, Resources& rResources);
+
+    /**
+     * @brief Synchronize an entity's assigned mesh to an ACompMeshGl
      *
      * @param ent           [in] DrawEnt with mesh to synchronize
-     * @param cmpMeshIds    [in] Scene Mesh Id component
+     * @param hot           [in] Scene per-DrawEnt records holding the assigned mesh
      * @param meshToRes     [in] Scene's Mesh Id to Resource Id
      * @param rCmpMeshGl    [ref] Renderer-side ACompMeshGl components
      * @param rRenderGl     [ref] Renderer state
      */
     static void sync_drawent_mesh(
             DrawEnt                                     ent,
-            KeyedVec<DrawEnt, MeshIdOwner_t> const&     cmpMeshIds,
+            DrawEntHots_t const&                        hot,
             IdMap_t<MeshId, ResIdOwner_t> const&        meshToRes,
             MeshGlEntStorage_t&                         rCmpMeshGl,
             RenderGL&                                   rRenderGl);
@@ -178,14 +407,14 @@ public:
     static void sync_drawent_mesh(
             ITA_T const&                                first,
             ITB_T const&                                last,
-            KeyedVec<DrawEnt, MeshIdOwner_t> const&     cmpMeshIds,
+            DrawEntHots_t const&                        hot,
             IdMap_t<MeshId, ResIdOwner_t> const&        meshToRes,
             MeshGlEntStorage_t&                         rCmpMeshGl,
             RenderGL&                                   rRenderGl)
     {
         std::for_each(first, last, [&] (DrawEnt const ent)
         {
-            sync_drawent_mesh(ent, cmpMeshIds, meshToRes, rCmpMeshGl, rRenderGl);
+            sync_drawent_mesh(ent, hot, meshToRes, rCmpMeshGl, rRenderGl);
         });
     }
 
@@ -205,6 +434,23 @@ public:
             TexGlEntStorage_t&                          rCmpTexGl,
             RenderGL&                                   rRenderGl);
 
+    /**
+     * @brief Pick each visible entity's mesh LOD level from its view depth
+     *
+     * Repoints ACompMeshGl::m_glId within its compiled chain using the ratio of view depth
+     * to world-space bounding radius, so distant entities draw their simplified meshes.
+     * Entities without bounds or without a chain keep the full mesh. Call after visibility
+     * and draw transforms are updated, before the render passes.
+     *
+     * @param rScnRender    [in] Scene render context with visibility, transforms, and bounds
+     * @param viewProj      [in] View and projection matrix
+     * @param rCmpMeshGl    [ref] Renderer-side ACompMeshGl components
+     */
+    static void select_mesh_lods(
+            ACtxSceneRender const&                      rScnRender,
+            ViewProjMatrix const&                       viewProj,
+            MeshGlEntStorage_t&                         rCmpMeshGl) noexcept;
+
     template <typename ITA_T, typename ITB_T>
     static void sync_drawent_texture(
             ITA_T const&                                first,
@@ -223,32 +469,80 @@ public:
     /**
      * @brief Call draw functions of a RenderGroup of opaque objects
      *
-     * @param group     [in] RenderGroup to draw
+     * Entities draw approximately front-to-back through draw_group_front_to_back, so far
+     * fragments fail the depth test before shading on fill-rate-limited GPUs.
+     *
+     * @param rRenderGl [ref] Renderer state; the pass is timed into m_timeOpaque
+     * @param rGroup    [ref] RenderGroup to draw
      * @param visible   [in] Storage for visible components
+     * @param hot       [in] Per-DrawEnt records; draw transforms used for view depth
      * @param viewProj  [in] View and projection matrix
      */
     static void render_opaque(
-            RenderGroup const& group,
+            RenderGL& rRenderGl,
+            RenderGroup& rGroup,
             DrawEntSet_t const& visible,
+            DrawEntHots_t const& hot,
             ViewProjMatrix const& viewProj);
 
     /**
      * @brief Call draw functions of a RenderGroup of transparent objects
      *
-     * Consider sorting the render group for correct transparency
+     * Unlike render_opaque, entities are drawn back-to-front through
+     * draw_group_depth_sorted for correct blending.
      *
-     * @param group     [in] RenderGroup to draw
+     * @param rRenderGl [ref] Renderer state; the pass is timed into m_timeTransparent
+     * @param rGroup    [ref] RenderGroup to draw
      * @param visible   [in] Storage for visible components
+     * @param hot       [in] Per-DrawEnt records; draw transforms used for view depth
      * @param viewProj  [in] View and projection matrix
      */
     static void render_transparent(
-            RenderGroup const& group,
+            RenderGL& rRenderGl,
+            RenderGroup& rGroup,
             DrawEntSet_t const& visible,
+            DrawEntHots_t const& hot,
             ViewProjMatrix const& viewProj);
 
+    /**
+     * @brief Draw a RenderGroup's entities in sort-key order, then its instanced buckets
+     *
+     * Walks the group's cached key-ordered entity list so draws with the same shader, texture,
+     * and mesh land adjacent. The cache persists across frames; it is only rebuilt and
+     * re-sorted when sort keys changed or group membership no longer matches it.
+     */
     static void draw_group(
-            RenderGroup const& group,
+            RenderGroup& rGroup,
+            DrawEntSet_t const& visible,
+            ViewProjMatrix const& viewProj);
+
+    /**
+     * @brief Draw a RenderGroup's entities ordered back-to-front by view depth
+     *
+     * View depth changes every frame, so the static sort key cache is no use here; instead
+     * each visible entity's depth is quantized into the high bits of a fresh key (the static
+     * key's shader and texture fields tie-break equal depths to still group GL state) and the
+     * list is LSD radix sorted, O(n) rather than comparison-sort cost. Instanced buckets
+     * cannot be depth-ordered per entity and draw after, as in draw_group.
+     */
+    static void draw_group_depth_sorted(
+            RenderGroup& rGroup,
+            DrawEntSet_t const& visible,
+            DrawEntHots_t const& hot,
+            ViewProjMatrix const& viewProj);
+
+    /**
+     * @brief Draw a RenderGroup's entities approximately front-to-back for early-Z
+     *
+     * Opaque counterpart of draw_group_depth_sorted, using the same per-frame radix sort.
+     * A coarse 16-bit depth bucket occupies the high bits so near entities draw first and
+     * occluded fragments are rejected before shading; the static sort key's state fields
+     * order within each bucket, preserving most of the shader/texture/mesh bind grouping.
+     */
+    static void draw_group_front_to_back(
+            RenderGroup& rGroup,
             DrawEntSet_t const& visible,
+            DrawEntHots_t const& hot,
             ViewProjMatrix const& viewProj);
 
 };
@@ -0,0 +1,122 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "streamed_buffer.h"
+
+#include <Magnum/GL/OpenGL.h>
+
+#include <longeron/utility/asserts.hpp>
+
+using Magnum::GL::Buffer;
+
+using osp::draw::StreamedBufferGL;
+
+StreamedBufferGL& StreamedBufferGL::operator=(StreamedBufferGL&& other) noexcept
+{
+    delete_fences();
+
+    m_buffer       = std::move(other.m_buffer);
+    m_mapped       = std::exchange(other.m_mapped, {});
+    m_fences       = std::exchange(other.m_fences, {});
+    m_sectionSize  = std::exchange(other.m_sectionSize, 0);
+    m_sectionIndex = std::exchange(other.m_sectionIndex, 0);
+
+    return *this;
+}
+
+StreamedBufferGL::~StreamedBufferGL()
+{
+    delete_fences();
+}
+
+void StreamedBufferGL::delete_fences() noexcept
+{
+    for (void* &rFence : m_fences)
+    {
+        if (rFence != nullptr)
+        {
+            glDeleteSync(static_cast<GLsync>(rFence));
+            rFence = nullptr;
+        }
+    }
+}
+
+void StreamedBufferGL::allocate(std::size_t const sectionSize)
+{
+    LGRN_ASSERTM(m_sectionSize == 0, "StreamedBufferGL is already allocated");
+
+    m_sectionSize  = sectionSize;
+    m_sectionIndex = 0;
+
+    m_buffer = Buffer{};
+    m_buffer.setStorage(sectionSize * smc_sections,
+                          Buffer::StorageFlag::MapWrite
+                        | Buffer::StorageFlag::MapPersistent);
+
+    m_mapped = m_buffer.map(0, sectionSize * smc_sections,
+                              Buffer::MapFlag::Write
+                            | Buffer::MapFlag::Persistent
+                            | Buffer::MapFlag::FlushExplicit);
+}
+
+Corrade::Containers::ArrayView<std::byte> StreamedBufferGL::begin_section()
+{
+    LGRN_ASSERT(m_sectionSize != 0);
+
+    void* &rFence = m_fences[m_sectionIndex];
+    if (rFence != nullptr)
+    {
+        // The GPU may still be drawing from this section. This only blocks when the CPU laps
+        // all smc_sections sections before the oldest frame retires.
+        GLsync const sync   = static_cast<GLsync>(rFence);
+        GLenum       status = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (status == GL_TIMEOUT_EXPIRED)
+        {
+            constexpr GLuint64 timeoutNs = 1000000; // 1 ms
+            status = glClientWaitSync(sync, 0, timeoutNs);
+        }
+        LGRN_ASSERT(status != GL_WAIT_FAILED);
+
+        glDeleteSync(sync);
+        rFence = nullptr;
+    }
+
+    auto const mappedBytes = Corrade::Containers::arrayCast<std::byte>(m_mapped);
+    return mappedBytes.sliceSize(section_offset_bytes(), m_sectionSize);
+}
+
+void StreamedBufferGL::flush_range(std::size_t const offset, std::size_t const size)
+{
+    LGRN_ASSERT(offset + size <= m_sectionSize);
+
+    m_buffer.flushMappedRange(GLintptr(section_offset_bytes() + offset), GLsizeiptr(size));
+}
+
+void StreamedBufferGL::end_section()
+{
+    LGRN_ASSERT(m_fences[m_sectionIndex] == nullptr);
+
+    m_fences[m_sectionIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_sectionIndex = (m_sectionIndex + 1) % smc_sections;
+}
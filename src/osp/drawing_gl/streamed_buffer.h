@@ -0,0 +1,137 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Persistent-mapped streaming GL buffer for frequently updated mesh data
+ */
+
+#include <Magnum/GL/Buffer.h>
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace osp::draw
+{
+
+/**
+ * @brief Triple-buffered persistent-mapped GL buffer for streaming mesh data
+ *
+ * Intended for large, frequently updated geometry such as planeta::BasicChunkMeshGeometry
+ * vertex and index slabs, where only a few chunk-sized ranges change per frame. The buffer is
+ * allocated once with immutable storage (GL_MAP_PERSISTENT_BIT) and stays mapped for its whole
+ * lifetime: updates are plain writes into the mapping followed by an explicit flush
+ * (glFlushMappedBufferRange) of each dirty range, with no glBufferSubData and no map/unmap
+ * round-trips for the driver to stall on.
+ *
+ * The buffer holds smc_sections copies of the data so the section being written never aliases
+ * one the GPU may still be drawing from. A fence guards each section; begin_section only waits
+ * if the CPU wraps around all sections before the oldest frame retires.
+ *
+ * Per frame:
+ * @code
+ * ArrayView<std::byte> const section = buf.begin_section();
+ * // write changed data into 'section', then per dirty range:
+ * buf.flush_range(offset, size);
+ * buf.end_section();
+ * // draw with buf.section_offset_bytes() added to vertex/index offsets
+ * @endcode
+ */
+class StreamedBufferGL
+{
+public:
+
+    static constexpr int smc_sections = 3;
+
+    StreamedBufferGL() = default;
+    StreamedBufferGL(StreamedBufferGL const&) = delete;
+    StreamedBufferGL& operator=(StreamedBufferGL const&) = delete;
+
+    StreamedBufferGL(StreamedBufferGL&& other) noexcept
+     : m_buffer      {std::move(other.m_buffer)}
+     , m_mapped      {std::exchange(other.m_mapped, {})}
+     , m_fences      {std::exchange(other.m_fences, {})}
+     , m_sectionSize {std::exchange(other.m_sectionSize, 0)}
+     , m_sectionIndex{std::exchange(other.m_sectionIndex, 0)}
+    { }
+
+    StreamedBufferGL& operator=(StreamedBufferGL&& other) noexcept;
+
+    ~StreamedBufferGL();
+
+    /**
+     * @brief Allocate the buffer with smc_sections sections and persistently map it
+     *
+     * Requires an active GL context supporting ARB_buffer_storage (GL 4.4)
+     *
+     * @param sectionSize [in] Size of one section in bytes
+     */
+    void allocate(std::size_t sectionSize);
+
+    /**
+     * @brief Get the mapping of the current section, waiting for the GPU to release it if needed
+     */
+    Corrade::Containers::ArrayView<std::byte> begin_section();
+
+    /**
+     * @brief Flush a byte range written to the current section, making it visible to the GPU
+     */
+    void flush_range(std::size_t offset, std::size_t size);
+
+    /**
+     * @brief Fence the current section and advance to the next one
+     */
+    void end_section();
+
+    /// Byte offset of the current section within the GL buffer, for draw call setup
+    constexpr std::size_t section_offset_bytes() const noexcept
+    {
+        return m_sectionSize * std::size_t(m_sectionIndex);
+    }
+
+    constexpr std::size_t section_size() const noexcept { return m_sectionSize; }
+
+    Magnum::GL::Buffer& buffer() noexcept { return m_buffer; }
+
+private:
+
+    void delete_fences() noexcept;
+
+    Magnum::GL::Buffer                      m_buffer{Corrade::NoCreate};
+    Corrade::Containers::ArrayView<char>    m_mapped;
+
+    /// GLsync per section; stored as void* to keep raw GL types out of this header
+    std::array<void*, smc_sections>         m_fences{};
+
+    std::size_t                             m_sectionSize{0};
+    int                                     m_sectionIndex{0};
+
+}; // class StreamedBufferGL
+
+} // namespace osp::draw
@@ -0,0 +1,185 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "upload_queue.h"
+#include "rendergl.h"
+
+#include <Magnum/GL/BufferImage.h>
+#include <Magnum/MeshTools/Compile.h>
+#include <Magnum/Trade/ImageData.h>
+#include <Magnum/Trade/MeshData.h>
+
+#include <cstring>
+
+using namespace osp::draw;
+
+using Magnum::GL::Buffer;
+
+UploadQueueGL::UploadQueueGL()
+ : m_worker{&UploadQueueGL::worker_main, this}
+{ }
+
+UploadQueueGL::~UploadQueueGL()
+{
+    {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        m_stop = true;
+    }
+    m_condVar.notify_one();
+    m_worker.join();
+
+    // Unfinished jobs simply drop their (still mapped) buffers
+}
+
+void UploadQueueGL::enqueue_mesh(MeshGlId const meshGl, Magnum::Trade::MeshData const& meshData)
+{
+    auto const vtxData = meshData.vertexData();
+
+    MeshJob &rJob   = m_meshJobs.emplace_back();
+    rJob.meshGl     = meshGl;
+    rJob.pMeshData  = &meshData;
+
+    rJob.vertices = Buffer{Buffer::TargetHint::Array};
+    rJob.vertices.setData({nullptr, vtxData.size()}, Magnum::GL::BufferUsage::StaticDraw);
+    void *pVtxMap = rJob.vertices.map(
+            0, vtxData.size(),
+            Buffer::MapFlag::Write | Buffer::MapFlag::InvalidateBuffer).data();
+
+    if (meshData.isIndexed())
+    {
+        auto const idxData = meshData.indexData();
+
+        rJob.indices = Buffer{Buffer::TargetHint::ElementArray};
+        rJob.indices.setData({nullptr, idxData.size()}, Magnum::GL::BufferUsage::StaticDraw);
+        void *pIdxMap = rJob.indices.map(
+                0, idxData.size(),
+                Buffer::MapFlag::Write | Buffer::MapFlag::InvalidateBuffer).data();
+
+        rJob.copiesLeft.store(2, std::memory_order_relaxed);
+        push_copies({ {vtxData.data(), pVtxMap, vtxData.size(), &rJob.copiesLeft},
+                      {idxData.data(), pIdxMap, idxData.size(), &rJob.copiesLeft} });
+    }
+    else
+    {
+        rJob.copiesLeft.store(1, std::memory_order_relaxed);
+        push_copies({ {vtxData.data(), pVtxMap, vtxData.size(), &rJob.copiesLeft} });
+    }
+}
+
+void UploadQueueGL::enqueue_texture(TexGlId const texGl, Magnum::Trade::ImageData2D const& imgData)
+{
+    auto const pixData = imgData.data();
+
+    TextureJob &rJob = m_textureJobs.emplace_back();
+    rJob.texGl      = texGl;
+    rJob.storage    = imgData.storage();
+    rJob.format     = imgData.format();
+    rJob.size       = imgData.size();
+    rJob.dataSize   = pixData.size();
+
+    rJob.pixels = Buffer{Buffer::TargetHint::PixelUnpack};
+    rJob.pixels.setData({nullptr, pixData.size()}, Magnum::GL::BufferUsage::StaticDraw);
+    void *pPixMap = rJob.pixels.map(
+            0, pixData.size(),
+            Buffer::MapFlag::Write | Buffer::MapFlag::InvalidateBuffer).data();
+
+    rJob.copiesLeft.store(1, std::memory_order_relaxed);
+    push_copies({ {pixData.data(), pPixMap, pixData.size(), &rJob.copiesLeft} });
+}
+
+void UploadQueueGL::finish_uploads(
+        Storage_t<MeshGlId, Magnum::GL::Mesh>&      rMeshGl,
+        Storage_t<TexGlId, Magnum::GL::Texture2D>&  rTexGl,
+        int                                         budget)
+{
+    // Jobs are staged in FIFO order, so only the front of each deque needs checking
+
+    while (   budget > 0
+           && ! m_meshJobs.empty()
+           && m_meshJobs.front().copiesLeft.load(std::memory_order_acquire) == 0 )
+    {
+        MeshJob &rJob = m_meshJobs.front();
+
+        rJob.vertices.unmap();
+        if (rJob.indices.id() != 0)
+        {
+            rJob.indices.unmap();
+        }
+
+        // Data is already in the buffers; this only sets up vertex attributes
+        rMeshGl.get(rJob.meshGl) = Magnum::MeshTools::compile(
+                *rJob.pMeshData, std::move(rJob.indices), std::move(rJob.vertices));
+
+        m_meshJobs.pop_front();
+        --budget;
+    }
+
+    while (   budget > 0
+           && ! m_textureJobs.empty()
+           && m_textureJobs.front().copiesLeft.load(std::memory_order_acquire) == 0 )
+    {
+        TextureJob &rJob = m_textureJobs.front();
+
+        rJob.pixels.unmap();
+
+        // Pixel transfer sources from the staged buffer, not client memory
+        Magnum::GL::BufferImage2D bufImg{
+                rJob.storage, rJob.format, rJob.size, std::move(rJob.pixels), rJob.dataSize};
+        rTexGl.get(rJob.texGl).setSubImage(0, {}, std::move(bufImg));
+
+        m_textureJobs.pop_front();
+        --budget;
+    }
+}
+
+void UploadQueueGL::push_copies(std::initializer_list<Copy> const copies)
+{
+    {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        m_copyQueue.insert(m_copyQueue.end(), copies.begin(), copies.end());
+    }
+    m_condVar.notify_one();
+}
+
+void UploadQueueGL::worker_main()
+{
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (true)
+    {
+        m_condVar.wait(lock, [this] { return m_stop || ! m_copyQueue.empty(); });
+
+        if (m_stop)
+        {
+            break;
+        }
+
+        Copy const copy = m_copyQueue.front();
+        m_copyQueue.pop_front();
+
+        lock.unlock();
+        std::memcpy(copy.pDst, copy.pSrc, copy.size);
+        copy.pCopiesLeft->fetch_sub(1, std::memory_order_release);
+        lock.lock();
+    }
+}
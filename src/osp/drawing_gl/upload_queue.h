@@ -0,0 +1,154 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Worker-thread staging of mesh and texture resource data into GL buffers
+ */
+
+#include "../core/storage.h"
+
+#include <Magnum/Magnum.h>
+#include <Magnum/PixelFormat.h>
+#include <Magnum/PixelStorage.h>
+#include <Magnum/Math/Vector2.h>
+
+#include <Magnum/GL/Buffer.h>
+#include <Magnum/GL/Mesh.h>
+#include <Magnum/GL/Texture.h>
+
+#include <Magnum/Trade/Trade.h> // forward declarations for MeshData and ImageData2D
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace osp::draw
+{
+
+enum class TexGlId : uint32_t;
+enum class MeshGlId : uint32_t;
+
+/**
+ * @brief Stages mesh and texture resource data into GL buffers from a worker thread
+ *
+ * Uploading a new vehicle's glTF assets all at once hitches the render thread, mostly in the
+ * client-to-GL data copies. This queue keeps all GL calls on the render thread so no shared
+ * context is needed: enqueue maps a freshly allocated vertex/index or pixel buffer, the worker
+ * thread memcpys resource data into the mapping, and finish_uploads completes a bounded number
+ * of fully staged jobs per frame with cheap unmaps and binds.
+ *
+ * Until its upload finishes, an enqueued mesh stays default-constructed (draws nothing) and an
+ * enqueued texture has storage but undefined contents. Source data pointers are borrowed; the
+ * caller must keep the Resource alive until the job finishes, which the renderer's resource
+ * owners already guarantee.
+ */
+class UploadQueueGL
+{
+public:
+
+    /// Staged jobs finished per finish_uploads call; the rest wait for following frames
+    static constexpr int smc_finishBudget = 8;
+
+    UploadQueueGL();
+    UploadQueueGL(UploadQueueGL const&) = delete;
+    UploadQueueGL& operator=(UploadQueueGL const&) = delete;
+    ~UploadQueueGL();
+
+    /**
+     * @brief Allocate and map staging buffers for a mesh, then stage its data off-thread
+     *
+     * Call on the GL thread; \p meshData must outlive the job.
+     */
+    void enqueue_mesh(MeshGlId meshGl, Magnum::Trade::MeshData const& meshData);
+
+    /**
+     * @brief Allocate and map a pixel buffer for an uncompressed image, then stage off-thread
+     *
+     * Call on the GL thread; the texture must already have storage. \p imgData must outlive
+     * the job.
+     */
+    void enqueue_texture(TexGlId texGl, Magnum::Trade::ImageData2D const& imgData);
+
+    /**
+     * @brief Finish up to \p budget fully staged jobs; call once per frame on the GL thread
+     */
+    void finish_uploads(
+            Storage_t<MeshGlId, Magnum::GL::Mesh>&      rMeshGl,
+            Storage_t<TexGlId, Magnum::GL::Texture2D>&  rTexGl,
+            int                                         budget = smc_finishBudget);
+
+private:
+
+    struct MeshJob
+    {
+        MeshGlId                        meshGl;
+        Magnum::Trade::MeshData const   *pMeshData{nullptr};
+        Magnum::GL::Buffer              vertices{Corrade::NoCreate};
+        Magnum::GL::Buffer              indices{Corrade::NoCreate};
+        std::atomic<int>                copiesLeft{0};
+    };
+
+    struct TextureJob
+    {
+        TexGlId                         texGl;
+        Magnum::PixelStorage            storage;
+        Magnum::PixelFormat             format;
+        Magnum::Vector2i                size;
+        std::size_t                     dataSize{0};
+        Magnum::GL::Buffer              pixels{Corrade::NoCreate};
+        std::atomic<int>                copiesLeft{0};
+    };
+
+    /// One memcpy for the worker; pCopiesLeft reaches zero once a job is fully staged
+    struct Copy
+    {
+        void const          *pSrc;
+        void                *pDst;
+        std::size_t         size;
+        std::atomic<int>    *pCopiesLeft;
+    };
+
+    void push_copies(std::initializer_list<Copy> copies);
+    void worker_main();
+
+    // Job deques are GL-thread-only and FIFO; deque keeps the atomics at stable addresses
+    std::deque<MeshJob>         m_meshJobs;
+    std::deque<TextureJob>      m_textureJobs;
+
+    std::deque<Copy>            m_copyQueue; ///< Guarded by m_mutex
+    std::mutex                  m_mutex;
+    std::condition_variable     m_condVar;
+    bool                        m_stop{false};
+    std::thread                 m_worker;
+
+}; // class UploadQueueGL
+
+} // namespace osp::draw
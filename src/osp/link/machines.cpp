@@ -24,6 +24,8 @@
  */
 #include "machines.h"
 
+#include <cassert>
+
 namespace osp::link
 {
 
@@ -97,4 +99,116 @@ void copy_nodes(
     }
 }
 
+void snapshot_nodes(
+        Nodes const &rSrcNodes,
+        Machines const &rSrcMach,
+        NodesSnapshot &rSnapshotOut)
+{
+    using lgrn::Span;
+
+    std::size_t const nodeCount     = rSrcNodes.nodeIds.size();
+    std::size_t const machCapacity  = rSrcMach.ids.capacity();
+
+    rSnapshotOut.nodeCount = uint32_t(nodeCount);
+    rSnapshotOut.juncFirst.resize(nodeCount + 1);
+    rSnapshotOut.juncs.clear();
+    rSnapshotOut.portFirst.resize(machCapacity + 1);
+    rSnapshotOut.ports.clear();
+
+    // Flatten node-to-machine junctions, resolving machine local ids to
+    // directly remappable MachAnyIds
+    for (NodeId node = 0; node < nodeCount; ++node)
+    {
+        assert(rSrcNodes.nodeIds.exists(node)); // builder ids are dense
+
+        rSnapshotOut.juncFirst[node] = uint32_t(rSnapshotOut.juncs.size());
+
+        for (Junction const& junc : Span<Junction const>{rSrcNodes.nodeToMach[node]})
+        {
+            MachAnyId const mach = rSrcMach.perType[junc.type].localToAny[junc.local];
+            rSnapshotOut.juncs.push_back(
+                    { .mach = mach, .type = junc.type, .custom = junc.custom });
+        }
+    }
+    rSnapshotOut.juncFirst[nodeCount] = uint32_t(rSnapshotOut.juncs.size());
+
+    // Pack machine-to-node port spans end to end
+    for (MachAnyId mach = 0; mach < machCapacity; ++mach)
+    {
+        rSnapshotOut.portFirst[mach] = uint32_t(rSnapshotOut.ports.size());
+
+        if (rSrcNodes.machToNode.contains(mach))
+        {
+            Span<NodeId const> const portSpan = rSrcNodes.machToNode[mach];
+            rSnapshotOut.ports.insert(rSnapshotOut.ports.end(),
+                                      portSpan.begin(), portSpan.end());
+        }
+    }
+    rSnapshotOut.portFirst[machCapacity] = uint32_t(rSnapshotOut.ports.size());
+}
+
+void copy_nodes(
+        NodesSnapshot const &rSnapshot,
+        ArrayView<MachAnyId const> remapMach,
+        Nodes &rDstNodes,
+        Machines &rDstMach,
+        ArrayView<NodeId> remapNodeOut)
+{
+    using lgrn::Span;
+
+    // Snapshot node ids are dense, so creating new ids fills the remap as-is
+    rDstNodes.nodeIds.create(remapNodeOut.begin(),
+                             remapNodeOut.begin() + rSnapshot.nodeCount);
+
+    // Copy node-to-machine connections
+    rDstNodes.nodeToMach.ids_reserve(rDstNodes.nodeIds.capacity());
+    rDstNodes.nodeToMach.data_reserve(rDstNodes.nodeToMach.data_size()
+                                        + rSnapshot.juncs.size());
+    for (NodeId srcNode = 0; srcNode < rSnapshot.nodeCount; ++srcNode)
+    {
+        NodeId const    dstNode = remapNodeOut[srcNode];
+        uint32_t const  first   = rSnapshot.juncFirst[srcNode];
+        uint32_t const  count   = rSnapshot.juncFirst[srcNode + 1] - first;
+
+        rDstNodes.nodeToMach.emplace(dstNode, count);
+        Span<Junction> dstJunction = rDstNodes.nodeToMach[dstNode];
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            NodesSnapshot::Junc const junc      = rSnapshot.juncs[first + i];
+            MachAnyId const           dstMach   = remapMach[junc.mach];
+
+            dstJunction[i] = { .local  = rDstMach.machToLocal[dstMach],
+                               .type   = junc.type,
+                               .custom = junc.custom };
+        }
+    }
+
+    // Copy mach-to-node connections
+    rDstNodes.machToNode.ids_reserve(rDstMach.ids.capacity());
+    rDstNodes.machToNode.data_reserve(rDstNodes.machToNode.data_size()
+                                        + rSnapshot.ports.size());
+    for (MachAnyId srcMach = 0; srcMach < rSnapshot.portFirst.size() - 1; ++srcMach)
+    {
+        uint32_t const first = rSnapshot.portFirst[srcMach];
+        uint32_t const count = rSnapshot.portFirst[srcMach + 1] - first;
+        if (count == 0)
+        {
+            continue;
+        }
+
+        MachAnyId const dstMach = remapMach[srcMach];
+        rDstNodes.machToNode.emplace(dstMach, count);
+        Span<NodeId> dstPorts = rDstNodes.machToNode[dstMach];
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            NodeId const srcNode = rSnapshot.ports[first + i];
+            dstPorts[i] = (srcNode != lgrn::id_null<NodeId>())
+                        ? remapNodeOut[srcNode]
+                        : lgrn::id_null<NodeId>();
+        }
+    }
+}
+
 } // namespace osp::link
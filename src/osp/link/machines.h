@@ -77,6 +77,12 @@ struct Machines
     std::vector<PerMachType>            perType;
 };
 
+struct MachinePair
+{
+    MachLocalId     local   {lgrn::id_null<MachLocalId>()};
+    MachTypeId      type    {lgrn::id_null<MachTypeId>()};
+};
+
 struct MachineUpdater
 {
     alignas(64) std::atomic<bool> requestMachineUpdateLoop {false};
@@ -85,12 +91,21 @@ struct MachineUpdater
 
     // [MachTypeId][MachLocalId]
     osp::KeyedVec<MachTypeId, BitVector_t> localDirty;
-};
 
-struct MachinePair
-{
-    MachLocalId     local   {lgrn::id_null<MachLocalId>()};
-    MachTypeId      type    {lgrn::id_null<MachTypeId>()};
+    /// Topological rank of each machine in the signal link graph, rebuilt on
+    /// vehicle spawn by build_machine_ranks (signal.h)
+    osp::KeyedVec<MachAnyId, uint8_t> machRank;
+
+    /// [rank] -> Machines notified of new input, held back until the settling
+    /// pass matching their rank so each updates once with all inputs written
+    std::vector<std::vector<MachinePair>> machDeferred;
+
+    /// [MachTypeId] -> scratch for batch_dirty_machines, written by each
+    /// machine type's own update task
+    osp::KeyedVec<MachTypeId, std::vector<MachLocalId>> localDirtyIds;
+
+    /// Current settling pass of the frame's link update loop
+    uint8_t linkPass {0};
 };
 
 struct Junction
@@ -128,11 +143,58 @@ struct PortEntry
     JuncCustom  custom;
 };
 
+/**
+ * @brief Flat relocatable snapshot of one node type's connectivity
+ *
+ * Compiled once when a vehicle is finalized. Node ids are dense, junctions
+ * store machine ids directly, and port spans are packed into one array, so
+ * spawning a copy bulk-creates the node id range and streams these arrays
+ * through the spawn remap tables instead of re-walking builder maps.
+ */
+struct NodesSnapshot
+{
+    struct Junc
+    {
+        MachAnyId   mach    {lgrn::id_null<MachAnyId>()};
+        MachTypeId  type    {lgrn::id_null<MachTypeId>()};
+        JuncCustom  custom  {0};
+    };
+
+    /// Node ids are dense [0, nodeCount)
+    uint32_t                nodeCount {0};
+
+    /// [NodeId] -> start offset into juncs; sized nodeCount + 1
+    std::vector<uint32_t>   juncFirst;
+    std::vector<Junc>       juncs;
+
+    /// [MachAnyId] -> start offset into ports; sized machine capacity + 1
+    std::vector<uint32_t>   portFirst;
+    std::vector<NodeId>     ports;
+};
+
 inline NodeId connected_node(lgrn::Span<NodeId const> portSpan, PortId port) noexcept
 {
     return (portSpan.size() > port) ? portSpan[port] : lgrn::id_null<NodeId>();
 }
 
+/**
+ * @brief Gather a machine type's dirty bits into a sorted contiguous id span
+ *
+ * Batch update kernels take the returned span and run one tight loop over all
+ * dirty machines of a type, instead of testing bits inside the math.
+ */
+inline ArrayView<MachLocalId const> batch_dirty_machines(
+        MachineUpdater &rUpdMach, MachTypeId type)
+{
+    std::vector<MachLocalId> &rIds = rUpdMach.localDirtyIds[type];
+    rIds.clear();
+    for (MachLocalId const local : rUpdMach.localDirty[type].ones())
+    {
+        rIds.push_back(local);
+    }
+    return {rIds.data(), rIds.size()};
+}
+
 void copy_machines(
         Machines const &rSrc,
         Machines &rDst,
@@ -146,5 +208,23 @@ void copy_nodes(
         Machines &rDstMach,
         ArrayView<NodeId> remapNodeOut);
 
+/**
+ * @brief Flatten a finalized vehicle's node connectivity into a NodesSnapshot
+ *
+ * Node ids must be dense, which holds for VehicleBuilder data since builder
+ * ids are created sequentially and never deleted.
+ */
+void snapshot_nodes(
+        Nodes const &rSrcNodes,
+        Machines const &rSrcMach,
+        NodesSnapshot &rSnapshotOut);
+
+void copy_nodes(
+        NodesSnapshot const &rSnapshot,
+        ArrayView<MachAnyId const> remapMach,
+        Nodes &rDstNodes,
+        Machines &rDstMach,
+        ArrayView<NodeId> remapNodeOut);
+
 
 } // namespace osp::wire
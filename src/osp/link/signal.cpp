@@ -0,0 +1,295 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "signal.h"
+
+#include <algorithm>
+
+namespace osp::link
+{
+
+uint8_t build_machine_ranks(
+        Machines const&                     machines,
+        KeyedVec<NodeTypeId, Nodes> const&  nodesPerType,
+        KeyedVec<MachAnyId, uint8_t>&       rRanks)
+{
+    constexpr uint8_t sc_rankMax = 255;
+
+    std::size_t const machCapacity = machines.ids.capacity();
+
+    rRanks.clear();
+    rRanks.resize(machCapacity, 0);
+
+    if (machCapacity == 0)
+    {
+        return 0;
+    }
+
+    // Machines with no sig-in junctions are only ever written from outside
+    // the link update loop; they never update in a settling pass, so they
+    // don't add a level to the chains below them and are left out of the graph
+    std::vector<uint8_t> hasInput(machCapacity, 0);
+
+    for (Nodes const& rNodes : nodesPerType)
+    {
+        for (NodeId node = 0; node < rNodes.nodeIds.capacity(); ++node)
+        {
+            if ( ! rNodes.nodeToMach.contains(node))
+            {
+                continue;
+            }
+            for (Junction const junc : rNodes.nodeToMach[node])
+            {
+                if (junc.custom == gc_sigIn)
+                {
+                    hasInput[machines.perType[junc.type].localToAny[junc.local]] = 1;
+                }
+            }
+        }
+    }
+
+    // Build writer->reader edges in a CSR layout; one edge per
+    // (sig-out, sig-in) junction pair sharing a node
+    std::vector<uint32_t>   edgeFirst(machCapacity + 1, 0);
+    std::vector<uint32_t>   depCount (machCapacity, 0);
+    std::vector<MachAnyId>  writers;
+    std::vector<MachAnyId>  readers;
+
+    for (Nodes const& rNodes : nodesPerType)
+    {
+        for (NodeId node = 0; node < rNodes.nodeIds.capacity(); ++node)
+        {
+            if ( ! rNodes.nodeToMach.contains(node))
+            {
+                continue;
+            }
+
+            writers.clear();
+            readers.clear();
+            for (Junction const junc : rNodes.nodeToMach[node])
+            {
+                MachAnyId const mach = machines.perType[junc.type].localToAny[junc.local];
+                if (junc.custom == gc_sigOut && hasInput[mach] != 0)
+                {
+                    writers.push_back(mach);
+                }
+                else if (junc.custom == gc_sigIn)
+                {
+                    readers.push_back(mach);
+                }
+            }
+
+            for (MachAnyId const writer : writers)
+            {
+                edgeFirst[writer + 1] += uint32_t(readers.size());
+            }
+            for (MachAnyId const reader : readers)
+            {
+                depCount[reader] += uint32_t(writers.size());
+            }
+        }
+    }
+
+    for (MachAnyId mach = 0; mach < machCapacity; ++mach)
+    {
+        edgeFirst[mach + 1] += edgeFirst[mach];
+    }
+
+    std::vector<uint32_t>   edgeCursor(edgeFirst.begin(), std::prev(edgeFirst.end()));
+    std::vector<MachAnyId>  edges(edgeFirst[machCapacity]);
+
+    for (Nodes const& rNodes : nodesPerType)
+    {
+        for (NodeId node = 0; node < rNodes.nodeIds.capacity(); ++node)
+        {
+            if ( ! rNodes.nodeToMach.contains(node))
+            {
+                continue;
+            }
+
+            writers.clear();
+            readers.clear();
+            for (Junction const junc : rNodes.nodeToMach[node])
+            {
+                MachAnyId const mach = machines.perType[junc.type].localToAny[junc.local];
+                if (junc.custom == gc_sigOut && hasInput[mach] != 0)
+                {
+                    writers.push_back(mach);
+                }
+                else if (junc.custom == gc_sigIn)
+                {
+                    readers.push_back(mach);
+                }
+            }
+
+            for (MachAnyId const writer : writers)
+            {
+                for (MachAnyId const reader : readers)
+                {
+                    edges[edgeCursor[writer]] = reader;
+                    ++edgeCursor[writer];
+                }
+            }
+        }
+    }
+
+    // Kahn's algorithm; machines are released in dependency order, making
+    // each rank the longest writer chain leading to that machine
+    std::vector<MachAnyId> released;
+    released.reserve(machCapacity);
+    for (MachAnyId mach = 0; mach < machCapacity; ++mach)
+    {
+        if (machines.ids.exists(mach) && hasInput[mach] != 0 && depCount[mach] == 0)
+        {
+            released.push_back(mach);
+        }
+    }
+
+    for (std::size_t i = 0; i < released.size(); ++i)
+    {
+        MachAnyId const mach = released[i];
+        uint8_t const nextRank = (rRanks[mach] < sc_rankMax) ? uint8_t(rRanks[mach] + 1)
+                                                             : sc_rankMax;
+        for (uint32_t edge = edgeFirst[mach]; edge < edgeFirst[mach + 1]; ++edge)
+        {
+            MachAnyId const reader = edges[edge];
+            rRanks[reader] = std::max(rRanks[reader], nextRank);
+
+            --depCount[reader];
+            if (depCount[reader] == 0)
+            {
+                released.push_back(reader);
+            }
+        }
+    }
+
+    // Machines still blocked sit on feedback loops. They all get the highest
+    // rank; once the settling pass reaches it they iterate as before
+    uint8_t rankMax     = 0;
+    bool    anyBlocked  = false;
+    bool    anyRanked   = false;
+    for (MachAnyId mach = 0; mach < machCapacity; ++mach)
+    {
+        if (machines.ids.exists(mach) && hasInput[mach] != 0)
+        {
+            anyRanked = true;
+            if (depCount[mach] != 0)
+            {
+                anyBlocked = true;
+            }
+            else
+            {
+                rankMax = std::max(rankMax, rRanks[mach]);
+            }
+        }
+    }
+
+    if (anyBlocked)
+    {
+        uint8_t const cycleRank = (rankMax < sc_rankMax) ? uint8_t(rankMax + 1)
+                                                         : sc_rankMax;
+        for (MachAnyId mach = 0; mach < machCapacity; ++mach)
+        {
+            if (machines.ids.exists(mach) && hasInput[mach] != 0 && depCount[mach] != 0)
+            {
+                rRanks[mach] = cycleRank;
+            }
+        }
+        rankMax = cycleRank;
+    }
+
+    return anyRanked ? uint8_t(std::min<int>(int(rankMax) + 1, sc_rankMax)) : 0;
+}
+
+void build_signal_subscribers(
+        Nodes const&                        nodes,
+        Machines const&                     machines,
+        KeyedVec<MachAnyId, uint8_t> const& machRank,
+        SignalSubscribers&                  rSubs)
+{
+    std::size_t const capacity = nodes.nodeIds.capacity();
+
+    rSubs.subFirst.resize(capacity + 1);
+    rSubs.subs.clear();
+    rSubs.subRank.clear();
+
+    for (NodeId node = 0; node < capacity; ++node)
+    {
+        rSubs.subFirst[node] = uint32_t(rSubs.subs.size());
+
+        if ( ! nodes.nodeToMach.contains(node))
+        {
+            continue;
+        }
+
+        for (Junction const junc : nodes.nodeToMach[node])
+        {
+            if (junc.custom == gc_sigIn)
+            {
+                MachAnyId const mach = machines.perType[junc.type].localToAny[junc.local];
+                rSubs.subs.push_back({ .local = junc.local, .type = junc.type });
+                rSubs.subRank.push_back(machRank[mach]);
+            }
+        }
+    }
+    rSubs.subFirst[capacity] = uint32_t(rSubs.subs.size());
+}
+
+void build_signal_port_table(
+        Nodes const&        nodes,
+        Machines const&     machines,
+        MachTypeId          type,
+        PortId              portCount,
+        SignalPortTable&    rTable)
+{
+    PerMachType const& perType = machines.perType[type];
+    std::size_t const machCapacity = perType.localIds.capacity();
+
+    rTable.machCapacity = machCapacity;
+    rTable.nodes.assign(std::size_t(portCount) * machCapacity,
+                        lgrn::id_null<NodeId>());
+
+    for (MachLocalId local = 0; local < machCapacity; ++local)
+    {
+        if ( ! perType.localIds.exists(local))
+        {
+            continue;
+        }
+
+        MachAnyId const mach = perType.localToAny[local];
+        if ( ! nodes.machToNode.contains(mach))
+        {
+            continue;
+        }
+
+        lgrn::Span<NodeId const> const portSpan = nodes.machToNode[mach];
+        for (PortId port = 0; port < portCount; ++port)
+        {
+            rTable.nodes[std::size_t(port) * machCapacity + local]
+                    = connected_node(portSpan, port);
+        }
+    }
+}
+
+} // namespace osp::link
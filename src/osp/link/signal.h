@@ -51,35 +51,153 @@ struct UpdateNodes
     }
 };
 
+/**
+ * @brief Per-machine-type staging for new signal values, with a publish
+ *        generation
+ *
+ * Each machine type stages writes into its own UpdateNodes slot, so update
+ * tasks of independent types can run in parallel without locking shared node
+ * storage. The link loop's node-update stage merges every dirty slot into the
+ * published SignalValues_t and advances readGen; readers within a stage
+ * always observe one consistent generation.
+ */
+template <typename VALUE_T>
+struct UpdateNodesStaged
+{
+    /// [MachTypeId] -> that type's private staging buffer
+    KeyedVec<MachTypeId, UpdateNodes<VALUE_T>> perType;
+
+    /// Generation of the published values, advanced once per merge by the
+    /// node-update stage
+    uint64_t readGen {0};
+
+    bool any_dirty() const noexcept
+    {
+        for (UpdateNodes<VALUE_T> const& rSlot : perType)
+        {
+            if (rSlot.dirty)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Flattened per-node lists of signal-reading machines
+ *
+ * CSR-style rebuild of Nodes::nodeToMach that keeps only gc_sigIn junctions,
+ * so propagating a dirty node is a linear sweep over one contiguous span
+ * instead of filtering the full junction list every update. Connections only
+ * change on vehicle spawn/despawn; rebuild with build_signal_subscribers
+ * after those.
+ */
+struct SignalSubscribers
+{
+    /// [NodeId] -> start offset into subs. Sized node capacity + 1 so
+    /// subFirst[node + 1] is always the end offset
+    KeyedVec<NodeId, uint32_t>  subFirst;
+
+    /// Sig-in machines of every node, grouped by node
+    std::vector<MachinePair>    subs;
+
+    /// Topological rank of each subs entry, from MachineUpdater::machRank
+    std::vector<uint8_t>        subRank;
+};
+
+/**
+ * @brief Assign each machine a topological rank in the signal link graph
+ *
+ * A machine's rank is the longest chain of signal-writing machines feeding
+ * its inputs, counting only machines that can themselves update in the link
+ * loop (those with at least one sig-in junction). update_signal_nodes holds
+ * a machine's dirty notification back until the settling pass matching its
+ * rank, so each machine updates once with all inputs written instead of once
+ * per dirtied input. Machines on feedback loops all get the highest rank and
+ * settle iteratively as before.
+ *
+ * @return Number of settling passes needed to cover every rank
+ */
+uint8_t build_machine_ranks(
+        Machines const&                     machines,
+        KeyedVec<NodeTypeId, Nodes> const&  nodesPerType,
+        KeyedVec<MachAnyId, uint8_t>&       rRanks);
+
+void build_signal_subscribers(
+        Nodes const&                        nodes,
+        Machines const&                     machines,
+        KeyedVec<MachAnyId, uint8_t> const& machRank,
+        SignalSubscribers&                  rSubs);
+
+/**
+ * @brief Port-major table of the nodes connected to every machine of one type
+ *
+ * Rebuilt on vehicle spawn from Nodes::machToNode. Each port's column stores
+ * the connected node of every machine of the type consecutively by local id,
+ * so update kernels stream whole port columns at a fixed stride instead of
+ * chasing per-machine port spans.
+ */
+struct SignalPortTable
+{
+    /// [port * machCapacity + MachLocalId] -> connected node, or id_null
+    std::vector<NodeId> nodes;
+    std::size_t         machCapacity {0};
+
+    NodeId get(PortId port, MachLocalId local) const noexcept
+    {
+        return nodes[std::size_t(port) * machCapacity + local];
+    }
+};
+
+void build_signal_port_table(
+        Nodes const&        nodes,
+        Machines const&     machines,
+        MachTypeId          type,
+        PortId              portCount,
+        SignalPortTable&    rTable);
+
 template <typename VALUE_T, typename RANGE_T>
 bool update_signal_nodes(
         RANGE_T const&                  toUpdate,
-        Nodes::NodeToMach_t const&      nodeToMach,
-        Machines const&                 machines,
+        SignalSubscribers const&        subscribers,
         ArrayView<VALUE_T const>        newValues,
         ArrayView<VALUE_T>              currentValues,
         MachineUpdater&                 rUpdMach)
 {
     bool somethingNotified = false;
+    uint8_t const pass = rUpdMach.linkPass;
 
     for (uint32_t const node : toUpdate)
     {
         // Apply node value changes
         currentValues[node] = newValues[node];
 
-        // Notify connected inputs
-        for (Junction junc : nodeToMach[node])
+        // Notify subscribed inputs. Junctions were filtered down to sig-in
+        // when the subscriber lists were built, so no per-junction branch here
+        uint32_t const first = subscribers.subFirst[node];
+        uint32_t const last  = subscribers.subFirst[node + 1];
+
+        for (uint32_t i = first; i < last; ++i)
         {
-            if (junc.custom == gc_sigIn)
+            MachinePair const sub = subscribers.subs[i];
+
+            // Machines deeper in the link graph hold off until the settling
+            // pass matching their rank, once all of their inputs are written
+            uint8_t const rank = subscribers.subRank[i];
+            if (rank > pass)
             {
-                somethingNotified = true;
+                rUpdMach.machDeferred[rank].push_back(sub);
+                continue;
+            }
 
-                // A machine of type "junc.m_type" has new values to read
-                rUpdMach.machTypesDirty.set(junc.type);
+            somethingNotified = true;
 
-                // Specify using local Id on which machine needs to update
-                rUpdMach.localDirty[junc.type].set(junc.local);
-            }
+            // A machine of type "sub.type" has new values to read
+            rUpdMach.machTypesDirty.set(sub.type);
+
+            // Specify using local Id on which machine needs to update
+            rUpdMach.localDirty[sub.type].set(sub.local);
         }
     }
 
@@ -26,29 +26,95 @@
 #include "shapes.h"
 
 #include <cassert>
+#include <cstddef>
 
 namespace osp
 {
 
+static constexpr float sc_pi = Magnum::Math::Constants<Magnum::Float>::pi();
+
+// Number of EShape values; tables below are indexed by the enum
+static constexpr std::size_t sc_shapeCount = 6;
+
+// volume = coeff * sx * sy * sz. Default primitives are 2x2x2 bounding boxes (see
+// shape_volume doc comment), so the sphere is radius 1, the box 2x2x2, and the cylinder
+// radius 1 height 2. Shapes without an analytic volume (None, Custom, Capsule) get zero.
+static constexpr std::array<float, sc_shapeCount> sc_volumeCoeff
+{
+    0.0f,                   // None
+    0.0f,                   // Custom
+    (4.0f / 3.0f) * sc_pi,  // Sphere (as ellipsoid semiaxes sx, sy, sz)
+    8.0f,                   // Box
+    0.0f,                   // Capsule (TODO)
+    2.0f * sc_pi,           // Cylinder (assumes sy == sx)
+};
+
+// inertia[axis] = mass * (row[3*axis+0]*sx^2 + row[3*axis+1]*sy^2 + row[3*axis+2]*sz^2),
+// the closed-form tensors from the constexpr *_inertia_tensor functions with the default
+// primitive dimensions substituted in
+static constexpr std::array<std::array<float, 9>, sc_shapeCount> sc_inertiaCoeff
+{{
+    {},                                 // None
+    {},                                 // Custom
+    { 0.0f,        1.0f / 5.0f, 1.0f / 5.0f,    // Sphere
+      1.0f / 5.0f, 0.0f,        1.0f / 5.0f,
+      1.0f / 5.0f, 1.0f / 5.0f, 0.0f        },
+    { 0.0f,        1.0f / 3.0f, 1.0f / 3.0f,    // Box (dimensions 2*scale)
+      1.0f / 3.0f, 0.0f,        1.0f / 3.0f,
+      1.0f / 3.0f, 1.0f / 3.0f, 0.0f        },
+    {},                                 // Capsule (TODO)
+    { 1.0f / 4.0f, 0.0f,        1.0f / 3.0f,    // Cylinder (radius sx, height 2*sz)
+      1.0f / 4.0f, 0.0f,        1.0f / 3.0f,
+      1.0f / 2.0f, 0.0f,        0.0f        },
+}};
+
 float shape_volume(EShape shape, Vector3 scale)
 {
-    static constexpr float sc_pi = Magnum::Math::Constants<Magnum::Float>::pi();
-    switch (shape)
+    float const coeff = sc_volumeCoeff[std::size_t(shape)];
+    return coeff * scale.x() * scale.y() * scale.z();
+}
+
+void shape_volume_batch(
+        ArrayView<EShape const>  const shapes,
+        ArrayView<Vector3 const> const scales,
+        ArrayView<float>         const volumesOut) noexcept
+{
+    assert(shapes.size() == scales.size());
+    assert(shapes.size() == volumesOut.size());
+
+    for (std::size_t i = 0; i < shapes.size(); ++i)
     {
-    case EShape::None:
-        return 0.0f;
-    case EShape::Sphere:
-        // Default radius: 1
-        return (4.0f / 3.0f) * sc_pi * scale.x() * scale.x() * scale.x();
-    case EShape::Box:
-        // Default width: 2
-        return 2.0f*scale.x() * 2.0f*scale.y() * 2.0f*scale.z();
-    case EShape::Cylinder:
-        // Default radius: 1, default height: 2
-        return sc_pi * scale.x() * scale.x() * 2.0f*scale.z();
-    default:
-        return 0.0f;
-    }   
+        Vector3 const scale = scales[i];
+        volumesOut[i] = sc_volumeCoeff[std::size_t(shapes[i])]
+                      * scale.x() * scale.y() * scale.z();
+    }
+}
+
+void collider_inertia_tensor_batch(
+        ArrayView<EShape const>  const shapes,
+        ArrayView<Vector3 const> const scales,
+        ArrayView<float const>   const masses,
+        ArrayView<Vector3>       const inertiaOut) noexcept
+{
+    assert(shapes.size() == scales.size());
+    assert(shapes.size() == masses.size());
+    assert(shapes.size() == inertiaOut.size());
+
+    for (std::size_t i = 0; i < shapes.size(); ++i)
+    {
+        std::array<float, 9> const &row = sc_inertiaCoeff[std::size_t(shapes[i])];
+
+        Vector3 const scale = scales[i];
+        float const sx2 = scale.x() * scale.x();
+        float const sy2 = scale.y() * scale.y();
+        float const sz2 = scale.z() * scale.z();
+        float const mass = masses[i];
+
+        inertiaOut[i] = Vector3{
+                mass * (row[0]*sx2 + row[1]*sy2 + row[2]*sz2),
+                mass * (row[3]*sx2 + row[4]*sy2 + row[5]*sz2),
+                mass * (row[6]*sx2 + row[7]*sy2 + row[8]*sz2)};
+    }
 }
 
 Matrix3 transform_inertia_tensor(Matrix3 I, float mass, Vector3 translation, Matrix3 rotation)
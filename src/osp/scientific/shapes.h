@@ -24,8 +24,11 @@
  */
 #pragma once
 
+#include "../core/array_view.h"
 #include "../core/math_types.h"
 
+#include <array>
+
 namespace osp
 {
 
@@ -92,6 +95,32 @@ Matrix3 transform_inertia_tensor(Matrix3 I, float mass,
  */
 Vector3 collider_inertia_tensor(EShape shape, Vector3 scale, float mass);
 
+/**
+ * @brief Batched shape_volume over parallel spans
+ *
+ * The per-shape constants live in a constexpr table indexed by EShape, making the loop
+ * branch-free multiply-adds that compilers readily vectorize. Shapes without an analytic
+ * volume (None, Custom, Capsule) yield zero, matching shape_volume.
+ *
+ * All spans must be the same length.
+ */
+void shape_volume_batch(
+        ArrayView<EShape const>  shapes,
+        ArrayView<Vector3 const> scales,
+        ArrayView<float>         volumesOut) noexcept;
+
+/**
+ * @brief Batched collider_inertia_tensor over parallel spans
+ *
+ * One branch-free sweep for whole-vehicle mass property computation; see
+ * shape_volume_batch. All spans must be the same length.
+ */
+void collider_inertia_tensor_batch(
+        ArrayView<EShape const>  shapes,
+        ArrayView<Vector3 const> scales,
+        ArrayView<float const>   masses,
+        ArrayView<Vector3>       inertiaOut) noexcept;
+
 /**
  * Compute the inertia tensor for a cylinder
  *
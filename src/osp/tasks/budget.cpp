@@ -0,0 +1,74 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "budget.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace osp
+{
+
+void frame_budget_update(Tasks const& tasks, ExecContext const& rExec, FrameBudget& rBudget)
+{
+    rBudget.pipelineMs.resize(tasks.m_pipelineIds.capacity());
+    std::fill(rBudget.pipelineMs.begin(), rBudget.pipelineMs.end(), 0.0f);
+
+    // Tasks not yet observed by the executor have a zero EWMA and contribute nothing,
+    // so a fresh graph ramps pressure up smoothly as durations come in.
+    float frameMs = 0.0f;
+    for (TaskInt const taskInt : tasks.m_taskIds.bitview().zeros())
+    {
+        auto const task = TaskId(taskInt);
+        float const durationMs = (taskInt < rExec.taskDurationEwma.size())
+                               ? rExec.taskDurationEwma[task] : 0.0f;
+
+        PipelineId const pipeline = tasks.m_taskRunOn[task].pipeline;
+        if (pipeline != lgrn::id_null<PipelineId>())
+        {
+            rBudget.pipelineMs[pipeline] += durationMs;
+        }
+        frameMs += durationMs;
+    }
+
+    // Same first-sample-snap blend the executors use for per-task durations
+    rBudget.frameMsEwma = (rBudget.frameMsEwma == 0.0f)
+                        ? frameMs
+                        : rBudget.frameMsEwma + 0.125f * (frameMs - rBudget.frameMsEwma);
+
+    rBudget.pressure = rBudget.frameMsEwma / rBudget.budgetMs;
+
+    for (FrameBudget::Listener &rListener : rBudget.listeners)
+    {
+        if (std::abs(rBudget.pressure - rListener.lastNotified) < rListener.deadband)
+        {
+            continue;
+        }
+
+        rListener.lastNotified = rBudget.pressure;
+        rListener.func(rBudget, rListener.userData);
+    }
+}
+
+} // namespace osp
@@ -0,0 +1,89 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "execute.h"
+#include "tasks.h"
+
+#include "../core/keyed_vector.h"
+
+#include <array>
+#include <vector>
+
+namespace osp
+{
+
+/**
+ * @brief Frame-time budget governor state
+ *
+ * Aggregates the executor's per-task duration EWMAs (ExecContext::taskDurationEwma) into
+ * per-pipeline totals and a whole-frame cost estimate, then exposes the ratio of that
+ * estimate to the frame budget as a "pressure" value. Systems that can trade resolution
+ * for time (terrain subdivision thresholds, LOD selection) register listeners against it,
+ * so the engine degrades detail instead of frame rate when over budget.
+ */
+struct FrameBudget
+{
+    using UserData_t = std::array<void*, 4>;
+    using ListenerFunc_t = void (*)(FrameBudget const& budget, UserData_t userData) noexcept;
+
+    struct Listener
+    {
+        ListenerFunc_t  func        {nullptr};
+        UserData_t      userData    {{nullptr, nullptr, nullptr, nullptr}};
+
+        /// Pressure must move at least this far from the value last notified before the
+        /// listener fires again; avoids re-tuning detail every frame over measurement noise
+        float           deadband        {0.05f};
+        float           lastNotified    {-1.0f};
+    };
+
+    /// Target frame time in milliseconds
+    float budgetMs {16.0f};
+
+    /// [PipelineId] -> summed EWMA duration (ms) of every task that runs on the pipeline.
+    /// Recalculated from scratch each update; diagnostics and listeners may read it to
+    /// find out where the frame is going.
+    KeyedVec<PipelineId, float> pipelineMs;
+
+    /// EWMA of the estimated total frame cost in milliseconds
+    float frameMsEwma {0.0f};
+
+    /// frameMsEwma / budgetMs; exactly on budget at 1.0, over budget above it
+    float pressure {0.0f};
+
+    std::vector<Listener> listeners;
+};
+
+/**
+ * @brief Recalculate budget pressure from the executor's task timing data, and notify
+ *        listeners whose pressure deadband was exceeded
+ *
+ * Intended to run once per frame after tasks have completed, on the thread that owns the
+ * ExecContext.
+ */
+void frame_budget_update(Tasks const& tasks, ExecContext const& rExec, FrameBudget& rBudget);
+
+} // namespace osp
@@ -71,6 +71,36 @@ struct TaskBuilderBase
         };
     }
 
+    /**
+     * @brief Create many tasks in one shot
+     *
+     * Bulk-allocates the id range and resizes per-task storage once, instead of the
+     * create/resize cycle task() does per task. Sessions registering dozens of near-identical
+     * tasks should create them here, then configure each through task(TaskId).
+     */
+    void create_tasks(ArrayView<TaskId> const tasksOut)
+    {
+        m_rTasks.m_taskIds.create(tasksOut.begin(), tasksOut.end());
+
+        std::size_t const capacity = m_rTasks.m_taskIds.capacity();
+
+        m_rTasks.m_taskRunOn   .resize(capacity);
+        m_rTasks.m_taskCostHint.resize(capacity, 0.0f);
+
+        static_cast<Builder_t&>(*this).reserve_task_data(capacity);
+    }
+
+    template <std::size_t N>
+    [[nodiscard]] std::array<TaskId, N> create_tasks()
+    {
+        std::array<TaskId, N> out;
+        create_tasks(ArrayView<TaskId>{out.data(), N});
+        return out;
+    }
+
+    /// Overridden by builders that own per-task storage (see TopTaskBuilder)
+    void reserve_task_data([[maybe_unused]] std::size_t capacity) { }
+
     template <typename ENUM_T>
     [[nodiscard]] constexpr PipelineRef_t<ENUM_T> pipeline(PipelineDef<ENUM_T> pipelineDef) noexcept
     {
@@ -186,6 +216,17 @@ struct TaskRefBase
         return run_on(tpl);
     }
 
+    /**
+     * @brief Set an estimated cost (milliseconds) used for critical-path-first scheduling
+     */
+    TaskRef_t& cost(float const costMs) noexcept
+    {
+        m_rBuilder.m_rTasks.m_taskCostHint.resize(m_rBuilder.m_rTasks.m_taskIds.capacity(), 0.0f);
+        m_rBuilder.m_rTasks.m_taskCostHint[m_taskId] = costMs;
+
+        return static_cast<TaskRef_t&>(*this);
+    }
+
     TaskRef_t& sync_with(ArrayView<TplPipelineStage const> const specs) noexcept
     {
         return add_edges(m_rBuilder.m_rEdges.m_syncWith, specs);
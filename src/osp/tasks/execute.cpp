@@ -42,10 +42,12 @@ static void pipeline_advance_reqs(Tasks const& tasks, TaskGraph const& graph, Ex
 
 static void pipeline_advance_run(Tasks const& tasks, TaskGraph const& graph, ExecContext &rExec, PipelineId pipeline) noexcept;
 
-static constexpr bool pipeline_can_advance(ExecPipeline &rExecPl) noexcept;
+static bool pipeline_can_advance(ExecPipeline &rExecPl) noexcept;
 
 static void pipeline_try_advance(ExecContext &rExec, ExecPipeline &rExecPl, PipelineId pipeline) noexcept;
 
+static void drain_pending_advance(ExecContext &rExec) noexcept;
+
 static void pipeline_cancel(Tasks const& tasks, TaskGraph const& graph, ExecContext& rExec, ExecPipeline& rExecPl, PipelineId pipeline) noexcept;
 
 struct ArgsForIsPipelineInLoop
@@ -71,6 +73,8 @@ static void subtree_for_each(ArgsForSubtreeForEach args, TaskGraph const& graph,
 
 void exec_update(Tasks const& tasks, TaskGraph const& graph, ExecContext &rExec) noexcept
 {
+    rExec.updateTime = std::chrono::steady_clock::now();
+
     exec_log(rExec, ExecContext::UpdateStart{});
 
     if (rExec.hasRequestRun)
@@ -90,6 +94,8 @@ void exec_update(Tasks const& tasks, TaskGraph const& graph, ExecContext &rExec)
     }
 
 
+    drain_pending_advance(rExec);
+
     while (rExec.hasPlAdvanceOrLoop)
     {
         exec_log(rExec, ExecContext::UpdateCycle{});
@@ -123,6 +129,8 @@ void exec_update(Tasks const& tasks, TaskGraph const& graph, ExecContext &rExec)
                   rExec.plAdvanceNext.ints().end(),
                   rExec.plAdvance    .ints().begin());
         rExec.plAdvanceNext.reset();
+
+        drain_pending_advance(rExec);
     }
 
     exec_log(rExec, ExecContext::UpdateEnd{});
@@ -244,8 +252,10 @@ static int pipeline_run(Tasks const& tasks, TaskGraph const& graph, ExecContext
     {
         if ( ! rExecPl.running )
         {
-            rExecPl.running  = true;
-            rExecPl.loop     = isLoopScope || insideLoopScope;
+            rExecPl.running            = true;
+            rExecPl.loop               = isLoopScope || insideLoopScope;
+            rExecPl.loopIterationsDone = 0;
+            rExecPl.lastAdvance.store(rExec.updateTime);
 
             ++ rExec.pipelinesRunning;
 
@@ -303,6 +313,8 @@ static int pipeline_run(Tasks const& tasks, TaskGraph const& graph, ExecContext
 
 static void loop_scope_done(Tasks const& tasks, TaskGraph const& graph, ExecContext &rExec, ExecPipeline &rExecPl, PipelineId const pipeline, PipelineTreePos_t const treePos)
 {
+    ++ rExecPl.loopIterationsDone;
+
     if ( ! rExecPl.canceled )
     {
         // Loop more
@@ -399,15 +411,29 @@ static void pipeline_advance_stage(Tasks const& tasks, TaskGraph const& graph, E
 
     bool const justStarting = rExecPl.stage == lgrn::id_null<StageId>();
 
-    auto const nextStage = StageId( justStarting ? 0 : (int(rExecPl.stage)+1) );
+    auto nextStage = StageId( justStarting ? 0 : (int(rExecPl.stage)+1) );
 
     rExecPl.tasksQueueDone = false;
+    rExecPl.lastAdvance.store(rExec.updateTime);
 
     if (rExecPl.stage == rExecPl.waitStage)
     {
         rExecPl.waitSignaled = false;
     }
 
+    // Fused advance through trivial stages (classified in make_exec_graph): nothing runs
+    // on them and no sync edges touch them, so hop through the whole run here instead of
+    // a full advance_stage/reqs/run round-trip per stage. Stops short of the wait stage,
+    // which must be entered normally so signal handling still applies.
+    while (   nextStage != StageId(stageCount)
+           && nextStage != rExecPl.waitStage
+           && graph.anystgTrivial[anystg_from(graph, pipeline, nextStage)] != 0)
+    {
+        exec_log(rExec, ExecContext::StageChange{pipeline, rExecPl.stage, nextStage});
+        rExecPl.stage = nextStage;
+        nextStage = StageId(int(nextStage) + 1);
+    }
+
     if (nextStage != StageId(stageCount))
     {
         exec_log(rExec, ExecContext::StageChange{pipeline, rExecPl.stage, nextStage});
@@ -442,6 +468,14 @@ static void pipeline_advance_reqs(Tasks const& tasks, TaskGraph const& graph, Ex
         return;
     }
 
+    if (graph.pipelineFastLane[pipeline] != 0)
+    {
+        // No sync edges touch this pipeline; both requirement scans below would find nothing
+        rExecPl.tasksReqOwnStageLeft = 0;
+        rExecPl.ownStageReqTasksLeft = 0;
+        return;
+    }
+
     AnyStageId const anystg = anystg_from(graph, pipeline, rExecPl.stage);
 
     // Evaluate Task-requires-Stages
@@ -768,16 +802,47 @@ static void pipeline_try_advance(ExecContext &rExec, ExecPipeline &rExecPl, Pipe
 {
     if (pipeline_can_advance(rExecPl))
     {
-        rExec.plAdvance.set(std::size_t(pipeline));
-        rExec.hasPlAdvanceOrLoop = true;
+        // Multiple workers can concurrently observe the counters hit zero. Exactly one wins
+        // the exchange and pushes the pipeline onto the lock-free pending-advance stack; the
+        // serial advance phase drains it via drain_pending_advance.
+        if ( ! rExecPl.advancePending.exchange(true) )
+        {
+            auto const plInt = PipelineInt(pipeline);
+
+            PipelineInt head = rExec.plAdvancePendingHead.load(std::memory_order_relaxed);
+            do
+            {
+                rExec.plAdvancePendingNext[pipeline] = head;
+            }
+            while ( ! rExec.plAdvancePendingHead.compare_exchange_weak(
+                            head, plInt,
+                            std::memory_order_release, std::memory_order_relaxed) );
+        }
     }
 };
 
+static void drain_pending_advance(ExecContext &rExec) noexcept
+{
+    PipelineInt head = rExec.plAdvancePendingHead.exchange(lgrn::id_null<PipelineInt>(),
+                                                           std::memory_order_acquire);
+    while (head != lgrn::id_null<PipelineInt>())
+    {
+        auto const pipeline = PipelineId(head);
+
+        rExec.plData[pipeline].advancePending.reset();
+
+        rExec.plAdvance.set(std::size_t(head));
+        rExec.hasPlAdvanceOrLoop = true;
+
+        head = rExec.plAdvancePendingNext[pipeline];
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 // Read-only checks
 
-static constexpr bool pipeline_can_advance(ExecPipeline &rExecPl) noexcept
+static bool pipeline_can_advance(ExecPipeline &rExecPl) noexcept
 {
     // Pipeline can advance if...
     return
@@ -896,6 +961,8 @@ void exec_conform(Tasks const& tasks, ExecContext &rOut)
     rOut.tasksQueuedRun    .reserve(maxTasks);
     rOut.tasksQueuedBlocked.reserve(maxTasks);
     rOut.plData.resize(maxPipeline);
+    rOut.taskDurationEwma.resize(maxTasks, 0.0f);
+    rOut.plAdvancePendingNext.resize(maxPipeline, lgrn::id_null<PipelineInt>());
     bitvector_resize(rOut.plAdvance,     maxPipeline);
     bitvector_resize(rOut.plAdvanceNext, maxPipeline);
     bitvector_resize(rOut.plRequestRun,  maxPipeline);
@@ -31,13 +31,116 @@
 
 #include <entt/entity/storage.hpp>
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <variant>
 #include <vector>
 
 namespace osp
 {
 
+/**
+ * @brief Copyable atomic int for ExecPipeline dependency counters
+ *
+ * Memory-ordering contract: worker threads report completion by decrementing counters with
+ * acq_rel, then re-checking pipeline_can_advance with acquire loads. The last decrement that
+ * brings all counters to zero is guaranteed to observe the all-zero state, so exactly one
+ * worker wins the race to mark the pipeline for advancement. All counter increments and plain
+ * assignments happen in the serial advance phase (exec_update), never concurrently with
+ * worker decrements of the same counter.
+ *
+ * Copy operations exist only to satisfy KeyedVec resizing, which is serial by contract.
+ */
+struct ExecCounter
+{
+    ExecCounter() noexcept = default;
+    ExecCounter(ExecCounter const& copy) noexcept { store(copy.load()); }
+    ExecCounter& operator=(ExecCounter const& copy) noexcept { store(copy.load()); return *this; }
+
+    int  load(std::memory_order order = std::memory_order_acquire) const noexcept
+    {
+        return m_value.load(order);
+    }
+
+    void store(int value, std::memory_order order = std::memory_order_release) noexcept
+    {
+        m_value.store(value, order);
+    }
+
+    ExecCounter& operator=(int const value) noexcept { store(value); return *this; }
+    operator int() const noexcept { return load(); }
+
+    /// @return Decremented value
+    int operator--() noexcept { return m_value.fetch_sub(1, std::memory_order_acq_rel) - 1; }
+
+    /// @return Incremented value
+    int operator++() noexcept { return m_value.fetch_add(1, std::memory_order_acq_rel) + 1; }
+
+private:
+    std::atomic<int> m_value { 0 };
+};
+
+/**
+ * @brief Copyable atomic flag; same serial-copy contract as ExecCounter
+ */
+struct ExecAtomicFlag
+{
+    ExecAtomicFlag() noexcept = default;
+    ExecAtomicFlag(ExecAtomicFlag const& copy) noexcept
+     : m_value{ copy.m_value.load(std::memory_order_relaxed) }
+    { }
+    ExecAtomicFlag& operator=(ExecAtomicFlag const& copy) noexcept
+    {
+        m_value.store(copy.m_value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    /// @return Previous value; acq_rel exchange so exactly one caller sees false
+    bool exchange(bool const value) noexcept
+    {
+        return m_value.exchange(value, std::memory_order_acq_rel);
+    }
+
+    void reset() noexcept { m_value.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<bool> m_value { false };
+};
+
+/**
+ * @brief Copyable atomic steady_clock timestamp; same serial-copy contract as ExecCounter
+ *
+ * Stored as the time_point's tick count so the stall watchdog thread can read it without a
+ * data race while the serial advance phase writes it.
+ */
+struct ExecTimestamp
+{
+    ExecTimestamp() noexcept = default;
+    ExecTimestamp(ExecTimestamp const& copy) noexcept
+     : m_ticks{ copy.m_ticks.load(std::memory_order_relaxed) }
+    { }
+    ExecTimestamp& operator=(ExecTimestamp const& copy) noexcept
+    {
+        m_ticks.store(copy.m_ticks.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    void store(std::chrono::steady_clock::time_point const time) noexcept
+    {
+        m_ticks.store(time.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    std::chrono::steady_clock::time_point load() const noexcept
+    {
+        return std::chrono::steady_clock::time_point{
+                std::chrono::steady_clock::duration{m_ticks.load(std::memory_order_relaxed)}};
+    }
+
+private:
+    std::atomic<std::chrono::steady_clock::rep> m_ticks { 0 };
+};
+
 /**
  * @brief Per-Pipeline state needed for execution
  */
@@ -45,10 +148,10 @@ struct ExecPipeline
 {
 
     /// Number of Tasks with satisfied dependencies that are ready to run
-    int             tasksQueuedRun          { 0 };
+    ExecCounter     tasksQueuedRun;
 
     ///< Number of Tasks waiting for their TaskReqStage dependencies to be satisfied
-    int             tasksQueuedBlocked      { 0 };
+    ExecCounter     tasksQueuedBlocked;
 
     /**
      * @brief Number of remaining TaskReqStage dependencies.
@@ -57,7 +160,7 @@ struct ExecPipeline
      * in order to run. This Pipeline has to wait for these tasks to complete before proceeding to
      * the next stage.
      */
-    int             tasksReqOwnStageLeft    { 0 };
+    ExecCounter     tasksReqOwnStageLeft;
 
     /**
      * @brief Number of remaining StageReqTask dependencies.
@@ -65,9 +168,21 @@ struct ExecPipeline
      * This Pipeline's current stage require Tasks from other Pipelines to complete in order to
      * proceed to the next stage.
      */
-    int             ownStageReqTasksLeft    { 0 };
+    ExecCounter     ownStageReqTasksLeft;
+
+    ExecCounter     loopChildrenLeft;
+
+    /// Set when this pipeline is on the pending-advance list; dedups concurrent
+    /// pipeline_try_advance calls so each pipeline is pushed at most once
+    ExecAtomicFlag  advancePending;
 
-    int             loopChildrenLeft        { 0 };
+    /// Completed loop iterations of this loop scope since it started running. Only maintained
+    /// for loop-scope pipelines; used to gate double-buffered frame overlap (see exec_loop_lag).
+    uint64_t        loopIterationsDone      { 0 };
+
+    /// Stamped with ExecContext::updateTime on every stage advance; one store, no clock read.
+    /// The stall watchdog (ExecStallWatchdog) flags running pipelines with old stamps.
+    ExecTimestamp   lastAdvance;
 
     StageId         stage                   { lgrn::id_null<StageId>() };
 
@@ -192,6 +307,54 @@ struct ExecLog
     bool                            doLogging{true};
 }; // struct ExecLog
 
+/**
+ * @brief Opt-in per-task timing log, written by executors around each task function call
+ *
+ * Events go into a preallocated ring buffer indexed by an atomic counter, so recording from
+ * concurrent workers is wait-free and never allocates. Disabled (zero-capacity) by default.
+ */
+struct ExecTimeLog
+{
+    using clock_t = std::chrono::steady_clock;
+
+    struct TaskTimeEvent
+    {
+        TaskId              task;
+        unsigned int        worker;
+        clock_t::time_point start;
+        clock_t::time_point end;
+    };
+
+    /// Preallocate the ring. Not thread-safe; call while no workers are running.
+    /// Zero capacity disables recording.
+    void resize(std::size_t const capacity)
+    {
+        events.clear();
+        events.resize(capacity);
+        eventsNext.store(0, std::memory_order_relaxed);
+    }
+
+    bool enabled() const noexcept { return ! events.empty(); }
+
+    /// Record one task execution. Safe to call from any worker thread.
+    void record(TaskId const task, unsigned int const worker,
+                clock_t::time_point const start, clock_t::time_point const end) noexcept
+    {
+        std::size_t const index = eventsNext.fetch_add(1, std::memory_order_relaxed);
+        events[index % events.size()] = {task, worker, start, end};
+    }
+
+    /// Number of events recorded so far; older ones past the ring capacity are overwritten
+    std::size_t count() const noexcept
+    {
+        return eventsNext.load(std::memory_order_relaxed);
+    }
+
+    std::vector<TaskTimeEvent>  events;
+    std::atomic<std::size_t>    eventsNext { 0 };
+
+}; // struct ExecTimeLog
+
 /**
  * @brief State for executing Tasks and TaskGraph
  */
@@ -206,12 +369,28 @@ struct ExecContext : public ExecLog
     BitVector_t                         plAdvanceNext;
     bool                                hasPlAdvanceOrLoop  {false};
 
+    /// Lock-free Treiber stack of pipelines marked for advancement by concurrent
+    /// complete_task calls. exec_update drains this into plAdvance single-threaded.
+    /// ExecPipeline::advancePending guarantees each pipeline is pushed at most once.
+    std::atomic<PipelineInt>            plAdvancePendingHead { lgrn::id_null<PipelineInt>() };
+    KeyedVec<PipelineId, PipelineInt>   plAdvancePendingNext;
+
     BitVector_t                         plRequestRun;
     std::vector<LoopRequestRun>         requestLoop;
     bool                                hasRequestRun {false};
 
     int                                 pipelinesRunning {0};
 
+    /// Sampled once at the start of exec_update; pipeline advances copy it into
+    /// ExecPipeline::lastAdvance so each advance costs a store instead of a clock read
+    std::chrono::steady_clock::time_point   updateTime {};
+
+    ExecTimeLog                         timeLog;
+
+    /// Exponentially-weighted moving average of observed task runtimes (milliseconds), updated
+    /// by executors. Combined with TaskGraph::taskPriority to order the ready queue.
+    KeyedVec<TaskId, float>             taskDurationEwma;
+
     // TODO: Consider multithreading. something something work stealing...
     //  * Allow multiple threads to search for and execute tasks. Atomic access
     //    for ExecContext? Might be messy to implement.
@@ -233,6 +412,20 @@ inline void exec_request_run(ExecContext &rExec, PipelineId pipeline) noexcept
 
 void exec_signal(ExecContext &rExec, PipelineId pipeline) noexcept;
 
+/**
+ * @brief Completed loop iterations 'leader' is ahead of 'follower'
+ *
+ * Supports double-buffered pipeline overlap: with scene-update and render as sibling loop
+ * scopes using double-buffered shared data instead of per-stage sync edges, the render
+ * scheduler task keeps at most one frame of lag by signaling/cancelling based on this value.
+ * Renderer consuming frame N while the scene updates frame N+1 is lag 1.
+ */
+inline int64_t exec_loop_lag(ExecContext const& exec, PipelineId const leader, PipelineId const follower) noexcept
+{
+    return int64_t(exec.plData[leader].loopIterationsDone)
+         - int64_t(exec.plData[follower].loopIterationsDone);
+}
+
 void exec_update(Tasks const& tasks, TaskGraph const& graph, ExecContext &rExec) noexcept;
 
 void complete_task(Tasks const& tasks, TaskGraph const& graph, ExecContext &rExec, TaskId task, TaskActions actions) noexcept;
@@ -0,0 +1,237 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2022 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "graph_cache.h"
+
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+namespace osp
+{
+
+// Bumped whenever the TaskGraph layout or this file format changes
+constexpr std::uint32_t gc_graphCacheVersion = 3;
+constexpr std::uint32_t gc_graphCacheMagic   = 0x47505347; // "GSPG"
+
+/**
+ * Visit every KeyedVec member of a TaskGraph in a fixed order. Serialization, deserialization,
+ * and any future layout hash all share this single list, so a new member only needs adding here.
+ */
+template <typename GRAPH_T, typename FUNC_T>
+static void graph_for_each_member(GRAPH_T& rGraph, FUNC_T&& func)
+{
+    func(rGraph.pipelineToFirstAnystg);
+    func(rGraph.anystgToPipeline);
+    func(rGraph.anystgToFirstRuntask);
+    func(rGraph.runtaskToTask);
+    func(rGraph.anystgToFirstStgreqtask);
+    func(rGraph.stgreqtaskData);
+    func(rGraph.taskToFirstRevStgreqtask);
+    func(rGraph.revStgreqtaskToStage);
+    func(rGraph.taskToFirstTaskreqstg);
+    func(rGraph.taskreqstgData);
+    func(rGraph.anystgToFirstRevTaskreqstg);
+    func(rGraph.revTaskreqstgToTask);
+    func(rGraph.pltreeDescendantCounts);
+    func(rGraph.pltreeToPipeline);
+    func(rGraph.pipelineToPltree);
+    func(rGraph.pipelineToLoopScope);
+    func(rGraph.taskPriority);
+    func(rGraph.pipelineFastLane);
+}
+
+static constexpr std::uint64_t fnv1a_init() noexcept
+{
+    return 0xCBF29CE484222325ull;
+}
+
+static constexpr void fnv1a_feed(std::uint64_t &rHash, unsigned char const* pData, std::size_t size) noexcept
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        rHash ^= pData[i];
+        rHash *= 0x00000100000001B3ull;
+    }
+}
+
+template <typename T>
+static void hash_pod(std::uint64_t &rHash, T const& value) noexcept
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    fnv1a_feed(rHash, reinterpret_cast<unsigned char const*>(&value), sizeof(T));
+}
+
+std::uint64_t exec_graph_hash(Tasks const& tasks, ArrayView<TaskEdges const* const> const data) noexcept
+{
+    std::uint64_t hash = fnv1a_init();
+
+    hash_pod(hash, tasks.m_taskIds.capacity());
+    hash_pod(hash, tasks.m_pipelineIds.capacity());
+
+    for (TaskInt const taskInt : tasks.m_taskIds.bitview().zeros())
+    {
+        auto const task = TaskId(taskInt);
+        hash_pod(hash, taskInt);
+        hash_pod(hash, tasks.m_taskRunOn[task]);
+    }
+
+    for (PipelineInt const plInt : tasks.m_pipelineIds.bitview().zeros())
+    {
+        auto const pipeline = PipelineId(plInt);
+        PipelineInfo const&    info = tasks.m_pipelineInfo[pipeline];
+        PipelineControl const& ctrl = tasks.m_pipelineControl[pipeline];
+
+        hash_pod(hash, plInt);
+        hash_pod(hash, tasks.m_pipelineParents[pipeline]);
+        hash_pod(hash, info.stageType);
+        hash_pod(hash, ctrl.scheduler);
+        hash_pod(hash, ctrl.waitStage);
+        hash_pod(hash, ctrl.isLoopScope);
+        fnv1a_feed(hash, reinterpret_cast<unsigned char const*>(info.name.data()), info.name.size());
+    }
+
+    for (TaskEdges const* const pEdges : data)
+    {
+        for (TplTaskPipelineStage const& tpl : pEdges->m_syncWith)
+        {
+            hash_pod(hash, tpl);
+        }
+    }
+
+    return hash;
+}
+
+bool save_exec_graph(TaskGraph const& graph, std::uint64_t const hash, std::filesystem::path const& file)
+{
+    // Write to a sibling temp file first so a crash mid-write never leaves a torn cache
+    std::filesystem::path const tmp = file.native() + ".tmp";
+
+    {
+        std::ofstream stream{tmp, std::ios::binary | std::ios::trunc};
+        if ( ! stream.is_open() )
+        {
+            return false;
+        }
+
+        auto const write_pod = [&stream] (auto const& value)
+        {
+            stream.write(reinterpret_cast<char const*>(&value), sizeof(value));
+        };
+
+        write_pod(gc_graphCacheMagic);
+        write_pod(gc_graphCacheVersion);
+        write_pod(hash);
+
+        graph_for_each_member(graph, [&stream, &write_pod] (auto const& vec)
+        {
+            std::uint64_t const count = vec.size();
+            write_pod(count);
+            stream.write(reinterpret_cast<char const*>(vec.data()),
+                         std::streamsize(count * sizeof(*vec.data())));
+        });
+
+        if ( ! stream.good() )
+        {
+            stream.close();
+            std::filesystem::remove(tmp);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp, file, ec);
+    return ! bool(ec);
+}
+
+std::optional<TaskGraph> load_exec_graph(std::uint64_t const hash, std::filesystem::path const& file)
+{
+    std::ifstream stream{file, std::ios::binary};
+    if ( ! stream.is_open() )
+    {
+        return std::nullopt;
+    }
+
+    auto const read_pod = [&stream] (auto& rValue)
+    {
+        stream.read(reinterpret_cast<char*>(&rValue), sizeof(rValue));
+    };
+
+    std::uint32_t magic   = 0;
+    std::uint32_t version = 0;
+    std::uint64_t stored  = 0;
+    read_pod(magic);
+    read_pod(version);
+    read_pod(stored);
+
+    if ( ! stream.good() || magic != gc_graphCacheMagic
+        || version != gc_graphCacheVersion || stored != hash )
+    {
+        return std::nullopt;
+    }
+
+    TaskGraph out;
+    bool ok = true;
+
+    graph_for_each_member(out, [&stream, &read_pod, &ok] (auto& rVec)
+    {
+        std::uint64_t count = 0;
+        read_pod(count);
+        if ( ! stream.good() )
+        {
+            ok = false;
+            return;
+        }
+
+        rVec.resize(count);
+        stream.read(reinterpret_cast<char*>(rVec.data()),
+                    std::streamsize(count * sizeof(*rVec.data())));
+        ok = ok && stream.good();
+    });
+
+    if ( ! ok )
+    {
+        return std::nullopt;
+    }
+
+    return out;
+}
+
+TaskGraph make_exec_graph_cached(Tasks const& tasks, ArrayView<TaskEdges const* const> const data, std::filesystem::path const& file)
+{
+    std::uint64_t const hash = exec_graph_hash(tasks, data);
+
+    if (std::optional<TaskGraph> loaded = load_exec_graph(hash, file))
+    {
+        return std::move(*loaded);
+    }
+
+    TaskGraph graph = make_exec_graph(tasks, data);
+
+    save_exec_graph(graph, hash, file); // Best-effort; recompute next launch if this fails
+
+    return graph;
+}
+
+} // namespace osp
@@ -0,0 +1,67 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2022 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "tasks.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+namespace osp
+{
+
+/**
+ * @brief Hash of everything make_exec_graph reads: registered tasks, pipelines, and edges
+ *
+ * Used as the cache key for saved TaskGraphs. Any change to the task/pipeline setup produces a
+ * different hash, invalidating stale cache files.
+ */
+std::uint64_t exec_graph_hash(Tasks const& tasks, ArrayView<TaskEdges const* const> data) noexcept;
+
+/**
+ * @brief Write a compiled TaskGraph to a cache file
+ *
+ * @return True on success. Failure leaves no partial file behind.
+ */
+bool save_exec_graph(TaskGraph const& graph, std::uint64_t hash, std::filesystem::path const& file);
+
+/**
+ * @brief Load a compiled TaskGraph from a cache file, verifying its hash
+ *
+ * @return Loaded graph, or nullopt if the file is missing, corrupt, or was built from a
+ *         different task/pipeline setup
+ */
+std::optional<TaskGraph> load_exec_graph(std::uint64_t hash, std::filesystem::path const& file);
+
+/**
+ * @brief make_exec_graph with a transparent file cache
+ *
+ * Loads the graph from 'file' when its stored hash matches the current task setup; otherwise
+ * compiles the graph and rewrites the cache for the next launch.
+ */
+TaskGraph make_exec_graph_cached(Tasks const& tasks, ArrayView<TaskEdges const* const> data, std::filesystem::path const& file);
+
+} // namespace osp
@@ -0,0 +1,142 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2022 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace osp
+{
+
+/// Awaited inside a ResumableTask body to suspend until the next resume() call
+using TaskYield = std::suspend_always;
+
+/**
+ * @brief Coroutine handle for long-running work amortized across pipeline loop iterations
+ *
+ * Task functions registered through the builder must still run to completion within one stage;
+ * a ResumableTask lets that "completion" be one slice of a longer job. The coroutine state lives
+ * in TopData owned by the session, and the per-frame task function simply calls resume():
+ *
+ * @code
+ * ResumableTask update_faces_incremental(ACtxTerrain &rTerrain)
+ * {
+ *     for (ChunkId const chunk : rTerrain.chunksToUpdate)
+ *     {
+ *         update_chunk(rTerrain, chunk);
+ *         co_await TaskYield{};   // Resumed next loop iteration
+ *     }
+ * }
+ * @endcode
+ *
+ * The executor is unaware of coroutines; the pipeline loop re-running the stage each iteration
+ * is what drives resumption, so existing dependency/cancel semantics are untouched. A typical
+ * driver task returns TaskActions{} while unfinished and starts a fresh coroutine (or cancels
+ * its pipeline) once done() reports completion.
+ *
+ * Move-only; destroys the coroutine frame on destruction.
+ */
+class ResumableTask
+{
+public:
+
+    struct promise_type
+    {
+        ResumableTask get_return_object() noexcept
+        {
+            return ResumableTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        // Lazy start: first resume() runs the body up to the first yield
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+
+        // Suspend at the end so done() can be queried; frame freed by ~ResumableTask
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        void return_void() const noexcept { }
+
+        // Task functions are noexcept; an escaping exception is unrecoverable here
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+
+    ResumableTask() noexcept = default;
+
+    ResumableTask(ResumableTask && move) noexcept
+     : m_handle{std::exchange(move.m_handle, nullptr)}
+    { }
+
+    ResumableTask& operator=(ResumableTask && move) noexcept
+    {
+        if (m_handle != nullptr)
+        {
+            m_handle.destroy();
+        }
+        m_handle = std::exchange(move.m_handle, nullptr);
+        return *this;
+    }
+
+    ResumableTask(ResumableTask const& copy) = delete;
+    ResumableTask& operator=(ResumableTask const& copy) = delete;
+
+    ~ResumableTask()
+    {
+        if (m_handle != nullptr)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    /// True if a coroutine is attached, finished or not
+    bool valid() const noexcept { return m_handle != nullptr; }
+
+    /// True once the coroutine body has run to completion
+    bool done() const noexcept { return (m_handle == nullptr) || m_handle.done(); }
+
+    /**
+     * @brief Run the coroutine until its next yield point or completion
+     *
+     * @return True if the coroutine finished; false if it yielded and can be resumed again
+     */
+    bool resume()
+    {
+        if ( ! done() )
+        {
+            m_handle.resume();
+        }
+        return done();
+    }
+
+private:
+
+    explicit ResumableTask(std::coroutine_handle<promise_type> const handle) noexcept
+     : m_handle{handle}
+    { }
+
+    std::coroutine_handle<promise_type> m_handle;
+
+}; // class ResumableTask
+
+} // namespace osp
@@ -55,9 +55,10 @@ struct PipelineCounts
 };
 
 
-TaskGraph make_exec_graph(Tasks const& tasks, ArrayView<TaskEdges const* const> const data)
+void make_exec_graph_into(Tasks const& tasks, ArrayView<TaskEdges const* const> const data, TaskGraph &rOut)
 {
-    TaskGraph out;
+    // 'out' alias keeps the body identical to the value-returning wrapper this grew out of
+    TaskGraph &out = rOut;
 
     std::size_t const maxPipelines  = tasks.m_pipelineIds.capacity();
     std::size_t const maxTasks      = tasks.m_taskIds.capacity();
@@ -170,22 +171,25 @@ TaskGraph make_exec_graph(Tasks const& tasks, ArrayView<TaskEdges const* const>
     // The +1 is needed for 1-to-many connections to store the total number of other elements they
     // index. This also simplifies logic in fanout_view(...)
 
-    out.pipelineToFirstAnystg       .resize(maxPipelines+1,     lgrn::id_null<AnyStageId>());
-    out.anystgToPipeline            .resize(totalStages+1,      lgrn::id_null<PipelineId>());
-    out.anystgToFirstRuntask        .resize(totalStages+1,      lgrn::id_null<RunTaskId>());
-    out.runtaskToTask               .resize(totalRunTasks,      lgrn::id_null<TaskId>());
-    out.anystgToFirstStgreqtask     .resize(totalStages+1,      lgrn::id_null<StageReqTaskId>());
-    out.stgreqtaskData              .resize(totalStageReqTasks, {});
-    out.taskToFirstRevStgreqtask    .resize(maxTasks+1,         lgrn::id_null<ReverseStageReqTaskId>());
-    out.revStgreqtaskToStage        .resize(totalStageReqTasks, lgrn::id_null<AnyStageId>());
-    out.taskToFirstTaskreqstg       .resize(maxTasks+1,         lgrn::id_null<TaskReqStageId>());
-    out.taskreqstgData              .resize(totalTasksReqStage, {});
-    out.anystgToFirstRevTaskreqstg  .resize(totalStages+1,      lgrn::id_null<ReverseTaskReqStageId>());
-    out.revTaskreqstgToTask         .resize(totalTasksReqStage, lgrn::id_null<TaskId>());
-    out.pltreeDescendantCounts      .resize(treeSize,           0);
-    out.pltreeToPipeline            .resize(treeSize,           lgrn::id_null<PipelineId>());
-    out.pipelineToPltree            .resize(maxPipelines,       lgrn::id_null<PipelineTreePos_t>());
-    out.pipelineToLoopScope         .resize(maxPipelines,       lgrn::id_null<PipelineTreePos_t>());
+    // assign(...) instead of resize(...): rebuilding into an existing graph must overwrite
+    // stale values, and reusing the vectors' capacity keeps repeat rebuilds allocation-free
+
+    out.pipelineToFirstAnystg       .assign(maxPipelines+1,     lgrn::id_null<AnyStageId>());
+    out.anystgToPipeline            .assign(totalStages+1,      lgrn::id_null<PipelineId>());
+    out.anystgToFirstRuntask        .assign(totalStages+1,      lgrn::id_null<RunTaskId>());
+    out.runtaskToTask               .assign(totalRunTasks,      lgrn::id_null<TaskId>());
+    out.anystgToFirstStgreqtask     .assign(totalStages+1,      lgrn::id_null<StageReqTaskId>());
+    out.stgreqtaskData              .assign(totalStageReqTasks, {});
+    out.taskToFirstRevStgreqtask    .assign(maxTasks+1,         lgrn::id_null<ReverseStageReqTaskId>());
+    out.revStgreqtaskToStage        .assign(totalStageReqTasks, lgrn::id_null<AnyStageId>());
+    out.taskToFirstTaskreqstg       .assign(maxTasks+1,         lgrn::id_null<TaskReqStageId>());
+    out.taskreqstgData              .assign(totalTasksReqStage, {});
+    out.anystgToFirstRevTaskreqstg  .assign(totalStages+1,      lgrn::id_null<ReverseTaskReqStageId>());
+    out.revTaskreqstgToTask         .assign(totalTasksReqStage, lgrn::id_null<TaskId>());
+    out.pltreeDescendantCounts      .assign(treeSize,           0);
+    out.pltreeToPipeline            .assign(treeSize,           lgrn::id_null<PipelineId>());
+    out.pipelineToPltree            .assign(maxPipelines,       lgrn::id_null<PipelineTreePos_t>());
+    out.pipelineToLoopScope         .assign(maxPipelines,       lgrn::id_null<PipelineTreePos_t>());
 
     // 5. Calculate one-to-many partitions
 
@@ -389,6 +393,140 @@ TaskGraph make_exec_graph(Tasks const& tasks, ArrayView<TaskEdges const* const>
         rootPos += 1 + rootDescendantCount;
     }
 
+    // 8. Classify fast-lane pipelines: no sync edges touch any of their stages, so the
+    //    executor's requirement scans can be skipped for them outright
+
+    out.pipelineFastLane.assign(maxPipelines, 0);
+
+    for (PipelineInt const plInt : tasks.m_pipelineIds.bitview().zeros())
+    {
+        auto const pl = PipelineId(plInt);
+
+        bool fast = true;
+        for (std::size_t stg = 0; stg < plCounts[pl].stages; ++stg)
+        {
+            AnyStageId const anystg = anystg_from(out, pl, StageId(stg));
+            if (   fanout_size(out.anystgToFirstStgreqtask,    anystg) != 0
+                || fanout_size(out.anystgToFirstRevTaskreqstg, anystg) != 0 )
+            {
+                fast = false;
+                break;
+            }
+        }
+
+        out.pipelineFastLane[pl] = fast ? 1 : 0;
+    }
+
+    // 9. Compute critical-path task priorities
+
+    auto const task_cost = [&tasks] (TaskId const task) -> float
+    {
+        float const hint = (std::size_t(task) < tasks.m_taskCostHint.size())
+                         ? tasks.m_taskCostHint[task]
+                         : 0.0f;
+        return (hint > 0.0f) ? hint : 1.0f; // Unit cost when untagged; orders by chain depth
+    };
+
+    out.taskPriority.assign(maxTasks, 0.0f);
+
+    KeyedVec<AnyStageId, float> stageCrit;
+    stageCrit.resize(totalStages + 1, 0.0f);
+
+    // Critical path downstream of a pipeline passing the given stage
+    auto const stage_crit_after = [&out, &plCounts, &stageCrit] (PipelineId const pl, StageId const stg) -> float
+    {
+        int const next = int(stg) + 1;
+        if (next >= int(plCounts[pl].stages))
+        {
+            return 0.0f;
+        }
+        return stageCrit[AnyStageId(uint32_t(anystg_from(out, pl, StageId(next))))];
+    };
+
+    // Longest path over the stage graph. Cross-pipeline sync edges can point either way along
+    // the anystg ordering (and loop scopes form cycles), so relax to a fixpoint with a pass cap
+    // instead of a single topological sweep. Values only grow, so this converges quickly.
+    for (int pass = 0; pass < 64; ++pass)
+    {
+        bool changed = false;
+
+        // stageCrit: reaching a stage runs its tasks, then continues down the pipeline
+        for (PipelineInt const plInt : tasks.m_pipelineIds.bitview().zeros())
+        {
+            auto const pl = PipelineId(plInt);
+
+            for (int stgLocal = int(plCounts[pl].stages) - 1; stgLocal >= 0; --stgLocal)
+            {
+                AnyStageId const anystg = anystg_from(out, pl, StageId(stgLocal));
+
+                float crit = stage_crit_after(pl, StageId(stgLocal));
+
+                for (TaskId const task : fanout_view(out.anystgToFirstRuntask, out.runtaskToTask, anystg))
+                {
+                    crit = std::max(crit, out.taskPriority[task]);
+                }
+
+                if (crit > stageCrit[anystg])
+                {
+                    stageCrit[anystg] = crit;
+                    changed = true;
+                }
+            }
+        }
+
+        // taskPriority: own cost plus the heaviest chain this task's completion unblocks
+        for (TaskInt const taskInt : tasks.m_taskIds.bitview().zeros())
+        {
+            auto const task = TaskId(taskInt);
+            auto const [runPl, runStg] = tasks.m_taskRunOn[task];
+
+            float downstream = stage_crit_after(runPl, runStg);
+
+            for (AnyStageId const reqAnystg : fanout_view(out.taskToFirstRevStgreqtask, out.revStgreqtaskToStage, task))
+            {
+                PipelineId const reqPl = out.anystgToPipeline[reqAnystg];
+                downstream = std::max(downstream, stage_crit_after(reqPl, stage_from(out, reqPl, reqAnystg)));
+            }
+
+            for (TaskRequiresStage const& req : fanout_view(out.taskToFirstTaskreqstg, out.taskreqstgData, task))
+            {
+                downstream = std::max(downstream, stage_crit_after(req.reqPipeline, req.reqStage));
+            }
+
+            float const priority = task_cost(task) + downstream;
+
+            if (priority > out.taskPriority[task])
+            {
+                out.taskPriority[task] = priority;
+                changed = true;
+            }
+        }
+
+        if ( ! changed )
+        {
+            break;
+        }
+    }
+
+    // 10. Mark trivial stages: nothing runs on them and no sync edges touch them, so the
+    //     executor fuses consecutive ones into a single stage advance
+
+    out.anystgTrivial.assign(totalStages+1, 0);
+
+    for (std::size_t stg = 0; stg < totalStages; ++stg)
+    {
+        auto const anystg = AnyStageId(uint32_t(stg));
+        bool const trivial =  fanout_size(out.anystgToFirstRuntask,       anystg) == 0
+                           && fanout_size(out.anystgToFirstStgreqtask,    anystg) == 0
+                           && fanout_size(out.anystgToFirstRevTaskreqstg, anystg) == 0;
+        out.anystgTrivial[anystg] = trivial ? 1 : 0;
+    }
+}
+
+TaskGraph make_exec_graph(Tasks const& tasks, ArrayView<TaskEdges const* const> const data)
+{
+    TaskGraph out;
+    make_exec_graph_into(tasks, data, out);
     return out;
 }
 
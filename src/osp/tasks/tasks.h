@@ -136,6 +136,11 @@ struct Tasks
     KeyedVec<PipelineId, PipelineControl>           m_pipelineControl;
 
     KeyedVec<TaskId, TplPipelineStage>              m_taskRunOn;
+
+    /// Optional estimated cost per task in milliseconds, set through the builder. Zero (or out
+    /// of range) means no hint; the graph compiler then assumes unit cost, so untagged graphs
+    /// still schedule longest-dependency-chain first.
+    KeyedVec<TaskId, float>                         m_taskCostHint;
 };
 
 struct TaskEdges
@@ -218,6 +223,21 @@ struct TaskGraph
     KeyedVec<PipelineId, PipelineTreePos_t>         pipelineToPltree;
     KeyedVec<PipelineId, PipelineTreePos_t>         pipelineToLoopScope;
 
+    // Critical-path length (in cost-hint milliseconds) from the start of each task to the end
+    // of the graph. Executors dispatch higher values first, so the long chain through e.g.
+    // update_world launches before cheap leaf tasks instead of after them.
+    KeyedVec<TaskId, float>                         taskPriority;
+
+    // Nonzero for pipelines none of whose stages have StageReqTask or TaskReqStage edges (or,
+    // once in use, semaphores). pipeline_advance_reqs skips the requirement scans entirely for
+    // these, which is the common case for internal fixed-sequence pipelines.
+    KeyedVec<PipelineId, std::uint8_t>              pipelineFastLane;
+
+    // Nonzero for stages with no tasks to run and no sync edges. pipeline_advance_stage
+    // fuses runs of consecutive trivial stages into a single advance, instead of a full
+    // advance_stage/reqs/run round-trip per empty stage.
+    KeyedVec<AnyStageId, std::uint8_t>              anystgTrivial;
+
     // not yet used
     //lgrn::IntArrayMultiMap<TaskInt, SemaphoreId>    taskAcquire;      /// Tasks acquire (n) Semaphores
     //lgrn::IntArrayMultiMap<SemaphoreInt, TaskId>    semaAcquiredBy;   /// Semaphores are acquired by (n) Tasks
@@ -225,6 +245,15 @@ struct TaskGraph
 }; // struct TaskGraph
 
 
+/**
+ * @brief Rebuild a TaskGraph in-place, reusing rOut's existing allocations
+ *
+ * Intended for runtime session load/unload, where the graph is rebuilt every time tasks or
+ * pipelines change. The flat fanout partitions must be recomputed as a whole, but writing into
+ * the previous graph's vectors makes repeat rebuilds allocation-free once capacity has peaked.
+ */
+void make_exec_graph_into(Tasks const& tasks, ArrayView<TaskEdges const* const> data, TaskGraph &rOut);
+
 TaskGraph make_exec_graph(Tasks const& tasks, ArrayView<TaskEdges const* const> data);
 
 inline TaskGraph make_exec_graph(Tasks const& tasks, std::initializer_list<TaskEdges const* const> data)
@@ -232,6 +261,11 @@ inline TaskGraph make_exec_graph(Tasks const& tasks, std::initializer_list<TaskE
     return make_exec_graph(tasks, arrayView(data));
 }
 
+inline void make_exec_graph_into(Tasks const& tasks, std::initializer_list<TaskEdges const* const> data, TaskGraph &rOut)
+{
+    make_exec_graph_into(tasks, arrayView(data), rOut);
+}
+
 template <typename KEY_T, typename VALUE_T, typename GETSIZE_T, typename CLAIM_T>
 inline void fanout_partition(KeyedVec<KEY_T, VALUE_T>& rVec, GETSIZE_T&& get_size, CLAIM_T&& claim) noexcept
 {
@@ -25,22 +25,55 @@
 #include "top_execute.h"
 #include "top_worker.h"
 #include "execute.h"
+#include "worker_deque.h"
+
+#include "../util/logging.h"
 
 #include <Corrade/Containers/ArrayViewStl.h>
 
 #include <entt/core/any.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
 #include <vector>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace osp
 {
 
-void top_run_blocking(Tasks const& tasks, TaskGraph const& graph, TopTaskDataVec_t& rTaskData, ArrayView<entt::any> topData, ExecContext& rExec, WorkerContext worker)
+void top_resolve_task_args(Tasks const& tasks, TopTaskDataVec_t& rTaskData, ArrayView<entt::any> topData)
 {
-    std::vector<entt::any> topDataRefs;
+    for (TaskInt const taskInt : tasks.m_taskIds.bitview().zeros())
+    {
+        if (taskInt >= rTaskData.size())
+        {
+            continue;
+        }
+
+        TopTask &rTopTask = rTaskData[TaskId(taskInt)];
+
+        std::size_t i = 0;
+        for (TopDataId const dataId : rTopTask.m_dataUsed)
+        {
+            rTopTask.m_dataRefs[i] = (dataId != lgrn::id_null<TopDataId>())
+                                   ? topData[dataId].as_ref()
+                                   : entt::any{};
+            ++i;
+        }
+    }
+}
 
+void top_run_blocking(Tasks const& tasks, TaskGraph const& graph, TopTaskDataVec_t& rTaskData, [[maybe_unused]] ArrayView<entt::any> topData, ExecContext& rExec, WorkerContext worker)
+{
     // Run until there's no tasks left to run
     while (true)
     {
@@ -52,19 +85,20 @@ void top_run_blocking(Tasks const& tasks, TaskGraph const& graph, TopTaskDataVec
             TaskId const task = rExec.tasksQueuedRun[0];
             TopTask &rTopTask = rTaskData[task];
 
-            topDataRefs.clear();
-            topDataRefs.reserve(rTopTask.m_dataUsed.size());
-            for (TopDataId const dataId : rTopTask.m_dataUsed)
-            {
-                topDataRefs.push_back((dataId != lgrn::id_null<TopDataId>())
-                                       ? topData[dataId].as_ref()
-                                       : entt::any{});
-            }
-
             bool const shouldRun = (rTopTask.m_func != nullptr);
+            bool const timing    = rExec.timeLog.enabled();
+
+            auto const start = timing ? ExecTimeLog::clock_t::now() : ExecTimeLog::clock_t::time_point{};
 
             // Task function is called here
-            TaskActions const status = shouldRun ? rTopTask.m_func(worker, topDataRefs) : TaskActions{};
+            TaskActions const status = shouldRun
+                    ? rTopTask.m_func(worker, arrayView(rTopTask.m_dataRefs.data(), rTopTask.m_dataUsed.size()))
+                    : TaskActions{};
+
+            if (timing)
+            {
+                rExec.timeLog.record(task, worker.m_workerId, start, ExecTimeLog::clock_t::now());
+            }
 
             complete_task(tasks, graph, rExec, task, status);
         }
@@ -77,6 +111,739 @@ void top_run_blocking(Tasks const& tasks, TaskGraph const& graph, TopTaskDataVec
     }
 }
 
+#ifdef __linux__
+static void pin_worker_to_node(int const node, int const nodeCount)
+{
+    unsigned int const cpuCount     = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int const cpusPerNode  = std::max(1u, cpuCount / unsigned(nodeCount));
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (unsigned int cpu = unsigned(node) * cpusPerNode;
+         cpu < std::min(cpuCount, (unsigned(node) + 1u) * cpusPerNode); ++cpu)
+    {
+        CPU_SET(cpu, &cpuSet);
+    }
+
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet); // Best-effort
+}
+#endif
+
+void top_run_parallel(Tasks const& tasks, TaskGraph const& graph, TopTaskDataVec_t& rTaskData, ArrayView<entt::any> topData, ExecContext& rExec, unsigned int workerCount, WorkerAffinity const* pAffinity)
+{
+    if (workerCount == 0)
+    {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Resolve argument references up front; workers dispatch with them as-is
+    top_resolve_task_args(tasks, rTaskData, topData);
+
+    int const nodeCount = (pAffinity != nullptr) ? std::max(1, pAffinity->nodeCount) : 1;
+
+    // Workers are split evenly across nodes; worker -> node is a plain division
+    auto const worker_node = [workerCount, nodeCount] (unsigned int const workerId) -> int
+    {
+        return int((workerId * unsigned(nodeCount)) / workerCount);
+    };
+
+    // Preferred node per task: first TopData it uses that declares one
+    KeyedVec<TaskId, int> taskNode;
+    taskNode.resize(tasks.m_taskIds.capacity(), -1);
+
+    if (pAffinity != nullptr)
+    {
+        for (TaskInt const taskInt : tasks.m_taskIds.bitview().zeros())
+        {
+            auto const task = TaskId(taskInt);
+            for (TopDataId const dataId : rTaskData[task].m_dataUsed)
+            {
+                if (   (dataId != lgrn::id_null<TopDataId>())
+                    && (dataId < pAffinity->topDataNode.size())
+                    && (pAffinity->topDataNode[dataId] != -1) )
+                {
+                    taskNode[task] = pAffinity->topDataNode[dataId];
+                    break;
+                }
+            }
+        }
+    }
+
+    std::mutex              execMtx;
+    std::condition_variable execCv;
+
+    std::size_t const maxTasks = tasks.m_taskIds.capacity();
+
+    // One work-stealing deque per worker. Each worker pushes tasks its own completions make
+    // ready, keeping wide fan-outs local; idle workers steal from the top of other deques.
+    std::vector<WorkerDeque> deques(workerCount);
+    for (WorkerDeque &rDeque : deques)
+    {
+        rDeque.resize(maxTasks);
+    }
+
+    // Tasks handed out to deques stay in rExec.tasksQueuedRun until complete_task, so that
+    // pipeline_advance_reqs still sees them as unfinished. This set tracks which queued tasks
+    // have already been pushed to a deque, so each is handed out exactly once.
+    BitVector_t tasksDistributed;
+    bitvector_resize(tasksDistributed, maxTasks);
+
+    // Deque contents + tasks currently running. Zero means the executor is drained.
+    std::atomic<int> tasksPending{0};
+
+    std::vector<TaskId> readyScratch;
+
+    // Estimated critical-path length unblocked by running a task; observed runtimes replace the
+    // builder's cost hint once the EWMA warms up
+    auto const task_priority = [&graph, &rExec] (TaskId const task) -> float
+    {
+        return graph.taskPriority[task] + rExec.taskDurationEwma[task];
+    };
+
+    // Push tasks newly added to rExec.tasksQueuedRun onto a deque, critical-path-first.
+    // Call with execMtx held.
+    auto const distribute_new_tasks = [&rExec, &deques, &tasksDistributed, &tasksPending,
+                                       &readyScratch, &task_priority, &taskNode, &worker_node]
+                                      (unsigned int const workerId)
+    {
+        readyScratch.clear();
+
+        for (TaskId const task : rExec.tasksQueuedRun)
+        {
+            if ( ! tasksDistributed.test(std::size_t(task)) )
+            {
+                tasksDistributed.set(std::size_t(task));
+                readyScratch.push_back(task);
+            }
+        }
+
+        // Push lowest priority first; the owner's LIFO pop then grabs the longest chain first.
+        // Tasks preferring a different NUMA node sort even earlier, so they sit at the steal
+        // end of the deque and are picked up by that node's workers.
+        int const ownNode = worker_node(workerId);
+
+        auto const foreign = [&taskNode, ownNode] (TaskId const task)
+        {
+            return (taskNode[task] != -1) && (taskNode[task] != ownNode);
+        };
+
+        std::sort(readyScratch.begin(), readyScratch.end(),
+                  [&task_priority, &foreign] (TaskId const lhs, TaskId const rhs)
+        {
+            bool const lhsForeign = foreign(lhs);
+            bool const rhsForeign = foreign(rhs);
+            if (lhsForeign != rhsForeign)
+            {
+                return lhsForeign;
+            }
+            return task_priority(lhs) < task_priority(rhs);
+        });
+
+        for (TaskId const task : readyScratch)
+        {
+            tasksPending.fetch_add(1, std::memory_order_relaxed);
+            deques[workerId].push(task);
+        }
+    };
+
+    // Workers borrow the spawning thread's logger; a raw pointer is enough since this
+    // thread keeps its owning reference until the workers are joined below
+    spdlog::logger * const pLogger = t_pLogger;
+
+    auto const worker_loop = [&tasks, &graph, &rTaskData, &rExec, &execMtx, &execCv,
+                              &deques, &tasksDistributed, &tasksPending, &distribute_new_tasks,
+                              &worker_node, workerCount, nodeCount, pLogger]
+                             (unsigned int const workerId)
+    {
+        set_thread_logger_ref(pLogger);
+
+        int const ownNode = worker_node(workerId);
+
+        WorkerContext const worker{ .m_workerId    = workerId,
+                                    .m_workerCount = workerCount,
+                                    .m_numaNode    = (nodeCount > 1) ? ownNode : -1 };
+
+#ifdef __linux__
+        if (nodeCount > 1)
+        {
+            pin_worker_to_node(ownNode, nodeCount);
+        }
+#endif
+
+        WorkerDeque &rOwnDeque = deques[workerId];
+
+        while (true)
+        {
+            // Own deque first (LIFO, cache-warm), then steal round-robin (FIFO, oldest work),
+            // trying same-node victims before crossing the socket interconnect
+            TaskId task = rOwnDeque.try_pop();
+
+            for (int pass = 0; (task == lgrn::id_null<TaskId>()) && (pass < 2); ++pass)
+            {
+                for (unsigned int i = 1; (task == lgrn::id_null<TaskId>()) && (i < workerCount); ++i)
+                {
+                    unsigned int const victim = (workerId + i) % workerCount;
+                    if ((pass == 0) == (worker_node(victim) == ownNode))
+                    {
+                        task = deques[victim].try_steal();
+                    }
+                }
+            }
+
+            if (task == lgrn::id_null<TaskId>())
+            {
+                std::unique_lock<std::mutex> lock{execMtx};
+
+                if (tasksPending.load(std::memory_order_relaxed) == 0)
+                {
+                    execCv.notify_all();
+                    break; // Deques drained and nothing running that could refill them
+                }
+
+                execCv.wait(lock);
+                continue;
+            }
+
+            TopTask &rTopTask = rTaskData[task];
+
+            bool const shouldRun = (rTopTask.m_func != nullptr);
+
+            auto const start = ExecTimeLog::clock_t::now();
+
+            // Task function is called here, in parallel with other workers
+            TaskActions const status = shouldRun
+                    ? rTopTask.m_func(worker, arrayView(rTopTask.m_dataRefs.data(), rTopTask.m_dataUsed.size()))
+                    : TaskActions{};
+
+            auto const end = ExecTimeLog::clock_t::now();
+
+            if (rExec.timeLog.enabled())
+            {
+                rExec.timeLog.record(task, worker.m_workerId, start, end);
+            }
+
+            float const durationMs
+                    = float(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count())
+                    * 0.001f;
+
+            {
+                std::lock_guard<std::mutex> lock{execMtx};
+
+                tasksDistributed.reset(std::size_t(task));
+
+                float &rEwma = rExec.taskDurationEwma[task];
+                rEwma = (rEwma == 0.0f) ? durationMs : (rEwma + 0.125f * (durationMs - rEwma));
+
+                complete_task(tasks, graph, rExec, task, status);
+                exec_update(tasks, graph, rExec);
+
+                distribute_new_tasks(workerId);
+
+                tasksPending.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            // Completion may have queued new tasks, or drained the deques entirely
+            execCv.notify_all();
+        }
+    };
+
+    {
+        std::lock_guard<std::mutex> lock{execMtx};
+        distribute_new_tasks(0);
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(worker_loop, i);
+    }
+
+    for (std::thread &rThread : workers)
+    {
+        rThread.join();
+    }
+}
+
+/// Deque entry for top_run_parallel_multi: domain index in the upper 32 bits, TaskInt in the
+/// lower. The all-ones null id never collides with a real entry; domain counts are small.
+enum class DomainTaskId : uint64_t { };
+
+static constexpr DomainTaskId domain_task_pack(std::size_t const domain, TaskId const task) noexcept
+{
+    return DomainTaskId((uint64_t(domain) << 32) | uint64_t(TaskInt(task)));
+}
+
+void top_run_parallel_multi(ArrayView<ExecDomain const> domains, unsigned int workerCount)
+{
+    if (domains.size() == 0)
+    {
+        return;
+    }
+
+    if (workerCount == 0)
+    {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::size_t maxTasksTotal = 0;
+    for (ExecDomain const& rDomain : domains)
+    {
+        top_resolve_task_args(*rDomain.pTasks, *rDomain.pTaskData, rDomain.topData);
+        maxTasksTotal += rDomain.pTasks->m_taskIds.capacity();
+    }
+
+    // One mutex per domain, so a scene only ever contends with itself for ExecContext
+    // bookkeeping; cross-scene contention is limited to the shared deques
+    std::vector<std::mutex> domainMtx(domains.size());
+
+    // Same hand-out-once tracking as top_run_parallel, per domain
+    std::vector<BitVector_t> tasksDistributed(domains.size());
+    for (std::size_t domain = 0; domain < domains.size(); ++domain)
+    {
+        bitvector_resize(tasksDistributed[domain], domains[domain].pTasks->m_taskIds.capacity());
+    }
+
+    std::mutex              waitMtx;
+    std::condition_variable execCv;
+
+    // Deque contents + tasks currently running, across all domains. Zero means fully drained.
+    std::atomic<int>        tasksPending{0};
+
+    std::vector<WorkerDequeT<DomainTaskId>> deques(workerCount);
+    for (WorkerDequeT<DomainTaskId> &rDeque : deques)
+    {
+        rDeque.resize(maxTasksTotal);
+    }
+
+    // Push tasks newly added to a domain's ready queue onto a deque, critical-path-first.
+    // Call with domainMtx[domain] held.
+    auto const distribute_new_tasks = [&domains, &deques, &tasksDistributed, &tasksPending]
+                                      (std::size_t const domain, unsigned int const workerId)
+    {
+        ExecDomain const&   rDomain = domains[domain];
+        ExecContext const&  rExec   = *rDomain.pExec;
+        BitVector_t         &rDist  = tasksDistributed[domain];
+
+        std::vector<TaskId> ready;
+        for (TaskId const task : rExec.tasksQueuedRun)
+        {
+            if ( ! rDist.test(std::size_t(task)) )
+            {
+                rDist.set(std::size_t(task));
+                ready.push_back(task);
+            }
+        }
+
+        // Push lowest priority first; the owner's LIFO pop then grabs the longest chain first
+        auto const task_priority = [&rDomain, &rExec] (TaskId const task) -> float
+        {
+            return rDomain.pGraph->taskPriority[task] + rExec.taskDurationEwma[task];
+        };
+
+        std::sort(ready.begin(), ready.end(),
+                  [&task_priority] (TaskId const lhs, TaskId const rhs)
+        {
+            return task_priority(lhs) < task_priority(rhs);
+        });
+
+        for (TaskId const task : ready)
+        {
+            tasksPending.fetch_add(1, std::memory_order_relaxed);
+            deques[workerId].push(domain_task_pack(domain, task));
+        }
+    };
+
+    // Workers borrow the spawning thread's logger; see top_run_parallel
+    spdlog::logger * const pLogger = t_pLogger;
+
+    auto const worker_loop = [&domains, &domainMtx, &deques, &tasksDistributed, &tasksPending,
+                              &waitMtx, &execCv, &distribute_new_tasks, workerCount, pLogger]
+                             (unsigned int const workerId)
+    {
+        set_thread_logger_ref(pLogger);
+
+        WorkerContext const worker{ .m_workerId    = workerId,
+                                    .m_workerCount = workerCount,
+                                    .m_numaNode    = -1 };
+
+        WorkerDequeT<DomainTaskId> &rOwnDeque = deques[workerId];
+
+        while (true)
+        {
+            // Own deque first (LIFO, cache-warm, same domain); then steal the oldest work
+            // round-robin, which picks up whichever domain has waited longest
+            DomainTaskId packed = rOwnDeque.try_pop();
+
+            for (unsigned int i = 1; (packed == lgrn::id_null<DomainTaskId>()) && (i < workerCount); ++i)
+            {
+                packed = deques[(workerId + i) % workerCount].try_steal();
+            }
+
+            if (packed == lgrn::id_null<DomainTaskId>())
+            {
+                std::unique_lock<std::mutex> lock{waitMtx};
+
+                if (tasksPending.load(std::memory_order_relaxed) == 0)
+                {
+                    execCv.notify_all();
+                    break; // Everything drained and nothing running that could refill
+                }
+
+                // Re-check under the lock; completers notify under the same lock, so a push
+                // either lands before this check or its notify arrives after the wait starts
+                bool anyWork = false;
+                for (WorkerDequeT<DomainTaskId> const &rDeque : deques)
+                {
+                    if ( ! rDeque.empty() )
+                    {
+                        anyWork = true;
+                        break;
+                    }
+                }
+
+                if ( ! anyWork )
+                {
+                    execCv.wait(lock);
+                }
+                continue;
+            }
+
+            auto const domain = std::size_t(uint64_t(packed) >> 32);
+            auto const task   = TaskId(uint32_t(uint64_t(packed)));
+
+            ExecDomain const&   rDomain  = domains[domain];
+            ExecContext         &rExec   = *rDomain.pExec;
+            TopTask             &rTopTask = (*rDomain.pTaskData)[task];
+
+            bool const shouldRun = (rTopTask.m_func != nullptr);
+
+            auto const start = ExecTimeLog::clock_t::now();
+
+            // Task function is called here, in parallel with other workers and domains
+            TaskActions const status = shouldRun
+                    ? rTopTask.m_func(worker, arrayView(rTopTask.m_dataRefs.data(), rTopTask.m_dataUsed.size()))
+                    : TaskActions{};
+
+            auto const end = ExecTimeLog::clock_t::now();
+
+            if (rExec.timeLog.enabled())
+            {
+                rExec.timeLog.record(task, worker.m_workerId, start, end);
+            }
+
+            float const durationMs
+                    = float(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count())
+                    * 0.001f;
+
+            {
+                std::lock_guard<std::mutex> lock{domainMtx[domain]};
+
+                tasksDistributed[domain].reset(std::size_t(task));
+
+                float &rEwma = rExec.taskDurationEwma[task];
+                rEwma = (rEwma == 0.0f) ? durationMs : (rEwma + 0.125f * (durationMs - rEwma));
+
+                complete_task(*rDomain.pTasks, *rDomain.pGraph, rExec, task, status);
+                exec_update(*rDomain.pTasks, *rDomain.pGraph, rExec);
+
+                distribute_new_tasks(domain, workerId);
+
+                tasksPending.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            // Completion may have queued new tasks or drained everything. Take the wait lock
+            // briefly so sleepers can't slip between their re-check and their wait.
+            {
+                std::lock_guard<std::mutex> lock{waitMtx};
+            }
+            execCv.notify_all();
+        }
+    };
+
+    // Seed each domain's initial ready tasks onto a different worker's deque, so light
+    // domains start spread across the pool instead of queued behind one another
+    for (std::size_t domain = 0; domain < domains.size(); ++domain)
+    {
+        std::lock_guard<std::mutex> lock{domainMtx[domain]};
+        distribute_new_tasks(domain, unsigned(domain % workerCount));
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(worker_loop, i);
+    }
+
+    for (std::thread &rThread : workers)
+    {
+        rThread.join();
+    }
+}
+
+static std::string_view stall_stage_name(Tasks const& tasks, PipelineId const pl, StageId const stg)
+{
+    PipelineInfo const& info = tasks.m_pipelineInfo[pl];
+
+    if (   (stg == lgrn::id_null<StageId>())
+        || (info.stageType == lgrn::id_null<PipelineInfo::stage_type_t>()) )
+    {
+        return "NULL";
+    }
+
+    auto const stageNames = ArrayView<std::string_view const>{PipelineInfo::sm_stageNames[info.stageType]};
+    return stageNames[std::size_t(stg)];
+}
+
+/**
+ * @brief Read-only mirror of pipeline_advance_reqs' Stage-requires-Task completion check
+ */
+static bool stall_req_task_done(ExecContext const& exec, StageRequiresTask const& stgreqtask) noexcept
+{
+    ExecPipeline const &reqTaskExecPl = exec.plData[stgreqtask.reqPipeline];
+
+    if ( ! reqTaskExecPl.running )                              { return true;  }
+    if (reqTaskExecPl.canceled)                                 { return true;  }
+    if (int(reqTaskExecPl.stage) < int(stgreqtask.reqStage))    { return false; }
+    if (int(reqTaskExecPl.stage) > int(stgreqtask.reqStage))    { return true;  }
+    if ( ! reqTaskExecPl.tasksQueueDone )                       { return false; }
+
+    return ! (   exec.tasksQueuedBlocked.contains(stgreqtask.reqTask)
+              || exec.tasksQueuedRun    .contains(stgreqtask.reqTask) );
+}
+
+/**
+ * @brief Walk and print the chain of dependencies keeping a stalled pipeline on its stage
+ *
+ * Follows one unmet dependency per hop to the pipeline it leads to, until reaching a pipeline
+ * with its own tasks still queued (the overrunning task) or looping back (a dependency cycle).
+ */
+static void write_stall_chain(std::ostream &rStream, Tasks const& tasks, TopTaskDataVec_t const& taskData, TaskGraph const& graph, ExecContext const& exec, PipelineId const stalled)
+{
+    BitVector_t visited;
+    bitvector_resize(visited, tasks.m_pipelineIds.capacity());
+
+    PipelineId current = stalled;
+
+    while (true)
+    {
+        visited.set(std::size_t(current));
+
+        ExecPipeline const &execPl  = exec.plData[current];
+        PipelineInfo const &info    = tasks.m_pipelineInfo[current];
+
+        rStream << "PL" << std::setw(3) << std::left << PipelineInt(current)
+                << " (" << (info.name.empty() ? "untitled" : info.name) << ")"
+                << " on stage " << stall_stage_name(tasks, current, execPl.stage) << ": ";
+
+        if (execPl.stage == lgrn::id_null<StageId>())
+        {
+            rStream << "not on any stage; advanced mid-report or waiting on loop children\n";
+            return;
+        }
+
+        AnyStageId const anystg = anystg_from(graph, current, execPl.stage);
+
+        PipelineId next = lgrn::id_null<PipelineId>();
+
+        if (execPl.tasksQueuedRun != 0)
+        {
+            rStream << "waiting on its own queued tasks; likely an overrunning task function\n";
+            for (TaskId const task : fanout_view(graph.anystgToFirstRuntask, graph.runtaskToTask, anystg))
+            {
+                if (exec.tasksQueuedRun.contains(task))
+                {
+                    rStream << "  * Queued/running TASK" << TaskInt(task) << " - " << taskData[task].m_debugName << "\n";
+                }
+            }
+        }
+        else if (execPl.tasksQueuedBlocked != 0)
+        {
+            rStream << "own queued tasks are blocked on required stages\n";
+            for (TaskId const task : fanout_view(graph.anystgToFirstRuntask, graph.runtaskToTask, anystg))
+            {
+                if ( ! exec.tasksQueuedBlocked.contains(task) )
+                {
+                    continue;
+                }
+
+                rStream << "  * Blocked TASK" << TaskInt(task) << " - " << taskData[task].m_debugName << "\n";
+
+                for (TaskRequiresStage const& req : fanout_view(graph.taskToFirstTaskreqstg, graph.taskreqstgData, task))
+                {
+                    if (exec.plData[req.reqPipeline].stage != req.reqStage)
+                    {
+                        rStream << "    * Requires PL" << std::setw(3) << std::left << PipelineInt(req.reqPipeline)
+                                << " stage " << stall_stage_name(tasks, req.reqPipeline, req.reqStage) << "\n";
+                        next = req.reqPipeline;
+                    }
+                }
+            }
+        }
+        else if (execPl.ownStageReqTasksLeft != 0)
+        {
+            rStream << "own stage requires unfinished tasks of other pipelines\n";
+            for (StageRequiresTask const& stgreqtask : ArrayView<StageRequiresTask const>{fanout_view(graph.anystgToFirstStgreqtask, graph.stgreqtaskData, anystg)})
+            {
+                if ( ! stall_req_task_done(exec, stgreqtask) )
+                {
+                    rStream << "  * Requires TASK" << TaskInt(stgreqtask.reqTask) << " - " << taskData[stgreqtask.reqTask].m_debugName
+                            << " on PL" << std::setw(3) << std::left << PipelineInt(stgreqtask.reqPipeline) << "\n";
+                    next = stgreqtask.reqPipeline;
+                }
+            }
+        }
+        else if (execPl.tasksReqOwnStageLeft != 0)
+        {
+            rStream << "held on this stage by tasks of other pipelines that require it\n";
+            for (TaskId const task : ArrayView<TaskId const>{fanout_view(graph.anystgToFirstRevTaskreqstg, graph.revTaskreqstgToTask, anystg)})
+            {
+                auto const [taskPl, taskStg] = tasks.m_taskRunOn[task];
+                ExecPipeline const &taskExecPl = exec.plData[taskPl];
+
+                if (taskExecPl.running && ( ! taskExecPl.canceled ))
+                {
+                    rStream << "  * Required by TASK" << TaskInt(task) << " - " << taskData[task].m_debugName
+                            << " on PL" << std::setw(3) << std::left << PipelineInt(taskPl) << "\n";
+                    next = taskPl;
+                }
+            }
+        }
+        else if ((execPl.waitStage == execPl.stage) && ( ! execPl.waitSignaled ))
+        {
+            rStream << "on its wait stage; nothing has signaled it\n";
+        }
+        else
+        {
+            rStream << "no unmet dependencies found; advanced mid-report, or its advance was never queued\n";
+        }
+
+        if (next == lgrn::id_null<PipelineId>())
+        {
+            return;
+        }
+
+        if (visited.test(std::size_t(next)))
+        {
+            rStream << "Chain loops back to PL" << PipelineInt(next) << "; dependency cycle\n";
+            return;
+        }
+
+        current = next;
+    }
+}
+
+ExecStallWatchdog::~ExecStallWatchdog()
+{
+    stop();
+}
+
+void ExecStallWatchdog::stop()
+{
+    if (m_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+        m_stop = false;
+    }
+}
+
+void ExecStallWatchdog::start(Tasks const& tasks, TopTaskDataVec_t const& taskData, TaskGraph const& graph, ExecContext const& exec, std::chrono::milliseconds const threshold)
+{
+    stop();
+
+    // Watchdog borrows the starting thread's logger, same as top_run_parallel's workers
+    spdlog::logger * const pLogger = t_pLogger;
+
+    m_thread = std::thread{[this, &tasks, &taskData, &graph, &exec, threshold, pLogger] ()
+    {
+        set_thread_logger_ref(pLogger);
+
+        // Advance stamp each pipeline was last reported with; a stall is reported once, and
+        // again only if the pipeline advanced and stalled a second time
+        KeyedVec<PipelineId, std::chrono::steady_clock::time_point> reported;
+
+        std::unique_lock<std::mutex> lock{m_mutex};
+
+        while ( ! m_stop )
+        {
+            // Wake at half the threshold, so a stall is caught within 1.5x of it
+            m_cv.wait_for(lock, threshold / 2);
+
+            if (m_stop)
+            {
+                break;
+            }
+
+            auto const now = std::chrono::steady_clock::now();
+
+            reported.resize(exec.plData.size());
+
+            for (std::size_t plInt = 0; plInt < exec.plData.size(); ++plInt)
+            {
+                auto const          pipeline = PipelineId(PipelineInt(plInt));
+                ExecPipeline const  &execPl  = exec.plData[pipeline];
+
+                if ( ! execPl.running )
+                {
+                    continue;
+                }
+
+                auto const lastAdvance = execPl.lastAdvance.load();
+
+                if (   (lastAdvance.time_since_epoch().count() == 0)
+                    || ((now - lastAdvance) < threshold)
+                    || (reported[pipeline] == lastAdvance) )
+                {
+                    continue;
+                }
+
+                reported[pipeline] = lastAdvance;
+
+                auto const stalledMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastAdvance).count();
+
+                std::ostringstream chain;
+                write_stall_chain(chain, tasks, taskData, graph, exec, pipeline);
+
+                OSP_LOG_ERROR("Pipeline PL{} has not advanced in {} ms; blocking chain:\n{}",
+                              PipelineInt(pipeline), stalledMs, chain.str());
+            }
+        }
+    }};
+}
+
+void write_task_trace(std::ostream& rStream, TopTaskDataVec_t const& taskData, ExecTimeLog const& timeLog)
+{
+    using namespace std::chrono;
+
+    std::size_t const stored = std::min(timeLog.count(), timeLog.events.size());
+
+    rStream << "[";
+
+    for (std::size_t i = 0; i < stored; ++i)
+    {
+        ExecTimeLog::TaskTimeEvent const& event = timeLog.events[i];
+
+        auto const ts  = duration_cast<microseconds>(event.start.time_since_epoch()).count();
+        auto const dur = duration_cast<microseconds>(event.end - event.start).count();
+
+        rStream << ((i == 0) ? "\n" : ",\n")
+                << "{\"name\":\"" << taskData[event.task].m_debugName << "\","
+                << "\"cat\":\"task\",\"ph\":\"X\",\"pid\":0,"
+                << "\"tid\":" << event.worker << ","
+                << "\"ts\":"  << ts  << ","
+                << "\"dur\":" << dur << ","
+                << "\"args\":{\"task\":" << TaskInt(event.task) << "}}";
+    }
+
+    rStream << "\n]\n";
+}
+
 static void write_task_requirements(std::ostream &rStream, Tasks const& tasks, TaskGraph const& graph, ExecContext const& exec, TaskId const task)
 {
     auto const taskreqstageView = ArrayView<const TaskRequiresStage>(fanout_view(graph.taskToFirstTaskreqstg, graph.taskreqstgData, task));
@@ -28,13 +28,116 @@
 #include "tasks.h"
 #include "top_tasks.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace osp
 {
 
+/**
+ * @brief Resolve every task's argument references out of topData into TopTask::m_dataRefs
+ *
+ * Call once after sessions have emplaced their TopData values (and again if a slot is ever
+ * re-emplaced); top_run_blocking dispatches with the stored references as-is.
+ */
+void top_resolve_task_args(Tasks const& tasks, TopTaskDataVec_t& rTaskData, ArrayView<entt::any> topData);
+
 void top_run_blocking(Tasks const& tasks, TaskGraph const& graph, TopTaskDataVec_t& rTaskData, ArrayView<entt::any> topData, ExecContext& rExec, WorkerContext worker = {});
 
+/**
+ * @brief NUMA layout hints for top_run_parallel
+ *
+ * Workers are split evenly across nodeCount nodes and pinned there, assuming each node's logical
+ * CPUs are a contiguous block (the layout of our dual-socket machines). TopData slots holding
+ * large buffers can declare the node they were faulted in on; tasks using them are then kept on
+ * that node's workers unless another node runs out of work and steals.
+ */
+struct WorkerAffinity
+{
+    /// Preferred NUMA node per TopDataId; -1 (or out-of-range id) means no preference
+    std::vector<int> topDataNode;
+
+    /// Number of NUMA nodes to spread workers across
+    int nodeCount {1};
+};
+
+/**
+ * @brief Drain an ExecContext using a pool of worker threads
+ *
+ * Independent tasks run concurrently; StageReqTask/TaskReqStage dependencies are respected by
+ * only ever handing out tasks that exec_update has moved to the ready queue. ExecContext
+ * bookkeeping is serialized behind an internal mutex, so task functions themselves must only
+ * synchronize on the TopData they access.
+ *
+ * @param workerCount [in] Number of worker threads. Zero selects hardware concurrency.
+ * @param pAffinity   [in] Optional NUMA pinning and per-TopData node preferences
+ */
+void top_run_parallel(Tasks const& tasks, TaskGraph const& graph, TopTaskDataVec_t& rTaskData, ArrayView<entt::any> topData, ExecContext& rExec, unsigned int workerCount = 0, WorkerAffinity const* pAffinity = nullptr);
+
+/**
+ * @brief One independent execution domain (e.g. an ActiveScene) for top_run_parallel_multi
+ */
+struct ExecDomain
+{
+    Tasks const             *pTasks;
+    TaskGraph const         *pGraph;
+    TopTaskDataVec_t        *pTaskData;
+    ArrayView<entt::any>    topData;
+    ExecContext             *pExec;
+};
+
+/**
+ * @brief Drain several independent ExecContexts using one shared pool of worker threads
+ *
+ * Domains never share Tasks/TaskGraph/TopData; each domain's ExecContext bookkeeping is
+ * serialized behind its own mutex, so scenes only contend on the shared deques. Each domain's
+ * initial ready tasks are seeded round-robin across worker deques, and a completion pushes the
+ * tasks it makes ready onto the completing worker's own deque; idle workers steal the oldest
+ * work from others, so a heavy scene cannot hold workers that light scenes have work for.
+ *
+ * Returns once every domain is drained.
+ *
+ * @param workerCount [in] Number of worker threads shared by all domains. Zero selects
+ *                         hardware concurrency.
+ */
+void top_run_parallel_multi(ArrayView<ExecDomain const> domains, unsigned int workerCount = 0);
+
+/**
+ * @brief Background watchdog that reports pipelines stalled beyond a threshold
+ *
+ * Executors stamp ExecPipeline::lastAdvance on every stage advance; the watchdog thread wakes
+ * periodically and logs any running pipeline whose stamp is older than the threshold, along
+ * with the chain of dependencies blocking it out of TaskGraph. Each stall is reported once;
+ * the report repeats only if the pipeline advances and stalls again.
+ *
+ * Reads ExecContext without synchronization, so a report may reflect a mid-update state. Good
+ * enough to name the deadlocked pipelines or the overrunning task; not precise accounting.
+ */
+class ExecStallWatchdog
+{
+public:
+    ~ExecStallWatchdog();
+
+    /**
+     * @brief Start the watchdog thread. Referenced objects must outlive stop()
+     *
+     * Stops any previously started thread first, so executors may call this on every load.
+     */
+    void start(Tasks const& tasks, TopTaskDataVec_t const& taskData, TaskGraph const& graph,
+               ExecContext const& exec, std::chrono::milliseconds threshold);
+
+    void stop();
+
+private:
+    std::thread             m_thread;
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    bool                    m_stop { false };
+};
+
 struct TopExecWriteState
 {
     Tasks const             &tasks;
@@ -51,6 +154,14 @@ struct TopExecWriteLog
     ExecContext const       &exec;
 };
 
+/**
+ * @brief Export recorded ExecTimeLog events as chrome://tracing "Trace Event Format" JSON
+ *
+ * Load the output into Perfetto or chrome://tracing to inspect per-task timings of a captured
+ * frame. Worker ids map to thread ids in the trace.
+ */
+void write_task_trace(std::ostream& rStream, TopTaskDataVec_t const& taskData, ExecTimeLog const& timeLog);
+
 std::ostream& operator<<(std::ostream& rStream, TopExecWriteState const& write);
 
 std::ostream& operator<<(std::ostream& rStream, TopExecWriteLog const& write);
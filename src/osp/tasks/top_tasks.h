@@ -27,16 +27,69 @@
 #include "tasks.h"
 #include "top_worker.h"
 
+#include <entt/core/any.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
-#include <vector>
 
 namespace osp
 {
 
+/**
+ * @brief Inline fixed-capacity list of TopDataIds a task accesses
+ *
+ * Replaces a heap-allocated vector so the executor's dispatch loop reads argument ids straight
+ * out of the contiguous TopTask array instead of chasing a per-task allocation. Task argument
+ * lists are short; capacity overflow asserts.
+ */
+class TopDataIdList
+{
+public:
+
+    static constexpr std::size_t smc_capacity = 12;
+
+    TopDataIdList() noexcept = default;
+
+    TopDataIdList(std::initializer_list<TopDataId> const list) noexcept
+    {
+        *this = list;
+    }
+
+    TopDataIdList& operator=(std::initializer_list<TopDataId> const list) noexcept
+    {
+        LGRN_ASSERTMV(list.size() <= smc_capacity, "Too many task arguments", list.size());
+        std::copy(list.begin(), list.end(), m_ids.begin());
+        m_count = std::uint8_t(list.size());
+        return *this;
+    }
+
+    TopDataId const* begin() const noexcept { return m_ids.data(); }
+    TopDataId const* end()   const noexcept { return m_ids.data() + m_count; }
+
+    std::size_t size()  const noexcept { return m_count; }
+    bool        empty() const noexcept { return m_count == 0; }
+
+    void clear() noexcept { m_count = 0; }
+
+private:
+
+    std::array<TopDataId, smc_capacity> m_ids;
+    std::uint8_t                        m_count { 0 };
+
+}; // class TopDataIdList
+
 struct TopTask
 {
     std::string             m_debugName;
-    std::vector<TopDataId>  m_dataUsed;
+    TopDataIdList           m_dataUsed;
+
+    /// Argument references pre-resolved from m_dataUsed by top_resolve_task_args, so the
+    /// executor hands them to m_func directly instead of rebuilding a span per invocation
+    std::array<entt::any, TopDataIdList::smc_capacity> m_dataRefs;
+
     TopTaskFunc_t           m_func              { nullptr };
 };
 
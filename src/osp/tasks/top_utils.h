@@ -144,7 +144,15 @@ struct wrap_args_trait
         else
         {
             LGRN_ASSERTMV(topData.size() > argIndex, "Task function has more arguments than TopDataIds provided", topData.size(), argIndex);
-            return entt::any_cast<T&>(topData[argIndex]);
+
+            // Argument types are resolved at compile time from the task function's
+            // signature, and top_emplace fixed each slot's type during session setup, so
+            // the per-argument any_cast type check branch is redundant in the prologue of
+            // every task invocation. Verify agreement in debug builds, access unchecked.
+            using Bare_t = std::remove_reference_t<T>;
+            entt::any &rAny = topData[argIndex];
+            LGRN_ASSERTM(entt::any_cast<Bare_t>(&rAny) != nullptr, "Task argument type does not match TopData slot");
+            return *static_cast<Bare_t*>(rAny.data());
         }
     }
 
@@ -233,6 +241,12 @@ struct TopTaskBuilder : public TaskBuilderBase<TopTaskBuilderTraits>
 
     TopTaskBuilder& operator=(TopTaskBuilder const& copy) = delete;
 
+    /// Called by create_tasks so bulk registration sizes TopTask storage once up front
+    void reserve_task_data(std::size_t const capacity)
+    {
+        m_rData.resize(capacity);
+    }
+
     TopTaskDataVec_t & m_rData;
 };
 
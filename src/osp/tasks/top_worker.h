@@ -45,7 +45,14 @@ struct Reserved {};
 
 struct WorkerContext
 {
-    //DependOnDirty_t m_dependOnDirty;
+    /// Index of the worker thread running the task. Zero on single-threaded executors.
+    unsigned int m_workerId     { 0 };
+
+    /// Total number of worker threads in the executor. One on single-threaded executors.
+    unsigned int m_workerCount  { 1 };
+
+    /// NUMA node the worker is pinned to; -1 when the executor isn't NUMA-aware
+    int m_numaNode              { -1 };
 };
 
 using TopTaskFunc_t = TaskActions(*)(WorkerContext, ArrayView<entt::any>) noexcept;
@@ -0,0 +1,173 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2022 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "tasks.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace osp
+{
+
+/**
+ * @brief Chase-Lev work-stealing deque of ready task ids, owned by one worker thread
+ *
+ * The owning worker pushes and pops at the bottom without contention; idle workers steal from
+ * the top with a single compare-exchange. Capacity is fixed at resize() time; the executor sizes
+ * each deque to the task id capacity, which the number of simultaneously-ready tasks can never
+ * exceed, so push() never needs to grow the ring.
+ *
+ * ID_T is TaskId for single-domain executors; top_run_parallel_multi packs a domain index into
+ * a wider id type. Any id lgrn::id_null supports works.
+ */
+template <typename ID_T>
+class WorkerDequeT
+{
+public:
+
+    /**
+     * @brief Allocate the ring buffer. Not thread-safe; call before workers start.
+     *
+     * @param minCapacity [in] Minimum capacity, rounded up to the next power of two
+     */
+    void resize(std::size_t minCapacity)
+    {
+        std::size_t capacity = 1;
+        while (capacity < minCapacity)
+        {
+            capacity <<= 1;
+        }
+
+        m_ring = std::make_unique<ID_T[]>(capacity);
+        m_mask = capacity - 1;
+        m_top.store(0, std::memory_order_relaxed);
+        m_bottom.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Push a ready task at the bottom. Owner thread only.
+     */
+    void push(ID_T const task) noexcept
+    {
+        std::int64_t const bottom = m_bottom.load(std::memory_order_relaxed);
+        m_ring[std::size_t(bottom) & m_mask] = task;
+
+        // Publish the slot before making it visible to thieves
+        m_bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pop the most recently pushed task. Owner thread only.
+     *
+     * @return Popped task, or null id if the deque is empty
+     */
+    ID_T try_pop() noexcept
+    {
+        std::int64_t const bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+
+        // Order the bottom update before reading top, against concurrent steals
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            // Deque was already empty; restore bottom
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return lgrn::id_null<ID_T>();
+        }
+
+        ID_T task = m_ring[std::size_t(bottom) & m_mask];
+
+        if (top == bottom)
+        {
+            // Last element; race against thieves for it
+            if ( ! m_top.compare_exchange_strong(top, top + 1,
+                                                 std::memory_order_seq_cst,
+                                                 std::memory_order_relaxed) )
+            {
+                task = lgrn::id_null<ID_T>(); // Thief got it first
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return task;
+    }
+
+    /**
+     * @brief Approximate emptiness check for sleep/wake decisions. Callable from any thread.
+     */
+    bool empty() const noexcept
+    {
+        return m_top.load(std::memory_order_acquire) >= m_bottom.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Steal the oldest task. Callable from any thread.
+     *
+     * @return Stolen task, or null id if the deque is empty or the steal lost a race
+     */
+    ID_T try_steal() noexcept
+    {
+        std::int64_t top = m_top.load(std::memory_order_acquire);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::int64_t const bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return lgrn::id_null<ID_T>(); // Empty
+        }
+
+        ID_T const task = m_ring[std::size_t(top) & m_mask];
+
+        if ( ! m_top.compare_exchange_strong(top, top + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed) )
+        {
+            return lgrn::id_null<ID_T>(); // Lost race against owner pop or another thief
+        }
+
+        return task;
+    }
+
+private:
+
+    std::unique_ptr<ID_T[]>     m_ring;
+    std::size_t                 m_mask      { 0 };
+
+    // Top and bottom on separate cache lines to keep thief CAS traffic off the owner's line
+    alignas(64) std::atomic<std::int64_t> m_top    { 0 };
+    alignas(64) std::atomic<std::int64_t> m_bottom { 0 };
+
+}; // class WorkerDequeT
+
+using WorkerDeque = WorkerDequeT<TaskId>;
+
+} // namespace osp
@@ -127,6 +127,160 @@ struct CoordTransformer
         return out;
     }
 
+    /**
+     * @brief Transform many positions stored as separate x/y/z arrays (see sat_views)
+     *
+     * Equivalent to transform_position per element, but the rotation tests and the c*2^m term
+     * are hoisted out of the loop; the common rotation-free case is a flat shift-add pass over
+     * whole int64 arrays that the compiler can vectorize.
+     */
+    void transform_positions(
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const x,
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const y,
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const z,
+            Corrade::Containers::ArrayView<Vector3g>                  const out) const noexcept
+    {
+        using osp::math::int_2pow;
+        using osp::math::mul_2pow;
+
+        std::size_t const count = out.size();
+        Vector3g    const cTerm = mul_2pow<Vector3g, spaceint_t>(Vector3g(m_c), m_m);
+
+        if ( ! quat_non_zero(m_rotIn) && ! quat_non_zero(m_rotOut) )
+        {
+            if (m_n >= 0)
+            {
+                spaceint_t const mul = int_2pow<spaceint_t>(m_n);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    out[i] = { x[i]*mul + cTerm.x(), y[i]*mul + cTerm.y(), z[i]*mul + cTerm.z() };
+                }
+            }
+            else
+            {
+                spaceint_t const div = int_2pow<spaceint_t>(-m_n);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    out[i] = { x[i]/div + cTerm.x(), y[i]/div + cTerm.y(), z[i]/div + cTerm.z() };
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                out[i] = transform_position({x[i], y[i], z[i]});
+            }
+        }
+    }
+
+    /**
+     * @brief Overload writing back into strided x/y/z arrays, for SoA-to-SoA transforms
+     *
+     * Input and output views may alias element-for-element (in-place transform), but must not
+     * partially overlap.
+     */
+    void transform_positions(
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const x,
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const y,
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const z,
+            Corrade::Containers::StridedArrayView1D<spaceint_t>       const xOut,
+            Corrade::Containers::StridedArrayView1D<spaceint_t>       const yOut,
+            Corrade::Containers::StridedArrayView1D<spaceint_t>       const zOut) const noexcept
+    {
+        using osp::math::int_2pow;
+        using osp::math::mul_2pow;
+
+        std::size_t const count = xOut.size();
+        Vector3g    const cTerm = mul_2pow<Vector3g, spaceint_t>(Vector3g(m_c), m_m);
+
+        if ( ! quat_non_zero(m_rotIn) && ! quat_non_zero(m_rotOut) )
+        {
+            if (m_n >= 0)
+            {
+                spaceint_t const mul = int_2pow<spaceint_t>(m_n);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    xOut[i] = x[i]*mul + cTerm.x();
+                    yOut[i] = y[i]*mul + cTerm.y();
+                    zOut[i] = z[i]*mul + cTerm.z();
+                }
+            }
+            else
+            {
+                spaceint_t const div = int_2pow<spaceint_t>(-m_n);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    xOut[i] = x[i]/div + cTerm.x();
+                    yOut[i] = y[i]/div + cTerm.y();
+                    zOut[i] = z[i]/div + cTerm.z();
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                Vector3g const out = transform_position({x[i], y[i], z[i]});
+                xOut[i] = out.x();
+                yOut[i] = out.y();
+                zOut[i] = out.z();
+            }
+        }
+    }
+
+    /**
+     * @brief Overload producing float positions in meters, for handing to scene/render code
+     *
+     * Folds the units-to-meters scaling (2^-precision) into the same hoisted pass, so callers
+     * don't need a Vector3g intermediate buffer plus a second per-element conversion loop.
+     */
+    void transform_positions_meters(
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const x,
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const y,
+            Corrade::Containers::StridedArrayView1D<spaceint_t const> const z,
+            int                                                       const precision,
+            Corrade::Containers::ArrayView<Vector3>                   const out) const noexcept
+    {
+        using osp::math::int_2pow;
+        using osp::math::mul_2pow;
+
+        std::size_t const count = out.size();
+        Vector3g    const cTerm = mul_2pow<Vector3g, spaceint_t>(Vector3g(m_c), m_m);
+        double      const scale = mul_2pow<double, int>(1.0, -precision);
+
+        if ( ! quat_non_zero(m_rotIn) && ! quat_non_zero(m_rotOut) )
+        {
+            if (m_n >= 0)
+            {
+                spaceint_t const mul = int_2pow<spaceint_t>(m_n);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    out[i] = Vector3( float(double(x[i]*mul + cTerm.x()) * scale),
+                                      float(double(y[i]*mul + cTerm.y()) * scale),
+                                      float(double(z[i]*mul + cTerm.z()) * scale) );
+                }
+            }
+            else
+            {
+                spaceint_t const div = int_2pow<spaceint_t>(-m_n);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    out[i] = Vector3( float(double(x[i]/div + cTerm.x()) * scale),
+                                      float(double(y[i]/div + cTerm.y()) * scale),
+                                      float(double(z[i]/div + cTerm.z()) * scale) );
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                out[i] = Vector3(Vector3d(transform_position({x[i], y[i], z[i]})) * scale);
+            }
+        }
+    }
+
     Quaterniond rotation() const noexcept
     {
         return m_rotOut * m_rotIn;
@@ -0,0 +1,250 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "propagation.h"
+
+#include "../core/math_2pow.h"
+
+#include <algorithm>
+#include <cmath>
+
+using Magnum::Math::cross;
+using Magnum::Math::dot;
+
+namespace osp::universe
+{
+
+namespace
+{
+
+/**
+ * @brief Kepler's equation M = E - e*sin(E), solved for eccentric anomaly E by Newton iteration
+ *
+ * Converges in a handful of steps for elliptic orbits; E = M is a good starting guess for low
+ * eccentricity.
+ */
+double solve_eccentric_anomaly(double const meanAnomaly, double const e) noexcept
+{
+    double eccAnomaly = meanAnomaly;
+    for (int iter = 0; iter < 8; ++iter)
+    {
+        double const delta = (eccAnomaly - e * std::sin(eccAnomaly) - meanAnomaly)
+                           / (1.0 - e * std::cos(eccAnomaly));
+        eccAnomaly -= delta;
+        if (std::abs(delta) < 1e-12)
+        {
+            break;
+        }
+    }
+    return eccAnomaly;
+}
+
+/**
+ * @brief Rotate an orbital-plane vector (periapsis towards +X) into world space
+ *
+ * Rotates by argument of periapsis, inclination, then longitude of ascending node.
+ */
+Vector3d orbit_plane_to_world(KeplerOrbit const &orbit, double const planeX, double const planeY) noexcept
+{
+    double const cosW = std::cos(orbit.argPeriapsis);
+    double const sinW = std::sin(orbit.argPeriapsis);
+    double const cosI = std::cos(orbit.inclination);
+    double const sinI = std::sin(orbit.inclination);
+    double const cosO = std::cos(orbit.longAscendingNode);
+    double const sinO = std::sin(orbit.longAscendingNode);
+
+    double const xw = planeX * cosW - planeY * sinW;
+    double const yw = planeX * sinW + planeY * cosW;
+
+    return { xw * cosO - yw * cosI * sinO,
+             xw * sinO + yw * cosI * cosO,
+             yw * sinI };
+}
+
+} // namespace
+
+void propagate_central_euler(
+        SatPosView_t const x,  SatPosView_t const y,  SatPosView_t const z,
+        SatVelView_t const vx, SatVelView_t const vy, SatVelView_t const vz,
+        std::uint32_t const count, int const precision,
+        double const deltaTime, double const gravity) noexcept
+{
+    double const scale      = math::mul_2pow<double, int>(1.0, -precision); // units -> meters
+    double const scaleDelta = deltaTime / scale;                            // (m/s) -> units/step
+
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        x[i] += spaceint_t(vx[i] * scaleDelta);
+        y[i] += spaceint_t(vy[i] * scaleDelta);
+        z[i] += spaceint_t(vz[i] * scaleDelta);
+
+        Vector3d const pos   = Vector3d(Vector3g(x[i], y[i], z[i])) * scale;
+        double   const r     = pos.length();
+        Vector3d const accel = -pos * (deltaTime * gravity / (r * r * r));
+
+        vx[i] += accel.x();
+        vy[i] += accel.y();
+        vz[i] += accel.z();
+    }
+}
+
+Vector3d kepler_position(KeplerOrbit const &orbit, double const timeSinceEpoch) noexcept
+{
+    double const a  = orbit.semiMajorAxis;
+    double const e  = orbit.eccentricity;
+    double const n  = std::sqrt(orbit.gravitationalParam / (a * a * a)); // mean motion, rad/s
+
+    double const meanAnomaly = orbit.meanAnomalyEpoch + n * timeSinceEpoch;
+    double const eccAnomaly  = solve_eccentric_anomaly(meanAnomaly, e);
+
+    // Position in the orbital plane, periapsis towards +X
+    double const planeX = a * (std::cos(eccAnomaly) - e);
+    double const planeY = a * std::sqrt(1.0 - e * e) * std::sin(eccAnomaly);
+
+    return orbit_plane_to_world(orbit, planeX, planeY);
+}
+
+Vector3d kepler_velocity(KeplerOrbit const &orbit, double const timeSinceEpoch) noexcept
+{
+    double const a  = orbit.semiMajorAxis;
+    double const e  = orbit.eccentricity;
+    double const n  = std::sqrt(orbit.gravitationalParam / (a * a * a));
+
+    double const meanAnomaly = orbit.meanAnomalyEpoch + n * timeSinceEpoch;
+    double const eccAnomaly  = solve_eccentric_anomaly(meanAnomaly, e);
+
+    // dE/dt from differentiating Kepler's equation
+    double const eccAnomalyRate = n / (1.0 - e * std::cos(eccAnomaly));
+
+    double const planeVx = -a * std::sin(eccAnomaly) * eccAnomalyRate;
+    double const planeVy =  a * std::sqrt(1.0 - e * e) * std::cos(eccAnomaly) * eccAnomalyRate;
+
+    return orbit_plane_to_world(orbit, planeVx, planeVy);
+}
+
+bool kepler_from_state(
+        Vector3d const pos, Vector3d const vel,
+        double const gravitationalParam, KeplerOrbit &rOrbitOut) noexcept
+{
+    constexpr double tolerance = 1e-9;
+
+    double const r = pos.length();
+
+    Vector3d const hVec = cross(pos, vel); // specific angular momentum
+    double   const h    = hVec.length();
+
+    if (r < tolerance || h < tolerance)
+    {
+        return false; // at the attractor, or a degenerate radial trajectory
+    }
+
+    // Specific orbital energy; only bound elliptic orbits are representable
+    double const energy = 0.5 * vel.dot() - gravitationalParam / r;
+    if (energy >= 0.0)
+    {
+        return false;
+    }
+
+    double const a = -gravitationalParam / (2.0 * energy);
+
+    Vector3d const eVec = cross(vel, hVec) / gravitationalParam - pos / r;
+    double   const e    = eVec.length();
+    if (e >= 1.0)
+    {
+        return false; // numeric safety; bound orbits should stay below 1
+    }
+
+    Vector3d const hUnit = hVec / h;
+
+    double const inclination = std::acos(std::clamp(hUnit.z(), -1.0, 1.0));
+
+    // Node vector: z-axis cross h, pointing at the ascending node. Vanishes for equatorial
+    // orbits, where the node is undefined and angles are measured from +X instead
+    Vector3d const nVec{-hVec.y(), hVec.x(), 0.0};
+    double   const nLen = nVec.length();
+
+    double longAscendingNode {0.0};
+    double argPeriapsis      {0.0};
+
+    if (nLen > tolerance)
+    {
+        longAscendingNode = std::atan2(nVec.y(), nVec.x());
+    }
+
+    if (e > tolerance)
+    {
+        if (nLen > tolerance)
+        {
+            Vector3d const nUnit = nVec / nLen;
+            Vector3d const eUnit = eVec / e;
+            argPeriapsis = std::atan2(dot(cross(nUnit, eUnit), hUnit), dot(nUnit, eUnit));
+        }
+        else
+        {
+            argPeriapsis = std::atan2(eVec.y(), eVec.x());
+        }
+    }
+
+    // True anomaly from the periapsis direction, or the node/+X reference when circular
+    Vector3d const refDir = (e    > tolerance) ? eVec / e
+                          : (nLen > tolerance) ? nVec / nLen
+                          :                      Vector3d{1.0, 0.0, 0.0};
+
+    double const trueAnomaly = std::atan2(dot(cross(refDir, pos / r), hUnit), dot(refDir, pos / r));
+
+    // Eccentric anomaly from true anomaly, then mean anomaly through Kepler's equation
+    double const eccAnomaly  = 2.0 * std::atan2(std::sqrt(1.0 - e) * std::sin(0.5 * trueAnomaly),
+                                                std::sqrt(1.0 + e) * std::cos(0.5 * trueAnomaly));
+    double const meanAnomaly = eccAnomaly - e * std::sin(eccAnomaly);
+
+    rOrbitOut = {
+        .semiMajorAxis      = a,
+        .eccentricity       = e,
+        .inclination        = inclination,
+        .argPeriapsis       = argPeriapsis,
+        .longAscendingNode  = longAscendingNode,
+        .meanAnomalyEpoch   = meanAnomaly,
+        .gravitationalParam = gravitationalParam,
+    };
+    return true;
+}
+
+void propagate_kepler(
+        Corrade::Containers::ArrayView<KeplerOrbit const> const orbits,
+        double const time, int const precision,
+        SatPosView_t const x, SatPosView_t const y, SatPosView_t const z) noexcept
+{
+    double const invScale = math::mul_2pow<double, int>(1.0, precision); // meters -> units
+
+    for (std::size_t i = 0; i < orbits.size(); ++i)
+    {
+        Vector3d const pos = kepler_position(orbits[i], time) * invScale;
+
+        x[i] = spaceint_t(pos.x());
+        y[i] = spaceint_t(pos.y());
+        z[i] = spaceint_t(pos.z());
+    }
+}
+
+} // namespace osp::universe
@@ -0,0 +1,115 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Fixed-timestep satellite propagation over CoSpaceSatData's SoA arrays
+ */
+
+#include "universetypes.h"
+
+#include "../core/math_types.h"
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include <cstdint>
+
+namespace osp::universe
+{
+
+using SatPosView_t = Corrade::Containers::StridedArrayView1D<spaceint_t>;
+using SatVelView_t = Corrade::Containers::StridedArrayView1D<double>;
+
+/**
+ * @brief Step satellites under a central inverse-square attractor at the origin
+ *
+ * Position-first semi-implicit Euler over the strided x/y/z (space units) and vx/vy/vz (m/s)
+ * arrays that sat_views produces: positions advance by current velocity, then velocities gain
+ * the acceleration evaluated at the new position. Symplectic, so orbits stay bounded over long
+ * runs instead of spiraling like plain explicit Euler.
+ *
+ * @param gravity [in] Standard gravitational parameter GM of the attractor, m^3/s^2
+ */
+void propagate_central_euler(
+        SatPosView_t x,  SatPosView_t y,  SatPosView_t z,
+        SatVelView_t vx, SatVelView_t vy, SatVelView_t vz,
+        std::uint32_t count, int precision, double deltaTime, double gravity) noexcept;
+
+/**
+ * @brief Classical orbital elements for a body on rails around an origin-centered attractor
+ *
+ * Angles in radians, lengths in meters. Elliptic orbits only (eccentricity < 1).
+ */
+struct KeplerOrbit
+{
+    double semiMajorAxis    {};
+    double eccentricity     {};
+    double inclination      {};
+    double argPeriapsis     {};
+    double longAscendingNode{};
+    double meanAnomalyEpoch {};
+    double gravitationalParam{}; ///< GM of the attractor, m^3/s^2
+};
+
+/**
+ * @brief Closed-form position of a railed body at a given time, in meters
+ *
+ * Solves Kepler's equation by Newton iteration; cost is constant per call regardless of time,
+ * so railed bodies need no per-step integration at all.
+ */
+Vector3d kepler_position(KeplerOrbit const &orbit, double timeSinceEpoch) noexcept;
+
+/**
+ * @brief Closed-form velocity of a railed body at a given time, in m/s
+ *
+ * Companion to kepler_position; use when handing a railed body back to numeric integration.
+ */
+Vector3d kepler_velocity(KeplerOrbit const &orbit, double timeSinceEpoch) noexcept;
+
+/**
+ * @brief Derive orbital elements from an instantaneous state around the origin attractor
+ *
+ * Position in meters, velocity in m/s. meanAnomalyEpoch is set so evaluating the returned
+ * elements at timeSinceEpoch = 0 reproduces the given state. Only bound elliptic orbits can be
+ * represented; returns false and leaves rOrbitOut untouched for parabolic/hyperbolic energies
+ * and degenerate radial trajectories.
+ */
+bool kepler_from_state(
+        Vector3d pos, Vector3d vel, double gravitationalParam, KeplerOrbit &rOrbitOut) noexcept;
+
+/**
+ * @brief Evaluate railed bodies in bulk, writing positions into strided SoA views
+ *
+ * Use for large debris fields: elements stay fixed, and only bodies currently needing a
+ * position (rendering, proximity) have to be evaluated.
+ */
+void propagate_kepler(
+        Corrade::Containers::ArrayView<KeplerOrbit const> orbits,
+        double time, int precision,
+        SatPosView_t x, SatPosView_t y, SatPosView_t z) noexcept;
+
+} // namespace osp::universe
@@ -0,0 +1,154 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Smallest-three quantized satellite rotations
+ *
+ * A unit quaternion's largest component can be reconstructed from the other three, and those
+ * three always fall within [-1/√2, 1/√2]. Packing stores the index of the largest component
+ * (sign-flipped positive) in the top bits and the remaining three quantized to 20 bits each,
+ * fitting a rotation in one 64-bit word instead of four doubles. Worst-case quantization error
+ * is on the order of microradians — far below what inert debris orientation needs, at a quarter
+ * of the memory traffic.
+ */
+
+#include "universe.h"
+
+#include <Magnum/Math/Constants.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace osp::universe
+{
+
+/**
+ * @brief Pack a unit quaternion into a 64-bit smallest-three word
+ *
+ * Layout: bits [60..61] index of the largest-magnitude component (0..2 vector xyz, 3 scalar),
+ * bits [0..59] the other three components in xyzw order, each quantized to 20 bits over
+ * [-1/√2, 1/√2]. The quaternion's sign is normalized so the dropped component is non-negative;
+ * q and -q represent the same rotation, so this is lossless.
+ */
+inline SatRotPacked rotation_pack(Quaterniond const &q) noexcept
+{
+    double const comp[4] = { q.vector().x(), q.vector().y(), q.vector().z(), q.scalar() };
+
+    int largest = 0;
+    for (int i = 1; i < 4; ++i)
+    {
+        if (std::abs(comp[i]) > std::abs(comp[largest]))
+        {
+            largest = i;
+        }
+    }
+
+    double const sign = (comp[largest] < 0.0) ? -1.0 : 1.0;
+
+    constexpr double quantMax = double((std::uint64_t(1) << 20) - 1);
+    double const sqrt2 = Magnum::Math::Constants<double>::sqrt2();
+
+    SatRotPacked out = SatRotPacked(largest) << 60;
+    int shift = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (i == largest)
+        {
+            continue;
+        }
+        // Map [-1/√2, 1/√2] to [0, 1] then quantize
+        double const unit = comp[i] * sign * sqrt2 * 0.5 + 0.5;
+        out |= SatRotPacked(std::llround(unit * quantMax)) << shift;
+        shift += 20;
+    }
+    return out;
+}
+
+/**
+ * @brief Unpack a word written by rotation_pack back into a unit quaternion
+ */
+inline Quaterniond rotation_unpack(SatRotPacked const packed) noexcept
+{
+    int const largest = int(packed >> 60) & 0x3;
+
+    constexpr double quantMax = double((std::uint64_t(1) << 20) - 1);
+    double const sqrtHalf = Magnum::Math::Constants<double>::sqrtHalf();
+
+    double comp[4];
+    double sumSq = 0.0;
+    int shift = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (i == largest)
+        {
+            continue;
+        }
+        auto const bits = (packed >> shift) & 0xFFFFF;
+        double const c = (double(bits) / quantMax * 2.0 - 1.0) * sqrtHalf;
+        comp[i] = c;
+        sumSq += c * c;
+        shift += 20;
+    }
+    comp[largest] = std::sqrt(std::max(0.0, 1.0 - sumSq));
+
+    return Quaterniond{ {comp[0], comp[1], comp[2]}, comp[3] };
+}
+
+/**
+ * @brief Read a satellite's rotation regardless of which rotation layout the cospace uses
+ */
+inline Quaterniond sat_rotation_get(CoSpaceSatData const &satData, SatId const sat) noexcept
+{
+    auto const data = Corrade::Containers::arrayView(satData.m_data);
+    if ( ! satData.m_satRotationsPacked.not_used())
+    {
+        return rotation_unpack(satData.m_satRotationsPacked.view(data, satData.m_satCount)[sat]);
+    }
+    auto const [qx, qy, qz, qw] = sat_views(satData.m_satRotations, satData.m_data, satData.m_satCount);
+    return Quaterniond{ {qx[sat], qy[sat], qz[sat]}, qw[sat] };
+}
+
+/**
+ * @brief Write a satellite's rotation regardless of which rotation layout the cospace uses
+ */
+inline void sat_rotation_set(CoSpaceSatData &rSatData, SatId const sat, Quaterniond const &q) noexcept
+{
+    auto const data = Corrade::Containers::arrayView(rSatData.m_data);
+    if ( ! rSatData.m_satRotationsPacked.not_used())
+    {
+        rSatData.m_satRotationsPacked.view(data, rSatData.m_satCount)[sat] = rotation_pack(q);
+        return;
+    }
+    auto const [qx, qy, qz, qw] = sat_views(rSatData.m_satRotations, rSatData.m_data, rSatData.m_satCount);
+    qx[sat] = q.vector().x();
+    qy[sat] = q.vector().y();
+    qz[sat] = q.vector().z();
+    qw[sat] = q.scalar();
+}
+
+} // namespace osp::universe
@@ -0,0 +1,176 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "satindex.h"
+
+#include <osp/core/math_int64.h>
+
+#include <algorithm>
+#include <array>
+
+namespace osp::universe
+{
+
+static std::uint64_t hash_cell(
+        spaceint_t const cx, spaceint_t const cy, spaceint_t const cz) noexcept
+{
+    std::uint64_t const h = std::uint64_t(cx) * 0x9E3779B97F4A7C15ull
+                          ^ std::uint64_t(cy) * 0xC2B2AE3D27D4EB4Full
+                          ^ std::uint64_t(cz) * 0x165667B19E3779F9ull;
+
+    // smc_cellNone means 'not binned'; remap the one key that would collide with it
+    return (h != SatSpatialIndex::smc_cellNone) ? h : 0;
+}
+
+void SatSpatialIndex::resize(std::uint32_t const satCapacity)
+{
+    satCells.resize(satCapacity, smc_cellNone);
+}
+
+void SatSpatialIndex::update(
+        PosViewConst_t const x, PosViewConst_t const y, PosViewConst_t const z,
+        std::uint32_t const count)
+{
+    for (std::uint32_t sat = 0; sat < count; ++sat)
+    {
+        std::uint64_t const key = hash_cell(x[sat] >> cellExponent,
+                                            y[sat] >> cellExponent,
+                                            z[sat] >> cellExponent);
+        std::uint64_t const prev = satCells[sat];
+
+        if (key == prev)
+        {
+            continue; // Still in the same cell; the common case
+        }
+
+        if (prev != smc_cellNone)
+        {
+            std::vector<SatId> &rBucket = cells[prev];
+            rBucket.erase(std::find(rBucket.begin(), rBucket.end(), SatId(sat)));
+            if (rBucket.empty())
+            {
+                cells.erase(prev);
+            }
+        }
+
+        cells[key].push_back(SatId(sat));
+        satCells[sat] = key;
+    }
+}
+
+void SatSpatialIndex::query_radius(
+        Vector3g const center, spaceint_t const radius,
+        PosViewConst_t const x, PosViewConst_t const y, PosViewConst_t const z,
+        std::vector<SatId> &rFoundOut) const
+{
+    double const radiusSq = double(radius) * double(radius);
+
+    // Typical radii fit is_distance_near's threshold limit, taking the exact-integer batched
+    // filter below; oversized queries fall back to the scalar double test
+    constexpr spaceint_t batchRadiusMax = 1431655765l;
+    bool const useBatched = (radius > 0) && (radius <= batchRadiusMax);
+
+    // Cell range covering the query sphere's bounding box
+    spaceint_t const cxMin = (center.x() - radius) >> cellExponent;
+    spaceint_t const cyMin = (center.y() - radius) >> cellExponent;
+    spaceint_t const czMin = (center.z() - radius) >> cellExponent;
+    spaceint_t const cxMax = (center.x() + radius) >> cellExponent;
+    spaceint_t const cyMax = (center.y() + radius) >> cellExponent;
+    spaceint_t const czMax = (center.z() + radius) >> cellExponent;
+
+    // Hash collisions can map several visited cells to the same bucket; remember which buckets
+    // were already walked so satellites aren't reported twice
+    std::vector<std::uint64_t> visited;
+
+    for (spaceint_t cz = czMin; cz <= czMax; ++cz)
+    for (spaceint_t cy = cyMin; cy <= cyMax; ++cy)
+    for (spaceint_t cx = cxMin; cx <= cxMax; ++cx)
+    {
+        std::uint64_t const key = hash_cell(cx, cy, cz);
+
+        auto const found = cells.find(key);
+        if (found == cells.end())
+        {
+            continue;
+        }
+
+        if (std::find(visited.begin(), visited.end(), key) != visited.end())
+        {
+            continue;
+        }
+        visited.push_back(key);
+
+        // The distance filter is exact; it also discards bucket-mates from hash-colliding
+        // far-away cells
+        std::vector<SatId> const &bucket = found->second;
+
+        if (useBatched)
+        {
+            // Gather candidate positions into contiguous blocks so the branch-free integer
+            // kernel can vectorize the compares
+            constexpr std::size_t blockSize = 64;
+            std::array<Vector3g,     blockSize> gathered;
+            std::array<std::uint8_t, blockSize> nearBytes;
+
+            for (std::size_t blockFirst = 0; blockFirst < bucket.size(); blockFirst += blockSize)
+            {
+                std::size_t const count = std::min(blockSize, bucket.size() - blockFirst);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    SatId const sat = bucket[blockFirst + i];
+                    gathered[i] = {x[sat], y[sat], z[sat]};
+                }
+
+                is_distance_near_batched(
+                        center, {gathered.data(), count},
+                        std::uint64_t(radius), {nearBytes.data(), count});
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    if (nearBytes[i] != 0)
+                    {
+                        rFoundOut.push_back(bucket[blockFirst + i]);
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (SatId const sat : bucket)
+            {
+                double const dx = double(x[sat] - center.x());
+                double const dy = double(y[sat] - center.y());
+                double const dz = double(z[sat] - center.z());
+
+                if (dx*dx + dy*dy + dz*dz < radiusSq)
+                {
+                    rFoundOut.push_back(sat);
+                }
+            }
+        }
+    }
+}
+
+} // namespace osp::universe
@@ -0,0 +1,95 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Uniform-grid spatial index over satellite positions
+ */
+
+#include "universetypes.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace osp::universe
+{
+
+/**
+ * @brief Uniform-grid spatial index over satellite positions for radius queries
+ *
+ * Satellites are binned into cubic cells of 2^cellExponent space units, keyed by a hash of
+ * their cell coordinates. update() re-bins only satellites whose cell changed since the last
+ * call, so per-update cost tracks how many satellites crossed a cell boundary rather than the
+ * total count. Hash collisions merge distant cells into one bucket, which only adds candidates
+ * that query_radius's exact distance filter throws away.
+ *
+ * Pick cellExponent so cells are around the size of typical query radii; query_radius visits
+ * every cell overlapping the query sphere's bounding box.
+ */
+struct SatSpatialIndex
+{
+    using PosViewConst_t = Corrade::Containers::StridedArrayView1D<spaceint_t const>;
+
+    /**
+     * @brief Grow per-satellite bookkeeping; new slots start outside of any cell
+     */
+    void resize(std::uint32_t satCapacity);
+
+    /**
+     * @brief Bin satellites [0, count) into cells, or move ones whose cell changed
+     *
+     * Call after satellite positions move. Also serves as the initial build.
+     */
+    void update(PosViewConst_t x, PosViewConst_t y, PosViewConst_t z, std::uint32_t count);
+
+    /**
+     * @brief Find all satellites within radius space units of center
+     *
+     * Positions are re-read from the given views for the exact distance test, so they must be
+     * the same data update() last binned. Results are appended to rFoundOut in no particular
+     * order, without duplicates.
+     */
+    void query_radius(
+            Vector3g center, spaceint_t radius,
+            PosViewConst_t x, PosViewConst_t y, PosViewConst_t z,
+            std::vector<SatId> &rFoundOut) const;
+
+    /// Cells are 2^cellExponent space units across. Changing this invalidates current binning;
+    /// follow with resize + update after clearing satCells.
+    int cellExponent{19};
+
+    std::unordered_map< std::uint64_t, std::vector<SatId> > cells;
+
+    /// Hashed cell key each satellite currently sits in, smc_cellNone if not binned yet
+    std::vector<std::uint64_t> satCells;
+
+    static constexpr std::uint64_t smc_cellNone = ~std::uint64_t(0);
+};
+
+} // namespace osp::universe
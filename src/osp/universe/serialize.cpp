@@ -0,0 +1,361 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "serialize.h"
+
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace osp::universe
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> gc_snapshotMagic{{'O','S','P','U','N','I','V','\0'}};
+constexpr std::array<char, 8> gc_deltaMagic   {{'O','S','P','U','D','L','T','\0'}};
+constexpr std::uint32_t       gc_formatVersion{1};
+
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    std::uint32_t       version;
+    std::uint32_t       coSpaceCapacity;
+    std::uint32_t       recordCount;
+};
+
+struct StrideRecord
+{
+    std::uint64_t offset;
+    std::int64_t  stride;
+};
+
+struct CoSpaceRecord
+{
+    std::uint32_t id;
+    std::uint32_t parent;
+    std::uint32_t parentSat;
+    std::int32_t  precision;
+    double        rotation[4]; // xyzw
+    spaceint_t    position[3];
+    std::uint32_t satCount;
+    std::uint32_t satCapacity;
+    std::uint64_t dataBytes;
+    StrideRecord  strides[11]; // positions xyz, velocities xyz, rotations xyzw, packed rotations
+};
+
+struct DeltaEntry
+{
+    std::uint32_t sat;
+    spaceint_t    pos[3];
+};
+
+template <typename T>
+void write_pod(std::ostream &rStream, T const &value)
+{
+    rStream.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_pod(std::istream &rStream, T &rValue)
+{
+    rStream.read(reinterpret_cast<char*>(&rValue), sizeof(T));
+    return bool(rStream);
+}
+
+std::size_t cospace_data_bytes(CoSpaceSatData const &satData) noexcept
+{
+    // Reservation-backed data only has its committed prefix worth saving
+    return (satData.m_dataCommitted != 0) ? satData.m_dataCommitted : satData.m_data.size();
+}
+
+void pack_strides(CoSpaceSatData const &satData, StrideRecord (&rOut)[11]) noexcept
+{
+    int i = 0;
+    for (StrideDesc const &desc : satData.m_satPositions)  { rOut[i++] = {desc.m_offset, desc.m_stride}; }
+    for (StrideDesc const &desc : satData.m_satVelocities) { rOut[i++] = {desc.m_offset, desc.m_stride}; }
+    for (StrideDesc const &desc : satData.m_satRotations)  { rOut[i++] = {desc.m_offset, desc.m_stride}; }
+    rOut[i] = {satData.m_satRotationsPacked.m_offset, satData.m_satRotationsPacked.m_stride};
+}
+
+void unpack_strides(StrideRecord const (&in)[11], CoSpaceSatData &rSatData) noexcept
+{
+    int i = 0;
+    for (StrideDesc &rDesc : rSatData.m_satPositions)  { rDesc.m_offset = in[i].offset; rDesc.m_stride = in[i].stride; ++i; }
+    for (StrideDesc &rDesc : rSatData.m_satVelocities) { rDesc.m_offset = in[i].offset; rDesc.m_stride = in[i].stride; ++i; }
+    for (StrideDesc &rDesc : rSatData.m_satRotations)  { rDesc.m_offset = in[i].offset; rDesc.m_stride = in[i].stride; ++i; }
+    rSatData.m_satRotationsPacked.m_offset = in[i].offset;
+    rSatData.m_satRotationsPacked.m_stride = in[i].stride;
+}
+
+} // namespace
+
+
+void write_universe_snapshot(std::ostream &rStream, Universe const &universe)
+{
+    FileHeader header;
+    header.magic           = gc_snapshotMagic;
+    header.version         = gc_formatVersion;
+    header.coSpaceCapacity = std::uint32_t(universe.m_coordIds.capacity());
+    header.recordCount     = std::uint32_t(universe.m_coordIds.size());
+    write_pod(rStream, header);
+
+    for (std::uint32_t id = 0; id < header.coSpaceCapacity; ++id)
+    {
+        if ( ! universe.m_coordIds.exists(CoSpaceId(id)) )
+        {
+            continue;
+        }
+
+        CoSpaceCommon const &rCommon = universe.m_coordCommon[id];
+
+        CoSpaceRecord record;
+        record.id          = id;
+        record.parent      = rCommon.m_parent;
+        record.parentSat   = rCommon.m_parentSat;
+        record.precision   = rCommon.m_precision;
+        record.rotation[0] = rCommon.m_rotation.vector().x();
+        record.rotation[1] = rCommon.m_rotation.vector().y();
+        record.rotation[2] = rCommon.m_rotation.vector().z();
+        record.rotation[3] = rCommon.m_rotation.scalar();
+        record.position[0] = rCommon.m_position.x();
+        record.position[1] = rCommon.m_position.y();
+        record.position[2] = rCommon.m_position.z();
+        record.satCount    = rCommon.m_satCount;
+        record.satCapacity = rCommon.m_satCapacity;
+        record.dataBytes   = cospace_data_bytes(rCommon);
+        pack_strides(rCommon, record.strides);
+
+        write_pod(rStream, record);
+        rStream.write(reinterpret_cast<char const*>(rCommon.m_data.data()),
+                      std::streamsize(record.dataBytes));
+    }
+}
+
+bool read_universe_snapshot(std::istream &rStream, Universe &rUniverse)
+{
+    FileHeader header;
+    if (   ! read_pod(rStream, header)
+        || std::memcmp(header.magic.data(), gc_snapshotMagic.data(), sizeof(header.magic)) != 0
+        || header.version != gc_formatVersion)
+    {
+        return false;
+    }
+
+    // Recreate the ID registry: IDs are handed out in order on a fresh registry, so create all
+    // of them and remove the ones the snapshot doesn't contain
+    std::vector<CoSpaceId> allIds(header.coSpaceCapacity);
+    rUniverse.m_coordIds.create(allIds.begin(), allIds.end());
+    rUniverse.m_coordCommon.resize(rUniverse.m_coordIds.capacity());
+
+    std::vector<bool> present(header.coSpaceCapacity, false);
+
+    for (std::uint32_t i = 0; i < header.recordCount; ++i)
+    {
+        CoSpaceRecord record;
+        if ( ! read_pod(rStream, record) || record.id >= header.coSpaceCapacity)
+        {
+            return false;
+        }
+        present[record.id] = true;
+
+        CoSpaceCommon &rCommon = rUniverse.m_coordCommon[record.id];
+        rCommon.m_parent      = record.parent;
+        rCommon.m_parentSat   = record.parentSat;
+        rCommon.m_precision   = record.precision;
+        rCommon.m_rotation    = Quaterniond{
+                {record.rotation[0], record.rotation[1], record.rotation[2]}, record.rotation[3]};
+        rCommon.m_position    = Vector3g{record.position[0], record.position[1], record.position[2]};
+        rCommon.m_satCount    = record.satCount;
+        rCommon.m_satCapacity = record.satCapacity;
+        unpack_strides(record.strides, rCommon);
+
+        rCommon.m_data = Corrade::Containers::Array<unsigned char>{
+                Corrade::NoInit, std::size_t(record.dataBytes)};
+        rStream.read(reinterpret_cast<char*>(rCommon.m_data.data()),
+                     std::streamsize(record.dataBytes));
+        if ( ! rStream )
+        {
+            return false;
+        }
+    }
+
+    for (std::uint32_t id = 0; id < header.coSpaceCapacity; ++id)
+    {
+        if ( ! present[id] )
+        {
+            rUniverse.m_coordIds.remove(CoSpaceId(id));
+        }
+    }
+
+    return true;
+}
+
+void universe_delta_rebase(Universe const &universe, UniverseDeltaBaseline &rBaseline)
+{
+    std::size_t const capacity = universe.m_coordIds.capacity();
+    rBaseline.positions.resize(capacity);
+
+    for (std::uint32_t id = 0; id < capacity; ++id)
+    {
+        std::vector<Vector3g> &rPositions = rBaseline.positions[id];
+        if ( ! universe.m_coordIds.exists(CoSpaceId(id)) )
+        {
+            rPositions.clear();
+            continue;
+        }
+
+        CoSpaceCommon const &rCommon = universe.m_coordCommon[id];
+        auto const [x, y, z] = sat_views(rCommon.m_satPositions, rCommon.m_data, rCommon.m_satCount);
+
+        rPositions.resize(rCommon.m_satCount);
+        for (std::uint32_t sat = 0; sat < rCommon.m_satCount; ++sat)
+        {
+            rPositions[sat] = {x[sat], y[sat], z[sat]};
+        }
+    }
+}
+
+void write_universe_delta(
+        std::ostream &rStream, Universe const &universe,
+        UniverseDeltaBaseline &rBaseline, spaceint_t const threshold)
+{
+    std::size_t const capacity = universe.m_coordIds.capacity();
+    rBaseline.positions.resize(capacity);
+
+    double const thresholdSq = double(threshold) * double(threshold);
+
+    // Record layout per space: u32 id, u32 entry count, then DeltaEntry[count]. Spaces without
+    // movement are skipped entirely, so count them first for the header.
+    std::vector<DeltaEntry> entries;
+
+    FileHeader header;
+    header.magic           = gc_deltaMagic;
+    header.version         = gc_formatVersion;
+    header.coSpaceCapacity = std::uint32_t(capacity);
+    header.recordCount     = 0;
+
+    auto const headerPos = rStream.tellp();
+    write_pod(rStream, header);
+
+    for (std::uint32_t id = 0; id < capacity; ++id)
+    {
+        if ( ! universe.m_coordIds.exists(CoSpaceId(id)) )
+        {
+            continue;
+        }
+
+        CoSpaceCommon const &rCommon = universe.m_coordCommon[id];
+        auto const [x, y, z] = sat_views(rCommon.m_satPositions, rCommon.m_data, rCommon.m_satCount);
+
+        std::vector<Vector3g> &rPositions = rBaseline.positions[id];
+
+        entries.clear();
+        for (std::uint32_t sat = 0; sat < rCommon.m_satCount; ++sat)
+        {
+            Vector3g const pos{x[sat], y[sat], z[sat]};
+
+            if (sat < rPositions.size())
+            {
+                Vector3g const diff = pos - rPositions[sat];
+                double const distSq = double(diff.x())*double(diff.x())
+                                    + double(diff.y())*double(diff.y())
+                                    + double(diff.z())*double(diff.z());
+                if (distSq < thresholdSq)
+                {
+                    continue;
+                }
+                rPositions[sat] = pos;
+            }
+            else
+            {
+                // Newly added satellite, not in the baseline yet; always emit
+                rPositions.resize(sat + 1);
+                rPositions[sat] = pos;
+            }
+
+            entries.push_back({sat, {pos.x(), pos.y(), pos.z()}});
+        }
+
+        if (entries.empty())
+        {
+            continue;
+        }
+
+        write_pod(rStream, id);
+        write_pod(rStream, std::uint32_t(entries.size()));
+        rStream.write(reinterpret_cast<char const*>(entries.data()),
+                      std::streamsize(entries.size() * sizeof(DeltaEntry)));
+        ++header.recordCount;
+    }
+
+    auto const endPos = rStream.tellp();
+    rStream.seekp(headerPos);
+    write_pod(rStream, header);
+    rStream.seekp(endPos);
+}
+
+bool read_universe_delta(std::istream &rStream, Universe &rUniverse)
+{
+    FileHeader header;
+    if (   ! read_pod(rStream, header)
+        || std::memcmp(header.magic.data(), gc_deltaMagic.data(), sizeof(header.magic)) != 0
+        || header.version != gc_formatVersion)
+    {
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < header.recordCount; ++i)
+    {
+        std::uint32_t id;
+        std::uint32_t count;
+        if (   ! read_pod(rStream, id) || ! read_pod(rStream, count)
+            || id >= rUniverse.m_coordCommon.size()
+            || ! rUniverse.m_coordIds.exists(CoSpaceId(id)))
+        {
+            return false;
+        }
+
+        CoSpaceCommon &rCommon = rUniverse.m_coordCommon[id];
+        auto const [x, y, z] = sat_views(rCommon.m_satPositions, rCommon.m_data, rCommon.m_satCount);
+
+        for (std::uint32_t j = 0; j < count; ++j)
+        {
+            DeltaEntry entry;
+            if ( ! read_pod(rStream, entry) || entry.sat >= rCommon.m_satCount)
+            {
+                return false;
+            }
+
+            x[entry.sat] = entry.pos[0];
+            y[entry.sat] = entry.pos[1];
+            z[entry.sat] = entry.pos[2];
+        }
+    }
+
+    return true;
+}
+
+} // namespace osp::universe
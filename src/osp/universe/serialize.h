@@ -0,0 +1,94 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Binary universe state snapshots and position delta records
+ *
+ * Snapshots write each coordinate space's transform, hierarchy, stride layout, and raw
+ * interleaved satellite buffer straight from memory; deltas record only satellites that moved
+ * beyond a threshold since the last checkpoint. Fields are native-endian — a
+ * checkpoint/streaming format for the machine family that wrote it, not interchange.
+ */
+
+#include "universe.h"
+
+#include <iosfwd>
+#include <vector>
+
+namespace osp::universe
+{
+
+/**
+ * @brief Satellite positions at the last checkpoint, diffed against by write_universe_delta
+ *
+ * Indexed by CoSpaceId. Rebase from a universe whenever a full snapshot is written, so deltas
+ * chain off that snapshot.
+ */
+struct UniverseDeltaBaseline
+{
+    std::vector< std::vector<Vector3g> > positions;
+};
+
+/**
+ * @brief Write all coordinate spaces and their satellite data as a full binary snapshot
+ *
+ * Satellite buffers are written zero-copy from m_data (only the committed prefix for
+ * reservation-backed spaces, see cospace_data_reserve).
+ */
+void write_universe_snapshot(std::ostream &rStream, Universe const &universe);
+
+/**
+ * @brief Load a snapshot written by write_universe_snapshot into an empty Universe
+ *
+ * SatSpatialIndex binnings are not captured; rebuild them after loading. Returns false on bad
+ * magic, version mismatch, or truncation.
+ */
+bool read_universe_snapshot(std::istream &rStream, Universe &rUniverse);
+
+/**
+ * @brief Reset the baseline to the universe's current satellite positions
+ */
+void universe_delta_rebase(Universe const &universe, UniverseDeltaBaseline &rBaseline);
+
+/**
+ * @brief Write a delta record of satellites that moved at least threshold space units since
+ *        the baseline, then fold them into the baseline
+ *
+ * Satellites not yet in the baseline (newly added) are always included. Checkpointing cost
+ * scales with how many satellites actually moved, not with universe size.
+ */
+void write_universe_delta(
+        std::ostream &rStream, Universe const &universe,
+        UniverseDeltaBaseline &rBaseline, spaceint_t threshold);
+
+/**
+ * @brief Apply a delta record to a universe previously restored from the matching snapshot
+ *        and earlier deltas. Returns false on malformed input or out-of-range satellites.
+ */
+bool read_universe_delta(std::istream &rStream, Universe &rUniverse);
+
+} // namespace osp::universe
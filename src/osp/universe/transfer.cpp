@@ -0,0 +1,162 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "transfer.h"
+#include "rotation.h"
+
+#include <longeron/utility/asserts.hpp>
+
+namespace osp::universe
+{
+
+std::uint32_t coord_reparent_satellites(
+        CoSpaceCommon               &rSrc,
+        CoSpaceCommon               &rDst,
+        CoordTransformer      const &srcToDst,
+        std::uint32_t         const first,
+        std::uint32_t         const count)
+{
+    LGRN_ASSERTMV(first + count <= rSrc.m_satCount,
+                  "Span out of range", first, count, rSrc.m_satCount);
+    LGRN_ASSERTMV(rDst.m_satCount + count <= rDst.m_satCapacity,
+                  "Destination space is full", count, rDst.m_satCount, rDst.m_satCapacity);
+
+    std::uint32_t const dstFirst = rDst.m_satCount;
+
+    auto const [sx, sy, sz]         = sat_views(rSrc.m_satPositions,  rSrc.m_data, rSrc.m_satCount);
+    auto const [svx, svy, svz]      = sat_views(rSrc.m_satVelocities, rSrc.m_data, rSrc.m_satCount);
+
+    // View the destination's full capacity; the transferred span sits past its m_satCount
+    auto const [dx, dy, dz]         = sat_views(rDst.m_satPositions,  rDst.m_data, rDst.m_satCapacity);
+    auto const [dvx, dvy, dvz]      = sat_views(rDst.m_satVelocities, rDst.m_data, rDst.m_satCapacity);
+
+    std::size_t const srcEnd = first + count;
+    std::size_t const dstEnd = dstFirst + count;
+
+    // Positions through the hoisted SoA batch kernel
+    srcToDst.transform_positions(
+            sx.slice(first, srcEnd),    sy.slice(first, srcEnd),    sz.slice(first, srcEnd),
+            dx.slice(dstFirst, dstEnd), dy.slice(dstFirst, dstEnd), dz.slice(dstFirst, dstEnd));
+
+    Quaterniond const rot = srcToDst.rotation();
+
+    if (quat_non_zero(rot))
+    {
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            Vector3d const vel = rot.transformVector({svx[first+i], svy[first+i], svz[first+i]});
+            dvx[dstFirst+i] = vel.x();
+            dvy[dstFirst+i] = vel.y();
+            dvz[dstFirst+i] = vel.z();
+        }
+    }
+    else
+    {
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            dvx[dstFirst+i] = svx[first+i];
+            dvy[dstFirst+i] = svy[first+i];
+            dvz[dstFirst+i] = svz[first+i];
+        }
+    }
+
+    LGRN_ASSERTM(rSrc.m_satRotationsPacked.not_used() == rDst.m_satRotationsPacked.not_used(),
+                 "Source and destination must use the same rotation layout");
+
+    if ( ! rSrc.m_satRotationsPacked.not_used())
+    {
+        auto const sq = rSrc.m_satRotationsPacked.view(
+                Corrade::Containers::arrayView(rSrc.m_data), rSrc.m_satCount);
+        auto const dq = rDst.m_satRotationsPacked.view(
+                Corrade::Containers::arrayView(rDst.m_data), rDst.m_satCapacity);
+
+        if (quat_non_zero(rot))
+        {
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                dq[dstFirst+i] = rotation_pack(rot * rotation_unpack(sq[first+i]));
+            }
+        }
+        else
+        {
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                dq[dstFirst+i] = sq[first+i];
+            }
+        }
+
+        for (std::size_t i = first; i < rSrc.m_satCount - count; ++i)
+        {
+            sq[i] = sq[i+count];
+        }
+    }
+    else
+    {
+        auto const [sqx, sqy, sqz, sqw] = sat_views(rSrc.m_satRotations, rSrc.m_data, rSrc.m_satCount);
+        auto const [dqx, dqy, dqz, dqw] = sat_views(rDst.m_satRotations, rDst.m_data, rDst.m_satCapacity);
+
+        if (quat_non_zero(rot))
+        {
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                Quaterniond const satRot
+                        = rot * Quaterniond{{sqx[first+i], sqy[first+i], sqz[first+i]}, sqw[first+i]};
+                dqx[dstFirst+i] = satRot.vector().x();
+                dqy[dstFirst+i] = satRot.vector().y();
+                dqz[dstFirst+i] = satRot.vector().z();
+                dqw[dstFirst+i] = satRot.scalar();
+            }
+        }
+        else
+        {
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                dqx[dstFirst+i] = sqx[first+i];
+                dqy[dstFirst+i] = sqy[first+i];
+                dqz[dstFirst+i] = sqz[first+i];
+                dqw[dstFirst+i] = sqw[first+i];
+            }
+        }
+
+        for (std::size_t i = first; i < rSrc.m_satCount - count; ++i)
+        {
+            sqx[i] = sqx[i+count];  sqy[i] = sqy[i+count];  sqz[i] = sqz[i+count];
+            sqw[i] = sqw[i+count];
+        }
+    }
+
+    // Close the source gap, preserving the order of satellites after the span
+    for (std::size_t i = first; i < rSrc.m_satCount - count; ++i)
+    {
+        sx[i]  = sx[i+count];   sy[i]  = sy[i+count];   sz[i]  = sz[i+count];
+        svx[i] = svx[i+count];  svy[i] = svy[i+count];  svz[i] = svz[i+count];
+    }
+
+    rSrc.m_satCount -= count;
+    rDst.m_satCount += count;
+
+    return dstFirst;
+}
+
+} // namespace osp::universe
@@ -0,0 +1,63 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Bulk transfer of satellites between coordinate spaces
+ */
+
+#include "coordinates.h"
+#include "universe.h"
+
+namespace osp::universe
+{
+
+/**
+ * @brief Move a contiguous span of satellites from one coordinate space to another in bulk
+ *
+ * srcToDst is computed once by the caller (coord_parent_to_child, coord_child_to_parent, or a
+ * coord_composite of them) and applied across the whole span with CoordTransformer's SoA batch
+ * kernel; velocities and satellite rotations are rotated by the transform's combined rotation.
+ * This keeps mass events like a stage separation debris cloud a few array passes instead of a
+ * per-satellite CoordTransformer construction each.
+ *
+ * Transferred satellites are appended to rDst, which must have capacity for them. The source
+ * range is closed by shifting the satellites after it down by count, preserving their order, so
+ * source SatIds above the range shift down by count.
+ *
+ * SatSpatialIndex bins satellites by index and is NOT fixed up here; clear both spaces'
+ * index binnings and rebuild after transferring.
+ *
+ * @return Index of the first transferred satellite within rDst
+ */
+std::uint32_t coord_reparent_satellites(
+        CoSpaceCommon               &rSrc,
+        CoSpaceCommon               &rDst,
+        CoordTransformer      const &srcToDst,
+        std::uint32_t               first,
+        std::uint32_t               count);
+
+} // namespace osp::universe
@@ -0,0 +1,88 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "universe.h"
+
+#include "../core/virtual_memory.h"
+
+#include <longeron/utility/asserts.hpp>
+
+namespace osp::universe
+{
+
+static std::size_t round_up_to_page(std::size_t const bytes) noexcept
+{
+    std::size_t const page = virtual_page_size();
+    return ((bytes + page - 1) / page) * page;
+}
+
+static void release_reservation(unsigned char* const data, std::size_t const size)
+{
+    virtual_release(data, size);
+}
+
+void cospace_data_reserve(
+        CoSpaceSatData &rSatData, std::size_t const commitBytes, std::size_t const reserveBytes)
+{
+    LGRN_ASSERTM(rSatData.m_dataCommitted == 0 && rSatData.m_data.isEmpty(),
+                 "CoSpace data is already allocated");
+    LGRN_ASSERTMV(commitBytes <= reserveBytes, "Commit exceeds reservation", commitBytes, reserveBytes);
+
+    std::size_t const reserve = round_up_to_page(reserveBytes);
+    std::size_t const commit  = round_up_to_page(commitBytes);
+
+    auto* const data = static_cast<unsigned char*>(virtual_reserve(reserve));
+    LGRN_ASSERTMV(data != nullptr, "Failed to reserve address space", reserve);
+
+    [[maybe_unused]] bool const committed = virtual_commit(data, commit);
+    LGRN_ASSERTMV(committed, "Failed to commit pages", commit);
+
+    // The Array spans the whole reservation, so growth never touches it and outstanding views
+    // stay valid; the deleter size is therefore the full reserved size virtual_release needs
+    rSatData.m_data = Corrade::Containers::Array<unsigned char>{
+            data, reserve, &release_reservation};
+    rSatData.m_dataCommitted = commit;
+}
+
+void cospace_data_commit(CoSpaceSatData &rSatData, std::size_t const commitBytes)
+{
+    LGRN_ASSERTM(rSatData.m_dataCommitted != 0,
+                 "CoSpace data is not a virtual reservation; see cospace_data_reserve");
+
+    std::size_t const commit = round_up_to_page(commitBytes);
+    if (commit <= rSatData.m_dataCommitted)
+    {
+        return;
+    }
+
+    LGRN_ASSERTMV(commit <= rSatData.m_data.size(),
+                  "Reservation exhausted", commit, rSatData.m_data.size());
+
+    [[maybe_unused]] bool const committed = virtual_commit(rSatData.m_data.data(), commit);
+    LGRN_ASSERTMV(committed, "Failed to commit pages", commit);
+
+    rSatData.m_dataCommitted = commit;
+}
+
+} // namespace osp::universe
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "../core/math_types.h"
+#include "satindex.h"
 #include "universetypes.h"
 
 #include <longeron/id_management/registry_stl.hpp>
@@ -98,11 +99,45 @@ struct CoSpaceSatData
     StrideDescArray_t<spaceint_t, 3>            m_satPositions;
     StrideDescArray_t<double, 3>                m_satVelocities;
     StrideDescArray_t<double, 4>                m_satRotations;
+
+    /// Optional compressed alternative to m_satRotations: one smallest-three quantized word per
+    /// satellite (see rotation.h). A cospace partitions exactly one of the two rotation layouts;
+    /// this one is in use when not not_used(). Tolerates microradian error, at a quarter of the
+    /// rotation memory traffic
+    TypedStrideDesc<SatRotPacked>               m_satRotationsPacked;
+
+    /// Grid index over m_satPositions for proximity queries; keep updated as satellites move
+    SatSpatialIndex                             m_satIndex;
+
+    /// Bytes of m_data backed by committed pages when m_data wraps a reserved virtual range
+    /// (see cospace_data_reserve); 0 when m_data is a plain allocation
+    std::size_t                                 m_dataCommitted{0};
 };
 
 
 struct CoSpaceCommon : CoSpaceTransform, CoSpaceHierarchy, CoSpaceSatData { };
 
+/**
+ * @brief Back m_data with a large reserved virtual range instead of a plain allocation
+ *
+ * Address space is reserved up to reserveBytes but only commitBytes are backed by accessible
+ * pages. m_data spans the whole reservation from the start, so later growth through
+ * cospace_data_commit never reallocates, never copies, and never invalidates
+ * StridedArrayView1D views held by tasks; views must simply keep indexing within the committed
+ * region. Reserved-but-uncommitted pages fault loudly if touched.
+ *
+ * Sizes round up to virtual_page_size().
+ */
+void cospace_data_reserve(CoSpaceSatData &rSatData, std::size_t commitBytes, std::size_t reserveBytes);
+
+/**
+ * @brief Grow the committed region of a reservation made by cospace_data_reserve
+ *
+ * No-op if commitBytes is already committed. The caller then re-partitions or extends its
+ * stride descriptors and m_satCapacity for the new room.
+ */
+void cospace_data_commit(CoSpaceSatData &rSatData, std::size_t commitBytes);
+
 struct Universe
 {
     Universe() = default;
@@ -51,6 +51,9 @@ namespace osp::universe
 
 using spaceint_t = int64_t;
 
+// A rotation packed by smallest-three quantization; see universe/rotation.h
+using SatRotPacked = uint64_t;
+
 // 1024 space units = 1 meter
 // TODO: this should vary by trajectory, but for now it's global
 constexpr float gc_units_per_meter = 1024.0f;
@@ -29,6 +29,9 @@
 
 #include <Magnum/Math/Functions.h>
 
+#include <algorithm>
+#include <utility>
+
 namespace osp::input
 {
 
@@ -37,8 +40,8 @@ UserInputHandler::UserInputHandler(std::size_t deviceCount)
 { }
 
 bool UserInputHandler::eval_button_expression(
-        ControlExpr_t const& expression,
-        ControlExpr_t* pReleaseExpr)
+        ArrayView<ControlTerm const> const expression,
+        ControlExpr_t* pReleaseExpr) const
 {
 
     bool totalOn = false;
@@ -51,7 +54,6 @@ bool UserInputHandler::eval_button_expression(
     for (auto it =  expression.begin(); it != expression.end(); it ++)
     {
         ControlTerm const& var = *it;
-        ButtonRaw const& btnRaw = var.m_button->second;
 
         bool varOn;
 
@@ -61,11 +63,11 @@ bool UserInputHandler::eval_button_expression(
         case EVarTrigger::Pressed:
             if (var.m_invert)
             {
-                varOn = btnRaw.m_justReleased;
+                varOn = m_stateJustReleased.test(var.m_bit);
             }
             else
             {
-                varOn = btnRaw.m_justPressed;
+                varOn = m_stateJustPressed.test(var.m_bit);
             }
 
             break;
@@ -76,7 +78,7 @@ bool UserInputHandler::eval_button_expression(
             // 0 != 0 = 0
             // 1 != 0 = 1
 
-            varOn = (btnRaw.m_pressed != var.m_invert);
+            varOn = (m_statePressed.test(var.m_bit) != var.m_invert);
             break;
         }
 
@@ -117,7 +119,7 @@ bool UserInputHandler::eval_button_expression(
                         continue;
                     }
                     pReleaseExpr->emplace_back(
-                            ControlTerm{itB->m_button, EVarTrigger::Pressed,
+                            ControlTerm{itB->m_bit, EVarTrigger::Pressed,
                                         EVarOperator::Or, !(itB->m_invert)});
                 }
             }
@@ -180,12 +182,15 @@ EButtonControlIndex UserInputHandler::button_subscribe(std::string_view name)
 
         rControl.m_holdable = (cfgIt->second.m_holdable);
 
-        rControl.m_exprPress.reserve(varConfigs.size());
+        // Compile the expression into the shared flat program array
+        rControl.m_exprFirst = uint32_t(m_exprProgram.size());
+        rControl.m_exprCount = uint32_t(varConfigs.size());
+        m_exprProgram.reserve(m_exprProgram.size() + varConfigs.size());
 
         for (ControlTermConfig const &varCfg : varConfigs)
         {
             // Each loop, create a ButtonVar from the ButtonConfig and emplace
-            // it into control.m_vars
+            // it into the expression program
 
             // Map of buttons for the specified device
             ButtonMap_t &btnMap = m_deviceToButtonRaw[varCfg.m_device];
@@ -199,9 +204,14 @@ EButtonControlIndex UserInputHandler::button_subscribe(std::string_view name)
             // one was chosen
             if (btnInsert.second)
             {
-                // new ButtonRaw created
-                //btnRaw.m_pressed = 0;
+                // new ButtonRaw created; assign it a packed state bit
+                btnRaw.m_bitIndex = m_bitNext ++;
                 btnRaw.m_referenceCount = 1;
+
+                bitvector_resize(m_statePressed,      m_bitNext);
+                bitvector_resize(m_stateJustPressed,  m_bitNext);
+                bitvector_resize(m_stateJustReleased, m_bitNext);
+                m_stateTimeUs.resize(m_bitNext);
             }
             else
             {
@@ -209,11 +219,7 @@ EButtonControlIndex UserInputHandler::button_subscribe(std::string_view name)
                 btnRaw.m_referenceCount ++;
             }
 
-            //uint8_t bits = (uint8_t(varCfg.m_trigger) << 0)
-            //             | (uint8_t(varCfg.m_invert) << 1)
-            //             | (uint8_t(varCfg.m_nextOp) << 2);
-
-            rControl.m_exprPress.emplace_back(varCfg.create(btnInsert.first));
+            m_exprProgram.emplace_back(varCfg.create(btnRaw.m_bitIndex));
         }
 
         // New control has been created, now return a pointer to it
@@ -236,20 +242,8 @@ void UserInputHandler::button_unsubscribe(EButtonControlIndex index)
 void UserInputHandler::clear_events()
 {
     // remove any just pressed / just released flags
-
-    for (ButtonMap_t::iterator btnIt : m_btnPressed)
-    {
-        btnIt->second.m_justPressed = false;
-    }
-
-    for (ButtonMap_t::iterator btnIt : m_btnReleased)
-    {
-        btnIt->second.m_justReleased = false;
-    }
-
-    // Clear the button pressed and released events
-    m_btnPressed.clear();
-    m_btnReleased.clear();
+    m_stateJustPressed .reset();
+    m_stateJustReleased.reset();
 
     // Clear mouse delta
     m_mouseMotion.m_rawDelta = Vector2i(0);
@@ -263,6 +257,23 @@ void UserInputHandler::clear_events()
 
 void UserInputHandler::event_raw(DeviceId deviceId, int buttonEnum,
                                  EButtonEvent dir)
+{
+    // Queue unfiltered; the button maps are mutated by button_subscribe on the
+    // consumer side, so filtering unregistered buttons happens on drain
+    bool const pushed = m_eventRing.push(RawInputEvent{
+            .m_type       = RawInputEvent::EType::Button,
+            .m_dir        = dir,
+            .m_device     = deviceId,
+            .m_buttonEnum = buttonEnum,
+            .m_timeUs     = now_us() });
+    if ( ! pushed)
+    {
+        m_eventsDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void UserInputHandler::apply_button(DeviceId deviceId, int buttonEnum,
+                                    EButtonEvent dir, uint64_t const timeUs)
 {
     // Check if the button is being listened to
     ButtonMap_t::iterator btnIt = m_deviceToButtonRaw[deviceId].find(buttonEnum);
@@ -273,26 +284,68 @@ void UserInputHandler::event_raw(DeviceId deviceId, int buttonEnum,
     }
 
     OSP_LOG_TRACE("sensitive button pressed");
-        
-    ButtonRaw &btnRaw = btnIt->second;
+
+    uint16_t const bit = btnIt->second.m_bitIndex;
 
     switch (dir)
     {
     case EButtonEvent::Pressed:
-        btnRaw.m_pressed = true;
-        btnRaw.m_justPressed = true;
-        m_btnPressed.push_back(btnIt);
+        m_statePressed    .set(bit);
+        m_stateJustPressed.set(bit);
         break;
     case EButtonEvent::Released:
-        btnRaw.m_pressed = false;
-        btnRaw.m_justReleased = true;
-        m_btnReleased.push_back(btnIt);
+        m_statePressed     .reset(bit);
+        m_stateJustReleased.set(bit);
         break;
     }
+
+    m_stateTimeUs[bit] = timeUs;
+}
+
+uint64_t UserInputHandler::latest_edge_time(
+        ArrayView<ControlTerm const> const expression) const noexcept
+{
+    uint64_t latest = 0;
+    for (ControlTerm const& term : expression)
+    {
+        if (   m_stateJustPressed .test(term.m_bit)
+            || m_stateJustReleased.test(term.m_bit))
+        {
+            latest = std::max(latest, m_stateTimeUs[term.m_bit]);
+        }
+    }
+    return latest;
 }
 
 void UserInputHandler::update_controls()
 {
+    // Consume everything captured since the last update as one snapshot; the
+    // capture side may be another thread and is never blocked by this
+    m_eventRing.drain([this] (RawInputEvent const& event)
+    {
+        switch (event.m_type)
+        {
+        case RawInputEvent::EType::Button:
+            apply_button(event.m_device, event.m_buttonEnum, event.m_dir,
+                         event.m_timeUs);
+            break;
+        case RawInputEvent::EType::MouseDelta:
+            // Coalesce; high-rate mice deliver many motion events per frame,
+            // and clear_events zeros the total once per frame
+            m_mouseMotion.m_rawDelta += event.m_delta;
+            break;
+        case RawInputEvent::EType::ScrollDelta:
+            m_scrollOffset.offset += event.m_delta;
+            break;
+        }
+    });
+
+    if (uint32_t const dropped = m_eventsDropped.exchange(0); dropped != 0)
+    {
+        OSP_LOG_WARN("Input event ring overflowed, {} events dropped", dropped);
+    }
+
+    uint64_t const updateTimeUs = now_us();
 
     // Loop through controls and see which ones are triggered
 
@@ -312,13 +365,19 @@ void UserInputHandler::update_controls()
             pExprRelease = &(rControl.m_exprRelease);
         }
 
-        rControl.m_triggered = eval_button_expression(rControl.m_exprPress,
-                                                     pExprRelease);
+        auto const exprPress = arrayView(m_exprProgram).sliceSize(
+                rControl.m_exprFirst, rControl.m_exprCount);
+
+        rControl.m_triggered = eval_button_expression(exprPress, pExprRelease);
 
         if (rControl.m_triggered)
         {
-            m_btnControlEvents.emplace_back(index,
-                                            EButtonControlEvent::Triggered);
+            // The triggering edge's capture time; hold-only expressions have
+            // no fresh edge and get the update time instead
+            uint64_t const edgeTimeUs = latest_edge_time(exprPress);
+            m_btnControlEvents.emplace_back(
+                    index, EButtonControlEvent::Triggered,
+                    (edgeTimeUs != 0) ? edgeTimeUs : updateTimeUs);
         }
 
         if (!rControl.m_holdable)
@@ -329,14 +388,18 @@ void UserInputHandler::update_controls()
         if (rControl.m_held)
         {
             // if currently held, evaluate the release expression
-            rControl.m_held = !eval_button_expression(rControl.m_exprRelease);
+            rControl.m_held = !eval_button_expression(
+                    arrayView(std::as_const(rControl.m_exprRelease)));
 
             // if just released
             if (!rControl.m_held)
             {
+                uint64_t const edgeTimeUs = latest_edge_time(
+                        arrayView(std::as_const(rControl.m_exprRelease)));
                 rControl.m_exprRelease.clear();
-                m_btnControlEvents.emplace_back(index,
-                                                EButtonControlEvent::Released);
+                m_btnControlEvents.emplace_back(
+                        index, EButtonControlEvent::Released,
+                        (edgeTimeUs != 0) ? edgeTimeUs : updateTimeUs);
                 OSP_LOG_TRACE("RELEASE");
             }
         }
@@ -364,12 +427,26 @@ void UserInputHandler::update_controls()
 
 void UserInputHandler::mouse_delta(Vector2i delta)
 {
-    m_mouseMotion.m_rawDelta = delta;
+    bool const pushed = m_eventRing.push(RawInputEvent{
+            .m_type   = RawInputEvent::EType::MouseDelta,
+            .m_delta  = delta,
+            .m_timeUs = now_us() });
+    if ( ! pushed)
+    {
+        m_eventsDropped.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 void UserInputHandler::scroll_delta(Vector2i offset)
 {
-    m_scrollOffset.offset = offset;
+    bool const pushed = m_eventRing.push(RawInputEvent{
+            .m_type   = RawInputEvent::EType::ScrollDelta,
+            .m_delta  = offset,
+            .m_timeUs = now_us() });
+    if ( ! pushed)
+    {
+        m_eventsDropped.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -25,9 +25,12 @@
 #pragma once
 
 #include "../core/array_view.h"
+#include "../core/bitvector.h"
 #include "../core/math_types.h"
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <limits>
 #include <optional>
@@ -50,13 +53,14 @@ enum class EButtonControlIndex : uint32_t
 //-----------------------------------------------------------------------------
 
 /**
- * @brief Raw button state mapped directly from a device enum
+ * @brief Raw button mapped directly from a device enum
+ *
+ * Pressed/just-pressed/just-released state lives in UserInputHandler's packed
+ * state bitsets, indexed by m_bitIndex
  */
 struct ButtonRaw
 {
-    bool m_pressed;
-    bool m_justPressed;
-    bool m_justReleased;
+    uint16_t m_bitIndex;
     uint8_t m_referenceCount;
 };
 
@@ -97,10 +101,13 @@ enum class EVarOperator : uint8_t { Or = 0, And = 1 };
 
 /**
  * @brief An invidual term in a boolean expression representing a (raw button)
+ *
+ * Compiled form: m_bit indexes the packed button-state bitsets instead of
+ * pointing into per-device button maps
  */
 struct ControlTerm
 {
-    ButtonMap_t::iterator m_button;
+    uint16_t m_bit;
     EVarTrigger m_trigger;
     EVarOperator m_nextOp;
     bool m_invert;
@@ -112,9 +119,9 @@ struct ControlTerm
 struct ControlTermConfig
 {
 
-    ControlTerm create(ButtonMap_t::iterator button) const
+    ControlTerm create(uint16_t bit) const
     {
-        return ControlTerm{button, m_trigger, m_nextOp, m_invert};
+        return ControlTerm{bit, m_trigger, m_nextOp, m_invert};
     }
 
     int m_device;
@@ -151,7 +158,11 @@ struct ButtonControl
     bool m_holdable{false};
     bool m_triggered{false};
 
-    ControlExpr_t m_exprPress{};
+    /// Slice of UserInputHandler's compiled expression array; controls are
+    /// never removed, so slices stay valid as the array grows
+    uint32_t m_exprFirst{0};
+    uint32_t m_exprCount{0};
+
     ControlExpr_t m_exprRelease{};
 };
 
@@ -171,18 +182,96 @@ struct ButtonControlEvent
 // parenthesis isn't supported by the compiler.
 #if ! defined( __cpp_aggregate_paren_init )
     constexpr ButtonControlEvent(EButtonControlIndex index,
-                                 EButtonControlEvent event) noexcept
+                                 EButtonControlEvent event,
+                                 uint64_t timeUs) noexcept
      : m_index(index)
      , m_event(event)
+     , m_timeUs(timeUs)
     { }
 #endif // ! defined( __cpp_aggregate_paren_init )
 
     EButtonControlIndex m_index;
     EButtonControlEvent m_event;
+
+    /// Capture time of the raw button edge that fired this control,
+    /// microseconds since the input handler was created. Finer than frame
+    /// granularity; events coalesced into one update keep distinct times.
+    uint64_t m_timeUs;
 };
 
 //-----------------------------------------------------------------------------
 
+/**
+ * @brief A timestamped device event as captured, before any button mapping
+ */
+struct RawInputEvent
+{
+    enum class EType : uint8_t { Button, MouseDelta, ScrollDelta };
+
+    EType           m_type;
+    EButtonEvent    m_dir;          ///< Button only
+    uint32_t        m_device;       ///< Button only
+    int             m_buttonEnum;   ///< Button only
+    Vector2i        m_delta;        ///< MouseDelta / ScrollDelta
+    uint64_t        m_timeUs;       ///< Capture time, microseconds since handler creation
+};
+
+/**
+ * @brief Fixed-capacity lock-free single-producer single-consumer event ring
+ *
+ * The capture side (application event loop, or a dedicated poll thread) pushes
+ * without ever blocking; the sim side drains everything pending as one
+ * coherent batch per update. Only one thread may push and only one may drain.
+ */
+class InputEventRing
+{
+public:
+
+    static constexpr std::size_t smc_capacity = 1024; // must be a power of two
+
+    /**
+     * @brief Push an event from the producer thread
+     *
+     * @return false if the ring is full and the event was dropped
+     */
+    bool push(RawInputEvent const& event) noexcept
+    {
+        std::size_t const head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == smc_capacity)
+        {
+            return false; // consumer stalled; dropping beats blocking capture
+        }
+        m_events[head % smc_capacity] = event;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Call func on each pending event in capture order, from the consumer thread
+     */
+    template <typename FUNC_T>
+    void drain(FUNC_T&& func) noexcept
+    {
+        std::size_t       tail = m_tail.load(std::memory_order_relaxed);
+        std::size_t const head = m_head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail)
+        {
+            func(m_events[tail % smc_capacity]);
+        }
+        m_tail.store(tail, std::memory_order_release);
+    }
+
+private:
+
+    std::array<RawInputEvent, smc_capacity> m_events;
+
+    std::atomic<std::size_t> m_head{0}; ///< Next write slot, owned by producer
+    std::atomic<std::size_t> m_tail{0}; ///< Next read slot, owned by consumer
+
+}; // class InputEventRing
+
+//-----------------------------------------------------------------------------
+
 /**
  * Roughly based on HotkeyHandler.as from urho-osp (but more sane),
  * UserInputHandler is intended to unite buttons and axis across all input
@@ -255,6 +344,9 @@ public:
     /**
      * Iterate through the vars of a Button Expression to evaluate it.
      *
+     * Terms read the packed button-state bitsets, so evaluation is a single
+     * linear sweep with no pointer chasing into device button maps.
+     *
      * If a Release Expression is provided (non-nullptr), then individual terms
      * that evaluated
      *
@@ -262,9 +354,9 @@ public:
      * @param pReleaseExpr [out] optional Release Expression to generate
      * @return result of expression
      */
-    static bool eval_button_expression(
-            ControlExpr_t const& expression,
-            ControlExpr_t* pReleaseExpr = nullptr);
+    bool eval_button_expression(
+            ArrayView<ControlTerm const> expression,
+            ControlExpr_t* pReleaseExpr = nullptr) const;
 
     /**
      * Register a new control into the config.
@@ -304,6 +396,9 @@ public:
     void clear_events();
 
     /**
+     * Capture a raw button event. Timestamps it and queues it on the event
+     * ring without blocking; safe to call from a thread other than the one
+     * running update_controls.
      *
      * @param deviceId
      * @param buttonEnum
@@ -312,24 +407,41 @@ public:
     void event_raw(DeviceId deviceId, int buttonEnum, EButtonEvent dir);
 
     /**
-     *
+     * Drain everything captured since the last update as one coherent
+     * snapshot, then evaluate which controls are triggered
      */
     void update_controls();
 
     /*
-     * Update this frame's mouse motion (position delta)
-     * @param delta Change in mouse position this frame
+     * Capture mouse motion (position delta). Queued like event_raw; deltas
+     * from high-rate mice are coalesced into the frame total on drain
+     * @param delta Change in mouse position
     */
     void mouse_delta(Vector2i delta);
 
     /*
-     * Update this frame's scroll offset
-     * @param delta Change in mouse position this frame
+     * Capture a scroll offset. Queued like event_raw
+     * @param delta Change in scroll position
     */
     void scroll_delta(Vector2i offset);
 
 private:
 
+    /// Apply a drained button event to the packed state bitsets
+    void apply_button(DeviceId deviceId, int buttonEnum, EButtonEvent dir,
+                      uint64_t timeUs);
+
+    /// Microseconds since this handler was created
+    uint64_t now_us() const noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - m_timeOrigin).count();
+    }
+
+    /// Newest capture time among an expression's just-pressed/released
+    /// buttons; 0 if the expression has no fresh edge this update
+    uint64_t latest_edge_time(ArrayView<ControlTerm const> expression) const noexcept;
+
     std::vector<ButtonMap_t> m_deviceToButtonRaw;
     std::map<std::string, ButtonControlConfig, std::less<> > m_btnControlCfg;
 
@@ -337,8 +449,21 @@ private:
     MouseMotion m_mouseMotion;
     ScrollRaw m_scrollOffset;
 
-    std::vector<ButtonMap_t::iterator> m_btnPressed;
-    std::vector<ButtonMap_t::iterator> m_btnReleased;
+    // Written by the capture thread, drained by update_controls
+    InputEventRing m_eventRing;
+    std::atomic<uint32_t> m_eventsDropped{0};
+    std::chrono::steady_clock::time_point m_timeOrigin{std::chrono::steady_clock::now()};
+
+    // Packed per-button state, indexed by ButtonRaw::m_bitIndex
+    BitVector_t m_statePressed;
+    BitVector_t m_stateJustPressed;
+    BitVector_t m_stateJustReleased;
+    std::vector<uint64_t> m_stateTimeUs; ///< Capture time of each button's last edge
+    uint16_t m_bitNext{0};
+
+    // Every control's press expression compiled end to end; each
+    // ButtonControl owns a slice
+    std::vector<ControlTerm> m_exprProgram;
 
     // Currently active controls being listened to
     std::vector<ButtonControl> m_btnControls;
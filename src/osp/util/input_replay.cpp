@@ -0,0 +1,213 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "input_replay.h"
+
+#include "logging.h"
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace osp::input
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> sc_replayMagic{'O', 'S', 'P', 'R', 'E', 'C', '\0', '\1'};
+
+// Log is a flat stream of tagged records; FrameEnd carries the frame's timestep and
+// delimits frames
+enum class ERecord : std::uint8_t
+{
+    Button      = 0,    ///< u32 device, i32 button enum, u8 EButtonEvent
+    MouseDelta  = 1,    ///< i32 x, i32 y
+    ScrollDelta = 2,    ///< i32 x, i32 y
+    FrameEnd    = 3     ///< f32 timestep
+};
+
+} // namespace
+
+void InputRecorder::start()
+{
+    m_writer.out.clear();
+    m_writer.out.insert(m_writer.out.end(), sc_replayMagic.begin(), sc_replayMagic.end());
+    m_recording = true;
+}
+
+void InputRecorder::record_button(
+        UserInputHandler::DeviceId const deviceId, int const buttonEnum, EButtonEvent const dir)
+{
+    m_writer.write(ERecord::Button);
+    m_writer.write(std::uint32_t(deviceId));
+    m_writer.write(std::int32_t(buttonEnum));
+    m_writer.write(dir);
+}
+
+void InputRecorder::record_mouse_delta(Vector2i const delta)
+{
+    m_writer.write(ERecord::MouseDelta);
+    m_writer.write(std::int32_t(delta.x()));
+    m_writer.write(std::int32_t(delta.y()));
+}
+
+void InputRecorder::record_scroll_delta(Vector2i const offset)
+{
+    m_writer.write(ERecord::ScrollDelta);
+    m_writer.write(std::int32_t(offset.x()));
+    m_writer.write(std::int32_t(offset.y()));
+}
+
+void InputRecorder::end_frame(float const delta)
+{
+    m_writer.write(ERecord::FrameEnd);
+    m_writer.write(delta);
+}
+
+bool InputRecorder::save(std::string_view const filepath)
+{
+    m_recording = false;
+
+    std::string const path{filepath};
+
+    bool writable;
+    {
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        writable = file.is_open();
+        if (writable)
+        {
+            file.write(reinterpret_cast<char const*>(m_writer.out.data()),
+                       std::streamsize(m_writer.out.size()));
+            writable = file.good();
+        }
+    }
+
+    if ( ! writable)
+    {
+        OSP_LOG_WARN("Could not write input recording {}", filepath);
+        std::remove(path.c_str()); // Never leave a partial file behind
+    }
+
+    m_writer.out.clear();
+    return writable;
+}
+
+bool InputReplayer::load(std::string_view const filepath)
+{
+    if ( ! m_file.open(filepath))
+    {
+        OSP_LOG_WARN("Could not open input recording {}", filepath);
+        return false;
+    }
+
+    auto const view = m_file.data();
+    if (   view.size() < sc_replayMagic.size()
+        || std::memcmp(view.data(), sc_replayMagic.data(), sc_replayMagic.size()) != 0)
+    {
+        OSP_LOG_WARN("Input recording {} has wrong magic or version", filepath);
+        return false;
+    }
+
+    m_reader  = PackReader{ .data = view, .pos = sc_replayMagic.size() };
+    m_playing = true;
+    return true;
+}
+
+float InputReplayer::play_frame(UserInputHandler &rInput, float const fallbackDelta)
+{
+    if ( ! m_playing)
+    {
+        return fallbackDelta;
+    }
+
+    while (m_reader.pos < m_reader.data.size())
+    {
+        switch (m_reader.read<ERecord>())
+        {
+        case ERecord::Button:
+        {
+            auto const deviceId   = m_reader.read<std::uint32_t>();
+            auto const buttonEnum = m_reader.read<std::int32_t>();
+            auto const dir        = m_reader.read<EButtonEvent>();
+            if (m_reader.fail)
+            {
+                break;
+            }
+            rInput.event_raw(deviceId, buttonEnum, dir);
+            continue;
+        }
+        case ERecord::MouseDelta:
+        {
+            auto const x = m_reader.read<std::int32_t>();
+            auto const y = m_reader.read<std::int32_t>();
+            if (m_reader.fail)
+            {
+                break;
+            }
+            rInput.mouse_delta(Vector2i{x, y});
+            continue;
+        }
+        case ERecord::ScrollDelta:
+        {
+            auto const x = m_reader.read<std::int32_t>();
+            auto const y = m_reader.read<std::int32_t>();
+            if (m_reader.fail)
+            {
+                break;
+            }
+            rInput.scroll_delta(Vector2i{x, y});
+            continue;
+        }
+        case ERecord::FrameEnd:
+        {
+            float const delta = m_reader.read<float>();
+            if (m_reader.fail)
+            {
+                break;
+            }
+            return delta;
+        }
+        default:
+            m_reader.fail = true;
+            break;
+        }
+        break; // Truncated or unknown record
+    }
+
+    m_playing = false;
+    if (m_reader.fail)
+    {
+        OSP_LOG_WARN("Input recording is truncated or corrupt; resuming live input");
+    }
+    else
+    {
+        OSP_LOG_INFO("Input replay finished; resuming live input");
+    }
+    return fallbackDelta;
+}
+
+} // namespace osp::input
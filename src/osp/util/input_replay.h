@@ -0,0 +1,109 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Record and replay of raw user input and frame timesteps
+ *
+ * A recording captures every raw device event fed into UserInputHandler plus each frame's
+ * timestep, so a replay re-presents the exact same per-frame input and delta sequence. With
+ * the single-threaded executor, task order is a pure function of the task graph, and physics
+ * steps at a fixed rate — inputs and timesteps are the only run-to-run variance — so a replay
+ * re-executes the recorded scenario deterministically. Capture a hitch once, then profile the
+ * identical workload repeatedly.
+ */
+
+#include "UserInputHandler.h"
+
+#include "../vehicles/pack_io.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace osp::input
+{
+
+/**
+ * @brief Accumulates raw input events and frame timesteps into an in-memory log
+ *
+ * Forward every event also given to UserInputHandler, then call end_frame once per frame
+ * with its timestep. save() writes the log out and stops recording.
+ */
+class InputRecorder
+{
+public:
+
+    [[nodiscard]] bool recording() const noexcept { return m_recording; }
+
+    void start();
+
+    void record_button(UserInputHandler::DeviceId deviceId, int buttonEnum, EButtonEvent dir);
+    void record_mouse_delta(Vector2i delta);
+    void record_scroll_delta(Vector2i offset);
+    void end_frame(float delta);
+
+    /**
+     * @return false if the file couldn't be written; no partial file is left behind
+     */
+    bool save(std::string_view filepath);
+
+private:
+
+    PackWriter  m_writer;
+    bool        m_recording{false};
+};
+
+/**
+ * @brief Plays a recorded input log back into a UserInputHandler, one frame per call
+ */
+class InputReplayer
+{
+public:
+
+    /**
+     * @return false on missing file, bad magic, or version mismatch
+     */
+    bool load(std::string_view filepath);
+
+    [[nodiscard]] bool playing() const noexcept { return m_playing; }
+
+    /**
+     * @brief Feed one frame's recorded events into rInput
+     *
+     * Live device input must be suppressed while playing, or the replay diverges.
+     *
+     * @return The recorded frame timestep, or fallbackDelta once the log is exhausted
+     */
+    float play_frame(UserInputHandler &rInput, float fallbackDelta);
+
+private:
+
+    PackFileView    m_file;
+    PackReader      m_reader;
+    bool            m_playing{false};
+};
+
+} // namespace osp::input
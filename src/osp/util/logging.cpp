@@ -0,0 +1,57 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "logging.h"
+
+#include <spdlog/async.h>
+
+#include <utility>
+
+namespace osp
+{
+
+void init_async_logging(std::size_t const queueSize)
+{
+    // One backend thread is plenty; it only formats and writes to sinks
+    spdlog::init_thread_pool(queueSize, 1);
+}
+
+Logger_t make_async_logger(std::string name, spdlog::sink_ptr sink)
+{
+    std::shared_ptr<spdlog::details::thread_pool> const pPool = spdlog::thread_pool();
+
+    if (pPool == nullptr)
+    {
+        // init_async_logging not called; stay synchronous
+        return std::make_shared<spdlog::logger>(std::move(name), std::move(sink));
+    }
+
+    // overrun_oldest: a full ring drops the oldest queued message instead of blocking
+    // the logging thread, so bursty logging can't distort frame timing
+    return std::make_shared<spdlog::async_logger>(
+            std::move(name), std::move(sink), pPool,
+            spdlog::async_overflow_policy::overrun_oldest);
+}
+
+} // namespace osp
@@ -27,22 +27,60 @@
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
 #include <spdlog/spdlog.h>
 
+#include <string>
+
 namespace osp
 {
 using Logger_t = std::shared_ptr<spdlog::logger>;
 
-inline thread_local Logger_t t_logger; // Unique logger per thread
+inline thread_local Logger_t t_logger; // Owns this thread's logger
+
+// Raw pointer the OSP_LOG_* macros go through; no refcount traffic per log statement
+inline thread_local spdlog::logger *t_pLogger { nullptr };
 
 inline void set_thread_logger(Logger_t logger)
 {
-    t_logger = std::move(logger);
+    t_logger  = std::move(logger);
+    t_pLogger = t_logger.get();
 }
 
+/**
+ * @brief Point this thread's log macros at a logger owned elsewhere
+ *
+ * Takes no refcount; the caller guarantees the logger outlives this thread's use of it.
+ * Executor worker threads borrow the spawning thread's logger this way, which stays
+ * alive until they are joined.
+ */
+inline void set_thread_logger_ref(spdlog::logger *pLogger) noexcept
+{
+    t_logger.reset();
+    t_pLogger = pLogger;
+}
+
+/**
+ * @brief Start the background logging thread; call once before make_async_logger
+ *
+ * Loggers made afterwards enqueue messages into a bounded ring buffer drained by the
+ * background thread, so a log statement inside a task never blocks on sink locking or
+ * I/O. When the ring is full the oldest queued message is dropped rather than stalling
+ * the frame.
+ *
+ * @param queueSize [in] Ring buffer capacity, in messages
+ */
+void init_async_logging(std::size_t queueSize = 8192);
+
+/**
+ * @brief Create a logger that logs through the background thread
+ *
+ * Falls back to a synchronous logger if init_async_logging was never called.
+ */
+[[nodiscard]] Logger_t make_async_logger(std::string name, spdlog::sink_ptr sink);
+
 } // namespace osp
 
-#define OSP_LOG_TRACE(...) SPDLOG_LOGGER_TRACE(osp::t_logger, __VA_ARGS__)
-#define OSP_LOG_DEBUG(...) SPDLOG_LOGGER_DEBUG(osp::t_logger, __VA_ARGS__)
-#define OSP_LOG_INFO(...) SPDLOG_LOGGER_INFO(osp::t_logger, __VA_ARGS__)
-#define OSP_LOG_WARN(...) SPDLOG_LOGGER_TRACE(osp::t_logger, __VA_ARGS__)
-#define OSP_LOG_ERROR(...) SPDLOG_LOGGER_ERROR(osp::t_logger, __VA_ARGS__)
-#define OSP_LOG_CRITICAL(...) SPDLOG_LOGGER_CRITICAL(osp::t_logger, __VA_ARGS__)
+#define OSP_LOG_TRACE(...) SPDLOG_LOGGER_TRACE(osp::t_pLogger, __VA_ARGS__)
+#define OSP_LOG_DEBUG(...) SPDLOG_LOGGER_DEBUG(osp::t_pLogger, __VA_ARGS__)
+#define OSP_LOG_INFO(...) SPDLOG_LOGGER_INFO(osp::t_pLogger, __VA_ARGS__)
+#define OSP_LOG_WARN(...) SPDLOG_LOGGER_TRACE(osp::t_pLogger, __VA_ARGS__)
+#define OSP_LOG_ERROR(...) SPDLOG_LOGGER_ERROR(osp::t_pLogger, __VA_ARGS__)
+#define OSP_LOG_CRITICAL(...) SPDLOG_LOGGER_CRITICAL(osp::t_pLogger, __VA_ARGS__)
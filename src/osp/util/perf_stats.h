@@ -0,0 +1,98 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2023 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace osp
+{
+
+/**
+ * @brief One frame of engine statistics sampled for the performance HUD
+ */
+struct PerfSample
+{
+    float           updateMs        {0.0f}; ///< CPU time of the frame's scene update iterations
+    float           renderMs        {0.0f}; ///< CPU time of the sync+render executor iteration
+    std::uint32_t   drawnEnts       {0};    ///< DrawEnts marked visible this frame
+    std::uint32_t   drawCalls       {0};    ///< Forward group singleton draws plus instanced buckets
+    std::uint32_t   queuedTasks     {0};    ///< Executor ready-queue depth at end of frame
+    std::uint32_t   blockedTasks    {0};    ///< Tasks waiting on pipeline stages at end of frame
+    std::uint64_t   memBytes        {0};    ///< Memory census total across all tags
+};
+
+/**
+ * @brief Single-writer mailbox holding the latest PerfSample
+ *
+ * Seqlock-style: the writer bumps the sequence odd, stores the sample, then bumps it even;
+ * a reader retries while the sequence is odd or changed during its copy. Both sides cost a
+ * few relaxed atomics and a small struct copy, so sampling never perturbs the frame being
+ * measured and a reader on another thread (eg: the CLI) never blocks the writer.
+ */
+class PerfStatsMailbox
+{
+public:
+
+    void publish(PerfSample const &sample) noexcept
+    {
+        std::uint32_t const seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_release);
+        m_sample = sample;
+        m_seq.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @return False when nothing has been published yet
+     */
+    [[nodiscard]] bool read(PerfSample &rOut) const noexcept
+    {
+        while (true)
+        {
+            std::uint32_t const seq = m_seq.load(std::memory_order_acquire);
+            if (seq % 2 != 0)
+            {
+                continue; // Write in progress
+            }
+            rOut = m_sample;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_seq.load(std::memory_order_relaxed) == seq)
+            {
+                return seq != 0;
+            }
+        }
+    }
+
+    /// Toggled from the CLI; the render thread skips all HUD work while false
+    std::atomic<bool> hudEnabled { false };
+
+private:
+
+    std::atomic<std::uint32_t>  m_seq { 0 };
+    PerfSample                  m_sample;
+
+}; // class PerfStatsMailbox
+
+} // namespace osp
@@ -0,0 +1,96 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ImporterData.h"
+
+#include "../core/Resources.h"
+
+namespace osp
+{
+
+PrefabIndex_t index_prefabs(Resources &rResources)
+{
+    using restypes::gc_importer;
+
+    PrefabIndex_t out;
+    for (unsigned int i = 0; i < rResources.ids(gc_importer).capacity(); ++i)
+    {
+        auto const resId = ResId(i);
+        if ( ! rResources.ids(gc_importer).exists(resId))
+        {
+            continue;
+        }
+
+        auto const *pPrefabData = rResources.data_try_get<Prefabs>(gc_importer, resId);
+        if (pPrefabData == nullptr)
+        {
+            continue; // No prefab data
+        }
+
+        for (PrefabId j = 0; j < pPrefabData->m_prefabNames.size(); ++j)
+        {
+            out.emplace(pPrefabData->m_prefabNames[j], std::pair{resId, j});
+        }
+    }
+    return out;
+}
+
+PrefabRecipes make_prefab_recipes(ImporterData const& importData, Prefabs const& prefabs)
+{
+    PrefabRecipes out;
+
+    auto const prefabCount = prefabs.m_prefabs.ids_count();
+    out.m_recipes.resize(prefabCount);
+
+    for (std::uint32_t pf = 0; pf < prefabCount; ++pf)
+    {
+        auto const objects  = lgrn::Span<int const>{prefabs.m_prefabs[PrefabId(pf)]};
+        auto const parents  = lgrn::Span<int const>{prefabs.m_prefabParents[PrefabId(pf)]};
+
+        PrefabRecipe &rRecipe = out.m_recipes[pf];
+
+        rRecipe.m_descendants   .reserve(objects.size());
+        rRecipe.m_parents       .reserve(objects.size());
+        rRecipe.m_transforms    .reserve(objects.size());
+        rRecipe.m_mass          .reserve(objects.size());
+        rRecipe.m_shape         .reserve(objects.size());
+
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            ObjId const obj = objects[i];
+
+            // Every descendant of a prefab's object is part of the prefab, so
+            // the importer-wide count is also the prefab-local subtree size
+            rRecipe.m_descendants   .push_back(std::uint32_t(importData.m_objDescendants[obj]));
+            rRecipe.m_parents       .push_back(parents[i]);
+            rRecipe.m_transforms    .push_back(importData.m_objTransforms[obj]);
+            rRecipe.m_mass          .push_back(prefabs.m_objMass[obj]);
+            rRecipe.m_shape         .push_back(prefabs.m_objShape[obj]);
+        }
+    }
+
+    return out;
+}
+
+} // namespace osp
@@ -36,9 +36,12 @@
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 
+#include <entt/container/dense_map.hpp>
+
 #include <longeron/containers/intarray_multimap.hpp>
 
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace osp
@@ -96,4 +99,39 @@ struct Prefabs
     std::vector<float>                      m_objMass;
 };
 
+/**
+ * @brief Flat instantiation recipe for one prefab
+ *
+ * Everything SysPrefabInit reads per spawned node, gathered out of ImporterData/Prefabs into
+ * contiguous arrays in the same depth-first order as Prefabs::m_prefabs. Spawning then runs
+ * straight down these arrays instead of re-walking the importer's node tree.
+ */
+struct PrefabRecipe
+{
+    std::vector<uint32_t>                   m_descendants;  ///< Subtree size below each node
+    std::vector<int32_t>                    m_parents;      ///< Index within prefab; -1 for root
+    std::vector<Matrix4>                    m_transforms;
+    std::vector<float>                      m_mass;
+    std::vector<EShape>                     m_shape;
+};
+
+struct PrefabRecipes
+{
+    std::vector<PrefabRecipe>               m_recipes;      ///< [PrefabId]
+};
+
+/**
+ * @brief Precompute per-prefab instantiation recipes; call once after Prefabs are assigned
+ */
+PrefabRecipes make_prefab_recipes(ImporterData const& importData, Prefabs const& prefabs);
+
+/// [prefab name] -> {importer resource, prefab within it}. Name string views point into
+/// ImporterData resources; the index is only valid while those stay loaded.
+using PrefabIndex_t = entt::dense_map< std::string_view, std::pair<ResId, PrefabId> >;
+
+/**
+ * @brief Index every loaded importer's prefabs by name, for fixing up saved prefab references
+ */
+PrefabIndex_t index_prefabs(Resources &rResources);
+
 } // namespace osp
@@ -0,0 +1,725 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "asset_pack.h"
+#include "ImporterData.h"
+#include "pack_io.h"
+
+#include "../core/Resources.h"
+#include "../drawing/own_restypes.h"
+#include "../util/logging.h"
+
+#include <Magnum/Trade/ImageData.h>
+#include <Magnum/Trade/MaterialData.h>
+#include <Magnum/Trade/MeshData.h>
+#include <Magnum/Trade/TextureData.h>
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StringStlView.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+using namespace osp;
+using namespace osp::restypes;
+
+using Corrade::Containers::Array;
+using Corrade::Containers::Optional;
+using Corrade::Containers::StringView;
+
+using Magnum::UnsignedInt;
+using Magnum::Vector2i;
+
+using Magnum::Trade::ImageData2D;
+using Magnum::Trade::MaterialData;
+using Magnum::Trade::MeshData;
+using Magnum::Trade::TextureData;
+
+namespace
+{
+
+constexpr std::array<char, 8> sc_packMagic{'O', 'S', 'P', 'P', 'A', 'K', '\0', '\1'};
+
+//-----------------------------------------------------------------------------
+
+void write_mesh(PackWriter &rWriter, MeshData const& mesh)
+{
+    rWriter.write(std::uint32_t(mesh.primitive()));
+    rWriter.write(std::uint32_t(mesh.vertexCount()));
+
+    rWriter.write(std::uint8_t(mesh.isIndexed()));
+    if (mesh.isIndexed())
+    {
+        rWriter.write(std::uint32_t(mesh.indexType()));
+        rWriter.write(std::uint32_t(mesh.indexCount()));
+        rWriter.write(std::uint64_t(mesh.indexOffset()));
+    }
+
+    rWriter.write(std::uint32_t(mesh.attributeCount()));
+    for (UnsignedInt i = 0; i < mesh.attributeCount(); i ++)
+    {
+        rWriter.write(std::uint32_t(mesh.attributeName(i)));
+        rWriter.write(std::uint32_t(mesh.attributeFormat(i)));
+        rWriter.write(std::uint64_t(mesh.attributeOffset(i)));
+        rWriter.write(std::int64_t (mesh.attributeStride(i)));
+        rWriter.write(std::uint32_t(mesh.attributeArraySize(i)));
+    }
+
+    if (mesh.isIndexed())
+    {
+        rWriter.write_blob(mesh.indexData().data(), mesh.indexData().size());
+    }
+    rWriter.write_blob(mesh.vertexData().data(), mesh.vertexData().size());
+}
+
+Optional<MeshData> read_mesh(PackReader &rReader)
+{
+    auto const primitive    = Magnum::MeshPrimitive(rReader.read<std::uint32_t>());
+    auto const vertexCount  = rReader.read<std::uint32_t>();
+
+    bool const indexed      = rReader.read<std::uint8_t>() != 0;
+    auto indexType          = Magnum::MeshIndexType{};
+    std::uint32_t indexCount{0};
+    std::uint64_t indexOffset{0};
+    if (indexed)
+    {
+        indexType   = Magnum::MeshIndexType(rReader.read<std::uint32_t>());
+        indexCount  = rReader.read<std::uint32_t>();
+        indexOffset = rReader.read<std::uint64_t>();
+    }
+
+    auto const attrCount = rReader.read<std::uint32_t>();
+    if (rReader.fail || attrCount > 64)
+    {
+        rReader.fail = true;
+        return {};
+    }
+
+    Array<Magnum::Trade::MeshAttributeData> attributes{attrCount};
+    for (std::uint32_t i = 0; i < attrCount; i ++)
+    {
+        auto const name      = Magnum::Trade::MeshAttribute(rReader.read<std::uint32_t>());
+        auto const format    = Magnum::VertexFormat(rReader.read<std::uint32_t>());
+        auto const offset    = rReader.read<std::uint64_t>();
+        auto const stride    = rReader.read<std::int64_t>();
+        auto const arraySize = rReader.read<std::uint32_t>();
+
+        attributes[i] = Magnum::Trade::MeshAttributeData{
+                name, format, std::size_t(offset), vertexCount,
+                std::ptrdiff_t(stride), Magnum::UnsignedShort(arraySize)};
+    }
+
+    ArrayView<unsigned char const> const indexData  = indexed ? rReader.read_blob()
+                                                              : ArrayView<unsigned char const>{};
+    ArrayView<unsigned char const> const vertexData = rReader.read_blob();
+
+    if (rReader.fail)
+    {
+        return {};
+    }
+
+    // Non-owning views into the pack; the AssetPack keeps the bytes alive
+    if (indexed)
+    {
+        Magnum::Trade::MeshIndexData const indices{
+                indexType, indexData.exceptPrefix(std::size_t(indexOffset))};
+        return MeshData{primitive,
+                Magnum::Trade::DataFlags{}, indexData,  indices,
+                Magnum::Trade::DataFlags{}, vertexData, std::move(attributes), vertexCount};
+    }
+    return MeshData{primitive,
+            Magnum::Trade::DataFlags{}, vertexData, std::move(attributes), vertexCount};
+}
+
+void write_image(PackWriter &rWriter, ImageData2D const& image)
+{
+    rWriter.write(std::uint8_t(image.isCompressed()));
+    if (image.isCompressed())
+    {
+        // Block-compressed data (eg: transcoded KTX2/BasisU) is cached as-is, so warm
+        // launches feed the GL upload path without ever re-decoding or re-transcoding
+        rWriter.write(std::uint32_t(image.compressedFormat()));
+    }
+    else
+    {
+        rWriter.write(std::uint32_t(image.format()));
+    }
+    rWriter.write(std::int32_t(image.size().x()));
+    rWriter.write(std::int32_t(image.size().y()));
+    rWriter.write(std::int32_t(image.isCompressed() ? 4 : image.storage().alignment()));
+    rWriter.write_blob(image.data().data(), image.data().size());
+}
+
+Optional<ImageData2D> read_image(PackReader &rReader)
+{
+    bool const compressed = rReader.read<std::uint8_t>() != 0;
+    auto const format    = rReader.read<std::uint32_t>();
+    auto const sizeX     = rReader.read<std::int32_t>();
+    auto const sizeY     = rReader.read<std::int32_t>();
+    auto const alignment = rReader.read<std::int32_t>();
+
+    ArrayView<unsigned char const> const pixels = rReader.read_blob();
+    if (rReader.fail)
+    {
+        return {};
+    }
+
+    if (compressed)
+    {
+        return ImageData2D{Magnum::CompressedPixelFormat(format),
+                           Vector2i{sizeX, sizeY}, Magnum::Trade::DataFlags{}, pixels};
+    }
+    return ImageData2D{Magnum::PixelStorage{}.setAlignment(alignment),
+                       Magnum::PixelFormat(format),
+                       Vector2i{sizeX, sizeY}, Magnum::Trade::DataFlags{}, pixels};
+}
+
+void write_texture(PackWriter &rWriter, TextureData const& tex)
+{
+    rWriter.write(std::uint32_t(tex.type()));
+    rWriter.write(std::uint32_t(tex.minificationFilter()));
+    rWriter.write(std::uint32_t(tex.magnificationFilter()));
+    rWriter.write(std::uint32_t(tex.mipmapFilter()));
+    rWriter.write(std::uint32_t(tex.wrapping().x()));
+    rWriter.write(std::uint32_t(tex.wrapping().y()));
+    rWriter.write(std::uint32_t(tex.wrapping().z()));
+    rWriter.write(std::uint32_t(tex.image()));
+}
+
+Optional<TextureData> read_texture(PackReader &rReader)
+{
+    auto const type      = Magnum::Trade::TextureType(rReader.read<std::uint32_t>());
+    auto const minFilter = Magnum::SamplerFilter(rReader.read<std::uint32_t>());
+    auto const magFilter = Magnum::SamplerFilter(rReader.read<std::uint32_t>());
+    auto const mipmap    = Magnum::SamplerMipmap(rReader.read<std::uint32_t>());
+    auto const wrapX     = Magnum::SamplerWrapping(rReader.read<std::uint32_t>());
+    auto const wrapY     = Magnum::SamplerWrapping(rReader.read<std::uint32_t>());
+    auto const wrapZ     = Magnum::SamplerWrapping(rReader.read<std::uint32_t>());
+    auto const image     = rReader.read<std::uint32_t>();
+
+    if (rReader.fail)
+    {
+        return {};
+    }
+
+    return TextureData{type, minFilter, magFilter, mipmap,
+                       Magnum::Math::Vector3<Magnum::SamplerWrapping>{wrapX, wrapY, wrapZ},
+                       image};
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief One cooked source file parsed back out of a pack, not yet touching Resources
+ */
+struct PackEntry
+{
+    std::string_view                    path;
+
+    std::vector<std::string_view>       imgNames;
+    std::vector<Optional<ImageData2D>>  images;
+
+    std::vector<std::string_view>       texNames;
+    std::vector<Optional<TextureData>>  textures;
+
+    std::vector<std::string_view>       meshNames;
+    std::vector<Optional<MeshData>>     meshes;
+
+    /// Base color texture per material, -1 for none; this is the only material attribute the
+    /// engine reads back out of ImporterData
+    std::vector<std::int32_t>           matBaseColorTex;
+
+    ImporterData                        importerData;   ///< Owner vectors left empty
+    Prefabs                             prefabs;        ///< m_prefabNames built at register
+    bool                                hasPrefabs{false};
+};
+
+void cook_entry(PackWriter &rWriter, Resources &rResources, ResId const importerRes)
+{
+    auto const &rImportData = rResources.data_get<ImporterData const>(gc_importer, importerRes);
+    auto const *pPrefabs    = rResources.data_try_get<Prefabs const>(gc_importer, importerRes);
+
+    rWriter.write_string(rResources.name(gc_importer, importerRes));
+
+    // Images, textures, and meshes, each: presence flag, resource name, payload
+    rWriter.write(std::uint32_t(rImportData.m_images.size()));
+    for (ResIdOwner_t const& rOwner : rImportData.m_images)
+    {
+        auto const *pImage = rOwner.has_value()
+                ? rResources.data_try_get<ImageData2D const>(gc_image, rOwner.value()) : nullptr;
+        rWriter.write(std::uint8_t(pImage != nullptr));
+        if (pImage != nullptr)
+        {
+            rWriter.write_string(rResources.name(gc_image, rOwner.value()));
+            write_image(rWriter, *pImage);
+        }
+    }
+
+    rWriter.write(std::uint32_t(rImportData.m_textures.size()));
+    for (ResIdOwner_t const& rOwner : rImportData.m_textures)
+    {
+        auto const *pTex = rOwner.has_value()
+                ? rResources.data_try_get<TextureData const>(gc_texture, rOwner.value()) : nullptr;
+        rWriter.write(std::uint8_t(pTex != nullptr));
+        if (pTex != nullptr)
+        {
+            rWriter.write_string(rResources.name(gc_texture, rOwner.value()));
+            write_texture(rWriter, *pTex);
+        }
+    }
+
+    rWriter.write(std::uint32_t(rImportData.m_meshes.size()));
+    for (ResIdOwner_t const& rOwner : rImportData.m_meshes)
+    {
+        auto const *pMesh = rOwner.has_value()
+                ? rResources.data_try_get<MeshData const>(gc_mesh, rOwner.value()) : nullptr;
+        rWriter.write(std::uint8_t(pMesh != nullptr));
+        if (pMesh != nullptr)
+        {
+            rWriter.write_string(rResources.name(gc_mesh, rOwner.value()));
+            write_mesh(rWriter, *pMesh);
+        }
+    }
+
+    // Materials reduced to what prefab_draw reads back: the base color texture index
+    rWriter.write(std::uint32_t(rImportData.m_materials.size()));
+    for (ImporterData::OptMaterialData_t const& mat : rImportData.m_materials)
+    {
+        std::int32_t baseColorTex = -1;
+        if (    bool(mat)
+             && (mat->types() & Magnum::Trade::MaterialType::PbrMetallicRoughness)
+             && mat->hasAttribute(Magnum::Trade::MaterialAttribute::BaseColorTexture))
+        {
+            baseColorTex = std::int32_t(
+                    mat->attribute<UnsignedInt>(Magnum::Trade::MaterialAttribute::BaseColorTexture));
+        }
+        rWriter.write(baseColorTex);
+    }
+
+    // Object data
+    auto const objCount = std::uint32_t(rImportData.m_objParents.size());
+    rWriter.write(objCount);
+    for (std::uint32_t obj = 0; obj < objCount; obj ++)
+    {
+        rWriter.write_string(std::string_view{StringView{rImportData.m_objNames[obj]}});
+        rWriter.write(rImportData.m_objTransforms[obj]);
+        rWriter.write(std::int32_t(rImportData.m_objParents[obj]));
+        rWriter.write(std::uint64_t(rImportData.m_objDescendants[obj]));
+        rWriter.write(std::int32_t(rImportData.m_objMeshes[obj]));
+        rWriter.write(std::int32_t(rImportData.m_objMaterials[obj]));
+
+        auto const children = rImportData.m_objChildren[ObjId(obj)];
+        rWriter.write(std::uint32_t(children.size()));
+        for (ObjId const child : children)
+        {
+            rWriter.write(std::int32_t(child));
+        }
+    }
+
+    auto const scnCount = std::uint32_t(rImportData.m_scnTopLevel.ids_count());
+    rWriter.write(scnCount);
+    for (std::uint32_t scn = 0; scn < scnCount; scn ++)
+    {
+        auto const topLevel = rImportData.m_scnTopLevel[int(scn)];
+        rWriter.write(std::uint32_t(topLevel.size()));
+        for (ObjId const obj : topLevel)
+        {
+            rWriter.write(std::int32_t(obj));
+        }
+    }
+
+    // Prefabs: the machine/part metadata previously re-derived from glTF node extras
+    rWriter.write(std::uint8_t(pPrefabs != nullptr));
+    if (pPrefabs != nullptr)
+    {
+        for (std::uint32_t obj = 0; obj < objCount; obj ++)
+        {
+            rWriter.write(std::uint8_t(pPrefabs->m_objShape[obj]));
+            rWriter.write(float(pPrefabs->m_objMass[obj]));
+        }
+
+        auto const prefabCount = std::uint32_t(pPrefabs->m_prefabs.ids_count());
+        rWriter.write(prefabCount);
+        for (std::uint32_t pf = 0; pf < prefabCount; pf ++)
+        {
+            auto const objs    = pPrefabs->m_prefabs[PrefabId(pf)];
+            auto const parents = pPrefabs->m_prefabParents[PrefabId(pf)];
+            rWriter.write(std::uint32_t(objs.size()));
+            for (ObjId const obj : objs)
+            {
+                rWriter.write(std::int32_t(obj));
+            }
+            for (std::int32_t const parent : parents)
+            {
+                rWriter.write(parent);
+            }
+        }
+    }
+}
+
+bool read_entry(PackReader &rReader, PackEntry &rEntry)
+{
+    // Arbitrary sanity bound so a corrupt count can't balloon allocations
+    auto const check_count = [&rReader] (std::uint32_t const count)
+    {
+        rReader.fail = rReader.fail || (count > (1u << 20));
+        return ! rReader.fail;
+    };
+
+    rEntry.path = rReader.read_string();
+
+    auto const imgCount = rReader.read<std::uint32_t>();
+    if ( ! check_count(imgCount)) { return false; }
+    rEntry.imgNames.resize(imgCount);
+    rEntry.images  .resize(imgCount);
+    for (std::uint32_t i = 0; i < imgCount; i ++)
+    {
+        if (rReader.read<std::uint8_t>() != 0)
+        {
+            rEntry.imgNames[i] = rReader.read_string();
+            rEntry.images  [i] = read_image(rReader);
+        }
+    }
+
+    auto const texCount = rReader.read<std::uint32_t>();
+    if ( ! check_count(texCount)) { return false; }
+    rEntry.texNames.resize(texCount);
+    rEntry.textures.resize(texCount);
+    for (std::uint32_t i = 0; i < texCount; i ++)
+    {
+        if (rReader.read<std::uint8_t>() != 0)
+        {
+            rEntry.texNames[i] = rReader.read_string();
+            rEntry.textures[i] = read_texture(rReader);
+        }
+    }
+
+    auto const meshCount = rReader.read<std::uint32_t>();
+    if ( ! check_count(meshCount)) { return false; }
+    rEntry.meshNames.resize(meshCount);
+    rEntry.meshes   .resize(meshCount);
+    for (std::uint32_t i = 0; i < meshCount; i ++)
+    {
+        if (rReader.read<std::uint8_t>() != 0)
+        {
+            rEntry.meshNames[i] = rReader.read_string();
+            rEntry.meshes   [i] = read_mesh(rReader);
+        }
+    }
+
+    auto const matCount = rReader.read<std::uint32_t>();
+    if ( ! check_count(matCount)) { return false; }
+    rEntry.matBaseColorTex.resize(matCount);
+    for (std::uint32_t i = 0; i < matCount; i ++)
+    {
+        rEntry.matBaseColorTex[i] = rReader.read<std::int32_t>();
+    }
+
+    ImporterData &rImportData = rEntry.importerData;
+
+    auto const objCount = rReader.read<std::uint32_t>();
+    if ( ! check_count(objCount)) { return false; }
+    rImportData.m_objNames      .resize(objCount);
+    rImportData.m_objTransforms .resize(objCount);
+    rImportData.m_objParents    .resize(objCount, -1);
+    rImportData.m_objDescendants.resize(objCount, 0);
+    rImportData.m_objMeshes     .resize(objCount, -1);
+    rImportData.m_objMaterials  .resize(objCount, -1);
+    rImportData.m_objChildren.ids_reserve(objCount);
+    rImportData.m_objChildren.data_reserve(objCount);
+
+    std::vector<ObjId> tmpObjs;
+    for (std::uint32_t obj = 0; obj < objCount; obj ++)
+    {
+        rImportData.m_objNames      [obj] = StringView{rReader.read_string()};
+        rImportData.m_objTransforms [obj] = rReader.read<Matrix4>();
+        rImportData.m_objParents    [obj] = rReader.read<std::int32_t>();
+        rImportData.m_objDescendants[obj] = std::size_t(rReader.read<std::uint64_t>());
+        rImportData.m_objMeshes     [obj] = rReader.read<std::int32_t>();
+        rImportData.m_objMaterials  [obj] = rReader.read<std::int32_t>();
+
+        auto const childCount = rReader.read<std::uint32_t>();
+        if ( ! check_count(childCount)) { return false; }
+        tmpObjs.resize(childCount);
+        for (std::uint32_t i = 0; i < childCount; i ++)
+        {
+            tmpObjs[i] = rReader.read<std::int32_t>();
+        }
+        if (childCount != 0)
+        {
+            rImportData.m_objChildren.emplace(ObjId(obj), tmpObjs.begin(), tmpObjs.end());
+        }
+    }
+
+    auto const scnCount = rReader.read<std::uint32_t>();
+    if ( ! check_count(scnCount)) { return false; }
+    rImportData.m_scnTopLevel.ids_reserve(scnCount);
+    rImportData.m_scnTopLevel.data_reserve(objCount);
+    for (std::uint32_t scn = 0; scn < scnCount; scn ++)
+    {
+        auto const topCount = rReader.read<std::uint32_t>();
+        if ( ! check_count(topCount)) { return false; }
+        tmpObjs.resize(topCount);
+        for (std::uint32_t i = 0; i < topCount; i ++)
+        {
+            tmpObjs[i] = rReader.read<std::int32_t>();
+        }
+        if (topCount != 0)
+        {
+            rImportData.m_scnTopLevel.emplace(int(scn), tmpObjs.begin(), tmpObjs.end());
+        }
+        else
+        {
+            rImportData.m_scnTopLevel.emplace(int(scn), {});
+        }
+    }
+
+    rEntry.hasPrefabs = rReader.read<std::uint8_t>() != 0;
+    if (rEntry.hasPrefabs)
+    {
+        Prefabs &rPrefabs = rEntry.prefabs;
+        rPrefabs.m_objShape.resize(objCount, EShape::None);
+        rPrefabs.m_objMass .resize(objCount, 0.0f);
+        for (std::uint32_t obj = 0; obj < objCount; obj ++)
+        {
+            rPrefabs.m_objShape[obj] = EShape(rReader.read<std::uint8_t>());
+            rPrefabs.m_objMass [obj] = rReader.read<float>();
+        }
+
+        auto const prefabCount = rReader.read<std::uint32_t>();
+        if ( ! check_count(prefabCount)) { return false; }
+        rPrefabs.m_prefabs      .ids_reserve(prefabCount);
+        rPrefabs.m_prefabs      .data_reserve(objCount);
+        rPrefabs.m_prefabParents.ids_reserve(prefabCount);
+        rPrefabs.m_prefabParents.data_reserve(objCount);
+
+        std::vector<std::int32_t> tmpParents;
+        for (std::uint32_t pf = 0; pf < prefabCount; pf ++)
+        {
+            auto const pfObjCount = rReader.read<std::uint32_t>();
+            if ( ! check_count(pfObjCount)) { return false; }
+            tmpObjs   .resize(pfObjCount);
+            tmpParents.resize(pfObjCount);
+            for (std::uint32_t i = 0; i < pfObjCount; i ++)
+            {
+                tmpObjs[i] = rReader.read<std::int32_t>();
+            }
+            for (std::uint32_t i = 0; i < pfObjCount; i ++)
+            {
+                tmpParents[i] = rReader.read<std::int32_t>();
+            }
+            rPrefabs.m_prefabs.emplace(
+                    PrefabId(pf), tmpObjs.begin(), tmpObjs.end());
+            rPrefabs.m_prefabParents.emplace(
+                    PrefabId(pf), tmpParents.begin(), tmpParents.end());
+        }
+    }
+
+    return ! rReader.fail;
+}
+
+ResId register_entry(PackEntry &&entry, Resources &rResources, PkgId const pkg)
+{
+    ResId const res = rResources.create(gc_importer, pkg, SharedString::create(entry.path));
+
+    auto &rImportData = rResources.data_add<ImporterData>(
+            gc_importer, res, std::move(entry.importerData));
+
+    rImportData.m_images  .resize(entry.images.size());
+    rImportData.m_textures.resize(entry.textures.size());
+    rImportData.m_meshes  .resize(entry.meshes.size());
+
+    for (std::size_t i = 0; i < entry.images.size(); i ++)
+    {
+        if ( ! bool(entry.images[i]))
+        {
+            continue;
+        }
+        ResId const imgRes = rResources.create(gc_image, pkg, SharedString::create(entry.imgNames[i]));
+        rResources.data_add<ImageData2D>(gc_image, imgRes, std::move(*entry.images[i]));
+        rImportData.m_images[i] = rResources.owner_create(gc_image, imgRes);
+    }
+
+    for (std::size_t i = 0; i < entry.textures.size(); i ++)
+    {
+        if ( ! bool(entry.textures[i]))
+        {
+            continue;
+        }
+        TextureData &rTex = *entry.textures[i];
+
+        ResId const texRes = rResources.create(gc_texture, pkg, SharedString::create(entry.texNames[i]));
+        rImportData.m_textures[i] = rResources.owner_create(gc_texture, texRes);
+
+        if (ResIdOwner_t const& imgRes = rImportData.m_images.at(rTex.image());
+            imgRes.has_value())
+        {
+            ResIdOwner_t imgOwner = rResources.owner_create(gc_image, imgRes.value());
+            rResources.data_add<TextureImgSource>(gc_texture, texRes, TextureImgSource{std::move(imgOwner)});
+        }
+        rResources.data_add<TextureData>(gc_texture, texRes, std::move(rTex));
+    }
+
+    for (std::size_t i = 0; i < entry.meshes.size(); i ++)
+    {
+        if ( ! bool(entry.meshes[i]))
+        {
+            continue;
+        }
+        ResId const meshRes = rResources.create(gc_mesh, pkg, SharedString::create(entry.meshNames[i]));
+        rResources.data_add<MeshData>(gc_mesh, meshRes, std::move(*entry.meshes[i]));
+        rImportData.m_meshes[i] = rResources.owner_create(gc_mesh, meshRes);
+    }
+
+    rImportData.m_materials.reserve(entry.matBaseColorTex.size());
+    for (std::int32_t const baseColorTex : entry.matBaseColorTex)
+    {
+        using Magnum::Trade::MaterialAttributeData;
+        using Magnum::Trade::MaterialAttribute;
+
+        if (baseColorTex >= 0)
+        {
+            rImportData.m_materials.emplace_back(MaterialData{
+                    Magnum::Trade::MaterialType::PbrMetallicRoughness,
+                    {MaterialAttributeData{MaterialAttribute::BaseColorTexture,
+                                           UnsignedInt(baseColorTex)}}});
+        }
+        else
+        {
+            rImportData.m_materials.emplace_back(MaterialData{
+                    Magnum::Trade::MaterialType::PbrMetallicRoughness, {}});
+        }
+    }
+
+    if (entry.hasPrefabs)
+    {
+        // Prefab names view into the importer's now-stable object name storage
+        auto const prefabCount = entry.prefabs.m_prefabs.ids_count();
+        entry.prefabs.m_prefabNames.reserve(prefabCount);
+        for (std::uint32_t pf = 0; pf < prefabCount; pf ++)
+        {
+            auto const &name = rImportData.m_objNames[entry.prefabs.m_prefabs[PrefabId(pf)][0]];
+            entry.prefabs.m_prefabNames.emplace_back(name.exceptPrefix("part_"));
+        }
+        PrefabRecipes recipes = make_prefab_recipes(rImportData, entry.prefabs);
+        rResources.data_add<Prefabs>(gc_importer, res, std::move(entry.prefabs));
+        rResources.data_add<PrefabRecipes>(gc_importer, res, std::move(recipes));
+    }
+
+    return res;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+
+bool AssetPack::open(std::string_view const filepath)
+{
+    if ( ! m_file.open(filepath))
+    {
+        return false;
+    }
+
+    // Verify magic and version before anyone parses further
+    auto const view = m_file.data();
+    return view.size() >= sc_packMagic.size()
+        && std::memcmp(view.data(), sc_packMagic.data(), sc_packMagic.size()) == 0;
+}
+
+ArrayView<unsigned char const> AssetPack::data() const noexcept
+{
+    return m_file.data();
+}
+
+bool osp::cook_asset_pack(std::string_view const filepath, Resources &rResources, ArrayView<ResId const> const importers)
+{
+    PackWriter writer;
+
+    writer.out.insert(writer.out.end(), sc_packMagic.begin(), sc_packMagic.end());
+    writer.write(std::uint32_t(importers.size()));
+
+    for (ResId const importerRes : importers)
+    {
+        cook_entry(writer, rResources, importerRes);
+    }
+
+    std::string const path{filepath};
+
+    bool cookable;
+    {
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        cookable = file.is_open();
+        if (cookable)
+        {
+            file.write(reinterpret_cast<char const*>(writer.out.data()),
+                       std::streamsize(writer.out.size()));
+            cookable = file.good();
+        }
+    }
+
+    if ( ! cookable)
+    {
+        OSP_LOG_WARN("Could not cook asset pack {}", filepath);
+        std::remove(path.c_str()); // Never leave a partial pack behind
+    }
+
+    return cookable;
+}
+
+std::vector<ResId> osp::load_asset_pack(AssetPack const& rPack, Resources &rResources, PkgId const pkg)
+{
+    PackReader reader{ .data = rPack.data(), .pos = sc_packMagic.size() };
+
+    auto const entryCount = reader.read<std::uint32_t>();
+    if (reader.fail || entryCount > (1u << 16))
+    {
+        OSP_LOG_WARN("Malformed asset pack header");
+        return {};
+    }
+
+    // Parse everything up-front; a truncated or corrupt pack is rejected as a whole instead of
+    // leaving half of its resources registered
+    std::vector<PackEntry> entries(entryCount);
+    for (PackEntry &rEntry : entries)
+    {
+        if ( ! read_entry(reader, rEntry))
+        {
+            OSP_LOG_WARN("Malformed asset pack entry; ignoring pack");
+            return {};
+        }
+    }
+
+    std::vector<ResId> out;
+    out.reserve(entryCount);
+    for (PackEntry &rEntry : entries)
+    {
+        out.push_back(register_entry(std::move(rEntry), rResources, pkg));
+    }
+
+    return out;
+}
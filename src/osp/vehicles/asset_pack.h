@@ -0,0 +1,89 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "pack_io.h"
+
+#include "../core/array_view.h"
+#include "../core/resourcetypes.h"
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace osp
+{
+
+/**
+ * @brief Read-only view of a cooked asset pack file
+ *
+ * Packs are produced by cook_asset_pack and loaded by load_asset_pack. Mesh and image blobs
+ * inside the pack are referenced in-place (memory-mapped on POSIX platforms), so an AssetPack
+ * must outlive every Resources entry created from it.
+ */
+class AssetPack
+{
+public:
+    AssetPack() = default;
+    AssetPack(AssetPack const&) = delete;
+    AssetPack& operator=(AssetPack const&) = delete;
+
+    /**
+     * @brief Map or read a pack file and verify its header
+     *
+     * @return false if the file is missing, unreadable, or not a supported pack
+     */
+    bool open(std::string_view filepath);
+
+    [[nodiscard]] ArrayView<unsigned char const> data() const noexcept;
+
+private:
+    PackFileView                m_file;
+};
+
+/**
+ * @brief Write loaded glTF importers' decoded contents into one pack file
+ *
+ * Stores pre-parsed prefab hierarchies, object metadata, and mesh/image blobs in their
+ * upload-ready layout, so later launches skip glTF parsing entirely.
+ *
+ * @param importers [in] gc_importer resources with ImporterData (and optionally Prefabs)
+ *
+ * @return false when writing failed; the output file is removed in that case
+ */
+bool cook_asset_pack(std::string_view filepath, Resources &rResources, ArrayView<ResId const> importers);
+
+/**
+ * @brief Register an opened pack's contents into Resources
+ *
+ * Equivalent to loading the originally cooked glTF files and assigning their prefabs, except
+ * mesh and image data reference the pack in-place instead of being parsed.
+ *
+ * @return One importer ResId per cooked source file; empty when the pack is malformed. A
+ *         malformed pack is detected up-front, before anything is added to \p rResources.
+ */
+std::vector<ResId> load_asset_pack(AssetPack const& rPack, Resources &rResources, PkgId pkg);
+
+} // namespace osp
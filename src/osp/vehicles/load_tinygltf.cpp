@@ -25,6 +25,7 @@
 
 #include "load_tinygltf.h"
 #include "ImporterData.h"
+#include "mesh_lod.h"
 
 #include "../core/Resources.h"
 #include "../drawing/own_restypes.h"
@@ -39,10 +40,24 @@
 #include <Magnum/Trade/SceneData.h>
 
 #include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/Containers/StringStlView.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/PairStl.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OSP_GLTF_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 using namespace osp;
 
 using Magnum::Trade::TinyGltfImporter;
@@ -71,10 +86,160 @@ void osp::register_tinygltf_resources(Resources &rResources)
     rResources.data_register<TinyGltfNodeExtras_t>(restypes::gc_importer);
 }
 
-static void load_gltf(TinyGltfImporter &rImporter, ResId res, std::string_view name, Resources &rResources, PkgId pkg)
+#ifdef OSP_GLTF_MMAP
+
+/**
+ * @brief Read-only memory-mapped file, unmapped on destruction
+ *
+ * Lets the importer parse a self-contained .glb straight out of the page cache instead of
+ * reading the whole file into a heap buffer first; its binary chunk is demand-paged as
+ * accessors are decoded.
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    MappedFile(MappedFile&& other) noexcept
+     : m_data{std::exchange(other.m_data, nullptr)}
+     , m_size{std::exchange(other.m_size, 0ul)}
+    { }
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        if (m_data != nullptr)
+        {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    bool try_map(char const* path)
+    {
+        int const fd = ::open(path, O_RDONLY);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStat{};
+        if (::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            void *pData = ::mmap(nullptr, std::size_t(fileStat.st_size),
+                                 PROT_READ, MAP_PRIVATE, fd, 0);
+            if (pData != MAP_FAILED)
+            {
+                m_data = pData;
+                m_size = std::size_t(fileStat.st_size);
+            }
+        }
+        ::close(fd); // Mapping stays valid after close
+
+        return m_data != nullptr;
+    }
+
+    Corrade::Containers::ArrayView<void const> view() const noexcept
+    {
+        return {m_data, m_size};
+    }
+
+private:
+    void        *m_data{nullptr};
+    std::size_t m_size{0};
+};
+
+#endif // OSP_GLTF_MMAP
+
+/**
+ * @brief One glTF file's importer and its eagerly decoded contents
+ *
+ * Everything here is produced without touching Resources, so multiple files can decode on
+ * worker threads ahead of the serialized registration phase.
+ */
+struct DecodedGltf
+{
+    Pointer<TinyGltfImporter>           importer;
+    std::string                         path;
+
+#ifdef OSP_GLTF_MMAP
+    MappedFile                          mapped;
+#endif
+
+    std::vector<Optional<ImageData2D>>  images;
+    std::vector<Optional<TextureData>>  textures;
+    std::vector<Optional<MeshData>>     meshes;
+    std::vector<MeshLodChain_t>         meshLods;
+
+    bool                                opened{false};
+};
+
+static void decode_gltf(DecodedGltf &rDecoded)
+{
+    TinyGltfImporter &rImporter = *rDecoded.importer;
+
+#ifdef OSP_GLTF_MMAP
+    // Self-contained .glb files are parsed from a memory mapping. External-file .gltf still
+    // goes through openFile, so relative buffer/image URIs resolve against its directory.
+    if ( ! (   std::string_view{rDecoded.path}.ends_with(".glb")
+            && rDecoded.mapped.try_map(rDecoded.path.c_str())
+            && rImporter.openData(rDecoded.mapped.view()) ) )
+    {
+        rImporter.openFile(rDecoded.path);
+    }
+#else
+    rImporter.openFile(rDecoded.path);
+#endif
+
+    if ( ! rImporter.isOpened() || rImporter.defaultScene() == -1)
+    {
+        return; // opened stays false; reported during registration
+    }
+    rDecoded.opened = true;
+
+    // Image decode and mesh conversion dominate load time; do them eagerly here so separate
+    // files overlap on worker threads
+    rDecoded.images.reserve(rImporter.image2DCount());
+    for (UnsignedInt i = 0; i < rImporter.image2DCount(); i ++)
+    {
+        rDecoded.images.push_back(rImporter.image2D(i));
+    }
+
+    rDecoded.textures.reserve(rImporter.textureCount());
+    for (UnsignedInt i = 0; i < rImporter.textureCount(); i ++)
+    {
+        rDecoded.textures.push_back(rImporter.texture(i));
+    }
+
+    rDecoded.meshes.reserve(rImporter.meshCount());
+    for (UnsignedInt i = 0; i < rImporter.meshCount(); i ++)
+    {
+        rDecoded.meshes.push_back(rImporter.mesh(i));
+    }
+
+    // Cook simplified LOD chains here too, so the quadric clustering overlaps on the same
+    // worker threads instead of extending the serialized registration phase
+    rDecoded.meshLods.resize(rDecoded.meshes.size());
+    for (std::size_t i = 0; i < rDecoded.meshes.size(); i ++)
+    {
+        if (bool(rDecoded.meshes[i]))
+        {
+            rDecoded.meshLods[i] = simplify_mesh_lods(*rDecoded.meshes[i]);
+        }
+    }
+}
+
+static void load_gltf(DecodedGltf &rDecoded, ResId res, std::string_view name, Resources &rResources, PkgId pkg)
 {
     using namespace restypes;
 
+    TinyGltfImporter &rImporter = *rDecoded.importer;
+
     // Combine resource names. Maybe make this customizable
     // ie: name = "dir/file.gltf" and resName = "mytexture"
     // "dir/file.gltf:mytexture"
@@ -122,7 +287,7 @@ static void load_gltf(TinyGltfImporter &rImporter, ResId res, std::string_view n
     // Store images
     for (UnsignedInt i = 0; i < rImporter.image2DCount(); i ++)
     {
-        Optional<ImageData2D> img = rImporter.image2D(i);
+        Optional<ImageData2D> &img = rDecoded.images[i];
 
         if ( ! bool(img) )
         {
@@ -135,12 +300,13 @@ static void load_gltf(TinyGltfImporter &rImporter, ResId res, std::string_view n
 
         // Add image data to resource
         rResources.data_add<ImageData2D>(gc_image, imgRes, std::move(*img));
+        rResources.load_state_set(gc_image, imgRes, EResLoadState::Resident);
     }
 
     // Store textures
     for (UnsignedInt i = 0; i < rImporter.textureCount(); i ++)
     {
-        Optional<TextureData> tex = rImporter.texture(i);
+        Optional<TextureData> &tex = rDecoded.textures[i];
 
         if ( ! bool(tex) )
         {
@@ -161,12 +327,14 @@ static void load_gltf(TinyGltfImporter &rImporter, ResId res, std::string_view n
             ResIdOwner_t imgOwner = rResources.owner_create(gc_image, imgRes);
             rResources.data_add<TextureImgSource>(gc_texture, texRes, TextureImgSource{std::move(imgOwner)} );
         }
+
+        rResources.load_state_set(gc_texture, texRes, EResLoadState::Resident);
     }
 
     // Store meshes
     for (UnsignedInt i = 0; i < rImporter.meshCount(); i ++)
     {
-        Optional<MeshData> mesh = rImporter.mesh(i);
+        Optional<MeshData> &mesh = rDecoded.meshes[i];
 
         if ( ! bool(mesh) )
         {
@@ -176,6 +344,11 @@ static void load_gltf(TinyGltfImporter &rImporter, ResId res, std::string_view n
         ResId const meshRes = rResources.create(gc_mesh, pkg, format_name(rImporter.meshName(i), i));
         rResources.data_add<MeshData>(gc_mesh, meshRes, std::move(*mesh));
         rImportData.m_meshes[i] = rResources.owner_create(gc_mesh, meshRes);
+
+        // Store the LOD chain cooked during decode as its own resources
+        register_mesh_lods(rResources, pkg, meshRes, std::move(rDecoded.meshLods[i]));
+
+        rResources.load_state_set(gc_mesh, meshRes, EResLoadState::Resident);
     }
 
     // Store materials
@@ -324,30 +497,93 @@ static void load_gltf(TinyGltfImporter &rImporter, ResId res, std::string_view n
     }
 }
 
+static ResId register_decoded_gltf(DecodedGltf &rDecoded, Resources &rResources, PkgId pkg)
+{
+    if ( ! rDecoded.opened)
+    {
+        OSP_LOG_ERROR("Could not open file {}", rDecoded.path);
+        return lgrn::id_null<ResId>();
+    }
+
+    // Create Importer resource
+    ResId const res = rResources.create(restypes::gc_importer, pkg, SharedString::create(rDecoded.path));
+
+    rResources.load_state_set(restypes::gc_importer, res, EResLoadState::Loading);
+    load_gltf(rDecoded, res, rDecoded.path, rResources, pkg);
+    rResources.load_state_set(restypes::gc_importer, res, EResLoadState::Resident);
+
+    rDecoded.importer->close();
+
+    return res;
+}
 
 ResId osp::load_tinygltf_file(std::string_view filepath, Resources &rResources, PkgId pkg)
 {
     PluginManager pluginManager;
 
+    DecodedGltf decoded{ .importer = Pointer<TinyGltfImporter>{Corrade::InPlaceInit, pluginManager},
+                         .path     = std::string{filepath} };
+    decode_gltf(decoded);
 
-    // Create Importer resource
-    ResId const res = rResources.create(restypes::gc_importer, pkg, SharedString::create(filepath));
-    TinyGltfImporter importer{pluginManager};
+    return register_decoded_gltf(decoded, rResources, pkg);
+}
 
-    importer.openFile(filepath);
+std::vector<ResId> osp::load_tinygltf_files(std::vector<std::string_view> const& filepaths, Resources &rResources, PkgId pkg)
+{
+    PluginManager pluginManager;
 
-    if (!importer.isOpened() || importer.defaultScene() == -1)
+    // Importer plugin instantiation isn't known to be thread-safe; construct serially
+    std::vector<DecodedGltf> decoded;
+    decoded.reserve(filepaths.size());
+    for (std::string_view const filepath : filepaths)
     {
-        // TODO: delete resource (not yet implemented)
-        OSP_LOG_ERROR("Could not open file {}", filepath);
-        return lgrn::id_null<ResId>();
+        decoded.push_back({ .importer = Pointer<TinyGltfImporter>{Corrade::InPlaceInit, pluginManager},
+                            .path     = std::string{filepath} });
     }
 
-    load_gltf(importer, res, filepath, rResources, pkg);
+    // Parse and decode files in parallel; separate importer instances are independent
+    std::size_t const workerCount = std::min({
+            std::size_t(std::thread::hardware_concurrency()),
+            decoded.size()});
 
-    importer.close();
+    if (workerCount <= 1)
+    {
+        for (DecodedGltf &rDecoded : decoded)
+        {
+            decode_gltf(rDecoded);
+        }
+    }
+    else
+    {
+        std::atomic<std::size_t> nextFile{0};
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        for (std::size_t w = 0; w < workerCount; ++w)
+        {
+            workers.emplace_back([&decoded, &nextFile] ()
+            {
+                for (std::size_t i = nextFile.fetch_add(1); i < decoded.size();
+                     i = nextFile.fetch_add(1))
+                {
+                    decode_gltf(decoded[i]);
+                }
+            });
+        }
+        for (std::thread &rWorker : workers)
+        {
+            rWorker.join();
+        }
+    }
 
-    return res;
+    // Registration into Resources is not thread-safe; serialize it in input order
+    std::vector<ResId> out;
+    out.reserve(decoded.size());
+    for (DecodedGltf &rDecoded : decoded)
+    {
+        out.push_back(register_decoded_gltf(rDecoded, rResources, pkg));
+    }
+
+    return out;
 }
 
 static EShape shape_from_name(std::string_view name) noexcept
@@ -467,4 +703,8 @@ void osp::assigns_prefabs_tinygltf(Resources &rResources, ResId importer)
         prefabObjs.clear();
         prefabParents.clear();
     }
+
+    // Flatten into per-prefab instantiation recipes for SysPrefabInit
+    rResources.data_add<PrefabRecipes>(restypes::gc_importer, importer,
+                                       make_prefab_recipes(*pImportData, rPrefabs));
 }
@@ -27,6 +27,7 @@
 #include "../core/resourcetypes.h"
 
 #include <string_view>
+#include <vector>
 
 namespace osp
 {
@@ -34,6 +35,17 @@ namespace osp
 void register_tinygltf_resources(Resources &rResources);
 ResId load_tinygltf_file(std::string_view filepath, Resources &rResources, PkgId pkg);
 
+/**
+ * @brief Load multiple glTF files, decoding them in parallel on worker threads
+ *
+ * File parse and image decode of separate files are independent, so they run on a worker
+ * pool; registration into \p rResources is not thread-safe and stays serialized afterwards,
+ * in \p filepaths order.
+ *
+ * @return One ResId per input file, id_null for files that failed to open
+ */
+std::vector<ResId> load_tinygltf_files(std::vector<std::string_view> const& filepaths, Resources &rResources, PkgId pkg);
+
 /**
  * @brief Assign prefabs (potentially Parts) and add physical properties to an
  *        ImporterData loaded from tinygltf
@@ -0,0 +1,327 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "mesh_lod.h"
+
+#include "../core/Resources.h"
+
+#include <Magnum/Math/Matrix3.h>
+#include <Magnum/Math/Vector2.h>
+#include <Magnum/Math/Vector3.h>
+#include <Magnum/Mesh.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace osp;
+
+using Corrade::Containers::Array;
+using Corrade::Containers::ArrayView;
+using Corrade::Containers::Optional;
+
+using Magnum::Trade::MeshData;
+
+using Magnum::Matrix3x3;
+using Magnum::Vector2;
+using Magnum::Vector3;
+using Magnum::Vector3i;
+using Magnum::UnsignedInt;
+
+// Grid resolution per LOD level, finest first; triangle counts fall roughly with the square
+static constexpr std::array<int, MeshLods::smc_maxLevels> sc_lodGridCells {28, 10};
+
+// Meshes below this many triangles aren't worth a chain at all
+static constexpr std::size_t sc_minTriangles = 256;
+
+namespace
+{
+
+// Per-cluster accumulation state for one grid cell
+struct Cluster
+{
+    Matrix3x3   quadricA    {Magnum::Math::ZeroInit};
+    Vector3     quadricB    {0.0f};
+    Vector3     posSum      {0.0f};
+    Vector3     nrmSum      {0.0f};
+    Vector2     texCoord    {0.0f};
+    Vector3i    cell;
+    UnsignedInt vertexCount {0};
+    bool        texCoordSet {false};
+};
+
+} // namespace
+
+// Simplify one mesh onto a cells³ grid; empty when the result wouldn't be meaningfully smaller
+static Optional<MeshData> cluster_simplify(MeshData const& mesh, int const cells)
+{
+    using Magnum::MeshPrimitive;
+    using Magnum::Trade::MeshAttribute;
+
+    if (mesh.primitive() != MeshPrimitive::Triangles || ! mesh.isIndexed())
+    {
+        return {};
+    }
+
+    Array<UnsignedInt> const indices    = mesh.indicesAsArray();
+    Array<Vector3> const     positions  = mesh.positions3DAsArray();
+
+    bool const hasNormals   = mesh.hasAttribute(MeshAttribute::Normal);
+    bool const hasTexCoords = mesh.hasAttribute(MeshAttribute::TextureCoordinates);
+
+    Array<Vector3> const normals   = hasNormals   ? mesh.normalsAsArray()
+                                                  : Array<Vector3>{};
+    Array<Vector2> const texCoords = hasTexCoords ? mesh.textureCoordinates2DAsArray()
+                                                  : Array<Vector2>{};
+
+    Vector3 bbMin{ std::numeric_limits<float>::max()};
+    Vector3 bbMax{-std::numeric_limits<float>::max()};
+    for (Vector3 const& pos : positions)
+    {
+        bbMin = Magnum::Math::min(bbMin, pos);
+        bbMax = Magnum::Math::max(bbMax, pos);
+    }
+
+    float const cellSize = (bbMax - bbMin).max() / float(cells);
+    if ( ! (cellSize > 0.0f))
+    {
+        return {}; // Degenerate bounds
+    }
+
+    // Assign each vertex to the cluster of its grid cell
+    std::unordered_map<std::uint32_t, std::uint32_t> cellToCluster;
+    std::vector<std::uint32_t>  vertCluster(positions.size());
+    std::vector<Cluster>        clusters;
+
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        Vector3i const cell = Magnum::Math::clamp(
+                Vector3i{(positions[i] - bbMin) / cellSize}, Vector3i{0}, Vector3i{cells - 1});
+
+        std::uint32_t const key = std::uint32_t(cell.x())
+                                | (std::uint32_t(cell.y()) << 10)
+                                | (std::uint32_t(cell.z()) << 20);
+
+        auto const [it, added] = cellToCluster.try_emplace(key, std::uint32_t(clusters.size()));
+        if (added)
+        {
+            clusters.push_back({.cell = cell});
+        }
+
+        std::uint32_t const clusterIdx = it->second;
+        vertCluster[i] = clusterIdx;
+
+        Cluster &rCluster = clusters[clusterIdx];
+        rCluster.posSum += positions[i];
+        rCluster.vertexCount ++;
+        if (hasNormals)
+        {
+            rCluster.nrmSum += normals[i];
+        }
+        if (hasTexCoords && ! rCluster.texCoordSet)
+        {
+            rCluster.texCoord    = texCoords[i];
+            rCluster.texCoordSet = true;
+        }
+    }
+
+    // Accumulate each triangle's area-weighted plane quadric into its corner clusters, and
+    // remap the index list, dropping triangles that collapse
+    std::vector<UnsignedInt> outIndices;
+    outIndices.reserve(indices.size());
+
+    for (std::size_t tri = 0; tri < indices.size() / 3; ++tri)
+    {
+        UnsignedInt const i0 = indices[tri * 3 + 0];
+        UnsignedInt const i1 = indices[tri * 3 + 1];
+        UnsignedInt const i2 = indices[tri * 3 + 2];
+
+        Vector3 const crossV = Magnum::Math::cross(positions[i1] - positions[i0],
+                                                   positions[i2] - positions[i0]);
+        float const area2 = crossV.length();
+        if (area2 > 1.0e-12f)
+        {
+            Vector3 const normal = crossV / area2;
+            float const   weight = 0.5f * area2; // Triangle area
+            float const   planeD = -Magnum::Math::dot(normal, positions[i0]);
+
+            Matrix3x3 const outer{normal * normal.x(), normal * normal.y(),
+                                  normal * normal.z()};
+
+            for (UnsignedInt const corner : {i0, i1, i2})
+            {
+                Cluster &rCluster = clusters[vertCluster[corner]];
+                rCluster.quadricA += outer * weight;
+                rCluster.quadricB += normal * (planeD * weight);
+            }
+        }
+
+        std::uint32_t const c0 = vertCluster[i0];
+        std::uint32_t const c1 = vertCluster[i1];
+        std::uint32_t const c2 = vertCluster[i2];
+        if (c0 != c1 && c1 != c2 && c2 != c0)
+        {
+            outIndices.insert(outIndices.end(), {c0, c1, c2});
+        }
+    }
+
+    // Not worth a separate GPU mesh unless a good chunk of the triangles went away
+    if (outIndices.empty() || outIndices.size() * 4 >= indices.size() * 3)
+    {
+        return {};
+    }
+
+    // Place each cluster's vertex at the quadric error minimum, falling back to the plain
+    // average when the quadric is rank-deficient (flat or colinear neighborhoods) or the
+    // minimum shoots outside the cell
+    auto const vertexCount = UnsignedInt(clusters.size());
+
+    std::size_t const nrmOffset = sizeof(Vector3);
+    std::size_t const texOffset = nrmOffset + (hasNormals   ? sizeof(Vector3) : 0);
+    std::size_t const stride    = texOffset + (hasTexCoords ? sizeof(Vector2) : 0);
+
+    Array<char> vertexData{Corrade::NoInit, stride * vertexCount};
+
+    for (std::size_t i = 0; i < clusters.size(); ++i)
+    {
+        Cluster const &cluster = clusters[i];
+
+        Vector3 const average = cluster.posSum / float(cluster.vertexCount);
+        Vector3 pos = average;
+
+        float const trace = cluster.quadricA[0].x() + cluster.quadricA[1].y()
+                          + cluster.quadricA[2].z();
+        if (trace > 0.0f)
+        {
+            // Tikhonov term keeps the solve well-conditioned; it biases gently toward the
+            // origin of the regularized system, which the cell-bounds check below guards
+            Matrix3x3 const reg = cluster.quadricA + Matrix3x3{} * (1.0e-3f * trace);
+
+            Vector3 const solved = reg.inverted() * (-cluster.quadricB);
+
+            Vector3 const cellMin = bbMin + Vector3{cluster.cell} * cellSize
+                                  - Vector3{0.5f * cellSize};
+            Vector3 const cellMax = cellMin + Vector3{2.0f * cellSize};
+
+            if (   (solved >= cellMin).all() && (solved <= cellMax).all())
+            {
+                pos = solved;
+            }
+        }
+
+        char *pVertex = vertexData.data() + i * stride;
+        std::memcpy(pVertex, &pos, sizeof(Vector3));
+
+        if (hasNormals)
+        {
+            float const len = cluster.nrmSum.length();
+            Vector3 const normal = (len > 1.0e-12f) ? (cluster.nrmSum / len)
+                                                    : Vector3::zAxis();
+            std::memcpy(pVertex + nrmOffset, &normal, sizeof(Vector3));
+        }
+        if (hasTexCoords)
+        {
+            std::memcpy(pVertex + texOffset, &cluster.texCoord, sizeof(Vector2));
+        }
+    }
+
+    Array<char> indexData{Corrade::NoInit, outIndices.size() * sizeof(UnsignedInt)};
+    std::memcpy(indexData.data(), outIndices.data(), indexData.size());
+
+    Array<Magnum::Trade::MeshAttributeData> attributes{
+            std::size_t(1) + hasNormals + hasTexCoords};
+    std::size_t attr = 0;
+    attributes[attr++] = Magnum::Trade::MeshAttributeData{
+            MeshAttribute::Position, Magnum::VertexFormat::Vector3,
+            0, vertexCount, std::ptrdiff_t(stride)};
+    if (hasNormals)
+    {
+        attributes[attr++] = Magnum::Trade::MeshAttributeData{
+                MeshAttribute::Normal, Magnum::VertexFormat::Vector3,
+                nrmOffset, vertexCount, std::ptrdiff_t(stride)};
+    }
+    if (hasTexCoords)
+    {
+        attributes[attr++] = Magnum::Trade::MeshAttributeData{
+                MeshAttribute::TextureCoordinates, Magnum::VertexFormat::Vector2,
+                texOffset, vertexCount, std::ptrdiff_t(stride)};
+    }
+
+    Magnum::Trade::MeshIndexData const indexView{
+            Magnum::MeshIndexType::UnsignedInt, ArrayView<void const>{indexData}};
+
+    return MeshData{MeshPrimitive::Triangles,
+                    std::move(indexData), indexView,
+                    std::move(vertexData), std::move(attributes), vertexCount};
+}
+
+MeshLodChain_t osp::simplify_mesh_lods(MeshData const& mesh)
+{
+    MeshLodChain_t out;
+
+    if ( ! mesh.isIndexed() || (mesh.indexCount() / 3) < sc_minTriangles)
+    {
+        return out;
+    }
+
+    for (std::size_t lvl = 0; lvl < MeshLods::smc_maxLevels; ++lvl)
+    {
+        out[lvl] = cluster_simplify(mesh, sc_lodGridCells[lvl]);
+    }
+
+    return out;
+}
+
+void osp::register_mesh_lods(Resources &rResources, PkgId const pkg, ResId const meshRes, MeshLodChain_t &&chain)
+{
+    using namespace restypes;
+
+    if (std::none_of(chain.begin(), chain.end(),
+                     [] (auto const& level) { return bool(level); }))
+    {
+        return;
+    }
+
+    SharedString const baseName = rResources.name(gc_mesh, meshRes);
+
+    MeshLods lods;
+    for (std::size_t lvl = 0; lvl < MeshLods::smc_maxLevels; ++lvl)
+    {
+        if ( ! bool(chain[lvl]))
+        {
+            continue;
+        }
+
+        ResId const lodRes = rResources.create(gc_mesh, pkg,
+                SharedString::create_from_parts(baseName, ":lod", std::to_string(lvl + 1)));
+        rResources.data_add<MeshData>(gc_mesh, lodRes, std::move(*chain[lvl]));
+        rResources.load_state_set(gc_mesh, lodRes, EResLoadState::Resident);
+        lods.m_levels[lvl] = rResources.owner_create(gc_mesh, lodRes);
+    }
+
+    rResources.data_add<MeshLods>(gc_mesh, meshRes, std::move(lods));
+}
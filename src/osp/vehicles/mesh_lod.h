@@ -0,0 +1,64 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "../core/resourcetypes.h"
+#include "../drawing/own_restypes.h"
+
+#include <Magnum/Trade/MeshData.h>
+
+#include <Corrade/Containers/Optional.h>
+
+#include <array>
+
+namespace osp
+{
+
+using MeshLodChain_t = std::array<Corrade::Containers::Optional<Magnum::Trade::MeshData>,
+                                  MeshLods::smc_maxLevels>;
+
+/**
+ * @brief Generate simplified LOD levels of a mesh by quadric-error vertex clustering
+ *
+ * Vertices are clustered on a uniform grid and each cluster collapses to the position
+ * minimizing the summed quadric error of its incident triangle planes, which keeps flat
+ * regions flat and preserves sharp silhouettes far better than plain averaging. Normals
+ * and texture coordinates carry over so the simplified meshes draw through the same
+ * shaders. Safe to call from worker threads; touches no shared state.
+ *
+ * A level is left empty when the mesh is already small, is not indexed triangles, or
+ * clustering failed to meaningfully reduce it.
+ */
+MeshLodChain_t simplify_mesh_lods(Magnum::Trade::MeshData const& mesh);
+
+/**
+ * @brief Store generated LOD levels as gc_mesh resources attached to their full mesh
+ *
+ * Levels are named "<base>:lod1", "<base>:lod2", ... and recorded in a MeshLods entry on
+ * \p meshRes. Does nothing when every level of \p chain is empty.
+ */
+void register_mesh_lods(Resources &rResources, PkgId pkg, ResId meshRes, MeshLodChain_t &&chain);
+
+} // namespace osp
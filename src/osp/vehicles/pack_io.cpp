@@ -0,0 +1,102 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pack_io.h"
+
+#include <fstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OSP_PACK_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace osp
+{
+
+PackFileView::~PackFileView()
+{
+#ifdef OSP_PACK_MMAP
+    if (m_map != nullptr)
+    {
+        ::munmap(m_map, m_mapSize);
+    }
+#endif
+}
+
+bool PackFileView::open(std::string_view const filepath)
+{
+    std::string const path{filepath};
+
+#ifdef OSP_PACK_MMAP
+    if (int const fd = ::open(path.c_str(), O_RDONLY);
+        fd != -1)
+    {
+        struct stat fileStat{};
+        if (::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            void *pData = ::mmap(nullptr, std::size_t(fileStat.st_size),
+                                 PROT_READ, MAP_PRIVATE, fd, 0);
+            if (pData != MAP_FAILED)
+            {
+                m_map     = pData;
+                m_mapSize = std::size_t(fileStat.st_size);
+            }
+        }
+        ::close(fd);
+    }
+#endif
+
+    if (m_map == nullptr)
+    {
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        if ( ! file.is_open())
+        {
+            return false;
+        }
+        m_fallback.resize(std::size_t(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(m_fallback.data()),
+                  std::streamsize(m_fallback.size()));
+        if ( ! file.good())
+        {
+            m_fallback.clear();
+            return false;
+        }
+    }
+
+    return data().size() != 0;
+}
+
+ArrayView<unsigned char const> PackFileView::data() const noexcept
+{
+    return (m_map != nullptr)
+         ? arrayView(static_cast<unsigned char const*>(m_map), m_mapSize)
+         : arrayView(m_fallback.data(), m_fallback.size());
+}
+
+} // namespace osp
@@ -0,0 +1,286 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "../core/array_view.h"
+
+#include <longeron/containers/intarray_multimap.hpp>
+#include <longeron/id_management/registry_stl.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace osp
+{
+
+// Pack files store host-endian data; they are a per-machine cache, not a distribution format.
+// Each format prepends its own magic/version; everything below is format-agnostic plumbing
+// shared by asset packs (asset_pack.cpp) and vehicle blueprints (vehicle_blueprint.cpp).
+
+constexpr std::size_t gc_packBlobAlign = 8;
+
+struct PackWriter
+{
+    template<typename T>
+    void write(T const value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto const *pBytes = reinterpret_cast<unsigned char const*>(&value);
+        out.insert(out.end(), pBytes, pBytes + sizeof(T));
+    }
+
+    void write_string(std::string_view const str)
+    {
+        write(std::uint32_t(str.size()));
+        out.insert(out.end(), str.begin(), str.end());
+    }
+
+    void write_blob(void const* pData, std::size_t const size)
+    {
+        out.resize((out.size() + gc_packBlobAlign - 1) / gc_packBlobAlign * gc_packBlobAlign, 0);
+        write(std::uint64_t(size));
+        auto const *pBytes = reinterpret_cast<unsigned char const*>(pData);
+        out.insert(out.end(), pBytes, pBytes + size);
+    }
+
+    std::vector<unsigned char> out;
+};
+
+/**
+ * @brief Bounds-checked sequential reader; any out-of-range read sets fail and returns empty
+ */
+struct PackReader
+{
+    template<typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value{};
+        if (pos + sizeof(T) > data.size())
+        {
+            fail = true;
+            return value;
+        }
+        std::memcpy(&value, data.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    std::string_view read_string()
+    {
+        auto const size = std::size_t(read<std::uint32_t>());
+        if (fail || pos + size > data.size())
+        {
+            fail = true;
+            return {};
+        }
+        auto const view = std::string_view{reinterpret_cast<char const*>(data.data() + pos), size};
+        pos += size;
+        return view;
+    }
+
+    ArrayView<unsigned char const> read_blob()
+    {
+        pos = (pos + gc_packBlobAlign - 1) / gc_packBlobAlign * gc_packBlobAlign;
+        auto const size = std::size_t(read<std::uint64_t>());
+        if (fail || pos + size > data.size())
+        {
+            fail = true;
+            return {};
+        }
+        auto const view = arrayView(data.data() + pos, size);
+        pos += size;
+        return view;
+    }
+
+    ArrayView<unsigned char const>  data;
+    std::size_t                     pos{0};
+    bool                            fail{false};
+};
+
+//-----------------------------------------------------------------------------
+
+// Helpers for the array-shaped containers most pack formats are built out of; tables and
+// multimaps are stored as raw blobs, so saving costs a memcpy per section.
+
+template<typename T>
+void write_table(PackWriter &rWriter, T const* pData, std::size_t const count)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    static unsigned char const sc_none{};
+    rWriter.write_blob((count != 0) ? static_cast<void const*>(pData)
+                                    : static_cast<void const*>(&sc_none),
+                       count * sizeof(T));
+}
+
+template<typename T>
+bool read_table(PackReader &rReader, T *pOut, std::size_t const count)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto const blob = rReader.read_blob();
+    if (rReader.fail || blob.size() != count * sizeof(T))
+    {
+        rReader.fail = true;
+        return false;
+    }
+    if (count != 0)
+    {
+        std::memcpy(pOut, blob.data(), blob.size());
+    }
+    return true;
+}
+
+template<typename T>
+bool read_vector(PackReader &rReader, std::vector<T> &rOut)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto const blob = rReader.read_blob();
+    if (rReader.fail || (blob.size() % sizeof(T)) != 0)
+    {
+        rReader.fail = true;
+        return false;
+    }
+    rOut.resize(blob.size() / sizeof(T));
+    if ( ! rOut.empty())
+    {
+        std::memcpy(rOut.data(), blob.data(), blob.size());
+    }
+    return true;
+}
+
+/**
+ * @brief Number of existing ids in a registry
+ */
+template<typename REG_T>
+std::uint32_t registry_count(REG_T const& reg)
+{
+    std::uint32_t count = 0;
+    for ([[maybe_unused]] auto const id : reg.bitview().zeros())
+    {
+        ++count;
+    }
+    return count;
+}
+
+/**
+ * @brief Fill a fresh registry with dense ids [0, count); they are handed out in order
+ */
+template<typename ID_T>
+void registry_create_dense(lgrn::IdRegistryStl<ID_T> &rReg, std::uint32_t const count)
+{
+    std::vector<ID_T> ids(count);
+    rReg.create(ids.begin(), ids.end());
+}
+
+template<typename ID_T, typename T>
+void write_multimap(PackWriter &rWriter, lgrn::IntArrayMultiMap<ID_T, T> const& map,
+                    std::uint32_t const idCount)
+{
+    std::vector<std::uint32_t> counts(idCount, 0);
+    std::vector<T> flat;
+    for (std::uint32_t id = 0; id < idCount; ++id)
+    {
+        if (map.contains(ID_T(id)))
+        {
+            auto const span = map[ID_T(id)];
+            counts[id] = std::uint32_t(span.size());
+            flat.insert(flat.end(), span.begin(), span.end());
+        }
+    }
+    write_table(rWriter, counts.data(), counts.size());
+    write_table(rWriter, flat.data(), flat.size());
+}
+
+template<typename ID_T, typename T>
+bool read_multimap(PackReader &rReader, lgrn::IntArrayMultiMap<ID_T, T> &rMap,
+                   std::uint32_t const idCount)
+{
+    std::vector<std::uint32_t> counts(idCount);
+    if ( ! read_table(rReader, counts.data(), idCount))
+    {
+        return false;
+    }
+
+    std::size_t total = 0;
+    for (std::uint32_t const count : counts)
+    {
+        total += count;
+    }
+
+    auto const blob = rReader.read_blob();
+    if (rReader.fail || blob.size() != total * sizeof(T))
+    {
+        rReader.fail = true;
+        return false;
+    }
+
+    rMap.ids_reserve(idCount);
+    rMap.data_reserve(total);
+    std::size_t offset = 0;
+    for (std::uint32_t id = 0; id < idCount; ++id)
+    {
+        if (counts[id] != 0)
+        {
+            T *pData = rMap.emplace(ID_T(id), counts[id]);
+            std::memcpy(pData, blob.data() + offset, counts[id] * sizeof(T));
+            offset += counts[id] * sizeof(T);
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Read-only view of a pack file; memory-mapped on POSIX platforms
+ *
+ * Performs no format validation itself; callers check their own magic against data().
+ * Anything referenced in-place out of data() must not outlive this view.
+ */
+class PackFileView
+{
+public:
+    PackFileView() = default;
+    PackFileView(PackFileView const&) = delete;
+    PackFileView& operator=(PackFileView const&) = delete;
+    ~PackFileView();
+
+    /**
+     * @return false if the file is missing, empty, or unreadable
+     */
+    bool open(std::string_view filepath);
+
+    [[nodiscard]] ArrayView<unsigned char const> data() const noexcept;
+
+private:
+    void                        *m_map{nullptr};   ///< mmap base; null when using m_fallback
+    std::size_t                 m_mapSize{0};
+    std::vector<unsigned char>  m_fallback;        ///< Owned copy on platforms without mmap
+};
+
+} // namespace osp
@@ -29,6 +29,7 @@
 #include <osp/activescene/basic.h>
 #include <osp/core/id_map.h>
 #include <osp/core/bitvector.h>
+#include <osp/scientific/shapes.h>
 
 #include <Newton.h>
 
@@ -36,6 +37,8 @@
 
 #include <entt/core/any.hpp>
 
+#include <thread>
+
 
 namespace ospnewton
 {
@@ -58,6 +61,9 @@ using NwtColliderPtr_t = std::unique_ptr<NewtonCollision, NwtDeleter<NewtonDestr
 
 using BodyId = uint32_t;
 
+/// Newton material group ID, created with SysNewton::material_create
+using NwtMatId = int;
+
 using ColliderStorage_t = osp::Storage_t<osp::active::ActiveEnt, NwtColliderPtr_t>;
 
 /**
@@ -69,23 +75,71 @@ struct ACtxNwtWorld
     struct ForceFactorFunc
     {
         using UserData_t = std::array<void*, 6u>;
-        using Func_t = void (*)(NewtonBody const* pBody, BodyId BodyId, ACtxNwtWorld const&, UserData_t, osp::Vector3&, osp::Vector3&) noexcept;
+
+        /**
+         * Called once per frame by SysNewton::update_world. Sweeps every body the factor
+         * is assigned to (bit \p factorIdx of m_bodyFactors) in one pass and accumulates
+         * into m_bodyForce and m_bodyTorque.
+         */
+        using Func_t = void (*)(ACtxNwtWorld& rCtxWorld, std::size_t factorIdx, UserData_t) noexcept;
 
         Func_t      m_func;
         UserData_t  m_userData;
     };
 
+    /**
+     * Contact response parameters for one pair of material classes, applied with
+     * SysNewton::material_set_pair. Friction and restitution resolve inside Newton;
+     * only pairs with notify set run any OSP code on the contact path.
+     */
+    struct ContactMaterial
+    {
+        float   staticFriction  {0.9f};
+        float   kineticFriction {0.5f};
+        float   restitution     {0.4f};
+        bool    notify          {false};
+    };
+
+    /**
+     * One contact joint between bodies of a notify material pair, recorded during the
+     * solve and delivered in m_contactEvents. Entities are null for bodies with no
+     * associated entity, like the static terrain body.
+     */
+    struct ContactEvent
+    {
+        osp::active::ActiveEnt  entA;
+        osp::active::ActiveEnt  entB;
+        osp::Vector3            position;
+        osp::Vector3            normal;
+        float                   normalSpeed;
+    };
+
     struct Deleter
     {
         void operator() (NewtonWorld* pNwtWorld) { NewtonDestroy(pNwtWorld); }
     };
 
+    /**
+     * Newton solves contact islands on its own worker threads; threadCount <= 0
+     * uses all hardware threads.
+     */
     ACtxNwtWorld(int threadCount)
      : m_world(NewtonCreate())
     {
         NewtonWorldSetUserData(m_world.get(), this);
+        NewtonSetThreadsCount(m_world.get(), (threadCount > 0)
+                ? threadCount
+                : int(std::thread::hardware_concurrency()));
+        m_perThreadMoved   .resize(std::size_t(NewtonGetThreadsCount(m_world.get())));
+        m_perThreadContacts.resize(std::size_t(NewtonGetThreadsCount(m_world.get())));
     }
 
+    struct MovedBody
+    {
+        osp::Matrix4    m_tf;
+        BodyId          m_body;
+    };
+
     // note: important that m_nwtBodies and m_nwtColliders are destructed
     //       before m_nwtWorld
     std::unique_ptr<NewtonWorld, Deleter>           m_world;
@@ -95,6 +149,50 @@ struct ACtxNwtWorld
     std::vector<ForceFactors_t>                     m_bodyFactors;
     osp::BitVector_t                                m_bodyDirty;
 
+    // Bodies currently in continuous collision mode, toggled per-body by
+    // update_world against ACtxPhysics::m_ccdSpeedThreshold; tracked here so
+    // unchanged bodies cost no Newton call
+    osp::BitVector_t                                m_bodyCcd;
+
+    // Force and torque accumulated once per frame by SysNewton::update_world,
+    // only read by cb_force_torque during the solve
+    std::vector<osp::Vector3>                       m_bodyForce;
+    std::vector<osp::Vector3>                       m_bodyTorque;
+
+    // Previous frame's accumulators, swapped in by update_world. Sleeping bodies skip
+    // cb_force_torque, so update_world wakes a body when its applied force changes;
+    // steady forces like gravity reproduce exactly each frame and don't disturb sleep
+    std::vector<osp::Vector3>                       m_bodyForcePrev;
+    std::vector<osp::Vector3>                       m_bodyTorquePrev;
+
+    // Fixed-timestep state. update_world steps the world in m_stepSize
+    // increments and writes transforms interpolated between the last two
+    // steps, so simulation rate is independent of frame rate
+    float                                           m_stepSize{1.0f / 60.0f};
+    float                                           m_stepAccumulator{0.0f};
+    std::vector<osp::Matrix4>                       m_bodyTfPrev;
+    std::vector<osp::Matrix4>                       m_bodyTfCurr;
+    osp::BitVector_t                                m_bodySnapshot;
+
+    // Transforms of bodies Newton moved during a step, one buffer per Newton
+    // worker thread. cb_set_transform appends to its own thread's buffer with
+    // no synchronization; update_world drains all buffers into m_bodyTfCurr
+    // and m_bodyDirty in one sequential merge pass after each step
+    std::vector< std::vector<MovedBody> >           m_perThreadMoved;
+
+    // Contact response table per material class pair, keyed by
+    // SysNewton::material_set_pair; kept for introspection since Newton holds
+    // the working copy
+    osp::IdMap_t<std::uint32_t, ContactMaterial>    m_matPairs;
+
+    // Contacts between notify material pairs, staged per worker thread by
+    // cb_contact_process and merged into m_contactEvents by update_world
+    std::vector< std::vector<ContactEvent> >        m_perThreadContacts;
+
+    // Batched contact events from the most recent update_world; read by
+    // gameplay tasks after the physics update, overwritten next update
+    std::vector<ContactEvent>                       m_contactEvents;
+
     std::vector<osp::active::ActiveEnt>             m_bodyToEnt;
     osp::IdMap_t<osp::active::ActiveEnt, BodyId>    m_entToBody;
 
@@ -102,7 +200,14 @@ struct ACtxNwtWorld
 
     ColliderStorage_t                               m_colliders;
 
-    osp::active::ACompTransformStorage_t            *m_pTransform;
+    // Compound sub-collision node handles returned when each entity's collider was added to
+    // its body's compound; lets SysNewton::compound_remove_collider detach one part without
+    // rebuilding the whole compound
+    osp::IdMap_t<osp::active::ActiveEnt, void*>     m_entToSubCollision;
+
+    // Canonical unit primitives shared by all collider instances of the same
+    // shape; create_primative hands out NewtonCollisionCreateInstance copies
+    std::array<NwtColliderPtr_t, std::size_t(osp::EShape::Cylinder) + 1> m_shapePrimitives;
 };
 
 
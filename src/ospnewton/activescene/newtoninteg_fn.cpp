@@ -29,8 +29,11 @@
 
 #include <Newton.h>                  // for NewtonBodySetCollision
 
+#include <algorithm>                 // for std::fill
 #include <utility>                   // for std::exchange
 #include <cassert>                   // for assert
+#include <cstdint>                   // for std::uint64_t
+#include <cstring>                   // for std::memcpy
 
 // IWYU pragma: no_include <cstddef>
 // IWYU pragma: no_include <type_traits>
@@ -48,6 +51,7 @@ using osp::active::SysSceneGraph;
 
 using osp::Matrix3;
 using osp::Matrix4;
+using osp::Quaternion;
 using osp::Vector3;
 
 
@@ -58,19 +62,9 @@ void SysNewton::cb_force_torque(
     ACtxNwtWorld &rWorldCtx = SysNewton::context_from_nwtbody(pBody);
     BodyId const bodyId     = SysNewton::get_userdata_bodyid(pBody);
 
-    Vector3 force{0.0f};
-    Vector3 torque{0.0f};
-
-    auto factorBits = lgrn::bit_view(rWorldCtx.m_bodyFactors[bodyId]);
-    for (std::size_t const factorIdx : factorBits.ones())
-    {
-        ACtxNwtWorld::ForceFactorFunc const& factor = rWorldCtx.m_factors[factorIdx];
-
-        factor.m_func(pBody, bodyId, rWorldCtx, factor.m_userData, force, torque);
-    }
-
-    NewtonBodySetForce(pBody, force.data());
-    NewtonBodySetTorque(pBody, torque.data());
+    // Factors already ran in update_world; just read the accumulators
+    NewtonBodySetForce (pBody, rWorldCtx.m_bodyForce [bodyId].data());
+    NewtonBodySetTorque(pBody, rWorldCtx.m_bodyTorque[bodyId].data());
 } // cb_force_torque()
 
 void SysNewton::cb_set_transform(
@@ -79,11 +73,56 @@ void SysNewton::cb_set_transform(
     ACtxNwtWorld &rWorldCtx = SysNewton::context_from_nwtbody(pBody);
     BodyId const bodyId     = SysNewton::get_userdata_bodyid(pBody);
 
-    ActiveEnt const ent = rWorldCtx.m_bodyToEnt[bodyId];
-
-    NewtonBodyGetMatrix(pBody, rWorldCtx.m_pTransform->get(ent).m_transform.data());
+    // This callback runs on Newton's worker threads; each thread appends to
+    // its own buffer only. update_world merges the buffers single-threaded.
+    rWorldCtx.m_perThreadMoved[thread].push_back(
+            { Matrix4::from(pMatrix), bodyId });
 } // cb_set_transform()
 
+// Contact processing for notify material pairs only; all other pairs resolve inside
+// Newton with no callback at all. Runs on Newton's worker threads, so events are staged
+// per-thread like cb_set_transform's buffers and merged by update_world.
+void SysNewton::cb_contact_process(
+        NewtonJoint const* pContactJoint, dFloat const timestep, NwtThreadIndex_t const thread)
+{
+    NewtonBody const* pBody0 = NewtonJointGetBody0(pContactJoint);
+    NewtonBody const* pBody1 = NewtonJointGetBody1(pContactJoint);
+
+    ACtxNwtWorld &rWorldCtx = SysNewton::context_from_nwtbody(pBody0);
+
+    void *pContact = NewtonContactJointGetFirstContact(pContactJoint);
+    if (pContact == nullptr)
+    {
+        return;
+    }
+
+    // One event per contact joint: first contact's position and normal, max approach
+    // speed across the patch. Enough for touchdown detection without flooding the batch.
+    NewtonMaterial *pMaterial = NewtonContactGetMaterial(pContact);
+
+    Vector3 position;
+    Vector3 normal;
+    NewtonMaterialGetContactPositionAndNormal(pMaterial, pBody0, position.data(), normal.data());
+
+    float normalSpeed = NewtonMaterialGetContactNormalSpeed(pMaterial);
+
+    for (pContact = NewtonContactJointGetNextContact(pContactJoint, pContact);
+         pContact != nullptr;
+         pContact = NewtonContactJointGetNextContact(pContactJoint, pContact))
+    {
+        normalSpeed = std::max(normalSpeed, NewtonMaterialGetContactNormalSpeed(
+                                                NewtonContactGetMaterial(pContact)));
+    }
+
+    rWorldCtx.m_perThreadContacts[thread].push_back({
+        .entA        = rWorldCtx.m_bodyToEnt[SysNewton::get_userdata_bodyid(pBody0)],
+        .entB        = rWorldCtx.m_bodyToEnt[SysNewton::get_userdata_bodyid(pBody1)],
+        .position    = position,
+        .normal      = normal,
+        .normalSpeed = normalSpeed
+    });
+} // cb_contact_process()
+
 
 void SysNewton::resize_body_data(ACtxNwtWorld& rCtxWorld)
 {
@@ -91,32 +130,50 @@ void SysNewton::resize_body_data(ACtxNwtWorld& rCtxWorld)
     rCtxWorld.m_bodyPtrs    .resize(capacity);
     rCtxWorld.m_bodyToEnt   .resize(capacity);
     rCtxWorld.m_bodyFactors .resize(capacity);
+    rCtxWorld.m_bodyForce      .resize(capacity);
+    rCtxWorld.m_bodyTorque     .resize(capacity);
+    rCtxWorld.m_bodyForcePrev  .resize(capacity);
+    rCtxWorld.m_bodyTorquePrev .resize(capacity);
+    rCtxWorld.m_bodyTfPrev  .resize(capacity);
+    rCtxWorld.m_bodyTfCurr  .resize(capacity);
+    osp::bitvector_resize(rCtxWorld.m_bodyDirty,    capacity);
+    osp::bitvector_resize(rCtxWorld.m_bodySnapshot, capacity);
+    osp::bitvector_resize(rCtxWorld.m_bodyCcd,      capacity);
 }
 
 NwtColliderPtr_t SysNewton::create_primative(
         ACtxNwtWorld&   rCtxWorld,
         EShape          shape)
 {
-    NewtonWorld* pNwtWorld = rCtxWorld.m_world.get();
-    NewtonCollision* pCollision;
-    switch (shape)
+    NwtColliderPtr_t &rPrimitive = rCtxWorld.m_shapePrimitives[std::size_t(shape)];
+
+    if (rPrimitive.get() == nullptr)
     {
-    case EShape::Sphere:
-        pCollision = NewtonCreateSphere(pNwtWorld, 1.0f, 0, nullptr);
-        break;
-    case EShape::Box:
-        pCollision = NewtonCreateBox(pNwtWorld, 2, 2, 2, 0, nullptr);
-        break;
-    case EShape::Cylinder:
-        pCollision = NewtonCreateCylinder(pNwtWorld, 1, 1, 2, 0, nullptr);
-        break;
-    default:
-        // TODO: support other shapes, sphere is used for now
-        pCollision = NewtonCreateSphere(pNwtWorld, 1.0f, 0, nullptr);
-        break;
+        NewtonWorld* pNwtWorld = rCtxWorld.m_world.get();
+        NewtonCollision* pCollision;
+        switch (shape)
+        {
+        case EShape::Sphere:
+            pCollision = NewtonCreateSphere(pNwtWorld, 1.0f, 0, nullptr);
+            break;
+        case EShape::Box:
+            pCollision = NewtonCreateBox(pNwtWorld, 2, 2, 2, 0, nullptr);
+            break;
+        case EShape::Cylinder:
+            pCollision = NewtonCreateCylinder(pNwtWorld, 1, 1, 2, 0, nullptr);
+            break;
+        default:
+            // TODO: support other shapes, sphere is used for now
+            pCollision = NewtonCreateSphere(pNwtWorld, 1.0f, 0, nullptr);
+            break;
+        }
+
+        rPrimitive.reset(pCollision);
     }
 
-    return NwtColliderPtr_t{pCollision};
+    // Instances share the cached primitive's geometry; the matrix and scale
+    // set per-entity by orient_collision are per-instance state
+    return NwtColliderPtr_t{ NewtonCollisionCreateInstance(rPrimitive.get()) };
 }
 
 void SysNewton::orient_collision(
@@ -146,23 +203,152 @@ void SysNewton::orient_collision(
     }
 }
 
-void SysNewton::update_translate(ACtxPhysics& rCtxPhys, ACtxNwtWorld& rCtxWorld) noexcept
+/**
+ * FNV-1a over the collider's shape and transform float bits. Only used to detect "didn't
+ * actually change" after wholesale invalidations, so bit-exactness is the right equality:
+ * a recomputed-but-identical transform hashes the same, any real change doesn't.
+ */
+static std::uint64_t collider_state_hash(EShape const shape, Matrix4 const& tf) noexcept
 {
-    NewtonWorld const* pNwtWorld = rCtxWorld.m_world.get();
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    auto const mix = [&hash] (std::uint64_t const value) noexcept
+    {
+        hash = (hash ^ value) * 0x100000001b3ull;
+    };
 
-    // Origin translation
-    if (Vector3 const translate = std::exchange(rCtxPhys.m_originTranslate, {});
-        ! translate.isZero())
+    mix(std::uint64_t(shape));
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, tf.data() + i, sizeof(bits));
+        mix(bits);
+    }
+    return hash;
+}
+
+void SysNewton::update_colliders(
+        ACtxPhysics&                    rCtxPhys,
+        ACtxNwtWorld&                   rCtxWorld,
+        ACompTransformStorage_t const&  rTf,
+        std::vector<ActiveEnt> const&   collidersDirty) noexcept
+{
+    if (rCtxPhys.m_colliderStamp.size() < rCtxPhys.m_hasColliders.size())
+    {
+        rCtxPhys.m_colliderStamp.resize(rCtxPhys.m_hasColliders.size(), 0);
+    }
+
+    for (ActiveEnt const ent : collidersDirty)
+    {
+        EShape const shape = rCtxPhys.m_shape[ent];
+
+        if (   (shape == EShape::None)
+            || ( ! rCtxWorld.m_colliders.contains(ent))
+            || ( ! rTf.contains(ent)) )
+        {
+            continue;
+        }
+
+        Matrix4 const &tf = rTf.get(ent).m_transform;
+
+        std::uint64_t const stamp = collider_state_hash(shape, tf);
+        if (rCtxPhys.m_colliderStamp[ent] == stamp)
+        {
+            continue; // Marked dirty but identical to what Newton already has
+        }
+        rCtxPhys.m_colliderStamp[ent] = stamp;
+
+        orient_collision(rCtxWorld.m_colliders.get(ent).get(), shape,
+                         tf.translation(), tf.rotation(), tf.scaling());
+    }
+}
+
+void SysNewton::body_wake(ACtxNwtWorld& rCtxWorld, BodyId const bodyId) noexcept
+{
+    if (NewtonBody const *pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+        pBody != nullptr)
     {
-        // Translate every newton body
-        for (NewtonBody const* pBody = NewtonWorldGetFirstBody(pNwtWorld);
-             pBody != nullptr; pBody = NewtonWorldGetNextBody(pNwtWorld, pBody))
+        NewtonBodySetSleepState(pBody, 0);
+    }
+}
+
+void SysNewton::body_sleep(ACtxNwtWorld& rCtxWorld, BodyId const bodyId) noexcept
+{
+    if (NewtonBody const *pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+        pBody != nullptr)
+    {
+        NewtonBodySetSleepState(pBody, 1);
+    }
+}
+
+void SysNewton::body_auto_sleep(ACtxNwtWorld& rCtxWorld, BodyId const bodyId, bool const enable) noexcept
+{
+    if (NewtonBody const *pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+        pBody != nullptr)
+    {
+        NewtonBodySetAutoSleep(pBody, enable ? 1 : 0);
+    }
+}
+
+void SysNewton::body_continuous_collision(ACtxNwtWorld& rCtxWorld, BodyId const bodyId, bool const enable) noexcept
+{
+    if (NewtonBody const *pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+        pBody != nullptr)
+    {
+        NewtonBodySetContinuousCollisionMode(pBody, enable ? 1 : 0);
+
+        if (enable)
         {
-            Matrix4 matrix;
-            NewtonBodyGetMatrix(pBody, matrix.data());
-            matrix.translation() += translate;
-            NewtonBodySetMatrix(pBody, matrix.data());
+            rCtxWorld.m_bodyCcd.set(bodyId);
         }
+        else
+        {
+            rCtxWorld.m_bodyCcd.reset(bodyId);
+        }
+    }
+}
+
+/**
+ * Order-independent key for one material class pair; group IDs are small Newton ints
+ */
+static constexpr std::uint32_t matpair_key(NwtMatId const matA, NwtMatId const matB) noexcept
+{
+    auto const lo = std::uint32_t(std::min(matA, matB));
+    auto const hi = std::uint32_t(std::max(matA, matB));
+    return (hi << 16) | lo;
+}
+
+NwtMatId SysNewton::material_create(ACtxNwtWorld& rCtxWorld) noexcept
+{
+    return NewtonMaterialCreateGroupID(rCtxWorld.m_world.get());
+}
+
+void SysNewton::material_set_pair(
+        ACtxNwtWorld&                       rCtxWorld,
+        NwtMatId const                      matA,
+        NwtMatId const                      matB,
+        ACtxNwtWorld::ContactMaterial const &params) noexcept
+{
+    NewtonWorld *pNwtWorld = rCtxWorld.m_world.get();
+
+    NewtonMaterialSetDefaultFriction  (pNwtWorld, matA, matB, params.staticFriction,
+                                                              params.kineticFriction);
+    NewtonMaterialSetDefaultElasticity(pNwtWorld, matA, matB, params.restitution);
+
+    // Only notify pairs get a contact callback; every other pair's contacts never leave
+    // the solver
+    NewtonMaterialSetCollisionCallback(pNwtWorld, matA, matB, nullptr,
+                                       params.notify ? &SysNewton::cb_contact_process
+                                                     : nullptr);
+
+    rCtxWorld.m_matPairs.insert_or_assign(matpair_key(matA, matB), params);
+}
+
+void SysNewton::body_material(ACtxNwtWorld& rCtxWorld, BodyId const bodyId, NwtMatId const mat) noexcept
+{
+    if (NewtonBody const *pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+        pBody != nullptr)
+    {
+        NewtonBodySetMaterialGroupID(pBody, mat);
     }
 }
 
@@ -172,7 +358,7 @@ void SysNewton::update_world(
         ACtxPhysics&                rCtxPhys,
         ACtxNwtWorld&               rCtxWorld,
         float                       timestep,
-        ACtxSceneGraph const&       rScnGraph,
+        ACtxSceneGraph&             rScnGraph,
         ACompTransformStorage_t&    rTf) noexcept
 {
     NewtonWorld const* pNwtWorld = rCtxWorld.m_world.get();
@@ -184,12 +370,223 @@ void SysNewton::update_world(
         NewtonBody const *pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
 
         NewtonBodySetVelocity(pBody, vel.data());
+        NewtonBodySetSleepState(pBody, 0);
+    }
+
+    // Wake bodies requested by gameplay events Newton can't see
+    for (ActiveEnt const ent : std::exchange(rCtxPhys.m_wake, {}))
+    {
+        auto const foundIt = rCtxWorld.m_entToBody.find(ent);
+        if (foundIt != rCtxWorld.m_entToBody.end())
+        {
+            body_wake(rCtxWorld, foundIt->second);
+        }
+    }
+
+    // Rebase to a shifted floating origin. The interpolation snapshots are contiguous
+    // arrays translated in whole-array sweeps (dead slots included; branchless and easily
+    // vectorized), and Newton matrices are rewritten from the translated snapshots instead
+    // of a get-translate-set round trip per body. Scene transforms are not touched here;
+    // every live body is marked dirty after stepping so the interpolated writeback below
+    // rewrites them at the new origin in its usual pass.
+    bool rebased = false;
+
+    if (Vector3 const translate = std::exchange(rCtxPhys.m_originTranslate, {});
+        ! translate.isZero())
+    {
+        rebased = true;
+
+        for (Matrix4 &rBodyTf : rCtxWorld.m_bodyTfPrev)
+        {
+            rBodyTf.translation() += translate;
+        }
+        for (Matrix4 &rBodyTf : rCtxWorld.m_bodyTfCurr)
+        {
+            rBodyTf.translation() += translate;
+        }
+
+        for (BodyId bodyId = 0; bodyId < rCtxWorld.m_bodyPtrs.size(); ++bodyId)
+        {
+            NewtonBody const* pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+
+            if (pBody == nullptr)
+            {
+                continue;
+            }
+
+            if (rCtxWorld.m_bodySnapshot.test(bodyId))
+            {
+                NewtonBodySetMatrix(pBody, rCtxWorld.m_bodyTfCurr[bodyId].data());
+            }
+            else
+            {
+                // Created since the last update; no snapshot to rewrite from yet
+                Matrix4 matrix;
+                NewtonBodyGetMatrix(pBody, matrix.data());
+                matrix.translation() += translate;
+                NewtonBodySetMatrix(pBody, matrix.data());
+            }
+        }
+    }
+
+    // Accumulate forces and torques with one linear sweep per factor; each factor walks its
+    // own bodies and writes the per-body accumulators directly, so no per-body dispatch is
+    // left in the solve path. Forces are held constant over the frame's substeps.
+    std::swap(rCtxWorld.m_bodyForce,  rCtxWorld.m_bodyForcePrev);
+    std::swap(rCtxWorld.m_bodyTorque, rCtxWorld.m_bodyTorquePrev);
+    std::fill(rCtxWorld.m_bodyForce .begin(), rCtxWorld.m_bodyForce .end(), Vector3{0.0f});
+    std::fill(rCtxWorld.m_bodyTorque.begin(), rCtxWorld.m_bodyTorque.end(), Vector3{0.0f});
+
+    for (std::size_t factorIdx = 0; factorIdx < rCtxWorld.m_factors.size(); ++factorIdx)
+    {
+        ACtxNwtWorld::ForceFactorFunc const& factor = rCtxWorld.m_factors[factorIdx];
+        factor.m_func(rCtxWorld, factorIdx, factor.m_userData);
+    }
+
+    // Sleeping bodies skip cb_force_torque, so a new thrust command on a slept body would be
+    // ignored until a contact wakes it; wake bodies whose applied force or torque changed.
+    // Steady factors like gravity reproduce bit-exact results each frame, so resting debris
+    // stays asleep and costs no solver time.
+    for (BodyId bodyId = 0; bodyId < rCtxWorld.m_bodyPtrs.size(); ++bodyId)
+    {
+        NewtonBody const* pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+
+        if ((pBody == nullptr) || (NewtonBodyGetSleepState(pBody) == 0))
+        {
+            continue;
+        }
+
+        if (   rCtxWorld.m_bodyForce [bodyId] != rCtxWorld.m_bodyForcePrev [bodyId]
+            || rCtxWorld.m_bodyTorque[bodyId] != rCtxWorld.m_bodyTorquePrev[bodyId] )
+        {
+            NewtonBodySetSleepState(pBody, 0);
+        }
+    }
+
+    // Swept (continuous) collision only for bodies fast enough to tunnel through thin
+    // geometry within one step; everyone else keeps the cheap discrete test. Sleeping
+    // bodies don't move and keep whatever mode they slept with.
+    if (rCtxPhys.m_ccdSpeedThreshold > 0.0f)
+    {
+        float const thresholdSq = rCtxPhys.m_ccdSpeedThreshold * rCtxPhys.m_ccdSpeedThreshold;
+
+        for (BodyId bodyId = 0; bodyId < rCtxWorld.m_bodyPtrs.size(); ++bodyId)
+        {
+            NewtonBody const* pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+
+            if ((pBody == nullptr) || (NewtonBodyGetSleepState(pBody) == 1))
+            {
+                continue;
+            }
+
+            Vector3 velocity;
+            NewtonBodyGetVelocity(pBody, velocity.data());
+
+            bool const fast = velocity.dot() > thresholdSq;
+            if (fast != rCtxWorld.m_bodyCcd.test(bodyId))
+            {
+                body_continuous_collision(rCtxWorld, bodyId, fast);
+            }
+        }
+    }
+
+    // Bodies created since the last update have no transform snapshots yet
+    for (BodyId bodyId = 0; bodyId < rCtxWorld.m_bodyPtrs.size(); ++bodyId)
+    {
+        NewtonBody const* pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+
+        if ((pBody == nullptr) || rCtxWorld.m_bodySnapshot.test(bodyId))
+        {
+            continue;
+        }
+
+        NewtonBodyGetMatrix(pBody, rCtxWorld.m_bodyTfCurr[bodyId].data());
+        rCtxWorld.m_bodyTfPrev[bodyId] = rCtxWorld.m_bodyTfCurr[bodyId];
+        rCtxWorld.m_bodySnapshot.set(bodyId);
+    }
+
+    // Step the world at a fixed size; leftover time is rendered by
+    // interpolating between the last two steps
+    rCtxWorld.m_stepAccumulator += timestep;
+
+    if (rCtxWorld.m_stepAccumulator >= rCtxWorld.m_stepSize)
+    {
+        // Dirty bits persist over zero-step frames so interpolation keeps
+        // writing moving bodies; only clear them when stepping again
+        auto &rDirtyInts = rCtxWorld.m_bodyDirty.ints();
+        std::fill(rDirtyInts.begin(), rDirtyInts.end(), osp::bitint_t{0});
     }
 
-    rCtxWorld.m_pTransform = std::addressof(rTf);
+    rCtxWorld.m_contactEvents.clear();
+
+    while (rCtxWorld.m_stepAccumulator >= rCtxWorld.m_stepSize)
+    {
+        rCtxWorld.m_stepAccumulator -= rCtxWorld.m_stepSize;
+
+        for (std::size_t const bodyId : rCtxWorld.m_bodySnapshot.ones())
+        {
+            rCtxWorld.m_bodyTfPrev[bodyId] = rCtxWorld.m_bodyTfCurr[bodyId];
+        }
+
+        NewtonUpdate(pNwtWorld, rCtxWorld.m_stepSize);
+
+        // Merge the per-thread writeback buffers filled by cb_set_transform.
+        // Each body appears in at most one buffer per step, so this is a plain
+        // sequential copy with no contention and no re-reads from Newton
+        for (std::vector<ACtxNwtWorld::MovedBody> &rMoved : rCtxWorld.m_perThreadMoved)
+        {
+            for (ACtxNwtWorld::MovedBody const& moved : rMoved)
+            {
+                rCtxWorld.m_bodyTfCurr[moved.m_body] = moved.m_tf;
+                rCtxWorld.m_bodyDirty.set(moved.m_body);
+            }
+            rMoved.clear();
+        }
+
+        // Batch up contacts recorded for notify material pairs; delivered in
+        // m_contactEvents once the update is done instead of per-contact calls mid-solve
+        for (std::vector<ACtxNwtWorld::ContactEvent> &rContacts : rCtxWorld.m_perThreadContacts)
+        {
+            rCtxWorld.m_contactEvents.insert(rCtxWorld.m_contactEvents.end(),
+                                             rContacts.begin(), rContacts.end());
+            rContacts.clear();
+        }
+    }
+
+    // A rebase must reach every body's scene transform, not just the ones Newton moved;
+    // marking after stepping so the marks survive the dirty-bit clear above. Bodies with
+    // no entity (eg. the static terrain body) have no scene transform to rewrite.
+    if (rebased)
+    {
+        for (BodyId bodyId = 0; bodyId < rCtxWorld.m_bodyPtrs.size(); ++bodyId)
+        {
+            if (   (rCtxWorld.m_bodyPtrs[bodyId].get() != nullptr)
+                && (rCtxWorld.m_bodyToEnt[bodyId] != lgrn::id_null<ActiveEnt>()) )
+            {
+                rCtxWorld.m_bodyDirty.set(bodyId);
+            }
+        }
+    }
 
-    // Update the world
-    NewtonUpdate(pNwtWorld, timestep);
+    // Write interpolated transforms of bodies Newton moved; the raw step
+    // results stay in the snapshots
+    float const alpha = rCtxWorld.m_stepAccumulator / rCtxWorld.m_stepSize;
+
+    for (std::size_t const bodyId : rCtxWorld.m_bodyDirty.ones())
+    {
+        ActiveEnt const ent     = rCtxWorld.m_bodyToEnt[bodyId];
+        Matrix4 const   &tfPrev = rCtxWorld.m_bodyTfPrev[bodyId];
+        Matrix4 const   &tfCurr = rCtxWorld.m_bodyTfCurr[bodyId];
+
+        Quaternion const rot = Magnum::Math::slerpShortestPath(
+                Quaternion::fromMatrix(tfPrev.rotation()),
+                Quaternion::fromMatrix(tfCurr.rotation()), alpha);
+        Vector3 const pos = Magnum::Math::lerp(
+                tfPrev.translation(), tfCurr.translation(), alpha);
+
+        rTf.get(ent).m_transform = Matrix4::from(rot.toMatrix(), pos);
+        SysSceneGraph::mark_transform_dirty(rScnGraph, ent);
+    }
 }
 
 void SysNewton::remove_components(ACtxNwtWorld& rCtxWorld, ActiveEnt ent) noexcept
@@ -201,10 +598,67 @@ void SysNewton::remove_components(ACtxNwtWorld& rCtxWorld, ActiveEnt ent) noexce
         BodyId const bodyId = itBodyId->second;
         rCtxWorld.m_bodyPtrs[bodyId].reset();
         rCtxWorld.m_bodyToEnt[bodyId] = lgrn::id_null<ActiveEnt>();
+        rCtxWorld.m_bodyDirty   .reset(bodyId);
+        rCtxWorld.m_bodySnapshot.reset(bodyId);
         rCtxWorld.m_entToBody.erase(itBodyId);
     }
 
     rCtxWorld.m_colliders.remove(ent);
+    rCtxWorld.m_entToSubCollision.erase(ent);
+}
+
+void SysNewton::compound_add_collider(
+        ACtxNwtWorld&       rCtxWorld,
+        BodyId const        bodyId,
+        ActiveEnt const     ent,
+        EShape const        shape,
+        Matrix4 const&      transform)
+{
+    NewtonBody const *pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+    NewtonCollision *pCompound = NewtonBodyGetCollision(pBody);
+
+    // Reuse the entity's cached collider instance if it was attached before
+    NwtColliderPtr_t &rPtr = rCtxWorld.m_colliders.contains(ent)
+                           ? rCtxWorld.m_colliders.get(ent)
+                           : rCtxWorld.m_colliders.emplace(ent);
+    if (rPtr.get() == nullptr)
+    {
+        rPtr = create_primative(rCtxWorld, shape);
+    }
+
+    orient_collision(rPtr.get(), shape, transform.translation(), transform.rotation(), transform.scaling());
+
+    NewtonCompoundCollisionBeginAddRemove(pCompound);
+    void *pNode = NewtonCompoundCollisionAddSubCollision(pCompound, rPtr.get());
+    NewtonCompoundCollisionEndAddRemove(pCompound);
+
+    rCtxWorld.m_entToSubCollision.insert_or_assign(ent, pNode);
+
+    // The body's shape changed; it must leave any sleeping island and re-evaluate contacts
+    body_wake(rCtxWorld, bodyId);
+}
+
+void SysNewton::compound_remove_collider(
+        ACtxNwtWorld&       rCtxWorld,
+        BodyId const        bodyId,
+        ActiveEnt const     ent)
+{
+    auto const it = rCtxWorld.m_entToSubCollision.find(ent);
+    if (it == rCtxWorld.m_entToSubCollision.end())
+    {
+        return;
+    }
+
+    NewtonBody const *pBody = rCtxWorld.m_bodyPtrs[bodyId].get();
+    NewtonCollision *pCompound = NewtonBodyGetCollision(pBody);
+
+    NewtonCompoundCollisionBeginAddRemove(pCompound);
+    NewtonCompoundCollisionRemoveSubCollision(pCompound, it->second);
+    NewtonCompoundCollisionEndAddRemove(pCompound);
+
+    rCtxWorld.m_entToSubCollision.erase(it);
+
+    body_wake(rCtxWorld, bodyId);
 }
 
 
@@ -238,8 +692,10 @@ void SysNewton::find_colliders_recurse(
         Vector3 const scale = colliderTf.scaling();
         NewtonCollisionSetScale(pCollision, scale.x(), scale.y(), scale.z());
 
-        // Add body to compound collision
-        NewtonCompoundCollisionAddSubCollision(pCompound, pCollision);
+        // Add body to compound collision, keeping the node handle so the sub-collider can
+        // later be detached individually by compound_remove_collider
+        void *pNode = NewtonCompoundCollisionAddSubCollision(pCompound, pCollision);
+        rCtxWorld.m_entToSubCollision.insert_or_assign(ent, pNode);
     }
 
     if ( ! rCtxPhys.m_hasColliders.test(std::size_t(ent)) )
@@ -248,7 +704,7 @@ void SysNewton::find_colliders_recurse(
     }
 
     // Recurse into children if there are more colliders
-    for (ActiveEnt child : SysSceneGraph::children(rScnGraph, ent))
+    for (ActiveEnt child : SysSceneGraph::children_span(rScnGraph, ent))
     {
         if (rTf.contains(child))
         {
@@ -55,6 +55,36 @@ public:
 
     static void cb_set_transform(NewtonBody const* pBody, dFloat const* pMatrix, NwtThreadIndex_t thread);
 
+    static void cb_contact_process(NewtonJoint const* pContactJoint, dFloat timestep, NwtThreadIndex_t thread);
+
+    /**
+     * @brief Create a new material class for contact response
+     *
+     * Pair two classes with material_set_pair and assign bodies with body_material.
+     * Newton's default group is material 0; bodies start there.
+     */
+    [[nodiscard]] static NwtMatId material_create(ACtxNwtWorld& rCtxWorld) noexcept;
+
+    /**
+     * @brief Set contact response parameters for one pair of material classes
+     *
+     * Friction and restitution are handed to Newton and resolve entirely inside the
+     * solver; no OSP callback runs for the pair unless ContactMaterial::notify is set,
+     * in which case contacts are recorded and delivered batched in
+     * ACtxNwtWorld::m_contactEvents after update_world. Pass a class twice for
+     * self-contact, and pair against material 0 for unclassified bodies.
+     */
+    static void material_set_pair(
+            ACtxNwtWorld&                       rCtxWorld,
+            NwtMatId                            matA,
+            NwtMatId                            matB,
+            ACtxNwtWorld::ContactMaterial const &params) noexcept;
+
+    /**
+     * @brief Assign a rigid body to a material class. No-op on deleted bodies.
+     */
+    static void body_material(ACtxNwtWorld& rCtxWorld, BodyId bodyId, NwtMatId mat) noexcept;
+
     static void resize_body_data(ACtxNwtWorld& rCtxWorld);
 
     [[nodiscard]] static NwtColliderPtr_t create_primative(
@@ -70,33 +100,109 @@ public:
             osp::Vector3 const&     scale);
 
     /**
-     * @brief Respond to scene origin shifts by translating all rigid bodies
+     * @brief Wake a rigid body, pulling its sleeping island back into the solve
      *
-     * @param rCtxPhys      [ref] Generic physics context with m_originTranslate
-     * @param rCtxWorld     [ref] Newton World
+     * update_world already wakes bodies on velocity writes, collider edits, and applied-force
+     * changes; use this (or queue the entity in ACtxPhysics::m_wake) for events Newton can't
+     * see, like proximity triggers or grabs. No-op on deleted bodies.
      */
-    static void update_translate(
-            ACtxPhysics& rCtxPhys,
-            ACtxNwtWorld& rCtxWorld) noexcept;
+    static void body_wake(ACtxNwtWorld& rCtxWorld, BodyId bodyId) noexcept;
+
+    /**
+     * @brief Put a rigid body to sleep immediately instead of waiting for equilibrium
+     *
+     * Newton wakes it again on contact or through any of the triggers listed on body_wake.
+     */
+    static void body_sleep(ACtxNwtWorld& rCtxWorld, BodyId bodyId) noexcept;
+
+    /**
+     * @brief Enable or disable equilibrium auto-sleep for one body
+     *
+     * Enabled by default: a body at rest long enough leaves the solve until disturbed, so a
+     * junkyard of settled debris costs near-zero physics time. Disable for bodies that must
+     * integrate every step regardless, like player-controlled vehicles under fine thrust.
+     * Sleep thresholds themselves are world-global in Newton; this is the per-body knob.
+     */
+    static void body_auto_sleep(ACtxNwtWorld& rCtxWorld, BodyId bodyId, bool enable) noexcept;
+
+    /**
+     * @brief Enable or disable swept (continuous) collision detection for one body
+     *
+     * update_world toggles this automatically for bodies crossing
+     * ACtxPhysics::m_ccdSpeedThreshold, so fast movers can't tunnel through thin geometry
+     * without shrinking the global step. Only call directly for bodies that must stay swept
+     * regardless of speed, and mind that the automatic sweep re-evaluates awake bodies.
+     */
+    static void body_continuous_collision(ACtxNwtWorld& rCtxWorld, BodyId bodyId, bool enable) noexcept;
 
     /**
      * @brief Synchronize generic physics colliders with Newton colliders
      *
-     * @param rCtxPhys          [ref] Generic physics context
+     * Dirty entries are compared against ACtxPhysics::m_colliderStamp before touching
+     * Newton: broad invalidations (eg. a scene load marking every collider dirty) leave
+     * terrain and station colliders byte-identical, and those skip for the cost of a hash.
+     * Transforms are taken as relative to the entity's rigid body root, matching how the
+     * colliders were oriented at assembly.
+     *
+     * @param rCtxPhys          [ref] Generic physics context; change stamps are updated
      * @param rCtxWorld         [ref] Newton World
-     * @param rCollidersDirty   [in] Colliders to update
+     * @param rTf               [in] Storage for transform components
+     * @param collidersDirty    [in] Colliders to update
      */
     static void update_colliders(
             ACtxPhysics& rCtxPhys,
             ACtxNwtWorld& rCtxWorld,
+            ACompTransformStorage_t const& rTf,
             std::vector<ActiveEnt> const& collidersDirty) noexcept;
 
+    /**
+     * @brief Add a single entity's collider to a rigid body's existing compound collision
+     *
+     * For structural edits like docking: the collider is oriented relative to the body root
+     * and added against the existing compound, leaving every other sub-collider's cached
+     * transform untouched; cost is O(1) per changed part instead of a full recursive rebuild.
+     * The caller must refresh the body's mass matrix and center of mass afterwards, see
+     * SysPhysics::update_subtree_mass.
+     *
+     * @param rCtxWorld     [ref] Newton world
+     * @param bodyId        [in] Body whose compound collision to edit
+     * @param ent           [in] Entity the collider belongs to
+     * @param shape         [in] Collider shape
+     * @param transform     [in] Collider transform relative to the body root
+     */
+    static void compound_add_collider(
+            ACtxNwtWorld&           rCtxWorld,
+            BodyId                  bodyId,
+            ActiveEnt               ent,
+            osp::EShape             shape,
+            osp::Matrix4 const&     transform);
+
+    /**
+     * @brief Detach a single entity's collider from a rigid body's compound collision
+     *
+     * Undocking counterpart of compound_add_collider. The collider instance stays cached in
+     * ACtxNwtWorld::m_colliders for re-attachment; only the compound's sub-collision node is
+     * removed. No-op if the entity has no attached sub-collider.
+     */
+    static void compound_remove_collider(
+            ACtxNwtWorld&           rCtxWorld,
+            BodyId                  bodyId,
+            ActiveEnt               ent);
+
     /**
      * @brief Step the entire Newton World forward in time
      *
+     * The world advances in fixed ACtxNwtWorld::m_stepSize increments driven
+     * by an accumulator, and body transforms are written interpolated between
+     * the last two steps; simulation rate is independent of frame rate.
+     *
+     * Also consumes ACtxPhysics::m_originTranslate: floating-origin shifts are
+     * applied as linear sweeps over the contiguous snapshot arrays, and the
+     * scene-side shift rides the same interpolated transform writeback.
+     *
      * @param rCtxPhys      [ref] Generic Physics context. Updates linear and angular velocity.
      * @param rCtxWorld     [ref] Newton world to update
-     * @param timestep      [in] Time to step world, passed to Newton update
+     * @param timestep      [in] Frame delta time added to the step accumulator
      * @param inputs        [ref] Physics inputs (from different threads)
      * @param rHier         [in] Storage for Hierarchy components
      * @param rTf           [ref] Relative transforms used by rigid bodies
@@ -107,7 +213,7 @@ public:
             ACtxPhysics&                            rCtxPhys,
             ACtxNwtWorld&                           rCtxWorld,
             float                                   timestep,
-            ACtxSceneGraph const&                   rScnGraph,
+            ACtxSceneGraph&                         rScnGraph,
             osp::active::ACompTransformStorage_t&   rTf) noexcept;
 
     static void remove_components(
@@ -145,6 +251,9 @@ private:
      * @brief Find colliders in an entity and its hierarchy, and add them to
      *        a Newton Compound Collision
      *
+     * Iterates children through SysSceneGraph::children_span; the caller must
+     * have called update_children_spans since the last scene graph change.
+     *
      * @param rCtxPhys      [in] Generic Physics context.
      * @param rCtxWorld     [ref] Newton world
      * @param rHier         [in] Storage for hierarchy components
@@ -0,0 +1,234 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "chunk_cull.h"
+
+#include <algorithm>
+#include <cmath>
+
+using osp::Matrix4;
+using osp::Vector3;
+using osp::Vector4;
+
+namespace planeta
+{
+
+namespace
+{
+
+SkTriGroupCone cone_from_corners(
+        std::array<SkVrtxOwner_t, 3>  const &vertices,
+        SkeletonVertexData            const &rSkData)
+{
+    std::array<Vector3, 3> dirs;
+    for (int i = 0; i < 3; ++i)
+    {
+        dirs[i] = Vector3(rSkData.positions[vertices[i].value()]).normalized();
+    }
+
+    Vector3 const axis = (dirs[0] + dirs[1] + dirs[2]).normalized();
+
+    float const cosHalfAngle = std::min({ Magnum::Math::dot(axis, dirs[0]),
+                                          Magnum::Math::dot(axis, dirs[1]),
+                                          Magnum::Math::dot(axis, dirs[2]) });
+
+    return { .axis = axis, .cosHalfAngle = cosHalfAngle };
+}
+
+/**
+ * @brief Per-cull view state shared by every cone test of one cull_chunks call
+ */
+struct CullView
+{
+    /// Frustum planes {nx, ny, nz, d}, normals pointing inward, extracted from viewProj
+    std::array<Vector4, 6>  planes;
+
+    Vector3                 camDir; ///< Unit direction from planet center to the camera
+    float                   maxHorizonAngle{}; ///< See cone_visible
+    bool                    horizonEnabled{};
+};
+
+CullView make_cull_view(Vector3 const viewPos, Matrix4 const &viewProj, ChunkCullData const &rCull)
+{
+    CullView view;
+
+    Vector4 const row0 = viewProj.row(0);
+    Vector4 const row1 = viewProj.row(1);
+    Vector4 const row2 = viewProj.row(2);
+    Vector4 const row3 = viewProj.row(3);
+
+    view.planes = {{ row3 + row0, row3 - row0,
+                     row3 + row1, row3 - row1,
+                     row3 + row2, row3 - row2 }};
+    for (Vector4 &rPlane : view.planes)
+    {
+        rPlane /= rPlane.xyz().length();
+    }
+
+    float const camDist = viewPos.length();
+    view.horizonEnabled = camDist > rCull.radiusMin && rCull.radiusMin > 0.0f;
+    if (view.horizonEnabled)
+    {
+        view.camDir = viewPos / camDist;
+
+        // A surface point is hidden by the radiusMin sphere once the angle between the camera
+        // and the point (measured from the planet center) exceeds the camera's horizon angle
+        // plus the point's own horizon angle at its maximum height.
+        float const maxHeightCos = std::min(rCull.radiusMin / rCull.radiusMax, 1.0f);
+        view.maxHorizonAngle = std::acos(rCull.radiusMin / camDist) + std::acos(maxHeightCos);
+    }
+
+    return view;
+}
+
+bool cone_visible(CullView const &view, ChunkCullData const &rCull, SkTriGroupCone const cone)
+{
+    float const halfAngle = std::acos(std::clamp(cone.cosHalfAngle, -1.0f, 1.0f));
+
+    if (view.horizonEnabled)
+    {
+        float const angleToCam = std::acos(std::clamp(
+                Magnum::Math::dot(view.camDir, cone.axis), -1.0f, 1.0f));
+        if (angleToCam - halfAngle > view.maxHorizonAngle)
+        {
+            return false; // Entirely beyond the horizon
+        }
+    }
+
+    // Conservative bounding sphere of the cone's shell between radiusMin and radiusMax,
+    // for testing against the frustum planes
+    float const cosA   = std::clamp(cone.cosHalfAngle, -1.0f, 1.0f);
+    float const center = 0.5f * (rCull.radiusMin * cosA + rCull.radiusMax);
+
+    auto const dist_sq = [center] (float const r, float const cos)
+    {
+        return r*r + center*center - 2.0f*r*center*cos;
+    };
+    float const radiusSq = std::max({ dist_sq(rCull.radiusMax, cosA),
+                                      dist_sq(rCull.radiusMin, cosA),
+                                      dist_sq(rCull.radiusMax, 1.0f),
+                                      dist_sq(rCull.radiusMin, 1.0f) });
+
+    Vector3 const sphereCenter = cone.axis * center;
+    float   const sphereRadius = std::sqrt(std::max(radiusSq, 0.0f));
+
+    for (Vector4 const &plane : view.planes)
+    {
+        if (Magnum::Math::dot(plane.xyz(), sphereCenter) + plane.w() < -sphereRadius)
+        {
+            return false; // Entirely behind one frustum plane
+        }
+    }
+
+    return true;
+}
+
+struct CullCtx
+{
+    CullView               const &view;
+    SubdivTriangleSkeleton const &rSkel;
+    ChunkSkeleton          const &rSkCh;
+    ChunkCullData          const &rCull;
+    std::vector<ChunkId>         &rVisibleOut;
+};
+
+void cull_walk_group(SkTriGroupId const groupId, CullCtx const &ctx)
+{
+    if ( ! cone_visible(ctx.view, ctx.rCull, ctx.rCull.groupCones[groupId]) )
+    {
+        return; // Rejects all descendants at once
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        SkTriId const sktriId = tri_id(groupId, i);
+        ChunkId const chunkId = ctx.rSkCh.m_triToChunk[sktriId];
+
+        if (chunkId.has_value())
+        {
+            ctx.rVisibleOut.push_back(chunkId); // Surface triangle with a chunk
+        }
+        else if (SkTriGroupId const children = ctx.rSkel.tri_at(sktriId).children;
+                 children.has_value())
+        {
+            cull_walk_group(children, ctx);
+        }
+    }
+}
+
+} // namespace
+
+
+void calc_group_cone(
+        SkTriGroupId              const groupId,
+        SubdivTriangleSkeleton    const &rSkel,
+        SkeletonVertexData        const &rSkData,
+        ChunkCullData                   &rCull)
+{
+    SkTriGroup const &group = rSkel.tri_group_at(groupId);
+    if ( ! group.parent.has_value() )
+    {
+        return; // Root group; its 4 triangles don't tile a parent, handled in cull_chunks
+    }
+
+    rCull.groupCones[groupId] = cone_from_corners(rSkel.tri_at(group.parent).vertices, rSkData);
+}
+
+void cull_chunks(
+        osp::Vector3                    viewPos,
+        osp::Matrix4              const &viewProj,
+        osp::ArrayView<SkTriId const>   rootTris,
+        SubdivTriangleSkeleton    const &rSkel,
+        SkeletonVertexData        const &rSkData,
+        ChunkSkeleton             const &rSkCh,
+        ChunkCullData             const &rCull,
+        std::vector<ChunkId>            &rVisibleOut)
+{
+    rVisibleOut.clear();
+
+    CullView const view = make_cull_view(viewPos, viewProj, rCull);
+    CullCtx  const ctx{ view, rSkel, rSkCh, rCull, rVisibleOut };
+
+    for (SkTriId const rootId : rootTris)
+    {
+        SkeletonTriangle const &rootTri = rSkel.tri_at(rootId);
+
+        if ( ! cone_visible(view, rCull, cone_from_corners(rootTri.vertices, rSkData)) )
+        {
+            continue;
+        }
+
+        ChunkId const chunkId = rSkCh.m_triToChunk[rootId];
+        if (chunkId.has_value())
+        {
+            rVisibleOut.push_back(chunkId);
+        }
+        else if (rootTri.children.has_value())
+        {
+            cull_walk_group(rootTri.children, ctx);
+        }
+    }
+}
+
+} // namespace planeta
@@ -0,0 +1,117 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Horizon and frustum culling for terrain chunks
+ */
+
+#include "skeleton.h"
+#include "geometry.h"
+
+#include <osp/core/math_types.h>
+
+#include <vector>
+
+namespace planeta
+{
+
+/**
+ * @brief Bounding cone of a SkTriGroup's terrain region, apex at the planet center
+ *
+ * A group's four triangles exactly tile their parent triangle, and spherical caps are
+ * geodesically convex, so the cap covering the parent's three corner directions bounds the
+ * group and every descendant. Combined with ChunkCullData's radius range this bounds all chunk
+ * geometry under the group.
+ */
+struct SkTriGroupCone
+{
+    osp::Vector3    axis;           ///< Unit direction from planet center through the region
+    float           cosHalfAngle;   ///< Cosine of the cone's half-angle
+};
+
+/**
+ * @brief Bounding cones for hierarchically culling terrain chunks, see cull_chunks
+ *
+ * Cones follow the SkTriGroup hierarchy of SubdivTriangleSkeleton; update them through
+ * calc_group_cone as groups are created (e.g. in SkeletonSubdivScratchpad::onSubdiv). Root
+ * groups don't form a triangle and have no cone; cull_chunks handles root triangles
+ * individually.
+ */
+struct ChunkCullData
+{
+    void resize(SubdivTriangleSkeleton const &rSkel)
+    {
+        groupCones.resize(rSkel.tri_group_ids().capacity());
+    }
+
+    osp::KeyedVec<SkTriGroupId, SkTriGroupCone> groupCones;
+
+    /// Planet radius at the lowest terrain point in meters; the sphere assumed to occlude
+    float radiusMin{};
+
+    /// Planet radius at the highest terrain point in meters
+    float radiusMax{};
+};
+
+/**
+ * @brief Write the bounding cone of a newly created SkTriGroup
+ *
+ * Call after the group's (parent's) vertex positions are written. Root groups are skipped.
+ */
+void calc_group_cone(
+        SkTriGroupId                    groupId,
+        SubdivTriangleSkeleton    const &rSkel,
+        SkeletonVertexData        const &rSkData,
+        ChunkCullData                   &rCull);
+
+/**
+ * @brief Gather chunks that may be visible, walking the skeleton hierarchy top-down
+ *
+ * Groups entirely beyond the horizon of the radiusMin sphere or outside the view frustum are
+ * rejected with all of their descendants; chunks of surviving groups are appended to
+ * rVisibleOut in hierarchy order, ready for draw submission.
+ *
+ * @param viewPos     [in] Camera position in mesh space (planet center origin, meters)
+ * @param viewProj    [in] Combined view and projection matrix for frustum testing
+ * @param rootTris    [in] Root skeleton triangles, e.g. the 20 initial icosahedron faces
+ * @param rSkel       [in] Skeleton hierarchy
+ * @param rSkData     [in] Skeleton vertex data, used for root triangle cones
+ * @param rSkCh       [in] Chunk skeleton mapping surface triangles to chunks
+ * @param rCull       [in] Bounding cones maintained through calc_group_cone
+ * @param rVisibleOut [out] Cleared, then filled with possibly-visible chunks
+ */
+void cull_chunks(
+        osp::Vector3                    viewPos,
+        osp::Matrix4              const &viewProj,
+        osp::ArrayView<SkTriId const>   rootTris,
+        SubdivTriangleSkeleton    const &rSkel,
+        SkeletonVertexData        const &rSkData,
+        ChunkSkeleton             const &rSkCh,
+        ChunkCullData             const &rCull,
+        std::vector<ChunkId>            &rVisibleOut);
+
+} // namespace planeta
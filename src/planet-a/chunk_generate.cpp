@@ -24,9 +24,17 @@
  */
 #include "chunk_generate.h"
 
+#include <osp/core/bitvector.h>
+
 #include <Corrade/Containers/ArrayViewStl.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <istream>
 #include <ostream>
+#include <thread>
 
 using osp::ArrayView;
 using osp::Vector3;
@@ -41,12 +49,29 @@ namespace planeta
 void ChunkScratchpad::resize(ChunkSkeleton const& rChSk)
 {
     auto const maxSharedVrtx = rChSk.m_sharedIds.capacity();
+    auto const maxChunks     = rChSk.m_chunkIds.capacity();
+
+    lut       = get_chunk_vrtx_subdiv_lut(rChSk.m_chunkSubdivLevel);
+    stitchLut = get_chunk_fan_stitch_lut  (rChSk.m_chunkSubdivLevel);
 
     edgeVertices.resize((rChSk.m_chunkEdgeVrtxCount - 1) * 3);
-    stitchCmds  .resize(rChSk.m_chunkIds.capacity(), {});
+    stitchCmds  .resize(maxChunks, {});
     osp::bitvector_resize(sharedAdded,        maxSharedVrtx);
     osp::bitvector_resize(sharedRemoved,      maxSharedVrtx);
     osp::bitvector_resize(sharedNormalsDirty, maxSharedVrtx);
+
+    // Preallocate update_faces_parallel scratch up-front. The mesh buffers themselves are flat
+    // per-id slabs recycled through ChunkId reuse, so with these reserved, steady-state chunk
+    // creation/removal allocates nothing on the heap.
+    chunksAdded   .reserve(maxChunks);
+    chunksToUpdate.reserve(maxChunks);
+
+    normalStaging.resize(std::max<std::size_t>(std::thread::hardware_concurrency(), 1u));
+    for (ChunkNormalStaging &rStaging : normalStaging)
+    {
+        rStaging.sharedNormalDelta.resize(maxSharedVrtx);
+        osp::bitvector_resize(rStaging.sharedDirty, maxSharedVrtx);
+    }
 }
 
 void restitch_check(
@@ -180,6 +205,8 @@ void update_faces(
         SkeletonVertexData     const &rSkData,
         BasicChunkMeshGeometry       &rGeom,
         ChunkMeshBufferInfo    const &rChInfo,
+        ArrayView<Vector3>     const sharedNormalSum,
+        osp::BitVector_t             &rSharedNormalsDirty,
         ChunkScratchpad              &rChSP,
         ChunkSkeleton                &rSkCh)
 {
@@ -198,13 +225,21 @@ void update_faces(
     TerrainFaceWriter writer{
         .vbufPos             = rGeom.chunkVbufPos,
         .vbufNrm             = rGeom.chunkVbufNrm,
-        .sharedNormalSum     = rGeom.sharedNormalSum.base(),
+        .sharedNormalSum     = sharedNormalSum,
         .fillNormalContrib   = fillNormalContrib,
         .fanNormalContrib    = fanNormalContrib,
         .sharedUsed          = sharedUsed,
-        .currentFace         = ibufSlice.begin(),
-        .contribLast         = fanNormalContrib.begin(),
-        .rSharedNormalsDirty = rChSP.sharedNormalsDirty
+        .currentFace           = ibufSlice.begin(),
+        .contribLast           = fanNormalContrib.begin(),
+        .fanFaceFirst          = std::next(ibufSlice.begin(), rChInfo.fillFaceCount),
+        .cornerFaceCapacity    = rChInfo.fanCornerFaceCapacity,
+        .edgeFaceCapacity      = rChInfo.fanEdgeFaceCapacity,
+        .cornerContribCapacity = rChInfo.fanCornerContribCapacity,
+        .edgeContribCapacity   = rChInfo.fanEdgeContribCapacity,
+        .segmentFaceEnd        = ibufSlice.end(),
+        .contribFirst          = fanNormalContrib.begin(),
+        .segmentContribEnd     = fanNormalContrib.end(),
+        .rSharedNormalsDirty   = rSharedNormalsDirty
     };
 
     // Create triangle fill for newly added triangles
@@ -214,10 +249,14 @@ void update_faces(
         auto const chunkVbufFillNormals2D = as_2d(arrayView(rGeom.chunkVbufNrm).exceptPrefix(rChInfo.vbufFillOffset), rChInfo.fillVrtxCount);
         auto const vbufFillNormals        = chunkVbufFillNormals2D.row(chunkId.value);
 
-        // These aren't cleaned up by the previous chunk that used them
+        // These aren't cleaned up by the previous chunk that used them. Fan faces are zeroed
+        // too, in case no stitch command rewrites them this update; zeroed faces are degenerate
+        // and draw nothing.
         std::fill(vbufFillNormals  .begin(), vbufFillNormals  .end(), Vector3{ZeroInit});
         std::fill(fillNormalContrib.begin(), fillNormalContrib.end(), Vector3{ZeroInit});
         std::fill(fanNormalContrib .begin(), fanNormalContrib .end(), FanNormalContrib{});
+        std::fill(std::next(ibufSlice.begin(), rChInfo.fillFaceCount), ibufSlice.end(),
+                  Vector3u{ZeroInit});
 
         auto const add_fill_tri = [&rSkCh, &rChInfo, &writer, chunkId]
                 (std::uint16_t const aX, std::uint16_t const aY,
@@ -259,22 +298,42 @@ void update_faces(
         LGRN_ASSERTM(writer.currentFace == std::next(ibufSlice.begin(), rChInfo.fillFaceCount),
                      "Code above must always add a known number of faces");
 
-        for (Vector3 &rNormal : vbufFillNormals)
-        {
-            rNormal = rNormal.normalized();
-        }
+        normalize_batched(vbufFillNormals);
     }
 
-    writer.currentFace = std::next(ibufSlice.begin(), rChInfo.fillFaceCount);
-
     // Add or replace Fan triangles
     if (cmd.enabled)
     {
         ChunkStitch &rCurrentStitch = rSkCh.m_chunkStitch[chunkId];
-        if (rCurrentStitch.enabled)
+
+        // Work out which borders actually changed. Only their fan segments (edge + both
+        // adjacent corners) are subtracted and rewritten; the rest keep their faces and
+        // normal contributions.
+        std::uint8_t dirtyEdges;
+        if (newlyAdded || ! rCurrentStitch.enabled)
+        {
+            dirtyEdges = 0b111;
+        }
+        else
         {
-            // Delete previous fan stitch, Subtract normal contributions
-            subtract_normal_contrib(chunkId, true, rGeom, rChInfo, rChSP, rSkCh);
+            dirtyEdges = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                bool const wasX2 = rCurrentStitch.detailX2 && (rCurrentStitch.x2ownEdge == k);
+                bool const isX2  = cmd.detailX2            && (cmd.x2ownEdge           == k);
+                if (   (wasX2 != isX2)
+                    || (isX2 && rCurrentStitch.x2neighborEdge != cmd.x2neighborEdge) )
+                {
+                    dirtyEdges |= std::uint8_t(1u << k);
+                }
+            }
+        }
+
+        if (rCurrentStitch.enabled && dirtyEdges != 0)
+        {
+            // Delete previous fan stitch of changed segments, subtract normal contributions
+            subtract_normal_contrib(chunkId, fan_dirty_segments(dirtyEdges), false, rGeom,
+                                    rChInfo, sharedNormalSum, rSharedNormalsDirty, rChSP, rSkCh);
         }
         rSkCh.m_chunkStitch[chunkId] = cmd;
         ArrayView<SharedVrtxOwner_t const> detailX2Edge0;
@@ -300,45 +359,152 @@ void update_faces(
 
         auto const stitcher = make_chunk_fan_stitcher<TerrainFaceWriter&>(writer, chunkId, detailX2Edge0, detailX2Edge1, rSkCh, rChInfo);
 
-        stitcher.stitch(cmd);
+        stitcher.stitch(*rChSP.stitchLut, cmd, dirtyEdges);
+    }
+}
+
+void update_faces_parallel(
+        osp::BitVector_t          const &surfaceAdded,
+        SubdivTriangleSkeleton          &rSkel,
+        SkeletonVertexData        const &rSkData,
+        BasicChunkMeshGeometry          &rGeom,
+        ChunkMeshBufferInfo       const &rChInfo,
+        ChunkScratchpad                 &rChSP,
+        ChunkSkeleton                   &rSkCh)
+{
+    rChSP.chunksToUpdate.clear();
+    for (std::size_t const chunkInt : rSkCh.m_chunkIds.bitview().zeros())
+    {
+        rChSP.chunksToUpdate.push_back(ChunkId::from_index(chunkInt));
+    }
+
+    auto const update_one = [&] (ChunkId              const chunkId,
+                                 ArrayView<Vector3>   const sharedNormalSum,
+                                 osp::BitVector_t           &rSharedNormalsDirty)
+    {
+        SkTriId const sktriId    = rSkCh.m_chunkToTri[chunkId];
+        bool    const newlyAdded = surfaceAdded.test(sktriId.value);
+
+        update_faces(chunkId, sktriId, newlyAdded, rSkel, rSkData, rGeom, rChInfo,
+                     sharedNormalSum, rSharedNormalsDirty, rChSP, rSkCh);
+    };
+
+    /// Chunk batches smaller than this aren't worth the thread spawn/join and splice overhead
+    constexpr std::size_t minChunksPerWorker = 8;
+
+    std::size_t const workerCount = std::min<std::size_t>(
+            std::thread::hardware_concurrency(),
+            rChSP.chunksToUpdate.size() / minChunksPerWorker);
+
+    if (workerCount <= 1)
+    {
+        for (ChunkId const chunkId : rChSP.chunksToUpdate)
+        {
+            update_one(chunkId, rGeom.sharedNormalSum.base(), rChSP.sharedNormalsDirty);
+        }
+        return;
+    }
+
+    auto const maxSharedVrtx = rSkCh.m_sharedIds.capacity();
+
+    if (rChSP.normalStaging.size() < workerCount)
+    {
+        rChSP.normalStaging.resize(workerCount);
+    }
+    for (ChunkNormalStaging &rStaging : rChSP.normalStaging)
+    {
+        // Growing zero-fills new slots; existing slots are left zeroed by the splice below
+        rStaging.sharedNormalDelta.resize(maxSharedVrtx);
+        osp::bitvector_resize(rStaging.sharedDirty, maxSharedVrtx);
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+
+    std::size_t const per = rChSP.chunksToUpdate.size() / workerCount;
+    for (std::size_t w = 0; w < workerCount; ++w)
+    {
+        std::size_t const first = w * per;
+        std::size_t const last  = (w+1 == workerCount) ? rChSP.chunksToUpdate.size() : first + per;
+
+        workers.emplace_back([&update_one, &rChSP, w, first, last] ()
+        {
+            ChunkNormalStaging &rStaging = rChSP.normalStaging[w];
+            for (std::size_t i = first; i < last; ++i)
+            {
+                update_one(rChSP.chunksToUpdate[i], rStaging.sharedNormalDelta.base(),
+                           rStaging.sharedDirty);
+            }
+        });
     }
 
-    // Fill remaining with zeros to indicate an early end if the full range isn't used
-    std::fill(writer.currentFace, ibufSlice.end(), Vector3u{ZeroInit});
+    for (std::thread &rWorker : workers)
+    {
+        rWorker.join();
+    }
+
+    // Splice staged normal sum deltas on the calling thread, leaving staging zeroed for reuse
+    for (std::size_t w = 0; w < workerCount; ++w)
+    {
+        ChunkNormalStaging &rStaging = rChSP.normalStaging[w];
 
+        osp::bitvector_for_each_set(rStaging.sharedDirty, [&] (std::size_t const sharedInt)
+        {
+            auto const shared = SharedVrtxId(sharedInt);
+            rGeom.sharedNormalSum[shared]       += rStaging.sharedNormalDelta[shared];
+            rStaging.sharedNormalDelta[shared]   = Vector3{ZeroInit};
+            rChSP.sharedNormalsDirty.set(sharedInt);
+        });
+        rStaging.sharedDirty.reset();
+    }
 }
 
 void subtract_normal_contrib(
         ChunkId                       const chunkId,
-        bool                          const onlySubtractFans,
+        std::uint8_t                  const fanSegments,
+        bool                          const subtractFill,
         BasicChunkMeshGeometry              &rGeom,
         ChunkMeshBufferInfo           const &rChInfo,
+        ArrayView<Vector3>            const sharedNormalSum,
+        osp::BitVector_t                    &rSharedNormalsDirty,
         ChunkScratchpad                     &rChSP,
         ChunkSkeleton                 const &rSkCh)
 {
-    // Subtract Fan shared vertex normal contributions
+    // Subtract Fan shared vertex normal contributions of the selected segments
 
     auto const chunkFanNormalContrib2D = as_2d(arrayView(rGeom.chunkFanNormalContrib), rChInfo.fanMaxSharedCount);
     auto const fanNormalContrib        = chunkFanNormalContrib2D.row(chunkId.value);
 
     LGRN_ASSERT(rSkCh.m_chunkStitch[chunkId].enabled);
-    for (FanNormalContrib &rContrib : fanNormalContrib)
+    for (int segment = 0; segment < 6; ++segment)
     {
-        if ( ! rContrib.shared.has_value() )
+        if ((fanSegments & (1u << segment)) == 0)
         {
-            break;
+            continue;
         }
 
-        if (rSkCh.m_sharedIds.exists(rContrib.shared) && ! rChSP.sharedRemoved.test(rContrib.shared.value))
+        auto const segContrib = fanNormalContrib.sliceSize(
+                rChInfo.fan_segment_contrib_offset(segment),
+                rChInfo.fan_segment_contrib_capacity(segment));
+
+        for (FanNormalContrib &rContrib : segContrib)
         {
-            osp::Vector3 &rNormal = rGeom.sharedNormalSum[rContrib.shared];
-            rNormal -= rContrib.sum;
-            rChSP.sharedNormalsDirty.set(rContrib.shared.value);
+            if ( ! rContrib.shared.has_value() )
+            {
+                break;
+            }
+
+            if (rSkCh.m_sharedIds.exists(rContrib.shared) && ! rChSP.sharedRemoved.test(rContrib.shared.value))
+            {
+                osp::Vector3 &rNormal = sharedNormalSum[rContrib.shared.value];
+                rNormal -= rContrib.sum;
+                rSharedNormalsDirty.set(rContrib.shared.value);
+            }
+            rContrib.sum *= 0.0f;
         }
-        rContrib.sum *= 0.0f;
     }
 
-    if ( ! onlySubtractFans )
+    if (subtractFill)
     {
         // Subtract Fill shared vertex normal contributions
         auto const chunkFillNormalContrib2D = as_2d(arrayView(rGeom.chunkFillSharedNormals), rSkCh.m_chunkSharedCount);
@@ -357,31 +523,120 @@ void subtract_normal_contrib(
             if (rSkCh.m_sharedIds.exists(shared) && ! rChSP.sharedRemoved.test(shared.value))
             {
                 Vector3 const &contrib = fillNormalContrib[i];
-                Vector3       &rNormal = rGeom.sharedNormalSum[shared];
+                Vector3       &rNormal = sharedNormalSum[shared.value];
                 rNormal -= contrib;
-                rChSP.sharedNormalsDirty.set(shared.value);
+                rSharedNormalsDirty.set(shared.value);
             }
             fillNormalContrib[i] *= 0.0f;
         }
     }
 }
 
-void debug_check_invariants(
-        BasicChunkMeshGeometry        const &rGeom,
+void rebuild_shared_normal_sums(
+        BasicChunkMeshGeometry              &rGeom,
         ChunkMeshBufferInfo           const &rChInfo,
         ChunkSkeleton                 const &rSkCh)
 {
-    auto const check_vertex = [&] (VertexIdx vertex, SharedVrtxId sharedId, ChunkId chunkId)
+    for (std::size_t const sharedInt : rSkCh.m_sharedIds.bitview().zeros())
     {
-        osp::Vector3 const normal = rGeom.chunkVbufNrm[vertex];
-        float   const length = normal.length();
+        rGeom.sharedNormalSum[SharedVrtxId(sharedInt)] = Vector3{ZeroInit};
+    }
 
-        LGRN_ASSERTMV(std::abs(length - 1.0f) < 0.05f, "Normal isn't normalized", length, vertex, sharedId.value, chunkId.value);
-    };
+    auto const chunkFanNormalContrib2D  = as_2d(arrayView(rGeom.chunkFanNormalContrib),  rChInfo.fanMaxSharedCount);
+    auto const chunkFillNormalContrib2D = as_2d(arrayView(rGeom.chunkFillSharedNormals), rSkCh.m_chunkSharedCount);
+
+    for (std::size_t const chunkInt : rSkCh.m_chunkIds.bitview().zeros())
+    {
+        auto const chunkId = ChunkId(chunkInt);
+
+        auto const sharedUsed        = rSkCh.shared_vertices_used(chunkId);
+        auto const fillNormalContrib = chunkFillNormalContrib2D.row(chunkInt);
+
+        for (std::size_t i = 0; i < sharedUsed.size(); ++i)
+        {
+            SharedVrtxId const shared = sharedUsed[i].value();
+            if ( ! shared.has_value() )
+            {
+                break;
+            }
+            rGeom.sharedNormalSum[shared] += fillNormalContrib[i];
+        }
+
+        auto const fanNormalContrib = chunkFanNormalContrib2D.row(chunkInt);
+        for (int segment = 0; segment < 6; ++segment)
+        {
+            auto const segContrib = fanNormalContrib.sliceSize(
+                    rChInfo.fan_segment_contrib_offset(segment),
+                    rChInfo.fan_segment_contrib_capacity(segment));
+
+            for (FanNormalContrib const &rContrib : segContrib)
+            {
+                if ( ! rContrib.shared.has_value() )
+                {
+                    break;
+                }
+                // Subtracted entries keep their shared id with a zeroed sum; adding them is
+                // harmless
+                rGeom.sharedNormalSum[rContrib.shared] += rContrib.sum;
+            }
+        }
+    }
+
+    for (std::size_t const sharedInt : rSkCh.m_sharedIds.bitview().zeros())
+    {
+        rGeom.chunkVbufNrm[rChInfo.vbufSharedOffset + sharedInt]
+                = rGeom.sharedNormalSum[SharedVrtxId(sharedInt)].normalized();
+    }
+}
+
+void normalize_batched(ArrayView<Vector3> const vectors) noexcept
+{
+    constexpr std::size_t lanes = 8;
+
+    std::size_t const batched = vectors.size() - (vectors.size() % lanes);
+
+    for (std::size_t i = 0; i < batched; i += lanes)
+    {
+        std::array<float, lanes> invLen;
+
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            Vector3 const v = vectors[i + lane];
+            invLen[lane] = 1.0f / std::sqrt(v.x()*v.x() + v.y()*v.y() + v.z()*v.z());
+        }
+
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            vectors[i + lane] *= invLen[lane];
+        }
+    }
+
+    for (std::size_t i = batched; i < vectors.size(); ++i)
+    {
+        vectors[i] = vectors[i].normalized();
+    }
+}
+
+static void check_vertex_normal(
+        BasicChunkMeshGeometry        const &rGeom,
+        VertexIdx                     const vertex,
+        SharedVrtxId                  const sharedId,
+        ChunkId                       const chunkId)
+{
+    osp::Vector3 const normal = rGeom.chunkVbufNrm[vertex];
+    float   const length = normal.length();
 
+    LGRN_ASSERTMV(std::abs(length - 1.0f) < 0.05f, "Normal isn't normalized", length, vertex, sharedId.value, chunkId.value);
+}
+
+void debug_check_invariants(
+        BasicChunkMeshGeometry        const &rGeom,
+        ChunkMeshBufferInfo           const &rChInfo,
+        ChunkSkeleton                 const &rSkCh)
+{
     for (std::size_t const sharedInt : rSkCh.m_sharedIds.bitview().zeros())
     {
-        check_vertex(rChInfo.vbufSharedOffset + sharedInt, SharedVrtxId(sharedInt), {});
+        check_vertex_normal(rGeom, rChInfo.vbufSharedOffset + sharedInt, SharedVrtxId(sharedInt), {});
     }
 
     for (std::size_t const chunkInt : rSkCh.m_chunkIds.bitview().zeros())
@@ -391,7 +646,50 @@ void debug_check_invariants(
 
         for (VertexIdx vertex = first; vertex < last; ++vertex)
         {
-            check_vertex(vertex, {}, ChunkId(chunkInt));
+            check_vertex_normal(rGeom, vertex, {}, ChunkId(chunkInt));
+        }
+    }
+}
+
+void debug_check_invariants_sampled(
+        BasicChunkMeshGeometry        const &rGeom,
+        ChunkMeshBufferInfo           const &rChInfo,
+        ChunkSkeleton                 const &rSkCh,
+        std::uint32_t                 const maxChunks,
+        std::uint32_t                       &rRotation)
+{
+    auto const capacity = std::uint32_t(rSkCh.m_chunkIds.capacity());
+    if (capacity == 0)
+    {
+        return;
+    }
+
+    rRotation %= capacity; // Capacity may have grown since the last call
+
+    for (std::uint32_t n = 0; n < std::min(maxChunks, capacity); ++n)
+    {
+        ChunkId const chunkId = ChunkId(rRotation);
+        rRotation = (rRotation + 1 == capacity) ? 0 : (rRotation + 1);
+
+        if ( ! rSkCh.m_chunkIds.exists(chunkId) )
+        {
+            continue;
+        }
+
+        VertexIdx const first = rChInfo.vbufFillOffset + chunkId.value * rChInfo.fillVrtxCount;
+        VertexIdx const last  = first + rChInfo.fillVrtxCount;
+
+        for (VertexIdx vertex = first; vertex < last; ++vertex)
+        {
+            check_vertex_normal(rGeom, vertex, {}, chunkId);
+        }
+
+        // Shared vertices are reached through the chunks using them, so each gets checked at
+        // least as often as its chunks come around in the rotation
+        for (SharedVrtxOwner_t const &sharedUsed : rSkCh.shared_vertices_used(chunkId))
+        {
+            SharedVrtxId const sharedId = sharedUsed.value();
+            check_vertex_normal(rGeom, rChInfo.vbufSharedOffset + sharedId.value, sharedId, chunkId);
         }
     }
 }
@@ -438,4 +736,91 @@ void write_obj(
 }
 
 
+// Binary snapshot layout; see write_snapshot in chunk_generate.h
+struct SnapshotHeader
+{
+    static constexpr std::array<char, 8> smc_magic{{'O','S','P','T','M','S','H','\0'}};
+    static constexpr std::uint32_t       smc_version{1};
+
+    std::array<char, 8> magic;
+    std::uint32_t       version;
+    std::uint32_t       vrtxCount;
+    std::uint32_t       faceCount;
+    std::uint32_t       chunkCount;
+    std::uint32_t       sharedCount;
+};
+
+template <typename T>
+static void write_block(std::ostream &rStream, std::vector<T> const &vec)
+{
+    rStream.write(reinterpret_cast<char const*>(vec.data()),
+                  std::streamsize(vec.size() * sizeof(T)));
+}
+
+template <typename T>
+static bool read_block(std::istream &rStream, std::vector<T> &rVec, std::uint32_t const count)
+{
+    rVec.resize(count);
+    rStream.read(reinterpret_cast<char*>(rVec.data()), std::streamsize(count * sizeof(T)));
+    return bool(rStream);
+}
+
+void write_snapshot(
+        std::ostream                        &rStream,
+        BasicChunkMeshGeometry        const &rGeom,
+        ChunkSkeleton                 const &rSkCh)
+{
+    std::vector<std::uint32_t> chunkIds;
+    chunkIds.reserve(rSkCh.m_chunkIds.size());
+    for (std::size_t const chunkInt : rSkCh.m_chunkIds.bitview().zeros())
+    {
+        chunkIds.push_back(std::uint32_t(chunkInt));
+    }
+
+    std::vector<std::uint32_t> sharedIds;
+    sharedIds.reserve(rSkCh.m_sharedIds.size());
+    for (std::size_t const sharedInt : rSkCh.m_sharedIds.bitview().zeros())
+    {
+        sharedIds.push_back(std::uint32_t(sharedInt));
+    }
+
+    SnapshotHeader header;
+    header.magic       = SnapshotHeader::smc_magic;
+    header.version     = SnapshotHeader::smc_version;
+    header.vrtxCount   = std::uint32_t(rGeom.chunkVbufPos.size());
+    header.faceCount   = std::uint32_t(rGeom.chunkIbuf.size());
+    header.chunkCount  = std::uint32_t(chunkIds.size());
+    header.sharedCount = std::uint32_t(sharedIds.size());
+
+    rStream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    write_block(rStream, chunkIds);
+    write_block(rStream, sharedIds);
+    write_block(rStream, rGeom.chunkVbufPos);
+    write_block(rStream, rGeom.chunkVbufNrm);
+    write_block(rStream, rGeom.chunkIbuf);
+}
+
+bool read_snapshot(
+        std::istream                        &rStream,
+        BasicChunkMeshGeometry              &rGeom,
+        MeshSnapshotInfo                    &rInfo)
+{
+    SnapshotHeader header;
+    rStream.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    if (   ! rStream
+        || std::memcmp(header.magic.data(), SnapshotHeader::smc_magic.data(), sizeof(header.magic)) != 0
+        || header.version != SnapshotHeader::smc_version)
+    {
+        return false;
+    }
+
+    return read_block(rStream, rInfo.chunkIds,    header.chunkCount)
+        && read_block(rStream, rInfo.sharedIds,   header.sharedCount)
+        && read_block(rStream, rGeom.chunkVbufPos, header.vrtxCount)
+        && read_block(rStream, rGeom.chunkVbufNrm, header.vrtxCount)
+        && read_block(rStream, rGeom.chunkIbuf,    header.faceCount);
+}
+
+
 } // namespace planeta
@@ -31,15 +31,36 @@
 #include "skeleton.h"
 #include "geometry.h"
 
+#include <iosfwd>
+
 namespace planeta
 {
 
+/**
+ * @brief Per-worker staging for shared vertex normal sums written during update_faces_parallel
+ *
+ * Shared vertex normal sums are the only cross-chunk writes in update_faces; workers accumulate
+ * them here instead, and the calling thread splices the deltas into
+ * \c BasicChunkMeshGeometry::sharedNormalSum once all workers finish. sharedNormalDelta is
+ * all-zero outside of bits set in sharedDirty.
+ */
+struct ChunkNormalStaging
+{
+    osp::KeyedVec<SharedVrtxId, osp::Vector3>   sharedNormalDelta;
+    osp::BitVector_t                            sharedDirty;
+};
+
 struct ChunkScratchpad
 {
     void resize(ChunkSkeleton const& rChSk);
 
-    /// Lookup table to help calculate 'Fill' vertices for chunks
-    ChunkFillSubdivLUT lut;
+    /// Lookup table to help calculate 'Fill' vertices for chunks; read-only and shared between
+    /// all terrain instances of the same subdivision level, see get_chunk_vrtx_subdiv_lut
+    std::shared_ptr<ChunkFillSubdivLUT const> lut;
+
+    /// Pre-generated fan face patterns replayed when stitching chunk edges; shared per
+    /// subdivision level like lut, see get_chunk_fan_stitch_lut
+    std::shared_ptr<ChunkFanStitchLUT const> stitchLut;
 
     /// Temporary vector for storing sections of shared vertices
     std::vector< osp::MaybeNewId<SkVrtxId> > edgeVertices;
@@ -58,6 +79,18 @@ struct ChunkScratchpad
 
     /// Shared vertices that need to recalculate normals
     osp::BitVector_t sharedNormalsDirty;
+
+    /// Chunks for update_faces_parallel to process this update
+    std::vector<ChunkId> chunksToUpdate;
+
+    /// Per-worker normal sum staging for update_faces_parallel
+    std::vector<ChunkNormalStaging> normalStaging;
+
+    /// Rotation cursor for debug_check_invariants_sampled
+    std::uint32_t invariantCheckRotate {0};
+
+    /// Updates since the last rebuild_shared_normal_sums call
+    std::uint32_t normalRebuildTimer {0};
 };
 
 /**
@@ -78,6 +111,10 @@ void restitch_check(
  *
  * Fan triangles will be generated for newly added chunks. Fan triangles will be added or replaced
  * if a chunk command is enabled.
+ *
+ * Shared vertex normal sums are accumulated into the given sharedNormalSum / rSharedNormalsDirty,
+ * which is either \c BasicChunkMeshGeometry::sharedNormalSum directly, or a worker's
+ * \c ChunkNormalStaging when called through update_faces_parallel.
  */
 void update_faces(
         ChunkId                         chunkId,
@@ -87,23 +124,74 @@ void update_faces(
         SkeletonVertexData        const &rSkData,
         BasicChunkMeshGeometry          &rGeom,
         ChunkMeshBufferInfo       const &rChInfo,
+        osp::ArrayView<osp::Vector3>    sharedNormalSum,
+        osp::BitVector_t                &rSharedNormalsDirty,
+        ChunkScratchpad                 &rChSP,
+        ChunkSkeleton                   &rSkCh);
+
+/**
+ * @brief Run update_faces for every chunk, split across worker threads
+ *
+ * Per-chunk outputs (index buffer rows, fill normals, fan normal contributions, stitches) are
+ * disjoint between chunks, so chunks are simply partitioned across threads. The one cross-chunk
+ * write, shared vertex normal sums, goes through per-worker ChunkNormalStaging; the calling
+ * thread splices the staged deltas into rGeom.sharedNormalSum after workers finish, keeping the
+ * expensive per-vertex and per-face work off the critical path.
+ */
+void update_faces_parallel(
+        osp::BitVector_t          const &surfaceAdded,
+        SubdivTriangleSkeleton          &rSkel,
+        SkeletonVertexData        const &rSkData,
+        BasicChunkMeshGeometry          &rGeom,
+        ChunkMeshBufferInfo       const &rChInfo,
         ChunkScratchpad                 &rChSP,
         ChunkSkeleton                   &rSkCh);
 
 /**
- * @brief Subtract normals from connected shared vertices when removing a chunk, or fan triangles
- *        only if fans are being redone.
+ * @brief Subtract normals from connected shared vertices when removing a chunk, or only the fan
+ *        segments being redone.
  *
- * \c see BasicChunkMeshGeometry::sharedNormalSum
+ * Bits [0, 6) of fanSegments select which fan segments to subtract (see \c ChunkMeshBufferInfo);
+ * pass 0b111111 plus subtractFill when removing a whole chunk. \c see
+ * BasicChunkMeshGeometry::sharedNormalSum
  */
 void subtract_normal_contrib(
         ChunkId                         chunkId,
-        bool                            onlySubtractFans,
+        std::uint8_t                    fanSegments,
+        bool                            subtractFill,
         BasicChunkMeshGeometry          &rGeom,
         ChunkMeshBufferInfo       const &rChInfo,
+        osp::ArrayView<osp::Vector3>    sharedNormalSum,
+        osp::BitVector_t                &rSharedNormalsDirty,
         ChunkScratchpad                 &rChSP,
         ChunkSkeleton             const &rSkCh);
 
+/**
+ * @brief Recompute every shared vertex normal sum exactly from stored per-chunk contributions
+ *
+ * sharedNormalSum is maintained incrementally: update_faces adds contributions and
+ * subtract_normal_contrib removes them, and each add/subtract pair leaves a small floating
+ * point residue. Long-lived shared vertices near a moving viewer go through many such cycles,
+ * slowly drifting seam normals away from the true face normal sum. This overwrites the sums
+ * with a fresh walk over every existing chunk's fill and fan contribution rows (the same values
+ * the subtract pass uses) and refreshes the shared section of the normal vertex buffer, so it
+ * only needs to run occasionally.
+ */
+void rebuild_shared_normal_sums(
+        BasicChunkMeshGeometry          &rGeom,
+        ChunkMeshBufferInfo       const &rChInfo,
+        ChunkSkeleton             const &rSkCh);
+
+/**
+ * @brief Normalize a contiguous run of vectors, eight at a time
+ *
+ * Splitting the work into fixed-width blocks of length and multiply phases keeps each phase a
+ * straight-line loop the compiler can vectorize for whichever SIMD width the target has (AVX2,
+ * NEON, ...), without committing to intrinsics for any one of them. Use for per-vertex normal
+ * passes over BasicChunkMeshGeometry buffers; all input vectors must be non-zero.
+ */
+void normalize_batched(osp::ArrayView<osp::Vector3> vectors) noexcept;
+
 /**
  * @brief Does asserts, checks if chunk normals are normalized
  */
@@ -112,6 +200,21 @@ void debug_check_invariants(
         ChunkMeshBufferInfo       const &rChInfo,
         ChunkSkeleton             const &rSkCh);
 
+/**
+ * @brief Sampled variant of debug_check_invariants, checking maxChunks chunks per call
+ *
+ * Walks a rotating window of the chunk ID space starting at rRotation, checking each existing
+ * chunk's fill vertices plus the shared vertices it uses, then advances rRotation. Repeated
+ * calls cover everything eventually at a fraction of the full walk's cost, so this can stay
+ * enabled in production-debug builds (see the OSP_TERRAIN_INVARIANT_CHECKS build option).
+ */
+void debug_check_invariants_sampled(
+        BasicChunkMeshGeometry    const &rGeom,
+        ChunkMeshBufferInfo       const &rChInfo,
+        ChunkSkeleton             const &rSkCh,
+        std::uint32_t                   maxChunks,
+        std::uint32_t                   &rRotation);
+
 /**
  * @brief Write chunk mesh in wavefront .obj format
  */
@@ -121,4 +224,42 @@ void write_obj(
         ChunkMeshBufferInfo       const &rChInfo,
         ChunkSkeleton             const &rSkCh);
 
+/**
+ * @brief Which chunks and shared vertices existed when a mesh snapshot was captured
+ *
+ * Vertex and index buffer rows outside these hold stale leftover data; diff tooling should mask
+ * them out.
+ */
+struct MeshSnapshotInfo
+{
+    std::vector<std::uint32_t> chunkIds;
+    std::vector<std::uint32_t> sharedIds;
+};
+
+/**
+ * @brief Write chunk mesh as a compact binary snapshot
+ *
+ * Unlike write_obj, buffers are written directly from BasicChunkMeshGeometry's contiguous
+ * arrays with no per-element formatting, so capturing a deep planet takes memcpy-speed writes
+ * instead of seconds of ASCII conversion. Layout: header with magic/version and element counts,
+ * the existing chunk and shared vertex ID lists (see MeshSnapshotInfo), then raw position,
+ * normal, and index blocks. Fields are native-endian; snapshots are for capture/diff on the
+ * machine family that wrote them, not an interchange format.
+ */
+void write_snapshot(
+        std::ostream                    &rStream,
+        BasicChunkMeshGeometry    const &rGeom,
+        ChunkSkeleton             const &rSkCh);
+
+/**
+ * @brief Load a snapshot written by write_snapshot
+ *
+ * Resizes and fills rGeom's position/normal/index buffers only; normal contribution and
+ * skeleton state are not captured. Returns false on bad magic, version mismatch, or truncation.
+ */
+bool read_snapshot(
+        std::istream                    &rStream,
+        BasicChunkMeshGeometry          &rGeom,
+        MeshSnapshotInfo                &rInfo);
+
 } // namespace planeta
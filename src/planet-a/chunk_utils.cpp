@@ -25,6 +25,8 @@
 
 #include "chunk_utils.h"
 
+#include <mutex>
+
 
 namespace planeta
 {
@@ -51,6 +53,188 @@ ChunkFillSubdivLUT make_chunk_vrtx_subdiv_lut(std::uint8_t const subdivLevel)
     // by accessing to fill vertices in a more sequential order.
 }
 
+std::shared_ptr<ChunkFillSubdivLUT const> get_chunk_vrtx_subdiv_lut(std::uint8_t const subdivLevel)
+{
+    // One cache slot per practical subdivision level. weak_ptr so a LUT is rebuilt on demand but
+    // freed once the last terrain instance using its level is gone.
+    static std::array<std::weak_ptr<ChunkFillSubdivLUT const>,
+                      ChunkMeshBufferInfo::smc_fanFacesVsSubdivLevel.size()> cache;
+    static std::mutex cacheMutex;
+
+    LGRN_ASSERT(subdivLevel < cache.size());
+
+    std::lock_guard<std::mutex> const lock{cacheMutex};
+
+    std::weak_ptr<ChunkFillSubdivLUT const> &rSlot = cache[subdivLevel];
+
+    if (std::shared_ptr<ChunkFillSubdivLUT const> existing = rSlot.lock())
+    {
+        return existing;
+    }
+
+    auto built = std::make_shared<ChunkFillSubdivLUT const>(make_chunk_vrtx_subdiv_lut(subdivLevel));
+    rSlot = built;
+    return built;
+}
+
+ChunkFanStitchLUT make_chunk_fan_stitch_lut(std::uint8_t const subdivLevel)
+{
+    using ESource = FanVrtxRef::ESource;
+    using enum ECornerDetailX2;
+
+    ChunkFanStitchLUT out;
+
+    int const chunkWidth = 1 << subdivLevel;
+    int const fillWidth  = chunkWidth - 2;
+
+    auto const chunk_shared = [] (int const slot) noexcept
+    {
+        return FanVrtxRef{ESource::ChunkShared, std::uint16_t(slot)};
+    };
+
+    // ## Corner patterns
+    //
+    // A chunk corner consists of 3 chunk-local shared vertices:
+    //
+    //          [1]
+    //          . .
+    //         .   .
+    //        .     .
+    //      [2]-----[0]
+    //
+    // 'None' is the single triangle (0, 1, 2). When a touching edge is detailX2, the corner
+    // splits into 2 triangles around the higher-detail neighbor's midpoint vertex: 'Left'
+    // splits the 1-2 side using the last vertex of edge row 1, 'Right' splits the 0-1 side
+    // using the second vertex of edge row 0.
+    for (int k = 0; k < 3; ++k)
+    {
+        std::array<int, 3> const tri
+        {
+            ((k == 0) ? 3 : k) * chunkWidth - 1,
+            k * chunkWidth,
+            k * chunkWidth + 1
+        };
+
+        FanVrtxRef const c0     = chunk_shared(tri[0]);
+        FanVrtxRef const c1     = chunk_shared(tri[1]);
+        FanVrtxRef const c2     = chunk_shared(tri[2]);
+        FanVrtxRef const midLft = {ESource::X2Edge1, std::uint16_t(chunkWidth - 1)};
+        FanVrtxRef const midRte = {ESource::X2Edge0, 1};
+
+        out.m_corners[std::size_t(k)*3u + std::size_t(None)]  = { {c0, c1, c2} };
+        out.m_corners[std::size_t(k)*3u + std::size_t(Left)]  = { {c0, c1, midLft},
+                                                                  {c0, midLft, c2} };
+        out.m_corners[std::size_t(k)*3u + std::size_t(Right)] = { {c2, midRte, c1},
+                                                                  {c2, c0, midRte} };
+    }
+
+    // ## Edge patterns
+    //
+    // Walk fillWidth steps along the edge; each step spans two consecutive chunk-local shared
+    // vertices (A, B) and one fill vertex (C). Plain stitches emit one triangle per step;
+    // detailX2 stitches split each around the higher-detail neighbor's midpoint: the first
+    // half of the walk takes midpoints from edge row 1 backwards, the second half from edge
+    // row 0 (matching how update_faces assembles detailX2Edge0/1 from the two child chunks).
+    for (int side = 0; side < 3; ++side)
+    {
+        std::vector<FanFacePattern> &rPlain = out.m_edges[std::size_t(side)*2u + 0u];
+        std::vector<FanFacePattern> &rX2    = out.m_edges[std::size_t(side)*2u + 1u];
+        rPlain.reserve(std::size_t(fillWidth));
+        rX2   .reserve(std::size_t(fillWidth) * 2u);
+
+        int sharedLocalA   = side*chunkWidth + 1;
+        int sharedLocalB   = side*chunkWidth + 2;
+        int fillTriangular {};
+        int triRowSize     {};
+
+        if (side == 0)
+        {
+            fillTriangular = xy_to_triangular(0, 0);
+            triRowSize = 1;
+        }
+        else if (side == 1)
+        {
+            fillTriangular = xy_to_triangular(0, fillWidth-1);
+            // triRowSize = don't care
+        }
+        else // side == 2
+        {
+            fillTriangular = xy_to_triangular(fillWidth-1, fillWidth-1);
+            triRowSize = fillWidth;
+        }
+
+        ESource x2Source = ESource::X2Edge1;
+        int     x2Slot   = chunkWidth - 3;
+
+        for (int i = 0; i < fillWidth; ++i)
+        {
+            if (i == fillWidth/2)
+            {
+                x2Source = ESource::X2Edge0;
+                x2Slot   = chunkWidth - 1;
+            }
+
+            FanVrtxRef const refA   = chunk_shared(sharedLocalA);
+            FanVrtxRef const refB   = chunk_shared(sharedLocalB);
+            FanVrtxRef const refC   = {ESource::Fill, std::uint16_t(fillTriangular)};
+            FanVrtxRef const refMid = {x2Source, std::uint16_t(x2Slot)};
+
+            //    A              A
+            //   / \            / \
+            //  /   \          /  MID
+            // C-----B        / _-' \
+            //               C'------B
+            rPlain.push_back({refA, refB, refC});
+            rX2   .push_back({refA, refMid, refC});
+            rX2   .push_back({refC, refMid, refB});
+
+            x2Slot -= 2;
+            ++sharedLocalA;
+            ++sharedLocalB;
+
+            if (side == 0)
+            {
+                fillTriangular += triRowSize;
+                ++triRowSize;
+            }
+            else if (side == 1)
+            {
+                fillTriangular += 1;
+            }
+            else // side == 2
+            {
+                fillTriangular -= triRowSize;
+                --triRowSize;
+            }
+        }
+    }
+
+    return out;
+}
+
+std::shared_ptr<ChunkFanStitchLUT const> get_chunk_fan_stitch_lut(std::uint8_t const subdivLevel)
+{
+    // Same weak_ptr cache scheme as get_chunk_vrtx_subdiv_lut above
+    static std::array<std::weak_ptr<ChunkFanStitchLUT const>,
+                      ChunkMeshBufferInfo::smc_fanFacesVsSubdivLevel.size()> cache;
+    static std::mutex cacheMutex;
+
+    LGRN_ASSERT(subdivLevel < cache.size());
+
+    std::lock_guard<std::mutex> const lock{cacheMutex};
+
+    std::weak_ptr<ChunkFanStitchLUT const> &rSlot = cache[subdivLevel];
+
+    if (std::shared_ptr<ChunkFanStitchLUT const> existing = rSlot.lock())
+    {
+        return existing;
+    }
+
+    auto built = std::make_shared<ChunkFanStitchLUT const>(make_chunk_fan_stitch_lut(subdivLevel));
+    rSlot = built;
+    return built;
+}
+
 void ChunkFillSubdivLUT::subdiv_line_recurse(
         Vector2us const a, Vector2us const b, std::uint8_t const level)
 {
@@ -36,6 +36,11 @@
 
 #include <osp/core/math_types.h>
 
+#include <Corrade/Containers/ArrayViewStl.h>
+
+#include <memory>
+#include <type_traits>
+
 
 namespace planeta
 {
@@ -79,6 +84,39 @@ struct ChunkMeshBufferInfo
     /// Max total faces per chunk. fillFaceCount + fanMaxFaceCount
     std::uint32_t chunkMaxFaceCount;
 
+    /// Fan faces and their FanNormalContrib entries are stored in 6 fixed-capacity segments per
+    /// chunk, in order: corner 0, edge 0, corner 1, edge 1, corner 2, edge 2. Fixed offsets let a
+    /// single border be restitched in place without rewriting the other two; unused capacity is
+    /// zero-filled, and zeroed faces are degenerate so they draw nothing.
+    std::uint32_t fanCornerFaceCapacity;
+    std::uint32_t fanEdgeFaceCapacity;
+    std::uint32_t fanCornerContribCapacity;
+    std::uint32_t fanEdgeContribCapacity;
+
+    /// Face offset of fan segment [0, 6) relative to the start of the chunk's fan region
+    constexpr std::uint32_t fan_segment_face_offset(int const segment) const noexcept
+    {
+        return std::uint32_t(segment/2) * (fanCornerFaceCapacity + fanEdgeFaceCapacity)
+             + std::uint32_t(segment%2) * fanCornerFaceCapacity;
+    }
+
+    constexpr std::uint32_t fan_segment_face_capacity(int const segment) const noexcept
+    {
+        return (segment%2 == 0) ? fanCornerFaceCapacity : fanEdgeFaceCapacity;
+    }
+
+    /// FanNormalContrib offset of fan segment [0, 6) within the chunk's contrib row
+    constexpr std::uint32_t fan_segment_contrib_offset(int const segment) const noexcept
+    {
+        return std::uint32_t(segment/2) * (fanCornerContribCapacity + fanEdgeContribCapacity)
+             + std::uint32_t(segment%2) * fanCornerContribCapacity;
+    }
+
+    constexpr std::uint32_t fan_segment_contrib_capacity(int const segment) const noexcept
+    {
+        return (segment%2 == 0) ? fanCornerContribCapacity : fanEdgeContribCapacity;
+    }
+
     /// Index of first fill vertex within in vertex buffer
     std::uint32_t vbufFillOffset;
     /// Index of first shared vertex within in vertex buffer
@@ -94,23 +132,38 @@ constexpr ChunkMeshBufferInfo make_chunk_mesh_buffer_info(ChunkSkeleton const &s
     std::uint32_t const maxSharedVrtx = std::uint32_t(skChunks.m_sharedIds.capacity());
 
     std::uint32_t const chunkWidth        = skChunks.m_chunkEdgeVrtxCount;
+    std::uint32_t const fillWidth         = chunkWidth - 2;
     std::uint32_t const fillCount         = (chunkWidth-2)*(chunkWidth-1) / 2;
     std::uint32_t const fillTotal         = fillCount * maxChunks;
     std::uint32_t const fanFaceCount      = ChunkMeshBufferInfo::smc_fanFacesVsSubdivLevel[skChunks.m_chunkSubdivLevel];
     std::uint32_t const fillFaceCount     = chunkWidth*chunkWidth - fanFaceCount;
-    std::uint32_t const fanMaxFaceCount   = fanFaceCount + fanFaceCount/3 + 1;
-    std::uint32_t const fanMaxSharedCount = fanMaxFaceCount + 4;
+
+    // Per-segment capacities cover the detailX2 (two faces per step) case, so each segment can
+    // be rewritten individually regardless of which edge the stitch doubles. Contrib capacities
+    // carry extra slack: a detailX2 corner uses 4 distinct shared vertices and a detailX2 edge
+    // uses 2*fillWidth+1, and the writer's overflow assert requires one spare slot.
+    std::uint32_t const fanCornerFaceCapacity    = 2;
+    std::uint32_t const fanEdgeFaceCapacity      = 2 * fillWidth;
+    std::uint32_t const fanCornerContribCapacity = 6;
+    std::uint32_t const fanEdgeContribCapacity   = 2 * fillWidth + 4;
+
+    std::uint32_t const fanMaxFaceCount   = 3 * (fanCornerFaceCapacity + fanEdgeFaceCapacity);
+    std::uint32_t const fanMaxSharedCount = 3 * (fanCornerContribCapacity + fanEdgeContribCapacity);
 
     return
     {
-        .fillVrtxCount       = fillCount,
-        .fillFaceCount       = fillFaceCount,
-        .fanMaxFaceCount     = fanMaxFaceCount,
-        .fanMaxSharedCount   = fanMaxSharedCount,
-        .chunkMaxFaceCount   = fillFaceCount + fanMaxFaceCount,
-        .vbufFillOffset      = 0,
-        .vbufSharedOffset    = fillTotal,
-        .vbufSize            = std::uint32_t(fillTotal + maxSharedVrtx)
+        .fillVrtxCount            = fillCount,
+        .fillFaceCount            = fillFaceCount,
+        .fanMaxFaceCount          = fanMaxFaceCount,
+        .fanMaxSharedCount        = fanMaxSharedCount,
+        .chunkMaxFaceCount        = fillFaceCount + fanMaxFaceCount,
+        .fanCornerFaceCapacity    = fanCornerFaceCapacity,
+        .fanEdgeFaceCapacity      = fanEdgeFaceCapacity,
+        .fanCornerContribCapacity = fanCornerContribCapacity,
+        .fanEdgeContribCapacity   = fanEdgeContribCapacity,
+        .vbufFillOffset           = 0,
+        .vbufSharedOffset         = fillTotal,
+        .vbufSize                 = std::uint32_t(fillTotal + maxSharedVrtx)
     };
 }
 
@@ -260,6 +313,17 @@ private:
 
 ChunkFillSubdivLUT make_chunk_vrtx_subdiv_lut(std::uint8_t subdivLevel);
 
+/**
+ * @brief Shared read-only ChunkFillSubdivLUT for a given subdivision level
+ *
+ * The LUT is identical for every chunk skeleton of the same subdivision level, so one immutable
+ * instance per level is built on first use and shared between all terrain instances and worker
+ * threads. The instance is freed once no terrain holds it anymore.
+ *
+ * Thread-safe.
+ */
+std::shared_ptr<ChunkFillSubdivLUT const> get_chunk_vrtx_subdiv_lut(std::uint8_t subdivLevel);
+
 
 //-----------------------------------------------------------------------------
 
@@ -272,20 +336,110 @@ concept CFaceWriter = requires(T t, VertexIdx idx)
     t.fill_add_normal_shared(idx, ChunkLocalSharedId{});
     t.fan_add_face(idx, idx, idx);
     t.fan_add_normal_shared(idx, SharedVrtxId{});
+    t.fan_segment_begin(int{});
+    t.fan_segment_end();
 };
 
+/**
+ * @brief Which fan segments must be rewritten for a set of changed chunk edges
+ *
+ * Bit k of dirtyEdges marks edge k as changed; returned bits [0, 6) follow the segment order of
+ * \c ChunkMeshBufferInfo. A changed edge rewrites its own segment plus both adjacent corners,
+ * since a corner's shape depends on whether either touching edge is detailX2.
+ */
+constexpr std::uint8_t fan_dirty_segments(std::uint8_t const dirtyEdges) noexcept
+{
+    std::uint8_t segments = 0;
+    for (int k = 0; k < 3; ++k)
+    {
+        if ((dirtyEdges & (1u << k)) != 0)
+        {
+            segments |= std::uint8_t(1u << (2*k));           // corner k
+            segments |= std::uint8_t(1u << (2*k + 1));       // edge k
+            segments |= std::uint8_t(1u << ((2*(k+1)) % 6)); // corner k+1
+        }
+    }
+    return segments;
+}
+
 enum class ECornerDetailX2 : int { None = 0, Right = 1, Left = 2 };
 
-template <CFaceWriter WRITER_T>
-struct ChunkFanStitcher
+/**
+ * @brief Where one fan face vertex comes from, in chunk-local terms
+ *
+ * Resolved to a real vertex buffer index per chunk when a stitch pattern is replayed
+ */
+struct FanVrtxRef
 {
-    template <int cornerIdx, ECornerDetailX2 detailX2>
-    inline void corner() const;
+    enum class ESource : std::uint8_t
+    {
+        ChunkShared,    ///< Chunk-local shared vertex slot [0, chunkWidth*3)
+        Fill,           ///< Fill vertex triangular index
+        X2Edge0,        ///< Slot within a detailX2 neighbor's shared vertex edge row 0
+        X2Edge1,        ///< Slot within a detailX2 neighbor's shared vertex edge row 1
+    };
 
-    template <int side, bool detailX2>
-    inline void edge() const;
+    ESource         source;
+    std::uint16_t   index;
+};
+
+/// One fan triangle in chunk-local terms
+using FanFacePattern = std::array<FanVrtxRef, 3>;
 
-    void stitch(ChunkStitch cmd) const;
+/**
+ * @brief Pre-generated fan face patterns for every stitch configuration of a subdivision level
+ *
+ * The stitch configuration space is small and finite: 3 corners x 3 corner detail cases plus
+ * 3 edges x 2 detail cases. The vertex walk that used to be re-derived with per-face branching
+ * on every stitch runs once per level here, recording each configuration's emission sequence;
+ * \c ChunkFanStitcher::stitch then replays the pattern as a flat loop, only mapping each
+ * FanVrtxRef through the chunk's shared vertex tables. Identical for every chunk skeleton of
+ * the same subdivision level, so one immutable instance per level is shared, like
+ * \c ChunkFillSubdivLUT.
+ */
+class ChunkFanStitchLUT
+{
+public:
+
+    osp::ArrayView<FanFacePattern const> corner(int const cornerIdx, ECornerDetailX2 const detail) const noexcept
+    {
+        return osp::arrayView(m_corners[std::size_t(cornerIdx)*3u + std::size_t(detail)]);
+    }
+
+    osp::ArrayView<FanFacePattern const> edge(int const side, bool const detailX2) const noexcept
+    {
+        return osp::arrayView(m_edges[std::size_t(side)*2u + std::size_t(detailX2)]);
+    }
+
+    friend ChunkFanStitchLUT make_chunk_fan_stitch_lut(std::uint8_t subdivLevel);
+
+private:
+
+    std::array<std::vector<FanFacePattern>, 3*3> m_corners;
+    std::array<std::vector<FanFacePattern>, 3*2> m_edges;
+
+}; // class ChunkFanStitchLUT
+
+ChunkFanStitchLUT make_chunk_fan_stitch_lut(std::uint8_t subdivLevel);
+
+/**
+ * @brief Shared read-only ChunkFanStitchLUT for a given subdivision level
+ *
+ * Same caching behaviour as get_chunk_vrtx_subdiv_lut. Thread-safe.
+ */
+std::shared_ptr<ChunkFanStitchLUT const> get_chunk_fan_stitch_lut(std::uint8_t subdivLevel);
+
+template <CFaceWriter WRITER_T>
+struct ChunkFanStitcher
+{
+    /**
+     * @brief Write fan faces for the segments of edges marked in dirtyEdges (all = 0b111)
+     *
+     * Replays the LUT pattern matching each segment's detail case. Each rewritten segment is
+     * positioned with writer.fan_segment_begin/end so untouched segments keep their faces and
+     * normal contributions.
+     */
+    void stitch(ChunkFanStitchLUT const &lut, ChunkStitch cmd, std::uint8_t dirtyEdges = 0b111) const;
 
     WRITER_T                            writer;
 
@@ -326,274 +480,82 @@ ChunkFanStitcher<WRITER_T> make_chunk_fan_stitcher(
 }
 
 template <CFaceWriter WRITER_T>
-void ChunkFanStitcher<WRITER_T>::stitch(ChunkStitch const cmd) const
+void ChunkFanStitcher<WRITER_T>::stitch(ChunkFanStitchLUT const &lut, ChunkStitch const cmd, std::uint8_t const dirtyEdges) const
 {
     using enum ECornerDetailX2;
 
-    if (cmd.detailX2)
+    // Corner k is 'Left' when edge k is detailX2, and 'Right' when the edge before it
+    // (edge (k+2)%3) is. This reproduces the Left/Right assignments of the old all-edges switch.
+    auto const corner_detail = [cmd] (int const k) noexcept -> ECornerDetailX2
     {
-        switch (cmd.x2ownEdge)
-        {
-        case 0: // DetailX2 Left edge
-            corner <0, Left >();
-            edge   <0, true >();
-            corner <1, Right>();
-            edge   <1, false>();
-            corner <2, None >();
-            edge   <2, false>();
-            break;
-        case 1: // DetailX2 Bottom edge
-            corner <0, None >();
-            edge   <0, false>();
-            corner <1, Left >();
-            edge   <1, true >();
-            corner <2, Right>();
-            edge   <2, false>();
-            break;
-        case 2: // DetailX2 Right edge
-            corner <0, Right>();
-            edge   <0, false>();
-            corner <1, None >();
-            edge   <1, false>();
-            corner <2, Left >();
-            edge   <2, true >();
-            break;
-        }
-    }
-    else // No DetailX2
-    {
-        corner <0, None>();
-        edge   <0, false>();
-        corner <1, None>();
-        edge   <1, false>();
-        corner <2, None>();
-        edge   <2, false>();
-    }
-}
-
-
-
-template <CFaceWriter WRITER_T>
-template <int cornerIdx, ECornerDetailX2 detailX2>
-void ChunkFanStitcher<WRITER_T>::corner() const
-{
-    // Chunk corner consists of 3 shared vertices
-    //
-    //          [1]
-    //          . .
-    //         .   .
-    //        .     .
-    //      [2]-----[0]
-    //     /   \   /   \
-    //    /     \ /     \
-    //   X-------X-------X  <-- don't care what's down heres
-    //
-    std::array<int, 3> tri;
-
-    // Figure out which 3 shared vertices make the chunk's corner
-    if constexpr (cornerIdx == 0)
-    {
-        tri = { chunkWidth*3-1, chunkWidth*0+0, chunkWidth*0+1 };
-    }
-    else if constexpr (cornerIdx == 1)
-    {
-        tri = { chunkWidth*1-1, chunkWidth*1+0, chunkWidth*1+1 };
-    }
-    else if constexpr (cornerIdx == 2)
-    {
-        tri = { chunkWidth*2-1, chunkWidth*2+0, chunkWidth*2+1 };
-    }
-
-    std::array<SharedVrtxId, 3> const triShared
-    {
-        chunkSharedVertices[tri[0]].value(),
-        chunkSharedVertices[tri[1]].value(),
-        chunkSharedVertices[tri[2]].value()
+        if ( ! cmd.detailX2 )             { return None;  }
+        if (cmd.x2ownEdge == k)           { return Left;  }
+        if (cmd.x2ownEdge == (k+2) % 3)   { return Right; }
+        return None;
     };
 
-    std::array<VertexIdx, 3> const triVrtx
-    {
-        sharedOffset + triShared[0].value,
-        sharedOffset + triShared[1].value,
-        sharedOffset + triShared[2].value
-    };
-
-    if (detailX2 == ECornerDetailX2::None)
-    {
-        // Add 1 triangle normally
-        //        1
-        //       / \
-        //      /   \
-        //     2-----0
-        writer.fan_add_face(triVrtx[0], triVrtx[1], triVrtx[2]);
-        writer.fan_add_normal_shared(triVrtx[0], triShared[0]);
-        writer.fan_add_normal_shared(triVrtx[1], triShared[1]);
-        writer.fan_add_normal_shared(triVrtx[2], triShared[2]);
-    }
-    else if constexpr (detailX2 == ECornerDetailX2::Left)
-    {
-        // Add 2 triangles: 'left' side has higher detail.
-        //             1
-        //            / \
-        //           /   \
-        //         MID    \
-        //         /  `-_  \
-        //        /      `-_\
-        //       2----------`0
-
-        SkVrtxId     const skelA    = rSkChunks.m_sharedToSkVrtx[triShared[1]];
-        SkVrtxId     const skelB    = rSkChunks.m_sharedToSkVrtx[triShared[2]];
-        SharedVrtxId const mid      = std::prev(detailX2Edge1.end())->value();
-        VertexIdx    const vrtxMid  = sharedOffset + mid.value;
-
-        writer.fan_add_face(triVrtx[0], triVrtx[1], vrtxMid);
-        writer.fan_add_normal_shared(triVrtx[0], triShared[0]);
-        writer.fan_add_normal_shared(triVrtx[1], triShared[1]);
-        writer.fan_add_normal_shared(vrtxMid, mid);
-
-        writer.fan_add_face(triVrtx[0], vrtxMid, triVrtx[2]);
-        writer.fan_add_normal_shared(triVrtx[0], triShared[0]);
-        writer.fan_add_normal_shared(vrtxMid, mid);
-        writer.fan_add_normal_shared(triVrtx[2], triShared[2]);
-    }
-    else if constexpr (detailX2 == ECornerDetailX2::Right)
-    {
-        // Add 2 triangles: 'right' side has higher detail
-        //             1
-        //            / \
-        //           /   \
-        //          /    MID
-        //         /  _-'  \
-        //        /_-'      \
-        //       2'----------0
-
-        SkVrtxId     const skelA   = rSkChunks.m_sharedToSkVrtx[triShared[1]];
-        SkVrtxId     const skelB   = rSkChunks.m_sharedToSkVrtx[triShared[2]];
-        SharedVrtxId const mid     = std::next(detailX2Edge0.begin())->value();
-        VertexIdx    const vrtxMid = sharedOffset + mid.value;
-
-        writer.fan_add_face(triVrtx[2], vrtxMid, triVrtx[1]);
-        writer.fan_add_normal_shared(triVrtx[2], triShared[2]);
-        writer.fan_add_normal_shared(vrtxMid, mid);
-        writer.fan_add_normal_shared(triVrtx[1], triShared[1]);
-
-        writer.fan_add_face(triVrtx[2], triVrtx[0], vrtxMid);
-        writer.fan_add_normal_shared(triVrtx[2], triShared[2]);
-        writer.fan_add_normal_shared(triVrtx[0], triShared[0]);
-        writer.fan_add_normal_shared(vrtxMid, mid);
-    }
-}
-
-template <CFaceWriter WRITER_T>
-template <int side, bool detailX2>
-void ChunkFanStitcher<WRITER_T>::edge() const
-{
-    int const fillWidth = rSkChunks.m_chunkEdgeVrtxCount - 2;
-
-    int sharedLocalA    {};
-    int sharedLocalB    {};
-    int fillTriangular  {};
-    int triRowSize      {};
-
-    sharedLocalA = side*chunkWidth + 1;
-    sharedLocalB = side*chunkWidth + 2;
+    std::uint8_t const dirtySegments = fan_dirty_segments(dirtyEdges);
 
-    if constexpr (side == 0)
-    {
-        fillTriangular = xy_to_triangular(0, 0);
-        triRowSize = 1;
-    }
-    else if constexpr (side == 1)
+    auto const replay = [this] (osp::ArrayView<FanFacePattern const> const pattern)
     {
-        fillTriangular = xy_to_triangular(0, fillWidth-1);
-        // triRowSize = don't care
-    }
-    else if constexpr (side == 2)
-    {
-        fillTriangular = xy_to_triangular(fillWidth-1, fillWidth-1);
-        triRowSize = fillWidth;
-    }
-
-    [[maybe_unused]] decltype(detailX2Edge0.begin()) detailX2It;
-
-    auto const process = [&] ()
-    {
-        SharedVrtxId const sharedA = chunkSharedVertices[sharedLocalA].value();
-        SharedVrtxId const sharedB = chunkSharedVertices[sharedLocalB].value();
-
-        VertexIdx const vrtxA = sharedOffset + sharedA.value;
-        VertexIdx const vrtxB = sharedOffset + sharedB.value;
-        VertexIdx const vrtxC = chunkFillOffset + fillTriangular;
-
-        if constexpr (detailX2)
+        for (FanFacePattern const &face : pattern)
         {
-            //         A
-            //        / \
-            //       /   \
-            //      /    MID
-            //     /  _-'  \
-            //    /_-'      \
-            //   C'----------B
-
-            SharedVrtxId const mid     = (*detailX2It).value();
-            VertexIdx    const vrtxMid = sharedOffset + mid.value;
-
-            writer.fan_add_face(vrtxA, vrtxMid, vrtxC);
-            writer.fan_add_normal_shared(vrtxA, sharedA);
-            writer.fan_add_normal_shared(vrtxMid, mid);
-
-            writer.fan_add_face(vrtxC, vrtxMid, vrtxB);
-            writer.fan_add_normal_shared(vrtxMid, mid);
-            writer.fan_add_normal_shared(vrtxB, sharedB);
-
-            std::advance(detailX2It, -2);
+            std::array<VertexIdx,    3> vrtx;
+            std::array<SharedVrtxId, 3> shared;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                FanVrtxRef const ref = face[i];
+                switch (ref.source)
+                {
+                case FanVrtxRef::ESource::Fill:
+                    shared[i] = {};
+                    vrtx[i]   = chunkFillOffset + ref.index;
+                    break;
+                case FanVrtxRef::ESource::ChunkShared:
+                    shared[i] = chunkSharedVertices[ref.index].value();
+                    vrtx[i]   = sharedOffset + shared[i].value;
+                    break;
+                case FanVrtxRef::ESource::X2Edge0:
+                    shared[i] = detailX2Edge0[ref.index].value();
+                    vrtx[i]   = sharedOffset + shared[i].value;
+                    break;
+                case FanVrtxRef::ESource::X2Edge1:
+                    shared[i] = detailX2Edge1[ref.index].value();
+                    vrtx[i]   = sharedOffset + shared[i].value;
+                    break;
+                }
+            }
+
+            writer.fan_add_face(vrtx[0], vrtx[1], vrtx[2]);
+
+            for (int i = 0; i < 3; ++i)
+            {
+                if (shared[i].has_value())
+                {
+                    writer.fan_add_normal_shared(vrtx[i], shared[i]);
+                }
+            }
         }
-        else
-        {
-            writer.fan_add_face(vrtxA, vrtxB, vrtxC);
-            writer.fan_add_normal_shared(vrtxA, sharedA);
-            writer.fan_add_normal_shared(vrtxB, sharedB);
-        }
-
-        ++sharedLocalA;
-        ++sharedLocalB;
+    };
 
-        if constexpr (side == 0)
-        {
-            fillTriangular += triRowSize;
-            ++triRowSize;
-        }
-        else if constexpr (side == 1)
+    for (int k = 0; k < 3; ++k)
+    {
+        if ((dirtySegments & (1u << (2*k))) != 0)
         {
-            fillTriangular += 1;
+            writer.fan_segment_begin(2*k);
+            replay(lut.corner(k, corner_detail(k)));
+            writer.fan_segment_end();
         }
-        else if constexpr (side == 2)
+        if ((dirtySegments & (1u << (2*k + 1))) != 0)
         {
-            fillTriangular -= triRowSize;
-            --triRowSize;
+            writer.fan_segment_begin(2*k + 1);
+            replay(lut.edge(k, cmd.detailX2 && (cmd.x2ownEdge == k)));
+            writer.fan_segment_end();
         }
-    };
-
-    if constexpr (detailX2)
-    {
-        detailX2It = std::prev(detailX2Edge1.end(), 3);
-    }
-
-    for (int i = 0; i < fillWidth/2; ++i)
-    {
-        process();
-    }
-
-    if constexpr (detailX2)
-    {
-        detailX2It = std::prev(detailX2Edge0.end());
-    }
-
-    for (int i = 0; i < fillWidth/2; ++i)
-    {
-        process();
     }
 }
 
 
+
 } // namespace planeta
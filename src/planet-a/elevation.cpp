@@ -0,0 +1,197 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "elevation.h"
+
+#include <longeron/utility/asserts.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using osp::arrayView;
+
+namespace planeta
+{
+
+float elevation_sample(ElevationTile const& tile, float const baryB, float const baryC) noexcept
+{
+    constexpr auto n = float(ElevationTile::smc_edgeCells);
+
+    // Row r is r/n of the way from the top vertex towards the bottom edge; within the row,
+    // index i runs from the 'Left' side towards the 'Right' corner.
+    int const row = std::clamp(int(std::lround((baryB + baryC) * n)), 0, int(ElevationTile::smc_edgeCells));
+    int const idx = std::clamp(int(std::lround(baryC * n)), 0, row);
+
+    return tile.samples[std::size_t(row) * std::size_t(row + 1) / 2 + std::size_t(idx)];
+}
+
+
+ElevationCache::~ElevationCache()
+{
+    stop();
+}
+
+void ElevationCache::start(LoadFunc_t const loader, void* const userData, std::uint32_t const maxResident)
+{
+    LGRN_ASSERTM( ! m_thread.joinable(), "Loader thread is already running");
+    LGRN_ASSERT(loader != nullptr && maxResident != 0);
+
+    m_loader         = loader;
+    m_loaderUserData = userData;
+    m_maxResident    = maxResident;
+    m_stop           = false;
+
+    m_thread = std::thread{&ElevationCache::loader_thread_main, this};
+}
+
+void ElevationCache::stop()
+{
+    if (m_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> const lock{m_mutex};
+            m_stop = true;
+        }
+        m_requestCv.notify_one();
+        m_thread.join();
+    }
+
+    m_requests.clear();
+    m_finished.clear();
+    m_loader = nullptr;
+
+    // Queued markers would otherwise block these tiles from ever being requested again
+    std::replace(m_tileSlots.begin(), m_tileSlots.end(), smc_slotQueued, smc_slotNone);
+}
+
+void ElevationCache::resize(SubdivTriangleSkeleton const &rSkel)
+{
+    m_tileSlots.resize(rSkel.tri_group_ids().capacity() * 4, smc_slotNone);
+}
+
+void ElevationCache::prefetch(SkTriId const sktri)
+{
+    std::uint32_t &rSlot = m_tileSlots[sktri];
+    if (rSlot != smc_slotNone)
+    {
+        return; // Already resident or queued
+    }
+    rSlot = smc_slotQueued;
+
+    {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        m_requests.push_back(sktri);
+    }
+    m_requestCv.notify_one();
+}
+
+void ElevationCache::update()
+{
+    std::vector<ElevationTile> finished;
+    {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        finished.swap(m_finished);
+    }
+
+    for (ElevationTile &rFinished : finished)
+    {
+        rFinished.lastUsed = m_useCounter;
+
+        std::uint32_t slot;
+        if ( ! m_tileSlotFree.empty() )
+        {
+            slot = m_tileSlotFree.back();
+            m_tileSlotFree.pop_back();
+            m_tiles[slot] = std::move(rFinished);
+        }
+        else
+        {
+            slot = std::uint32_t(m_tiles.size());
+            m_tiles.push_back(std::move(rFinished));
+        }
+
+        m_tileSlots[m_tiles[slot].sktri] = slot;
+    }
+
+    // Evict least-recently-sampled tiles while over budget
+    while (m_tiles.size() - m_tileSlotFree.size() > m_maxResident)
+    {
+        std::uint32_t evict    = smc_slotNone;
+        std::uint64_t evictUse = ~std::uint64_t(0);
+        for (std::uint32_t slot = 0; slot < m_tiles.size(); ++slot)
+        {
+            ElevationTile const &tile = m_tiles[slot];
+            if (tile.sktri.has_value() && tile.lastUsed < evictUse)
+            {
+                evict    = slot;
+                evictUse = tile.lastUsed;
+            }
+        }
+
+        m_tileSlots[m_tiles[evict].sktri] = smc_slotNone;
+        m_tiles[evict] = {};
+        m_tileSlotFree.push_back(evict);
+    }
+}
+
+ElevationTile const* ElevationCache::find_resident(SkTriId const sktri) noexcept
+{
+    std::uint32_t const slot = m_tileSlots[sktri];
+    if (slot >= smc_slotQueued)
+    {
+        return nullptr; // Not resident (smc_slotNone) or still loading (smc_slotQueued)
+    }
+
+    ElevationTile &rTile = m_tiles[slot];
+    rTile.lastUsed = ++m_useCounter;
+    return &rTile;
+}
+
+void ElevationCache::loader_thread_main()
+{
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (true)
+    {
+        m_requestCv.wait(lock, [this] { return m_stop || ! m_requests.empty(); });
+        if (m_stop)
+        {
+            return;
+        }
+
+        SkTriId const sktri = m_requests.back();
+        m_requests.pop_back();
+
+        lock.unlock();
+
+        ElevationTile tile{.sktri = sktri};
+        tile.samples.resize(ElevationTile::smc_sampleCount);
+        m_loader(sktri, arrayView(tile.samples), m_loaderUserData);
+
+        lock.lock();
+        m_finished.push_back(std::move(tile));
+    }
+}
+
+} // namespace planeta
@@ -0,0 +1,170 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2024 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/**
+ * @file
+ * @brief Tiled asynchronous elevation sampling for terrain chunk generation
+ */
+
+#include "skeleton.h"
+
+#include <osp/core/array_view.h>
+#include <osp/core/keyed_vector.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace planeta
+{
+
+/**
+ * @brief Elevation samples covering one skeleton triangle
+ *
+ * Samples form a triangular barycentric grid with smc_edgeCells cells along each edge, stored
+ * row by row from the triangle's top vertex: row r holds r+1 samples. Values are elevation in
+ * meters above the planet's base radius.
+ */
+struct ElevationTile
+{
+    static constexpr std::uint16_t smc_edgeCells   = 64;
+    static constexpr std::uint32_t smc_sampleCount
+            = std::uint32_t(smc_edgeCells+1) * std::uint32_t(smc_edgeCells+2) / 2;
+
+    SkTriId             sktri;
+    std::uint64_t       lastUsed{0};
+    std::vector<float>  samples;
+};
+
+/**
+ * @brief Nearest-sample elevation lookup within a tile
+ *
+ * @param baryB [in] Barycentric weight of the triangle's 'Left' corner (vertex 1)
+ * @param baryC [in] Barycentric weight of the triangle's 'Right' corner (vertex 2)
+ */
+float elevation_sample(ElevationTile const& tile, float baryB, float baryC) noexcept;
+
+/**
+ * @brief Bounded cache of ElevationTiles filled by a background loader thread
+ *
+ * Elevation datasets for a whole planet don't fit in RAM, so tiles are loaded on demand:
+ * prefetch() queues the tile covering a skeleton triangle (keyed by SkTriId at whatever level
+ * the caller tiles the dataset at), the loader thread fills it through the LoadFunc_t callback,
+ * and update() publishes finished tiles to the scene thread. find_resident() and
+ * elevation_sample never block, so chunk generation uses whatever is resident and keeps going;
+ * missing tiles simply mean the caller falls back (e.g. to the base radius) until a later
+ * update.
+ *
+ * The callback owns the actual I/O, so dataset formats — memory-mapped files included — plug in
+ * without this class knowing about them. When the resident budget is exceeded, the
+ * least-recently-sampled tile is evicted.
+ *
+ * start/stop, prefetch, update, and find_resident must all be called from the same (scene)
+ * thread; only the loader callback runs on the loader thread.
+ */
+class ElevationCache
+{
+public:
+
+    /// Fills samplesOut (ElevationTile::smc_sampleCount values, see ElevationTile layout) for
+    /// the given triangle. Runs on the loader thread; must only read data that outlives the
+    /// cache and stays constant while it runs.
+    using LoadFunc_t = void (*)(SkTriId sktri, osp::ArrayView<float> samplesOut, void* userData) noexcept;
+
+    ElevationCache() = default;
+    ElevationCache(ElevationCache const&) = delete;
+    ElevationCache& operator=(ElevationCache const&) = delete;
+    ~ElevationCache();
+
+    /**
+     * @brief Start the loader thread; the cache is inactive until this is called
+     *
+     * @param loader      [in] Tile load callback, see LoadFunc_t
+     * @param userData    [in] Passed through to the callback
+     * @param maxResident [in] Resident tile budget before least-recently-used eviction
+     */
+    void start(LoadFunc_t loader, void* userData, std::uint32_t maxResident);
+
+    /**
+     * @brief Stop and join the loader thread; pending requests are dropped
+     */
+    void stop();
+
+    bool active() const noexcept { return m_loader != nullptr; }
+
+    /**
+     * @brief Grow per-triangle bookkeeping to the skeleton's capacity
+     */
+    void resize(SubdivTriangleSkeleton const &rSkel);
+
+    /**
+     * @brief Queue loading the tile covering the given triangle; no-op if resident or queued
+     */
+    void prefetch(SkTriId sktri);
+
+    /**
+     * @brief Publish tiles the loader thread finished and evict over-budget ones
+     *
+     * Call once per scene update, before sampling.
+     */
+    void update();
+
+    /**
+     * @brief Get a resident tile, or nullptr if it hasn't loaded yet. Never blocks.
+     */
+    ElevationTile const* find_resident(SkTriId sktri) noexcept;
+
+private:
+
+    static constexpr std::uint32_t smc_slotNone   = 0xFFFFFFFF;
+    static constexpr std::uint32_t smc_slotQueued = 0xFFFFFFFE;
+
+    void loader_thread_main();
+
+    LoadFunc_t                          m_loader{nullptr};
+    void                                *m_loaderUserData{nullptr};
+    std::uint32_t                       m_maxResident{0};
+    std::uint64_t                       m_useCounter{0};
+
+    /// Resident tile slot per triangle, or smc_slotNone / smc_slotQueued
+    osp::KeyedVec<SkTriId, std::uint32_t> m_tileSlots;
+    std::vector<ElevationTile>          m_tiles;
+    std::vector<std::uint32_t>          m_tileSlotFree;
+
+    std::thread                         m_thread;
+
+    // Shared with the loader thread, guarded by m_mutex
+    std::mutex                          m_mutex;
+    std::condition_variable             m_requestCv;
+    std::vector<SkTriId>                m_requests;
+    std::vector<ElevationTile>          m_finished;
+    bool                                m_stop{false};
+
+}; // class ElevationCache
+
+} // namespace planeta
@@ -36,6 +36,7 @@ void BasicChunkMeshGeometry::resize(ChunkSkeleton const& skCh, ChunkMeshBufferIn
 
     chunkVbufPos           .resize(info.vbufSize);
     chunkVbufNrm           .resize(info.vbufSize);
+    chunkVbufMorphPos      .resize(info.vbufSize);
     chunkIbuf              .resize(maxChunks * info.chunkMaxFaceCount);
     chunkFanNormalContrib  .resize(maxChunks * info.fanMaxSharedCount);
     chunkFillSharedNormals .resize(maxChunks * skCh.m_chunkSharedCount, osp::Vector3{osp::ZeroInit});
@@ -75,9 +75,13 @@ struct FanNormalContrib
 /**
  * @brief Basic float vertex and index buffer for a chunk mesh.
  *
+ * Vertices along chunk borders are not duplicated: they live in a single shared vertex block at
+ * the start of the buffer (see ChunkMeshBufferInfo) and are indexed by every adjacent chunk, so
+ * seams need no welding and no extra vertex memory.
+ *
  * To be able to efficiently calculate vertex normals of shared vertices, all triangles connected
  * to shared vertices must add their normal contributions to \c sharedNormalSum, then remove their
- * contributions when deleted.
+ * contributions when deleted; see rebuild_shared_normal_sums for the drift this trades off.
  */
 struct BasicChunkMeshGeometry
 {
@@ -85,6 +89,13 @@ struct BasicChunkMeshGeometry
 
     std::vector<osp::Vector3>           chunkVbufPos;
     std::vector<osp::Vector3>           chunkVbufNrm;
+
+    /// Geomorph target: the position each vertex has on the parent subdivision level (midpoint
+    /// of the two vertices it was created between; own position for root vertices). A vertex
+    /// shader blending chunkVbufPos towards this by camera distance hides LOD transitions,
+    /// letting subdivision thresholds sit ~2x wider with no visible popping.
+    std::vector<osp::Vector3>           chunkVbufMorphPos;
+
     std::vector<osp::Vector3u>          chunkIbuf;
 
     /// See \c FanNormalContrib; 2D, each row is \c ChunkMeshBufferInfo::fanMaxSharedCount
@@ -149,20 +160,21 @@ struct TerrainFaceWriter
         // Record contributions to shared vertex normal, since this needs to be subtracted when
         // the associated chunk is removed or restitched.
 
-        // Find an existing FanNormalContrib for the given shared vertex.
-        // Since each triangle added is in contact with the previous triangle added, we only need
-        // to linear-search the previous few (4) contributions added. We also need to consider the
-        // first few (4), since the last triangle added will loop around and touch the start,
-        // forming a ring of triangles.
+        // Find an existing FanNormalContrib for the given shared vertex within the current fan
+        // segment. Since each triangle added is in contact with the previous triangle added, we
+        // only need to linear-search the previous few (4) contributions added. We also need to
+        // consider the first few (4), since triangles at segment boundaries touch the start.
+        // A shared vertex on the boundary between two segments gets an entry in each; both are
+        // subtracted when their segment is rewritten, so the split sum stays consistent.
         bool found = false;
         FanNormalContrib &rContrib = [this, shared, &found] () -> FanNormalContrib&
         {
             auto const matches = [shared] (FanNormalContrib const& x) noexcept { return x.shared == shared; };
 
-            ContribIt_t const searchAFirst = std::max<ContribIt_t>(std::prev(contribLast, 4), fanNormalContrib.begin());
+            ContribIt_t const searchAFirst = std::max<ContribIt_t>(std::prev(contribLast, 4), contribFirst);
             ContribIt_t const searchALast  = contribLast;
-            ContribIt_t const searchBFirst = fanNormalContrib.begin();
-            ContribIt_t const searchBLast  = std::min<ContribIt_t>(std::next(fanNormalContrib.begin(), 4), searchAFirst);
+            ContribIt_t const searchBFirst = contribFirst;
+            ContribIt_t const searchBLast  = std::min<ContribIt_t>(std::next(contribFirst, 4), searchAFirst);
 
             if (ContribIt_t const foundTemp = std::find_if(searchAFirst, searchALast, matches);
                 foundTemp != searchALast)
@@ -178,7 +190,7 @@ struct TerrainFaceWriter
                 return *foundTemp;
             }
 
-            LGRN_ASSERTM(std::none_of(fanNormalContrib.begin(), contribLast, matches), "search code above is broken XD");
+            LGRN_ASSERTM(std::none_of(contribFirst, contribLast, matches), "search code above is broken XD");
 
             return *contribLast;
         }();
@@ -189,12 +201,47 @@ struct TerrainFaceWriter
             rContrib.sum = osp::Vector3{osp::ZeroInit};
             rSharedNormalsDirty.set(shared.value);
             std::advance(contribLast, 1);
-            LGRN_ASSERT(contribLast != fanNormalContrib.end());
+            LGRN_ASSERT(contribLast != segmentContribEnd);
         }
 
         rContrib.sum += selectedFaceNormal;
     }
 
+    /**
+     * @brief Position face and contribution output at the start of fan segment [0, 6)
+     *
+     * See \c ChunkMeshBufferInfo for the segment layout. Only faces and contributions of
+     * segments opened this way are touched; call fan_segment_end() when the segment is done.
+     */
+    void fan_segment_begin(int const segment)
+    {
+        auto const pair   = std::uint32_t(segment / 2);
+        bool const isEdge = (segment % 2) != 0;
+
+        std::uint32_t const faceOffset    = pair * (cornerFaceCapacity + edgeFaceCapacity)
+                                          + (isEdge ? cornerFaceCapacity : 0);
+        std::uint32_t const contribOffset = pair * (cornerContribCapacity + edgeContribCapacity)
+                                          + (isEdge ? cornerContribCapacity : 0);
+
+        currentFace       = std::next(fanFaceFirst, faceOffset);
+        segmentFaceEnd    = std::next(currentFace, isEdge ? edgeFaceCapacity : cornerFaceCapacity);
+        contribFirst      = std::next(fanNormalContrib.begin(), contribOffset);
+        contribLast       = contribFirst;
+        segmentContribEnd = std::next(contribFirst, isEdge ? edgeContribCapacity : cornerContribCapacity);
+    }
+
+    /**
+     * @brief Zero unused capacity of the current fan segment
+     *
+     * Zeroed faces are degenerate and draw nothing; zeroed contributions terminate the
+     * segment's entries for subtract_normal_contrib.
+     */
+    void fan_segment_end()
+    {
+        std::fill(currentFace, segmentFaceEnd,    osp::Vector3u{osp::ZeroInit});
+        std::fill(contribLast, segmentContribEnd, FanNormalContrib{});
+    }
+
     void calculate_face_normal(VertexIdx a, VertexIdx b, VertexIdx c)
     {
         osp::Vector3 const u = vbufPos[b] - vbufPos[a];
@@ -212,6 +259,19 @@ struct TerrainFaceWriter
     osp::Vector3u                       selectedFaceIndx;
     IndxIt_t                            currentFace;
     ContribIt_t                         contribLast;
+
+    /// First fan face of the chunk's index buffer row; fan segment offsets are relative to this
+    IndxIt_t                            fanFaceFirst;
+    /// Per-segment capacities, from ChunkMeshBufferInfo
+    std::uint32_t                       cornerFaceCapacity;
+    std::uint32_t                       edgeFaceCapacity;
+    std::uint32_t                       cornerContribCapacity;
+    std::uint32_t                       edgeContribCapacity;
+    /// Bounds of the fan segment currently open via fan_segment_begin
+    IndxIt_t                            segmentFaceEnd;
+    ContribIt_t                         contribFirst;
+    ContribIt_t                         segmentContribEnd;
+
     osp::BitVector_t                    &rSharedNormalsDirty;
 };
 static_assert(CFaceWriter<TerrainFaceWriter>, "TerrainFaceWriter must satisfy concept CFaceWriter");
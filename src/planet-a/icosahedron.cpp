@@ -110,10 +110,11 @@ static void calc_midpoint_spherical(
 {
     // Midpoint is first calculated with only integers, then curvature is added on afterwards.
     // This is intended to prevent gargantuan numbers from squaring Vertex3l (int64) positions.
+    // Normalizing midPos directly (instead of midPos/scale) saves a per-component divide.
     osp::Vector3l const midPos    = (rSkData.positions[a] + rSkData.positions[b]) / 2;
-    osp::Vector3d const midPosDbl = osp::Vector3d(midPos) / scale;
+    osp::Vector3d const midPosDbl = osp::Vector3d(midPos);
     double        const midLen    = midPosDbl.length();
-    double        const curvature = radius - midLen;
+    double        const curvature = radius - midLen / scale;
 
     rSkData.normals[mid]   = osp::Vector3(midPosDbl / midLen);
     rSkData.positions[mid] = midPos + osp::Vector3l(rSkData.normals[mid] * curvature * scale);
@@ -126,7 +127,7 @@ void ico_calc_middles(
         std::array<osp::MaybeNewId<SkVrtxId>, 3>  const vrtxMid,
         SkeletonVertexData                              &rSkData)
 {
-    float const scale = std::pow(2.0f, rSkData.precision);
+    double const scale = double(osp::math::int_2pow<std::int64_t>(rSkData.precision));
 
     if (vrtxMid[0].isNew)
     {
@@ -157,26 +158,28 @@ void ico_calc_chunk_edge(
         return;
     }
 
-    float const scale = std::pow(2.0f, rSkData.precision);
+    double const scale = double(osp::math::int_2pow<std::int64_t>(rSkData.precision));
 
-    auto const recurse = [scale, radius, &rSkData] (auto &&self, SkVrtxId const a, SkVrtxId const b, int const currentLevel, ChunkEdgeView_t const view) noexcept -> void
+    // vrtxEdge holds the 2^level - 1 interior vertices of the edge in order. Midpoints are
+    // seeded coarsest level first: at stride 'step', vertex i's parents sit at i +/- step and
+    // were written by a previous (larger) stride or are the corners. Iterations within one
+    // stride are independent of each other, keeping each level a flat linear pass.
+    int const count = int(vrtxEdge.size());
+    for (int step = (count + 1) / 2; step >= 1; step /= 2)
     {
-        auto const halfSize = view.size() / 2;
-        osp::MaybeNewId<SkVrtxId> const mid = view[halfSize];
-
-        if (mid.isNew)
+        for (int i = step - 1; i < count; i += 2*step)
         {
-            calc_midpoint_spherical(a, mid.id, b, radius, scale, rSkData);
-        }
+            if ( ! vrtxEdge[i].isNew )
+            {
+                continue;
+            }
 
-        if (currentLevel != 1)
-        {
-            self(self, a, mid.id, currentLevel - 1, view.prefix(halfSize));
-            self(self, mid.id, b, currentLevel - 1, view.exceptPrefix(halfSize));
-        }
-    };
+            SkVrtxId const a = (i - step <  0)     ? cornerA : vrtxEdge[i - step].id;
+            SkVrtxId const b = (i + step >= count) ? cornerB : vrtxEdge[i + step].id;
 
-    recurse(recurse, cornerA, cornerB, level, vrtxEdge);
+            calc_midpoint_spherical(a, vrtxEdge[i].id, b, radius, scale, rSkData);
+        }
+    }
 }
 
 
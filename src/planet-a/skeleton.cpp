@@ -24,6 +24,8 @@
  */
 #include "skeleton.h"
 
+#include <Corrade/Containers/ArrayViewStl.h>
+
 using osp::MaybeNewId;
 
 namespace planeta
@@ -61,14 +63,61 @@ void SubdivTriangleSkeleton::vrtx_create_chunk_edge_recurse(
     LGRN_ASSERTV(rOut.size() == ( (1<<level) - 1 ),
                  rOut.size(),   ( (1<<level) - 1 ));
 
-    MaybeNewId<SkVrtxId> const mid      = vrtx_create_or_get_child(vrtxA, vrtxB);
-    std::size_t          const halfSize = rOut.size() / 2;
-    rOut[halfSize] = mid;
+    using IdPair = SubdivIdRegistry<SkVrtxId>::IdPair;
+
+    // Covers rOut[lo..hi); its middle vertex is the child of vrtxA and vrtxB
+    struct Segment
+    {
+        SkVrtxId    a;
+        SkVrtxId    b;
+        std::size_t lo;
+        std::size_t hi;
+    };
+
+    // Vertices of each subdivision level only depend on the level above, so the recursion
+    // tree is walked breadth-first; each level's edges resolve as one registry bundle,
+    // costing O(level) registry calls for the whole line instead of one per vertex
+    std::vector<Segment>                curr{ {vrtxA, vrtxB, 0, rOut.size()} };
+    std::vector<Segment>                next;
+    std::vector<IdPair>                 pairs;
+    std::vector< MaybeNewId<SkVrtxId> > mids;
+
+    curr .reserve(rOut.size()/2 + 1);
+    next .reserve(rOut.size()/2 + 1);
+    pairs.reserve(rOut.size()/2 + 1);
+    mids .reserve(rOut.size()/2 + 1);
 
-    if (level > 1)
+    while ( ! curr.empty() )
     {
-        vrtx_create_chunk_edge_recurse(level - 1, vrtxA,  mid.id, rOut.prefix(halfSize));
-        vrtx_create_chunk_edge_recurse(level - 1, mid.id, vrtxB,  rOut.exceptPrefix(halfSize + 1));
+        pairs.clear();
+        for (Segment const& seg : curr)
+        {
+            pairs.push_back({seg.a, seg.b});
+        }
+
+        mids.resize(curr.size());
+        m_vertexIds.create_or_get_bundle(osp::arrayView(pairs), osp::arrayView(mids));
+
+        next.clear();
+        for (std::size_t i = 0; i < curr.size(); ++i)
+        {
+            Segment     const &seg = curr[i];
+            std::size_t const mid  = seg.lo + (seg.hi - seg.lo) / 2;
+
+            rOut[mid] = mids[i];
+
+            if (mid != seg.lo)
+            {
+                next.push_back({seg.a, mids[i].id, seg.lo, mid});
+            }
+
+            if (mid + 1 != seg.hi)
+            {
+                next.push_back({mids[i].id, seg.b, mid + 1, seg.hi});
+            }
+        }
+
+        std::swap(curr, next);
     }
 }
 
@@ -105,11 +154,7 @@ SkTriGroupPair SubdivTriangleSkeleton::tri_group_create(
     for (int i = 0; i < 4; i ++)
     {
         SkeletonTriangle &rTri = rGroup.triangles[i];
-        rTri.vertices = {
-            vrtx_store(vertices[i][0]),
-            vrtx_store(vertices[i][1]),
-            vrtx_store(vertices[i][2])
-        };
+        vrtx_store_n(osp::arrayView(vertices[i]), osp::arrayView(rTri.vertices));
     }
     return {groupId, rGroup};
 }
@@ -128,11 +173,7 @@ SkTriGroupPair SubdivTriangleSkeleton::tri_group_create_root(
     for (int i = 0; i < 4; i ++)
     {
         SkeletonTriangle &rTri = rGroup.triangles[i];
-        rTri.vertices = {
-            vrtx_store(vertices[i][0]),
-            vrtx_store(vertices[i][1]),
-            vrtx_store(vertices[i][2])
-        };
+        vrtx_store_n(osp::arrayView(vertices[i]), osp::arrayView(rTri.vertices));
     }
     return {groupId, rGroup};
 }
@@ -378,14 +419,14 @@ ChunkId ChunkSkeleton::chunk_create(
                 && edgeBtm.size() == m_chunkEdgeVrtxCount - 1
                 && edgeRte.size() == m_chunkEdgeVrtxCount - 1 );
 
-    auto const own_shared_from_skvrtx = [this, &rSkel, &rSharedAdded] (SkVrtxId const vrtx) -> SharedVrtxOwner_t
+    auto const resolve_shared = [this, &rSkel, &rSharedAdded] (SkVrtxId const vrtx) -> SharedVrtxId
     {
         MaybeNewId<SharedVrtxId> const shared = shared_get_or_create(vrtx, rSkel);
         if (shared.isNew)
         {
             rSharedAdded.set(shared.id.value);
         }
-        return shared_store(shared.id);
+        return shared.id;
     };
 
     ChunkId const chunkId = m_chunkIds.create();
@@ -397,24 +438,26 @@ ChunkId ChunkSkeleton::chunk_create(
 
     SkeletonTriangle const &tri = rSkel.tri_at(sktriId);
 
-    auto const chunkSharedVerticesEdges = osp::as_2d(shared_vertices_used(chunkId), m_chunkEdgeVrtxCount);
+    // Pass 1: resolve each skeleton vertex along the border to a shared vertex id, in
+    //         shared_vertices_used order: per edge, the corner first then the rest of the edge
+    m_sharedResolveTmp.clear();
 
-    auto const assign_shared_vertices = [&] (osp::ArrayView< MaybeNewId<SkVrtxId> > const skvrtx, int edgeIdx)
+    auto const resolve_edge = [&] (osp::ArrayView< MaybeNewId<SkVrtxId> > const skvrtx, int edgeIdx)
     {
-        auto const edgeSharedVertices = chunkSharedVerticesEdges.row(edgeIdx);
-
-        // First vertex along the edge is the corner
-        edgeSharedVertices[0] = own_shared_from_skvrtx(tri.vertices[edgeIdx]);
+        m_sharedResolveTmp.push_back(resolve_shared(tri.vertices[edgeIdx]));
 
         for (unsigned int i = 0; i < m_chunkEdgeVrtxCount-1; i ++)
         {
-            edgeSharedVertices[i+1] = own_shared_from_skvrtx(skvrtx[i].id);
+            m_sharedResolveTmp.push_back(resolve_shared(skvrtx[i].id));
         }
     };
 
-    assign_shared_vertices(edgeLft, 0);
-    assign_shared_vertices(edgeBtm, 1);
-    assign_shared_vertices(edgeRte, 2);
+    resolve_edge(edgeLft, 0);
+    resolve_edge(edgeBtm, 1);
+    resolve_edge(edgeRte, 2);
+
+    // Pass 2: acquire owners for the whole span in one bulk ref-count pass
+    shared_store_n(osp::arrayView(m_sharedResolveTmp), shared_vertices_used(chunkId));
 
     return chunkId;
 }
@@ -425,15 +468,8 @@ void ChunkSkeleton::chunk_remove(
         osp::BitVector_t             &rSharedRemoved,
         SubdivTriangleSkeleton       &rSkel) noexcept
 {
-    for (SharedVrtxOwner_t& rOwner : shared_vertices_used(chunkId))
-    {
-        SharedVrtxId const shared = rOwner.value();
-        auto const status = shared_release(std::exchange(rOwner, {}), rSkel);
-        if (status.refCount == 0)
-        {
-            rSharedRemoved.set(shared.value);
-        }
-    }
+    shared_release_n(shared_vertices_used(chunkId), &rSharedRemoved, rSkel);
+
     m_triToChunk[sktriId] = {};
     m_chunkToTri[chunkId] = {};
     m_chunkIds.remove(chunkId);
@@ -441,6 +477,39 @@ void ChunkSkeleton::chunk_remove(
 }
 
 
+void ChunkSkeleton::shared_release_n(
+        osp::ArrayView<SharedVrtxOwner_t> const rOwners,
+        osp::BitVector_t                  *pSharedRemoved,
+        SubdivTriangleSkeleton            &rSkel) noexcept
+{
+    // Pass 1: plain ref-count decrements, noting which ids hit zero
+    m_sharedZeroTmp.clear();
+    for (SharedVrtxOwner_t& rOwner : rOwners)
+    {
+        SharedVrtxId const shared = rOwner.value();
+        m_sharedRefCount.ref_release(std::exchange(rOwner, {}));
+        if (m_sharedRefCount[shared.value] == 0)
+        {
+            m_sharedZeroTmp.push_back(shared);
+        }
+    }
+
+    // Pass 2: clean up shared vertices no longer used by any chunk
+    for (SharedVrtxId const shared : m_sharedZeroTmp)
+    {
+        SkVrtxOwner_t skvrtxOwner = std::exchange(m_sharedToSkVrtx[shared], {});
+        m_skVrtxToShared[skvrtxOwner.value()] = {};
+
+        rSkel.vrtx_release(std::move(skvrtxOwner));
+        m_sharedIds.remove(shared);
+
+        if (pSharedRemoved != nullptr)
+        {
+            pSharedRemoved->set(shared.value);
+        }
+    }
+}
+
 
 osp::MaybeNewId<SharedVrtxId> ChunkSkeleton::shared_get_or_create(SkVrtxId const skVrtxId, SubdivTriangleSkeleton &rSkel)
 {
@@ -467,10 +536,7 @@ void ChunkSkeleton::clear(SubdivTriangleSkeleton& rSkel)
         auto const chunk = static_cast<ChunkId>(chunkInt);
 
         // Release all shared vertices
-        for (SharedVrtxOwner_t& shared : shared_vertices_used(chunk))
-        {
-            shared_release(std::move(shared), rSkel);
-        }
+        shared_release_n(shared_vertices_used(chunk), nullptr, rSkel);
     }
     m_chunkToTri.clear();
     m_chunkSharedUsed.clear();
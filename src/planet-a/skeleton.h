@@ -150,8 +150,8 @@ public:
     /**
      * @brief Get or Create 3 Vertex IDs between the 3 other Vertex IDs
      *
-     * This is a shorthand to calling vrtx_create_or_get_child 3 times for each
-     * edge of a triangle; intended for subdivision.
+     * All 3 edges resolve as one bundle, so subdividing a triangle costs a single
+     * vertex-registry call; intended for subdivision.
      *
      * @param vertices [in] 3 Vertex IDs, representing corners of a triangle
      *
@@ -160,17 +160,24 @@ public:
     std::array<osp::MaybeNewId<SkVrtxId>, 3> vrtx_create_middles(
             std::array<SkVrtxId, 3> const& vertices)
     {
-        return { vrtx_create_or_get_child(vertices[0], vertices[1]),
-                 vrtx_create_or_get_child(vertices[1], vertices[2]),
-                 vrtx_create_or_get_child(vertices[2], vertices[0]) };
+        using IdPair = SubdivIdRegistry<SkVrtxId>::IdPair;
+
+        std::array<IdPair, 3> const pairs{{ {vertices[0], vertices[1]},
+                                            {vertices[1], vertices[2]},
+                                            {vertices[2], vertices[0]} }};
+
+        std::array<osp::MaybeNewId<SkVrtxId>, 3> out;
+        m_vertexIds.create_or_get_bundle(osp::arrayView(pairs), osp::arrayView(out));
+        return out;
     }
 
     /**
      * @brief Create or get a line up of Vertex IDs between two other Vertex IDs
      *
-     * Given Vertex A and B, each call will create a vertex C by combining
-     * A and B. If required, the function will recurse, calling itself twice
-     * with (A, C), and (C, B) to create more vertices.
+     * Given Vertex A and B, a vertex C is created by combining A and B. If
+     * required, this repeats on (A, C) and (C, B) to create more vertices,
+     * descending the implied binary tree level by level so each level's
+     * vertices are created as one bundle.
      *
      * Example:
      * Creating vertices between Vertex A to B, with level = 3, provided an
@@ -179,16 +186,12 @@ public:
      * Geometric representation:
      * A--0--1--2--3--4--5--6--B
      *
-     * Recursive calls to fill array view:
+     * Bundles filling the array view:
      *
-     * Level                         ID added
-     * 3: ---> A+B                -> 3
-     * 2:    |---> A+3            -> 1
-     * 1:    |   |---> A+1        -> 0
-     * 1:    |   |---> 1+3        -> 2
-     * 2:    |---> 3+B            -> 5
-     * 1:    |   |---> 3+5        -> 4
-     * 1:    |   |---> 5+B        -> 6
+     * Level    IDs added
+     * 3: A+B                     -> 3
+     * 2: A+3, 3+B                -> 1, 5
+     * 1: A+1, 1+3, 3+5, 5+B     -> 0, 2, 4, 6
      *
      * @param level [in] Number of times to subdivide further
      * @param a     [in] First Vertex ID
@@ -371,6 +374,23 @@ public:
         return status;
     }
 
+    /**
+     * @brief Bulk vrtx_store: acquire an owner for each Vertex ID in a span
+     *
+     * Writes an owner for ids[i] into rOut[i]. Equivalent to calling vrtx_store per element,
+     * but keeps the ref-count increments in one tight loop.
+     */
+    void vrtx_store_n(osp::ArrayView<SkVrtxId const> const ids, osp::ArrayView<SkVrtxOwner_t> const rOut)
+    {
+        LGRN_ASSERT(ids.size() == rOut.size());
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            LGRN_ASSERT(m_vertexIds.exists(ids[i]));
+            m_vertexIds.refcount_increment(ids[i]);
+            rOut[i] = SkVrtxOwner_t{ids[i]};
+        }
+    }
+
     /**
      * @return Read-only access to vertex IDs
      */
@@ -477,6 +497,8 @@ public:
         m_chunkSharedUsed   .resize(realSize * m_chunkSharedCount);
         m_chunkToTri        .resize(realSize);
         m_chunkStitch       .resize(realSize, {} /* zero init */);
+        m_sharedResolveTmp  .reserve(m_chunkSharedCount);
+        m_sharedZeroTmp     .reserve(m_chunkSharedCount);
     }
 
     ChunkId chunk_create(
@@ -550,6 +572,31 @@ public:
         return { refCount };
     }
 
+    /**
+     * @brief Bulk shared_store: acquire an owner for each Shared Vertex ID in a span
+     *
+     * Writes an owner for ids[i] into rOut[i]. Equivalent to calling shared_store per element,
+     * but keeps the ref-count increments in one tight loop; chunk creation acquires
+     * m_chunkSharedCount shared vertices at once through here.
+     */
+    void shared_store_n(osp::ArrayView<SharedVrtxId const> const ids, osp::ArrayView<SharedVrtxOwner_t> const rOut)
+    {
+        LGRN_ASSERT(ids.size() == rOut.size());
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            rOut[i] = m_sharedRefCount.ref_add(ids[i]);
+        }
+    }
+
+    /**
+     * @brief Bulk shared_release: release a span of owners in two passes
+     *
+     * Pass one decrements ref-counts in one tight loop, noting which ids hit zero. Pass two
+     * runs the zero-count cleanup (release owned skeleton vertex, free the shared vertex id)
+     * only for those. Freed ids have their bit set in pSharedRemoved when given.
+     */
+    void shared_release_n(osp::ArrayView<SharedVrtxOwner_t> rOwners, osp::BitVector_t *pSharedRemoved, SubdivTriangleSkeleton &rSkel) noexcept;
+
     /**
      * @brief Create or get a shared vertex associated with a skeleton vertex
      */
@@ -576,6 +623,10 @@ public:
     osp::KeyedVec<SharedVrtxId, SkVrtxOwner_t>  m_sharedToSkVrtx;
     osp::KeyedVec<SkVrtxId, SharedVrtxId>       m_skVrtxToShared;
 
+    /// Scratch for chunk_create / shared_release_n; members to avoid per-chunk allocations
+    std::vector<SharedVrtxId>                   m_sharedResolveTmp;
+    std::vector<SharedVrtxId>                   m_sharedZeroTmp;
+
 }; // class ChunkSkeleton
 
 inline ChunkSkeleton make_skeleton_chunks(uint8_t const subdivLevels)
@@ -24,6 +24,10 @@
  */
 #include "skeleton_subdiv.h"
 
+#include <algorithm>
+#include <array>
+#include <thread>
+
 using osp::bitvector_resize;
 using osp::Vector3;
 using osp::Vector3l;
@@ -31,6 +35,80 @@ using osp::Vector3l;
 namespace planeta
 {
 
+namespace
+{
+
+/// Batches smaller than this aren't worth the thread spawn/join overhead
+constexpr std::size_t gc_distanceTestParallelMin = 2048;
+
+/**
+ * @brief Evaluate the distance test for one batch of triangles, across threads when large
+ *
+ * The distance tests are pure reads of SkeletonVertexData::centers and scale with triangle count,
+ * unlike the later mutation passes which must stay on one thread: subdivide() recursively repairs
+ * invariants through shared neighbor links and allocates from SubdivIdRegistry, both of which are
+ * order-dependent. Results are written to rResults, indices matching toTest.
+ */
+void distance_test_batch(
+        std::vector<SkTriId>      const &toTest,
+        Vector3l                  const pos,
+        std::uint64_t             const threshold,
+        SkeletonVertexData        const &rSkData,
+        std::vector<std::uint8_t>       &rResults)
+{
+    rResults.resize(toTest.size());
+
+    auto const test_range = [&toTest, pos, threshold, &rSkData, &rResults]
+                            (std::size_t const first, std::size_t const last) noexcept
+    {
+        // Centers are gathered through toTest indices, so the test itself runs on contiguous
+        // fixed-size blocks where is_distance_near_batched's branch-free loop can vectorize
+        constexpr std::size_t blockSize = 64;
+        std::array<Vector3l, blockSize> gathered;
+
+        for (std::size_t blockFirst = first; blockFirst < last; blockFirst += blockSize)
+        {
+            std::size_t const count = std::min(blockSize, last - blockFirst);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                gathered[i] = rSkData.centers[toTest[blockFirst + i]];
+            }
+
+            osp::is_distance_near_batched(
+                    pos, osp::ArrayView<Vector3l const>{gathered.data(), count}, threshold,
+                    osp::ArrayView<std::uint8_t>{&rResults[blockFirst], count});
+        }
+    };
+
+    std::size_t const workerCount = std::min<std::size_t>(
+            std::thread::hardware_concurrency(), toTest.size() / gc_distanceTestParallelMin);
+
+    if (workerCount <= 1)
+    {
+        test_range(0, toTest.size());
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+
+    std::size_t const per = toTest.size() / workerCount;
+    for (std::size_t w = 0; w < workerCount; ++w)
+    {
+        std::size_t const first = w * per;
+        std::size_t const last  = (w+1 == workerCount) ? toTest.size() : first + per;
+        workers.emplace_back(test_range, first, last);
+    }
+
+    for (std::thread &rWorker : workers)
+    {
+        rWorker.join();
+    }
+}
+
+} // namespace
+
 void SkeletonSubdivScratchpad::resize(SubdivTriangleSkeleton &rSkel)
 {
     auto const triCapacity = rSkel.tri_group_ids().capacity() * 4;
@@ -91,10 +169,13 @@ void unsubdivide_select_by_distance(
         std::swap(rLvlSP.distanceTestProcessing, rLvlSP.distanceTestNext);
         rLvlSP.distanceTestNext.clear();
 
-        for (SkTriId const sktriId : rLvlSP.distanceTestProcessing)
+        distance_test_batch(rLvlSP.distanceTestProcessing, pos,
+                            rSP.distanceThresholdUnsubdiv[lvl], rSkData, rLvlSP.distanceTestResults);
+
+        for (std::size_t i = 0; i < rLvlSP.distanceTestProcessing.size(); ++i)
         {
-            Vector3l const center = rSkData.centers[sktriId];
-            bool const tooFar = ! osp::is_distance_near(pos, center, rSP.distanceThresholdUnsubdiv[lvl]);
+            SkTriId const sktriId = rLvlSP.distanceTestProcessing[i];
+            bool    const tooFar  = ! rLvlSP.distanceTestResults[i];
 
             LGRN_ASSERTM(rSkel.tri_at(sktriId).children.has_value(),
                          "Non-subdivided triangles must not be added to distance test.");
@@ -520,12 +601,15 @@ void subdivide_level_by_distance(
         std::swap(rLvlSP.distanceTestProcessing, rLvlSP.distanceTestNext);
         rLvlSP.distanceTestNext.clear();
 
-        for (SkTriId const sktriId : rLvlSP.distanceTestProcessing)
+        distance_test_batch(rLvlSP.distanceTestProcessing, pos,
+                            rSP.distanceThresholdSubdiv[lvl], rSkData, rLvlSP.distanceTestResults);
+
+        for (std::size_t i = 0; i < rLvlSP.distanceTestProcessing.size(); ++i)
         {
-            Vector3l const center = rSkData.centers[sktriId];
+            SkTriId const sktriId = rLvlSP.distanceTestProcessing[i];
 
             LGRN_ASSERT(rSP.distanceTestDone.test(sktriId.value));
-            bool const distanceNear = osp::is_distance_near(pos, center, rSP.distanceThresholdSubdiv[lvl]);
+            bool const distanceNear = rLvlSP.distanceTestResults[i];
             ++rSP.distanceCheckCount;
 
             if (distanceNear)
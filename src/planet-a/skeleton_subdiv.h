@@ -39,6 +39,11 @@ struct SubdivScratchpadLevel
 {
     std::vector<planeta::SkTriId> distanceTestProcessing;
     std::vector<planeta::SkTriId> distanceTestNext;
+
+    /// Distance test result per triangle of the batch in distanceTestProcessing, indices
+    /// matching. Filled across threads; see distance_test_batch in skeleton_subdiv.cpp.
+    /// Per-level since subdivide_level_by_distance re-enters itself on lower levels mid-batch.
+    std::vector<std::uint8_t>     distanceTestResults;
 };
 
 
@@ -83,6 +88,19 @@ struct SkeletonSubdivScratchpad
     UserData_t onUnsubdivUserData   {{nullptr, nullptr, nullptr, nullptr}};
 
     std::uint32_t distanceCheckCount{};
+
+    /// Viewer position of the last distance scan that actually ran. While the viewer stays
+    /// within scanHysteresis of it the whole scan is skipped; LOD transitions are delayed by at
+    /// most that distance of movement, which the 2x subdiv/unsubdiv threshold gap tolerates
+    /// without flip-flopping.
+    osp::Vector3l lastScanPosition;
+
+    /// How far the viewer may move from lastScanPosition before the scan runs again, in
+    /// skeleton units. Zero rescans every update.
+    std::uint64_t scanHysteresis    {0};
+
+    /// False until the first scan runs; forces it regardless of lastScanPosition
+    bool          scanValid         {false};
 };
 
 
@@ -29,6 +29,7 @@
  */
 #pragma once
 
+#include <osp/core/array_view.h>
 #include <osp/core/id_utils.h>
 
 #include <longeron/id_management/registry_stl.hpp>
@@ -102,6 +103,38 @@ public:
         return found != m_parentsToId.end() ? ID_T(found->second) : lgrn::id_null<ID_T>();
     }
 
+    struct IdPair
+    {
+        ID_T a;
+        ID_T b;
+    };
+
+    /**
+     * @brief Bundled create_or_get: resolve many parent pairs with one registry call
+     *
+     * Children that already exist are returned as-is; all missing ones are allocated
+     * together through a single walk of the registry's free-id bitmap, which hands out the
+     * lowest free runs before growing capacity. A subdivision event therefore costs O(1)
+     * registry calls instead of one per new ID. Pairs must be unique within one bundle.
+     */
+    void create_or_get_bundle(osp::ArrayView<IdPair const> pairs,
+                              osp::ArrayView< osp::MaybeNewId<ID_T> > out);
+
+    /**
+     * @brief Get the two parents an ID was created from
+     *
+     * Both are null for root IDs made with create_root()
+     */
+    [[nodiscard]] IdPair parents_of(ID_T x) const noexcept
+    {
+        std::uint64_t const combination = m_idToParents[std::size_t(x)];
+        if (combination == ~std::uint64_t(0))
+        {
+            return { lgrn::id_null<ID_T>(), lgrn::id_null<ID_T>() };
+        }
+        return uint64_to_id_pair(combination);
+    }
+
     /**
      * @brief Delete an ID once its refcount is zero
      *
@@ -143,12 +176,6 @@ private:
         return (std::uint64_t(ls) << 32) | std::uint64_t(ms);
     }
 
-    struct IdPair
-    {
-        ID_T a;
-        ID_T b;
-    };
-
     static constexpr IdPair uint64_to_id_pair(std::uint64_t const combination)
     {
         return { ID_T(std::uint32_t(combination)), ID_T(std::uint32_t(combination >> 32)) };
@@ -158,6 +185,11 @@ private:
     std::vector<std::uint64_t>                  m_idToParents;
     std::vector<std::uint8_t>                   m_idRefcount;
 
+    // Scratch reused across create_or_get_bundle calls; allocation-free once warmed up.
+    // Map slots are stored as pointers since unordered_map never moves its elements.
+    std::vector<id_int_t*>                      m_bundleSlots;
+    std::vector<ID_T>                           m_bundleIds;
+
 }; // class SubdivTree
 
 
@@ -186,6 +218,67 @@ osp::MaybeNewId<ID_T> SubdivIdRegistry<ID_T>::create_or_get(ID_T const a, ID_T c
 }
 
 
+template<typename ID_T>
+void SubdivIdRegistry<ID_T>::create_or_get_bundle(
+        osp::ArrayView<IdPair const>            const pairs,
+        osp::ArrayView< osp::MaybeNewId<ID_T> > const out)
+{
+    LGRN_ASSERT(pairs.size() == out.size());
+
+    m_bundleSlots.clear();
+
+    // First pass: resolve pairs that already have a child, blank-emplace the rest
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+    {
+        std::uint64_t const combination = id_pair_to_uint64(pairs[i].a, pairs[i].b);
+
+        auto const& [it, newChildAdded] = m_parentsToId.try_emplace(combination, 0);
+
+        if (newChildAdded)
+        {
+            m_bundleSlots.push_back(&it->second);
+        }
+
+        // For new children, the real ID is patched in the second pass
+        out[i] = { ID_T(it->second), newChildAdded };
+    }
+
+    if (m_bundleSlots.empty())
+    {
+        return; // Every pair already had a child; no allocation needed
+    }
+
+    // All missing children are allocated in one walk of the free-id bitmap
+    m_bundleIds.resize(m_bundleSlots.size());
+    base_t::create(m_bundleIds.begin(), m_bundleIds.end());
+
+    m_idRefcount .resize(capacity());
+    m_idToParents.resize(capacity(), ~std::uint64_t(0));
+
+    // Second pass: assign new IDs to their map slots and record parent links
+    std::size_t slot = 0;
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+    {
+        if ( ! out[i].isNew)
+        {
+            continue;
+        }
+
+        auto const idInt = id_int_t(m_bundleIds[slot]);
+        *m_bundleSlots[slot] = idInt;
+        ++slot;
+
+        m_idRefcount [idInt] = 0; // Recycled IDs may hold a stale count
+        m_idToParents[idInt] = id_pair_to_uint64(pairs[i].a, pairs[i].b);
+
+        out[i].id = ID_T(idInt);
+
+        refcount_increment(pairs[i].a);
+        refcount_increment(pairs[i].b);
+    }
+}
+
+
 template<typename ID_T>
 void SubdivIdRegistry<ID_T>::remove(ID_T const x) noexcept
 {
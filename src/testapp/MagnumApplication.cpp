@@ -52,7 +52,8 @@ MagnumApplication::MagnumApplication(const Application::Arguments& arguments,
  : Application{arguments, Configuration{}.setTitle("OSP-Magnum").setSize({1280, 720})}
  , m_rUserInput(rUserInput)
 {
-    // temporary fixed 60fps. No physics interpolation or anything is implemented yet
+    // vsync-limited; physics steps at a fixed rate and interpolates, so frame
+    // rate doesn't affect the simulation
     setSwapInterval(1);
     setMinimalLoopPeriod(16);
     m_timeline.start();
@@ -65,11 +66,25 @@ MagnumApplication::~MagnumApplication()
 
 void MagnumApplication::drawEvent()
 {
+    float delta = m_timeline.previousFrameDuration();
+
+    if (replay_active())
+    {
+        // Recorded events replace this frame's live input; the recorded timestep replaces
+        // the timeline's so the simulation sees the exact same frame sequence
+        delta = m_pInputReplayer->play_frame(m_rUserInput, delta);
+    }
+
     m_rUserInput.update_controls();
 
     if (m_ospApp != nullptr)
     {
-        m_ospApp->draw(*this, m_timeline.previousFrameDuration());
+        m_ospApp->draw(*this, delta);
+    }
+
+    if (m_pInputRecorder != nullptr && m_pInputRecorder->recording())
+    {
+        m_pInputRecorder->end_frame(delta);
     }
 
     m_rUserInput.clear_events();
@@ -79,40 +94,65 @@ void MagnumApplication::drawEvent()
     redraw();
 }
 
+void MagnumApplication::input_raw(osp::input::UserInputHandler::DeviceId const deviceId,
+                                  int const buttonEnum, osp::input::EButtonEvent const dir)
+{
+    if (replay_active())
+    {
+        return; // Live input would diverge the replay
+    }
+    m_rUserInput.event_raw(deviceId, buttonEnum, dir);
+    if (m_pInputRecorder != nullptr && m_pInputRecorder->recording())
+    {
+        m_pInputRecorder->record_button(deviceId, buttonEnum, dir);
+    }
+}
+
 void MagnumApplication::keyPressEvent(KeyEvent& event)
 {
     if (event.isRepeated()) { return; }
-    m_rUserInput.event_raw(osp::input::sc_keyboard, (int) event.key(),
-                           osp::input::EButtonEvent::Pressed);
+    input_raw(osp::input::sc_keyboard, (int) event.key(),
+              osp::input::EButtonEvent::Pressed);
 }
 
 void MagnumApplication::keyReleaseEvent(KeyEvent& event)
 {
     if (event.isRepeated()) { return; }
-    m_rUserInput.event_raw(osp::input::sc_keyboard, (int) event.key(),
-                           osp::input::EButtonEvent::Released);
+    input_raw(osp::input::sc_keyboard, (int) event.key(),
+              osp::input::EButtonEvent::Released);
 }
 
 void MagnumApplication::mousePressEvent(MouseEvent& event)
 {
-    m_rUserInput.event_raw(osp::input::sc_mouse, (int) event.button(),
-                           osp::input::EButtonEvent::Pressed);
+    input_raw(osp::input::sc_mouse, (int) event.button(),
+              osp::input::EButtonEvent::Pressed);
 }
 
 void MagnumApplication::mouseReleaseEvent(MouseEvent& event)
 {
-    m_rUserInput.event_raw(osp::input::sc_mouse, (int) event.button(),
-                           osp::input::EButtonEvent::Released);
+    input_raw(osp::input::sc_mouse, (int) event.button(),
+              osp::input::EButtonEvent::Released);
 }
 
 void MagnumApplication::mouseMoveEvent(MouseMoveEvent& event)
 {
+    if (replay_active()) { return; }
     m_rUserInput.mouse_delta(event.relativePosition());
+    if (m_pInputRecorder != nullptr && m_pInputRecorder->recording())
+    {
+        m_pInputRecorder->record_mouse_delta(event.relativePosition());
+    }
 }
 
 void MagnumApplication::mouseScrollEvent(MouseScrollEvent & event)
 {
-    m_rUserInput.scroll_delta(static_cast<osp::Vector2i>(event.offset()));
+    auto const offset = static_cast<osp::Vector2i>(event.offset());
+    if (replay_active()) { return; }
+    m_rUserInput.scroll_delta(offset);
+    if (m_pInputRecorder != nullptr && m_pInputRecorder->recording())
+    {
+        m_pInputRecorder->record_scroll_delta(offset);
+    }
 }
 
 void testapp::config_controls(UserInputHandler& rUserInput)
@@ -27,6 +27,7 @@
 #include "scenarios.h"
 
 #include <osp/util/UserInputHandler.h>
+#include <osp/util/input_replay.h>
 
 #include <Magnum/Timeline.h>
 
@@ -92,14 +93,39 @@ public:
         m_ospApp = std::move(ospApp);
     }
 
+    /// Mirror all raw input and frame timesteps into pRecorder; nullptr stops
+    void set_input_recorder(osp::input::InputRecorder *pRecorder) noexcept
+    {
+        m_pInputRecorder = pRecorder;
+    }
+
+    /// Drive frames from pReplayer's recorded log instead of live devices; nullptr stops.
+    /// Live input resumes automatically once the log runs out.
+    void set_input_replayer(osp::input::InputReplayer *pReplayer) noexcept
+    {
+        m_pInputReplayer = pReplayer;
+    }
+
 private:
 
     void drawEvent() override;
 
+    /// Feed a raw button event to the input handler, unless a replay is driving input
+    void input_raw(osp::input::UserInputHandler::DeviceId deviceId, int buttonEnum,
+                   osp::input::EButtonEvent dir);
+
+    bool replay_active() const noexcept
+    {
+        return (m_pInputReplayer != nullptr) && m_pInputReplayer->playing();
+    }
+
     AppPtr_t m_ospApp;
 
     osp::input::UserInputHandler &m_rUserInput;
 
+    osp::input::InputRecorder *m_pInputRecorder{nullptr};
+    osp::input::InputReplayer *m_pInputReplayer{nullptr};
+
     Magnum::Timeline m_timeline;
 
 };
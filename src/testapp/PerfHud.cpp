@@ -0,0 +1,129 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2023 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "PerfHud.h"
+
+#include <Magnum/GL/Buffer.h>
+#include <Magnum/GL/Renderer.h>
+#include <Magnum/Math/Color.h>
+#include <Magnum/Math/Matrix3.h>
+
+#include <algorithm>
+#include <array>
+
+using Magnum::Color4;
+using Magnum::Matrix3;
+using Magnum::Vector2;
+
+using Magnum::GL::Renderer;
+
+namespace testapp
+{
+
+PerfHud::PerfHud()
+ : m_shader{ Magnum::Shaders::FlatGL2D::Configuration{} }
+{
+    // Unit quad in [0, 1]^2; each bar scales and places it with the transformation matrix
+    static constexpr std::array<Vector2, 4> sc_verts
+            {{ {0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f} }};
+
+    Magnum::GL::Buffer verts;
+    verts.setData(sc_verts);
+
+    m_quad.setPrimitive(Magnum::MeshPrimitive::TriangleStrip)
+          .setCount(4)
+          .addVertexBuffer(std::move(verts), 0, Magnum::Shaders::FlatGL2D::Position{});
+}
+
+void PerfHud::draw(osp::PerfSample const& sample, Magnum::Vector2i const viewportPx)
+{
+    // Pixel-space layout, anchored to the top-left corner
+    constexpr float sc_margin    = 8.0f;
+    constexpr float sc_barWidth  = 240.0f;
+    constexpr float sc_barHeight = 10.0f;
+    constexpr float sc_barPitch  = 14.0f;
+
+    // Two thirds of a bar is one 60 Hz frame, so over-budget frames stand out
+    constexpr float sc_fullMs    = 25.0f;
+
+    struct Row
+    {
+        float   frac;
+        Color4  color;
+    };
+
+    std::array<Row, 7> const rows
+    {{
+        { sample.updateMs / sc_fullMs,                    Color4{0.3f, 0.9f, 0.3f, 1.0f} },
+        { sample.renderMs / sc_fullMs,                    Color4{0.3f, 0.8f, 0.9f, 1.0f} },
+        { float(sample.drawnEnts)    / 4096.0f,           Color4{0.9f, 0.9f, 0.3f, 1.0f} },
+        { float(sample.drawCalls)    / 1024.0f,           Color4{0.9f, 0.6f, 0.2f, 1.0f} },
+        { float(sample.queuedTasks)  / 64.0f,             Color4{0.9f, 0.3f, 0.9f, 1.0f} },
+        { float(sample.blockedTasks) / 64.0f,             Color4{0.9f, 0.3f, 0.3f, 1.0f} },
+        { float(sample.memBytes)     / (1024.0f*1048576.0f), Color4{0.4f, 0.5f, 0.9f, 1.0f} }
+    }};
+
+    Vector2 const viewport{viewportPx};
+
+    auto const draw_rect = [this, viewport]
+            (float const xPx, float const yPx, float const wPx, float const hPx,
+             Color4 const color)
+    {
+        // Map the unit quad to pixel rectangle (xPx, yPx) from the top-left, in NDC
+        Matrix3 const tf
+                = Matrix3::translation({ -1.0f + 2.0f *  xPx         / viewport.x(),
+                                          1.0f - 2.0f * (yPx + hPx)  / viewport.y() })
+                * Matrix3::scaling    ({ 2.0f * wPx / viewport.x(),
+                                         2.0f * hPx / viewport.y() });
+        m_shader.setTransformationProjectionMatrix(tf)
+                .setColor(color)
+                .draw(m_quad);
+    };
+
+    Renderer::disable(Renderer::Feature::DepthTest);
+    Renderer::disable(Renderer::Feature::FaceCulling);
+    Renderer::enable (Renderer::Feature::Blending);
+    Renderer::setBlendFunction(Renderer::BlendFunction::SourceAlpha,
+                               Renderer::BlendFunction::OneMinusSourceAlpha);
+
+    // Translucent backdrop so bars stay readable over bright scenes
+    draw_rect(sc_margin - 4.0f, sc_margin - 4.0f,
+              sc_barWidth + 8.0f, float(rows.size()) * sc_barPitch + 4.0f,
+              Color4{0.0f, 0.0f, 0.0f, 0.5f});
+
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+        float const frac = std::clamp(rows[i].frac, 0.0f, 1.0f);
+
+        // Keep a sliver visible at zero so a stuck stat reads differently from a hidden HUD
+        draw_rect(sc_margin, sc_margin + float(i) * sc_barPitch,
+                  std::max(frac * sc_barWidth, 2.0f), sc_barHeight,
+                  rows[i].color);
+    }
+
+    Renderer::disable(Renderer::Feature::Blending);
+    Renderer::enable (Renderer::Feature::DepthTest);
+}
+
+} // namespace testapp
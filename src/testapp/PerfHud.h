@@ -0,0 +1,65 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2023 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <osp/util/perf_stats.h>
+
+#include <Magnum/GL/Mesh.h>
+#include <Magnum/Magnum.h>
+#include <Magnum/Shaders/FlatGL.h>
+
+namespace testapp
+{
+
+/**
+ * @brief On-screen performance bars drawn over the top-left of the default framebuffer
+ *
+ * No text rendering exists in this codebase, so each statistic shows as a horizontal bar
+ * with a fixed color and full-scale value; consistent row order makes them readable at a
+ * glance during a test flight. Top to bottom: update CPU ms (green), render CPU ms (cyan),
+ * drawn entities (yellow), draw calls (orange), queued tasks (magenta), blocked tasks
+ * (red), census memory (blue). CPU bars are scaled so two thirds equals a 60 Hz frame.
+ *
+ * Construct and use only on the thread owning the GL context.
+ */
+class PerfHud
+{
+public:
+
+    PerfHud();
+
+    /**
+     * @brief Draw bars for one sample; call after scene rendering, before buffer swap
+     */
+    void draw(osp::PerfSample const& sample, Magnum::Vector2i viewportPx);
+
+private:
+
+    Magnum::Shaders::FlatGL2D   m_shader;
+    Magnum::GL::Mesh            m_quad;
+
+}; // class PerfHud
+
+} // namespace testapp
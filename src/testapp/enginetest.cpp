@@ -26,7 +26,9 @@
 
 #include <osp/activescene/basic.h>
 #include <osp/activescene/basic_fn.h>
+#include <osp/activescene/world_tf.h>
 #include <osp/core/Resources.h>
+#include <osp/core/bitvector.h>
 #include <osp/drawing/drawing.h>
 #include <osp/drawing/own_restypes.h>
 #include <osp/drawing_gl/rendergl.h>
@@ -41,6 +43,11 @@
 
 #include <Corrade/Containers/ArrayViewStl.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
 using Magnum::Trade::ImageData2D;
 using Magnum::Trade::MeshData;
 using adera::ACtxCameraController;
@@ -78,8 +85,17 @@ struct EngineTestScene
     // to ActiveEnts
     osp::active::ACtxBasic          m_basic;
 
-    // The rotating cube
-    ActiveEnt                       m_cube{lgrn::id_null<ActiveEnt>()};
+    // Cached world transforms, recomposed per-frame in one pass over the
+    // scene graph's flat tree
+    osp::active::ACtxWorldTf        m_worldTf;
+
+    // The rotating cubes. Normally just one; benchmark mode scales this up to
+    // measure the monolith against the task-graph scenes running the same work.
+    std::vector<ActiveEnt>          m_cubes;
+
+    // Benchmark mode: scripted camera orbit + per-phase timing output
+    bool                            m_benchmark{false};
+    float                           m_camOrbitRadius{5.0f};
 
 
     // Everything below is for rendering
@@ -117,7 +133,7 @@ EngineTestScene::~EngineTestScene()
     osp::draw::SysRender::clear_resource_owners(m_drawingRes, *m_pResources);
 }
 
-entt::any setup_scene(osp::Resources& rResources, osp::PkgId const pkg)
+entt::any setup_scene(osp::Resources& rResources, osp::PkgId const pkg, std::size_t const cubeCount, bool const benchmark)
 {
     using namespace osp::active;
     using namespace osp::draw;
@@ -126,17 +142,25 @@ entt::any setup_scene(osp::Resources& rResources, osp::PkgId const pkg)
     auto &rScene = entt::any_cast<EngineTestScene&>(sceneAny);
 
     rScene.m_pResources = &rResources;
+    rScene.m_benchmark  = benchmark;
+
+    // Cubes go on an gridSide x gridSide x gridSide grid, centered on the origin
+    std::size_t const gridSide = std::size_t(std::ceil(std::cbrt(double(cubeCount))));
+    float const gridSpacing = 3.0f;
+    float const gridOffset  = 0.5f * gridSpacing * float(gridSide - 1);
 
-    // Make a cube
-    ActiveEnt const cubeEnt = rScene.m_activeIds.create();
-    DrawEnt const   cubeDraw = rScene.m_scnRdr.m_drawIds.create();
+    // Orbit outside the whole grid
+    rScene.m_camOrbitRadius = std::max(5.0f, 1.5f * gridSpacing * float(gridSide));
+
+    // Make the cubes
+    rScene.m_cubes.resize(cubeCount);
+    rScene.m_activeIds.create(rScene.m_cubes.begin(), rScene.m_cubes.end());
 
     // Resize some containers to fit all existing entities
     std::size_t const maxEnts = rScene.m_activeIds.vec().capacity();
     rScene.m_matPhong.ints()    .resize(maxEnts);
     rScene.m_basic.m_scnGraph   .resize(maxEnts);
     rScene.m_scnRdr.resize_active(maxEnts);
-    rScene.m_scnRdr.resize_draw();
 
     // Take ownership of the cube mesh Resource. This will create a scene-space
     // MeshId that we can assign to ActiveEnts
@@ -144,35 +168,47 @@ entt::any setup_scene(osp::Resources& rResources, osp::PkgId const pkg)
     assert(resCube != lgrn::id_null<osp::ResId>());
     MeshId const meshCube = SysRender::own_mesh_resource(rScene.m_drawing, rScene.m_drawingRes, rResources, resCube);
 
-    // Add cube mesh to cube
+    // Add cubes to hierarchy, parented to root
+    SubtreeBuilder builder = SysSceneGraph::add_descendants(rScene.m_basic.m_scnGraph, cubeCount);
+
+    for (std::size_t i = 0; i < cubeCount; ++i)
+    {
+        ActiveEnt const cubeEnt  = rScene.m_cubes[i];
+        DrawEnt const   cubeDraw = rScene.m_scnRdr.m_drawIds.create();
 
-    rScene.m_scnRdr.m_needDrawTf.set(std::size_t(cubeEnt));
-    rScene.m_scnRdr.m_activeToDraw[cubeEnt] = cubeDraw;
-    rScene.m_scnRdr.m_mesh[cubeDraw] = rScene.m_drawing.m_meshRefCounts.ref_add(meshCube);
-    rScene.m_scnRdr.m_meshDirty.push_back(cubeDraw);
+        rScene.m_scnRdr.resize_draw();
 
-    // Add transform
-    rScene.m_basic.m_transform.emplace(cubeEnt);
+        // Add cube mesh to cube
+        rScene.m_scnRdr.m_needDrawTf.set(std::size_t(cubeEnt));
+        rScene.m_scnRdr.m_activeToDraw[cubeEnt] = cubeDraw;
+        rScene.m_scnRdr.hot[cubeDraw].mesh = rScene.m_drawing.m_meshRefCounts.ref_add(meshCube);
+        rScene.m_scnRdr.m_meshDirty.push_back(cubeDraw);
 
-    // Add phong material to cube
-    rScene.m_matPhong.set(std::size_t(cubeDraw));
-    rScene.m_matPhongDirty.push_back(cubeDraw);
+        // Add transform, placed on the grid
+        osp::Vector3 const pos
+        {
+            float(i % gridSide)              * gridSpacing - gridOffset,
+            float((i / gridSide) % gridSide) * gridSpacing - gridOffset,
+            float(i / (gridSide * gridSide)) * gridSpacing - gridOffset
+        };
+        rScene.m_basic.m_transform.emplace(cubeEnt, ACompTransform{Magnum::Matrix4::translation(pos)});
 
-    // Add drawble, opaque, and visible component
-    rScene.m_scnRdr.m_visible.set(std::size_t(cubeDraw));
-    rScene.m_scnRdr.m_opaque.set(std::size_t(cubeDraw));
+        // Add phong material to cube
+        rScene.m_matPhong.set(std::size_t(cubeDraw));
+        rScene.m_matPhongDirty.push_back(cubeDraw);
 
-    // Add cube to hierarchy, parented to root
-    SubtreeBuilder builder = SysSceneGraph::add_descendants(rScene.m_basic.m_scnGraph, 1);
-    builder.add_child(cubeEnt);
+        // Add drawble, opaque, and visible component
+        rScene.m_scnRdr.m_visible.set(std::size_t(cubeDraw));
+        rScene.m_scnRdr.m_opaque.set(std::size_t(cubeDraw));
 
-    rScene.m_cube = cubeEnt;
+        builder.add_child(cubeEnt);
+    }
 
     return sceneAny;
 }
 
 /**
- * @brief Update an EngineTestScene, this just rotates the cube
+ * @brief Update an EngineTestScene, this just rotates the cubes
  *
  * @param rScene [ref] scene to update
  */
@@ -183,10 +219,18 @@ void update_test_scene(EngineTestScene& rScene, float const delta)
     rScene.m_scnRdr.m_diffuseDirty.clear();
     rScene.m_matPhongDirty.clear();
 
-    // Rotate the cube
-    osp::Matrix4 &rCubeTf = rScene.m_basic.m_transform.get(rScene.m_cube).m_transform;
+    // Rotate the cubes. Spin rate varies deterministically with index so the
+    // workload isn't trivially coherent, but reruns are identical.
+    std::size_t const cubeCount = rScene.m_cubes.size();
+    for (std::size_t i = 0; i < cubeCount; ++i)
+    {
+        ActiveEnt const cube = rScene.m_cubes[i];
+        osp::Matrix4 &rCubeTf = rScene.m_basic.m_transform.get(cube).m_transform;
 
-    rCubeTf = Magnum::Matrix4::rotationZ(90.0_degf * delta) * rCubeTf;
+        auto const spinRate = 90.0_degf + 15.0_degf * float(i % 12);
+        rCubeTf = rCubeTf * Magnum::Matrix4::rotationZ(spinRate * delta);
+        SysSceneGraph::mark_transform_dirty(rScene.m_basic.m_scnGraph, cube);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -235,7 +279,7 @@ void sync_test_scene(
     using namespace osp::draw;
     using namespace adera::shader;
 
-    rScene.m_scnRdr.m_drawTransform         .resize(rScene.m_scnRdr.m_drawIds.capacity());
+    rScene.m_scnRdr.hot                     .resize(rScene.m_scnRdr.m_drawIds.capacity());
     rRenderer.m_sceneRenderGL.m_diffuseTexId.resize(rScene.m_scnRdr.m_drawIds.capacity());
     rRenderer.m_sceneRenderGL.m_meshId      .resize(rScene.m_scnRdr.m_drawIds.capacity());
 
@@ -243,7 +287,7 @@ void sync_test_scene(
     sync_drawent_phong(rScene.m_matPhongDirty.cbegin(), rScene.m_matPhongDirty.cend(),
     {
         .hasMaterial    = rScene.m_matPhong,
-        .pStorageOpaque = &rRenderer.m_groupFwdOpaque.entities,
+        .pGroupOpaque   = &rRenderer.m_groupFwdOpaque,
         .opaque         = rScene.m_scnRdr.m_opaque,
         .transparent    = rScene.m_scnRdr.m_transparent,
         .diffuse        = rRenderer.m_sceneRenderGL.m_diffuseTexId,
@@ -251,14 +295,14 @@ void sync_test_scene(
     });
 
     // Load required meshes and textures into OpenGL
-    SysRenderGL::compile_resource_meshes  (rScene.m_drawingRes, *rScene.m_pResources, rRenderGl);
-    SysRenderGL::compile_resource_textures(rScene.m_drawingRes, *rScene.m_pResources, rRenderGl);
+    SysRenderGL::compile_resource_meshes  (rScene.m_drawingRes, *rScene.m_pResources, rRenderer.m_sceneRenderGL, rRenderGl);
+    SysRenderGL::compile_resource_textures(rScene.m_drawingRes, *rScene.m_pResources, rRenderer.m_sceneRenderGL, rRenderGl);
 
     // Assign GL meshes to entities with a mesh component
     SysRenderGL::sync_drawent_mesh(
             rScene.m_scnRdr.m_meshDirty.begin(),
             rScene.m_scnRdr.m_meshDirty.end(),
-            rScene.m_scnRdr.m_mesh,
+            rScene.m_scnRdr.hot,
             rScene.m_drawingRes.m_meshToRes,
             rRenderer.m_sceneRenderGL.m_meshId,
             rRenderGl);
@@ -272,20 +316,23 @@ void sync_test_scene(
             rRenderer.m_sceneRenderGL.m_diffuseTexId,
             rRenderGl);
 
-    // Calculate hierarchy transforms
+    // Compose world transforms in one linear pass over the scene graph, then
+    // copy them out to drawable entities
+    using osp::active::SysWorldTf;
+    using osp::active::TreePos_t;
 
-    auto drawTfDirty = {rScene.m_cube};
+    SysWorldTf::update(rScene.m_basic.m_scnGraph, rScene.m_basic.m_transform, rScene.m_worldTf);
 
-    SysRender::update_draw_transforms(
-            {
-                .scnGraph     = rScene.m_basic .m_scnGraph,
-                .transforms   = rScene.m_basic .m_transform,
-                .activeToDraw = rScene.m_scnRdr.m_activeToDraw,
-                .needDrawTf   = rScene.m_scnRdr.m_needDrawTf,
-                .rDrawTf      = rScene.m_scnRdr.m_drawTransform
-            },
-            drawTfDirty.begin(),
-            drawTfDirty.end());
+    TreePos_t const treeSize = TreePos_t(rScene.m_worldTf.worldTf.size());
+    for (TreePos_t pos = 1; pos < treeSize; ++pos)
+    {
+        ActiveEnt const ent     = rScene.m_basic.m_scnGraph.m_treeToEnt[pos];
+        DrawEnt const drawEnt   = rScene.m_scnRdr.m_activeToDraw[ent];
+        if (drawEnt != lgrn::id_null<DrawEnt>())
+        {
+            rScene.m_scnRdr.hot[drawEnt].drawTf = rScene.m_worldTf.worldTf[pos];
+        }
+    }
 }
 
 /**
@@ -319,8 +366,8 @@ void render_test_scene(
 
     // Forward Render fwd_opaque group to FBO
     SysRenderGL::render_opaque(
-            rRenderer.m_groupFwdOpaque,
-            rScene.m_scnRdr.m_visible, viewProj);
+            rRenderGl, rRenderer.m_groupFwdOpaque,
+            rScene.m_scnRdr.m_visible, rScene.m_scnRdr.hot, viewProj);
 
     // Display FBO
     Texture2D &rFboColor = rRenderGl.m_texGl.get(rRenderGl.m_fboColor);
@@ -341,15 +388,66 @@ public:
 
     void draw(MagnumApplication& rApp, float delta) override
     {
-        update_test_scene(m_rScene, delta);
+        if ( ! m_rScene.m_benchmark)
+        {
+            update_test_scene(m_rScene, delta);
 
-        // Rotate and move the camera based on user inputs
-        SysCameraController::update_view(m_renderer.m_camCtrl, delta);
-        SysCameraController::update_move(m_renderer.m_camCtrl, delta, true);
-        m_renderer.m_cam.m_transform = m_renderer.m_camCtrl.m_transform;
+            // Rotate and move the camera based on user inputs
+            SysCameraController::update_view(m_renderer.m_camCtrl, delta);
+            SysCameraController::update_move(m_renderer.m_camCtrl, delta, true);
+            m_renderer.m_cam.m_transform = m_renderer.m_camCtrl.m_transform;
 
+            sync_test_scene  (m_rRenderGl, m_rScene, m_renderer);
+            render_test_scene(m_rRenderGl, m_rScene, m_renderer);
+            return;
+        }
+
+        // Benchmark mode: fixed timestep and a scripted camera orbit, so every run
+        // performs identical work regardless of wall-clock frame times, and each
+        // phase is timed separately
+        using Clock = std::chrono::steady_clock;
+        constexpr float benchDelta = 1.0f / 60.0f;
+
+        m_benchTime += benchDelta;
+
+        auto const time0 = Clock::now();
+        update_test_scene(m_rScene, benchDelta);
+
+        // Orbit the camera around the cube grid, slowly bobbing up and down
+        auto const ang = Magnum::Rad(0.25f * m_benchTime);
+        float const radius = m_rScene.m_camOrbitRadius;
+        osp::Vector3 const eye{
+                radius * std::cos(float(ang)),
+                radius * std::sin(float(ang)),
+                0.5f * radius * std::sin(0.5f * float(ang))};
+        m_renderer.m_cam.m_transform = Magnum::Matrix4::lookAt(eye, osp::Vector3{0.0f}, osp::Vector3{0.0f, 0.0f, 1.0f});
+
+        auto const time1 = Clock::now();
         sync_test_scene  (m_rRenderGl, m_rScene, m_renderer);
+        auto const time2 = Clock::now();
         render_test_scene(m_rRenderGl, m_rScene, m_renderer);
+        auto const time3 = Clock::now();
+
+        m_updateSec += std::chrono::duration<double>(time1 - time0).count();
+        m_syncSec   += std::chrono::duration<double>(time2 - time1).count();
+        m_renderSec += std::chrono::duration<double>(time3 - time2).count();
+
+        if (++m_benchFrames == smc_reportInterval)
+        {
+            // One machine-readable CSV line per interval. render_us is CPU submit
+            // time; gpu_opaque_us is the GL_TIME_ELAPSED average from RenderGL.
+            double const toUs = 1.0e6 / double(smc_reportInterval);
+            std::cout << "enginetest-bench,cubes=" << m_rScene.m_cubes.size()
+                      << ",frames=" << smc_reportInterval
+                      << ",update_us=" << m_updateSec * toUs
+                      << ",sync_us="   << m_syncSec   * toUs
+                      << ",render_us=" << m_renderSec * toUs
+                      << ",gpu_opaque_us=" << double(m_rRenderGl.m_timeOpaque.average_ms()) * 1000.0
+                      << "\n";
+
+            m_benchFrames = 0;
+            m_updateSec = m_syncSec = m_renderSec = 0.0;
+        }
     }
 
     void exit(MagnumApplication& rApp) override
@@ -362,6 +460,17 @@ public:
 
     EngineTestScene     &m_rScene;
     RenderGL            &m_rRenderGl;
+
+private:
+
+    /// Frames per benchmark report line
+    static constexpr std::uint32_t smc_reportInterval = 120;
+
+    float           m_benchTime  {0.0f};
+    std::uint32_t   m_benchFrames{0};
+    double          m_updateSec  {0.0};
+    double          m_syncSec    {0.0};
+    double          m_renderSec  {0.0};
 };
 
 MagnumApplication::AppPtr_t generate_osp_magnum_app(EngineTestScene& rScene, MagnumApplication &rApp, RenderGL& rRenderGl, UserInputHandler& rUserInput)
@@ -392,7 +501,7 @@ MagnumApplication::AppPtr_t generate_osp_magnum_app(EngineTestScene& rScene, Mag
         auto const drawEnt = DrawEnt(drawEntInt);
 
         // Set all meshs dirty
-        if (rScene.m_scnRdr.m_mesh[drawEnt] != lgrn::id_null<MeshId>())
+        if (rScene.m_scnRdr.hot[drawEnt].mesh != lgrn::id_null<MeshId>())
         {
             rScene.m_scnRdr.m_meshDirty.push_back(drawEnt);
         }
@@ -407,16 +516,16 @@ MagnumApplication::AppPtr_t generate_osp_magnum_app(EngineTestScene& rScene, Mag
     for (std::size_t const materialInt : rScene.m_scnRdr.m_materialIds.bitview().zeros())
     {
         Material &mat = rScene.m_scnRdr.m_materials[MaterialId(materialInt)];
-        for (std::size_t const entInt : mat.m_ents.ones())
+        osp::bitvector_for_each_set(mat.m_ents, [&mat] (std::size_t const entInt)
         {
             mat.m_dirty.push_back(DrawEnt(entInt));
-        }
+        });
     }
 
-    for (std::size_t const entInt : rScene.m_matPhong.ones())
+    osp::bitvector_for_each_set(rScene.m_matPhong, [&rScene] (std::size_t const entInt)
     {
         rScene.m_matPhongDirty.emplace_back(entInt);
-    }
+    });
 
     sync_test_scene(rRenderGl, rScene, rRenderer);
 
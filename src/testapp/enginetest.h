@@ -38,10 +38,13 @@ struct EngineTestScene;
  *
  * @param rResources    [ref] Application Resources containing cube mesh
  * @param pkg           [in] Package Id the cube mesh is under
+ * @param cubeCount     [in] Number of spinning cubes to create, arranged in a grid
+ * @param benchmark     [in] Fly a scripted camera path and report per-phase timings,
+ *                           instead of reading user inputs
  *
  * @return entt::any containing scene data
  */
-entt::any setup_scene(osp::Resources& rResources, osp::PkgId pkg);
+entt::any setup_scene(osp::Resources& rResources, osp::PkgId pkg, std::size_t cubeCount = 1, bool benchmark = false);
 
 /**
  * @brief Generate IOspApplication for MagnumApplication
@@ -151,8 +151,8 @@ struct PlApplication
 
 //-----------------------------------------------------------------------------
 
-#define TESTAPP_DATA_SCENE 1, \
-    idDeltaTimeIn
+#define TESTAPP_DATA_SCENE 3, \
+    idDeltaTimeIn, idFrameArena, idTickRate
 struct PlScene
 {
     PipelineDef<EStgEvnt> cleanup           {"cleanup           - Scene cleanup before destruction"};
@@ -172,12 +172,13 @@ struct PlCommonScene
 };
 
 
-#define TESTAPP_DATA_PHYSICS 3, \
-    idPhys, idHierBody, idPhysIn
+#define TESTAPP_DATA_PHYSICS 5, \
+    idPhys, idHierBody, idPhysIn, idPhysWorldTf, idSpatialTree
 struct PlPhysics
 {
     PipelineDef<EStgCont> physBody          {"physBody"};
     PipelineDef<EStgOptn> physUpdate        {"physUpdate"};
+    PipelineDef<EStgCont> spatial           {"spatial           - Spatial index of collidable entities"};
 };
 
 
@@ -277,8 +278,8 @@ struct PlVehicleSpawnVB
 
 
 
-#define TESTAPP_DATA_SIGNALS_FLOAT 2, \
-    idSigValFloat,      idSigUpdFloat
+#define TESTAPP_DATA_SIGNALS_FLOAT 3, \
+    idSigValFloat,      idSigUpdFloat,      idSigSubsFloat
 struct PlSignalsFloat
 {
     PipelineDef<EStgCont> sigFloatValues    {"sigFloatValues    -"};
@@ -320,6 +321,9 @@ struct PlTerrain
 #define TESTAPP_DATA_TERRAIN_ICO 1, \
     idTerrainIco
 
+#define TESTAPP_DATA_TERRAIN_NWT 1, \
+    idTerrainNwt
+
 
 //-----------------------------------------------------------------------------
 
@@ -406,14 +410,16 @@ struct PlMagnum
 
 
 
-#define TESTAPP_DATA_MAGNUM_SCENE 3, \
-    idScnRenderGl, idGroupFwd, idCamera
+#define TESTAPP_DATA_MAGNUM_SCENE 5, \
+    idScnRenderGl, idGroupFwd, idCamera, idHiZOcclusion, idImposters
 struct PlMagnumScene
 {
     PipelineDef<EStgFBO>  fbo               {"fboRender"};
 
     PipelineDef<EStgCont> camera            {"camera"};
 
+    PipelineDef<EStgCont> drawUniforms      {"drawUniforms      - Per-frame staged per-draw uniform data"};
+
 };
 
 
@@ -0,0 +1,204 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "load_resources.h"
+#include "scenarios.h"
+#include "identifiers.h"
+
+#include <osp/core/Resources.h>
+#include <osp/core/string_concat.h>
+#include <osp/drawing/own_restypes.h>
+#include <osp/vehicles/ImporterData.h>
+#include <osp/vehicles/asset_pack.h>
+#include <osp/vehicles/load_tinygltf.h>
+#include <osp/util/logging.h>
+
+#include <Magnum/MeshTools/Transform.h>
+#include <Magnum/Primitives/Cone.h>
+#include <Magnum/Primitives/Cylinder.h>
+#include <Magnum/Primitives/Cube.h>
+#include <Magnum/Primitives/Grid.h>
+#include <Magnum/Primitives/Icosphere.h>
+#include <Magnum/Trade/ImageData.h>
+#include <Magnum/Trade/TextureData.h>
+#include <Magnum/Trade/MeshData.h>
+
+#include <Corrade/Containers/ArrayViewStl.h>
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace testapp
+{
+
+void load_a_bunch_of_stuff(TestApp& rTestApp)
+{
+    using namespace osp::restypes;
+    using namespace Magnum;
+    using Primitives::ConeFlag;
+    using Primitives::CylinderFlag;
+
+    osp::TopTaskBuilder builder{rTestApp.m_tasks, rTestApp.m_applicationGroup.m_edges, rTestApp.m_taskData};
+    auto const plApp = rTestApp.m_application.create_pipelines<PlApplication>(builder);
+
+    builder.pipeline(plApp.mainLoop).loops(true).wait_for_signal(EStgOptn::ModifyOrSignal);
+
+    // declares idResources and idMainLoopCtrl
+    OSP_DECLARE_CREATE_DATA_IDS(rTestApp.m_application, rTestApp.m_topData, TESTAPP_DATA_APPLICATION);
+
+    auto &rResources = osp::top_emplace<osp::Resources> (rTestApp.m_topData, idResources);
+    /* unused */       osp::top_emplace<MainLoopControl>(rTestApp.m_topData, idMainLoopCtrl);
+
+    builder.task()
+        .name       ("Schedule Main Loop")
+        .schedules  ({plApp.mainLoop(EStgOptn::Schedule)})
+        .push_to    (rTestApp.m_application.m_tasks)
+        .args       ({                  idMainLoopCtrl})
+        .func([] (MainLoopControl const& rMainLoopCtrl) noexcept -> osp::TaskActions
+    {
+        if (   ! rMainLoopCtrl.doUpdate
+            && ! rMainLoopCtrl.doSync
+            && ! rMainLoopCtrl.doResync
+            && ! rMainLoopCtrl.doRender)
+        {
+            return osp::TaskAction::Cancel;
+        }
+        else
+        {
+            return { };
+        }
+    });
+
+    rResources.resize_types(osp::ResTypeIdReg_t::size());
+
+    rResources.data_register<Trade::ImageData2D>(gc_image);
+    rResources.data_register<Trade::TextureData>(gc_texture);
+    rResources.data_register<osp::TextureImgSource>(gc_texture);
+    rResources.data_register<Trade::MeshData>(gc_mesh);
+    rResources.data_register<osp::MeshLods>(gc_mesh);
+    rResources.data_register<osp::ImporterData>(gc_importer);
+    rResources.data_register<osp::Prefabs>(gc_importer);
+    rResources.data_register<osp::PrefabRecipes>(gc_importer);
+    osp::register_tinygltf_resources(rResources);
+    rTestApp.m_defaultPkg = rResources.pkg_create();
+
+    // Load sturdy glTF files
+    const std::string_view datapath = { "OSPData/adera/" };
+    const std::vector<std::string_view> meshes =
+    {
+        "spamcan.sturdy.gltf",
+        "stomper.sturdy.gltf",
+        "ph_capsule.sturdy.gltf",
+        "ph_fuselage.sturdy.gltf",
+        "ph_engine.sturdy.gltf",
+        //"ph_plume.sturdy.gltf",
+        "ph_rcs.sturdy.gltf"
+        //"ph_rcs_plume.sturdy.gltf"
+    };
+
+    // TODO: Make new gltf loader. This will read gltf files and dump meshes,
+    //       images, textures, and other relevant data into osp::Resources
+    std::vector<std::string> meshPaths;
+    std::vector<std::string_view> meshPathViews;
+    meshPaths.reserve(meshes.size());
+    meshPathViews.reserve(meshes.size());
+    for (auto const& meshName : meshes)
+    {
+        meshPathViews.emplace_back(meshPaths.emplace_back(osp::string_concat(datapath, meshName)));
+    }
+
+    // Cooked asset pack: warm launches mmap pre-parsed prefabs and upload-ready mesh/image
+    // blobs instead of re-parsing glTF. Function-local static so the mapping outlives every
+    // Resources entry referencing it.
+    static osp::AssetPack s_assetPack;
+    std::string const packPath = osp::string_concat(datapath, "sturdy.ospak");
+
+    auto const pack_is_fresh = [&packPath, &meshPaths] () -> bool
+    {
+        std::error_code ec;
+        auto const packTime = std::filesystem::last_write_time(packPath, ec);
+        if (ec)
+        {
+            return false;
+        }
+        for (std::string const& src : meshPaths)
+        {
+            auto const srcTime = std::filesystem::last_write_time(src, ec);
+            if (ec || packTime < srcTime)
+            {
+                return false; // Source file changed since the pack was cooked
+            }
+        }
+        return true;
+    };
+
+    std::vector<osp::ResId> packImporters;
+    if (pack_is_fresh() && s_assetPack.open(packPath))
+    {
+        packImporters = osp::load_asset_pack(s_assetPack, rResources, rTestApp.m_defaultPkg);
+    }
+
+    if (packImporters.empty())
+    {
+        // Cold path: parse glTF on worker threads, then cook a pack for the next launch
+        std::vector<osp::ResId> imported;
+        imported.reserve(meshPathViews.size());
+        for (osp::ResId const res : osp::load_tinygltf_files(meshPathViews, rResources, rTestApp.m_defaultPkg))
+        {
+            if (res != lgrn::id_null<osp::ResId>())
+            {
+                osp::assigns_prefabs_tinygltf(rResources, res);
+                imported.push_back(res);
+            }
+        }
+        osp::cook_asset_pack(packPath, rResources, osp::arrayView(imported.data(), imported.size()));
+    }
+    else
+    {
+        OSP_LOG_INFO("Loaded assets from pack {}", packPath);
+    }
+
+    // Add a default primitives
+    auto const add_mesh_quick = [&rResources, &rTestApp] (std::string_view const name, Trade::MeshData&& data)
+    {
+        osp::ResId const meshId = rResources.create(gc_mesh, rTestApp.m_defaultPkg, osp::SharedString::create(name));
+        rResources.data_add<Trade::MeshData>(gc_mesh, meshId, std::move(data));
+    };
+
+    Trade::MeshData &&cylinder = Magnum::MeshTools::transform3D( Primitives::cylinderSolid(3, 16, 1.0f, CylinderFlag::CapEnds), Matrix4::rotationX(Deg(90)), 0);
+    Trade::MeshData &&cone = Magnum::MeshTools::transform3D( Primitives::coneSolid(3, 16, 1.0f, ConeFlag::CapEnd), Matrix4::rotationX(Deg(90)), 0);
+
+    add_mesh_quick("cube", Primitives::cubeSolid());
+    add_mesh_quick("cubewire", Primitives::cubeWireframe());
+    add_mesh_quick("sphere", Primitives::icosphereSolid(2));
+    add_mesh_quick("cylinder", std::move(cylinder));
+    add_mesh_quick("cone", std::move(cone));
+    add_mesh_quick("grid64solid", Primitives::grid3DSolid({63, 63}));
+
+    OSP_LOG_INFO("Resource loading complete");
+}
+
+} // namespace testapp
@@ -27,44 +27,34 @@
 #include "testapp.h"
 #include "scenarios.h"
 #include "identifiers.h"
+#include "load_resources.h"
 #include "sessions/common.h"
 #include "sessions/magnum.h"
 
-#include <osp/core/Resources.h>
-#include <osp/core/string_concat.h>
-#include <osp/drawing/own_restypes.h>
+#include <osp/tasks/graph_cache.h>
 #include <osp/tasks/top_execute.h>
+#include <osp/util/input_replay.h>
 #include <osp/util/logging.h>
-#include <osp/vehicles/ImporterData.h>
-#include <osp/vehicles/load_tinygltf.h>
-
-#include <Magnum/MeshTools/Transform.h>
-#include <Magnum/Primitives/Cone.h>
-#include <Magnum/Primitives/Cylinder.h>
-#include <Magnum/Primitives/Cube.h>
-#include <Magnum/Primitives/Grid.h>
-#include <Magnum/Primitives/Icosphere.h>
-#include <Magnum/Trade/ImageData.h>
-#include <Magnum/Trade/TextureData.h>
-#include <Magnum/Trade/MeshData.h>
-
-#include <Corrade/Containers/ArrayViewStl.h>
+
 #include <Corrade/Utility/Arguments.h>
 
 #include <entt/core/any.hpp>
 
 #include <spdlog/sinks/stdout_color_sinks.h>
 
-#include <array>
-#include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 
 using namespace testapp;
 
+// Warm boot: compiled TaskGraph reused across launches while the task setup is unchanged
+constexpr std::string_view gc_graphCachePath = "OSPData/adera/taskgraph.osptg";
+
 /**
  * @brief Starts a spaghetti REPL (Read Evaluate Print Loop) interface that gets inputs from standard in
  *
@@ -81,16 +71,6 @@ void cli_loop(int argc, char** argv);
  */
 void start_magnum_async(int argc, char** argv);
 
-/**
- * @brief As the name implies
- *
- * This should only be called once for the entire lifetime
- * of the program.
- *
- * prefer not to use names like this outside of testapp
- */
-void load_a_bunch_of_stuff();
-
 // called only from commands to display information
 void print_help();
 void print_resources();
@@ -101,6 +81,12 @@ SingleThreadedExecutor g_executor;
 
 std::thread g_magnumThread;
 
+// Input record/replay; paths set from command line, used by the magnum thread
+osp::input::InputRecorder g_inputRecorder;
+osp::input::InputReplayer g_inputReplayer;
+std::string g_recordInputPath;
+std::string g_replayInputPath;
+
 // Loggers
 osp::Logger_t g_mainThreadLogger;
 osp::Logger_t g_logExecutor;
@@ -115,16 +101,21 @@ int main(int argc, char** argv)
         .addOption("config")                .setHelp("config",      "path to configuration file to use")
         .addBooleanOption("norepl")         .setHelp("norepl",      "don't enter read, evaluate, print, loop.")
         .addBooleanOption("log-exec")       .setHelp("log-exec",    "Log Task/Pipeline Execution (Extremely chatty!)")
+        .addOption("stall-watchdog", "0")   .setHelp("stall-watchdog", "Report pipelines stalled longer than this many milliseconds (0: disabled)")
+        .addOption("record-input")          .setHelp("record-input",  "Record raw input and frame timesteps to this file on window close")
+        .addOption("replay-input")          .setHelp("replay-input",  "Replay a recorded input file instead of live input")
         // TODO .addBooleanOption('v', "verbose")   .setHelp("verbose",     "log verbosely")
         .setGlobalHelp("Helptext goes here.")
         .parse(argc, argv);
 
-    // Setup logging
+    // Setup logging; tasks log from inside the frame, so route messages through the
+    // background logging thread instead of paying for sink locking and I/O in-frame
+    osp::init_async_logging();
     auto pSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
     pSink->set_pattern("[%T.%e] [%n] [%^%l%$] [%s:%#] %v");
-    g_mainThreadLogger = std::make_shared<spdlog::logger>("main-thread", pSink);
-    g_logExecutor  = std::make_shared<spdlog::logger>("executor", pSink);
-    g_logMagnumApp = std::make_shared<spdlog::logger>("flight", std::move(pSink));
+    g_mainThreadLogger = osp::make_async_logger("main-thread", pSink);
+    g_logExecutor  = osp::make_async_logger("executor", pSink);
+    g_logMagnumApp = osp::make_async_logger("flight", std::move(pSink));
 
     // Set thread-local logger used by OSP_LOG_* macros
     osp::set_thread_logger(g_mainThreadLogger);
@@ -136,8 +127,13 @@ int main(int argc, char** argv)
         g_executor.m_log = g_logExecutor;
     }
 
+    g_executor.m_stallThreshold = std::chrono::milliseconds{args.value<int>("stall-watchdog")};
+
+    g_recordInputPath = args.value("record-input");
+    g_replayInputPath = args.value("replay-input");
+
     g_testApp.m_topData.resize(64);
-    load_a_bunch_of_stuff();
+    load_a_bunch_of_stuff(g_testApp);
 
     if(args.value("scene") != "none")
     {
@@ -206,6 +202,11 @@ void cli_loop(int argc, char** argv)
                     g_testApp.m_scene.m_edges.m_syncWith.clear();
                 }
 
+                // Stale warm-boot hooks unpack the previous scenario's sessions, and stale
+                // census tags point into its freed contexts
+                g_testApp.m_sceneSnapshotWrite = nullptr;
+                g_testApp.m_memCensus.clear_tags();
+
                 g_testApp.m_rendererSetup = it->second.m_setup(g_testApp);
                 start_magnum_async(argc, argv);
             }
@@ -231,11 +232,32 @@ void cli_loop(int argc, char** argv)
                     start_magnum_async(argc, argv);
                 }
             }
-            else if (command == "list_pkg") 
+            else if (command == "list_pkg")
             {
                 print_resources();
             }
-            else if (command == "exit") 
+            else if (command == "mem")
+            {
+                if (g_testApp.m_memCensus.tags.empty())
+                {
+                    std::cout << "No memory census tags registered; open a scenario first\n";
+                }
+                for (osp::MemCensus::Tag const& tag : g_testApp.m_memCensus.tags)
+                {
+                    std::cout << "* " << tag.name
+                              << " - " << (tag.bytesLast / 1024u) << " KiB"
+                              << " (peak " << (tag.bytesPeak / 1024u) << " KiB)\n";
+                }
+            }
+            else if (command == "hud")
+            {
+                bool const enable = ! g_testApp.m_perfStats.hudEnabled
+                                                .load(std::memory_order_relaxed);
+                g_testApp.m_perfStats.hudEnabled.store(enable, std::memory_order_relaxed);
+                std::cout << (enable ? "Performance HUD enabled\n"
+                                     : "Performance HUD disabled\n");
+            }
+            else if (command == "exit")
             {
                 if (magnumOpen)
                 {
@@ -273,17 +295,54 @@ void start_magnum_async(int argc, char** argv)
         OSP_DECLARE_GET_DATA_IDS(g_testApp.m_magnum, TESTAPP_DATA_MAGNUM); // declares idActiveApp
         auto &rActiveApp = osp::top_get<MagnumApplication>(g_testApp.m_topData, idActiveApp);
 
+        if ( ! g_recordInputPath.empty())
+        {
+            g_inputRecorder.start();
+            rActiveApp.set_input_recorder(&g_inputRecorder);
+        }
+        if ( ! g_replayInputPath.empty() && g_inputReplayer.load(g_replayInputPath))
+        {
+            rActiveApp.set_input_replayer(&g_inputReplayer);
+        }
+
         // Setup renderer sessions
 
         g_testApp.m_rendererSetup(g_testApp);
 
-        g_testApp.m_graph = osp::make_exec_graph(g_testApp.m_tasks, {&g_testApp.m_renderer.m_edges, &g_testApp.m_scene.m_edges});
+        // Warm boot: load the compiled TaskGraph from a previous launch when the task setup
+        // hashes the same; otherwise rebuild in-place (reusing the previous graph's
+        // allocations across renderer restarts) and rewrite the cache for next time
+        osp::TaskEdges const* const edgesArr[] = {&g_testApp.m_renderer.m_edges, &g_testApp.m_scene.m_edges};
+        std::uint64_t const graphHash = osp::exec_graph_hash(g_testApp.m_tasks, edgesArr);
+
+        if (std::optional<osp::TaskGraph> cached = osp::load_exec_graph(graphHash, gc_graphCachePath))
+        {
+            g_testApp.m_graph = std::move(*cached);
+        }
+        else
+        {
+            osp::make_exec_graph_into(g_testApp.m_tasks, edgesArr, g_testApp.m_graph);
+            osp::save_exec_graph(g_testApp.m_graph, graphHash, gc_graphCachePath);
+        }
         g_executor.load(g_testApp);
 
         // Starts the main loop. This function is blocking, and will only return
         // once the window is closed. See MagnumApplication::drawEvent
         rActiveApp.exec();
 
+        if (g_inputRecorder.recording())
+        {
+            g_inputRecorder.save(g_recordInputPath);
+        }
+
+        // Warm boot: scenarios supporting it dump their scene here, while its sessions are
+        // still alive, so the next entry restores it instead of cold-booting
+        if (g_testApp.m_sceneSnapshotWrite != nullptr
+            && ! g_testApp.m_sceneSnapshotWrite(g_testApp))
+        {
+            OSP_LOG_WARN("Failed to write warm-boot scene snapshot");
+        }
+
         // Destruct draw function lambda first
         // EngineTest stores the entire renderer in here (if it's active)
         rActiveApp.set_osp_app({});
@@ -302,97 +361,6 @@ void start_magnum_async(int argc, char** argv)
     g_magnumThread.swap(t);
 }
 
-void load_a_bunch_of_stuff()
-{
-    using namespace osp::restypes;
-    using namespace Magnum;
-    using Primitives::ConeFlag;
-    using Primitives::CylinderFlag;
-
-    osp::TopTaskBuilder builder{g_testApp.m_tasks, g_testApp.m_applicationGroup.m_edges, g_testApp.m_taskData};
-    auto const plApp = g_testApp.m_application.create_pipelines<PlApplication>(builder);
-
-    builder.pipeline(plApp.mainLoop).loops(true).wait_for_signal(EStgOptn::ModifyOrSignal);
-
-    // declares idResources and idMainLoopCtrl
-    OSP_DECLARE_CREATE_DATA_IDS(g_testApp.m_application, g_testApp.m_topData, TESTAPP_DATA_APPLICATION);
-
-    auto &rResources = osp::top_emplace<osp::Resources> (g_testApp.m_topData, idResources);
-    /* unused */       osp::top_emplace<MainLoopControl>(g_testApp.m_topData, idMainLoopCtrl);
-
-    builder.task()
-        .name       ("Schedule Main Loop")
-        .schedules  ({plApp.mainLoop(EStgOptn::Schedule)})
-        .push_to    (g_testApp.m_application.m_tasks)
-        .args       ({                  idMainLoopCtrl})
-        .func([] (MainLoopControl const& rMainLoopCtrl) noexcept -> osp::TaskActions
-    {
-        if (   ! rMainLoopCtrl.doUpdate
-            && ! rMainLoopCtrl.doSync
-            && ! rMainLoopCtrl.doResync
-            && ! rMainLoopCtrl.doRender)
-        {
-            return osp::TaskAction::Cancel;
-        }
-        else
-        {
-            return { };
-        }
-    });
-
-    rResources.resize_types(osp::ResTypeIdReg_t::size());
-
-    rResources.data_register<Trade::ImageData2D>(gc_image);
-    rResources.data_register<Trade::TextureData>(gc_texture);
-    rResources.data_register<osp::TextureImgSource>(gc_texture);
-    rResources.data_register<Trade::MeshData>(gc_mesh);
-    rResources.data_register<osp::ImporterData>(gc_importer);
-    rResources.data_register<osp::Prefabs>(gc_importer);
-    osp::register_tinygltf_resources(rResources);
-    g_testApp.m_defaultPkg = rResources.pkg_create();
-
-    // Load sturdy glTF files
-    const std::string_view datapath = { "OSPData/adera/" };
-    const std::vector<std::string_view> meshes =
-    {
-        "spamcan.sturdy.gltf",
-        "stomper.sturdy.gltf",
-        "ph_capsule.sturdy.gltf",
-        "ph_fuselage.sturdy.gltf",
-        "ph_engine.sturdy.gltf",
-        //"ph_plume.sturdy.gltf",
-        "ph_rcs.sturdy.gltf"
-        //"ph_rcs_plume.sturdy.gltf"
-    };
-
-    // TODO: Make new gltf loader. This will read gltf files and dump meshes,
-    //       images, textures, and other relevant data into osp::Resources
-    for (auto const& meshName : meshes)
-    {
-        osp::ResId res = osp::load_tinygltf_file(osp::string_concat(datapath, meshName), rResources, g_testApp.m_defaultPkg);
-        osp::assigns_prefabs_tinygltf(rResources, res);
-    }
-
-    // Add a default primitives
-    auto const add_mesh_quick = [&rResources = rResources] (std::string_view const name, Trade::MeshData&& data)
-    {
-        osp::ResId const meshId = rResources.create(gc_mesh, g_testApp.m_defaultPkg, osp::SharedString::create(name));
-        rResources.data_add<Trade::MeshData>(gc_mesh, meshId, std::move(data));
-    };
-
-    Trade::MeshData &&cylinder = Magnum::MeshTools::transform3D( Primitives::cylinderSolid(3, 16, 1.0f, CylinderFlag::CapEnds), Matrix4::rotationX(Deg(90)), 0);
-    Trade::MeshData &&cone = Magnum::MeshTools::transform3D( Primitives::coneSolid(3, 16, 1.0f, ConeFlag::CapEnd), Matrix4::rotationX(Deg(90)), 0);
-
-    add_mesh_quick("cube", Primitives::cubeSolid());
-    add_mesh_quick("cubewire", Primitives::cubeWireframe());
-    add_mesh_quick("sphere", Primitives::icosphereSolid(2));
-    add_mesh_quick("cylinder", std::move(cylinder));
-    add_mesh_quick("cone", std::move(cone));
-    add_mesh_quick("grid64solid", Primitives::grid3DSolid({63, 63}));
-
-    OSP_LOG_INFO("Resource loading complete");
-}
-
 //-----------------------------------------------------------------------------
 
 void print_help()
@@ -416,6 +384,8 @@ void print_help()
     std::cout
         << "Other commands:\n"
         << "* list_pkg  - List Packages and Resources\n"
+        << "* mem       - Per-subsystem memory census (current and peak bytes)\n"
+        << "* hud       - Toggle the on-screen performance HUD\n"
         << "* help      - Show this again\n"
         << "* reopen    - Re-open Magnum Application\n"
         << "* exit      - Deallocate everything and return memory to OS\n";
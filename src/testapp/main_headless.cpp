@@ -0,0 +1,212 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Headless entry point: runs the physics test scene's update loop flat out with no window,
+// no GL context, and no renderer sessions, then reports steps per second. Intended for
+// server-style hosting and as a perf baseline that CI can run on machines without a GPU.
+
+#include "testapp.h"
+#include "scenarios.h"
+#include "identifiers.h"
+#include "load_resources.h"
+
+#include "sessions/common.h"
+#include "sessions/newton.h"
+#include "sessions/physics.h"
+#include "sessions/shapes.h"
+
+#include <osp/core/unpack.h>
+#include <osp/tasks/top_execute.h>
+#include <osp/util/logging.h>
+
+#include <Corrade/Utility/Arguments.h>
+
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace testapp;
+
+TestApp g_testApp;
+
+SingleThreadedExecutor g_executor;
+
+// Loggers
+osp::Logger_t g_mainThreadLogger;
+osp::Logger_t g_logExecutor;
+
+/**
+ * @brief Compose the same scene Sessions as the windowed "physics" scenario, minus every
+ *        renderer Session
+ */
+static void setup_physics_scene()
+{
+    using namespace osp;
+    using namespace testapp::scenes;
+
+    register_stage_enums();
+
+    // Same MaterialIds the windowed scenarios use; with no renderer loaded they only tag
+    // DrawEnts and nothing reads them
+    constexpr auto sc_matVisualizer = draw::MaterialId(0);
+    constexpr auto sc_matPhong      = draw::MaterialId(2);
+    constexpr auto sc_gravityForce  = Vector3{0.0f, 0.0f, -9.81f};
+
+    auto const  defaultPkg      = g_testApp.m_defaultPkg;
+    auto const  application     = g_testApp.m_application;
+    auto        & rTopData      = g_testApp.m_topData;
+
+    TopTaskBuilder builder{g_testApp.m_tasks, g_testApp.m_scene.m_edges, g_testApp.m_taskData};
+
+    auto & [scene, commonScene, physics, physShapes, droppers, bounds,
+            newton, nwtGravSet, nwtGrav, physShapesNwt]
+            = resize_then_unpack<10>(g_testApp.m_scene.m_sessions);
+
+    scene           = setup_scene               (builder, rTopData, application);
+    commonScene     = setup_common_scene        (builder, rTopData, scene, application, defaultPkg);
+    physics         = setup_physics             (builder, rTopData, scene, commonScene);
+    physShapes      = setup_phys_shapes         (builder, rTopData, scene, commonScene, physics, sc_matPhong);
+    droppers        = setup_droppers            (builder, rTopData, scene, commonScene, physShapes);
+    bounds          = setup_bounds              (builder, rTopData, scene, commonScene, physShapes);
+
+    newton          = setup_newton              (builder, rTopData, scene, commonScene, physics);
+    nwtGravSet      = setup_newton_factors      (builder, rTopData);
+    nwtGrav         = setup_newton_force_accel  (builder, rTopData, newton, nwtGravSet, sc_gravityForce);
+    physShapesNwt   = setup_phys_shapes_newton  (builder, rTopData, commonScene, physics, physShapes, newton, nwtGravSet);
+
+    add_floor(rTopData, physShapes, sc_matVisualizer, defaultPkg, 4);
+}
+
+int main(int argc, char** argv)
+{
+    // Command line argument parsing
+    Corrade::Utility::Arguments args;
+    args.addOption("steps", "3600")     .setHelp("steps",       "Number of scene update steps to run")
+        .addBooleanOption("log-exec")   .setHelp("log-exec",    "Log Task/Pipeline Execution (Extremely chatty!)")
+        .addOption("stall-watchdog", "0").setHelp("stall-watchdog", "Report pipelines stalled longer than this many milliseconds (0: disabled)")
+        .setGlobalHelp("Run the physics test scene without a window and report steps/second.")
+        .parse(argc, argv);
+
+    // Setup logging; messages go through the background logging thread so log
+    // statements inside scene tasks don't distort the steps/second measurement
+    osp::init_async_logging();
+    auto pSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+    pSink->set_pattern("[%T.%e] [%n] [%^%l%$] [%s:%#] %v");
+    g_mainThreadLogger = osp::make_async_logger("main-thread", pSink);
+    g_logExecutor  = osp::make_async_logger("executor", std::move(pSink));
+
+    // Set thread-local logger used by OSP_LOG_* macros
+    osp::set_thread_logger(g_mainThreadLogger);
+
+    g_testApp.m_pExecutor = &g_executor;
+
+    if (args.isSet("log-exec"))
+    {
+        g_executor.m_log = g_logExecutor;
+    }
+
+    g_executor.m_stallThreshold = std::chrono::milliseconds{args.value<int>("stall-watchdog")};
+
+    long const steps = std::max(1L, std::stol(args.value("steps")));
+
+    g_testApp.m_topData.resize(64);
+    load_a_bunch_of_stuff(g_testApp);
+
+    setup_physics_scene();
+
+    osp::make_exec_graph_into(g_testApp.m_tasks, {&g_testApp.m_scene.m_edges}, g_testApp.m_graph);
+    g_executor.load(g_testApp);
+
+    OSP_DECLARE_GET_DATA_IDS(g_testApp.m_application,           TESTAPP_DATA_APPLICATION);
+    OSP_DECLARE_GET_DATA_IDS(g_testApp.m_scene.m_sessions[1],   TESTAPP_DATA_COMMON_SCENE);
+
+    auto &rMainLoopCtrl = osp::top_get<MainLoopControl>(g_testApp.m_topData, idMainLoopCtrl);
+    auto &rDeltaTimeIn  = osp::top_get<float>          (g_testApp.m_topData, idDeltaTimeIn);
+
+    osp::PipelineId const mainLoop    = g_testApp.m_application       .get_pipelines<PlApplication>().mainLoop;
+    osp::PipelineId const sceneUpdate = g_testApp.m_scene.m_sessions[0].get_pipelines<PlScene>()     .update;
+
+    g_executor.run(g_testApp, mainLoop);
+
+    // No renderer means no frame pacing; every iteration is an update-only iteration at a
+    // fixed simulated timestep, run as fast as the scene tasks allow
+    constexpr float updatePeriod = 1.0f / 60.0f;
+    rDeltaTimeIn = updatePeriod;
+
+    OSP_LOG_INFO("Running {} steps...", steps);
+
+    auto const timeStart = std::chrono::steady_clock::now();
+
+    for (long i = 0; i < steps; ++i)
+    {
+        rMainLoopCtrl = MainLoopControl{
+            .doUpdate = true,
+            .doSync   = false,
+            .doResync = false,
+            .doRender = false,
+        };
+
+        g_executor.signal(g_testApp, mainLoop);
+        g_executor.signal(g_testApp, sceneUpdate);
+        g_executor.wait(g_testApp);
+    }
+
+    auto const timeEnd = std::chrono::steady_clock::now();
+    double const seconds = std::chrono::duration<double>(timeEnd - timeStart).count();
+
+    // Stop the main loop
+    rMainLoopCtrl = MainLoopControl{
+        .doUpdate = false,
+        .doSync   = false,
+        .doResync = false,
+        .doRender = false,
+    };
+
+    g_executor.signal(g_testApp, mainLoop);
+    g_executor.signal(g_testApp, sceneUpdate);
+    g_executor.wait(g_testApp);
+
+    if (g_executor.is_running(g_testApp))
+    {
+        // Main loop must have stopped, but didn't!
+        g_executor.wait(g_testApp);
+        std::abort();
+    }
+
+    std::cout << steps << " steps in " << seconds << " s: "
+              << double(steps) / seconds << " steps/second\n";
+
+    g_testApp.close_sessions(g_testApp.m_scene.m_sessions);
+    g_testApp.m_scene.m_sessions.clear();
+    g_testApp.m_scene.m_edges.m_syncWith.clear();
+
+    g_testApp.clear_resource_owners();
+
+    spdlog::shutdown();
+    return 0;
+}
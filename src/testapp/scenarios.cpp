@@ -40,18 +40,24 @@
 #include "sessions/vehicles_prebuilt.h"
 
 #include "MagnumApplication.h"
+#include "PerfHud.h"
 
 #include <adera/activescene/vehicles_vb_fn.h>
 #include <adera/drawing/CameraController.h>
 
 #include <osp/activescene/basic.h>
+#include <osp/activescene/serialize.h>
+#include <osp/drawing/drawing_fn.h>
 #include <osp/core/Resources.h>
 #include <osp/tasks/top_utils.h>
+#include <osp/universe/universe.h>
 #include <osp/util/logging.h>
 
 #include <Magnum/GL/DefaultFramebuffer.h>
 
 #include <algorithm>
+#include <bit>
+#include <future>
 
 using namespace adera;
 using namespace osp;
@@ -60,7 +66,7 @@ using namespace osp::active;
 namespace testapp
 {
 
-static void setup_magnum_draw(TestApp& rTestApp, Session const& scene, Session const& sceneRenderer, Session const& magnumScene);
+static void setup_magnum_draw(TestApp& rTestApp, Session const& scene, Session const& commonScene, Session const& sceneRenderer, Session const& magnumScene);
 
 // MaterialIds hints which shaders should be used to draw a DrawEnt
 // DrawEnts can be assigned to multiple materials
@@ -69,6 +75,11 @@ static constexpr auto   sc_matFlat          = draw::MaterialId(1);
 static constexpr auto   sc_matPhong         = draw::MaterialId(2);
 static constexpr int    sc_materialCount    = 4;
 
+// Warm boot: scene state dumped when a scenario closes, restored by bulk reads on the next
+// entry to skip spawning and settling. Bump the revision when restored context layouts change
+static constexpr std::string_view   sc_vehiclesSnapshot     = "OSPData/adera/warmboot-vehicles.ospscn";
+static constexpr std::uint32_t      sc_vehiclesSnapshotRev  = 1;
+
 static ScenarioMap_t make_scenarios()
 {   
     ScenarioMap_t scenarioMap;
@@ -126,6 +137,37 @@ static ScenarioMap_t make_scenarios()
         return setup_renderer;
     });
 
+    add_scenario("enginetest-bench", "enginetest as a throughput benchmark: many cubes, scripted camera, CSV timings",
+                 [] (TestApp& rTestApp) -> RendererSetupFunc_t
+    {
+        OSP_DECLARE_GET_DATA_IDS(rTestApp.m_application, TESTAPP_DATA_APPLICATION);
+        auto &rResources = top_get<Resources>(rTestApp.m_topData, idResources);
+
+        rTestApp.m_scene.m_sessions.resize(1);
+        TopDataId const idSceneData = rTestApp.m_scene.m_sessions[0].acquire_data<1>(rTestApp.m_topData)[0];
+
+        // Same scene as "enginetest" above, but with a deterministic 4096-cube workload
+        // and benchmark mode on. Comparing its CSV output against the task-graph
+        // scenarios running equivalent work measures framework overhead.
+        top_assign<enginetest::EngineTestScene>(rTestApp.m_topData, idSceneData, enginetest::setup_scene(rResources, rTestApp.m_defaultPkg, 4096, true));
+
+        RendererSetupFunc_t const setup_renderer = [] (TestApp& rTestApp) -> void
+        {
+            TopDataId const idSceneData = rTestApp.m_scene.m_sessions[0].m_data[0];
+            auto &rScene = top_get<enginetest::EngineTestScene>(rTestApp.m_topData, idSceneData);
+
+            OSP_DECLARE_GET_DATA_IDS(rTestApp.m_magnum,     TESTAPP_DATA_MAGNUM);
+            OSP_DECLARE_GET_DATA_IDS(rTestApp.m_windowApp,  TESTAPP_DATA_WINDOW_APP);
+            auto &rActiveApp    = top_get< MagnumApplication >      (rTestApp.m_topData, idActiveApp);
+            auto &rRenderGl     = top_get< draw::RenderGL >         (rTestApp.m_topData, idRenderGl);
+            auto &rUserInput    = top_get< input::UserInputHandler >(rTestApp.m_topData, idUserInput);
+
+            rActiveApp.set_osp_app(enginetest::generate_osp_magnum_app(rScene, rActiveApp, rRenderGl, rUserInput));
+        };
+
+        return setup_renderer;
+    });
+
     static constexpr auto sc_gravityForce = Vector3{0.0f, 0.0f, -9.81f};
 
     add_scenario("physics", "Newton Dynamics integration test scenario",
@@ -185,7 +227,7 @@ static ScenarioMap_t make_scenarios()
             shapeDraw       = setup_phys_shapes_draw    (builder, rTopData, windowApp, sceneRenderer, commonScene, physics, physShapes);
             cursor          = setup_cursor              (builder, rTopData, application, sceneRenderer, cameraCtrl, commonScene, sc_matFlat, rTestApp.m_defaultPkg);
 
-            setup_magnum_draw(rTestApp, scene, sceneRenderer, magnumScene);
+            setup_magnum_draw(rTestApp, scene, commonScene, sceneRenderer, magnumScene);
         };
 
         #undef SCENE_SESSIONS
@@ -228,8 +270,17 @@ static ScenarioMap_t make_scenarios()
         vehicleSpawnVB  = setup_vehicle_spawn_vb    (builder, rTopData, application, scene, commonScene, prefabs, parts, vehicleSpawn, signalsFloat);
         testVehicles    = setup_prebuilt_vehicles   (builder, rTopData, application, scene);
 
+        // Building the prebuilt vehicles is the heaviest part of entering this scenario and
+        // only touches its own TopData slot plus Resources; overlap it with the remaining
+        // session setup, none of which reads either until the join below
+        std::future<void> buildVehicles = std::async(std::launch::async,
+                [&rTopData, &application, &testVehicles] ()
+        {
+            initialize_prebuilt_vehicles(rTopData, application, testVehicles);
+        });
+
         machRocket      = setup_mach_rocket         (builder, rTopData, scene, parts, signalsFloat);
-        machRcsDriver   = setup_mach_rcsdriver      (builder, rTopData, scene, parts, signalsFloat);
+        machRcsDriver   = setup_mach_rcsdriver      (builder, rTopData, scene, parts, signalsFloat, vehicleSpawn);
 
         newton          = setup_newton              (builder, rTopData, scene, commonScene, physics);
         nwtGravSet      = setup_newton_factors      (builder, rTopData);
@@ -239,26 +290,72 @@ static ScenarioMap_t make_scenarios()
         nwtRocketSet    = setup_newton_factors      (builder, rTopData);
         rocketsNwt      = setup_rocket_thrust_newton(builder, rTopData, scene, commonScene, physics, prefabs, parts, signalsFloat, newton, nwtRocketSet);
 
+        buildVehicles.get();
+
+        OSP_DECLARE_GET_DATA_IDS(application,    TESTAPP_DATA_APPLICATION);
+        OSP_DECLARE_GET_DATA_IDS(commonScene,    TESTAPP_DATA_COMMON_SCENE);
+        OSP_DECLARE_GET_DATA_IDS(physics,        TESTAPP_DATA_PHYSICS);
+        OSP_DECLARE_GET_DATA_IDS(parts,          TESTAPP_DATA_PARTS);
+        OSP_DECLARE_GET_DATA_IDS(signalsFloat,   TESTAPP_DATA_SIGNALS_FLOAT);
         OSP_DECLARE_GET_DATA_IDS(vehicleSpawn,   TESTAPP_DATA_VEHICLE_SPAWN);
         OSP_DECLARE_GET_DATA_IDS(vehicleSpawnVB, TESTAPP_DATA_VEHICLE_SPAWN_VB);
         OSP_DECLARE_GET_DATA_IDS(testVehicles,   TESTAPP_DATA_TEST_VEHICLES);
 
-        auto &rVehicleSpawn     = top_get<ACtxVehicleSpawn>     (rTopData, idVehicleSpawn);
-        auto &rVehicleSpawnVB   = top_get<ACtxVehicleSpawnVB>   (rTopData, idVehicleSpawnVB);
-        auto &rPrebuiltVehicles = top_get<PrebuiltVehicles>     (rTopData, idPrebuiltVehicles);
-
-        for (int i = 0; i < 10; ++i)
+        // Warm boot: restore the fully-initialized scene dumped when this scenario was last
+        // closed. The restored state already contains the floor and the spawned, settled
+        // vehicles, so the cold-boot spawn below is skipped entirely; missing, corrupt, or
+        // out-of-revision snapshots fall through to a normal cold boot.
+        bool const warmBooted = read_scene_snapshot(
+                sc_vehiclesSnapshot, sc_vehiclesSnapshotRev,
+                top_get<ACtxBasic>                  (rTopData, idBasic),
+                top_get<ACtxPhysics>                (rTopData, idPhys),
+                top_get<ACtxParts>                  (rTopData, idScnParts),
+                top_get<link::SignalValues_t<float>>(rTopData, idSigValFloat),
+                top_get<Resources>                  (rTopData, idResources));
+
+        if ( ! warmBooted)
         {
-            rVehicleSpawn.spawnRequest.push_back(
+            auto &rVehicleSpawn     = top_get<ACtxVehicleSpawn>     (rTopData, idVehicleSpawn);
+            auto &rVehicleSpawnVB   = top_get<ACtxVehicleSpawnVB>   (rTopData, idVehicleSpawnVB);
+            auto &rPrebuiltVehicles = top_get<PrebuiltVehicles>     (rTopData, idPrebuiltVehicles);
+
+            for (int i = 0; i < 10; ++i)
             {
-               .position = {float(i - 2) * 8.0f, 30.0f, 10.0f},
-               .velocity = {0.0, 0.0f, 50.0f * float(i)},
-               .rotation = {}
-            });
-            rVehicleSpawnVB.dataVB.push_back(rPrebuiltVehicles[gc_pbvSimpleCommandServiceModule].get());
+                rVehicleSpawn.spawnRequest.push_back(
+                {
+                   .position = {float(i - 2) * 8.0f, 30.0f, 10.0f},
+                   .velocity = {0.0, 0.0f, 50.0f * float(i)},
+                   .rotation = {}
+                });
+                rVehicleSpawnVB.dataVB.push_back(rPrebuiltVehicles[gc_pbvSimpleCommandServiceModule].get());
+            }
+
+            add_floor(rTopData, physShapes, sc_matVisualizer, defaultPkg, 4);
         }
 
-        add_floor(rTopData, physShapes, sc_matVisualizer, defaultPkg, 4);
+        // Dump the scene when the application closes, so the next entry of this scenario
+        // warm-boots from bulk reads instead of re-spawning and re-settling
+        rTestApp.m_sceneSnapshotWrite = [] (TestApp& rTestApp) -> bool
+        {
+            auto const  application = rTestApp.m_application;
+            auto        & rTopData  = rTestApp.m_topData;
+
+            auto & [SCENE_SESSIONS] = unpack<22>(rTestApp.m_scene.m_sessions);
+
+            OSP_DECLARE_GET_DATA_IDS(application,  TESTAPP_DATA_APPLICATION);
+            OSP_DECLARE_GET_DATA_IDS(commonScene,  TESTAPP_DATA_COMMON_SCENE);
+            OSP_DECLARE_GET_DATA_IDS(physics,      TESTAPP_DATA_PHYSICS);
+            OSP_DECLARE_GET_DATA_IDS(parts,        TESTAPP_DATA_PARTS);
+            OSP_DECLARE_GET_DATA_IDS(signalsFloat, TESTAPP_DATA_SIGNALS_FLOAT);
+
+            return write_scene_snapshot(
+                    sc_vehiclesSnapshot, sc_vehiclesSnapshotRev,
+                    top_get<ACtxBasic>                  (rTopData, idBasic),
+                    top_get<ACtxPhysics>                (rTopData, idPhys),
+                    top_get<ACtxParts>                  (rTopData, idScnParts),
+                    top_get<link::SignalValues_t<float>>(rTopData, idSigValFloat),
+                    top_get<Resources>                  (rTopData, idResources));
+        };
 
         RendererSetupFunc_t const setup_renderer = [] (TestApp& rTestApp)
         {
@@ -290,7 +387,7 @@ static ScenarioMap_t make_scenarios()
             cameraVehicle   = setup_camera_vehicle      (builder, rTopData, windowApp, scene, sceneRenderer, commonScene, physics, parts, cameraCtrl, vehicleCtrl);
             thrustIndicator = setup_thrust_indicators   (builder, rTopData, application, windowApp, commonScene, parts, signalsFloat, sceneRenderer, defaultPkg, sc_matFlat);
 
-            setup_magnum_draw(rTestApp, scene, sceneRenderer, magnumScene);
+            setup_magnum_draw(rTestApp, scene, commonScene, sceneRenderer, magnumScene);
         };
 
         #undef SCENE_SESSIONS
@@ -302,7 +399,7 @@ static ScenarioMap_t make_scenarios()
     add_scenario("terrain", "Planet terrain mesh test",
                  [] (TestApp& rTestApp) -> RendererSetupFunc_t
     {
-        #define SCENE_SESSIONS      scene, commonScene, physics, physShapes, terrain, terrainIco, terrainSubdiv
+        #define SCENE_SESSIONS      scene, commonScene, physics, physShapes, terrain, terrainIco, terrainSubdiv, newton, nwtGravSet, nwtGrav, physShapesNwt, terrainNwt
         #define RENDERER_SESSIONS   sceneRenderer, magnumScene, cameraCtrl, cameraFree, shVisual, shFlat, shPhong, camThrow, shapeDraw, cursor, terrainDraw
 
         using namespace testapp::scenes;
@@ -313,7 +410,7 @@ static ScenarioMap_t make_scenarios()
 
         TopTaskBuilder builder{rTestApp.m_tasks, rTestApp.m_scene.m_edges, rTestApp.m_taskData};
 
-        auto & [SCENE_SESSIONS] = resize_then_unpack<7>(rTestApp.m_scene.m_sessions);
+        auto & [SCENE_SESSIONS] = resize_then_unpack<12>(rTestApp.m_scene.m_sessions);
 
         scene           = setup_scene               (builder, rTopData, application);
         commonScene     = setup_common_scene        (builder, rTopData, scene, application, defaultPkg);
@@ -322,6 +419,11 @@ static ScenarioMap_t make_scenarios()
         terrain         = setup_terrain             (builder, rTopData, scene);
         terrainIco      = setup_terrain_icosahedron (builder, rTopData, terrain);
         terrainSubdiv   = setup_terrain_subdiv_dist (builder, rTopData, scene, terrain, terrainIco);
+        newton          = setup_newton              (builder, rTopData, scene, commonScene, physics);
+        nwtGravSet      = setup_newton_factors      (builder, rTopData);
+        nwtGrav         = setup_newton_force_accel  (builder, rTopData, newton, nwtGravSet, sc_gravityForce);
+        physShapesNwt   = setup_phys_shapes_newton  (builder, rTopData, commonScene, physics, physShapes, newton, nwtGravSet);
+        terrainNwt      = setup_terrain_collider_newton(builder, rTopData, scene, terrain, newton);
 
         initialize_ico_terrain(rTopData, terrain, terrainIco, {
             .radius                 = 50.0,
@@ -331,6 +433,49 @@ static ScenarioMap_t make_scenarios()
             .chunkSubdivLevels      = 4
         });
 
+        // Degrade terrain resolution instead of frame rate when over budget: shrink the
+        // subdivision distance thresholds in proportion to frame-budget pressure
+        {
+            OSP_DECLARE_GET_DATA_IDS(terrain,    TESTAPP_DATA_TERRAIN);
+            OSP_DECLARE_GET_DATA_IDS(terrainIco, TESTAPP_DATA_TERRAIN_ICO);
+
+            auto &rTerrain    = top_get<ACtxTerrain>   (rTopData, idTerrain);
+            auto &rTerrainIco = top_get<ACtxTerrainIco>(rTopData, idTerrainIco);
+
+            rTestApp.m_frameBudget.listeners.push_back(osp::FrameBudget::Listener{
+                .func = [] (osp::FrameBudget const& budget,
+                            osp::FrameBudget::UserData_t userData) noexcept
+                {
+                    auto &rTerrain    = *reinterpret_cast<ACtxTerrain*>   (userData[0]);
+                    auto &rTerrainIco = *reinterpret_cast<ACtxTerrainIco*>(userData[1]);
+
+                    float const lodScale = 1.0f / std::clamp(budget.pressure, 1.0f, 4.0f);
+                    terrain_update_subdiv_thresholds(rTerrain, rTerrainIco, lodScale);
+                },
+                .userData = {&rTerrain, &rTerrainIco, nullptr, nullptr}
+            });
+
+            // Census tag over the terrain mesh and skeleton buffers, which dwarf the rest
+            // of this scenario's scene state
+            rTestApp.m_memCensus.add_tag("terrain",
+                    [] (MemCensus::UserData_t const userData) noexcept -> std::size_t
+            {
+                auto const &rTerrain = *reinterpret_cast<ACtxTerrain const*>(userData[0]);
+                auto const &rGeom    = rTerrain.chunkGeom;
+
+                return container_bytes(rGeom.chunkVbufPos)
+                     + container_bytes(rGeom.chunkVbufNrm)
+                     + container_bytes(rGeom.chunkVbufMorphPos)
+                     + container_bytes(rGeom.chunkIbuf)
+                     + container_bytes(rGeom.chunkFanNormalContrib)
+                     + container_bytes(rGeom.chunkFillSharedNormals)
+                     + container_bytes(rGeom.sharedNormalSum)
+                     + container_bytes(rTerrain.skData.positions)
+                     + container_bytes(rTerrain.skData.normals)
+                     + container_bytes(rTerrain.skData.centers);
+            }, {&rTerrain, nullptr, nullptr, nullptr});
+        }
+
         RendererSetupFunc_t const setup_renderer = [] (TestApp& rTestApp) -> void
         {
             auto const  application     = rTestApp.m_application;
@@ -341,7 +486,7 @@ static ScenarioMap_t make_scenarios()
 
             TopTaskBuilder builder{rTestApp.m_tasks, rTestApp.m_renderer.m_edges, rTestApp.m_taskData};
 
-            auto & [SCENE_SESSIONS] = unpack<7>(rTestApp.m_scene.m_sessions);
+            auto & [SCENE_SESSIONS] = unpack<12>(rTestApp.m_scene.m_sessions);
             auto & [RENDERER_SESSIONS] = resize_then_unpack<11>(rTestApp.m_renderer.m_sessions);
 
             sceneRenderer   = setup_scene_renderer      (builder, rTopData, application, windowApp, commonScene);
@@ -364,7 +509,7 @@ static ScenarioMap_t make_scenarios()
             rCamCtrl.m_orbitDistanceMin = 1.0f;
             rCamCtrl.m_moveSpeed = 0.5f;
 
-            setup_magnum_draw(rTestApp, scene, sceneRenderer, magnumScene);
+            setup_magnum_draw(rTestApp, scene, commonScene, sceneRenderer, magnumScene);
         };
 
         #undef SCENE_SESSIONS
@@ -406,7 +551,30 @@ static ScenarioMap_t make_scenarios()
 
         uniCore         = setup_uni_core            (builder, rTopData, tgApp.mainLoop);
         uniScnFrame     = setup_uni_sceneframe      (builder, rTopData, uniCore);
-        uniTestPlanets  = setup_uni_testplanets     (builder, rTopData, uniCore, uniScnFrame);
+        uniTestPlanets  = setup_uni_testplanets     (builder, rTopData, scene, uniCore, uniScnFrame);
+
+        // Census tag over satellite data across all coordinate spaces
+        {
+            OSP_DECLARE_GET_DATA_IDS(uniCore, TESTAPP_DATA_UNI_CORE);
+
+            auto &rUniverse = top_get<universe::Universe>(rTopData, idUniverse);
+
+            rTestApp.m_memCensus.add_tag("universe",
+                    [] (MemCensus::UserData_t const userData) noexcept -> std::size_t
+            {
+                auto const &rUniverse = *reinterpret_cast<universe::Universe const*>(userData[0]);
+
+                std::size_t total = container_bytes(rUniverse.m_coordCommon);
+                for (universe::CoSpaceCommon const &rCommon : rUniverse.m_coordCommon)
+                {
+                    // Committed bytes when satellite data sits in a reserved virtual range;
+                    // the reservation itself costs address space, not RAM
+                    total += (rCommon.m_dataCommitted != 0) ? rCommon.m_dataCommitted
+                                                            : rCommon.m_data.size();
+                }
+                return total;
+            }, {&rUniverse, nullptr, nullptr, nullptr});
+        }
 
         add_floor(rTopData, physShapes, sc_matVisualizer, defaultPkg, 0);
 
@@ -437,7 +605,7 @@ static ScenarioMap_t make_scenarios()
             cursor          = setup_cursor              (builder, rTopData, application, sceneRenderer, cameraCtrl, commonScene, sc_matFlat, rTestApp.m_defaultPkg);
             planetsDraw     = setup_testplanets_draw    (builder, rTopData, windowApp, sceneRenderer, cameraCtrl, commonScene, uniCore, uniScnFrame, uniTestPlanets, sc_matVisualizer, sc_matFlat);
 
-            setup_magnum_draw(rTestApp, scene, sceneRenderer, magnumScene);
+            setup_magnum_draw(rTestApp, scene, commonScene, sceneRenderer, magnumScene);
         };
 
         #undef SCENE_SESSIONS
@@ -475,10 +643,17 @@ struct MainLoopSignals
 class CommonMagnumApp : public IOspApplication
 {
 public:
-    CommonMagnumApp(TestApp &rTestApp, MainLoopControl &rMainLoopCtrl, MainLoopSignals signals) noexcept
+    CommonMagnumApp(TestApp &rTestApp, MainLoopControl &rMainLoopCtrl, float &rDeltaTimeIn,
+                    SceneTickRate const &tickRate, MainLoopSignals signals,
+                    draw::ACtxSceneRender const *pScnRender,
+                    draw::RenderGroup const     *pGroupFwd) noexcept
      : m_rTestApp       { rTestApp }
      , m_rMainLoopCtrl  { rMainLoopCtrl }
+     , m_rDeltaTimeIn   { rDeltaTimeIn }
+     , m_rTickRate      { tickRate }
      , m_signals        { signals }
+     , m_pScnRender     { pScnRender }
+     , m_pGroupFwd      { pGroupFwd }
     { }
 
     void run(MagnumApplication& rApp) override
@@ -506,16 +681,78 @@ public:
     {
         // Magnum Application's main loop calls this
 
+        // Scene updates step at a fixed rate accumulated from real frame time, decoupled
+        // from the display: a 30 Hz vsync-limited display runs extra update-only executor
+        // iterations to catch up, and a faster-than-60Hz display renders the latest state
+        // without updating. The accumulator is capped so a long hitch doesn't spiral into
+        // ever more catch-up work per frame.
+        //
+        // Scenes flagged background only tick once per background period: updates pile up
+        // in the accumulator between ticks, then drain as a burst of normal fixed steps,
+        // so simulated time stays correct while most frames run no update iterations.
+        float const tickPeriod  = m_rTickRate.background
+                                ? SceneTickRate::smc_backgroundPeriod : smc_updatePeriod;
+        float const maxCatchup  = std::max(smc_maxCatchup, tickPeriod + smc_updatePeriod);
+
+        m_updateAccum = std::min(m_updateAccum + delta, maxCatchup);
+
+        bool const tickDue = (m_updateAccum >= tickPeriod);
+
+        using clock_t = std::chrono::steady_clock;
+        clock_t::time_point const updateStart = clock_t::now();
+
+        while (tickDue && m_updateAccum >= 2.0f * smc_updatePeriod)
+        {
+            m_updateAccum -= smc_updatePeriod;
+            m_rDeltaTimeIn = smc_updatePeriod;
+
+            m_rMainLoopCtrl = MainLoopControl{
+                .doUpdate = true,
+                .doSync   = false,
+                .doResync = false,
+                .doRender = false,
+            };
+
+            signal_all();
+
+            m_rTestApp.m_pExecutor->wait(m_rTestApp);
+        }
+
+        float const updateMs
+                = std::chrono::duration<float, std::milli>(clock_t::now() - updateStart).count();
+
+        // Periodic memory census of the contexts scenarios tagged during setup
+        if (++m_censusCountdown >= smc_censusInterval)
+        {
+            m_censusCountdown = 0;
+            m_rTestApp.m_memCensus.sample();
+        }
+
+        // Last due update (if any) shares the iteration that syncs and renders
+        bool const updateDue = tickDue && (m_updateAccum >= smc_updatePeriod);
+        if (updateDue)
+        {
+            m_updateAccum -= smc_updatePeriod;
+        }
+        m_rDeltaTimeIn = updateDue ? smc_updatePeriod : 0.0f;
+
         m_rMainLoopCtrl = MainLoopControl{
-            .doUpdate = true,
+            .doUpdate = updateDue,
             .doSync   = true,
             .doResync = false,
             .doRender = true,
         };
 
+        clock_t::time_point const renderStart = clock_t::now();
+
         signal_all();
 
         m_rTestApp.m_pExecutor->wait(m_rTestApp);
+
+        float const renderMs
+                = std::chrono::duration<float, std::milli>(clock_t::now() - renderStart).count();
+
+        update_perf_hud(updateMs, renderMs);
     }
 
     void exit(MagnumApplication& rApp) override
@@ -541,6 +778,55 @@ public:
 
 private:
 
+    /**
+     * @brief Publish this frame's statistics to the mailbox, then draw the HUD bars
+     *
+     * Runs after the render iteration and before the buffer swap, on the GL thread. Costs
+     * one atomic load while the HUD is disabled; sampling is a handful of counter reads,
+     * never a lock, so measuring doesn't change what is measured.
+     */
+    void update_perf_hud(float const updateMs, float const renderMs)
+    {
+        if ( ! m_rTestApp.m_perfStats.hudEnabled.load(std::memory_order_relaxed))
+        {
+            m_hud.reset(); // Frees the HUD's GL objects; this is the GL thread
+            return;
+        }
+
+        osp::PerfSample sample{ .updateMs = updateMs, .renderMs = renderMs };
+
+        if (m_pScnRender != nullptr)
+        {
+            std::uint32_t drawn = 0;
+            for (osp::bitint_t const word : m_pScnRender->m_visible.ints())
+            {
+                drawn += std::uint32_t(std::popcount(word));
+            }
+            sample.drawnEnts = drawn;
+        }
+
+        if (m_pGroupFwd != nullptr)
+        {
+            sample.drawCalls = std::uint32_t(  m_pGroupFwd->entities.size()
+                                             + m_pGroupFwd->instanced.size() );
+        }
+
+        m_rTestApp.m_pExecutor->sample_queue_depths(sample.queuedTasks, sample.blockedTasks);
+
+        for (MemCensus::Tag const &tag : m_rTestApp.m_memCensus.tags)
+        {
+            sample.memBytes += tag.bytesLast;
+        }
+
+        m_rTestApp.m_perfStats.publish(sample);
+
+        if ( ! m_hud.has_value())
+        {
+            m_hud.emplace();
+        }
+        m_hud->draw(sample, Magnum::GL::defaultFramebuffer.viewport().size());
+    }
+
     void signal_all()
     {
         m_rTestApp.m_pExecutor->signal(m_rTestApp, m_signals.mainLoop);
@@ -551,15 +837,43 @@ private:
         m_rTestApp.m_pExecutor->signal(m_rTestApp, m_signals.sceneRender);
     }
 
+    /// Footprint sums cost microseconds; a couple of seconds between census samples is
+    /// plenty for high-water tracking
+    static constexpr int smc_censusInterval = 120;
+
+    int             m_censusCountdown {0};
+
+    /// Fixed simulation step; updates run at this rate regardless of display rate
+    static constexpr float smc_updatePeriod = 1.0f / 60.0f;
+
+    /// Most simulation time one frame may owe; beyond this, simulation slows down instead
+    /// of queueing unbounded catch-up updates
+    static constexpr float smc_maxCatchup   = 0.1f;
+
     TestApp         &m_rTestApp;
     MainLoopControl &m_rMainLoopCtrl;
+    float           &m_rDeltaTimeIn;
+
+    /// Written by scene/universe tasks; read here each frame to pick the tick period
+    SceneTickRate const &m_rTickRate;
+
+    float           m_updateAccum  {0.0f};
 
     MainLoopSignals m_signals;
+
+    draw::ACtxSceneRender const *m_pScnRender  {nullptr};
+    draw::RenderGroup const     *m_pGroupFwd   {nullptr};
+
+    /// Constructed on first use while enabled; holds GL objects, so only exists alongside
+    /// a live renderer
+    std::optional<PerfHud>      m_hud;
 };
 
-void setup_magnum_draw(TestApp& rTestApp, Session const& scene, Session const& sceneRenderer, Session const& magnumScene)
+void setup_magnum_draw(TestApp& rTestApp, Session const& scene, Session const& commonScene, Session const& sceneRenderer, Session const& magnumScene)
 {
     OSP_DECLARE_GET_DATA_IDS(rTestApp.m_application,    TESTAPP_DATA_APPLICATION);
+    OSP_DECLARE_GET_DATA_IDS(scene,                     TESTAPP_DATA_SCENE);
+    OSP_DECLARE_GET_DATA_IDS(commonScene,               TESTAPP_DATA_COMMON_SCENE);
     OSP_DECLARE_GET_DATA_IDS(sceneRenderer,             TESTAPP_DATA_SCENE_RENDERER);
     OSP_DECLARE_GET_DATA_IDS(rTestApp.m_magnum,         TESTAPP_DATA_MAGNUM);
     OSP_DECLARE_GET_DATA_IDS(magnumScene,               TESTAPP_DATA_MAGNUM_SCENE);
@@ -567,9 +881,48 @@ void setup_magnum_draw(TestApp& rTestApp, Session const& scene, Session const& s
     auto &rMainLoopCtrl = top_get<MainLoopControl>  (rTestApp.m_topData, idMainLoopCtrl);
     auto &rActiveApp    = top_get<MagnumApplication>(rTestApp.m_topData, idActiveApp);
     auto &rCamera       = top_get<draw::Camera>     (rTestApp.m_topData, idCamera);
+    auto &rDeltaTimeIn  = top_get<float>            (rTestApp.m_topData, idDeltaTimeIn);
 
     rCamera.set_aspect_ratio(Vector2{Magnum::GL::defaultFramebuffer.viewport().size()});
 
+    // Memory census tags every scenario shares. Footprints sum the major buffers only;
+    // add_tag replaces by name, so renderer restarts don't accumulate duplicates
+    {
+        auto &rDrawing   = top_get<ACtxDrawing>    (rTestApp.m_topData, idDrawing);
+        auto &rScnRender = top_get<ACtxSceneRender>(rTestApp.m_topData, idScnRender);
+
+        rTestApp.m_memCensus.add_tag("drawing",
+                [] (MemCensus::UserData_t const userData) noexcept -> std::size_t
+        {
+            auto const &rDrawing   = *reinterpret_cast<ACtxDrawing const*>    (userData[0]);
+            auto const &rScnRender = *reinterpret_cast<ACtxSceneRender const*>(userData[1]);
+
+            return rDrawing.m_meshIds.capacity() / 8
+                 + rDrawing.m_texIds.capacity() / 8
+                 + container_bytes(rScnRender.m_color)
+                 + container_bytes(rScnRender.m_activeToDraw)
+                 + container_bytes(rScnRender.hot)
+                 + container_bytes(rScnRender.m_diffuseTex)
+                 + container_bytes(rScnRender.m_drawEntGen);
+        }, {&rDrawing, &rScnRender, nullptr, nullptr});
+
+        rTestApp.m_memCensus.add_tag("taskdata",
+                [] (MemCensus::UserData_t const userData) noexcept -> std::size_t
+        {
+            auto const &rTaskData = *reinterpret_cast<TopTaskDataVec_t const*>(userData[0]);
+            auto const &rGraph    = *reinterpret_cast<TaskGraph const*>       (userData[1]);
+
+            return container_bytes(rTaskData)
+                 + container_bytes(rGraph.pipelineToFirstAnystg)
+                 + container_bytes(rGraph.anystgToFirstRuntask)
+                 + container_bytes(rGraph.runtaskToTask)
+                 + container_bytes(rGraph.stgreqtaskData)
+                 + container_bytes(rGraph.taskreqstgData)
+                 + container_bytes(rGraph.revStgreqtaskToStage)
+                 + container_bytes(rGraph.revTaskreqstgToTask);
+        }, {&rTestApp.m_taskData, &rTestApp.m_graph, nullptr, nullptr});
+    }
+
     MainLoopSignals const signals
     {
         .mainLoop     = rTestApp.m_application .get_pipelines<PlApplication>()   .mainLoop,
@@ -580,7 +933,13 @@ void setup_magnum_draw(TestApp& rTestApp, Session const& scene, Session const& s
         .sceneRender  = sceneRenderer          .get_pipelines<PlSceneRenderer>() .render,
     };
 
-    rActiveApp.set_osp_app( std::make_unique<CommonMagnumApp>(rTestApp, rMainLoopCtrl, signals) );
+    auto &rScnRenderHud = top_get<ACtxSceneRender>   (rTestApp.m_topData, idScnRender);
+    auto &rGroupFwd     = top_get<draw::RenderGroup> (rTestApp.m_topData, idGroupFwd);
+    auto &rTickRate     = top_get<SceneTickRate>     (rTestApp.m_topData, idTickRate);
+
+    rActiveApp.set_osp_app( std::make_unique<CommonMagnumApp>(
+            rTestApp, rMainLoopCtrl, rDeltaTimeIn, rTickRate, signals,
+            &rScnRenderHud, &rGroupFwd) );
 }
 
 } // namespace testapp
@@ -55,6 +55,25 @@ struct MainLoopControl
     bool doRender;
 };
 
+/**
+ * @brief Per-scene tick-rate request, letting a dormant scene run below full rate
+ *
+ * Scene or universe tasks flag the scene background when nothing demands full rate, eg: no
+ * satellite near the scene frame. The main loop driver then runs update iterations once per
+ * smc_backgroundPeriod instead of every frame; the fixed-step accumulator absorbs the
+ * difference by catching up in a burst of normal-length steps, so simulated time stays
+ * correct and physics never sees a varying timestep. Clearing the flag promotes the scene
+ * back to full rate on the next frame.
+ */
+struct SceneTickRate
+{
+    /// Background scenes tick once per this many seconds, trading update latency for far
+    /// fewer executor iterations
+    static constexpr float smc_backgroundPeriod = 10.0f / 60.0f;
+
+    bool background {false};
+};
+
 struct ScenarioOption
 {
     std::string_view m_description;
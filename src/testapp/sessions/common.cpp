@@ -28,10 +28,13 @@
 #include <adera/drawing/CameraController.h>
 #include <osp/activescene/basic_fn.h>
 #include <osp/core/Resources.h>
+#include <osp/core/frame_arena.h>
 #include <osp/core/unpack.h>
 #include <osp/drawing/drawing_fn.h>
 #include <osp/util/UserInputHandler.h>
 
+#include <algorithm>
+
 using namespace adera;
 using namespace osp;
 using namespace osp::active;
@@ -53,6 +56,12 @@ Session setup_scene(
 
     top_emplace< float >(topData, idDeltaTimeIn, 1.0f / 60.0f);
 
+    // Scratch space for per-frame temporaries, reset each scene update
+    top_emplace< FrameArena >(topData, idFrameArena, 1024 * 1024);
+
+    // Scenes start at full rate; tasks may flag it background to tick slower
+    top_emplace< SceneTickRate >(topData, idTickRate);
+
     auto const plScn = out.create_pipelines<PlScene>(rBuilder);
 
     rBuilder.pipeline(plScn.update).parent(tgApp.mainLoop).wait_for_signal(ModifyOrSignal);
@@ -61,10 +70,17 @@ Session setup_scene(
         .name       ("Schedule Scene update")
         .schedules  ({plScn.update(Schedule)})
         .push_to    (out.m_tasks)
-        .args       ({                  idMainLoopCtrl})
-        .func([] (MainLoopControl const& rMainLoopCtrl) noexcept -> osp::TaskActions
+        .args       ({                  idMainLoopCtrl,            idFrameArena})
+        .func([] (MainLoopControl const& rMainLoopCtrl, FrameArena& rFrameArena) noexcept -> osp::TaskActions
     {
-        return rMainLoopCtrl.doUpdate ? osp::TaskActions{} : osp::TaskAction::Cancel;
+        if ( ! rMainLoopCtrl.doUpdate )
+        {
+            return osp::TaskAction::Cancel;
+        }
+
+        // Runs before all child update pipelines, so nothing from last frame is still alive
+        rFrameArena.reset();
+        return osp::TaskActions{};
     });
 
     return out;
@@ -107,13 +123,25 @@ Session setup_common_scene(
 
 
     rBuilder.task()
-        .name       ("Cancel entity delete tasks stuff if no entities were deleted")
+        .name       ("Sort entity delete manifest, or cancel delete tasks if empty")
         .run_on     ({tgCS.activeEntDelete(Schedule_)})
         .push_to    (out.m_tasks)
-        .args       ({      idBasic,                      idActiveEntDel })
-        .func([] (ACtxBasic& rBasic, ActiveEntVec_t const& rActiveEntDel) noexcept
+        .args       ({      idBasic,                idActiveEntDel })
+        .func([] (ACtxBasic& rBasic, ActiveEntVec_t& rActiveEntDel) noexcept -> TaskActions
     {
-        return rActiveEntDel.empty() ? TaskAction::Cancel : TaskActions{};
+        if (rActiveEntDel.empty())
+        {
+            return TaskAction::Cancel;
+        }
+
+        // Producers append in any order and may repeat ids (eg. an entity both out-of-bounds
+        // and inside a deleted subtree). Sort and deduplicate once here; every subsystem's
+        // delete task then consumes one ascending id range instead of each doing its own
+        // cleanup pass over an unordered list.
+        std::sort(rActiveEntDel.begin(), rActiveEntDel.end());
+        rActiveEntDel.erase(std::unique(rActiveEntDel.begin(), rActiveEntDel.end()),
+                            rActiveEntDel.end());
+        return TaskActions{};
     });
 
     rBuilder.task()
@@ -350,30 +378,32 @@ Session setup_scene_renderer(
         .sync_with  ({tgCS.hierarchy(Ready), tgCS.transform(Ready), tgCS.activeEnt(Ready), tgScnRdr.drawTransforms(Modify_), tgScnRdr.drawEnt(Ready), tgScnRdr.drawEntResized(Done), tgCS.activeEntResized(Done)})
         .push_to    (out.m_tasks)
         .args       ({            idBasic,                   idDrawing,                 idScnRender,                 idDrawTfObservers })
-        .func([] (ACtxBasic const& rBasic, ACtxDrawing const& rDrawing, ACtxSceneRender& rScnRender, DrawTfObservers &rDrawTfObservers) noexcept
+        .func([] (ACtxBasic& rBasic, ACtxDrawing const& rDrawing, ACtxSceneRender& rScnRender, DrawTfObservers &rDrawTfObservers) noexcept
     {
-        auto rootChildren = SysSceneGraph::children(rBasic.m_scnGraph);
-        SysRender::update_draw_transforms(
+        SysSceneGraph::update_children_spans(rBasic.m_scnGraph);
+
+        auto const rootChildren = SysSceneGraph::children_span(rBasic.m_scnGraph);
+        SysRender::update_draw_transforms_parallel(
                 {
                     .scnGraph     = rBasic    .m_scnGraph,
                     .transforms   = rBasic    .m_transform,
                     .activeToDraw = rScnRender.m_activeToDraw,
                     .needDrawTf   = rScnRender.m_needDrawTf,
-                    .rDrawTf      = rScnRender.m_drawTransform
+                    .rHot         = rScnRender.hot
                 },
                 rootChildren.begin(),
                 rootChildren.end(),
                 [&rDrawTfObservers, &rScnRender] (Matrix4 const& transform, active::ActiveEnt ent, int depth)
         {
-            auto const enableInt  = std::array{rScnRender.drawTfObserverEnable[ent]};
-            auto const enableBits = lgrn::bit_view(enableInt);
-
-            for (std::size_t idx : enableBits.ones())
-            {
-                DrawTfObservers::Observer const &rObserver = rDrawTfObservers.observers[idx];
-                rObserver.func(rScnRender, transform, ent, depth, rObserver.data);
-            }
+            rDrawTfObservers.collect(rScnRender, transform, ent, depth);
         });
+
+        // Observers only see the subscribed entities queued above, i.e. the ones that
+        // actually moved; they run here on one thread, outside the parallel sweep
+        rDrawTfObservers.dispatch(rScnRender);
+
+        // Changes are consumed; subtrees left untouched until the next mark will be skipped
+        SysSceneGraph::clear_transform_dirty(rBasic.m_scnGraph);
     });
 
     rBuilder.task()
@@ -396,6 +426,10 @@ Session setup_scene_renderer(
                 rDrawEntDel.push_back(drawEnt);
             }
         }
+
+        // The ActiveEnt manifest is sorted, but the DrawEnts it maps to aren't; keep this
+        // manifest sorted too so its consumers also walk ascending ids
+        std::sort(rDrawEntDel.begin(), rDrawEntDel.end());
     });
 
     rBuilder.task()
@@ -36,12 +36,16 @@
 #include <adera/drawing_gl/visualizer_shader.h>
 #include <osp/activescene/basic_fn.h>
 #include <osp/drawing/drawing.h>
+#include <osp/drawing_gl/imposter.h>
+#include <osp/drawing_gl/occlusion.h>
 #include <osp/drawing_gl/rendergl.h>
 #include <osp/universe/coordinates.h>
 #include <osp/universe/universe.h>
 
 #include <adera/machines/links.h>
 
+#include <memory>
+
 
 // for the 0xrrggbb_rgbf and angle literals
 using namespace Magnum::Math::Literals;
@@ -90,6 +94,9 @@ Session setup_magnum(
 
     SysRenderGL::setup_context(rRenderGl);
 
+    // Stage resource data on a worker thread so new glTF assets don't hitch the render thread
+    rRenderGl.m_uploadQueue = std::make_unique<UploadQueueGL>();
+
     rBuilder.task()
         .name       ("Clean up Magnum renderer")
         .run_on     ({tgWin.cleanup(Run_)})
@@ -133,9 +140,12 @@ Session setup_magnum_scene(
 
     rBuilder.pipeline(tgMgnScn.fbo)             .parent(tgScnRdr.render);
     rBuilder.pipeline(tgMgnScn.camera)          .parent(tgScnRdr.render);
+    rBuilder.pipeline(tgMgnScn.drawUniforms)    .parent(tgScnRdr.render);
 
     top_emplace< ACtxSceneRenderGL >    (topData, idScnRenderGl);
     top_emplace< RenderGroup >          (topData, idGroupFwd);
+    top_emplace< ACtxHiZOcclusion >     (topData, idHiZOcclusion);
+    top_emplace< ACtxImposters >        (topData, idImposters);
 
     auto &rCamera = top_emplace< Camera >(topData, idCamera);
 
@@ -161,10 +171,10 @@ Session setup_magnum_scene(
         .run_on     ({tgScnRdr.meshResDirty(UseOrRun)})
         .sync_with  ({tgScnRdr.mesh(Ready), tgMgn.meshGL(New), tgScnRdr.entMeshDirty(UseOrRun)})
         .push_to    (out.m_tasks)
-        .args       ({                 idDrawingRes,                idResources,          idRenderGl })
-        .func([] (ACtxDrawingRes const& rDrawingRes, osp::Resources& rResources, RenderGL& rRenderGl) noexcept
+        .args       ({                 idDrawingRes,                idResources,                   idScnRenderGl,          idRenderGl })
+        .func([] (ACtxDrawingRes const& rDrawingRes, osp::Resources& rResources, ACtxSceneRenderGL& rScnRenderGl, RenderGL& rRenderGl) noexcept
     {
-        SysRenderGL::compile_resource_meshes(rDrawingRes, rResources, rRenderGl);
+        SysRenderGL::compile_resource_meshes(rDrawingRes, rResources, rScnRenderGl, rRenderGl);
     });
 
     rBuilder.task()
@@ -172,10 +182,41 @@ Session setup_magnum_scene(
         .run_on     ({tgScnRdr.textureResDirty(UseOrRun)})
         .sync_with  ({tgScnRdr.texture(Ready), tgMgn.textureGL(New)})
         .push_to    (out.m_tasks)
-        .args       ({                 idDrawingRes,                idResources,          idRenderGl })
-        .func([] (ACtxDrawingRes const& rDrawingRes, osp::Resources& rResources, RenderGL& rRenderGl) noexcept
+        .args       ({                 idDrawingRes,                idResources,                   idScnRenderGl,          idRenderGl })
+        .func([] (ACtxDrawingRes const& rDrawingRes, osp::Resources& rResources, ACtxSceneRenderGL& rScnRenderGl, RenderGL& rRenderGl) noexcept
+    {
+        SysRenderGL::compile_resource_textures(rDrawingRes, rResources, rScnRenderGl, rRenderGl);
+    });
+
+    rBuilder.task()
+        .name       ("Finish staged GL resource uploads")
+        .run_on     ({tgScnRdr.render(Run)})
+        .sync_with  ({tgMgn.meshGL(New), tgMgn.textureGL(New)})
+        .push_to    (out.m_tasks)
+        .args       ({          idRenderGl })
+        .func([] (RenderGL& rRenderGl) noexcept
+    {
+        if (rRenderGl.m_uploadQueue != nullptr)
+        {
+            rRenderGl.m_uploadQueue->finish_uploads(rRenderGl.m_meshGl, rRenderGl.m_texGl);
+        }
+    });
+
+    rBuilder.task()
+        .name       ("Track GL resource use and evict over budget")
+        .run_on     ({tgScnRdr.render(Run)})
+        .sync_with  ({tgMgn.meshGL(Ready), tgMgn.textureGL(Ready), tgMgn.entMeshGL(Ready), tgMgn.entTextureGL(Ready)})
+        .push_to    (out.m_tasks)
+        .args       ({            idScnRender,                         idScnRenderGl,                idResources,          idRenderGl })
+        .func([] (ACtxSceneRender& rScnRender, ACtxSceneRenderGL const& rScnRenderGl, osp::Resources& rResources, RenderGL& rRenderGl) noexcept
     {
-        SysRenderGL::compile_resource_textures(rDrawingRes, rResources, rRenderGl);
+        for (auto const drawEntInt : rScnRender.m_visible.ones())
+        {
+            auto const drawEnt = DrawEnt(drawEntInt);
+            SysRenderGL::touch_mesh   (rRenderGl, rScnRenderGl.m_meshId[drawEnt].m_glId);
+            SysRenderGL::touch_texture(rRenderGl, rScnRenderGl.m_diffuseTexId[drawEnt].m_glId);
+        }
+        SysRenderGL::update_residency(rRenderGl, rResources);
     });
 
     rBuilder.task()
@@ -225,7 +266,7 @@ Session setup_magnum_scene(
         SysRenderGL::sync_drawent_mesh(
                 rScnRender.m_meshDirty.begin(),
                 rScnRender.m_meshDirty.end(),
-                rScnRender.m_mesh,
+                rScnRender.hot,
                 rDrawingRes.m_meshToRes,
                 rScnRenderGl.m_meshId,
                 rRenderGl);
@@ -243,7 +284,7 @@ Session setup_magnum_scene(
         {
             SysRenderGL::sync_drawent_mesh(
                     DrawEnt(drawEntInt),
-                    rScnRender.m_mesh,
+                    rScnRender.hot,
                     rDrawingRes.m_meshToRes,
                     rScnRenderGl.m_meshId,
                     rRenderGl);
@@ -274,17 +315,65 @@ Session setup_magnum_scene(
     rBuilder.task()
         .name       ("Render Entities")
         .run_on     ({tgScnRdr.render(Run)})
-        .sync_with  ({tgScnRdr.group(Ready), tgScnRdr.groupEnts(Ready), tgMgnScn.camera(Ready), tgScnRdr.drawTransforms(UseOrRun), tgScnRdr.entMesh(Ready), tgScnRdr.entTexture(Ready),
+        .sync_with  ({tgScnRdr.group(Ready), tgScnRdr.groupEnts(Ready), tgMgnScn.camera(Ready), tgMgnScn.drawUniforms(Ready), tgScnRdr.drawTransforms(UseOrRun), tgScnRdr.entMesh(Ready), tgScnRdr.entTexture(Ready),
                       tgMgn.entMeshGL(Ready), tgMgn.entTextureGL(Ready),
                       tgScnRdr.drawEnt(Ready)})
         .push_to    (out.m_tasks)
-        .args       ({            idScnRender,          idRenderGl,                   idGroupFwd,              idCamera })
-        .func([] (ACtxSceneRender& rScnRender, RenderGL& rRenderGl, RenderGroup const& rGroupFwd, Camera const& rCamera, WorkerContext ctx) noexcept
+        .args       ({            idScnRender,                   idScnRenderGl,          idRenderGl,                   idGroupFwd,              idCamera,                idHiZOcclusion,                idImposters })
+        .func([] (ACtxSceneRender& rScnRender, ACtxSceneRenderGL& rScnRenderGl, RenderGL& rRenderGl, RenderGroup& rGroupFwd, Camera const& rCamera, ACtxHiZOcclusion& rOcclusion, ACtxImposters& rImposters, WorkerContext ctx) noexcept
     {
         ViewProjMatrix viewProj{rCamera.m_transform.inverted(), rCamera.perspective()};
 
+        // Distant entities swap to the simplified meshes cooked at import
+        SysRenderGL::select_mesh_lods(rScnRender, viewProj, rScnRenderGl.m_meshId);
+
+        DrawEntSet_t const *pVisible = &rScnRender.m_visible;
+        if (rOcclusion.enabled)
+        {
+            // Drop entities whose bounds sit behind last frame's reduced depth grid;
+            // rooms behind station walls skip the pass entirely
+            SysHiZOcclusion::apply_cull(rOcclusion, rScnRender, rOcclusion.viewVisible);
+            pVisible = &rOcclusion.viewVisible;
+        }
+
+        if (rImposters.enabled)
+        {
+            // Beyond-LOD entities hand their visible bit to an atlas tile and re-render
+            // a few stale tiles before the main pass
+            SysImposters::select(rImposters, rScnRender, viewProj, *pVisible);
+            SysImposters::capture(rImposters, rRenderGl, rGroupFwd, rScnRender, viewProj);
+            pVisible = &rImposters.viewVisible;
+        }
+
         // Forward Render fwd_opaque group to FBO
-        SysRenderGL::render_opaque(rGroupFwd, rScnRender.m_visible, viewProj);
+        SysRenderGL::render_opaque(rRenderGl, rGroupFwd, *pVisible,
+                                   rScnRender.hot, viewProj);
+
+        if (rImposters.enabled)
+        {
+            // One instanced call for every distant craft, depth-written so the quads
+            // still count as occluders below
+            SysImposters::draw_imposters(rImposters, rScnRender, viewProj);
+        }
+
+        if (rOcclusion.enabled)
+        {
+            // The opaque pass just drawn doubles as the occluder depth source; start the
+            // asynchronous readback that apply_cull consumes a couple frames from now
+            SysHiZOcclusion::update_depth(rRenderGl, rOcclusion, viewProj);
+        }
+    });
+
+    rBuilder.task()
+        .name       ("Release scene references to shared GL meshes and textures")
+        .run_on     ({tgWin.cleanup(Run_)})
+        .push_to    (out.m_tasks)
+        .args       ({               idScnRenderGl,          idResources,          idRenderGl })
+        .func([] (ACtxSceneRenderGL& rScnRenderGl, Resources& rResources, RenderGL& rRenderGl) noexcept
+    {
+        // GL objects other scenes still reference stay compiled; only this scene's
+        // last-reference objects are destroyed
+        SysRenderGL::release_scene_resources(rScnRenderGl, rResources, rRenderGl);
     });
 
     rBuilder.task()
@@ -366,10 +455,10 @@ Session setup_shader_visualizer(
         .func([] (ACtxSceneRender& rScnRender, RenderGroup& rGroupFwd, ACtxDrawMeshVisualizer& rDrawShVisual) noexcept
     {
         Material const &rMat = rScnRender.m_materials[rDrawShVisual.m_materialId];
-        for (auto const drawEntInt : rMat.m_ents.ones())
+        bitvector_for_each_set(rMat.m_ents, [&] (std::size_t const drawEntInt)
         {
             sync_drawent_visualizer(DrawEnt(drawEntInt), rMat.m_ents, rGroupFwd.entities, rDrawShVisual);
-        }
+        });
     });
 
     return out;
@@ -424,8 +513,8 @@ Session setup_shader_flat(
         sync_drawent_flat(rMat.m_dirty.begin(), rMat.m_dirty.end(),
         {
             .hasMaterial    = rMat.m_ents,
-            .pStorageOpaque = &rGroupFwd.entities,
-            /* TODO: set .pStorageTransparent */
+            .pGroupOpaque   = &rGroupFwd,
+            /* TODO: set .pGroupTransparent */
             .opaque         = rScnRender.m_opaque,
             .transparent    = rScnRender.m_transparent,
             .diffuse        = rScnRenderGl.m_diffuseTexId,
@@ -442,19 +531,19 @@ Session setup_shader_flat(
         .func([] (ACtxSceneRender& rScnRender, RenderGroup& rGroupFwd, ACtxSceneRenderGL const& rScnRenderGl, ACtxDrawFlat& rDrawShFlat) noexcept
     {
         Material const &rMat = rScnRender.m_materials[rDrawShFlat.materialId];
-        for (auto const drawEntInt : rMat.m_ents.ones())
+        bitvector_for_each_set(rMat.m_ents, [&] (std::size_t const drawEntInt)
         {
             sync_drawent_flat(DrawEnt(drawEntInt),
             {
                 .hasMaterial    = rMat.m_ents,
-                .pStorageOpaque = &rGroupFwd.entities,
-                /* TODO: set .pStorageTransparent */
+                .pGroupOpaque   = &rGroupFwd,
+                /* TODO: set .pGroupTransparent */
                 .opaque         = rScnRender.m_opaque,
                 .transparent    = rScnRender.m_transparent,
                 .diffuse        = rScnRenderGl.m_diffuseTexId,
                 .rData          = rDrawShFlat
             });
-        }
+        });
     });
 
     return out;
@@ -478,6 +567,7 @@ Session setup_shader_phong(
     auto const tgWin    = windowApp     .get_pipelines< PlWindowApp >();
     auto const tgScnRdr = sceneRenderer .get_pipelines< PlSceneRenderer >();
     auto const tgMgn    = magnum        .get_pipelines< PlMagnum >();
+    auto const tgMgnScn = magnumScene   .get_pipelines< PlMagnumScene >();
 
     auto &rScnRender    = top_get< ACtxSceneRender >    (topData, idScnRender);
     auto &rScnRenderGl  = top_get< ACtxSceneRenderGL >  (topData, idScnRenderGl);
@@ -488,8 +578,12 @@ Session setup_shader_phong(
     auto &rDrawPhong = top_emplace< ACtxDrawPhong >(topData, idDrawShPhong);
 
     auto const texturedFlags    = PhongGL::Flag::DiffuseTexture | PhongGL::Flag::AlphaMask | PhongGL::Flag::AmbientTexture;
+    auto const arenaFlags       = PhongGL::Flag::InstancedTransformation | PhongGL::Flag::VertexColor;
     rDrawPhong.shaderDiffuse    = PhongGL{PhongGL::Configuration{}.setFlags(texturedFlags).setLightCount(2)};
     rDrawPhong.shaderUntextured = PhongGL{PhongGL::Configuration{}.setLightCount(2)};
+    rDrawPhong.shaderDiffuseInstanced    = PhongGL{PhongGL::Configuration{}.setFlags(texturedFlags | arenaFlags).setLightCount(2)};
+    rDrawPhong.shaderUntexturedInstanced = PhongGL{PhongGL::Configuration{}.setFlags(arenaFlags).setLightCount(2)};
+    rDrawPhong.useDrawTfArena   = true; // Filled by "Stage Phong draw uniforms" below
     rDrawPhong.materialId       = materialId;
     rDrawPhong.assign_pointers(rScnRender, rScnRenderGl, rRenderGl);
 
@@ -498,6 +592,20 @@ Session setup_shader_phong(
         return out;
     }
 
+    rBuilder.task()
+        .name       ("Stage Phong draw uniforms")
+        .run_on     ({tgScnRdr.render(Run)})
+        .sync_with  ({tgMgnScn.camera(Ready), tgMgnScn.drawUniforms(Modify), tgScnRdr.drawTransforms(UseOrRun), tgScnRdr.groupEnts(Ready), tgScnRdr.drawEnt(Ready)})
+        .push_to    (out.m_tasks)
+        .args       ({            idScnRender,                   idGroupFwd,              idCamera,               idDrawShPhong})
+        .func([] (ACtxSceneRender& rScnRender, RenderGroup const& rGroupFwd, Camera const& rCamera, ACtxDrawPhong& rDrawShPhong) noexcept
+    {
+        Material const &rMat = rScnRender.m_materials[rDrawShPhong.materialId];
+        ViewProjMatrix const viewProj{rCamera.m_transform.inverted(), rCamera.perspective()};
+
+        stage_drawent_phong(rScnRender.m_visible, rMat.m_ents, rGroupFwd, viewProj, rDrawShPhong);
+    });
+
     rBuilder.task()
         .name       ("Sync Phong shader DrawEnts")
         .run_on     ({tgWin.sync(Run)})
@@ -510,8 +618,8 @@ Session setup_shader_phong(
         sync_drawent_phong(rMat.m_dirty.begin(), rMat.m_dirty.end(),
         {
             .hasMaterial    = rMat.m_ents,
-            .pStorageOpaque = &rGroupFwd.entities,
-            /* TODO: set .pStorageTransparent */
+            .pGroupOpaque   = &rGroupFwd,
+            /* TODO: set .pGroupTransparent */
             .opaque         = rScnRender.m_opaque,
             .transparent    = rScnRender.m_transparent,
             .diffuse        = rScnRenderGl.m_diffuseTexId,
@@ -528,18 +636,18 @@ Session setup_shader_phong(
         .func([] (ACtxSceneRender& rScnRender, RenderGroup& rGroupFwd, ACtxSceneRenderGL const& rScnRenderGl, ACtxDrawPhong& rDrawShPhong) noexcept
     {
         Material const &rMat = rScnRender.m_materials[rDrawShPhong.materialId];
-        for (auto const drawEntInt : rMat.m_ents.ones())
+        bitvector_for_each_set(rMat.m_ents, [&] (std::size_t const drawEntInt)
         {
             sync_drawent_phong(DrawEnt(drawEntInt),
             {
                 .hasMaterial    = rMat.m_ents,
-                .pStorageOpaque = &rGroupFwd.entities,
+                .pGroupOpaque   = &rGroupFwd,
                 .opaque         = rScnRender.m_opaque,
                 .transparent    = rScnRender.m_transparent,
                 .diffuse        = rScnRenderGl.m_diffuseTexId,
                 .rData          = rDrawShPhong
             });
-        }
+        });
     });
 
     return out;
@@ -165,7 +165,7 @@ Session setup_cursor(
     auto const cursorEnt = top_emplace<DrawEnt>(topData, idCursorEnt, rScnRender.m_drawIds.create());
     rScnRender.resize_draw();
 
-    rScnRender.m_mesh[cursorEnt] = SysRender::add_drawable_mesh(rDrawing, rDrawingRes, rResources, pkg, "cubewire");
+    rScnRender.hot[cursorEnt].mesh = SysRender::add_drawable_mesh(rDrawing, rDrawingRes, rResources, pkg, "cubewire");
     rScnRender.m_color[cursorEnt] = { 0.0f, 1.0f, 0.0f, 1.0f };
     rScnRender.m_visible.set(std::size_t(cursorEnt));
     rScnRender.m_opaque.set(std::size_t(cursorEnt));
@@ -181,7 +181,7 @@ Session setup_cursor(
         .args       ({        idCursorEnt,                            idCamCtrl,                 idScnRender })
         .func([] (DrawEnt const cursorEnt, ACtxCameraController const& rCamCtrl, ACtxSceneRender& rScnRender) noexcept
     {
-        rScnRender.m_drawTransform[cursorEnt] = Matrix4::translation(rCamCtrl.m_target.value());
+        rScnRender.hot[cursorEnt].drawTf = Matrix4::translation(rCamCtrl.m_target.value());
     });
 
     return out;
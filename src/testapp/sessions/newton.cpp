@@ -25,12 +25,16 @@
 #include "newton.h"
 #include "physics.h"
 #include "shapes.h"
+#include "terrain.h"
 
 #include <osp/activescene/basic_fn.h>
 #include <osp/activescene/physics_fn.h>
 #include <osp/activescene/prefab_fn.h>
 #include <osp/activescene/vehicles.h>
 #include <osp/core/Resources.h>
+#include <osp/core/array_view.h>
+#include <osp/core/math_2pow.h>
+#include <osp/core/math_int64.h>
 #include <osp/drawing/drawing.h>
 #include <osp/vehicles/ImporterData.h>
 
@@ -38,6 +42,8 @@
 
 #include <ospnewton/activescene/newtoninteg_fn.h>
 
+#include <Corrade/Containers/ArrayViewStl.h>
+
 using namespace osp;
 using namespace osp::active;
 using namespace osp::link;
@@ -71,7 +77,7 @@ Session setup_newton(
 
     rBuilder.pipeline(tgNwt.nwtBody).parent(tgScn.update);
 
-    top_emplace< ACtxNwtWorld >(topData, idNwt, 2);
+    top_emplace< ACtxNwtWorld >(topData, idNwt, 0);
 
     using ospnewton::SysNewton;
 
@@ -97,7 +103,7 @@ Session setup_newton(
         SysNewton::update_world(rPhys, rNwt, deltaTimeIn, rBasic.m_scnGraph, rBasic.m_transform);
     });
 
-    top_emplace< ACtxNwtWorld >(topData, idNwt, 2);
+    top_emplace< ACtxNwtWorld >(topData, idNwt, 0);
 
     return out;
 } // setup_newton
@@ -142,14 +148,26 @@ osp::Session setup_newton_force_accel(
 
     ACtxNwtWorld::ForceFactorFunc const factor
     {
-        .m_func = [] (NewtonBody const* pBody, BodyId const bodyID, ACtxNwtWorld const& rNwt, UserData_t data, Vector3& rForce, Vector3& rTorque) noexcept
+        .m_func = [] (ACtxNwtWorld& rNwt, std::size_t const factorIdx, UserData_t data) noexcept
         {
-            float mass = 0.0f;
-            float dummy = 0.0f;
-            NewtonBodyGetMass(pBody, &mass, &dummy, &dummy, &dummy);
+            auto const& accel = *reinterpret_cast<Vector3 const*>(data[0]);
+
+            for (BodyId bodyId = 0; bodyId < rNwt.m_bodyPtrs.size(); ++bodyId)
+            {
+                NewtonBody const *pBody = rNwt.m_bodyPtrs[bodyId].get();
 
-            auto const& force = *reinterpret_cast<Vector3 const*>(data[0]);
-            rForce += force * mass;
+                if (   (pBody == nullptr)
+                    || ( ! lgrn::bit_view(rNwt.m_bodyFactors[bodyId]).test(factorIdx)) )
+                {
+                    continue;
+                }
+
+                float mass = 0.0f;
+                float dummy = 0.0f;
+                NewtonBodyGetMass(pBody, &mass, &dummy, &dummy, &dummy);
+
+                rNwt.m_bodyForce[bodyId] += accel * mass;
+            }
         },
         .m_userData = {&rAccel}
     };
@@ -234,6 +252,216 @@ Session setup_phys_shapes_newton(
 
 
 
+/**
+ * @brief State for terrain chunk colliders, intended as idTerrainNwt
+ */
+struct ACtxTerrainNwt
+{
+    struct PerChunk
+    {
+        /// Tree collision currently attached for this chunk, null if none
+        NwtColliderPtr_t    tree;
+        /// Node handle within the terrain body's scene collision
+        void                *pSubCollision  {nullptr};
+        /// Skeleton triangle the tree was built from; a mismatch means the
+        /// ChunkId was recycled and the collider is stale
+        planeta::SkTriId    sktri;
+    };
+
+    osp::KeyedVec<planeta::ChunkId, PerChunk>   perChunk;
+
+    /// Static zero-mass body at scene origin holding one scene collision;
+    /// per-chunk tree collisions are its sub-collisions. Owned by
+    /// ACtxNwtWorld::m_bodyPtrs like any other body.
+    BodyId          bodyId          {lgrn::id_null<BodyId>()};
+    NewtonCollision *pSceneCollision{nullptr};
+
+    /// Chunks with skeleton triangle centers within this range of the terrain
+    /// frame get colliders, in meters
+    float           physRadius      {50.0f};
+
+    /// Max tree collisions built per update; the rest stay queued and are
+    /// picked up by following updates, so a subdivision burst near the viewer
+    /// never stalls the frame
+    int             buildBudget     {4};
+};
+
+Session setup_terrain_collider_newton(
+        TopTaskBuilder&             rBuilder,
+        ArrayView<entt::any> const  topData,
+        Session const&              scene,
+        Session const&              terrain,
+        Session const&              newton)
+{
+    OSP_DECLARE_GET_DATA_IDS(terrain,   TESTAPP_DATA_TERRAIN);
+    OSP_DECLARE_GET_DATA_IDS(newton,    TESTAPP_DATA_NEWTON);
+
+    auto const tgScn = scene    .get_pipelines<PlScene>();
+    auto const tgTrn = terrain  .get_pipelines<PlTerrain>();
+    auto const tgNwt = newton   .get_pipelines<PlNewton>();
+
+    Session out;
+    OSP_DECLARE_CREATE_DATA_IDS(out, topData, TESTAPP_DATA_TERRAIN_NWT);
+
+    top_emplace< ACtxTerrainNwt >(topData, idTerrainNwt);
+
+    rBuilder.task()
+        .name       ("Update terrain chunk colliders")
+        .run_on     ({tgScn.update(Run)})
+        .sync_with  ({tgTrn.terrainFrame(Ready), tgTrn.skeleton(Ready), tgTrn.surfaceChanges(UseOrRun), tgNwt.nwtBody(New)})
+        .push_to    (out.m_tasks)
+        .args({                    idTerrainFrame,             idTerrain,                idTerrainNwt,              idNwt })
+        .func([] (ACtxTerrainFrame &rTerrainFrame, ACtxTerrain &rTerrain, ACtxTerrainNwt &rTerrainNwt, ACtxNwtWorld &rNwt) noexcept
+    {
+        using planeta::ChunkId;
+        using planeta::SkTriId;
+
+        if ( ! rTerrainFrame.active )
+        {
+            return;
+        }
+
+        planeta::ChunkSkeleton        const &rSkCh   = rTerrain.skChunks;
+        planeta::ChunkMeshBufferInfo  const &rChInfo = rTerrain.chunkInfo;
+        planeta::BasicChunkMeshGeometry const &rChGeo = rTerrain.chunkGeom;
+
+        // Create the static terrain body on first run. The body keeps its own reference to the
+        // scene collision; sub-collision edits below go through that instance.
+        if (rTerrainNwt.bodyId == lgrn::id_null<BodyId>())
+        {
+            NwtColliderPtr_t const pSceneColNew{ NewtonCreateSceneCollision(rNwt.m_world.get(), 0) };
+            NewtonBody *pBody = NewtonCreateDynamicBody(
+                    rNwt.m_world.get(), pSceneColNew.get(), Matrix4{}.data());
+
+            BodyId const bodyId = rNwt.m_bodyIds.create();
+            SysNewton::resize_body_data(rNwt);
+
+            rNwt.m_bodyPtrs[bodyId].reset(pBody);
+            rNwt.m_bodyToEnt[bodyId] = lgrn::id_null<ActiveEnt>();
+            SysNewton::set_userdata_bodyid(pBody, bodyId);
+
+            rTerrainNwt.bodyId          = bodyId;
+            rTerrainNwt.pSceneCollision = NewtonBodyGetCollision(pBody);
+        }
+
+        rTerrainNwt.perChunk.resize(rSkCh.m_chunkIds.capacity());
+
+        NewtonCollision *pSceneCol = rTerrainNwt.pSceneCollision;
+
+        // Distance tests run in skeleton units. 2^precision units = 1 meter
+        auto const physRadiusUnits = std::uint64_t(
+                rTerrainNwt.physRadius * float(math::int_2pow<std::int64_t>(rTerrain.skData.precision)));
+
+        // All removes and adds this update share one bracket, so a subdividing chunk's
+        // collider is swapped for its children's without the ground ever having a hole
+        bool bracketOpen = false;
+        auto const open_bracket = [&bracketOpen, pSceneCol] ()
+        {
+            if ( ! bracketOpen )
+            {
+                NewtonSceneCollisionBeginAddRemove(pSceneCol);
+                bracketOpen = true;
+            }
+        };
+
+        // Detach colliders of chunks that were deleted, left the physics radius, or whose
+        // ChunkId was recycled for a different skeleton triangle
+        for (std::size_t chunkInt = 0; chunkInt < rTerrainNwt.perChunk.size(); ++chunkInt)
+        {
+            auto const chunkId    = ChunkId::from_index(chunkInt);
+            auto       &rPerChunk = rTerrainNwt.perChunk[chunkId];
+
+            if (rPerChunk.tree.get() == nullptr)
+            {
+                continue;
+            }
+
+            bool keep = rSkCh.m_chunkIds.exists(chunkId);
+            if (keep)
+            {
+                SkTriId const sktri = rSkCh.m_chunkToTri[chunkId];
+                keep = (rPerChunk.sktri == sktri)
+                    && osp::is_distance_near(rTerrainFrame.position,
+                                             rTerrain.skData.centers[sktri], physRadiusUnits);
+            }
+
+            if ( ! keep )
+            {
+                open_bracket();
+                NewtonSceneCollisionRemoveSubCollision(pSceneCol, rPerChunk.pSubCollision);
+                rPerChunk.pSubCollision = nullptr;
+                rPerChunk.tree.reset();
+            }
+        }
+
+        // Build tree collisions for chunks in range that have none, budgeted per update
+        int budget = rTerrainNwt.buildBudget;
+
+        for (std::size_t const chunkInt : rSkCh.m_chunkIds.bitview().zeros())
+        {
+            if (budget == 0)
+            {
+                break; // Remaining chunks are picked up by following updates
+            }
+
+            auto    const chunkId    = ChunkId::from_index(chunkInt);
+            auto          &rPerChunk = rTerrainNwt.perChunk[chunkId];
+            SkTriId const sktri      = rSkCh.m_chunkToTri[chunkId];
+
+            if (rPerChunk.tree.get() != nullptr)
+            {
+                continue; // Stale colliders were already detached above
+            }
+
+            if ( ! osp::is_distance_near(rTerrainFrame.position,
+                                         rTerrain.skData.centers[sktri], physRadiusUnits) )
+            {
+                continue;
+            }
+
+            NwtColliderPtr_t pTree{ NewtonCreateTreeCollision(rNwt.m_world.get(), 0) };
+            NewtonTreeCollisionBeginBuild(pTree.get());
+
+            auto const ibufSlice = osp::as_2d(arrayView(rChGeo.chunkIbuf),
+                                              rChInfo.chunkMaxFaceCount).row(chunkId.value);
+            for (Vector3u const face : ibufSlice)
+            {
+                // Unused fan capacity is zero-filled; degenerate faces have no area
+                if (face.x() == face.y() || face.y() == face.z() || face.x() == face.z())
+                {
+                    continue;
+                }
+
+                std::array<Vector3, 3> const verts{ rChGeo.chunkVbufPos[face.x()],
+                                                    rChGeo.chunkVbufPos[face.y()],
+                                                    rChGeo.chunkVbufPos[face.z()] };
+                NewtonTreeCollisionAddFace(pTree.get(), 3, verts.front().data(), sizeof(Vector3), 0);
+            }
+
+            // Skip Newton's tree optimization pass; chunks are short-lived as the viewer
+            // moves through LOD levels, and the per-chunk face count is already small
+            NewtonTreeCollisionEndBuild(pTree.get(), 0);
+
+            open_bracket();
+            rPerChunk.pSubCollision = NewtonSceneCollisionAddSubCollision(pSceneCol, pTree.get());
+            rPerChunk.tree          = std::move(pTree);
+            rPerChunk.sktri         = sktri;
+
+            --budget;
+        }
+
+        if (bracketOpen)
+        {
+            NewtonSceneCollisionEndAddRemove(pSceneCol);
+        }
+    });
+
+    return out;
+} // setup_terrain_collider_newton
+
+
+
+
 
 void compound_collect_recurse(
         ACtxPhysics const&  rCtxPhys,
@@ -257,7 +485,11 @@ void compound_collect_recurse(
         }
 
         SysNewton::orient_collision(rPtr.get(), shape, transform.translation(), transform.rotation(), transform.scaling());
-        NewtonCompoundCollisionAddSubCollision(pCompound, rPtr.get());
+
+        // Keep the node handle so this part can later be detached or re-attached on its own
+        // (SysNewton::compound_remove_collider / compound_add_collider) without a rebuild
+        void *pNode = NewtonCompoundCollisionAddSubCollision(pCompound, rPtr.get());
+        rCtxWorld.m_entToSubCollision.insert_or_assign(ent, pNode);
     }
 
     if ( ! rCtxPhys.m_hasColliders.test(std::size_t(ent)) )
@@ -266,7 +498,7 @@ void compound_collect_recurse(
     }
 
     // Recurse into children if there are more colliders
-    for (ActiveEnt child : SysSceneGraph::children(rBasic.m_scnGraph, ent))
+    for (ActiveEnt child : SysSceneGraph::children_span(rBasic.m_scnGraph, ent))
     {
         if (rBasic.m_transform.contains(child))
         {
@@ -404,6 +636,9 @@ Session setup_vehicle_spawn_newton(
 
         rPhys.m_hasColliders.ints().resize(rBasic.m_activeIds.vec().capacity());
 
+        // Newly added vehicle entities made the children lookup stale
+        SysSceneGraph::update_children_spans(rBasic.m_scnGraph);
+
         auto const& itWeldsFirst        = std::begin(rVehicleSpawn.spawnedWelds);
         auto const& itWeldOffsetsLast   = std::end(rVehicleSpawn.spawnedWeldOffsets);
         auto itWeldOffsets              = std::begin(rVehicleSpawn.spawnedWeldOffsets);
@@ -442,20 +677,15 @@ Session setup_vehicle_spawn_newton(
                 rNwt.m_bodyFactors[bodyId] = {1}; // TODO: temporary
                 rNwt.m_entToBody.emplace(weldEnt, bodyId);
 
-                float   totalMass = 0.0f;
-                Vector3 massPos{0.0f};
-                SysPhysics::calculate_subtree_mass_center(rBasic.m_transform, rPhys, rBasic.m_scnGraph, weldEnt, massPos, totalMass);
-
-                Vector3 const com = massPos / totalMass;
-                auto const comToOrigin = Matrix4::translation( - com );
+                // Cached rollup; only branches invalidated since the last
+                // spawn are re-traversed
+                ACompSubtreeMass const& weldMass = SysPhysics::update_subtree_mass(
+                        rBasic.m_transform, rPhys, rBasic.m_scnGraph, weldEnt);
 
-                Matrix3 inertiaTensor{0.0f};
-                SysPhysics::calculate_subtree_mass_inertia(rBasic.m_transform, rPhys, rBasic.m_scnGraph, weldEnt, inertiaTensor, comToOrigin);
-
-                Matrix4 const inertiaTensorMat4{inertiaTensor};
+                Matrix4 const inertiaTensorMat4{weldMass.m_inertia};
                 //NewtonBodySetMassMatrix(pBody, 0.0f, 1.0f, 1.0f, 1.0f);
-                NewtonBodySetFullMassMatrix         (pBody, totalMass, inertiaTensorMat4.data());
-                NewtonBodySetCentreOfMass           (pBody, com.data());
+                NewtonBodySetFullMassMatrix         (pBody, weldMass.m_mass, inertiaTensorMat4.data());
+                NewtonBodySetCentreOfMass           (pBody, weldMass.m_com.data());
                 NewtonBodySetGyroscopicTorque       (pBody, 1);
                 NewtonBodySetMatrix                 (pBody, transform.data());
                 NewtonBodySetLinearDamping          (pBody, 0.0f);
@@ -471,6 +701,50 @@ Session setup_vehicle_spawn_newton(
         }
     });
 
+    rBuilder.task()
+        .name       ("Refresh mass rollups of dirty Welds")
+        .run_on     ({tgVhSp.spawnRequest(UseOrRun)})
+        .sync_with  ({tgParts.weldDirty(UseOrRun), tgCS.transform(Ready), tgCS.hierarchy(Ready), tgPhy.physBody(Ready), tgNwt.nwtBody(Ready), tgPhy.physUpdate(Done)})
+        .push_to    (out.m_tasks)
+        .args       ({      idBasic,             idPhys,              idNwt,            idScnParts})
+        .func([] (ACtxBasic& rBasic, ACtxPhysics& rPhys, ACtxNwtWorld& rNwt, ACtxParts const& rScnParts) noexcept
+    {
+        // One array pass recomputing rollups of every dirty weld, so each
+        // consumer afterwards reads ACtxPhysics::m_subtreeMass as a cache hit
+        // instead of walking the weld's hierarchy itself
+        std::vector<ActiveEnt> weldEnts;
+        weldEnts.reserve(rScnParts.weldDirty.size());
+        for (WeldId const weld : rScnParts.weldDirty)
+        {
+            weldEnts.push_back(rScnParts.weldToActive[weld]);
+        }
+
+        SysPhysics::update_subtree_mass_batch(
+                rBasic.m_transform, rPhys, rBasic.m_scnGraph,
+                weldEnts.begin(), weldEnts.end());
+
+        // Push refreshed mass properties to each dirty weld's body. Cache hits
+        // from here on; welds spawned this frame were also computed on body
+        // creation above.
+        for (ActiveEnt const weldEnt : weldEnts)
+        {
+            auto const found = rNwt.m_entToBody.find(weldEnt);
+            if (found == rNwt.m_entToBody.end())
+            {
+                continue;
+            }
+
+            NewtonBody *pBody = rNwt.m_bodyPtrs[found->second].get();
+
+            ACompSubtreeMass const& weldMass = SysPhysics::update_subtree_mass(
+                    rBasic.m_transform, rPhys, rBasic.m_scnGraph, weldEnt);
+
+            Matrix4 const inertiaTensorMat4{weldMass.m_inertia};
+            NewtonBodySetFullMassMatrix (pBody, weldMass.m_mass, inertiaTensorMat4.data());
+            NewtonBodySetCentreOfMass   (pBody, weldMass.m_com.data());
+        }
+    });
+
     return out;
 } // setup_vehicle_spawn_newton
 
@@ -591,47 +865,62 @@ static void assign_rockets(
 }
 
 // ACtxNwtWorld::ForceFactorFunc::Func_t
-static void rocket_thrust_force(NewtonBody const* pBody, BodyId const body, ACtxNwtWorld const& rNwt, ACtxNwtWorld::ForceFactorFunc::UserData_t data, Vector3& rForce, Vector3& rTorque) noexcept
+static void rocket_thrust_force(ACtxNwtWorld& rNwt, std::size_t const factorIdx, ACtxNwtWorld::ForceFactorFunc::UserData_t data) noexcept
 {
     auto const& rRocketsNwt     = *reinterpret_cast<ACtxRocketsNwt const*>          (data[0]);
-    auto const& rMachines       = *reinterpret_cast<Machines const*>                (data[1]);
-    auto const& rSigValFloat    = *reinterpret_cast<SignalValues_t<float> const*>   (data[2]);
-
-    auto &rBodyRockets = rRocketsNwt.m_bodyRockets[body];
+    auto const& rSigValFloat    = *reinterpret_cast<SignalValues_t<float> const*>   (data[1]);
 
-    if (rBodyRockets.empty())
+    // One sweep over all bodies with the rocket factor bit; assign_rockets keeps the bit in
+    // sync with m_bodyRockets membership
+    for (BodyId body = 0; body < rNwt.m_bodyPtrs.size(); ++body)
     {
-        return;
-    }
+        NewtonBody const *pBody = rNwt.m_bodyPtrs[body].get();
 
-    std::array<dFloat, 4> nwtRot; // quaternion xyzw
-    NewtonBodyGetRotation(pBody, nwtRot.data());
-    Quaternion const rot{{nwtRot[0], nwtRot[1], nwtRot[2]}, nwtRot[3]};
-
-    Vector3 com;
-    NewtonBodyGetCentreOfMass(pBody, com.data());
-
-    for (BodyRocket const& bodyRocket : rBodyRockets)
-    {
-        float const throttle = std::clamp(rSigValFloat[bodyRocket.m_throttleIn], 0.0f, 1.0f);
-        float const multiplier = rSigValFloat[bodyRocket.m_multiplierIn];
+        if (   (pBody == nullptr)
+            || ( ! lgrn::bit_view(rNwt.m_bodyFactors[body]).test(factorIdx)) )
+        {
+            continue;
+        }
 
-        float const thrustMag = throttle * multiplier;
+        auto const &rBodyRockets = rRocketsNwt.m_bodyRockets[body];
 
-        if (thrustMag == 0.0f)
+        if (rBodyRockets.empty())
         {
             continue;
         }
 
-        Vector3 const offsetRel = rot.transformVector(bodyRocket.m_offset - com);
+        std::array<dFloat, 4> nwtRot; // quaternion xyzw
+        NewtonBodyGetRotation(pBody, nwtRot.data());
+        Quaternion const rot{{nwtRot[0], nwtRot[1], nwtRot[2]}, nwtRot[3]};
+
+        Vector3 com;
+        NewtonBodyGetCentreOfMass(pBody, com.data());
 
-        Vector3 const direction = (rot * bodyRocket.m_rotation).transformVector(adera::gc_rocketForward);
+        Vector3 &rForce  = rNwt.m_bodyForce [body];
+        Vector3 &rTorque = rNwt.m_bodyTorque[body];
+
+        for (BodyRocket const& bodyRocket : rBodyRockets)
+        {
+            float const throttle = std::clamp(rSigValFloat[bodyRocket.m_throttleIn], 0.0f, 1.0f);
+            float const multiplier = rSigValFloat[bodyRocket.m_multiplierIn];
 
-        Vector3 const thrustForce = direction * thrustMag;
-        Vector3 const thrustTorque = Magnum::Math::cross(offsetRel, thrustForce);
+            float const thrustMag = throttle * multiplier;
 
-        rForce += thrustForce;
-        rTorque += thrustTorque;
+            if (thrustMag == 0.0f)
+            {
+                continue;
+            }
+
+            Vector3 const offsetRel = rot.transformVector(bodyRocket.m_offset - com);
+
+            Vector3 const direction = (rot * bodyRocket.m_rotation).transformVector(adera::gc_rocketForward);
+
+            Vector3 const thrustForce = direction * thrustMag;
+            Vector3 const thrustTorque = Magnum::Math::cross(offsetRel, thrustForce);
+
+            rForce += thrustForce;
+            rTorque += thrustTorque;
+        }
     }
 }
 
@@ -687,15 +976,12 @@ Session setup_rocket_thrust_newton(
         }
     });
 
-    auto &rScnParts     = top_get< ACtxParts >              (topData, idScnParts);
     auto &rSigValFloat  = top_get< SignalValues_t<float> >  (topData, idSigValFloat);
-    Machines &rMachines = rScnParts.machines;
-
 
     ACtxNwtWorld::ForceFactorFunc const factor
     {
         .m_func = &rocket_thrust_force,
-        .m_userData = { &rRocketsNwt, &rMachines, &rSigValFloat }
+        .m_userData = { &rRocketsNwt, &rSigValFloat }
     };
 
     auto &rNwt = top_get<ACtxNwtWorld>(topData, idNwt);
@@ -95,6 +95,20 @@ osp::Session setup_vehicle_spawn_newton(
         osp::Session const&         vehicleSpawn,
         osp::Session const&         newton);
 
+/**
+ * @brief Newton colliders for planet terrain chunks near the terrain frame
+ *
+ * Tree collisions are built from BasicChunkMeshGeometry for chunks within a
+ * physics radius and attached to a single static terrain body, swapped in the
+ * same add/remove bracket as chunks subdivide. Builds are budgeted per update.
+ */
+osp::Session setup_terrain_collider_newton(
+        osp::TopTaskBuilder&        rBuilder,
+        osp::ArrayView<entt::any>   topData,
+        osp::Session const&         scene,
+        osp::Session const&         terrain,
+        osp::Session const&         newton);
+
 /**
  * @brief Add thrust forces to Magic Rockets from setup_mach_rocket
  */
@@ -28,6 +28,8 @@
 #include <osp/activescene/basic.h>
 #include <osp/activescene/physics_fn.h>
 #include <osp/activescene/prefab_fn.h>
+#include <osp/activescene/spatial.h>
+#include <osp/activescene/world_tf.h>
 #include <osp/core/Resources.h>
 #include <osp/drawing/drawing_fn.h>
 #include <osp/drawing/prefab_draw.h>
@@ -64,8 +66,23 @@ Session setup_physics(
 
     rBuilder.pipeline(tgPhy.physBody)  .parent(tgScn.update);
     rBuilder.pipeline(tgPhy.physUpdate).parent(tgScn.update);
+    rBuilder.pipeline(tgPhy.spatial)   .parent(tgScn.update);
 
-    top_emplace< ACtxPhysics >  (topData, idPhys);
+    top_emplace< ACtxPhysics >      (topData, idPhys);
+    top_emplace< ACtxWorldTf >      (topData, idPhysWorldTf);
+    top_emplace< ACtxSpatialTree >  (topData, idSpatialTree);
+
+    rBuilder.task()
+        .name       ("Update spatial index")
+        .run_on     ({tgScn.update(Run)})
+        .sync_with  ({tgCS.hierarchy(Ready), tgCS.transform(Ready), tgPhy.physUpdate(Done), tgPhy.spatial(Modify)})
+        .push_to    (out.m_tasks)
+        .args       ({      idBasic,             idPhys,             idPhysWorldTf,                 idSpatialTree })
+        .func([] (ACtxBasic& rBasic, ACtxPhysics& rPhys, ACtxWorldTf& rPhysWorldTf, ACtxSpatialTree& rSpatialTree) noexcept
+    {
+        SysWorldTf::update(rBasic.m_scnGraph, rBasic.m_transform, rPhysWorldTf);
+        SysSpatialTree::update_from_scene(rSpatialTree, rBasic.m_scnGraph, rPhysWorldTf, rPhys);
+    });
 
     rBuilder.task()
         .name       ("Delete Physics components")
@@ -256,7 +273,7 @@ Session setup_prefab_draw(
                       tgScnRdr.materialDirty(Modify_), tgScnRdr.entMeshDirty(Modify_)})
         .push_to    (out.m_tasks)
         .args       ({        idPrefabs,           idResources,                 idBasic,             idDrawing,                idDrawingRes,                 idScnRender,          idMaterial})
-        .func([] (ACtxPrefabs& rPrefabs, Resources& rResources, ACtxBasic const& rBasic, ACtxDrawing& rDrawing, ACtxDrawingRes& rDrawingRes, ACtxSceneRender& rScnRender, MaterialId material) noexcept
+        .func([] (ACtxPrefabs& rPrefabs, Resources& rResources, ACtxBasic& rBasic, ACtxDrawing& rDrawing, ACtxDrawingRes& rDrawingRes, ACtxSceneRender& rScnRender, MaterialId material) noexcept
     {
         SysPrefabDraw::resync_mesh_texture_material(rPrefabs, rResources, rBasic, rDrawing, rDrawingRes, rScnRender, material);
     });
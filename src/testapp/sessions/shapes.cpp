@@ -274,7 +274,7 @@ Session setup_phys_shapes_draw(
             rScnRender.m_needDrawTf.set(std::size_t(root));
             rScnRender.m_needDrawTf.set(std::size_t(child));
 
-            rScnRender.m_mesh[drawEnt] = rDrawing.m_meshRefCounts.ref_add(rNMesh.m_shapeToMesh.at(spawn.m_shape));
+            rScnRender.hot[drawEnt].mesh = rDrawing.m_meshRefCounts.ref_add(rNMesh.m_shapeToMesh.at(spawn.m_shape));
             rScnRender.m_meshDirty.push_back(drawEnt);
 
             rMat.m_ents.set(std::size_t(drawEnt));
@@ -311,7 +311,7 @@ Session setup_phys_shapes_draw(
                       tgScnRdr.materialDirty(Modify_), tgScnRdr.entMeshDirty(Modify_)})
         .push_to    (out.m_tasks)
         .args       ({            idBasic,             idDrawing,             idPhys,                idPhysShapes,                 idScnRender,             idNMesh })
-        .func([] (ACtxBasic const& rBasic, ACtxDrawing& rDrawing, ACtxPhysics& rPhys, ACtxPhysShapes& rPhysShapes, ACtxSceneRender& rScnRender, NamedMeshes& rNMesh) noexcept
+        .func([] (ACtxBasic& rBasic, ACtxDrawing& rDrawing, ACtxPhysics& rPhys, ACtxPhysShapes& rPhysShapes, ACtxSceneRender& rScnRender, NamedMeshes& rNMesh) noexcept
     {
         Material &rMat = rScnRender.m_materials[rPhysShapes.m_materialId];
 
@@ -326,8 +326,12 @@ Session setup_phys_shapes_draw(
             rScnRender.m_needDrawTf.set(std::size_t(root));
             rScnRender.m_needDrawTf.set(std::size_t(child));
 
+            // The re-opened renderer has no draw transforms yet; don't skip these as clean
+            SysSceneGraph::mark_transform_dirty(rBasic.m_scnGraph, root);
+            SysSceneGraph::mark_transform_dirty(rBasic.m_scnGraph, child);
+
             EShape const shape = rPhys.m_shape.at(child);
-            rScnRender.m_mesh[drawEnt] = rDrawing.m_meshRefCounts.ref_add(rNMesh.m_shapeToMesh.at(shape));
+            rScnRender.hot[drawEnt].mesh = rDrawing.m_meshRefCounts.ref_add(rNMesh.m_shapeToMesh.at(shape));
             rScnRender.m_meshDirty.push_back(drawEnt);
 
             rMat.m_ents.set(std::size_t(drawEnt));
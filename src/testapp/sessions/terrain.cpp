@@ -37,6 +37,8 @@
 
 #include <longeron/utility/asserts.hpp>
 
+#include <Corrade/Containers/ArrayViewStl.h>
+
 #include <chrono>
 #include <fstream>
 
@@ -141,6 +143,18 @@ Session setup_terrain_subdiv_dist(
         BasicChunkMeshGeometry     &rChGeo     = rTerrain.chunkGeom;
         SkeletonSubdivScratchpad   &rSkSP      = rTerrain.scratchpad;
 
+        // Skip the whole scan until the viewer strays far enough from where the last scan ran;
+        // a stationary viewer then costs nothing per update. LOD transitions are delayed by at
+        // most scanHysteresis of movement, well within the 2x subdiv/unsubdiv threshold gap.
+        if (   rSkSP.scanValid
+            && osp::is_distance_near(rTerrainFrame.position, rSkSP.lastScanPosition,
+                                     rSkSP.scanHysteresis) )
+        {
+            return;
+        }
+        rSkSP.lastScanPosition = rTerrainFrame.position;
+        rSkSP.scanValid        = true;
+
         // ## Unsubdivide triangles that are too far away
 
         // Unsubdivide is performed first, since it's better to remove stuff before adding new
@@ -215,7 +229,9 @@ Session setup_terrain_subdiv_dist(
             auto    const sktriId = SkTriId(sktriInt);
             ChunkId const chunkId = rSkCh.m_triToChunk[sktriId];
 
-            subtract_normal_contrib(chunkId, false, rChGeo, rChInfo, rChSP, rSkCh);
+            subtract_normal_contrib(chunkId, 0b111111, true, rChGeo, rChInfo,
+                                    rChGeo.sharedNormalSum.base(), rChSP.sharedNormalsDirty,
+                                    rChSP, rSkCh);
 
             rSkCh.chunk_remove(chunkId, sktriId, rChSP.sharedRemoved, rSkel);
         }
@@ -259,23 +275,53 @@ Session setup_terrain_subdiv_dist(
             restitch_check(chunkId, sktriId, rSkCh, rSkel, rSkData, rChSP);
         }
 
-        // Calculate positions for newly added shared vertex
+        // Calculate positions for newly added shared vertices. Per-vertex math runs in float
+        // relative to the owning skeleton triangle's centroid: the centroid is converted with
+        // doubles once per chunk, and the int64 offset from it is exact and small enough that
+        // float covers it, so the per-vertex work is all single-precision.
         float const scalepow = std::pow(2.0f, -rSkData.precision);
-        for (std::size_t const sharedVrtxInt : rChSP.sharedAdded.ones())
+        for (ChunkId const chunkId : rChSP.chunksAdded)
         {
-            auto     const sharedVrtxId = SharedVrtxId::from_index(sharedVrtxInt);
-            SkVrtxId const skelVrtx     = rSkCh.m_sharedToSkVrtx[sharedVrtxId];
+            SkTriId  const sktriId = rSkCh.m_chunkToTri[chunkId];
+            Vector3l const center  = rSkData.centers[sktriId];
+            Vector3  const centerF = Vector3(Vector3d(center) * scalepow);
+
+            for (SharedVrtxOwner_t const& sharedUsed : rSkCh.shared_vertices_used(chunkId))
+            {
+                SharedVrtxId const sharedVrtxId = sharedUsed.value();
+                if ( ! rChSP.sharedAdded.test(sharedVrtxId.value) )
+                {
+                    continue;
+                }
+                // Shared vertices on the boundary between two new chunks show up in both;
+                // clearing the bit keeps this a single visit.
+                rChSP.sharedAdded.reset(sharedVrtxId.value);
+
+                SkVrtxId const skelVrtx = rSkCh.m_sharedToSkVrtx[sharedVrtxId];
 
-            // Normal is not cleaned up by the previous user. Normal is initially set to zero, and
-            // face normals added in update_faces(...) will accumulate here.
-            rChGeo.sharedNormalSum[sharedVrtxId] = Vector3{ZeroInit};
+                // Normal is not cleaned up by the previous user. Normal is initially set to zero,
+                // and face normals added in update_faces(...) will accumulate here.
+                rChGeo.sharedNormalSum[sharedVrtxId] = Vector3{ZeroInit};
 
-            //Vector3l const translated = positions[size_t(skelId)] + translaton;
-            Vector3d  const scaled = Vector3d(rSkData.positions[skelVrtx]) * scalepow;
-            VertexIdx const vertex = rChInfo.vbufSharedOffset + sharedVrtxInt;
+                Vector3   const offset = Vector3(rSkData.positions[skelVrtx] - center) * scalepow;
+                VertexIdx const vertex = rChInfo.vbufSharedOffset + sharedVrtxId.value;
 
-            // Heightmap goes here (1)
-            rChGeo.chunkVbufPos[vertex] = Vector3(scaled);
+                // Heightmap goes here (1)
+                rChGeo.chunkVbufPos[vertex] = centerF + offset;
+
+                // Geomorph target: midpoint of the two skeleton vertices this one was created
+                // between, i.e. where this vertex sits on the parent subdivision level
+                auto const parents = rSkel.vrtx_ids().parents_of(skelVrtx);
+                if (parents.a.has_value())
+                {
+                    Vector3l const mid = (rSkData.positions[parents.a] + rSkData.positions[parents.b]) / 2;
+                    rChGeo.chunkVbufMorphPos[vertex] = centerF + Vector3(mid - center) * scalepow;
+                }
+                else
+                {
+                    rChGeo.chunkVbufMorphPos[vertex] = rChGeo.chunkVbufPos[vertex];
+                }
+            }
         }
 
         // Calculate fill vertex positions
@@ -287,10 +333,10 @@ Session setup_terrain_subdiv_dist(
 
             osp::ArrayView<SharedVrtxOwner_t const> sharedUsed = rSkCh.shared_vertices_used(chunk);
 
-            for (ChunkFillSubdivLUT::ToSubdiv const& toSubdiv : rChSP.lut.data())
+            for (ChunkFillSubdivLUT::ToSubdiv const& toSubdiv : rChSP.lut->data())
             {
-                std::size_t const vrtxA = rChSP.lut.index(sharedUsed, fillOffset, rChInfo.vbufSharedOffset, toSubdiv.m_vrtxA);
-                std::size_t const vrtxB = rChSP.lut.index(sharedUsed, fillOffset, rChInfo.vbufSharedOffset, toSubdiv.m_vrtxB);
+                std::size_t const vrtxA = rChSP.lut->index(sharedUsed, fillOffset, rChInfo.vbufSharedOffset, toSubdiv.m_vrtxA);
+                std::size_t const vrtxB = rChSP.lut->index(sharedUsed, fillOffset, rChInfo.vbufSharedOffset, toSubdiv.m_vrtxB);
                 std::size_t const vrtxC = rChInfo.vbufFillOffset + rChInfo.fillVrtxCount*chunkIdInt + toSubdiv.m_fillOut.value;
 
                 Vector3 &rPosC = rChGeo.chunkVbufPos[vrtxC];
@@ -301,18 +347,17 @@ Session setup_terrain_subdiv_dist(
                 float   const roundness = rTerrainIco.radius - avgLen;
 
                 rPosC = avg + (avg / avgLen) * roundness;
+
+                // Geomorph target: the un-rounded midpoint is this vertex's position on the
+                // parent subdivision level. The LUT lists parents before children, so vrtxA/B
+                // already hold final positions here.
+                rChGeo.chunkVbufMorphPos[vrtxC] = avg;
             }
         }
 
-        // Update index buffer and calculate normals
-        for (std::size_t const chunkInt : rSkCh.m_chunkIds.bitview().zeros())
-        {
-            auto    const chunkId    = ChunkId::from_index(chunkInt);
-            SkTriId const sktriId    = rSkCh.m_chunkToTri[chunkId];
-            bool    const newlyAdded = rSkSP.surfaceAdded.test(sktriId.value);
-
-            update_faces(chunkId, sktriId, newlyAdded, rSkel, rSkData, rChGeo, rChInfo, rChSP, rSkCh);
-        }
+        // Update index buffers and calculate normals across worker threads. Shared vertex
+        // normal sums are staged per-worker and spliced back on this thread.
+        update_faces_parallel(rSkSP.surfaceAdded, rSkel, rSkData, rChGeo, rChInfo, rChSP, rSkCh);
         std::fill(rChSP.stitchCmds.begin(), rChSP.stitchCmds.end(), ChunkStitch{});
 
 
@@ -324,8 +369,27 @@ Session setup_terrain_subdiv_dist(
             rChGeo.chunkVbufNrm[rChInfo.vbufSharedOffset + sharedIdx] = normalSum.normalized();
         }
 
+        // sharedNormalSum is maintained by incremental add/subtract, and each cycle leaves a
+        // tiny float residue; shared vertices that survive many chunk rebuilds slowly drift.
+        // Rebuild the sums exactly from the stored per-chunk contributions every once in a
+        // while to cancel it. ~68 seconds apart at 60 updates per second.
+        if (++rChSP.normalRebuildTimer >= 4096)
+        {
+            rChSP.normalRebuildTimer = 0;
+            rebuild_shared_normal_sums(rChGeo, rChInfo, rSkCh);
+        }
+
         //debug_check_invariants(rChGeo, rChInfo, rSkCh);
 
+#ifdef OSP_TERRAIN_INVARIANT_CHECKS
+        // Rotating ~1% sample per update; full coverage every ~100 updates at a fraction of
+        // the full walk's cost
+        debug_check_invariants_sampled(
+                rChGeo, rChInfo, rSkCh,
+                std::max<std::uint32_t>(rSkCh.m_chunkIds.capacity() / 100u, 1u),
+                rChSP.invariantCheckRotate);
+#endif
+
         // TODO: temporary, write debug obj file every ~10 seconds
         static int fish = 0;
         ++fish;
@@ -352,6 +416,41 @@ Session setup_terrain_subdiv_dist(
     return out;
 }
 
+void terrain_update_subdiv_thresholds(
+        ACtxTerrain          &rTerrain,
+        ACtxTerrainIco const &rTerrainIco,
+        float          const lodScale)
+{
+    SkeletonSubdivScratchpad &rSP = rTerrain.scratchpad;
+
+    double const scale = std::pow(2.0, rTerrain.skData.precision);
+
+    // These threshold values are used by subdivide_level_by_distance(...) and
+    // unsubdivide_select_by_distance(...)
+    for (int level = 0; level < gc_maxSubdivLevels; ++level)
+    {
+        // Good-enough bounding sphere is ~75% of the edge length (determined using Blender)
+        float const edgeLength = gc_icoMaxEdgeVsLevel[level] * rTerrainIco.radius * scale;
+        float const subdivRadius = 0.75f * edgeLength * lodScale;
+
+        // TODO: Pick thresholds based on the angular diameter (size on screen) of the
+        //       chunk triangle mesh that will actually be rendered.
+        rSP.distanceThresholdSubdiv[level] = std::uint64_t(subdivRadius);
+
+        // Unsubdivide thresholds should be slightly larger (arbitrary x2) to avoid rapid
+        // terrain changes when moving back and forth quickly
+        rSP.distanceThresholdUnsubdiv[level] = std::uint64_t(2.0f * subdivRadius);
+    }
+
+    // The finest level has the tightest threshold, so its subdiv radius bounds how far the
+    // viewer can move before any distance test result may flip. A quarter of it keeps the
+    // worst-case LOD lag small relative to the finest chunks.
+    if (rTerrain.skeleton.levelMax > 0)
+    {
+        rSP.scanHysteresis = rSP.distanceThresholdSubdiv[rTerrain.skeleton.levelMax - 1] / 4;
+    }
+}
+
 void initialize_ico_terrain(
         ArrayView<entt::any>   const topData,
         Session                const &terrain,
@@ -385,7 +484,6 @@ void initialize_ico_terrain(
 
     rTerrain.skData.resize(rTerrain.skeleton);
 
-    double const scale = std::pow(2.0, rTerrain.skData.precision);
     double const maxRadius = rTerrainIco.radius + rTerrainIco.height;
 
     for (SkTriGroupId const groupId : rTerrainIco.icoGroups)
@@ -393,6 +491,13 @@ void initialize_ico_terrain(
         ico_calc_sphere_tri_center(groupId, maxRadius, rTerrainIco.height, rTerrain.skeleton, rTerrain.skData);
     }
 
+    // ## Prepare chunk culling data. Root icosahedron faces don't form groups with a parent
+    // triangle, so no cones exist yet; they are added per-group as the skeleton subdivides.
+
+    rTerrain.chunkCull.radiusMin = float(specs.radius);
+    rTerrain.chunkCull.radiusMax = float(specs.radius + specs.height);
+    rTerrain.chunkCull.resize(rTerrain.skeleton);
+
     // ## Prepare the skeleton subdiv scratchpad.
     // This contains intermediate variables used when subdividing the triangle skeleton.
 
@@ -411,6 +516,7 @@ void initialize_ico_terrain(
     // Spherical planets are not hard-coded into subdivision logic, it's intended to work
     // to work for non-spherical shapes too.
     rTerrain.scratchpad.onSubdivUserData[0] = &rTerrainIco;
+    rTerrain.scratchpad.onSubdivUserData[1] = &rTerrain.chunkCull;
     rSP.onSubdiv = [] (
             SkTriId                             tri,
             SkTriGroupId                        groupId,
@@ -421,8 +527,12 @@ void initialize_ico_terrain(
             SkeletonSubdivScratchpad::UserData_t userData) noexcept
     {
         auto const& rTerrainIco = *reinterpret_cast<ACtxTerrainIco*>(userData[0]);
+        auto       & rChunkCull = *reinterpret_cast<ChunkCullData*>(userData[1]);
         ico_calc_middles(rTerrainIco.radius, corners, middles, rSkData);
         ico_calc_sphere_tri_center(groupId, rTerrainIco.radius + rTerrainIco.height, rTerrainIco.height, rSkel, rSkData);
+
+        rChunkCull.resize(rSkel);
+        calc_group_cone(groupId, rSkel, rSkData, rChunkCull);
     };
 
     // Nothing to do on un-subdivide
@@ -435,22 +545,9 @@ void initialize_ico_terrain(
     { };
 
     // Calculate distance thresholds for when skeleton triangles should be subdivided and
-    // unsubdivided. These threshold values are used by
-    // subdivide_level_by_distance(...) and unsubdivide_select_by_distance(...)
-    for (int level = 0; level < gc_maxSubdivLevels; ++level)
-    {
-        // Good-enough bounding sphere is ~75% of the edge length (determined using Blender)
-        float const edgeLength = gc_icoMaxEdgeVsLevel[level] * rTerrainIco.radius * scale;
-        float const subdivRadius = 0.75f * edgeLength;
-
-        // TODO: Pick thresholds based on the angular diameter (size on screen) of the
-        //       chunk triangle mesh that will actually be rendered.
-        rSP.distanceThresholdSubdiv[level] = std::uint64_t(subdivRadius);
-
-        // Unsubdivide thresholds should be slightly larger (arbitrary x2) to avoid rapid
-        // terrain changes when moving back and forth quickly
-        rSP.distanceThresholdUnsubdiv[level] = std::uint64_t(2.0f * subdivRadius);
-    }
+    // unsubdivided. The frame-budget governor re-calls this with a smaller lodScale when
+    // the frame runs over budget.
+    terrain_update_subdiv_thresholds(rTerrain, rTerrainIco, 1.0f);
 
     // ## Prepare Chunk Skeleton
 
@@ -474,9 +571,9 @@ void initialize_ico_terrain(
     rTerrain.chunkInfo = make_chunk_mesh_buffer_info(rTerrain.skChunks);
     rTerrain.chunkGeom.resize(rTerrain.skChunks, rTerrain.chunkInfo);
 
-    // ## Prepare Chunk scratchpad
+    // ## Prepare Chunk scratchpad. This also grabs the shared fill subdivision LUT for
+    // chunkSubdivLevels, building it only if no other terrain instance holds it yet.
 
-    rTerrain.chunkSP.lut = make_chunk_vrtx_subdiv_lut(chunkSubdivLevels);
     rTerrain.chunkSP.resize(rTerrain.skChunks);
 
     OSP_LOG_INFO("Terrain Chunk Properties:\n"
@@ -493,8 +590,9 @@ void initialize_ico_terrain(
                  rTerrain.chunkInfo.chunkMaxFaceCount,
                  rTerrain.skChunks.m_sharedIds.capacity(),
                  fmt::group_digits(rTerrain.chunkGeom.chunkIbuf.size() * sizeof(Vector3u)),
-                 fmt::group_digits(  rTerrain.chunkGeom.chunkVbufNrm.size() * sizeof(Vector3)
-                                   + rTerrain.chunkGeom.chunkVbufPos.size() * sizeof(Vector3)));
+                 fmt::group_digits(  rTerrain.chunkGeom.chunkVbufNrm.size()      * sizeof(Vector3)
+                                   + rTerrain.chunkGeom.chunkVbufPos.size()      * sizeof(Vector3)
+                                   + rTerrain.chunkGeom.chunkVbufMorphPos.size() * sizeof(Vector3)));
 }
 
 
@@ -589,9 +687,9 @@ Session setup_terrain_debug_draw(
             {
                 if (rDrawEnt.has_value())
                 {
-                    if (rScnRender.m_mesh[rDrawEnt].has_value())
+                    if (rScnRender.hot[rDrawEnt].mesh.has_value())
                     {
-                        rDrawing.m_meshRefCounts.ref_release(std::exchange(rScnRender.m_mesh[rDrawEnt], {}));
+                        rDrawing.m_meshRefCounts.ref_release(std::exchange(rScnRender.hot[rDrawEnt].mesh, {}));
                     }
                     rScnRender.m_meshDirty  .push_back  (rDrawEnt);
                     rScnRender.m_visible    .reset      (rDrawEnt.value);
@@ -627,9 +725,9 @@ Session setup_terrain_debug_draw(
             SkVrtxId const skVert  = SkVrtxId::from_index(skVertInt);
             DrawEnt  const drawEnt = rTrnDbgDraw.verts[skVert];
 
-            if ( ! rScnRender.m_mesh[drawEnt].has_value() )
+            if ( ! rScnRender.hot[drawEnt].mesh.has_value() )
             {
-                rScnRender.m_mesh[drawEnt] = rDrawing.m_meshRefCounts.ref_add(cubeMeshId);
+                rScnRender.hot[drawEnt].mesh = rDrawing.m_meshRefCounts.ref_add(cubeMeshId);
                 rScnRender.m_meshDirty.push_back(drawEnt);
                 rScnRender.m_visible.set(drawEnt.value);
                 rScnRender.m_opaque.set(drawEnt.value);
@@ -637,7 +735,7 @@ Session setup_terrain_debug_draw(
                 rMatPlanet.m_dirty.push_back(drawEnt);
             }
 
-            rScnRender.m_drawTransform[drawEnt]
+            rScnRender.hot[drawEnt].drawTf
                 = Matrix4::translation(Vector3(rTerrain.skData.positions[skVert]) / int_2pow<int>(rTerrain.skData.precision))
                 * Matrix4::scaling({0.05f, 0.05f, 0.05f});
         }
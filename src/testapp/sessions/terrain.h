@@ -30,6 +30,7 @@
 #include <osp/core/math_types.h>
 #include <osp/drawing/draw_ent.h>
 
+#include <planet-a/chunk_cull.h>
 #include <planet-a/skeleton.h>
 #include <planet-a/skeleton_subdiv.h>
 #include <planet-a/chunk_generate.h>
@@ -63,6 +64,9 @@ struct ACtxTerrain
 
     planeta::ChunkScratchpad            chunkSP;
     planeta::SkeletonSubdivScratchpad   scratchpad;
+
+    /// Bounding cones for horizon/frustum culling chunks, fed to planeta::cull_chunks
+    planeta::ChunkCullData              chunkCull;
 };
 
 struct ACtxTerrainIco
@@ -136,6 +140,21 @@ void initialize_ico_terrain(
         TerrainTestPlanetSpecs      params);
 
 
+/**
+ * @brief Recalculate skeleton subdivision distance thresholds
+ *
+ * lodScale 1.0 is full detail; values below 1.0 shrink the thresholds so triangles
+ * subdivide closer to the viewer, coarsening the mesh. Called by initialize_ico_terrain,
+ * and re-called by the frame-budget governor listener when the frame runs over budget.
+ * A renderer that geomorphs using BasicChunkMeshGeometry::chunkVbufMorphPos can run at
+ * lodScale ~0.5 with no visible popping, halving chunk churn during descent.
+ */
+void terrain_update_subdiv_thresholds(
+        ACtxTerrain                 &rTerrain,
+        ACtxTerrainIco        const &rTerrainIco,
+        float                       lodScale);
+
+
 /**
  * @brief Uses camera target as position relative to planet, and visualizes terrain skeleton.
  */
@@ -31,6 +31,7 @@
 #include <osp/core/math_2pow.h>
 #include <osp/drawing/drawing.h>
 #include <osp/universe/coordinates.h>
+#include <osp/universe/propagation.h>
 #include <osp/universe/universe.h>
 #include <osp/util/logging.h>
 
@@ -91,12 +92,14 @@ Session setup_uni_sceneframe(
 Session setup_uni_testplanets(
         TopTaskBuilder&             rBuilder,
         ArrayView<entt::any>        topData,
+        Session const&              scene,
         Session const&              uniCore,
         Session const&              uniScnFrame)
 {
     using CoSpaceIdVec_t = std::vector<CoSpaceId>;
     using Corrade::Containers::Array;
 
+    OSP_DECLARE_GET_DATA_IDS(scene, TESTAPP_DATA_SCENE);
     OSP_DECLARE_GET_DATA_IDS(uniCore, TESTAPP_DATA_UNI_CORE);
     OSP_DECLARE_GET_DATA_IDS(uniScnFrame, TESTAPP_DATA_UNI_SCENEFRAME);
 
@@ -180,6 +183,12 @@ Session setup_uni_testplanets(
         qw[i] = 1.0;
     }
 
+    // Bin satellites for proximity queries. Cells are 2^9 = 512 meters across, around the size
+    // of the capture radius queried below.
+    rMainSpaceCommon.m_satIndex.cellExponent = precision + 9;
+    rMainSpaceCommon.m_satIndex.resize(planetCount);
+    rMainSpaceCommon.m_satIndex.update(x, y, z, planetCount);
+
     // Set initial scene frame
 
     auto &rScnFrame      = top_get<SceneFrame>(topData, idScnFrame);
@@ -193,55 +202,151 @@ Session setup_uni_testplanets(
     top_emplace< float >            (topData, tgUniDeltaTimeIn, 1.0f / 60.0f);
     top_emplace< CoSpaceIdVec_t >   (topData, idSatSurfaceSpaces, std::move(satSurfaceSpaces));
 
+    // Closed-form rails state for time warp, per satellite-holding coordinate space
+    struct SpaceRails
+    {
+        /// Parallel with satellites; semiMajorAxis <= 0 marks ones that couldn't be railed
+        std::vector<KeplerOrbit>    orbits;
+
+        /// Seconds since elements were captured from the state vectors
+        double                      railsTime   {0.0};
+
+        bool                        active      {false};
+    };
+
+    // Satellite propagation is split into one task per satellite-holding coordinate space. Each
+    // space propagates only its own buffers, so these tasks have no data in common and a
+    // multithreaded executor is free to run them concurrently within tgUCore.update(Run).
+    // Hierarchy-crossing work that reads across spaces happens afterwards in the transfer task.
+    // Only mainSpace holds satellites here; the surface spaces are empty.
+    for (CoSpaceId const space : {mainSpace})
+    {
+        auto const [idPropagateSpace, idSpaceRails] = out.acquire_data<2>(topData);
+        top_emplace< CoSpaceId >  (topData, idPropagateSpace, space);
+        top_emplace< SpaceRails > (topData, idSpaceRails);
+
+        rBuilder.task()
+            .name       ("Propagate universe coordinate space")
+            .run_on     (tgUCore.update(Run))
+            .sync_with  ({tgUCore.transfer(Modify_)})
+            .push_to    (out.m_tasks)
+            .args       ({     idUniverse,         idPropagateSpace,            idSpaceRails,           tgUniDeltaTimeIn })
+            .func([] (Universe& rUniverse, CoSpaceId const space, SpaceRails &rRails, float const uniDeltaTimeIn) noexcept
+        {
+            CoSpaceCommon &rCommon = rUniverse.m_coordCommon[space];
+
+            auto const [x, y, z]        = sat_views(rCommon.m_satPositions,  rCommon.m_data, rCommon.m_satCount);
+            auto const [vx, vy, vz]     = sat_views(rCommon.m_satVelocities, rCommon.m_data, rCommon.m_satCount);
+            auto const [qx, qy, qz, qw] = sat_views(rCommon.m_satRotations,  rCommon.m_data, rCommon.m_satCount);
+
+            // Arbitrary inverse-square gravity towards origin
+            constexpr double c_gm = 10000000000.0;
+
+            // Above this much simulated time per update, one Euler step is too coarse and
+            // substepping would scale with the warp factor; switch to evaluating closed-form
+            // orbital positions at absolute time instead, which costs the same at any warp.
+            constexpr float c_railsThreshold = 1.0f;
+
+            double const scale    = osp::math::mul_2pow<double, int>(1.0, -rCommon.m_precision);
+            double const invScale = osp::math::mul_2pow<double, int>(1.0,  rCommon.m_precision);
+
+            if (uniDeltaTimeIn >= c_railsThreshold)
+            {
+                if ( ! rRails.active)
+                {
+                    // Entering warp: capture orbital elements from the state vectors once
+                    rRails.orbits.resize(rCommon.m_satCount);
+                    for (std::size_t i = 0; i < rCommon.m_satCount; ++i)
+                    {
+                        Vector3d const pos = Vector3d(Vector3g(x[i], y[i], z[i])) * scale;
+                        Vector3d const vel{vx[i], vy[i], vz[i]};
+                        if ( ! kepler_from_state(pos, vel, c_gm, rRails.orbits[i]))
+                        {
+                            rRails.orbits[i].semiMajorAxis = -1.0;
+                        }
+                    }
+                    rRails.railsTime = 0.0;
+                    rRails.active    = true;
+                }
+
+                rRails.railsTime += double(uniDeltaTimeIn);
+
+                for (std::size_t i = 0; i < rCommon.m_satCount; ++i)
+                {
+                    KeplerOrbit const &orbit = rRails.orbits[i];
+                    if (orbit.semiMajorAxis > 0.0)
+                    {
+                        Vector3d const pos = kepler_position(orbit, rRails.railsTime) * invScale;
+                        x[i] = spaceint_t(pos.x());
+                        y[i] = spaceint_t(pos.y());
+                        z[i] = spaceint_t(pos.z());
+                    }
+                    // else: escape trajectory with no closed elliptic form; frozen while
+                    // warping, same as off-rails content
+                }
+            }
+            else
+            {
+                if (rRails.active)
+                {
+                    // Leaving warp: write state vectors back so integration resumes exactly
+                    // where the closed form left off
+                    for (std::size_t i = 0; i < rCommon.m_satCount; ++i)
+                    {
+                        KeplerOrbit const &orbit = rRails.orbits[i];
+                        if (orbit.semiMajorAxis > 0.0)
+                        {
+                            Vector3d const pos = kepler_position(orbit, rRails.railsTime) * invScale;
+                            Vector3d const vel = kepler_velocity(orbit, rRails.railsTime);
+                            x[i]  = spaceint_t(pos.x());
+                            y[i]  = spaceint_t(pos.y());
+                            z[i]  = spaceint_t(pos.z());
+                            vx[i] = vel.x();
+                            vy[i] = vel.y();
+                            vz[i] = vel.z();
+                        }
+                    }
+                    rRails.active = false;
+                }
+
+                propagate_central_euler(x, y, z, vx, vy, vz,
+                                        rCommon.m_satCount, rCommon.m_precision,
+                                        uniDeltaTimeIn, c_gm);
+            }
+
+            for (std::size_t i = 0; i < rCommon.m_satCount; ++i)
+            {
+                // Rotate based on i, semi-random
+                Vector3d const axis = Vector3d{std::sin(i), std::cos(i), double(i % 8 - 4)}.normalized();
+                Radd const speed{(i % 16) / 16.0};
+
+                Quaterniond const rot =   Quaterniond{{qx[i], qy[i], qz[i]}, qw[i]}
+                                        * Quaterniond::rotation(speed * uniDeltaTimeIn, axis);
+                qx[i] = rot.vector().x();
+                qy[i] = rot.vector().y();
+                qz[i] = rot.vector().z();
+                qw[i] = rot.scalar();
+            }
+
+            rCommon.m_satIndex.update(x, y, z, rCommon.m_satCount);
+        });
+    }
+
     rBuilder.task()
-        .name       ("Update planets")
+        .name       ("Transfer scene frame between coordinate spaces")
         .run_on     (tgUCore.update(Run))
-        .sync_with  ({tgUSFrm.sceneFrame(Modify)})
+        .sync_with  ({tgUCore.transfer(UseOrRun), tgUSFrm.sceneFrame(Modify)})
         .push_to    (out.m_tasks)
-        .args       ({     idUniverse,               idPlanetMainSpace,            idScnFrame,                      idSatSurfaceSpaces,           tgUniDeltaTimeIn })
-        .func([] (Universe& rUniverse, CoSpaceId const planetMainSpace, SceneFrame &rScnFrame, CoSpaceIdVec_t const& rSatSurfaceSpaces, float const uniDeltaTimeIn) noexcept
+        .args       ({     idUniverse,               idPlanetMainSpace,            idScnFrame,                      idSatSurfaceSpaces })
+        .func([] (Universe& rUniverse, CoSpaceId const planetMainSpace, SceneFrame &rScnFrame, CoSpaceIdVec_t const& rSatSurfaceSpaces) noexcept
     {
         CoSpaceCommon &rMainSpaceCommon = rUniverse.m_coordCommon[planetMainSpace];
 
         auto const scale = osp::math::mul_2pow<double, int>(1.0, -rMainSpaceCommon.m_precision);
-        double const scaleDelta = uniDeltaTimeIn / scale;
 
         auto const [x, y, z]        = sat_views(rMainSpaceCommon.m_satPositions,  rMainSpaceCommon.m_data, rMainSpaceCommon.m_satCount);
-        auto const [vx, vy, vz]     = sat_views(rMainSpaceCommon.m_satVelocities, rMainSpaceCommon.m_data, rMainSpaceCommon.m_satCount);
         auto const [qx, qy, qz, qw] = sat_views(rMainSpaceCommon.m_satRotations,  rMainSpaceCommon.m_data, rMainSpaceCommon.m_satCount);
 
-        // Phase 1: Move satellites
-
-        for (std::size_t i = 0; i < rMainSpaceCommon.m_satCount; ++i)
-        {
-            x[i] += vx[i] * scaleDelta;
-            y[i] += vy[i] * scaleDelta;
-            z[i] += vz[i] * scaleDelta;
-
-            // Apply arbitrary inverse-square gravity towards origin
-            Vector3d const pos       = Vector3d( Vector3g( x[i], y[i], z[i] ) ) * scale;
-            double const r           = pos.length();
-            double const c_gm        = 10000000000.0;
-            Vector3d const accel     = -pos * uniDeltaTimeIn * c_gm / (r * r * r);
-
-            vx[i] += accel.x();
-            vy[i] += accel.y();
-            vz[i] += accel.z();
-
-            // Rotate based on i, semi-random
-            Vector3d const axis = Vector3d{std::sin(i), std::cos(i), double(i % 8 - 4)}.normalized();
-            Radd const speed{(i % 16) / 16.0};
-
-            Quaterniond const rot =   Quaterniond{{qx[i], qy[i], qz[i]}, qw[i]}
-                                    * Quaterniond::rotation(speed * uniDeltaTimeIn, axis);
-            qx[i] = rot.vector().x();
-            qy[i] = rot.vector().y();
-            qz[i] = rot.vector().z();
-            qw[i] = rot.scalar();
-        }
-
-        // Phase 2: Transfers and stuff
-
         constexpr float captureDist = 500.0f;
 
         Vector3g const cameraPos{rScnFrame.m_rotation.transformVector(Vector3d(rScnFrame.m_scenePosition))};
@@ -251,17 +356,13 @@ Session setup_uni_testplanets(
 
         if (notInPlanet)
         {
-            // Find a planet to enter
-            std::size_t nearbyPlanet = rMainSpaceCommon.m_satCount;
-            for (std::size_t i = 0; i < rMainSpaceCommon.m_satCount; ++i)
-            {
-                Vector3 const diff = (Vector3( x[i], y[i], z[i] ) - Vector3(areaPos)) * scale;
-                if (diff.length() < captureDist)
-                {
-                    nearbyPlanet = i;
-                    break;
-                }
-            }
+            // Find a planet to enter; grid query instead of scanning every satellite
+            auto const captureDistUnits = spaceint_t(captureDist / scale);
+            std::vector<SatId> nearby;
+            rMainSpaceCommon.m_satIndex.query_radius(areaPos, captureDistUnits, x, y, z, nearby);
+
+            std::size_t const nearbyPlanet
+                    = nearby.empty() ? rMainSpaceCommon.m_satCount : std::size_t(nearby.front());
 
             if (nearbyPlanet < rMainSpaceCommon.m_satCount)
             {
@@ -303,6 +404,40 @@ Session setup_uni_testplanets(
         }
     });
 
+    rBuilder.task()
+        .name       ("Set scene tick rate by planet proximity")
+        .run_on     (tgUCore.update(Run))
+        .sync_with  ({tgUSFrm.sceneFrame(Ready)})
+        .push_to    (out.m_tasks)
+        .args       ({     idUniverse,               idPlanetMainSpace,                  idScnFrame,               idTickRate })
+        .func([] (Universe& rUniverse, CoSpaceId const planetMainSpace, SceneFrame const& rScnFrame, SceneTickRate& rTickRate) noexcept
+    {
+        // Promote back to full rate well outside the 500 unit capture distance, so the
+        // scene is already ticking at 60 Hz by the time a planet can be entered
+        constexpr float fullRateDist = 4.0f * 500.0f;
+
+        if (rScnFrame.m_parent != planetMainSpace)
+        {
+            // Within a planet's surface space; always full rate
+            rTickRate.background = false;
+            return;
+        }
+
+        CoSpaceCommon &rMainSpaceCommon = rUniverse.m_coordCommon[planetMainSpace];
+
+        auto const scale = osp::math::mul_2pow<double, int>(1.0, -rMainSpaceCommon.m_precision);
+
+        auto const [x, y, z] = sat_views(rMainSpaceCommon.m_satPositions, rMainSpaceCommon.m_data, rMainSpaceCommon.m_satCount);
+
+        Vector3g const cameraPos{rScnFrame.m_rotation.transformVector(Vector3d(rScnFrame.m_scenePosition))};
+        Vector3g const areaPos{rScnFrame.m_position + cameraPos};
+
+        std::vector<SatId> nearby;
+        rMainSpaceCommon.m_satIndex.query_radius(areaPos, spaceint_t(fullRateDist / scale), x, y, z, nearby);
+
+        rTickRate.background = nearby.empty();
+    });
+
     return out;
 } // setup_uni_testplanets
 
@@ -312,6 +447,10 @@ Session setup_uni_testplanets(
 struct PlanetDraw
 {
     DrawEntVec_t            drawEnts;
+
+    /// Scratch for CoordTransformer::transform_positions_meters, kept to avoid reallocations
+    std::vector<Vector3>    relativePos;
+
     std::array<DrawEnt, 3>  axis;
     DrawEnt                 attractor;
     MaterialId              matPlanets;
@@ -492,35 +631,40 @@ Session setup_testplanets_draw(
         Vector3 const attractorPos = Vector3(mainToArea.transform_position({0, 0, 0})) * scale;
 
         // Attractor
-        rScnRender.m_drawTransform[rPlanetDraw.attractor]
+        rScnRender.hot[rPlanetDraw.attractor].drawTf
             = Matrix4::translation(attractorPos)
             * Matrix4{mainToAreaRot.toMatrix()}
             * Matrix4::scaling({500, 500, 500});
 
-        rScnRender.m_drawTransform[rPlanetDraw.axis[0]]
+        rScnRender.hot[rPlanetDraw.axis[0]].drawTf
             = Matrix4::translation(attractorPos)
             * Matrix4{mainToAreaRot.toMatrix()}
             * Matrix4::scaling({500000, 10, 10});
-        rScnRender.m_drawTransform[rPlanetDraw.axis[1]]
+        rScnRender.hot[rPlanetDraw.axis[1]].drawTf
             = Matrix4::translation(attractorPos)
             * Matrix4{mainToAreaRot.toMatrix()}
             * Matrix4::scaling({10, 500000, 10});
-        rScnRender.m_drawTransform[rPlanetDraw.axis[2]]
+        rScnRender.hot[rPlanetDraw.axis[2]].drawTf
             = Matrix4::translation(attractorPos)
             * Matrix4{mainToAreaRot.toMatrix()}
             * Matrix4::scaling({10, 10, 500000});
 
+        // One batched pass from the cospace SoA views straight to float meters; the scene-frame
+        // transform and unit scaling are both hoisted inside, so no per-satellite
+        // transform_position / rescale layer remains
+        rPlanetDraw.relativePos.resize(rMainSpace.m_satCount);
+        mainToArea.transform_positions_meters(x, y, z, rMainSpace.m_precision,
+                Corrade::Containers::arrayView(rPlanetDraw.relativePos.data(),
+                                               rPlanetDraw.relativePos.size()));
+
         for (std::size_t i = 0; i < rMainSpace.m_satCount; ++i)
         {
-            Vector3g const relative = mainToArea.transform_position({x[i], y[i], z[i]});
-            Vector3 const relativeMeters = Vector3(relative) * scale;
-
             Quaterniond const rot{{qx[i], qy[i], qz[i]}, qw[i]};
 
             DrawEnt const drawEnt = rPlanetDraw.drawEnts[i];
 
-            rScnRender.m_drawTransform[drawEnt]
-                = Matrix4::translation(relativeMeters)
+            rScnRender.hot[drawEnt].drawTf
+                = Matrix4::translation(rPlanetDraw.relativePos[i])
                 * Matrix4::scaling({200, 200, 200})
                 * Matrix4{(mainToAreaRot * Quaternion{rot}).toMatrix()};
         }
@@ -49,10 +49,14 @@ osp::Session setup_uni_sceneframe(
 
 /**
  * @brief Unrealistic planets test, allows SceneFrame to move around and get captured into planets
+ *
+ * Also flags the scene background through SceneTickRate while no planet is near the scene
+ * frame, and promotes it back to full rate on approach.
  */
 osp::Session setup_uni_testplanets(
         osp::TopTaskBuilder&        rBuilder,
         osp::ArrayView<entt::any>   topData,
+        osp::Session const&         scene,
         osp::Session const&         uniCore,
         osp::Session const&         uniScnFrame);
 
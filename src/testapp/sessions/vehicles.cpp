@@ -88,6 +88,7 @@ Session setup_parts(
     // These Global IDs are dynamically initialized just as the program starts
     bitvector_resize(rUpdMach.machTypesDirty, MachTypeReg_t::size());
     rUpdMach.localDirty       .resize(MachTypeReg_t::size());
+    rUpdMach.localDirtyIds    .resize(MachTypeReg_t::size());
     rScnParts.machines.perType.resize(MachTypeReg_t::size());
     rScnParts.nodePerType     .resize(NodeTypeReg_t::size());
 
@@ -100,8 +101,9 @@ Session setup_parts(
     {
         for (osp::PrefabPair &rPrefabPair : rScnParts.partPrefabs)
         {
-            rResources.owner_destroy(gc_importer, std::move(rPrefabPair.m_importer));
+            rResources.owner_destroy_later(gc_importer, std::move(rPrefabPair.m_importer));
         }
+        rResources.owner_destroy_flush();
     });
 
     rBuilder.task()
@@ -139,6 +141,7 @@ Session setup_parts(
         }
         else
         {
+            rUpdMach.linkPass = 0;
             return TaskAction::Cancel;
         }
     });
@@ -300,6 +303,25 @@ Session setup_vehicle_spawn_vb(
 
         rScnParts.machines.machToLocal.resize(rScnParts.machines.ids.capacity());
 
+        // Bulk-create MachLocalIds per type using machtypeCount gathered above, then hand them
+        // out in order below; one ranged create() and one resize() per type instead of per machine
+        std::vector<std::vector<MachLocalId>> newLocals(MachTypeReg_t::largest());
+        for (MachTypeId type = 0; type < MachTypeReg_t::largest(); ++type)
+        {
+            std::size_t const count = rVSVB.machtypeCount[type];
+            if (count == 0)
+            {
+                continue;
+            }
+
+            PerMachType &rDstPerType = rScnParts.machines.perType[type];
+
+            newLocals[type].resize(count);
+            rDstPerType.localIds.create(newLocals[type].begin(), newLocals[type].end());
+            rDstPerType.localToAny.resize(rDstPerType.localIds.capacity());
+        }
+        std::vector<std::size_t> typeNext(MachTypeReg_t::largest(), 0);
+
         auto itDstMachIds = rVehicleSpawn.spawnedMachs.cbegin();
 
         for (SpVehicleId vhId{0}; vhId.value < newVehicleCount; ++vhId.value)
@@ -314,7 +336,7 @@ Session setup_vehicle_spawn_vb(
 
             std::size_t const remapMachOffset = rVSVB.remapMachOffsets[vhId];
 
-            for (MachAnyId const srcMach : srcMachines.ids.bitview().zeros())
+            for (MachAnyId const srcMach : pVData->m_machsUsed)
             {
                 MachAnyId const dstMach = *itDstMachIds;
                 ++itDstMachIds;
@@ -322,17 +344,13 @@ Session setup_vehicle_spawn_vb(
                 // Populate map for "VehicleBuilder MachAnyId -> ACtxParts MachAnyId"
                 rVSVB.remapMachs[remapMachOffset + srcMach] = dstMach;
 
-                // Create ACtxParts MachLocalIds
+                // Assign ACtxParts MachLocalIds from the per-type batches above
                 // MachLocalIds don't need a remap, since they can be obtained
                 // from a MachAnyId.
-                // TODO: This can be optimized later, where all local IDs are
-                //       created at once with ids.create(first, last), and make
-                //       resize(..) called once per type too
                 MachTypeId const    type            = srcMachines.machTypes[srcMach];
                 PerMachType&        rDstPerType     = rScnParts.machines.perType[type];
 
-                MachLocalId const dstLocal = rDstPerType.localIds.create();
-                rDstPerType.localToAny.resize(rDstPerType.localIds.capacity());
+                MachLocalId const dstLocal = newLocals[type][typeNext[type] ++];
 
                 rDstPerType.localToAny[dstLocal] = dstMach;
                 rScnParts.machines.machToLocal[dstMach] = dstLocal;
@@ -351,6 +369,11 @@ Session setup_vehicle_spawn_vb(
         std::size_t const newVehicleCount = rVehicleSpawn.new_vehicle_count();
         ACtxVehicleSpawnVB const& rVSVB = rVehicleSpawnVB;
 
+        // Reserve for all pending vehicles at once; capacities already cover every new id
+        rScnParts.machineToPart.resize(rScnParts.machines.ids.capacity());
+        rScnParts.partToMachines.ids_reserve(rScnParts.partIds.capacity());
+        rScnParts.partToMachines.data_reserve(rScnParts.machines.ids.capacity());
+
         for (SpVehicleId vhId{0}; vhId.value < newVehicleCount; ++vhId.value)
         {
             VehicleData const* pVData = rVSVB.dataVB[vhId];
@@ -359,15 +382,11 @@ Session setup_vehicle_spawn_vb(
                 continue;
             }
 
-            rScnParts.machineToPart.resize(rScnParts.machines.ids.capacity());
-            rScnParts.partToMachines.ids_reserve(rScnParts.partIds.capacity());
-            rScnParts.partToMachines.data_reserve(rScnParts.machines.ids.capacity());
-
             std::size_t const remapMachOffset = rVSVB.remapMachOffsets[vhId];
             std::size_t const remapPartOffset = rVSVB.remapPartOffsets[vhId];
 
             // Update rScnParts machine->part map
-            for (MachAnyId const srcMach : pVData->m_machines.ids.bitview().zeros())
+            for (MachAnyId const srcMach : pVData->m_machsUsed)
             {
                 MachAnyId const dstMach = rVSVB.remapMachs[remapMachOffset + srcMach];
                 PartId const    srcPart = pVData->m_machToPart[srcMach];
@@ -377,7 +396,7 @@ Session setup_vehicle_spawn_vb(
             }
 
             // Update rScnParts part->machine multimap
-            for (PartId const srcPart : pVData->m_partIds.bitview().zeros())
+            for (PartId const srcPart : pVData->m_partsUsed)
             {
                 PartId const dstPart = rVSVB.remapParts[remapPartOffset + srcPart];
 
@@ -450,12 +469,28 @@ Session setup_vehicle_spawn_vb(
                 auto nodeRemapOut = arrayView(rVSVB.remapNodes).sliceSize(nodeRemapUsed, remapSize);
                 remapNodeOffsets2d[vhId.value][nodeType] = nodeRemapUsed;
                 nodeRemapUsed += remapSize;
-                copy_nodes(rSrcNodeType, pVData->m_machines, machRemap,
+                copy_nodes(rSrcNodeType.m_snapshot, machRemap,
                            rScnParts.nodePerType[nodeType], rScnParts.machines, nodeRemapOut);
             }
         }
     });
 
+    rBuilder.task()
+        .name       ("Rebuild machine ranks and Signal<float> subscriber lists")
+        .run_on     ({tgVhSp.spawnRequest(UseOrRun)})
+        .sync_with  ({tgParts.connect(Ready)})
+        .push_to    (out.m_tasks)
+        .args       ({         idScnParts,                idUpdMach,                   idSigSubsFloat})
+        .func([] (ACtxParts const& rScnParts, MachineUpdater& rUpdMach, SignalSubscribers& rSigSubsFloat) noexcept
+    {
+        uint8_t const rankCount = build_machine_ranks(
+                rScnParts.machines, rScnParts.nodePerType, rUpdMach.machRank);
+        rUpdMach.machDeferred.resize(rankCount);
+
+        build_signal_subscribers(rScnParts.nodePerType[gc_ntSigFloat],
+                                 rScnParts.machines, rUpdMach.machRank, rSigSubsFloat);
+    });
+
     rBuilder.task()
         .name       ("Update PartId<->ActiveEnt mapping")
         .run_on     ({tgVhSp.spawnRequest(UseOrRun)})
@@ -487,12 +522,15 @@ Session setup_vehicle_spawn_vb(
         .sync_with  ({tgVhSp.spawnedParts(UseOrRun), tgVhSpVB.remapNodes(UseOrRun), tgSgFlt.sigFloatValues(New), tgSgFlt.sigFloatUpdExtIn(New)})
         .push_to    (out.m_tasks)
         .args       ({             idVehicleSpawn,                          idVehicleSpawnVB,           idScnParts,                       idSigValFloat,                    idSigUpdFloat})
-        .func([] (ACtxVehicleSpawn& rVehicleSpawn, ACtxVehicleSpawnVB const& rVehicleSpawnVB, ACtxParts& rScnParts, SignalValues_t<float>& rSigValFloat, UpdateNodes<float>& rSigUpdFloat) noexcept
+        .func([] (ACtxVehicleSpawn& rVehicleSpawn, ACtxVehicleSpawnVB const& rVehicleSpawnVB, ACtxParts& rScnParts, SignalValues_t<float>& rSigValFloat, UpdateNodesStaged<float>& rSigUpdFloat) noexcept
     {
         Nodes const         &rFloatNodes    = rScnParts.nodePerType[gc_ntSigFloat];
         std::size_t const   maxNodes        = rFloatNodes.nodeIds.capacity();
-        rSigUpdFloat.nodeNewValues.resize(maxNodes);
-        bitvector_resize(rSigUpdFloat.nodeDirty, maxNodes);
+        for (UpdateNodes<float> &rSlot : rSigUpdFloat.perType)
+        {
+            rSlot.nodeNewValues.resize(maxNodes);
+            bitvector_resize(rSlot.nodeDirty, maxNodes);
+        }
         rSigValFloat.resize(maxNodes);
 
         std::size_t const           newVehicleCount     = rVehicleSpawn.new_vehicle_count();
@@ -513,7 +551,7 @@ Session setup_vehicle_spawn_vb(
             std::size_t const   nodeRemapOffset     = remapNodeOffsets2d[vhId.value][gc_ntSigFloat];
             auto const          nodeRemap           = arrayView(rVSVB.remapNodes).exceptPrefix(nodeRemapOffset);
 
-            for (NodeId const srcNode : srcFloatNodes.nodeIds.bitview().zeros())
+            for (NodeId const srcNode : srcFloatNodes.m_nodesUsed)
             {
                 NodeId const dstNode = nodeRemap[srcNode];
                 rSigValFloat[dstNode] = srcFloatValues[srcNode];
@@ -574,25 +612,31 @@ Session setup_signals_float(
     rBuilder.pipeline(tgSgFlt.sigFloatUpdLoop)  .parent(tgParts.linkLoop);
 
     top_emplace< SignalValues_t<float> >    (topData, idSigValFloat);
-    top_emplace< UpdateNodes<float> >       (topData, idSigUpdFloat);
+    auto &rSigUpd = top_emplace< UpdateNodesStaged<float> > (topData, idSigUpdFloat);
+    top_emplace< SignalSubscribers >        (topData, idSigSubsFloat);
 
-    // NOTE: Consider supporting per-thread UpdateNodes<float> to allow multiple threads to write
-    //       new float values in parallel.
+    // Each machine type stages new values into its own slot, so update tasks
+    // of independent types can run in parallel once the executor is threaded
+    rSigUpd.perType.resize(MachTypeReg_t::size());
 
     rBuilder.task()
         .name       ("Update Signal<float> Nodes")
         .run_on     ({tgParts.linkLoop(EStgLink::NodeUpd)})
         .sync_with  ({tgSgFlt.sigFloatUpdExtIn(Ready), tgParts.machUpdExtIn(Ready), tgSgFlt.sigFloatUpdLoop(Modify), tgSgFlt.sigFloatValues(Modify)})
         .push_to    (out.m_tasks)
-        .args       ({               idSigUpdFloat,                       idSigValFloat,                idUpdMach,                 idScnParts})
-        .func([] (UpdateNodes<float>& rSigUpdFloat, SignalValues_t<float>& rSigValFloat, MachineUpdater& rUpdMach, ACtxParts const& rScnParts) noexcept
+        .args       ({               idSigUpdFloat,                       idSigValFloat,                    idSigSubsFloat,                idUpdMach})
+        .func([] (UpdateNodesStaged<float>& rSigUpdFloat, SignalValues_t<float>& rSigValFloat, SignalSubscribers& rSigSubsFloat, MachineUpdater& rUpdMach) noexcept
     {
-        if ( ! rSigUpdFloat.dirty )
+        bool deferredPending = false;
+        for (std::vector<MachinePair> const& rBatch : rUpdMach.machDeferred)
         {
-            return; // Not dirty, nothing to do
+            deferredPending = deferredPending || ( ! rBatch.empty() );
         }
 
-        Nodes const &rFloatNodes = rScnParts.nodePerType[gc_ntSigFloat];
+        if ( ! rSigUpdFloat.any_dirty() && ! deferredPending )
+        {
+            return; // Not dirty, nothing to do
+        }
 
         // NOTE: The various use of reset() clear entire bit arrays, which may or may
         //       not be expensive. They likely optimize to memset
@@ -603,17 +647,53 @@ Session setup_signals_float(
         }
         rUpdMach.machTypesDirty.reset();
 
+        // Release machines whose deferred-to settling pass has arrived
+        uint8_t const pass = rUpdMach.linkPass;
+        if (pass < rUpdMach.machDeferred.size())
+        {
+            for (MachinePair const pair : rUpdMach.machDeferred[pass])
+            {
+                rUpdMach.machTypesDirty.set(pair.type);
+                rUpdMach.localDirty[pair.type].set(pair.local);
+            }
+            rUpdMach.machDeferred[pass].clear();
+        }
+
         // Sees which nodes changed, and writes into rUpdMach set dirty which MACHINES
-        // must be updated next
-        update_signal_nodes<float>(
-                rSigUpdFloat.nodeDirty.ones(),
-                rFloatNodes.nodeToMach,
-                rScnParts.machines,
-                arrayView(rSigUpdFloat.nodeNewValues),
-                rSigValFloat,
-                rUpdMach);
-        rSigUpdFloat.nodeDirty.reset();
-        rSigUpdFloat.dirty = false;
+        // must be updated next. Merge each machine type's staging slot into
+        // the published values, then advance the read generation
+        for (UpdateNodes<float> &rSlot : rSigUpdFloat.perType)
+        {
+            if ( ! rSlot.dirty )
+            {
+                continue;
+            }
+
+            update_signal_nodes<float>(
+                    rSlot.nodeDirty.ones(),
+                    rSigSubsFloat,
+                    arrayView(rSlot.nodeNewValues),
+                    rSigValFloat,
+                    rUpdMach);
+            rSlot.nodeDirty.reset();
+            rSlot.dirty = false;
+        }
+        ++rSigUpdFloat.readGen;
+
+        if (rUpdMach.linkPass != 255)
+        {
+            ++rUpdMach.linkPass;
+        }
+
+        // Keep looping while machines wait on later passes
+        for (std::vector<MachinePair> const& rBatch : rUpdMach.machDeferred)
+        {
+            if ( ! rBatch.empty() )
+            {
+                rUpdMach.requestMachineUpdateLoop.store(true);
+                break;
+            }
+        }
 
         // Run tasks needed to update machine types that are dirty
         bool anyMachineNotified = false;
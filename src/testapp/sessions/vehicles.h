@@ -48,7 +48,8 @@ osp::Session setup_parts(
  *
  * Passing values:
  *
- * 1. Tasks write new values to idSigUpdFloat
+ * 1. Tasks write new values to their machine type's staging slot in
+ *    idSigUpdFloat; independent types never share a write buffer
  *
  * 2. The "Reduce Signal-Float Nodes" task reads new values from idSigUpdFloat(s) and writes them
  *    into idSigValFloat. This changes the input values of connected Machines, marking them dirty.
@@ -93,7 +94,8 @@ osp::Session setup_mach_rcsdriver(
         osp::ArrayView<entt::any>   topData,
         osp::Session const&         scene,
         osp::Session const&         parts,
-        osp::Session const&         signalsFloat);
+        osp::Session const&         signalsFloat,
+        osp::Session const&         vehicleSpawn);
 
 /**
  * @brief Logic and queues for spawning vehicles
@@ -188,10 +188,10 @@ Session setup_thrust_indicators(
                 rMat.m_dirty.push_back(drawEnt);
             }
 
-            MeshIdOwner_t &rMeshOwner = rScnRender.m_mesh[drawEnt];
+            MeshIdOwner_t &rMeshOwner = rScnRender.hot[drawEnt].mesh;
             if ( ! rMeshOwner.has_value() )
             {
-                rScnRender.m_mesh[drawEnt] = rDrawing.m_meshRefCounts.ref_add(rThrustIndicator.mesh.value());
+                rScnRender.hot[drawEnt].mesh = rDrawing.m_meshRefCounts.ref_add(rThrustIndicator.mesh.value());
                 rScnRender.m_meshDirty.push_back(drawEnt);
             }
 
@@ -236,7 +236,7 @@ Session setup_thrust_indicators(
             float const     multiplier      = rSigValFloat[multiplierIn];
             float const     thrustMag       = throttle * multiplier;
 
-            rCtxScnRdr.m_drawTransform[drawEnt]
+            rCtxScnRdr.hot[drawEnt].drawTf
                     = drawTf
                     * Matrix4::scaling({1.0f, 1.0f, thrustMag * rThrustIndicator.indicatorScale})
                     * Matrix4::translation({0.0f, 0.0f, -1.0f})
@@ -265,14 +265,19 @@ Session setup_mach_rcsdriver(
         ArrayView<entt::any> const  topData,
         Session const&              scene,
         Session const&              parts,
-        Session const&              signalsFloat)
+        Session const&              signalsFloat,
+        Session const&              vehicleSpawn)
 {
     OSP_DECLARE_GET_DATA_IDS(signalsFloat,  TESTAPP_DATA_SIGNALS_FLOAT)
     OSP_DECLARE_GET_DATA_IDS(parts,         TESTAPP_DATA_PARTS);
+    OSP_DECLARE_GET_DATA_IDS(vehicleSpawn,  TESTAPP_DATA_VEHICLE_SPAWN);
     auto const tgScn    = scene         .get_pipelines<PlScene>();
     auto const tgParts  = parts         .get_pipelines<PlParts>();
+    auto const tgVhSp   = vehicleSpawn  .get_pipelines<PlVehicleSpawn>();
 
     Session out;
+    auto const [idRcsPorts] = out.acquire_data<1>(topData);
+    top_emplace< SignalPortTable >(topData, idRcsPorts);
 
     rBuilder.task()
         .name       ("Allocate Machine update bitset for RcsDriver")
@@ -285,68 +290,36 @@ Session setup_mach_rcsdriver(
         rUpdMach.localDirty[gc_mtRcsDriver].ints().resize(rScnParts.machines.perType[gc_mtRcsDriver].localIds.vec().capacity());
     });
 
+    rBuilder.task()
+        .name       ("Rebuild RcsDriver port table")
+        .run_on     ({tgVhSp.spawnRequest(UseOrRun)})
+        .sync_with  ({tgParts.connect(Ready)})
+        .push_to    (out.m_tasks)
+        .args       ({         idScnParts,                  idRcsPorts})
+        .func([] (ACtxParts const& rScnParts, SignalPortTable& rRcsPorts) noexcept
+    {
+        build_signal_port_table(rScnParts.nodePerType[gc_ntSigFloat], rScnParts.machines,
+                                gc_mtRcsDriver, ports_rcsdriver::gc_portCount, rRcsPorts);
+    });
+
     rBuilder.task()
         .name       ("RCS Drivers calculate new values")
         .run_on     ({tgParts.linkLoop(MachUpd)})
         .sync_with  ({tgParts.machUpdExtIn(Ready)})
         .push_to    (out.m_tasks)
-        .args       ({      idScnParts,                idUpdMach,                       idSigValFloat,                    idSigUpdFloat})
-        .func([] (ACtxParts& rScnParts, MachineUpdater& rUpdMach, SignalValues_t<float>& rSigValFloat, UpdateNodes<float>& rSigUpdFloat) noexcept
+        .args       ({               idUpdMach,                         idRcsPorts,                       idSigValFloat,                    idSigUpdFloat})
+        .func([] (MachineUpdater& rUpdMach, SignalPortTable const& rRcsPorts, SignalValues_t<float>& rSigValFloat, UpdateNodesStaged<float>& rSigUpdFloat) noexcept
     {
-        Nodes const &rFloatNodes = rScnParts.nodePerType[gc_ntSigFloat];
-        PerMachType &rRockets    = rScnParts.machines.perType[gc_mtRcsDriver];
-
-        for (MachLocalId const local : rUpdMach.localDirty[gc_mtRcsDriver].ones())
+        // Gather dirty bits into a contiguous span, then run the batch kernel
+        // over all dirty machines in one loop. New values go into this
+        // machine type's own staging slot, so other types can run in parallel
+        ArrayView<MachLocalId const> const toUpdate
+                = batch_dirty_machines(rUpdMach, gc_mtRcsDriver);
+
+        if (update_rcsdrivers(toUpdate, rRcsPorts, rSigValFloat,
+                              rSigUpdFloat.perType[gc_mtRcsDriver]))
         {
-            MachAnyId const mach     = rRockets.localToAny[local];
-            auto const      portSpan = lgrn::Span<NodeId const>{rFloatNodes.machToNode[mach]};
-
-            NodeId const thrNode = connected_node(portSpan, ports_rcsdriver::gc_throttleOut.port);
-            if (thrNode == lgrn::id_null<NodeId>())
-            {
-                continue; // Throttle Output not connected, calculations below are useless
-            }
-
-            auto const rcs_read = [&rSigValFloat, portSpan] (float& rDstVar, PortEntry const& entry)
-            {
-                NodeId const node = connected_node(portSpan, entry.port);
-
-                if (node != lgrn::id_null<NodeId>())
-                {
-                    rDstVar = rSigValFloat[node];
-                }
-            };
-
-            Vector3 pos     {0.0f};
-            Vector3 dir     {0.0f};
-            Vector3 cmdLin  {0.0f};
-            Vector3 cmdAng  {0.0f};
-
-            rcs_read( pos.x(),    ports_rcsdriver::gc_posXIn    );
-            rcs_read( pos.y(),    ports_rcsdriver::gc_posYIn    );
-            rcs_read( pos.z(),    ports_rcsdriver::gc_posZIn    );
-            rcs_read( dir.x(),    ports_rcsdriver::gc_dirXIn    );
-            rcs_read( dir.y(),    ports_rcsdriver::gc_dirYIn    );
-            rcs_read( dir.z(),    ports_rcsdriver::gc_dirZIn    );
-            rcs_read( cmdLin.x(), ports_rcsdriver::gc_cmdLinXIn );
-            rcs_read( cmdLin.y(), ports_rcsdriver::gc_cmdLinYIn );
-            rcs_read( cmdLin.z(), ports_rcsdriver::gc_cmdLinZIn );
-            rcs_read( cmdAng.x(), ports_rcsdriver::gc_cmdAngXIn );
-            rcs_read( cmdAng.y(), ports_rcsdriver::gc_cmdAngYIn );
-            rcs_read( cmdAng.z(), ports_rcsdriver::gc_cmdAngZIn );
-
-            OSP_LOG_TRACE("RCS controller {} pitch = {}", local, cmdAng.x());
-            OSP_LOG_TRACE("RCS controller {} yaw = {}", local, cmdAng.y());
-            OSP_LOG_TRACE("RCS controller {} roll = {}", local, cmdAng.z());
-
-            float const thrCurr = rSigValFloat[thrNode];
-            float const thrNew = thruster_influence(pos, dir, cmdLin, cmdAng);
-
-            if (thrCurr != thrNew)
-            {
-                rSigUpdFloat.assign(thrNode, thrNew);
-                rUpdMach.requestMachineUpdateLoop = true;
-            }
+            rUpdMach.requestMachineUpdateLoop = true;
         }
     });
 
@@ -455,8 +428,9 @@ Session setup_vehicle_control(
         .sync_with  ({tgWin.inputs(Run), tgSgFlt.sigFloatUpdExtIn(Modify)})
         .push_to    (out.m_tasks)
         .args       ({      idScnParts,                idUpdMach,                       idSigValFloat,                    idSigUpdFloat,                               idUserInput,                 idVhControls,           idDeltaTimeIn})
-        .func([] (ACtxParts& rScnParts, MachineUpdater& rUpdMach, SignalValues_t<float>& rSigValFloat, UpdateNodes<float>& rSigUpdFloat, input::UserInputHandler const& rUserInput, VehicleControls& rVhControls, float const deltaTimeIn) noexcept
+        .func([] (ACtxParts& rScnParts, MachineUpdater& rUpdMach, SignalValues_t<float>& rSigValFloat, UpdateNodesStaged<float>& rSigUpdStaged, input::UserInputHandler const& rUserInput, VehicleControls& rVhControls, float const deltaTimeIn) noexcept
     {
+        UpdateNodes<float> &rSigUpdFloat = rSigUpdStaged.perType[gc_mtUserCtrl];
         VehicleControls& rVC = rVhControls;
         auto const held = [&rUserInput] (input::EButtonControlIndex idx, float val) -> float
         {
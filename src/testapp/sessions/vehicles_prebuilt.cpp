@@ -24,9 +24,11 @@
  */
 #include "vehicles_prebuilt.h"
 
+#include <adera/activescene/vehicle_blueprint.h>
 #include <adera/machines/links.h>
 
 #include <osp/core/Resources.h>
+#include <osp/util/logging.h>
 
 using namespace adera;
 
@@ -129,8 +131,60 @@ Session setup_prebuilt_vehicles(
     auto &rPrebuiltVehicles = top_emplace<PrebuiltVehicles>(topData, idPrebuiltVehicles);
     rPrebuiltVehicles.resize(PrebuiltVhIdReg_t::size());
 
+    rBuilder.task()
+        .name       ("Clean up prebuilt vehicles")
+        .run_on     ({tgScn.cleanup(Run_)})
+        .push_to    (out.m_tasks)
+        .args       ({             idPrebuiltVehicles,          idResources})
+        .func([] (PrebuiltVehicles &rPrebuildVehicles, Resources& rResources) noexcept
+    {
+        for (std::unique_ptr<VehicleData> &rpData : rPrebuildVehicles)
+        {
+            if (rpData != nullptr)
+            {
+                for (PrefabPair &rPrefabPair : rpData->m_partPrefabs)
+                {
+                    rResources.owner_destroy_later(gc_importer, std::move(rPrefabPair.m_importer));
+                }
+            }
+        }
+        rResources.owner_destroy_flush();
+        rPrebuildVehicles.clear();
+    });
+
+    return out;
+} // setup_prebuilt_vehicles
+
+void initialize_prebuilt_vehicles(
+        ArrayView<entt::any> const  topData,
+        Session const&              application,
+        Session const&              testVehicles)
+{
+    OSP_DECLARE_GET_DATA_IDS(application,   TESTAPP_DATA_APPLICATION);
+    OSP_DECLARE_GET_DATA_IDS(testVehicles,  TESTAPP_DATA_TEST_VEHICLES);
+
+    auto &rResources        = top_get<Resources>        (topData, idResources);
+    auto &rPrebuiltVehicles = top_get<PrebuiltVehicles> (topData, idPrebuiltVehicles);
+
     using namespace adera;
 
+    // Cached blueprints from a previous launch load in one pass, skipping all of the
+    // builder assembly below. Bump the revision whenever the vehicle designs here change,
+    // so stale files rebuild instead of loading.
+    constexpr std::uint32_t blueprintRevision = 1;
+    constexpr std::string_view blueprintPath = "OSPData/adera/vehicles.ospvhb";
+
+    if (auto loaded = load_vehicle_blueprints(blueprintPath, blueprintRevision, rResources);
+        loaded.size() == rPrebuiltVehicles.size())
+    {
+        for (std::size_t i = 0; i < loaded.size(); ++i)
+        {
+            rPrebuiltVehicles[PrebuiltVhId(i)] = std::move(loaded[i]);
+        }
+        OSP_LOG_INFO("Loaded prebuilt vehicles from {}", blueprintPath);
+        return;
+    }
+
     // Build "PartVehicle"
     {
         VehicleBuilder vbuilder{&rResources};
@@ -202,29 +256,12 @@ Session setup_prebuilt_vehicles(
 
     // Put more prebuilt vehicles here!
 
+    // Export for the next launch
+    write_vehicle_blueprints(blueprintPath, blueprintRevision,
+                             osp::arrayView(rPrebuiltVehicles.data(), rPrebuiltVehicles.size()),
+                             rResources);
 
-    rBuilder.task()
-        .name       ("Clean up prebuilt vehicles")
-        .run_on     ({tgScn.cleanup(Run_)})
-        .push_to    (out.m_tasks)
-        .args       ({             idPrebuiltVehicles,          idResources})
-        .func([] (PrebuiltVehicles &rPrebuildVehicles, Resources& rResources) noexcept
-    {
-        for (std::unique_ptr<VehicleData> &rpData : rPrebuildVehicles)
-        {
-            if (rpData != nullptr)
-            {
-                for (PrefabPair &rPrefabPair : rpData->m_partPrefabs)
-                {
-                    rResources.owner_destroy(gc_importer, std::move(rPrefabPair.m_importer));
-                }
-            }
-        }
-        rPrebuildVehicles.clear();
-    });
-
-    return out;
-} // setup_prebuilt_vehicles
+} // initialize_prebuilt_vehicles
 
 
 } // namespace testapp::scenes
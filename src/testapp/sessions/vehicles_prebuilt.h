@@ -55,5 +55,17 @@ osp::Session setup_prebuilt_vehicles(
         osp::Session const&         application,
         osp::Session const&         scene);
 
+/**
+ * @brief Build the prebuilt vehicle data itself; heaviest part of vehicle scenario entry
+ *
+ * Split from setup_prebuilt_vehicles so scenarios can run it on a worker thread overlapped
+ * with other session setup. It writes only its own TopData slot and Resources, so it may
+ * run concurrently with any setup that touches neither.
+ */
+void initialize_prebuilt_vehicles(
+        osp::ArrayView<entt::any>   topData,
+        osp::Session const&         application,
+        osp::Session const&         testVehicles);
+
 
 } // namespace testapp::scenes
@@ -123,32 +123,24 @@ void TestApp::clear_resource_owners()
         auto * const pData = rResources.data_try_get<osp::TextureImgSource>(gc_texture, id);
         if (pData != nullptr)
         {
-            rResources.owner_destroy(gc_image, std::move(*pData));
+            rResources.owner_destroy_later(gc_image, std::move(*pData));
         }
     });
 
-    // Importer data own a lot of other resources
+    // Importer data own a lot of other resources; their owners are contiguous,
+    // so release each vector in one batch
     resource_for_each_type(gc_importer, rResources, [&rResources] (osp::ResId const id)
     {
         auto * const pData = rResources.data_try_get<osp::ImporterData>(gc_importer, id);
         if (pData != nullptr)
         {
-            for (osp::ResIdOwner_t &rOwner : std::move(pData->m_images))
-            {
-                rResources.owner_destroy(gc_image, std::move(rOwner));
-            }
-
-            for (osp::ResIdOwner_t &rOwner : std::move(pData->m_textures))
-            {
-                rResources.owner_destroy(gc_texture, std::move(rOwner));
-            }
-
-            for (osp::ResIdOwner_t &rOwner : std::move(pData->m_meshes))
-            {
-                rResources.owner_destroy(gc_mesh, std::move(rOwner));
-            }
+            rResources.owner_destroy_n(gc_image,   osp::arrayView(pData->m_images.data(),   pData->m_images.size()));
+            rResources.owner_destroy_n(gc_texture, osp::arrayView(pData->m_textures.data(), pData->m_textures.size()));
+            rResources.owner_destroy_n(gc_mesh,    osp::arrayView(pData->m_meshes.data(),   pData->m_meshes.size()));
         }
     });
+
+    rResources.owner_destroy_flush();
 }
 
 
@@ -158,7 +150,14 @@ void TestApp::clear_resource_owners()
 void SingleThreadedExecutor::load(TestAppTasks& rAppTasks)
 {
     osp::exec_conform(rAppTasks.m_tasks, m_execContext);
+    osp::top_resolve_task_args(rAppTasks.m_tasks, rAppTasks.m_taskData, rAppTasks.m_topData);
     m_execContext.doLogging = m_log != nullptr;
+
+    if (m_stallThreshold.count() != 0)
+    {
+        m_stallWatchdog.start(rAppTasks.m_tasks, rAppTasks.m_taskData, rAppTasks.m_graph,
+                              m_execContext, m_stallThreshold);
+    }
 }
 
 void SingleThreadedExecutor::run(TestAppTasks& rAppTasks, osp::PipelineId pipeline)
@@ -184,6 +183,8 @@ void SingleThreadedExecutor::wait(TestAppTasks& rAppTasks)
     osp::exec_update(rAppTasks.m_tasks, rAppTasks.m_graph, m_execContext);
     osp::top_run_blocking(rAppTasks.m_tasks, rAppTasks.m_graph, rAppTasks.m_taskData, rAppTasks.m_topData, m_execContext);
 
+    osp::frame_budget_update(rAppTasks.m_tasks, m_execContext, rAppTasks.m_frameBudget);
+
     if (m_log != nullptr)
     {
         m_log->info("\n>>>>>>>>>> New State Changes\n{}",
@@ -197,5 +198,11 @@ bool SingleThreadedExecutor::is_running(TestAppTasks const& appTasks)
     return m_execContext.hasRequestRun || (m_execContext.pipelinesRunning != 0);
 }
 
+void SingleThreadedExecutor::sample_queue_depths(std::uint32_t &rQueued, std::uint32_t &rBlocked)
+{
+    rQueued  = std::uint32_t(m_execContext.tasksQueuedRun.size());
+    rBlocked = std::uint32_t(m_execContext.tasksQueuedBlocked.size());
+}
+
 
 } // namespace testapp
@@ -25,14 +25,19 @@
 #pragma once
 
 #include <osp/core/keyed_vector.h>
+#include <osp/core/mem_census.h>
 #include <osp/core/resourcetypes.h>
+#include <osp/tasks/budget.h>
 #include <osp/tasks/tasks.h>
 #include <osp/tasks/top_execute.h>
 #include <osp/tasks/top_session.h>
 #include <osp/util/logging.h>
+#include <osp/util/perf_stats.h>
 
 #include <entt/core/any.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <optional>
 
 namespace testapp
@@ -43,6 +48,7 @@ class IExecutor;
 
 using RendererSetupFunc_t   = void(*)(TestApp&);
 using SceneSetupFunc_t      = RendererSetupFunc_t(*)(TestApp&);
+using SceneSnapshotFunc_t   = bool(*)(TestApp&);
 
 struct TestAppTasks
 {
@@ -50,6 +56,18 @@ struct TestAppTasks
     osp::Tasks                      m_tasks;
     osp::TopTaskDataVec_t           m_taskData;
     osp::TaskGraph                  m_graph;
+
+    /// Frame-time governor; updated by the executor each frame, scenarios register
+    /// listeners to trade detail for time when over budget
+    osp::FrameBudget                m_frameBudget;
+
+    /// Per-subsystem memory census; scenarios register footprint tags for their major
+    /// contexts, sampled periodically by the main loop
+    osp::MemCensus                  m_memCensus;
+
+    /// Latest frame statistics, published by the render loop and shown by the performance
+    /// HUD; also readable from the CLI thread without blocking the frame
+    osp::PerfStatsMailbox           m_perfStats;
 };
 
 struct TestApp : TestAppTasks
@@ -74,6 +92,11 @@ struct TestApp : TestAppTasks
 
     RendererSetupFunc_t             m_rendererSetup { nullptr };
 
+    /// Set by scenarios supporting warm boot. Writes the running scene's state to the
+    /// scenario's snapshot file, so the next entry restores it instead of cold-booting;
+    /// called by main when the application closes, while scene sessions are still alive
+    SceneSnapshotFunc_t             m_sceneSnapshotWrite { nullptr };
+
     IExecutor                       *m_pExecutor { nullptr };
 
     osp::PkgId                      m_defaultPkg    { lgrn::id_null<osp::PkgId>() };
@@ -92,6 +115,13 @@ public:
     virtual void wait(TestAppTasks& rAppTasks) = 0;
 
     virtual bool is_running(TestAppTasks const& rAppTasks) = 0;
+
+    /// Current task queue depths for the performance HUD; call between frames
+    virtual void sample_queue_depths(std::uint32_t &rQueued, std::uint32_t &rBlocked)
+    {
+        rQueued  = 0;
+        rBlocked = 0;
+    }
 };
 
 //-----------------------------------------------------------------------------
@@ -109,8 +139,15 @@ public:
 
     bool is_running(TestAppTasks const& rAppTasks) override;
 
+    void sample_queue_depths(std::uint32_t &rQueued, std::uint32_t &rBlocked) override;
+
     osp::ExecContext                m_execContext;
     std::shared_ptr<spdlog::logger> m_log;
+
+    /// Nonzero starts a background watchdog on load() that reports any pipeline which hasn't
+    /// advanced within this threshold, along with the dependency chain blocking it
+    std::chrono::milliseconds       m_stallThreshold { 0 };
+    osp::ExecStallWatchdog          m_stallWatchdog;
 };
 
 } // namespace testapp
@@ -0,0 +1,474 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Link graph update micro-benchmarks: procedurally generates vehicles of parameterized
+// size and fan-out with VehicleBuilder, spawns copies through copy_machines/copy_nodes the
+// same way the vehicle spawn tasks do, then runs the link update loop from
+// sessions/vehicles.cpp and sessions/vehicles_machines.cpp headlessly every step. Signal
+// propagation cost varies wildly with topology, so three classes are covered: one output
+// fanned out to many sinks, deep RcsDriver chains settling across ranked passes, and a
+// width x depth grid mixing both. Stimulus values alternate each step so every step
+// propagates through the whole graph. Reports per-machine-update nanoseconds.
+
+#include <adera/activescene/VehicleBuilder.h>
+#include <adera/machines/links.h>
+
+#include <osp/core/Resources.h>
+#include <osp/link/machines.h>
+#include <osp/link/signal.h>
+
+#include <Corrade/Containers/ArrayViewStl.h>
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+using namespace adera;
+using namespace osp;
+using namespace osp::link;
+
+namespace
+{
+
+/**
+ * Scene-side link state; the subset of ACtxParts and the signals-float session the link
+ * update loop reads and writes
+ */
+struct LinkCtx
+{
+    Machines                        machines;
+    KeyedVec<NodeTypeId, Nodes>     nodePerType;
+    MachineUpdater                  updMach;
+
+    SignalValues_t<float>           sigValFloat;
+    UpdateNodesStaged<float>        sigUpdFloat;
+    SignalSubscribers               sigSubsFloat;
+    SignalPortTable                 rcsPorts;
+
+    /// Scene NodeIds of every spawned copy's UserCtrl output nodes, stimulus targets
+    std::vector<NodeId>             ctrlNodes;
+
+    std::size_t                     machineUpdates  {0};
+    std::size_t                     settlingPasses  {0};
+    float                           checksum        {0.0f};
+};
+
+/**
+ * A built vehicle plus the builder-side node to poke with external input
+ */
+struct GeneratedVehicle
+{
+    VehicleData data;
+    NodeId      ctrlNode { lgrn::id_null<NodeId>() };
+};
+
+/**
+ * Copy a built vehicle into the scene-side link graph; same copy_machines/copy_nodes and
+ * float-value copy the vehicle spawn tasks perform
+ */
+void spawn_vehicle(LinkCtx &rCtx, GeneratedVehicle const &vehicle)
+{
+    VehicleData const &data = vehicle.data;
+
+    std::vector<MachAnyId> remapMach(data.m_machines.ids.capacity(),
+                                     lgrn::id_null<MachAnyId>());
+    copy_machines(data.m_machines, rCtx.machines, remapMach);
+
+    for (NodeTypeId nodeType = 0; std::size_t(nodeType) < NodeTypeReg_t::size(); ++nodeType)
+    {
+        PerNodeType const &rSrcNodeType = data.m_nodePerType[nodeType];
+
+        std::vector<NodeId> remapNode(rSrcNodeType.nodeIds.capacity(),
+                                      lgrn::id_null<NodeId>());
+        copy_nodes(rSrcNodeType.m_snapshot, remapMach,
+                   rCtx.nodePerType[nodeType], rCtx.machines, remapNode);
+
+        if (nodeType != gc_ntSigFloat)
+        {
+            continue;
+        }
+
+        // Copy initial float signal values set through VehicleBuilder::node_values
+        rCtx.sigValFloat.resize(rCtx.nodePerType[gc_ntSigFloat].nodeIds.capacity());
+
+        auto const& srcFloatValues
+                = entt::any_cast< SignalValues_t<float> >(rSrcNodeType.m_nodeValues);
+        for (NodeId const srcNode : rSrcNodeType.nodeIds.bitview().zeros())
+        {
+            rCtx.sigValFloat[remapNode[srcNode]] = srcFloatValues[srcNode];
+        }
+
+        rCtx.ctrlNodes.push_back(remapNode[vehicle.ctrlNode]);
+    }
+}
+
+/**
+ * Post-spawn setup; what setup_parts, the per-machine-type allocate tasks, and the
+ * "Rebuild machine ranks" spawn task do
+ */
+void finish_setup(LinkCtx &rCtx)
+{
+    MachineUpdater &rUpdMach = rCtx.updMach;
+
+    bitvector_resize(rUpdMach.machTypesDirty, MachTypeReg_t::size());
+    rUpdMach.localDirty   .resize(MachTypeReg_t::size());
+    rUpdMach.localDirtyIds.resize(MachTypeReg_t::size());
+    for (MachTypeId type = 0; std::size_t(type) < MachTypeReg_t::size(); ++type)
+    {
+        rUpdMach.localDirty[type].ints().resize(
+                rCtx.machines.perType[type].localIds.vec().capacity());
+    }
+
+    uint8_t const rankCount = build_machine_ranks(
+            rCtx.machines, rCtx.nodePerType, rUpdMach.machRank);
+    rUpdMach.machDeferred.resize(rankCount);
+
+    build_signal_subscribers(rCtx.nodePerType[gc_ntSigFloat],
+                             rCtx.machines, rUpdMach.machRank, rCtx.sigSubsFloat);
+    build_signal_port_table(rCtx.nodePerType[gc_ntSigFloat], rCtx.machines,
+                            gc_mtRcsDriver, ports_rcsdriver::gc_portCount, rCtx.rcsPorts);
+
+    std::size_t const maxNodes = rCtx.nodePerType[gc_ntSigFloat].nodeIds.capacity();
+    rCtx.sigValFloat.resize(maxNodes);
+    rCtx.sigUpdFloat.perType.resize(MachTypeReg_t::size());
+    for (UpdateNodes<float> &rSlot : rCtx.sigUpdFloat.perType)
+    {
+        rSlot.nodeNewValues.resize(maxNodes);
+        bitvector_resize(rSlot.nodeDirty, maxNodes);
+    }
+}
+
+/**
+ * One frame's link update loop; same bodies as the "Update Signal<float> Nodes" task and
+ * the machine update tasks, looping on requestMachineUpdateLoop like the scheduler does
+ */
+void link_update(LinkCtx &rCtx)
+{
+    MachineUpdater              &rUpdMach     = rCtx.updMach;
+    UpdateNodesStaged<float>    &rSigUpdFloat = rCtx.sigUpdFloat;
+    Nodes const                 &rFloatNodes  = rCtx.nodePerType[gc_ntSigFloat];
+
+    rUpdMach.linkPass = 0;
+
+    while (rUpdMach.requestMachineUpdateLoop.exchange(false))
+    {
+        ++ rCtx.settlingPasses;
+
+        // ## Update Signal<float> Nodes
+
+        for (std::size_t const machTypeDirty : rUpdMach.machTypesDirty.ones())
+        {
+            rUpdMach.localDirty[machTypeDirty].reset();
+        }
+        rUpdMach.machTypesDirty.reset();
+
+        // Release machines whose deferred-to settling pass has arrived
+        uint8_t const pass = rUpdMach.linkPass;
+        if (pass < rUpdMach.machDeferred.size())
+        {
+            for (MachinePair const pair : rUpdMach.machDeferred[pass])
+            {
+                rUpdMach.machTypesDirty.set(pair.type);
+                rUpdMach.localDirty[pair.type].set(pair.local);
+            }
+            rUpdMach.machDeferred[pass].clear();
+        }
+
+        for (UpdateNodes<float> &rSlot : rSigUpdFloat.perType)
+        {
+            if ( ! rSlot.dirty )
+            {
+                continue;
+            }
+
+            update_signal_nodes<float>(
+                    rSlot.nodeDirty.ones(),
+                    rCtx.sigSubsFloat,
+                    arrayView(std::as_const(rSlot.nodeNewValues)),
+                    arrayView(rCtx.sigValFloat),
+                    rUpdMach);
+            rSlot.nodeDirty.reset();
+            rSlot.dirty = false;
+        }
+        ++rSigUpdFloat.readGen;
+
+        if (rUpdMach.linkPass != 255)
+        {
+            ++rUpdMach.linkPass;
+        }
+
+        // Keep looping while machines wait on later passes
+        for (std::vector<MachinePair> const& rBatch : rUpdMach.machDeferred)
+        {
+            if ( ! rBatch.empty() )
+            {
+                rUpdMach.requestMachineUpdateLoop.store(true);
+                break;
+            }
+        }
+
+        // ## Machine updates
+
+        // MagicRockets are sinks here; read throttle like the newton thrust task does
+        ArrayView<MachLocalId const> const rockets
+                = batch_dirty_machines(rUpdMach, gc_mtMagicRocket);
+        for (MachLocalId const local : rockets)
+        {
+            MachAnyId const mach = rCtx.machines.perType[gc_mtMagicRocket].localToAny[local];
+            auto const portSpan  = lgrn::Span<NodeId const>{rFloatNodes.machToNode[mach]};
+
+            NodeId const node = connected_node(portSpan, ports_magicrocket::gc_throttleIn.port);
+            if (node != lgrn::id_null<NodeId>())
+            {
+                rCtx.checksum += rCtx.sigValFloat[node];
+            }
+        }
+        rCtx.machineUpdates += rockets.size();
+
+        ArrayView<MachLocalId const> const drivers
+                = batch_dirty_machines(rUpdMach, gc_mtRcsDriver);
+        if (update_rcsdrivers(drivers, rCtx.rcsPorts, rCtx.sigValFloat,
+                              rCtx.sigUpdFloat.perType[gc_mtRcsDriver]))
+        {
+            rUpdMach.requestMachineUpdateLoop = true;
+        }
+        rCtx.machineUpdates += drivers.size();
+    }
+}
+
+/**
+ * One UserCtrl throttle output fanned out to sinkCount MagicRocket sinks
+ */
+GeneratedVehicle make_fanout(Resources &rResources, int const sinkCount)
+{
+    VehicleBuilder builder{&rResources};
+    VehicleBuilder::WeldVec_t toWeld;
+
+    auto const [ctrlPart]  = builder.create_parts<1>();
+    toWeld.push_back({ctrlPart, Matrix4{}});
+
+    auto const [throttle] = builder.create_nodes<1>(gc_ntSigFloat);
+
+    builder.create_machine(ctrlPart, gc_mtUserCtrl, {
+        { ports_userctrl::gc_throttleOut, throttle }
+    });
+
+    for (int i = 0; i < sinkCount; ++i)
+    {
+        auto const [part] = builder.create_parts<1>();
+        toWeld.push_back({part, Matrix4{}});
+
+        builder.create_machine(part, gc_mtMagicRocket, {
+            { ports_magicrocket::gc_throttleIn, throttle }
+        });
+    }
+
+    // Sizes the initial float values copied on spawn; call after all create_nodes
+    (void) builder.node_values< SignalValues_t<float> >(gc_ntSigFloat);
+
+    builder.weld(toWeld);
+
+    return { .data = builder.finalize_release(), .ctrlNode = throttle };
+}
+
+/**
+ * A chain of RcsDrivers, each one's throttle output commanding the next; settles across
+ * one ranked pass per chain stage. A shared constant direction node keeps
+ * thruster_influence passing commands through at full strength.
+ */
+GeneratedVehicle make_chain(Resources &rResources, int const depth)
+{
+    VehicleBuilder builder{&rResources};
+    VehicleBuilder::WeldVec_t toWeld;
+
+    auto const [ctrlPart]  = builder.create_parts<1>();
+    toWeld.push_back({ctrlPart, Matrix4{}});
+
+    auto const [cmd, dirY] = builder.create_nodes<2>(gc_ntSigFloat);
+
+    builder.create_machine(ctrlPart, gc_mtUserCtrl, {
+        { ports_userctrl::gc_pitchOut, cmd }
+    });
+
+    NodeId prev = cmd;
+    for (int i = 0; i < depth; ++i)
+    {
+        auto const [part] = builder.create_parts<1>();
+        toWeld.push_back({part, Matrix4{}});
+
+        auto const [out] = builder.create_nodes<1>(gc_ntSigFloat);
+
+        builder.create_machine(part, gc_mtRcsDriver, {
+            { ports_rcsdriver::gc_dirYIn,      dirY },
+            { ports_rcsdriver::gc_cmdLinYIn,   prev },
+            { ports_rcsdriver::gc_throttleOut, out  }
+        });
+
+        prev = out;
+    }
+
+    auto const [sinkPart] = builder.create_parts<1>();
+    toWeld.push_back({sinkPart, Matrix4{}});
+    builder.create_machine(sinkPart, gc_mtMagicRocket, {
+        { ports_magicrocket::gc_throttleIn, prev }
+    });
+
+    // node_values resizes to the current node capacity, so set after all create_nodes
+    builder.node_values< SignalValues_t<float> >(gc_ntSigFloat)[dirY] = 1.0f;
+
+    builder.weld(toWeld);
+
+    return { .data = builder.finalize_release(), .ctrlNode = cmd };
+}
+
+/**
+ * width independent chains of the given depth off one UserCtrl output, every stage's
+ * output also feeding a MagicRocket sink; fan-out and settling depth combined
+ */
+GeneratedVehicle make_grid(Resources &rResources, int const width, int const depth)
+{
+    VehicleBuilder builder{&rResources};
+    VehicleBuilder::WeldVec_t toWeld;
+
+    auto const [ctrlPart]  = builder.create_parts<1>();
+    toWeld.push_back({ctrlPart, Matrix4{}});
+
+    auto const [cmd, dirY] = builder.create_nodes<2>(gc_ntSigFloat);
+
+    builder.create_machine(ctrlPart, gc_mtUserCtrl, {
+        { ports_userctrl::gc_pitchOut, cmd }
+    });
+
+    for (int w = 0; w < width; ++w)
+    {
+        NodeId prev = cmd;
+        for (int d = 0; d < depth; ++d)
+        {
+            auto const [part] = builder.create_parts<1>();
+            toWeld.push_back({part, Matrix4{}});
+
+            auto const [out] = builder.create_nodes<1>(gc_ntSigFloat);
+
+            builder.create_machine(part, gc_mtRcsDriver, {
+                { ports_rcsdriver::gc_dirYIn,      dirY },
+                { ports_rcsdriver::gc_cmdLinYIn,   prev },
+                { ports_rcsdriver::gc_throttleOut, out  }
+            });
+            builder.create_machine(part, gc_mtMagicRocket, {
+                { ports_magicrocket::gc_throttleIn, out }
+            });
+
+            prev = out;
+        }
+    }
+
+    builder.node_values< SignalValues_t<float> >(gc_ntSigFloat)[dirY] = 1.0f;
+
+    builder.weld(toWeld);
+
+    return { .data = builder.finalize_release(), .ctrlNode = cmd };
+}
+
+void run_bench(char const* const name, GeneratedVehicle const &vehicle,
+               int const copies, int const steps)
+{
+    LinkCtx ctx;
+    ctx.machines.perType.resize(MachTypeReg_t::size());
+    ctx.nodePerType     .resize(NodeTypeReg_t::size());
+
+    for (int i = 0; i < copies; ++i)
+    {
+        spawn_vehicle(ctx, vehicle);
+    }
+    finish_setup(ctx);
+
+    UpdateNodes<float> &rCtrlSlot = ctx.sigUpdFloat.perType[gc_mtUserCtrl];
+
+    // Warmup; first propagation through a cold graph
+    for (NodeId const node : ctx.ctrlNodes)
+    {
+        rCtrlSlot.assign(node, 1.0f);
+    }
+    ctx.updMach.requestMachineUpdateLoop = true;
+    link_update(ctx);
+
+    ctx.machineUpdates = 0;
+    ctx.settlingPasses = 0;
+
+    auto const start = std::chrono::steady_clock::now();
+
+    for (int step = 0; step < steps; ++step)
+    {
+        // Alternate so every machine's output flips and re-propagates each step
+        float const stimulus = (step % 2 == 0) ? 0.0f : 1.0f;
+        for (NodeId const node : ctx.ctrlNodes)
+        {
+            rCtrlSlot.assign(node, stimulus);
+        }
+        ctx.updMach.requestMachineUpdateLoop = true;
+
+        link_update(ctx);
+    }
+
+    auto const end = std::chrono::steady_clock::now();
+
+    double const totalNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    double const perMach = (ctx.machineUpdates != 0) ? (totalNs / double(ctx.machineUpdates)) : 0.0;
+
+    std::printf("%-40s %10zu mach-updates %10.1f ns/mach-update %6.1f passes/step %10.3f ms total\n",
+                name, ctx.machineUpdates, perMach,
+                double(ctx.settlingPasses) / double(steps), totalNs * 1.0e-6);
+}
+
+} // namespace
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
+{
+    std::printf("osp-magnum link graph update benchmarks (signal propagation + machine settling)\n\n");
+
+    // Empty package set; VehicleBuilder only needs Resources for prefab lookups
+    Resources resources;
+    resources.resize_types(ResTypeIdReg_t::size());
+
+    for (int copies : {1, 16})
+    {
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "fanout/sinks=256/copies=%d", copies);
+        GeneratedVehicle const fanout = make_fanout(resources, 256);
+        run_bench(name, fanout, copies, 256);
+
+        std::snprintf(name, sizeof(name), "chain/depth=32/copies=%d", copies);
+        GeneratedVehicle const chain = make_chain(resources, 32);
+        run_bench(name, chain, copies, 256);
+
+        std::snprintf(name, sizeof(name), "grid/width=16/depth=8/copies=%d", copies);
+        GeneratedVehicle const grid = make_grid(resources, 16, 8);
+        run_bench(name, grid, copies, 256);
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2023 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <osp/core/paged_keyed_vector.h>
+
+#include <gtest/gtest.h>
+
+enum class TestId : uint32_t {};
+
+using osp::PagedKeyedVec;
+
+// Small pages so tests cross page boundaries without thousands of elements
+using TestVec_t = PagedKeyedVec<TestId, int, 16>;
+
+// Elements must not move when the table grows past a page boundary
+TEST(PagedKeyedVec, StableReferencesAcrossGrowth)
+{
+    TestVec_t vec;
+    vec.resize(10);
+
+    vec[TestId(3)] = 42;
+    int *pBefore = &vec[TestId(3)];
+
+    vec.resize(1000);
+
+    EXPECT_EQ(pBefore, &vec[TestId(3)]);
+    EXPECT_EQ(vec[TestId(3)], 42);
+}
+
+// resize(count, value) fills newly exposed slots like std::vector
+TEST(PagedKeyedVec, ResizeFillsNewSlots)
+{
+    TestVec_t vec;
+    vec.resize(5, 7);
+    vec.resize(40, 9);
+
+    EXPECT_EQ(vec[TestId(0)],  7);
+    EXPECT_EQ(vec[TestId(4)],  7);
+    EXPECT_EQ(vec[TestId(5)],  9);
+    EXPECT_EQ(vec[TestId(39)], 9);
+    EXPECT_EQ(vec.size(), 40u);
+    EXPECT_GE(vec.capacity(), 40u);
+}
+
+TEST(PagedKeyedVec, ShrinkFreesTrailingPages)
+{
+    TestVec_t vec;
+    vec.resize(64);
+    EXPECT_EQ(vec.capacity(), 64u);
+
+    vec.resize(16);
+    EXPECT_EQ(vec.capacity(), 16u);
+    EXPECT_EQ(vec.size(), 16u);
+}
+
+TEST(PagedKeyedVec, AtThrowsOutOfRange)
+{
+    TestVec_t vec;
+    vec.resize(10);
+
+    EXPECT_NO_THROW(vec.at(TestId(9)));
+    EXPECT_THROW(vec.at(TestId(10)), std::out_of_range);
+}
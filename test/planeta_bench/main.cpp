@@ -0,0 +1,472 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2026 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Terrain generation micro-benchmarks: drives the full planet-a per-update path (skeleton
+// subdivide/unsubdivide by distance, chunk create/remove, edge and fill vertex calculation,
+// restitch, face/normal update) over synthetic icosahedron planets at fixed camera
+// trajectories, with no renderer or task executor involved. Reports vertices filled per
+// second and heap allocation counts over the timed region; steady-state trajectories should
+// allocate near zero once scratchpads are warm. Run before and after touching
+// chunk_generate.cpp or skeleton_subdiv.cpp.
+
+#include <planet-a/chunk_generate.h>
+#include <planet-a/chunk_utils.h>
+#include <planet-a/icosahedron.h>
+#include <planet-a/skeleton_subdiv.h>
+
+#include <Corrade/Containers/ArrayViewStl.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace osp;
+using namespace planeta;
+
+// Counted in the replaced global operator new below; the default operator new[] and the
+// aligned overloads forward here, so container growth anywhere in planet-a is counted.
+static std::atomic<std::size_t> g_allocCount{0};
+static std::atomic<std::size_t> g_allocBytes{0};
+
+void* operator new(std::size_t const size)
+{
+    g_allocCount.fetch_add(1,    std::memory_order_relaxed);
+    g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void *ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept                { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept   { std::free(ptr); }
+
+namespace
+{
+
+/**
+ * Standalone equivalent of testapp's ACtxTerrain + ACtxTerrainIco, minus culling
+ */
+struct BenchPlanet
+{
+    SubdivTriangleSkeleton      skeleton;
+    SkeletonVertexData          skData;
+    ChunkSkeleton               skChunks;
+    ChunkMeshBufferInfo         chunkInfo{};
+    BasicChunkMeshGeometry      chunkGeom;
+    ChunkScratchpad             chunkSP;
+    SkeletonSubdivScratchpad    skSP;
+
+    double                      radius{};
+    double                      height{};
+    std::array<SkVrtxId,     12> icoVrtx;
+    std::array<SkTriGroupId, 5>  icoGroups;
+    std::array<SkTriId,      20> icoTri;
+
+    std::size_t                 chunksCreated{0};
+    std::size_t                 chunksRemoved{0};
+};
+
+struct PlanetSpecs
+{
+    double          radius              {};
+    double          height              {};
+    int             skelPrecision       {};
+    std::uint8_t    skelMaxSubdivLevels {};
+    std::uint8_t    chunkSubdivLevels   {};
+};
+
+/**
+ * Mirrors testapp's initialize_ico_terrain, without chunk culling or render state. Initialized
+ * in-place since skSP.onSubdivUserData points back into rPlanet.
+ */
+void init_planet(BenchPlanet &rPlanet, PlanetSpecs const specs)
+{
+    rPlanet.radius              = specs.radius;
+    rPlanet.height              = specs.height;
+    rPlanet.skData.precision    = specs.skelPrecision;
+    rPlanet.skeleton = create_skeleton_icosahedron(
+            specs.radius, rPlanet.icoVrtx, rPlanet.icoGroups, rPlanet.icoTri, rPlanet.skData);
+    rPlanet.skeleton.levelMax = specs.skelMaxSubdivLevels;
+
+    rPlanet.skData.resize(rPlanet.skeleton);
+
+    double const maxRadius = specs.radius + specs.height;
+    for (SkTriGroupId const groupId : rPlanet.icoGroups)
+    {
+        ico_calc_sphere_tri_center(groupId, maxRadius, specs.height, rPlanet.skeleton, rPlanet.skData);
+    }
+
+    SkeletonSubdivScratchpad &rSP = rPlanet.skSP;
+    rSP.resize(rPlanet.skeleton);
+    for (SkTriGroupId const groupId : rPlanet.icoGroups)
+    {
+        rSP.surfaceAdded.set(tri_id(groupId, 0).value);
+        rSP.surfaceAdded.set(tri_id(groupId, 1).value);
+        rSP.surfaceAdded.set(tri_id(groupId, 2).value);
+        rSP.surfaceAdded.set(tri_id(groupId, 3).value);
+    }
+
+    rSP.onSubdivUserData[0] = &rPlanet;
+    rSP.onSubdiv = [] (
+            SkTriId                             tri,
+            SkTriGroupId                        groupId,
+            std::array<SkVrtxId, 3>             corners,
+            std::array<MaybeNewId<SkVrtxId>, 3> middles,
+            SubdivTriangleSkeleton              &rSkel,
+            SkeletonVertexData                  &rSkData,
+            SkeletonSubdivScratchpad::UserData_t userData) noexcept
+    {
+        auto const& rPlanet = *reinterpret_cast<BenchPlanet const*>(userData[0]);
+        ico_calc_middles(rPlanet.radius, corners, middles, rSkData);
+        ico_calc_sphere_tri_center(groupId, rPlanet.radius + rPlanet.height, rPlanet.height, rSkel, rSkData);
+    };
+
+    rSP.onUnsubdiv = [] (
+            SkTriId                         tri,
+            SkeletonTriangle                &rTri,
+            SubdivTriangleSkeleton          &rSkel,
+            SkeletonVertexData              &rSkData,
+            SkeletonSubdivScratchpad::UserData_t userData) noexcept
+    { };
+
+    // Same thresholds as testapp's terrain_update_subdiv_thresholds at lodScale 1.0.
+    // scanHysteresis stays zero so every benchmark step runs a full distance scan.
+    double const scale = std::pow(2.0, rPlanet.skData.precision);
+    for (int level = 0; level < gc_maxSubdivLevels; ++level)
+    {
+        float const edgeLength   = gc_icoMaxEdgeVsLevel[level] * specs.radius * scale;
+        float const subdivRadius = 0.75f * edgeLength;
+
+        rSP.distanceThresholdSubdiv  [level] = std::uint64_t(subdivRadius);
+        rSP.distanceThresholdUnsubdiv[level] = std::uint64_t(2.0f * subdivRadius);
+    }
+
+    rPlanet.skChunks = make_skeleton_chunks(specs.chunkSubdivLevels);
+
+    std::uint32_t const maxChunksApprox     = 36 * specs.skelMaxSubdivLevels + 30;
+    std::uint32_t const maxVrtxApprox       = maxChunksApprox * rPlanet.skChunks.m_chunkSharedCount;
+    std::uint32_t const maxSharedVrtxApprox = 0.6f * maxVrtxApprox;
+
+    rPlanet.skChunks.chunk_reserve(std::uint16_t(maxChunksApprox));
+    rPlanet.skChunks.shared_reserve(maxSharedVrtxApprox);
+
+    rPlanet.chunkInfo = make_chunk_mesh_buffer_info(rPlanet.skChunks);
+    rPlanet.chunkGeom.resize(rPlanet.skChunks, rPlanet.chunkInfo);
+    rPlanet.chunkSP.resize(rPlanet.skChunks);
+}
+
+/**
+ * One terrain update at the given viewer position. Same code path as testapp's "Subdivide
+ * triangle skeleton" and "Update Terrain Chunks" tasks, minus the scan hysteresis early-out,
+ * debug obj writes, and periodic normal sum rebuild.
+ */
+void planet_update(BenchPlanet &rPlanet, Vector3l const position)
+{
+    SubdivTriangleSkeleton     &rSkel      = rPlanet.skeleton;
+    SkeletonVertexData         &rSkData    = rPlanet.skData;
+    ChunkSkeleton              &rSkCh      = rPlanet.skChunks;
+    ChunkMeshBufferInfo        &rChInfo    = rPlanet.chunkInfo;
+    BasicChunkMeshGeometry     &rChGeo     = rPlanet.chunkGeom;
+    ChunkScratchpad            &rChSP      = rPlanet.chunkSP;
+    SkeletonSubdivScratchpad   &rSkSP      = rPlanet.skSP;
+
+    // ## Subdivide/unsubdivide the triangle skeleton by distance
+
+    for (int level = rSkel.levelMax-1; level >= 0; --level)
+    {
+        unsubdivide_select_by_distance(level, position, rSkel, rSkData, rSkSP);
+        unsubdivide_deselect_invariant_violations(level, rSkel, rSkData, rSkSP);
+        unsubdivide_level(level, rSkel, rSkData, rSkSP);
+    }
+    rSkSP.distanceTestDone.reset();
+
+    if (rSkel.levelMax > 0)
+    {
+        for (SkTriId const sktriId : rPlanet.icoTri)
+        {
+            rSkSP.levels[0].distanceTestNext.push_back(sktriId);
+            rSkSP.distanceTestDone.set(sktriId.value);
+        }
+        rSkSP.levelNeedProcess = 0;
+    }
+
+    for (int level = 0; level < rSkel.levelMax; ++level)
+    {
+        subdivide_level_by_distance(position, level, rSkel, rSkData, rSkSP);
+    }
+    rSkSP.distanceTestDone.reset();
+
+    // ## Update chunks of changed surface triangles
+
+    rChSP.chunksAdded       .clear();
+    rChSP.sharedNormalsDirty.reset();
+    rChSP.sharedAdded       .reset();
+    rChSP.sharedRemoved     .reset();
+
+    for (std::size_t const sktriInt : rSkSP.surfaceRemoved.ones())
+    {
+        auto    const sktriId = SkTriId(sktriInt);
+        ChunkId const chunkId = rSkCh.m_triToChunk[sktriId];
+
+        subtract_normal_contrib(chunkId, 0b111111, true, rChGeo, rChInfo,
+                                rChGeo.sharedNormalSum.base(), rChSP.sharedNormalsDirty,
+                                rChSP, rSkCh);
+
+        rSkCh.chunk_remove(chunkId, sktriId, rChSP.sharedRemoved, rSkel);
+
+        ++ rPlanet.chunksRemoved;
+    }
+
+    auto const chLevel  = rSkCh.m_chunkSubdivLevel;
+    auto const edgeSize = rSkCh.m_chunkEdgeVrtxCount-1;
+
+    rSkCh.m_triToChunk.resize(rSkel.tri_group_ids().capacity() * 4);
+    for (std::size_t const sktriInt : rSkSP.surfaceAdded.ones())
+    {
+        auto const sktriId  = SkTriId::from_index(sktriInt);
+        auto const &corners = rSkel.tri_at(SkTriId(sktriInt)).vertices;
+
+        ArrayView< MaybeNewId<SkVrtxId> > const edgeVrtxView = rChSP.edgeVertices;
+        ArrayView< MaybeNewId<SkVrtxId> > const edgeLft = edgeVrtxView.sliceSize(edgeSize * 0, edgeSize);
+        ArrayView< MaybeNewId<SkVrtxId> > const edgeBtm = edgeVrtxView.sliceSize(edgeSize * 1, edgeSize);
+        ArrayView< MaybeNewId<SkVrtxId> > const edgeRte = edgeVrtxView.sliceSize(edgeSize * 2, edgeSize);
+
+        rSkel.vrtx_create_chunk_edge_recurse(chLevel, corners[0], corners[1], edgeLft);
+        rSkel.vrtx_create_chunk_edge_recurse(chLevel, corners[1], corners[2], edgeBtm);
+        rSkel.vrtx_create_chunk_edge_recurse(chLevel, corners[2], corners[0], edgeRte);
+
+        ChunkId const chunkId = rSkCh.chunk_create(sktriId, rSkel, rChSP.sharedAdded, edgeLft, edgeBtm, edgeRte);
+        rChSP.chunksAdded.push_back(chunkId);
+
+        rSkData.resize(rSkel);
+        rSkSP.resize(rSkel);
+
+        ico_calc_chunk_edge(rPlanet.radius, chLevel, corners[0], corners[1], edgeLft, rSkData);
+        ico_calc_chunk_edge(rPlanet.radius, chLevel, corners[1], corners[2], edgeBtm, rSkData);
+        ico_calc_chunk_edge(rPlanet.radius, chLevel, corners[2], corners[0], edgeRte, rSkData);
+
+        ++ rPlanet.chunksCreated;
+    }
+
+    for (std::size_t const sktriInt : rSkSP.surfaceAdded.ones())
+    {
+        auto const sktriId = SkTriId::from_index(sktriInt);
+        auto const chunkId = rSkCh.m_triToChunk[SkTriId::from_index(sktriInt)];
+        restitch_check(chunkId, sktriId, rSkCh, rSkel, rSkData, rChSP);
+    }
+
+    float const scalepow = std::pow(2.0f, -rSkData.precision);
+    for (ChunkId const chunkId : rChSP.chunksAdded)
+    {
+        SkTriId  const sktriId = rSkCh.m_chunkToTri[chunkId];
+        Vector3l const center  = rSkData.centers[sktriId];
+        Vector3  const centerF = Vector3(Vector3d(center) * scalepow);
+
+        for (SharedVrtxOwner_t const& sharedUsed : rSkCh.shared_vertices_used(chunkId))
+        {
+            SharedVrtxId const sharedVrtxId = sharedUsed.value();
+            if ( ! rChSP.sharedAdded.test(sharedVrtxId.value) )
+            {
+                continue;
+            }
+            rChSP.sharedAdded.reset(sharedVrtxId.value);
+
+            SkVrtxId const skelVrtx = rSkCh.m_sharedToSkVrtx[sharedVrtxId];
+
+            rChGeo.sharedNormalSum[sharedVrtxId] = Vector3{ZeroInit};
+
+            Vector3   const offset = Vector3(rSkData.positions[skelVrtx] - center) * scalepow;
+            VertexIdx const vertex = rChInfo.vbufSharedOffset + sharedVrtxId.value;
+
+            rChGeo.chunkVbufPos[vertex] = centerF + offset;
+
+            auto const parents = rSkel.vrtx_ids().parents_of(skelVrtx);
+            if (parents.a.has_value())
+            {
+                Vector3l const mid = (rSkData.positions[parents.a] + rSkData.positions[parents.b]) / 2;
+                rChGeo.chunkVbufMorphPos[vertex] = centerF + Vector3(mid - center) * scalepow;
+            }
+            else
+            {
+                rChGeo.chunkVbufMorphPos[vertex] = rChGeo.chunkVbufPos[vertex];
+            }
+        }
+    }
+
+    for (std::size_t const sktriInt : rSkSP.surfaceAdded.ones())
+    {
+        auto        const chunk      = rSkCh.m_triToChunk[SkTriId::from_index(sktriInt)];
+        auto        const chunkIdInt = std::size_t(chunk);
+        std::size_t const fillOffset = rChInfo.vbufFillOffset + chunkIdInt*rChInfo.fillVrtxCount;
+
+        osp::ArrayView<SharedVrtxOwner_t const> sharedUsed = rSkCh.shared_vertices_used(chunk);
+
+        for (ChunkFillSubdivLUT::ToSubdiv const& toSubdiv : rChSP.lut->data())
+        {
+            std::size_t const vrtxA = rChSP.lut->index(sharedUsed, fillOffset, rChInfo.vbufSharedOffset, toSubdiv.m_vrtxA);
+            std::size_t const vrtxB = rChSP.lut->index(sharedUsed, fillOffset, rChInfo.vbufSharedOffset, toSubdiv.m_vrtxB);
+            std::size_t const vrtxC = rChInfo.vbufFillOffset + rChInfo.fillVrtxCount*chunkIdInt + toSubdiv.m_fillOut.value;
+
+            Vector3 &rPosC = rChGeo.chunkVbufPos[vrtxC];
+
+            Vector3 const avg       = (rChGeo.chunkVbufPos[vrtxA] + rChGeo.chunkVbufPos[vrtxB]) / 2.0f;
+            float   const avgLen    = avg.length();
+            float   const roundness = float(rPlanet.radius) - avgLen;
+
+            rPosC = avg + (avg / avgLen) * roundness;
+
+            rChGeo.chunkVbufMorphPos[vrtxC] = avg;
+        }
+    }
+
+    update_faces_parallel(rSkSP.surfaceAdded, rSkel, rSkData, rChGeo, rChInfo, rChSP, rSkCh);
+    std::fill(rChSP.stitchCmds.begin(), rChSP.stitchCmds.end(), ChunkStitch{});
+
+    for (std::size_t sharedIdx = 0; sharedIdx < rChSP.sharedNormalsDirty.size(); ++sharedIdx)
+    if (rSkCh.m_sharedIds.exists(SharedVrtxId(sharedIdx)))
+    {
+        SharedVrtxId const shared    = SharedVrtxId(sharedIdx);
+        Vector3      const normalSum = rChGeo.sharedNormalSum[shared];
+        rChGeo.chunkVbufNrm[rChInfo.vbufSharedOffset + sharedIdx] = normalSum.normalized();
+    }
+
+    rSkSP.surfaceAdded  .reset();
+    rSkSP.surfaceRemoved.reset();
+}
+
+using TrajectoryFunc_t = Vector3d (*)(double t);
+
+constexpr double gc_pi = 3.14159265358979323846;
+
+/**
+ * Spiral descent from 3 radii altitude down to just above the surface, circling twice
+ */
+Vector3d orbit_descent(double const t)
+{
+    double const angle = t * 2.0 * 2.0*gc_pi;
+    double const alt   = 3.0 - t * (3.0 - 1.02);
+    return Vector3d{std::cos(angle), std::sin(angle), 0.2}.normalized() * alt;
+}
+
+/**
+ * Quarter orbit at constant low altitude; steady-state create-ahead/remove-behind churn
+ */
+Vector3d surface_flyover(double const t)
+{
+    double const angle = t * 0.5*gc_pi;
+    return Vector3d{std::cos(angle), std::sin(angle), 0.1}.normalized() * 1.01;
+}
+
+/**
+ * Repeated climb and dive over one spot; stresses full subdivide/unsubdivide cycles
+ */
+Vector3d bounce(double const t)
+{
+    double const alt = 1.02 + 2.0 * std::abs(std::sin(t * 3.0 * gc_pi));
+    return Vector3d{1.0, 0.2, 0.1}.normalized() * alt;
+}
+
+void run_bench(char const* const name, PlanetSpecs const specs, TrajectoryFunc_t const trajectory, int const steps)
+{
+    BenchPlanet planet;
+    init_planet(planet, specs);
+
+    double const posScale = specs.radius * std::pow(2.0, specs.skelPrecision);
+
+    // Warmup: first step pays for initial icosahedron chunks and scratchpad growth
+    planet_update(planet, Vector3l(trajectory(0.0) * posScale));
+    planet.chunksCreated = 0;
+    planet.chunksRemoved = 0;
+
+    std::size_t const allocCountBefore = g_allocCount.load(std::memory_order_relaxed);
+    std::size_t const allocBytesBefore = g_allocBytes.load(std::memory_order_relaxed);
+
+    auto const start = std::chrono::steady_clock::now();
+
+    for (int i = 1; i <= steps; ++i)
+    {
+        double const t = double(i) / double(steps);
+        planet_update(planet, Vector3l(trajectory(t) * posScale));
+    }
+
+    auto const end = std::chrono::steady_clock::now();
+
+    std::size_t const allocCount = g_allocCount.load(std::memory_order_relaxed) - allocCountBefore;
+    std::size_t const allocBytes = g_allocBytes.load(std::memory_order_relaxed) - allocBytesBefore;
+
+    // Vertices written per created chunk: its fill vertices plus its share of the chunk edge
+    std::size_t const vrtxPerChunk = planet.chunkInfo.fillVrtxCount + planet.skChunks.m_chunkSharedCount;
+    std::size_t const vrtxFilled   = planet.chunksCreated * vrtxPerChunk;
+
+    double const totalSec  = std::chrono::duration<double>(end - start).count();
+    double const mvertPerSec = (totalSec != 0.0) ? (double(vrtxFilled) * 1.0e-6 / totalSec) : 0.0;
+
+    std::printf("%-44s %6zu +chunk %6zu -chunk %9.2f Mvert/s %8zu allocs %9zu KiB %9.3f ms\n",
+                name, planet.chunksCreated, planet.chunksRemoved, mvertPerSec,
+                allocCount, allocBytes / 1024u, totalSec * 1.0e3);
+}
+
+} // namespace
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
+{
+    std::printf("osp-magnum planet-a terrain generation benchmarks\n\n");
+
+    // Same specs as testapp's terrain scenario
+    PlanetSpecs const small
+    {
+        .radius                 = 50.0,
+        .height                 = 5.0,
+        .skelPrecision          = 10,
+        .skelMaxSubdivLevels    = 7,
+        .chunkSubdivLevels      = 4
+    };
+
+    // Planet-sized body; deeper skeleton, coarser precision to stay within Vector3l range
+    PlanetSpecs const large
+    {
+        .radius                 = 600000.0,
+        .height                 = 4000.0,
+        .skelPrecision          = 4,
+        .skelMaxSubdivLevels    = 9,
+        .chunkSubdivLevels      = 5
+    };
+
+    run_bench("orbit_descent/r=50/skel=7/chunk=4",    small, orbit_descent,   64);
+    run_bench("surface_flyover/r=50/skel=7/chunk=4",  small, surface_flyover, 64);
+    run_bench("bounce/r=50/skel=7/chunk=4",           small, bounce,          64);
+
+    run_bench("orbit_descent/r=600k/skel=9/chunk=5",   large, orbit_descent,   64);
+    run_bench("surface_flyover/r=600k/skel=9/chunk=5", large, surface_flyover, 64);
+    run_bench("bounce/r=600k/skel=9/chunk=5",          large, bounce,          64);
+
+    return 0;
+}
@@ -27,6 +27,10 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace osp;
 
 struct ImageData { int m_dummy{0}; };
@@ -96,6 +100,69 @@ TEST(Resources, Basic)
 
 }
 
+// Interned-name lookup must match plain string lookup
+TEST(Resources, InternedNameFind)
+{
+    Resources res = setup_basic();
+    PkgId const pkgA = res.pkg_create();
+
+    ResId const created = res.create(restypes::gc_image, pkgA, SharedString::create_reference("Image0"));
+
+    ResName const interned = ResName::intern(SharedString::create("Image0"));
+
+    EXPECT_EQ(res.find(restypes::gc_image, pkgA, interned), created);
+    EXPECT_EQ(res.find(restypes::gc_image, pkgA, interned),
+              res.find(restypes::gc_image, pkgA, "Image0"));
+
+    ResName const missing = ResName::intern(SharedString::create("Does/Not/Exist"));
+    EXPECT_EQ(res.find(restypes::gc_image, pkgA, missing), lgrn::id_null<ResId>());
+}
+
+// Concurrent importer threads creating, attaching data, and finding on the same type
+TEST(Resources, ConcurrentCreateAndFind)
+{
+    static constexpr int sc_threads      = 4;
+    static constexpr int sc_perThread    = 64;
+
+    Resources res = setup_basic();
+    PkgId const pkgA = res.pkg_create();
+
+    std::vector<std::thread> threads;
+    threads.reserve(sc_threads);
+
+    for (int t = 0; t < sc_threads; ++t)
+    {
+        threads.emplace_back([&res, pkgA, t] ()
+        {
+            for (int i = 0; i < sc_perThread; ++i)
+            {
+                std::string const name = "Image" + std::to_string(t) + "_" + std::to_string(i);
+
+                ResId const id = res.create(restypes::gc_image, pkgA, SharedString::create(name));
+                res.data_add<ImageData>(restypes::gc_image, id, ImageData{t});
+            }
+        });
+    }
+
+    for (std::thread &rThread : threads)
+    {
+        rThread.join();
+    }
+
+    // Every resource must exist exactly as created, with its data attached
+    for (int t = 0; t < sc_threads; ++t)
+    {
+        for (int i = 0; i < sc_perThread; ++i)
+        {
+            std::string const name = "Image" + std::to_string(t) + "_" + std::to_string(i);
+
+            ResId const id = res.find(restypes::gc_image, pkgA, name);
+            ASSERT_NE(id, lgrn::id_null<ResId>());
+            EXPECT_EQ(res.data_get<ImageData>(restypes::gc_image, id).m_dummy, t);
+        }
+    }
+}
+
 // Test ref counting and storage features
 TEST(Resources, RefCounting)
 {
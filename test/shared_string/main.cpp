@@ -41,6 +41,51 @@
     ASSERT_NE(LHS, RHS);            \
     ASSERT_NE(RHS, LHS);
 
+// Small strings are stored inline; copies must carry their own characters
+TEST(SharedString, SmallStringCopies)
+{
+    osp::SharedString const small = osp::SharedString::create("hello");
+
+    osp::SharedString const copy = small; // NOLINT(performance-unnecessary-copy-initialization)
+    ASSERT_EQ(copy, small);
+    ASSERT_NE(copy.data(), small.data()); // each object owns its inline buffer
+
+    osp::SharedString moved = osp::SharedString::create("world");
+    osp::SharedString const dst = std::move(moved);
+    ASSERT_EQ(dst, "world");
+}
+
+// Substrings of inline strings must not reference the source object's buffer
+TEST(SharedString, SmallStringSubstr)
+{
+    osp::SharedString sub;
+    {
+        osp::SharedString const small = osp::SharedString::create("hello world");
+        sub = small.substr(6);
+    } // small destroyed
+
+    ASSERT_EQ(sub, "world");
+}
+
+// Long strings still take the allocating refcounted path and share storage
+TEST(SharedString, LongStringsShareStorage)
+{
+    static constexpr std::string_view sc_long
+            = "this string is far too long for any inline buffer to hold";
+
+    osp::SharedString const str  = osp::SharedString::create(sc_long);
+    osp::SharedString const copy = str; // NOLINT(performance-unnecessary-copy-initialization)
+
+    ASSERT_EQ(str, sc_long);
+    ASSERT_EQ(copy.data(), str.data()); // shared refcounted buffer
+}
+
+TEST(SharedString, CreateStatic)
+{
+    constexpr auto str = osp::SharedString::create_static("literal");
+    ASSERT_EQ(str, "literal");
+}
+
 // Some trivial assertions. No lifetime tests yet.
 TEST(SharedString, BasicAssertions)
 {
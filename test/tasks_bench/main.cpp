@@ -0,0 +1,256 @@
+/**
+ * Open Space Program
+ * Copyright © 2019-2022 Open Space Program Project
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Scheduler micro-benchmarks: measures exec_update/complete_task throughput over synthetic
+// graph shapes (wide fan-outs, deep stage chains, loop scopes) at varying pipeline counts.
+// Task functions are empty, so the numbers isolate scheduler bookkeeping cost; regressions
+// here show up directly as per-frame overhead.
+
+#include <osp/tasks/tasks.h>
+#include <osp/tasks/builder.h>
+#include <osp/tasks/execute.h>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace osp;
+
+namespace
+{
+
+struct BenchState
+{
+    int countdown { 0 };
+};
+
+using BasicTraits_t = BasicBuilderTraits<TaskActions(*)(BenchState&)>;
+using Builder_t     = BasicTraits_t::Builder;
+using TaskFuncVec_t = BasicTraits_t::FuncVec_t;
+
+struct BenchGraph
+{
+    Tasks                   tasks;
+    TaskEdges               edges;
+    TaskFuncVec_t           functions;
+    std::vector<PipelineId> roots;
+};
+
+/**
+ * Drain the ExecContext single-threaded; returns number of tasks completed
+ */
+std::size_t drain(BenchGraph &rBench, TaskGraph const& graph, ExecContext &rExec, BenchState &rState)
+{
+    std::size_t tasksRun = 0;
+
+    for (PipelineId const root : rBench.roots)
+    {
+        exec_request_run(rExec, root);
+    }
+    exec_update(rBench.tasks, graph, rExec);
+
+    while (rExec.tasksQueuedRun.size() != 0)
+    {
+        TaskId const task = rExec.tasksQueuedRun[0];
+
+        auto const& func = rBench.functions[task];
+        TaskActions const status = (func != nullptr) ? func(rState) : TaskActions{};
+
+        complete_task(rBench.tasks, graph, rExec, task, status);
+        exec_update(rBench.tasks, graph, rExec);
+
+        ++ tasksRun;
+    }
+
+    return tasksRun;
+}
+
+/**
+ * pipelineCount independent pipelines, each with 'width' producer tasks on stage 0 feeding one
+ * consumer task on stage 1
+ */
+BenchGraph make_wide_fanout(int const pipelineCount, int const width)
+{
+    BenchGraph out;
+    Builder_t builder{out.tasks, out.edges, out.functions};
+
+    for (int p = 0; p < pipelineCount; ++p)
+    {
+        PipelineId pl;
+        out.tasks.m_pipelineIds.create(&pl, &pl + 1);
+        std::size_t const plCapacity = out.tasks.m_pipelineIds.capacity();
+        out.tasks.m_pipelineInfo   .resize(plCapacity);
+        out.tasks.m_pipelineControl.resize(plCapacity);
+        out.tasks.m_pipelineParents.resize(plCapacity, lgrn::id_null<PipelineId>());
+
+        for (int w = 0; w < width; ++w)
+        {
+            builder.task().run_on({pl, StageId(0)});
+        }
+        builder.task().run_on({pl, StageId(1)});
+
+        out.roots.push_back(pl);
+    }
+
+    return out;
+}
+
+/**
+ * pipelineCount independent pipelines, each a chain of 'depth' stages with one task per stage
+ */
+BenchGraph make_deep_chain(int const pipelineCount, int const depth)
+{
+    BenchGraph out;
+    Builder_t builder{out.tasks, out.edges, out.functions};
+
+    for (int p = 0; p < pipelineCount; ++p)
+    {
+        PipelineId pl;
+        out.tasks.m_pipelineIds.create(&pl, &pl + 1);
+        std::size_t const plCapacity = out.tasks.m_pipelineIds.capacity();
+        out.tasks.m_pipelineInfo   .resize(plCapacity);
+        out.tasks.m_pipelineControl.resize(plCapacity);
+        out.tasks.m_pipelineParents.resize(plCapacity, lgrn::id_null<PipelineId>());
+
+        for (int d = 0; d < depth; ++d)
+        {
+            builder.task().run_on({pl, StageId(d)});
+        }
+
+        out.roots.push_back(pl);
+    }
+
+    return out;
+}
+
+enum class LoopStages { Schedule, Process, Done };
+
+struct LoopPipelines
+{
+    osp::PipelineDef<LoopStages> main;
+    osp::PipelineDef<LoopStages> loop;
+};
+
+/**
+ * instanceCount loop scopes, each looping until the scheduler's countdown cancels
+ */
+BenchGraph make_loops(int const instanceCount)
+{
+    using enum LoopStages;
+
+    BenchGraph out;
+    Builder_t builder{out.tasks, out.edges, out.functions};
+
+    for (int i = 0; i < instanceCount; ++i)
+    {
+        auto const pl = builder.create_pipelines<LoopPipelines>();
+
+        builder.pipeline(pl.loop).parent(pl.main).loops(true);
+
+        builder.task()
+            .run_on   ({pl.loop(Schedule)})
+            .sync_with({pl.main(Process)})
+            .func( [] (BenchState &rState) -> TaskActions
+        {
+            if (rState.countdown == 0)
+            {
+                return TaskAction::Cancel;
+            }
+            -- rState.countdown;
+            return { };
+        });
+
+        builder.task()
+            .run_on   ({pl.loop(Process)})
+            .sync_with({pl.main(Process)})
+            .func( [] (BenchState&) -> TaskActions
+        {
+            return { };
+        });
+
+        out.roots.push_back(pl.main);
+    }
+
+    return out;
+}
+
+void run_bench(char const* name, BenchGraph &rBench, int const repetitions, int const countdown)
+{
+    TaskGraph const graph = make_exec_graph(rBench.tasks, {&rBench.edges});
+
+    ExecContext exec;
+    exec_conform(rBench.tasks, exec);
+    exec.doLogging = false;
+
+    BenchState state;
+
+    // Warmup
+    state.countdown = countdown;
+    drain(rBench, graph, exec, state);
+
+    std::size_t tasksRun = 0;
+
+    auto const start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < repetitions; ++i)
+    {
+        state.countdown = countdown;
+        tasksRun += drain(rBench, graph, exec, state);
+    }
+
+    auto const end = std::chrono::steady_clock::now();
+
+    double const totalNs  = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    double const perTask  = (tasksRun != 0) ? (totalNs / double(tasksRun)) : 0.0;
+
+    std::printf("%-40s %10zu tasks %12.1f ns/task %10.3f ms total\n",
+                name, tasksRun, perTask, totalNs * 1.0e-6);
+}
+
+} // namespace
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
+{
+    std::printf("osp-magnum task executor benchmarks (single-threaded scheduler cost)\n\n");
+
+    for (int pipelines : {1, 8, 64})
+    {
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "wide_fanout/pl=%d/width=32", pipelines);
+        BenchGraph wide = make_wide_fanout(pipelines, 32);
+        run_bench(name, wide, 64, 0);
+
+        std::snprintf(name, sizeof(name), "deep_chain/pl=%d/depth=12", pipelines);
+        BenchGraph chain = make_deep_chain(pipelines, 12);
+        run_bench(name, chain, 64, 0);
+
+        std::snprintf(name, sizeof(name), "loop_scope/instances=%d", pipelines);
+        BenchGraph loops = make_loops(pipelines);
+        run_bench(name, loops, 64, 16);
+    }
+
+    return 0;
+}
@@ -26,10 +26,19 @@
 #include <osp/universe/coordinates.h>
 #include <osp/core/math_2pow.h>
 
+#include <Corrade/Containers/ArrayViewStl.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
 #include <Magnum/Math/Functions.h>
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
 using namespace osp;
 using namespace osp::universe;
 
@@ -206,3 +215,180 @@ TEST(Universe, CoordTransformerRotations)
 }
 
 // TODO: Test CoordTransformer for hopping across nested rotated coordinate spaces
+
+
+//-----------------------------------------------------------------------------
+
+// Throughput benchmarks for CoordTransformer batch transforms. These run as a
+// regular test case so `ctest` exercises every code path, but the interesting
+// output is the printed ns-per-position table: the rotation-free cases should
+// stay flat shift-add passes regardless of precision delta, and the SoA paths
+// should not be slower than calling transform_position in a loop.
+
+struct BenchSats
+{
+    std::vector<Vector3g>   aosIn;
+    std::vector<spaceint_t> x;
+    std::vector<spaceint_t> y;
+    std::vector<spaceint_t> z;
+    std::vector<Vector3g>   aosOut;
+    std::vector<spaceint_t> xOut;
+    std::vector<spaceint_t> yOut;
+    std::vector<spaceint_t> zOut;
+    std::vector<Vector3>    metersOut;
+};
+
+static BenchSats make_bench_sats(std::size_t const count)
+{
+    BenchSats sats;
+    sats.aosIn    .reserve(count);
+    sats.x        .reserve(count);
+    sats.y        .reserve(count);
+    sats.z        .reserve(count);
+    sats.aosOut   .resize(count);
+    sats.xOut     .resize(count);
+    sats.yOut     .resize(count);
+    sats.zOut     .resize(count);
+    sats.metersOut.resize(count);
+
+    // Cheap xorshift; positions just need to be spread out and deterministic
+    uint64_t state = 88172645463325252ull;
+    auto const next = [&state] () -> spaceint_t
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return spaceint_t(state >> 24) - spaceint_t(1ull << 39);
+    };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Vector3g const pos{next(), next(), next()};
+        sats.aosIn.push_back(pos);
+        sats.x    .push_back(pos.x());
+        sats.y    .push_back(pos.y());
+        sats.z    .push_back(pos.z());
+    }
+    return sats;
+}
+
+/**
+ * @brief Time per-element cost of the scalar loop and each batch overload
+ *
+ * Accumulates a checksum from every output buffer so the compiler can't
+ * discard the transforms; the checksum also cross-checks that all paths
+ * computed the same positions.
+ */
+static void bench_transformer(char const* const name,
+                              CoordTransformer const& xform,
+                              BenchSats& rSats,
+                              int const precision)
+{
+    using Corrade::Containers::StridedArrayView1D;
+    using Corrade::Containers::arrayView;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int repeats = 64;
+
+    std::size_t const count = rSats.aosIn.size();
+
+    StridedArrayView1D<spaceint_t const> const viewX = arrayView(std::as_const(rSats.x));
+    StridedArrayView1D<spaceint_t const> const viewY = arrayView(std::as_const(rSats.y));
+    StridedArrayView1D<spaceint_t const> const viewZ = arrayView(std::as_const(rSats.z));
+
+    spaceint_t sumScalar = 0;
+    spaceint_t sumSoaAos = 0;
+    spaceint_t sumSoaSoa = 0;
+    double     sumMeters = 0.0;
+
+    // Scalar transform_position loop over AoS positions
+    Clock::time_point const timeA = Clock::now();
+    for (int pass = 0; pass < repeats; ++pass)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            rSats.aosOut[i] = xform.transform_position(rSats.aosIn[i]);
+        }
+        sumScalar += rSats.aosOut[pass % count].sum();
+    }
+
+    // SoA input, AoS Vector3g output
+    Clock::time_point const timeB = Clock::now();
+    for (int pass = 0; pass < repeats; ++pass)
+    {
+        xform.transform_positions(viewX, viewY, viewZ, arrayView(rSats.aosOut));
+        sumSoaAos += rSats.aosOut[pass % count].sum();
+    }
+
+    // SoA input, SoA output
+    Clock::time_point const timeC = Clock::now();
+    for (int pass = 0; pass < repeats; ++pass)
+    {
+        xform.transform_positions(viewX, viewY, viewZ,
+                                  arrayView(rSats.xOut), arrayView(rSats.yOut), arrayView(rSats.zOut));
+        sumSoaSoa += rSats.xOut[pass % count] + rSats.yOut[pass % count] + rSats.zOut[pass % count];
+    }
+
+    // SoA input, float meters output
+    Clock::time_point const timeD = Clock::now();
+    for (int pass = 0; pass < repeats; ++pass)
+    {
+        xform.transform_positions_meters(viewX, viewY, viewZ, precision, arrayView(rSats.metersOut));
+        sumMeters += double(rSats.metersOut[pass % count].sum());
+    }
+    Clock::time_point const timeE = Clock::now();
+
+    // All paths saw the same final pass; outputs must agree
+    EXPECT_EQ(sumScalar, sumSoaAos);
+    EXPECT_EQ(sumScalar, sumSoaSoa);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(rSats.aosOut[i], Vector3g(rSats.xOut[i], rSats.yOut[i], rSats.zOut[i]));
+    }
+
+    double const perElem = 1.0 / double(count * repeats);
+    std::printf("%-26s %8.3f ns/pos scalar %8.3f ns/pos soa-aos %8.3f ns/pos soa-soa %8.3f ns/pos meters (sum %g)\n",
+                name,
+                double(duration_cast<nanoseconds>(timeB - timeA).count()) * perElem,
+                double(duration_cast<nanoseconds>(timeC - timeB).count()) * perElem,
+                double(duration_cast<nanoseconds>(timeD - timeC).count()) * perElem,
+                double(duration_cast<nanoseconds>(timeE - timeD).count()) * perElem,
+                sumMeters);
+}
+
+// Benchmark batch position transforms across precision deltas and rotations
+TEST(Universe, CoordTransformerBenchmark)
+{
+    CoSpaceTransform const coarse
+    {
+        .m_precision = 10 // 2^10 units = 1 meter
+    };
+    CoSpaceTransform const sibling
+    {
+        .m_position  = {sci64(150, 9, 10), sci64(150, 9, 10), sci64(42, 0, 10)},
+        .m_precision = 10
+    };
+    CoSpaceTransform const fine
+    {
+        .m_position  = {sci64(150, 9, 10), sci64(150, 9, 10), sci64(42, 0, 10)},
+        .m_precision = 16
+    };
+    CoSpaceTransform const rotated
+    {
+        .m_rotation  = Quaterniond::rotation(90.0_deg, {0.0, 0.0, 1.0}),
+        .m_position  = {sci64(150, 9, 10), sci64(150, 9, 10), sci64(42, 0, 10)},
+        .m_precision = 13
+    };
+
+    BenchSats sats = make_bench_sats(1u << 14);
+
+    // Translation only (n = 0), shift-up (n = +6), shift-down (n = -6), and
+    // the rotated fallback, in both parent-to-child and child-to-parent forms
+    bench_transformer("translate-only",   coord_parent_to_child(coarse, sibling), sats, 10);
+    bench_transformer("shift-up   n=+6",  coord_parent_to_child(coarse, fine),    sats, 16);
+    bench_transformer("shift-down n=-6",  coord_child_to_parent(coarse, fine),    sats, 10);
+    bench_transformer("rotated    p->c",  coord_parent_to_child(coarse, rotated), sats, 13);
+    bench_transformer("rotated    c->p",  coord_child_to_parent(coarse, rotated), sats, 10);
+}